@@ -111,16 +111,20 @@ const char* loadFromFile(const std::string& pathToFile, std::string& content)
     return content.c_str();
 }
 
-void processInput(GLFWwindow* window)
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    // GLFW_REPEAT while held, acting on GLFW_PRESS only toggles once per press
+    if(action != GLFW_PRESS) {
+        return;
+    }
+
     // press ESC to quit
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+    if(key == GLFW_KEY_ESCAPE) {
         glfwSetWindowShouldClose(window, true);
     }
 
-    // ugly but works
     static bool wireframe = false;
-    if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
+    if(key == GLFW_KEY_W) {
         wireframe = !wireframe;
         glPolygonMode(GL_FRONT_AND_BACK, wireframe ? GL_LINE : GL_FILL);
     }
@@ -225,6 +229,7 @@ int main(int argc, char** argv)
 
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
 
     // glad init
     checkResult(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0, "gladLoadGLLoader");
@@ -258,9 +263,6 @@ int main(int argc, char** argv)
     glEnable(GL_DEPTH_TEST);
 
     while(!glfwWindowShouldClose(window)) {
-        // check pressed input
-        processInput(window);
-
         model =  glm::rotate(model, (float)glfwGetTime() * glm::radians(0.05f), glm::vec3(0.5f, 1.0f, 0.0f));
 
         // fill screen with greenish color
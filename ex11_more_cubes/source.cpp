@@ -1,23 +1,50 @@
 // What's new:
-// Enhance previous example to rotate a cube.
-
-// It is remarkable that no changes are required to the shader. Just to
-// vertices and minor changes to the code used to draw on screen .
+// - Ten cubes at fixed positions, their model matrices computed by the compiler
+//   with GLM_GTX_matrix_transform_constexpr.
+// - Vertices packed by the vertex format compiler (gl_vertex_format.h): half
+//   float positions and 16 bit normalized texture coords, 12 bytes per vertex.
+// - Every bind goes through gl::StateCache, which drops the redundant ones.
+// - Cubes are drawn through gl::RenderQueue, sorted by state then front to back.
+// - shader_vertex.glsl and shader_fragment.glsl are rebuilt by gl::ShaderReloader
+//   when edited while the example runs.
+// - With --on-demand, gl::FrameScheduler draws a frame only when an input, a
+//   resize or a shader rebuild asks for one.
+// - gl::Profiler writes the CPU and GPU time of the last 600 frames to
+//   ex11_trace.json, and glad built with make INSTRUMENT=1 writes its call
+//   counts to gl_calls.json.
+// - With --frames n, n frames are drawn in a hidden window, then the average
+//   time of each scope is printed and the example exits, with a failure if
+//   GL reported an error. This is the run for CI on a software renderer,
+//   e.g. LIBGL_ALWAYS_SOFTWARE=1 ./result --frames 300 for Mesa's llvmpipe.
 
 #include <iostream>
-#include <fstream>
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
 
 #include <glad/glad.h>
+#include <glad/glad_instrument.h>
+#include <gl_state_cache.h>
+#include <gl_profiler.h>
+#include <gl_render_queue.h>
+#include <gl_shader_reload.h>
+#include <gl_frame_scheduler.h>
 #include <GLFW/glfw3.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
 // math lib
+#define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/matrix_transform_constexpr.hpp>
+
+// quantized vertices, uses glm
+#include <gl_vertex_format.h>
 
 #define SCREEN_WIDTH 640
 #define SCREEN_HEIGHT 480
@@ -67,7 +94,7 @@ GLfloat vertices[] = {
     -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
 };
 
-glm::vec3 cubePositions[] = {
+constexpr glm::vec3 cubePositions[] = {
   glm::vec3( 0.0f,  0.0f,  0.0f),
   glm::vec3( 2.0f,  5.0f, -15.0f),
   glm::vec3(-1.5f, -2.2f, -2.5f),
@@ -79,19 +106,32 @@ glm::vec3 cubePositions[] = {
   glm::vec3( 1.5f,  0.2f, -1.5f),
   glm::vec3(-1.3f,  1.0f, -1.5f)
 };
+constexpr unsigned int cubeCount = sizeof(cubePositions) / sizeof(cubePositions[0]);
 
-void checkShaderCompilationStatus(GLuint shader, const char* text)
+// cubes don't move, so their model matrices are computed by the compiler
+struct CubeModels
 {
-    int success;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    if(!success) {
-    char infoLog[512];
-        glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
-        std::cerr << text << " shader compilation error: " << infoLog << '\n';
-        exit(EXIT_FAILURE);
+    glm::mat4 m[cubeCount];
+};
+
+constexpr CubeModels createCubeModels()
+{
+    CubeModels models{};
+    for(unsigned int i = 0; i < cubeCount; i++) {
+        models.m[i] = glm::constexprTranslate(glm::mat4(1.0f), cubePositions[i]);
+        models.m[i] = glm::constexprRotate(models.m[i], glm::radians(20.0f * i), glm::vec3(1.0f, 0.3f, 0.5f));
     }
+    return models;
 }
 
+constexpr CubeModels cubeModels = createCubeModels();
+
+// every state change goes through the cache, which drops the ones that change nothing
+gl::StateCache glState;
+
+// with --on-demand, frames are drawn only when something changes
+gl::FrameScheduler redraw;
+
 void checkResult(bool result, const char* text)
 {
     if( result ) {
@@ -103,110 +143,71 @@ void checkResult(bool result, const char* text)
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-    glViewport(0,0,width, height);
+    glState.viewport(0,0,width, height);
+    redraw.invalidate();
 }
 
-const char* loadFromFile(const std::string& pathToFile, std::string& content)
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
-    content = "";
-    // std::string content;
-    std::ifstream fileStream(pathToFile, std::ios::in);
-
-    if(!fileStream.is_open()) {
-        std::cerr << "Could not read file " << pathToFile << std::endl;
-    }
-
-    std::string line = "";
-    while(!fileStream.eof()) {
-        std::getline(fileStream, line);
-        content.append(line + "\n");
+    // GLFW_REPEAT while held, acting on GLFW_PRESS only toggles once per press
+    if(action != GLFW_PRESS) {
+        return;
     }
-    return content.c_str();
-}
 
-void processInput(GLFWwindow* window)
-{
     // press ESC to quit
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+    if(key == GLFW_KEY_ESCAPE) {
         glfwSetWindowShouldClose(window, true);
     }
 
-    // ugly but works
     static bool wireframe = false;
-    if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
+    if(key == GLFW_KEY_W) {
         wireframe = !wireframe;
-        glPolygonMode(GL_FRONT_AND_BACK, wireframe ? GL_LINE : GL_FILL);
+        glState.polygonMode(wireframe ? GL_LINE : GL_FILL);
+        redraw.invalidate();
     }
 }
 
-void createArrays(GLuint& vbo, GLuint& vao, GLuint& ebo)
+// the window was uncovered or needs drawing again for some other reason
+void refresh_callback(GLFWwindow* window)
 {
-    // this store vertex data in video card memory, managed by a vertex buffer object(VBO)
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-
-    // Stride was updated attributes before texture coordinates.
-    glVertexAttribPointer(0, 3 ,GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*) 0) ;
-    glEnableVertexAttribArray(0);
-
-    // texture coords
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*) (3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    redraw.invalidate();
 }
 
-GLuint createShaderProgram()
+void createArrays(gl::Buffer& vbo, gl::VertexArray& vao)
 {
-    // vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    std::string source;
-    const char* shaderSource = loadFromFile("shader_vertex.glsl", source);
-
-    glShaderSource(vertexShader, 1, &shaderSource, nullptr);
-    glCompileShader(vertexShader);
-    checkShaderCompilationStatus(vertexShader, "Vertex");
-
-    // fragment shader
-    GLuint fragShader = glCreateShader(GL_FRAGMENT_SHADER);
-
-    shaderSource = loadFromFile("shader_fragment.glsl", source);
-    glShaderSource(fragShader, 1, &shaderSource, nullptr);
-    glCompileShader(fragShader);
-    checkShaderCompilationStatus(fragShader, "Fragment");
-
-    // shader program linking
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragShader);
-    glLinkProgram(shaderProgram);
-
-    int success;
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if(!success) {
-        char infoLog[512];
-        glGetProgramInfoLog(shaderProgram, sizeof(infoLog), nullptr, infoLog);
-        std::cerr << "Shader program creation error: " << infoLog << '\n';
-        exit(EXIT_FAILURE);
-    }
+    // Positions as half floats and texture coords as 16 bit normalized
+    // integers, 12 bytes per vertex instead of 20. The vertex fetch converts
+    // them back to floats, so the shader doesn't change.
+    gl::VertexSource source;
+    source.positions = vertices;
+    source.texCoords = vertices + 3;
+    source.count = sizeof(vertices) / (5 * sizeof(GLfloat));
+    source.stride = 5;
+
+    gl::VertexFormat format;
+    format.position = gl::PositionEncoding::Half;
+    format.texCoord = gl::TexCoordEncoding::Unorm16;
+    const gl::CompiledVertices compiled = gl::compileVertices(source, format);
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragShader);
+    // this store vertex data in video card memory, managed by a vertex buffer object(VBO)
+    vbo = glState.createBuffer();
+    glState.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(compiled.data.size()), compiled.data.data(), GL_STATIC_DRAW);
 
-    return shaderProgram;
+    vao = glState.createVertexArray();
+    glState.bindVertexArray(vao);
+    compiled.setAttributes(glState, vbo);
 }
 
 // This is new!
-GLuint createTextures(int vao, const std::string& texFilename, GLenum format = GL_RGB) {
-    GLuint texture;
+gl::Texture createTextures(const std::string& texFilename, GLenum format = GL_RGB) {
+    gl::Texture texture;
     int width, height, nrChannels;
     unsigned char* data = stbi_load( texFilename.c_str(), &width, &height, &nrChannels, 0);
 
     if(data) {
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        texture = glState.createTexture();
+        glState.bindTexture(0, GL_TEXTURE_2D, texture);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, format, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
 
@@ -217,91 +218,188 @@ GLuint createTextures(int vao, const std::string& texFilename, GLenum format = G
     else {
         std::cout << "couldn't load texture: " << texFilename << std::endl;
     }
-    return 0;
+    return gl::Texture();
 }
 
 
 int main(int argc, char** argv)
 {
+    // 0 runs until the window is closed
+    long frameLimit = 0;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--on-demand") {
+            redraw.setOnDemand(true);
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frameLimit = std::max(1L, std::atol(argv[++i]));
+        }
+        else {
+            std::cerr << "usage: result [--on-demand] [--frames n]\n";
+            return EXIT_FAILURE;
+        }
+    }
+    // a fixed number of frames is a measure, drawn whether anything changes or not
+    if(frameLimit != 0) {
+        redraw.setOnDemand(false);
+    }
+
     // gl init
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, frameLimit == 0 ? GLFW_TRUE : GLFW_FALSE);
 
     GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "My OGL Example Window", nullptr, nullptr);
     checkResult(window == nullptr, "glfwCreateWindow");
 
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetWindowRefreshCallback(window, refresh_callback);
+    redraw.setWake(glfwPostEmptyEvent);
 
     // glad init
     checkResult(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0, "gladLoadGLLoader");
 
-    GLuint vbo, vao, ebo;
-    createArrays(vbo, vao, ebo);
-    GLuint shaderProgram = createShaderProgram();
+    gl::Buffer vbo;
+    gl::VertexArray vao;
+    createArrays(vbo, vao);
 
-
-    glm::mat4 view = glm::mat4(1.0f);
-    view = glm::translate(view, glm::vec3(0.0f, 0.0f, -3.0f));
-    glm::mat4 projection;
-    projection = glm::perspective(glm::radians(45.0f), (float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, 0.1f, 100.0f);
-
-    // load textures
-    GLuint texture1 = createTextures(vao, "../res/container.jpg");
-    GLuint texture2 = createTextures(vao, "../res/awesomeface.png", GL_RGBA);
-    if(texture1==0 || texture2 == 0) {
+    // edits to the .glsl files show up while the example runs
+    gl::ShaderReloader shaders(glState);
+    const unsigned int cubeShaders = shaders.add("shader_vertex.glsl", "shader_fragment.glsl");
+    if(shaders.program(cubeShaders).id == 0) {
+        std::cerr << "Shader program creation error: " << shaders.log(cubeShaders) << '\n';
         return EXIT_FAILURE;
     }
+    if(!shaders.watchError().empty()) {
+        std::cerr << "Shader watch error: " << shaders.watchError() << '\n';
+    }
+    gl::Program shaderProgram = shaders.program(cubeShaders);
 
-    glUseProgram(shaderProgram);
-    glUniform1i(glGetUniformLocation(shaderProgram, "texture1"), 0);
-    glUniform1i(glGetUniformLocation(shaderProgram, "texture2"), 1);
 
-    int uniMatrixModel = glGetUniformLocation(shaderProgram, "model");
-    int uniMatrixView = glGetUniformLocation(shaderProgram, "view");
-    int uniMatrixProj = glGetUniformLocation(shaderProgram, "projection");
+    constexpr glm::mat4 view = glm::constexprTranslate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -3.0f));
+    constexpr glm::mat4 projection = glm::constexprPerspective(glm::radians(45.0f), (float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, 0.1f, 100.0f);
 
-    glEnable(GL_DEPTH_TEST);
+    // load textures
+    gl::Texture texture1 = createTextures("../res/container.jpg");
+    gl::Texture texture2 = createTextures("../res/awesomeface.png", GL_RGBA);
+    if(texture1.id == 0 || texture2.id == 0) {
+        return EXIT_FAILURE;
+    }
 
-    while(!glfwWindowShouldClose(window)) {
-        // check pressed input
-        processInput(window);
+    glState.useProgram(shaderProgram);
+    glUniform1i(glGetUniformLocation(shaderProgram.id, "texture1"), 0);
+    glUniform1i(glGetUniformLocation(shaderProgram.id, "texture2"), 1);
+
+    int uniMatrixModel = glGetUniformLocation(shaderProgram.id, "model");
+    int uniMatrixView = glGetUniformLocation(shaderProgram.id, "view");
+    int uniMatrixProj = glGetUniformLocation(shaderProgram.id, "projection");
+
+    // view and projection don't change, uniforms keep their value between frames
+    glUniformMatrix4fv(uniMatrixView, 1, GL_FALSE, glm::value_ptr(view));
+    glUniformMatrix4fv(uniMatrixProj, 1, GL_FALSE, glm::value_ptr(projection));
+
+    glState.enable(GL_DEPTH_TEST);
+
+    // cubes go through the render queue, sorted by state then front to back
+    gl::RenderQueue renderQueue;
+    const gl::Texture cubeTextures[] = { texture1, texture2 };
+    const unsigned int cubeProgram = renderQueue.registerProgram(shaderProgram, uniMatrixModel);
+    const unsigned int cubeMaterial = renderQueue.registerMaterial(cubeTextures, 2);
+    const unsigned int cubeArray = renderQueue.registerVertexArray(vao);
+
+    // a rebuilt program keeps the textures units and matrices set above,
+    // only the location of model may have moved
+    shaders.onSwap([&](unsigned int, gl::Program, gl::Program program) {
+        renderQueue.replaceProgram(cubeProgram, program, glGetUniformLocation(program.id, "model"));
+        redraw.invalidate();
+    });
+
+    // CPU and GPU time of each part of the last 600 frames, written to
+    // ex11_trace.json
+    gl::Profiler profiler(600);
+    long frames = 0;
+
+    while(!glfwWindowShouldClose(window) && (frameLimit == 0 || frames < frameLimit)) {
+        // input and resizes come through the callbacks, on demand the loop
+        // sleeps until one of them or a timer
+        const double wait = redraw.waitTime(glfwGetTime());
+        if(wait == 0.0) {
+            glfwPollEvents();
+        }
+        else if(wait < 0.0) {
+            glfwWaitEvents();
+        }
+        else {
+            glfwWaitEventsTimeout(wait);
+        }
 
-        // fill screen with greenish color
-        glClearColor( 0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // a millisecond of the frame at most goes to rebuilding, the files
+        // are looked at every frame during a rebuild, else 4 times a second
+        const unsigned long failures = shaders.failureCount(cubeShaders);
+        shaders.update(1.0);
+        if(shaders.failureCount(cubeShaders) != failures) {
+            std::cerr << shaders.log(cubeShaders) << '\n';
+        }
+        redraw.wakeAt(glfwGetTime() + (shaders.pending(cubeShaders) ? 1.0 / 60.0 : 0.25));
 
-        // bind textures on corresponding texture units
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, texture2);
+        if(!redraw.beginFrame(glfwGetTime())) {
+            continue;
+        }
+        profiler.beginFrame();
 
-        glUniformMatrix4fv(uniMatrixView, 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(uniMatrixProj, 1, GL_FALSE, glm::value_ptr(projection));
+        {
+            gl::Profiler::Scope scope(profiler, "clear");
+            // fill screen with greenish color
+            glClearColor( 0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
 
-        // let's draw
-        glUseProgram(shaderProgram);
+        {
+            gl::Profiler::Scope scope(profiler, "draw cubes");
+            renderQueue.clear();
+            for(unsigned int i = 0; i < cubeCount; i++)
+            {
+                // the camera sits at z = 3 looking down -z
+                const std::uint32_t depth = gl::RenderQueue::depthKey(3.0f - cubePositions[i].z, 100.0f);
+                renderQueue.submit(0, cubeProgram, cubeMaterial, cubeArray, depth,
+                                   { GL_TRIANGLES, 0, 36, glm::value_ptr(cubeModels.m[i]) });
+            }
+            renderQueue.sort();
+            renderQueue.execute(glState);
+        }
 
-        glBindVertexArray(vbo);
-        for(unsigned int i = 0; i < 10; i++)
         {
-            glm::mat4 model = glm::mat4(1.0f);
-            model = glm::translate(model, cubePositions[i]);
-            float angle = 20.0f * i;
-            model = glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
-            glUniformMatrix4fv(uniMatrixModel, 1, GL_FALSE, glm::value_ptr(model));
-
-            // Now use 6 vertices
-            glDrawArrays(GL_TRIANGLES, 0, 36);
+            gl::Profiler::Scope scope(profiler, "swap");
+            glfwSwapBuffers(window);
         }
+        profiler.endFrame();
+        frames++;
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        // only counts when glad is built with make INSTRUMENT=1
+        gladInstrumentEndFrame();
     }
 
+    gladInstrumentWriteJSON("gl_calls.json");
+    profiler.writeChromeTrace("ex11_trace.json");
+
+    int result = EXIT_SUCCESS;
+    if(frameLimit != 0) {
+        std::printf("%ld frames, %s, %lu dropped\n", frames, reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                    profiler.droppedFrames());
+        std::printf("%-12s %8s %10s %10s\n", "", "count", "cpu", "gpu");
+        for(const gl::Profiler::Summary& scope : profiler.summary()) {
+            std::printf("%-12s %8lu %7.3f ms %7.3f ms\n", scope.name.c_str(), scope.count, scope.cpu, scope.gpu);
+        }
+        const GLenum error = glGetError();
+        if(error != GL_NO_ERROR) {
+            std::cerr << "Error: GL error 0x" << std::hex << error << '\n';
+            result = EXIT_FAILURE;
+        }
+    }
     glfwTerminate();
-    return EXIT_SUCCESS;
+    return result;
 }
@@ -53,16 +53,20 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     glViewport(0,0,width, height);
 }
 
-void processInput(GLFWwindow* window)
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    // GLFW_REPEAT while held, acting on GLFW_PRESS only toggles once per press
+    if(action != GLFW_PRESS) {
+        return;
+    }
+
     // press ESC to quit
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+    if(key == GLFW_KEY_ESCAPE) {
         glfwSetWindowShouldClose(window, true);
     }
 
-    // ugly but works
     static bool wireframe = false;
-    if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
+    if(key == GLFW_KEY_W) {
         wireframe = !wireframe;
         glPolygonMode(GL_FRONT_AND_BACK, wireframe ? GL_LINE : GL_FILL);
     }
@@ -137,6 +141,7 @@ int main(int argc, char** argv)
 
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
 
     // glad init
     checkResult(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0, "gladLoadGLLoader");
@@ -146,9 +151,6 @@ int main(int argc, char** argv)
     GLuint shaderProgram = createShaderProgram();
 
     while(!glfwWindowShouldClose(window)) {
-        // check pressed input
-        processInput(window);
-
         // fill screen with greenish color
         glClearColor( 0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
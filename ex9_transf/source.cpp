@@ -1,10 +1,12 @@
 // What's new:
 // - Colors from vertices array were removed. Remains triangle positions and texture cords.
 // - Added model, view and projection matrices to source code and to shader code.
+// - With --on-demand, draw only when an input, a resize or a refresh asks for a frame.
 
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <string>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -55,9 +57,15 @@ void checkResult(bool result, const char* text)
     }
 }
 
+// with --on-demand, a frame is drawn only when something asks for it, the
+// scene never changes on its own
+bool onDemand = false;
+bool redraw = true;
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
     glViewport(0,0,width, height);
+    redraw = true;
 }
 
 const char* loadFromFile(const std::string& pathToFile, std::string& content)
@@ -78,21 +86,32 @@ const char* loadFromFile(const std::string& pathToFile, std::string& content)
     return content.c_str();
 }
 
-void processInput(GLFWwindow* window)
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    // GLFW_REPEAT while held, acting on GLFW_PRESS only toggles once per press
+    if(action != GLFW_PRESS) {
+        return;
+    }
+
     // press ESC to quit
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+    if(key == GLFW_KEY_ESCAPE) {
         glfwSetWindowShouldClose(window, true);
     }
 
-    // ugly but works
     static bool wireframe = false;
-    if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
+    if(key == GLFW_KEY_W) {
         wireframe = !wireframe;
         glPolygonMode(GL_FRONT_AND_BACK, wireframe ? GL_LINE : GL_FILL);
+        redraw = true;
     }
 }
 
+// the window was uncovered or needs drawing again for some other reason
+void refresh_callback(GLFWwindow* window)
+{
+    redraw = true;
+}
+
 void createArrays(GLuint& vbo, GLuint& vao, GLuint& ebo)
 {
     // this store vertex data in video card memory, managed by a vertex buffer object(VBO)
@@ -187,6 +206,8 @@ GLuint createTextures(int vao, const std::string& texFilename, GLenum format = G
 
 int main(int argc, char** argv)
 {
+    onDemand = argc > 1 && std::string(argv[1]) == "--on-demand";
+
     // gl init
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -202,6 +223,8 @@ int main(int argc, char** argv)
 
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetWindowRefreshCallback(window, refresh_callback);
 
     // glad init
     checkResult(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0, "gladLoadGLLoader");
@@ -232,8 +255,12 @@ int main(int argc, char** argv)
     int uniMatrixProj = glGetUniformLocation(shaderProgram, "projection");
 
     while(!glfwWindowShouldClose(window)) {
-        // check pressed input
-        processInput(window);
+        // on demand, sleep until an input, a resize or a refresh asks for a frame
+        if(onDemand && !redraw) {
+            glfwWaitEvents();
+            continue;
+        }
+        redraw = false;
 
         // fill screen with greenish color
         glClearColor( 0.2f, 0.3f, 0.3f, 1.0f);
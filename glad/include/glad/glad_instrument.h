@@ -0,0 +1,39 @@
+/*
+
+    Call counting and timing for the instrumented build of the loader.
+
+    Build glad.c with GLAD_INSTRUMENT defined: gladLoadGL and gladLoadGLLoader
+    then replace every glad_gl* pointer by a wrapper that counts the calls,
+    measures the CPU time spent in the driver and flags the calls that don't
+    change the state: glUseProgram, glActiveTexture, glBindTexture and
+    glBindVertexArray with the object already bound, glUniform* and
+    glProgramUniform* with the value the uniform already has.
+
+    The functions below do nothing in a regular build, so they can be left in
+    the application code.
+
+*/
+
+#ifndef __glad_instrument_h_
+#define __glad_instrument_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Ends the current frame, its counters become the last frame summary. */
+GLAPI void gladInstrumentEndFrame(void);
+
+/* Clears the counters of the current frame, the last frame and the totals. */
+GLAPI void gladInstrumentReset(void);
+
+/* Writes the last frame summary and the totals as JSON, returns 0 on failure. */
+GLAPI int gladInstrumentWriteJSON(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
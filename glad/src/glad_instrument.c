@@ -0,0 +1,297 @@
+/*
+
+    Instrumented build of the loader, see glad/glad_instrument.h.
+    Included at the end of glad.c, the wrappers themselves are generated
+    in glad_instrument_gen.h by wrappers.py.
+
+*/
+
+#include <glad/glad_instrument.h>
+
+#ifdef GLAD_INSTRUMENT
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static unsigned long long glad_instrument_now(void) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if(frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+/* Bound objects, GLAD_INSTRUMENT_UNKNOWN until the application binds something
+   through the loader. The active texture unit starts at 0, as in a new context,
+   so that textures bound before any glActiveTexture are tracked. Only the first
+   texture units and the common targets are tracked, binding anything else is
+   never reported as redundant. */
+
+#define GLAD_INSTRUMENT_UNKNOWN 0xffffffffu
+#define GLAD_INSTRUMENT_TEXTURE_UNITS 32
+#define GLAD_INSTRUMENT_TEXTURE_TARGETS 10
+
+static GLuint glad_instrument_program = GLAD_INSTRUMENT_UNKNOWN;
+static GLuint glad_instrument_vertex_array = GLAD_INSTRUMENT_UNKNOWN;
+static GLuint glad_instrument_unit = 0;
+static GLuint glad_instrument_textures[GLAD_INSTRUMENT_TEXTURE_UNITS][GLAD_INSTRUMENT_TEXTURE_TARGETS];
+
+static void glad_instrument_record(int index, unsigned long long start, int redundant);
+static int glad_instrument_uniform(int tag, GLuint program, GLint location, const void *value, size_t size);
+static int glad_instrument_use_program(GLuint program);
+static int glad_instrument_active_texture(GLenum texture);
+static int glad_instrument_bind_texture(GLenum target, GLuint texture);
+static int glad_instrument_bind_vertex_array(GLuint array);
+static int glad_instrument_delete_textures(GLsizei n, const GLuint *textures);
+static int glad_instrument_delete_vertex_arrays(GLsizei n, const GLuint *arrays);
+static int glad_instrument_forget_program(GLuint program);
+
+#include "glad_instrument_gen.h"
+
+struct glad_instrument_counters {
+    unsigned long long calls;
+    unsigned long long ns;
+    unsigned long long redundant;
+};
+
+static struct glad_instrument_counters glad_instrument_frame[GLAD_INSTRUMENT_COUNT];
+static struct glad_instrument_counters glad_instrument_last[GLAD_INSTRUMENT_COUNT];
+static struct glad_instrument_counters glad_instrument_total[GLAD_INSTRUMENT_COUNT];
+static unsigned long long glad_instrument_frames = 0;
+
+static void glad_instrument_record(int index, unsigned long long start, int redundant) {
+    struct glad_instrument_counters *counters = &glad_instrument_frame[index];
+    counters->ns += glad_instrument_now() - start;
+    counters->calls++;
+    counters->redundant += (unsigned long long)(redundant != 0);
+}
+
+static int glad_instrument_texture_target(GLenum target) {
+    switch(target) {
+        case GL_TEXTURE_1D: return 0;
+        case GL_TEXTURE_2D: return 1;
+        case GL_TEXTURE_3D: return 2;
+        case GL_TEXTURE_1D_ARRAY: return 3;
+        case GL_TEXTURE_2D_ARRAY: return 4;
+        case GL_TEXTURE_RECTANGLE: return 5;
+        case GL_TEXTURE_CUBE_MAP: return 6;
+        case GL_TEXTURE_BUFFER: return 7;
+        case GL_TEXTURE_2D_MULTISAMPLE: return 8;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 9;
+        default: return -1;
+    }
+}
+
+static int glad_instrument_use_program(GLuint program) {
+    int redundant = glad_instrument_program == program;
+    glad_instrument_program = program;
+    return redundant;
+}
+
+static int glad_instrument_active_texture(GLenum texture) {
+    GLuint unit = (GLuint)(texture - GL_TEXTURE0);
+    int redundant = glad_instrument_unit == unit;
+    glad_instrument_unit = unit;
+    return redundant;
+}
+
+static int glad_instrument_bind_texture(GLenum target, GLuint texture) {
+    int index = glad_instrument_texture_target(target);
+    GLuint *bound;
+    int redundant;
+    if(index < 0 || glad_instrument_unit >= GLAD_INSTRUMENT_TEXTURE_UNITS) return 0;
+
+    bound = &glad_instrument_textures[glad_instrument_unit][index];
+    redundant = *bound == texture;
+    *bound = texture;
+    return redundant;
+}
+
+static int glad_instrument_bind_vertex_array(GLuint array) {
+    int redundant = glad_instrument_vertex_array == array;
+    glad_instrument_vertex_array = array;
+    return redundant;
+}
+
+static int glad_instrument_delete_textures(GLsizei n, const GLuint *textures) {
+    GLsizei i;
+    int unit, target;
+    /* deleting a bound texture binds 0 in its place */
+    for(i = 0; i < n; i++) {
+        for(unit = 0; unit < GLAD_INSTRUMENT_TEXTURE_UNITS; unit++) {
+            for(target = 0; target < GLAD_INSTRUMENT_TEXTURE_TARGETS; target++) {
+                if(textures[i] != 0 && glad_instrument_textures[unit][target] == textures[i]) {
+                    glad_instrument_textures[unit][target] = 0;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static int glad_instrument_delete_vertex_arrays(GLsizei n, const GLuint *arrays) {
+    GLsizei i;
+    for(i = 0; i < n; i++) {
+        if(arrays[i] != 0 && glad_instrument_vertex_array == arrays[i]) {
+            glad_instrument_vertex_array = 0;
+        }
+    }
+    return 0;
+}
+
+/* Last value set to each uniform of each program, keyed by program and
+   location in an open addressing table. Values are compared through a 64 bit
+   FNV-1a hash of their bytes and of the glUniform* variant used. Uniforms
+   that don't fit in the table are never reported as redundant. */
+
+#define GLAD_INSTRUMENT_UNIFORMS 4096
+
+struct glad_instrument_uniform_entry {
+    unsigned long long key;
+    unsigned long long hash;
+};
+
+static struct glad_instrument_uniform_entry glad_instrument_uniforms[GLAD_INSTRUMENT_UNIFORMS];
+
+static unsigned long long glad_instrument_hash(int tag, const void *value, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)value;
+    unsigned long long hash = 14695981039346656037ull ^ (unsigned long long)tag;
+    size_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/* program is the bound one for glUniform, the named one for glProgramUniform */
+static int glad_instrument_uniform(int tag, GLuint program, GLint location, const void *value, size_t size) {
+    unsigned long long key, hash;
+    size_t slot, probe;
+    if(program == GLAD_INSTRUMENT_UNKNOWN || program == 0 || location < 0 || value == NULL) return 0;
+
+    /* key 0 marks an empty slot */
+    key = ((unsigned long long)program << 32) | ((unsigned long long)location + 1);
+    hash = glad_instrument_hash(tag, value, size);
+    slot = (size_t)((key * 11400714819323198485ull) >> 52);
+    for(probe = 0; probe < GLAD_INSTRUMENT_UNIFORMS; probe++) {
+        struct glad_instrument_uniform_entry *entry = &glad_instrument_uniforms[(slot + probe) % GLAD_INSTRUMENT_UNIFORMS];
+        if(entry->key == key) {
+            int redundant = entry->hash == hash;
+            entry->hash = hash;
+            return redundant;
+        }
+        if(entry->key == 0) {
+            entry->key = key;
+            entry->hash = hash;
+            return 0;
+        }
+    }
+    return 0;
+}
+
+static int glad_instrument_forget_program(GLuint program) {
+    /* linking resets the uniforms, deleting may reuse the name: drop the whole
+       table rather than leave holes in the probe sequences */
+    size_t i;
+    for(i = 0; i < GLAD_INSTRUMENT_UNIFORMS; i++) {
+        if((GLuint)(glad_instrument_uniforms[i].key >> 32) == program) {
+            memset(glad_instrument_uniforms, 0, sizeof(glad_instrument_uniforms));
+            break;
+        }
+    }
+    return 0;
+}
+
+static void glad_instrument_install(void) {
+    int unit, target;
+    glad_instrument_program = GLAD_INSTRUMENT_UNKNOWN;
+    glad_instrument_vertex_array = GLAD_INSTRUMENT_UNKNOWN;
+    glad_instrument_unit = 0;
+    for(unit = 0; unit < GLAD_INSTRUMENT_TEXTURE_UNITS; unit++) {
+        for(target = 0; target < GLAD_INSTRUMENT_TEXTURE_TARGETS; target++) {
+            glad_instrument_textures[unit][target] = GLAD_INSTRUMENT_UNKNOWN;
+        }
+    }
+    memset(glad_instrument_uniforms, 0, sizeof(glad_instrument_uniforms));
+    glad_instrument_wrap_all();
+}
+
+void gladInstrumentEndFrame(void) {
+    int index;
+    for(index = 0; index < GLAD_INSTRUMENT_COUNT; index++) {
+        glad_instrument_total[index].calls += glad_instrument_frame[index].calls;
+        glad_instrument_total[index].ns += glad_instrument_frame[index].ns;
+        glad_instrument_total[index].redundant += glad_instrument_frame[index].redundant;
+    }
+    memcpy(glad_instrument_last, glad_instrument_frame, sizeof(glad_instrument_frame));
+    memset(glad_instrument_frame, 0, sizeof(glad_instrument_frame));
+    glad_instrument_frames++;
+}
+
+void gladInstrumentReset(void) {
+    memset(glad_instrument_frame, 0, sizeof(glad_instrument_frame));
+    memset(glad_instrument_last, 0, sizeof(glad_instrument_last));
+    memset(glad_instrument_total, 0, sizeof(glad_instrument_total));
+    glad_instrument_frames = 0;
+}
+
+static void glad_instrument_write_counters(FILE *file, const struct glad_instrument_counters *counters) {
+    struct glad_instrument_counters sum = { 0, 0, 0 };
+    int index, first = 1;
+
+    for(index = 0; index < GLAD_INSTRUMENT_COUNT; index++) {
+        sum.calls += counters[index].calls;
+        sum.ns += counters[index].ns;
+        sum.redundant += counters[index].redundant;
+    }
+
+    fprintf(file, "{\"calls\": %llu, \"ns\": %llu, \"redundant\": %llu, \"functions\": [",
+            sum.calls, sum.ns, sum.redundant);
+    for(index = 0; index < GLAD_INSTRUMENT_COUNT; index++) {
+        if(counters[index].calls == 0) continue;
+        fprintf(file, "%s\n    {\"name\": \"%s\", \"calls\": %llu, \"ns\": %llu, \"redundant\": %llu}",
+                first ? "" : ",", glad_instrument_names[index],
+                counters[index].calls, counters[index].ns, counters[index].redundant);
+        first = 0;
+    }
+    fprintf(file, "\n  ]}");
+}
+
+int gladInstrumentWriteJSON(const char *path) {
+    FILE *file = fopen(path, "w");
+    if(file == NULL) return 0;
+
+    fprintf(file, "{\n  \"frames\": %llu,\n  \"last_frame\": ", glad_instrument_frames);
+    glad_instrument_write_counters(file, glad_instrument_last);
+    fprintf(file, ",\n  \"total\": ");
+    glad_instrument_write_counters(file, glad_instrument_total);
+    fprintf(file, "\n}\n");
+
+    return fclose(file) == 0;
+}
+
+#else
+
+void gladInstrumentEndFrame(void) {
+}
+
+void gladInstrumentReset(void) {
+}
+
+int gladInstrumentWriteJSON(const char *path) {
+    (void)path;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,8653 @@
+/* Generated by wrappers.py from glad.h, do not edit. */
+
+enum {
+    GLAD_INSTRUMENT_glCullFace,
+    GLAD_INSTRUMENT_glFrontFace,
+    GLAD_INSTRUMENT_glHint,
+    GLAD_INSTRUMENT_glLineWidth,
+    GLAD_INSTRUMENT_glPointSize,
+    GLAD_INSTRUMENT_glPolygonMode,
+    GLAD_INSTRUMENT_glScissor,
+    GLAD_INSTRUMENT_glTexParameterf,
+    GLAD_INSTRUMENT_glTexParameterfv,
+    GLAD_INSTRUMENT_glTexParameteri,
+    GLAD_INSTRUMENT_glTexParameteriv,
+    GLAD_INSTRUMENT_glTexImage1D,
+    GLAD_INSTRUMENT_glTexImage2D,
+    GLAD_INSTRUMENT_glDrawBuffer,
+    GLAD_INSTRUMENT_glClear,
+    GLAD_INSTRUMENT_glClearColor,
+    GLAD_INSTRUMENT_glClearStencil,
+    GLAD_INSTRUMENT_glClearDepth,
+    GLAD_INSTRUMENT_glStencilMask,
+    GLAD_INSTRUMENT_glColorMask,
+    GLAD_INSTRUMENT_glDepthMask,
+    GLAD_INSTRUMENT_glDisable,
+    GLAD_INSTRUMENT_glEnable,
+    GLAD_INSTRUMENT_glFinish,
+    GLAD_INSTRUMENT_glFlush,
+    GLAD_INSTRUMENT_glBlendFunc,
+    GLAD_INSTRUMENT_glLogicOp,
+    GLAD_INSTRUMENT_glStencilFunc,
+    GLAD_INSTRUMENT_glStencilOp,
+    GLAD_INSTRUMENT_glDepthFunc,
+    GLAD_INSTRUMENT_glPixelStoref,
+    GLAD_INSTRUMENT_glPixelStorei,
+    GLAD_INSTRUMENT_glReadBuffer,
+    GLAD_INSTRUMENT_glReadPixels,
+    GLAD_INSTRUMENT_glGetBooleanv,
+    GLAD_INSTRUMENT_glGetDoublev,
+    GLAD_INSTRUMENT_glGetError,
+    GLAD_INSTRUMENT_glGetFloatv,
+    GLAD_INSTRUMENT_glGetIntegerv,
+    GLAD_INSTRUMENT_glGetString,
+    GLAD_INSTRUMENT_glGetTexImage,
+    GLAD_INSTRUMENT_glGetTexParameterfv,
+    GLAD_INSTRUMENT_glGetTexParameteriv,
+    GLAD_INSTRUMENT_glGetTexLevelParameterfv,
+    GLAD_INSTRUMENT_glGetTexLevelParameteriv,
+    GLAD_INSTRUMENT_glIsEnabled,
+    GLAD_INSTRUMENT_glDepthRange,
+    GLAD_INSTRUMENT_glViewport,
+    GLAD_INSTRUMENT_glDrawArrays,
+    GLAD_INSTRUMENT_glDrawElements,
+    GLAD_INSTRUMENT_glPolygonOffset,
+    GLAD_INSTRUMENT_glCopyTexImage1D,
+    GLAD_INSTRUMENT_glCopyTexImage2D,
+    GLAD_INSTRUMENT_glCopyTexSubImage1D,
+    GLAD_INSTRUMENT_glCopyTexSubImage2D,
+    GLAD_INSTRUMENT_glTexSubImage1D,
+    GLAD_INSTRUMENT_glTexSubImage2D,
+    GLAD_INSTRUMENT_glBindTexture,
+    GLAD_INSTRUMENT_glDeleteTextures,
+    GLAD_INSTRUMENT_glGenTextures,
+    GLAD_INSTRUMENT_glIsTexture,
+    GLAD_INSTRUMENT_glDrawRangeElements,
+    GLAD_INSTRUMENT_glTexImage3D,
+    GLAD_INSTRUMENT_glTexSubImage3D,
+    GLAD_INSTRUMENT_glCopyTexSubImage3D,
+    GLAD_INSTRUMENT_glActiveTexture,
+    GLAD_INSTRUMENT_glSampleCoverage,
+    GLAD_INSTRUMENT_glCompressedTexImage3D,
+    GLAD_INSTRUMENT_glCompressedTexImage2D,
+    GLAD_INSTRUMENT_glCompressedTexImage1D,
+    GLAD_INSTRUMENT_glCompressedTexSubImage3D,
+    GLAD_INSTRUMENT_glCompressedTexSubImage2D,
+    GLAD_INSTRUMENT_glCompressedTexSubImage1D,
+    GLAD_INSTRUMENT_glGetCompressedTexImage,
+    GLAD_INSTRUMENT_glBlendFuncSeparate,
+    GLAD_INSTRUMENT_glMultiDrawArrays,
+    GLAD_INSTRUMENT_glMultiDrawElements,
+    GLAD_INSTRUMENT_glPointParameterf,
+    GLAD_INSTRUMENT_glPointParameterfv,
+    GLAD_INSTRUMENT_glPointParameteri,
+    GLAD_INSTRUMENT_glPointParameteriv,
+    GLAD_INSTRUMENT_glBlendColor,
+    GLAD_INSTRUMENT_glBlendEquation,
+    GLAD_INSTRUMENT_glGenQueries,
+    GLAD_INSTRUMENT_glDeleteQueries,
+    GLAD_INSTRUMENT_glIsQuery,
+    GLAD_INSTRUMENT_glBeginQuery,
+    GLAD_INSTRUMENT_glEndQuery,
+    GLAD_INSTRUMENT_glGetQueryiv,
+    GLAD_INSTRUMENT_glGetQueryObjectiv,
+    GLAD_INSTRUMENT_glGetQueryObjectuiv,
+    GLAD_INSTRUMENT_glBindBuffer,
+    GLAD_INSTRUMENT_glDeleteBuffers,
+    GLAD_INSTRUMENT_glGenBuffers,
+    GLAD_INSTRUMENT_glIsBuffer,
+    GLAD_INSTRUMENT_glBufferData,
+    GLAD_INSTRUMENT_glBufferSubData,
+    GLAD_INSTRUMENT_glGetBufferSubData,
+    GLAD_INSTRUMENT_glMapBuffer,
+    GLAD_INSTRUMENT_glUnmapBuffer,
+    GLAD_INSTRUMENT_glGetBufferParameteriv,
+    GLAD_INSTRUMENT_glGetBufferPointerv,
+    GLAD_INSTRUMENT_glBlendEquationSeparate,
+    GLAD_INSTRUMENT_glDrawBuffers,
+    GLAD_INSTRUMENT_glStencilOpSeparate,
+    GLAD_INSTRUMENT_glStencilFuncSeparate,
+    GLAD_INSTRUMENT_glStencilMaskSeparate,
+    GLAD_INSTRUMENT_glAttachShader,
+    GLAD_INSTRUMENT_glBindAttribLocation,
+    GLAD_INSTRUMENT_glCompileShader,
+    GLAD_INSTRUMENT_glCreateProgram,
+    GLAD_INSTRUMENT_glCreateShader,
+    GLAD_INSTRUMENT_glDeleteProgram,
+    GLAD_INSTRUMENT_glDeleteShader,
+    GLAD_INSTRUMENT_glDetachShader,
+    GLAD_INSTRUMENT_glDisableVertexAttribArray,
+    GLAD_INSTRUMENT_glEnableVertexAttribArray,
+    GLAD_INSTRUMENT_glGetActiveAttrib,
+    GLAD_INSTRUMENT_glGetActiveUniform,
+    GLAD_INSTRUMENT_glGetAttachedShaders,
+    GLAD_INSTRUMENT_glGetAttribLocation,
+    GLAD_INSTRUMENT_glGetProgramiv,
+    GLAD_INSTRUMENT_glGetProgramInfoLog,
+    GLAD_INSTRUMENT_glGetShaderiv,
+    GLAD_INSTRUMENT_glGetShaderInfoLog,
+    GLAD_INSTRUMENT_glGetShaderSource,
+    GLAD_INSTRUMENT_glGetUniformLocation,
+    GLAD_INSTRUMENT_glGetUniformfv,
+    GLAD_INSTRUMENT_glGetUniformiv,
+    GLAD_INSTRUMENT_glGetVertexAttribdv,
+    GLAD_INSTRUMENT_glGetVertexAttribfv,
+    GLAD_INSTRUMENT_glGetVertexAttribiv,
+    GLAD_INSTRUMENT_glGetVertexAttribPointerv,
+    GLAD_INSTRUMENT_glIsProgram,
+    GLAD_INSTRUMENT_glIsShader,
+    GLAD_INSTRUMENT_glLinkProgram,
+    GLAD_INSTRUMENT_glShaderSource,
+    GLAD_INSTRUMENT_glUseProgram,
+    GLAD_INSTRUMENT_glUniform1f,
+    GLAD_INSTRUMENT_glUniform2f,
+    GLAD_INSTRUMENT_glUniform3f,
+    GLAD_INSTRUMENT_glUniform4f,
+    GLAD_INSTRUMENT_glUniform1i,
+    GLAD_INSTRUMENT_glUniform2i,
+    GLAD_INSTRUMENT_glUniform3i,
+    GLAD_INSTRUMENT_glUniform4i,
+    GLAD_INSTRUMENT_glUniform1fv,
+    GLAD_INSTRUMENT_glUniform2fv,
+    GLAD_INSTRUMENT_glUniform3fv,
+    GLAD_INSTRUMENT_glUniform4fv,
+    GLAD_INSTRUMENT_glUniform1iv,
+    GLAD_INSTRUMENT_glUniform2iv,
+    GLAD_INSTRUMENT_glUniform3iv,
+    GLAD_INSTRUMENT_glUniform4iv,
+    GLAD_INSTRUMENT_glUniformMatrix2fv,
+    GLAD_INSTRUMENT_glUniformMatrix3fv,
+    GLAD_INSTRUMENT_glUniformMatrix4fv,
+    GLAD_INSTRUMENT_glValidateProgram,
+    GLAD_INSTRUMENT_glVertexAttrib1d,
+    GLAD_INSTRUMENT_glVertexAttrib1dv,
+    GLAD_INSTRUMENT_glVertexAttrib1f,
+    GLAD_INSTRUMENT_glVertexAttrib1fv,
+    GLAD_INSTRUMENT_glVertexAttrib1s,
+    GLAD_INSTRUMENT_glVertexAttrib1sv,
+    GLAD_INSTRUMENT_glVertexAttrib2d,
+    GLAD_INSTRUMENT_glVertexAttrib2dv,
+    GLAD_INSTRUMENT_glVertexAttrib2f,
+    GLAD_INSTRUMENT_glVertexAttrib2fv,
+    GLAD_INSTRUMENT_glVertexAttrib2s,
+    GLAD_INSTRUMENT_glVertexAttrib2sv,
+    GLAD_INSTRUMENT_glVertexAttrib3d,
+    GLAD_INSTRUMENT_glVertexAttrib3dv,
+    GLAD_INSTRUMENT_glVertexAttrib3f,
+    GLAD_INSTRUMENT_glVertexAttrib3fv,
+    GLAD_INSTRUMENT_glVertexAttrib3s,
+    GLAD_INSTRUMENT_glVertexAttrib3sv,
+    GLAD_INSTRUMENT_glVertexAttrib4Nbv,
+    GLAD_INSTRUMENT_glVertexAttrib4Niv,
+    GLAD_INSTRUMENT_glVertexAttrib4Nsv,
+    GLAD_INSTRUMENT_glVertexAttrib4Nub,
+    GLAD_INSTRUMENT_glVertexAttrib4Nubv,
+    GLAD_INSTRUMENT_glVertexAttrib4Nuiv,
+    GLAD_INSTRUMENT_glVertexAttrib4Nusv,
+    GLAD_INSTRUMENT_glVertexAttrib4bv,
+    GLAD_INSTRUMENT_glVertexAttrib4d,
+    GLAD_INSTRUMENT_glVertexAttrib4dv,
+    GLAD_INSTRUMENT_glVertexAttrib4f,
+    GLAD_INSTRUMENT_glVertexAttrib4fv,
+    GLAD_INSTRUMENT_glVertexAttrib4iv,
+    GLAD_INSTRUMENT_glVertexAttrib4s,
+    GLAD_INSTRUMENT_glVertexAttrib4sv,
+    GLAD_INSTRUMENT_glVertexAttrib4ubv,
+    GLAD_INSTRUMENT_glVertexAttrib4uiv,
+    GLAD_INSTRUMENT_glVertexAttrib4usv,
+    GLAD_INSTRUMENT_glVertexAttribPointer,
+    GLAD_INSTRUMENT_glUniformMatrix2x3fv,
+    GLAD_INSTRUMENT_glUniformMatrix3x2fv,
+    GLAD_INSTRUMENT_glUniformMatrix2x4fv,
+    GLAD_INSTRUMENT_glUniformMatrix4x2fv,
+    GLAD_INSTRUMENT_glUniformMatrix3x4fv,
+    GLAD_INSTRUMENT_glUniformMatrix4x3fv,
+    GLAD_INSTRUMENT_glColorMaski,
+    GLAD_INSTRUMENT_glGetBooleani_v,
+    GLAD_INSTRUMENT_glGetIntegeri_v,
+    GLAD_INSTRUMENT_glEnablei,
+    GLAD_INSTRUMENT_glDisablei,
+    GLAD_INSTRUMENT_glIsEnabledi,
+    GLAD_INSTRUMENT_glBeginTransformFeedback,
+    GLAD_INSTRUMENT_glEndTransformFeedback,
+    GLAD_INSTRUMENT_glBindBufferRange,
+    GLAD_INSTRUMENT_glBindBufferBase,
+    GLAD_INSTRUMENT_glTransformFeedbackVaryings,
+    GLAD_INSTRUMENT_glGetTransformFeedbackVarying,
+    GLAD_INSTRUMENT_glClampColor,
+    GLAD_INSTRUMENT_glBeginConditionalRender,
+    GLAD_INSTRUMENT_glEndConditionalRender,
+    GLAD_INSTRUMENT_glVertexAttribIPointer,
+    GLAD_INSTRUMENT_glGetVertexAttribIiv,
+    GLAD_INSTRUMENT_glGetVertexAttribIuiv,
+    GLAD_INSTRUMENT_glVertexAttribI1i,
+    GLAD_INSTRUMENT_glVertexAttribI2i,
+    GLAD_INSTRUMENT_glVertexAttribI3i,
+    GLAD_INSTRUMENT_glVertexAttribI4i,
+    GLAD_INSTRUMENT_glVertexAttribI1ui,
+    GLAD_INSTRUMENT_glVertexAttribI2ui,
+    GLAD_INSTRUMENT_glVertexAttribI3ui,
+    GLAD_INSTRUMENT_glVertexAttribI4ui,
+    GLAD_INSTRUMENT_glVertexAttribI1iv,
+    GLAD_INSTRUMENT_glVertexAttribI2iv,
+    GLAD_INSTRUMENT_glVertexAttribI3iv,
+    GLAD_INSTRUMENT_glVertexAttribI4iv,
+    GLAD_INSTRUMENT_glVertexAttribI1uiv,
+    GLAD_INSTRUMENT_glVertexAttribI2uiv,
+    GLAD_INSTRUMENT_glVertexAttribI3uiv,
+    GLAD_INSTRUMENT_glVertexAttribI4uiv,
+    GLAD_INSTRUMENT_glVertexAttribI4bv,
+    GLAD_INSTRUMENT_glVertexAttribI4sv,
+    GLAD_INSTRUMENT_glVertexAttribI4ubv,
+    GLAD_INSTRUMENT_glVertexAttribI4usv,
+    GLAD_INSTRUMENT_glGetUniformuiv,
+    GLAD_INSTRUMENT_glBindFragDataLocation,
+    GLAD_INSTRUMENT_glGetFragDataLocation,
+    GLAD_INSTRUMENT_glUniform1ui,
+    GLAD_INSTRUMENT_glUniform2ui,
+    GLAD_INSTRUMENT_glUniform3ui,
+    GLAD_INSTRUMENT_glUniform4ui,
+    GLAD_INSTRUMENT_glUniform1uiv,
+    GLAD_INSTRUMENT_glUniform2uiv,
+    GLAD_INSTRUMENT_glUniform3uiv,
+    GLAD_INSTRUMENT_glUniform4uiv,
+    GLAD_INSTRUMENT_glTexParameterIiv,
+    GLAD_INSTRUMENT_glTexParameterIuiv,
+    GLAD_INSTRUMENT_glGetTexParameterIiv,
+    GLAD_INSTRUMENT_glGetTexParameterIuiv,
+    GLAD_INSTRUMENT_glClearBufferiv,
+    GLAD_INSTRUMENT_glClearBufferuiv,
+    GLAD_INSTRUMENT_glClearBufferfv,
+    GLAD_INSTRUMENT_glClearBufferfi,
+    GLAD_INSTRUMENT_glGetStringi,
+    GLAD_INSTRUMENT_glIsRenderbuffer,
+    GLAD_INSTRUMENT_glBindRenderbuffer,
+    GLAD_INSTRUMENT_glDeleteRenderbuffers,
+    GLAD_INSTRUMENT_glGenRenderbuffers,
+    GLAD_INSTRUMENT_glRenderbufferStorage,
+    GLAD_INSTRUMENT_glGetRenderbufferParameteriv,
+    GLAD_INSTRUMENT_glIsFramebuffer,
+    GLAD_INSTRUMENT_glBindFramebuffer,
+    GLAD_INSTRUMENT_glDeleteFramebuffers,
+    GLAD_INSTRUMENT_glGenFramebuffers,
+    GLAD_INSTRUMENT_glCheckFramebufferStatus,
+    GLAD_INSTRUMENT_glFramebufferTexture1D,
+    GLAD_INSTRUMENT_glFramebufferTexture2D,
+    GLAD_INSTRUMENT_glFramebufferTexture3D,
+    GLAD_INSTRUMENT_glFramebufferRenderbuffer,
+    GLAD_INSTRUMENT_glGetFramebufferAttachmentParameteriv,
+    GLAD_INSTRUMENT_glGenerateMipmap,
+    GLAD_INSTRUMENT_glBlitFramebuffer,
+    GLAD_INSTRUMENT_glRenderbufferStorageMultisample,
+    GLAD_INSTRUMENT_glFramebufferTextureLayer,
+    GLAD_INSTRUMENT_glMapBufferRange,
+    GLAD_INSTRUMENT_glFlushMappedBufferRange,
+    GLAD_INSTRUMENT_glBindVertexArray,
+    GLAD_INSTRUMENT_glDeleteVertexArrays,
+    GLAD_INSTRUMENT_glGenVertexArrays,
+    GLAD_INSTRUMENT_glIsVertexArray,
+    GLAD_INSTRUMENT_glDrawArraysInstanced,
+    GLAD_INSTRUMENT_glDrawElementsInstanced,
+    GLAD_INSTRUMENT_glTexBuffer,
+    GLAD_INSTRUMENT_glPrimitiveRestartIndex,
+    GLAD_INSTRUMENT_glCopyBufferSubData,
+    GLAD_INSTRUMENT_glGetUniformIndices,
+    GLAD_INSTRUMENT_glGetActiveUniformsiv,
+    GLAD_INSTRUMENT_glGetActiveUniformName,
+    GLAD_INSTRUMENT_glGetUniformBlockIndex,
+    GLAD_INSTRUMENT_glGetActiveUniformBlockiv,
+    GLAD_INSTRUMENT_glGetActiveUniformBlockName,
+    GLAD_INSTRUMENT_glUniformBlockBinding,
+    GLAD_INSTRUMENT_glDrawElementsBaseVertex,
+    GLAD_INSTRUMENT_glDrawRangeElementsBaseVertex,
+    GLAD_INSTRUMENT_glDrawElementsInstancedBaseVertex,
+    GLAD_INSTRUMENT_glMultiDrawElementsBaseVertex,
+    GLAD_INSTRUMENT_glProvokingVertex,
+    GLAD_INSTRUMENT_glFenceSync,
+    GLAD_INSTRUMENT_glIsSync,
+    GLAD_INSTRUMENT_glDeleteSync,
+    GLAD_INSTRUMENT_glClientWaitSync,
+    GLAD_INSTRUMENT_glWaitSync,
+    GLAD_INSTRUMENT_glGetInteger64v,
+    GLAD_INSTRUMENT_glGetSynciv,
+    GLAD_INSTRUMENT_glGetInteger64i_v,
+    GLAD_INSTRUMENT_glGetBufferParameteri64v,
+    GLAD_INSTRUMENT_glFramebufferTexture,
+    GLAD_INSTRUMENT_glTexImage2DMultisample,
+    GLAD_INSTRUMENT_glTexImage3DMultisample,
+    GLAD_INSTRUMENT_glGetMultisamplefv,
+    GLAD_INSTRUMENT_glSampleMaski,
+    GLAD_INSTRUMENT_glBindFragDataLocationIndexed,
+    GLAD_INSTRUMENT_glGetFragDataIndex,
+    GLAD_INSTRUMENT_glGenSamplers,
+    GLAD_INSTRUMENT_glDeleteSamplers,
+    GLAD_INSTRUMENT_glIsSampler,
+    GLAD_INSTRUMENT_glBindSampler,
+    GLAD_INSTRUMENT_glSamplerParameteri,
+    GLAD_INSTRUMENT_glSamplerParameteriv,
+    GLAD_INSTRUMENT_glSamplerParameterf,
+    GLAD_INSTRUMENT_glSamplerParameterfv,
+    GLAD_INSTRUMENT_glSamplerParameterIiv,
+    GLAD_INSTRUMENT_glSamplerParameterIuiv,
+    GLAD_INSTRUMENT_glGetSamplerParameteriv,
+    GLAD_INSTRUMENT_glGetSamplerParameterIiv,
+    GLAD_INSTRUMENT_glGetSamplerParameterfv,
+    GLAD_INSTRUMENT_glGetSamplerParameterIuiv,
+    GLAD_INSTRUMENT_glQueryCounter,
+    GLAD_INSTRUMENT_glGetQueryObjecti64v,
+    GLAD_INSTRUMENT_glGetQueryObjectui64v,
+    GLAD_INSTRUMENT_glVertexAttribDivisor,
+    GLAD_INSTRUMENT_glVertexAttribP1ui,
+    GLAD_INSTRUMENT_glVertexAttribP1uiv,
+    GLAD_INSTRUMENT_glVertexAttribP2ui,
+    GLAD_INSTRUMENT_glVertexAttribP2uiv,
+    GLAD_INSTRUMENT_glVertexAttribP3ui,
+    GLAD_INSTRUMENT_glVertexAttribP3uiv,
+    GLAD_INSTRUMENT_glVertexAttribP4ui,
+    GLAD_INSTRUMENT_glVertexAttribP4uiv,
+    GLAD_INSTRUMENT_glVertexP2ui,
+    GLAD_INSTRUMENT_glVertexP2uiv,
+    GLAD_INSTRUMENT_glVertexP3ui,
+    GLAD_INSTRUMENT_glVertexP3uiv,
+    GLAD_INSTRUMENT_glVertexP4ui,
+    GLAD_INSTRUMENT_glVertexP4uiv,
+    GLAD_INSTRUMENT_glTexCoordP1ui,
+    GLAD_INSTRUMENT_glTexCoordP1uiv,
+    GLAD_INSTRUMENT_glTexCoordP2ui,
+    GLAD_INSTRUMENT_glTexCoordP2uiv,
+    GLAD_INSTRUMENT_glTexCoordP3ui,
+    GLAD_INSTRUMENT_glTexCoordP3uiv,
+    GLAD_INSTRUMENT_glTexCoordP4ui,
+    GLAD_INSTRUMENT_glTexCoordP4uiv,
+    GLAD_INSTRUMENT_glMultiTexCoordP1ui,
+    GLAD_INSTRUMENT_glMultiTexCoordP1uiv,
+    GLAD_INSTRUMENT_glMultiTexCoordP2ui,
+    GLAD_INSTRUMENT_glMultiTexCoordP2uiv,
+    GLAD_INSTRUMENT_glMultiTexCoordP3ui,
+    GLAD_INSTRUMENT_glMultiTexCoordP3uiv,
+    GLAD_INSTRUMENT_glMultiTexCoordP4ui,
+    GLAD_INSTRUMENT_glMultiTexCoordP4uiv,
+    GLAD_INSTRUMENT_glNormalP3ui,
+    GLAD_INSTRUMENT_glNormalP3uiv,
+    GLAD_INSTRUMENT_glColorP3ui,
+    GLAD_INSTRUMENT_glColorP3uiv,
+    GLAD_INSTRUMENT_glColorP4ui,
+    GLAD_INSTRUMENT_glColorP4uiv,
+    GLAD_INSTRUMENT_glSecondaryColorP3ui,
+    GLAD_INSTRUMENT_glSecondaryColorP3uiv,
+    GLAD_INSTRUMENT_glMinSampleShading,
+    GLAD_INSTRUMENT_glBlendEquationi,
+    GLAD_INSTRUMENT_glBlendEquationSeparatei,
+    GLAD_INSTRUMENT_glBlendFunci,
+    GLAD_INSTRUMENT_glBlendFuncSeparatei,
+    GLAD_INSTRUMENT_glDrawArraysIndirect,
+    GLAD_INSTRUMENT_glDrawElementsIndirect,
+    GLAD_INSTRUMENT_glUniform1d,
+    GLAD_INSTRUMENT_glUniform2d,
+    GLAD_INSTRUMENT_glUniform3d,
+    GLAD_INSTRUMENT_glUniform4d,
+    GLAD_INSTRUMENT_glUniform1dv,
+    GLAD_INSTRUMENT_glUniform2dv,
+    GLAD_INSTRUMENT_glUniform3dv,
+    GLAD_INSTRUMENT_glUniform4dv,
+    GLAD_INSTRUMENT_glUniformMatrix2dv,
+    GLAD_INSTRUMENT_glUniformMatrix3dv,
+    GLAD_INSTRUMENT_glUniformMatrix4dv,
+    GLAD_INSTRUMENT_glUniformMatrix2x3dv,
+    GLAD_INSTRUMENT_glUniformMatrix2x4dv,
+    GLAD_INSTRUMENT_glUniformMatrix3x2dv,
+    GLAD_INSTRUMENT_glUniformMatrix3x4dv,
+    GLAD_INSTRUMENT_glUniformMatrix4x2dv,
+    GLAD_INSTRUMENT_glUniformMatrix4x3dv,
+    GLAD_INSTRUMENT_glGetUniformdv,
+    GLAD_INSTRUMENT_glGetSubroutineUniformLocation,
+    GLAD_INSTRUMENT_glGetSubroutineIndex,
+    GLAD_INSTRUMENT_glGetActiveSubroutineUniformiv,
+    GLAD_INSTRUMENT_glGetActiveSubroutineUniformName,
+    GLAD_INSTRUMENT_glGetActiveSubroutineName,
+    GLAD_INSTRUMENT_glUniformSubroutinesuiv,
+    GLAD_INSTRUMENT_glGetUniformSubroutineuiv,
+    GLAD_INSTRUMENT_glGetProgramStageiv,
+    GLAD_INSTRUMENT_glPatchParameteri,
+    GLAD_INSTRUMENT_glPatchParameterfv,
+    GLAD_INSTRUMENT_glBindTransformFeedback,
+    GLAD_INSTRUMENT_glDeleteTransformFeedbacks,
+    GLAD_INSTRUMENT_glGenTransformFeedbacks,
+    GLAD_INSTRUMENT_glIsTransformFeedback,
+    GLAD_INSTRUMENT_glPauseTransformFeedback,
+    GLAD_INSTRUMENT_glResumeTransformFeedback,
+    GLAD_INSTRUMENT_glDrawTransformFeedback,
+    GLAD_INSTRUMENT_glDrawTransformFeedbackStream,
+    GLAD_INSTRUMENT_glBeginQueryIndexed,
+    GLAD_INSTRUMENT_glEndQueryIndexed,
+    GLAD_INSTRUMENT_glGetQueryIndexediv,
+    GLAD_INSTRUMENT_glReleaseShaderCompiler,
+    GLAD_INSTRUMENT_glShaderBinary,
+    GLAD_INSTRUMENT_glGetShaderPrecisionFormat,
+    GLAD_INSTRUMENT_glDepthRangef,
+    GLAD_INSTRUMENT_glClearDepthf,
+    GLAD_INSTRUMENT_glGetProgramBinary,
+    GLAD_INSTRUMENT_glProgramBinary,
+    GLAD_INSTRUMENT_glProgramParameteri,
+    GLAD_INSTRUMENT_glUseProgramStages,
+    GLAD_INSTRUMENT_glActiveShaderProgram,
+    GLAD_INSTRUMENT_glCreateShaderProgramv,
+    GLAD_INSTRUMENT_glBindProgramPipeline,
+    GLAD_INSTRUMENT_glDeleteProgramPipelines,
+    GLAD_INSTRUMENT_glGenProgramPipelines,
+    GLAD_INSTRUMENT_glIsProgramPipeline,
+    GLAD_INSTRUMENT_glGetProgramPipelineiv,
+    GLAD_INSTRUMENT_glProgramUniform1i,
+    GLAD_INSTRUMENT_glProgramUniform1iv,
+    GLAD_INSTRUMENT_glProgramUniform1f,
+    GLAD_INSTRUMENT_glProgramUniform1fv,
+    GLAD_INSTRUMENT_glProgramUniform1d,
+    GLAD_INSTRUMENT_glProgramUniform1dv,
+    GLAD_INSTRUMENT_glProgramUniform1ui,
+    GLAD_INSTRUMENT_glProgramUniform1uiv,
+    GLAD_INSTRUMENT_glProgramUniform2i,
+    GLAD_INSTRUMENT_glProgramUniform2iv,
+    GLAD_INSTRUMENT_glProgramUniform2f,
+    GLAD_INSTRUMENT_glProgramUniform2fv,
+    GLAD_INSTRUMENT_glProgramUniform2d,
+    GLAD_INSTRUMENT_glProgramUniform2dv,
+    GLAD_INSTRUMENT_glProgramUniform2ui,
+    GLAD_INSTRUMENT_glProgramUniform2uiv,
+    GLAD_INSTRUMENT_glProgramUniform3i,
+    GLAD_INSTRUMENT_glProgramUniform3iv,
+    GLAD_INSTRUMENT_glProgramUniform3f,
+    GLAD_INSTRUMENT_glProgramUniform3fv,
+    GLAD_INSTRUMENT_glProgramUniform3d,
+    GLAD_INSTRUMENT_glProgramUniform3dv,
+    GLAD_INSTRUMENT_glProgramUniform3ui,
+    GLAD_INSTRUMENT_glProgramUniform3uiv,
+    GLAD_INSTRUMENT_glProgramUniform4i,
+    GLAD_INSTRUMENT_glProgramUniform4iv,
+    GLAD_INSTRUMENT_glProgramUniform4f,
+    GLAD_INSTRUMENT_glProgramUniform4fv,
+    GLAD_INSTRUMENT_glProgramUniform4d,
+    GLAD_INSTRUMENT_glProgramUniform4dv,
+    GLAD_INSTRUMENT_glProgramUniform4ui,
+    GLAD_INSTRUMENT_glProgramUniform4uiv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2x3fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3x2fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2x4fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4x2fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3x4fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4x3fv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2x3dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3x2dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix2x4dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4x2dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix3x4dv,
+    GLAD_INSTRUMENT_glProgramUniformMatrix4x3dv,
+    GLAD_INSTRUMENT_glValidateProgramPipeline,
+    GLAD_INSTRUMENT_glGetProgramPipelineInfoLog,
+    GLAD_INSTRUMENT_glVertexAttribL1d,
+    GLAD_INSTRUMENT_glVertexAttribL2d,
+    GLAD_INSTRUMENT_glVertexAttribL3d,
+    GLAD_INSTRUMENT_glVertexAttribL4d,
+    GLAD_INSTRUMENT_glVertexAttribL1dv,
+    GLAD_INSTRUMENT_glVertexAttribL2dv,
+    GLAD_INSTRUMENT_glVertexAttribL3dv,
+    GLAD_INSTRUMENT_glVertexAttribL4dv,
+    GLAD_INSTRUMENT_glVertexAttribLPointer,
+    GLAD_INSTRUMENT_glGetVertexAttribLdv,
+    GLAD_INSTRUMENT_glViewportArrayv,
+    GLAD_INSTRUMENT_glViewportIndexedf,
+    GLAD_INSTRUMENT_glViewportIndexedfv,
+    GLAD_INSTRUMENT_glScissorArrayv,
+    GLAD_INSTRUMENT_glScissorIndexed,
+    GLAD_INSTRUMENT_glScissorIndexedv,
+    GLAD_INSTRUMENT_glDepthRangeArrayv,
+    GLAD_INSTRUMENT_glDepthRangeIndexed,
+    GLAD_INSTRUMENT_glGetFloati_v,
+    GLAD_INSTRUMENT_glGetDoublei_v,
+    GLAD_INSTRUMENT_glDrawArraysInstancedBaseInstance,
+    GLAD_INSTRUMENT_glDrawElementsInstancedBaseInstance,
+    GLAD_INSTRUMENT_glDrawElementsInstancedBaseVertexBaseInstance,
+    GLAD_INSTRUMENT_glGetInternalformativ,
+    GLAD_INSTRUMENT_glGetActiveAtomicCounterBufferiv,
+    GLAD_INSTRUMENT_glBindImageTexture,
+    GLAD_INSTRUMENT_glMemoryBarrier,
+    GLAD_INSTRUMENT_glTexStorage1D,
+    GLAD_INSTRUMENT_glTexStorage2D,
+    GLAD_INSTRUMENT_glTexStorage3D,
+    GLAD_INSTRUMENT_glDrawTransformFeedbackInstanced,
+    GLAD_INSTRUMENT_glDrawTransformFeedbackStreamInstanced,
+    GLAD_INSTRUMENT_glClearBufferData,
+    GLAD_INSTRUMENT_glClearBufferSubData,
+    GLAD_INSTRUMENT_glDispatchCompute,
+    GLAD_INSTRUMENT_glDispatchComputeIndirect,
+    GLAD_INSTRUMENT_glCopyImageSubData,
+    GLAD_INSTRUMENT_glFramebufferParameteri,
+    GLAD_INSTRUMENT_glGetFramebufferParameteriv,
+    GLAD_INSTRUMENT_glGetInternalformati64v,
+    GLAD_INSTRUMENT_glInvalidateTexSubImage,
+    GLAD_INSTRUMENT_glInvalidateTexImage,
+    GLAD_INSTRUMENT_glInvalidateBufferSubData,
+    GLAD_INSTRUMENT_glInvalidateBufferData,
+    GLAD_INSTRUMENT_glInvalidateFramebuffer,
+    GLAD_INSTRUMENT_glInvalidateSubFramebuffer,
+    GLAD_INSTRUMENT_glMultiDrawArraysIndirect,
+    GLAD_INSTRUMENT_glMultiDrawElementsIndirect,
+    GLAD_INSTRUMENT_glGetProgramInterfaceiv,
+    GLAD_INSTRUMENT_glGetProgramResourceIndex,
+    GLAD_INSTRUMENT_glGetProgramResourceName,
+    GLAD_INSTRUMENT_glGetProgramResourceiv,
+    GLAD_INSTRUMENT_glGetProgramResourceLocation,
+    GLAD_INSTRUMENT_glGetProgramResourceLocationIndex,
+    GLAD_INSTRUMENT_glShaderStorageBlockBinding,
+    GLAD_INSTRUMENT_glTexBufferRange,
+    GLAD_INSTRUMENT_glTexStorage2DMultisample,
+    GLAD_INSTRUMENT_glTexStorage3DMultisample,
+    GLAD_INSTRUMENT_glTextureView,
+    GLAD_INSTRUMENT_glBindVertexBuffer,
+    GLAD_INSTRUMENT_glVertexAttribFormat,
+    GLAD_INSTRUMENT_glVertexAttribIFormat,
+    GLAD_INSTRUMENT_glVertexAttribLFormat,
+    GLAD_INSTRUMENT_glVertexAttribBinding,
+    GLAD_INSTRUMENT_glVertexBindingDivisor,
+    GLAD_INSTRUMENT_glDebugMessageControl,
+    GLAD_INSTRUMENT_glDebugMessageInsert,
+    GLAD_INSTRUMENT_glDebugMessageCallback,
+    GLAD_INSTRUMENT_glGetDebugMessageLog,
+    GLAD_INSTRUMENT_glPushDebugGroup,
+    GLAD_INSTRUMENT_glPopDebugGroup,
+    GLAD_INSTRUMENT_glObjectLabel,
+    GLAD_INSTRUMENT_glGetObjectLabel,
+    GLAD_INSTRUMENT_glObjectPtrLabel,
+    GLAD_INSTRUMENT_glGetObjectPtrLabel,
+    GLAD_INSTRUMENT_glBufferStorage,
+    GLAD_INSTRUMENT_COUNT
+};
+
+static const char *glad_instrument_names[GLAD_INSTRUMENT_COUNT] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+};
+
+static PFNGLCULLFACEPROC glad_real_glCullFace = NULL;
+static void APIENTRY glad_instrument_glCullFace(GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCullFace(mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glCullFace, glad_start, glad_redundant);
+}
+
+static PFNGLFRONTFACEPROC glad_real_glFrontFace = NULL;
+static void APIENTRY glad_instrument_glFrontFace(GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFrontFace(mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glFrontFace, glad_start, glad_redundant);
+}
+
+static PFNGLHINTPROC glad_real_glHint = NULL;
+static void APIENTRY glad_instrument_glHint(GLenum target, GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glHint(target, mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glHint, glad_start, glad_redundant);
+}
+
+static PFNGLLINEWIDTHPROC glad_real_glLineWidth = NULL;
+static void APIENTRY glad_instrument_glLineWidth(GLfloat width) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glLineWidth(width);
+    glad_instrument_record(GLAD_INSTRUMENT_glLineWidth, glad_start, glad_redundant);
+}
+
+static PFNGLPOINTSIZEPROC glad_real_glPointSize = NULL;
+static void APIENTRY glad_instrument_glPointSize(GLfloat size) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPointSize(size);
+    glad_instrument_record(GLAD_INSTRUMENT_glPointSize, glad_start, glad_redundant);
+}
+
+static PFNGLPOLYGONMODEPROC glad_real_glPolygonMode = NULL;
+static void APIENTRY glad_instrument_glPolygonMode(GLenum face, GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPolygonMode(face, mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glPolygonMode, glad_start, glad_redundant);
+}
+
+static PFNGLSCISSORPROC glad_real_glScissor = NULL;
+static void APIENTRY glad_instrument_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glScissor(x, y, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glScissor, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERFPROC glad_real_glTexParameterf = NULL;
+static void APIENTRY glad_instrument_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameterf(target, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameterf, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERFVPROC glad_real_glTexParameterfv = NULL;
+static void APIENTRY glad_instrument_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameterfv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERIPROC glad_real_glTexParameteri = NULL;
+static void APIENTRY glad_instrument_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameteri(target, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERIVPROC glad_real_glTexParameteriv = NULL;
+static void APIENTRY glad_instrument_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameteriv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXIMAGE1DPROC glad_real_glTexImage1D = NULL;
+static void APIENTRY glad_instrument_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXIMAGE2DPROC glad_real_glTexImage2D = NULL;
+static void APIENTRY glad_instrument_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWBUFFERPROC glad_real_glDrawBuffer = NULL;
+static void APIENTRY glad_instrument_glDrawBuffer(GLenum buf) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawBuffer(buf);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawBuffer, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARPROC glad_real_glClear = NULL;
+static void APIENTRY glad_instrument_glClear(GLbitfield mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClear(mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glClear, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARCOLORPROC glad_real_glClearColor = NULL;
+static void APIENTRY glad_instrument_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearColor(red, green, blue, alpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearColor, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARSTENCILPROC glad_real_glClearStencil = NULL;
+static void APIENTRY glad_instrument_glClearStencil(GLint s) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearStencil(s);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearStencil, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARDEPTHPROC glad_real_glClearDepth = NULL;
+static void APIENTRY glad_instrument_glClearDepth(GLdouble depth) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearDepth(depth);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearDepth, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILMASKPROC glad_real_glStencilMask = NULL;
+static void APIENTRY glad_instrument_glStencilMask(GLuint mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilMask(mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilMask, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORMASKPROC glad_real_glColorMask = NULL;
+static void APIENTRY glad_instrument_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorMask(red, green, blue, alpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorMask, glad_start, glad_redundant);
+}
+
+static PFNGLDEPTHMASKPROC glad_real_glDepthMask = NULL;
+static void APIENTRY glad_instrument_glDepthMask(GLboolean flag) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthMask(flag);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthMask, glad_start, glad_redundant);
+}
+
+static PFNGLDISABLEPROC glad_real_glDisable = NULL;
+static void APIENTRY glad_instrument_glDisable(GLenum cap) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDisable(cap);
+    glad_instrument_record(GLAD_INSTRUMENT_glDisable, glad_start, glad_redundant);
+}
+
+static PFNGLENABLEPROC glad_real_glEnable = NULL;
+static void APIENTRY glad_instrument_glEnable(GLenum cap) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEnable(cap);
+    glad_instrument_record(GLAD_INSTRUMENT_glEnable, glad_start, glad_redundant);
+}
+
+static PFNGLFINISHPROC glad_real_glFinish = NULL;
+static void APIENTRY glad_instrument_glFinish(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFinish();
+    glad_instrument_record(GLAD_INSTRUMENT_glFinish, glad_start, glad_redundant);
+}
+
+static PFNGLFLUSHPROC glad_real_glFlush = NULL;
+static void APIENTRY glad_instrument_glFlush(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFlush();
+    glad_instrument_record(GLAD_INSTRUMENT_glFlush, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDFUNCPROC glad_real_glBlendFunc = NULL;
+static void APIENTRY glad_instrument_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendFunc(sfactor, dfactor);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendFunc, glad_start, glad_redundant);
+}
+
+static PFNGLLOGICOPPROC glad_real_glLogicOp = NULL;
+static void APIENTRY glad_instrument_glLogicOp(GLenum opcode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glLogicOp(opcode);
+    glad_instrument_record(GLAD_INSTRUMENT_glLogicOp, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILFUNCPROC glad_real_glStencilFunc = NULL;
+static void APIENTRY glad_instrument_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilFunc(func, ref, mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilFunc, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILOPPROC glad_real_glStencilOp = NULL;
+static void APIENTRY glad_instrument_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilOp(fail, zfail, zpass);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilOp, glad_start, glad_redundant);
+}
+
+static PFNGLDEPTHFUNCPROC glad_real_glDepthFunc = NULL;
+static void APIENTRY glad_instrument_glDepthFunc(GLenum func) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthFunc(func);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthFunc, glad_start, glad_redundant);
+}
+
+static PFNGLPIXELSTOREFPROC glad_real_glPixelStoref = NULL;
+static void APIENTRY glad_instrument_glPixelStoref(GLenum pname, GLfloat param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPixelStoref(pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glPixelStoref, glad_start, glad_redundant);
+}
+
+static PFNGLPIXELSTOREIPROC glad_real_glPixelStorei = NULL;
+static void APIENTRY glad_instrument_glPixelStorei(GLenum pname, GLint param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPixelStorei(pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glPixelStorei, glad_start, glad_redundant);
+}
+
+static PFNGLREADBUFFERPROC glad_real_glReadBuffer = NULL;
+static void APIENTRY glad_instrument_glReadBuffer(GLenum src) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glReadBuffer(src);
+    glad_instrument_record(GLAD_INSTRUMENT_glReadBuffer, glad_start, glad_redundant);
+}
+
+static PFNGLREADPIXELSPROC glad_real_glReadPixels = NULL;
+static void APIENTRY glad_instrument_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glReadPixels(x, y, width, height, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glReadPixels, glad_start, glad_redundant);
+}
+
+static PFNGLGETBOOLEANVPROC glad_real_glGetBooleanv = NULL;
+static void APIENTRY glad_instrument_glGetBooleanv(GLenum pname, GLboolean *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBooleanv(pname, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBooleanv, glad_start, glad_redundant);
+}
+
+static PFNGLGETDOUBLEVPROC glad_real_glGetDoublev = NULL;
+static void APIENTRY glad_instrument_glGetDoublev(GLenum pname, GLdouble *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetDoublev(pname, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetDoublev, glad_start, glad_redundant);
+}
+
+static PFNGLGETERRORPROC glad_real_glGetError = NULL;
+static GLenum APIENTRY glad_instrument_glGetError(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLenum glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetError();
+    glad_instrument_record(GLAD_INSTRUMENT_glGetError, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETFLOATVPROC glad_real_glGetFloatv = NULL;
+static void APIENTRY glad_instrument_glGetFloatv(GLenum pname, GLfloat *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetFloatv(pname, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFloatv, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTEGERVPROC glad_real_glGetIntegerv = NULL;
+static void APIENTRY glad_instrument_glGetIntegerv(GLenum pname, GLint *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetIntegerv(pname, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetIntegerv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSTRINGPROC glad_real_glGetString = NULL;
+static const GLubyte * APIENTRY glad_instrument_glGetString(GLenum name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    const GLubyte * glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetString(name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetString, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETTEXIMAGEPROC glad_real_glGetTexImage = NULL;
+static void APIENTRY glad_instrument_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexImage(target, level, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexImage, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXPARAMETERFVPROC glad_real_glGetTexParameterfv = NULL;
+static void APIENTRY glad_instrument_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexParameterfv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXPARAMETERIVPROC glad_real_glGetTexParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexParameteriv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_real_glGetTexLevelParameterfv = NULL;
+static void APIENTRY glad_instrument_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexLevelParameterfv(target, level, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexLevelParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_real_glGetTexLevelParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexLevelParameteriv(target, level, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexLevelParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLISENABLEDPROC glad_real_glIsEnabled = NULL;
+static GLboolean APIENTRY glad_instrument_glIsEnabled(GLenum cap) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsEnabled(cap);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsEnabled, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLDEPTHRANGEPROC glad_real_glDepthRange = NULL;
+static void APIENTRY glad_instrument_glDepthRange(GLdouble n, GLdouble f) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthRange(n, f);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthRange, glad_start, glad_redundant);
+}
+
+static PFNGLVIEWPORTPROC glad_real_glViewport = NULL;
+static void APIENTRY glad_instrument_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glViewport(x, y, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glViewport, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWARRAYSPROC glad_real_glDrawArrays = NULL;
+static void APIENTRY glad_instrument_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawArrays(mode, first, count);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawArrays, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSPROC glad_real_glDrawElements = NULL;
+static void APIENTRY glad_instrument_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElements(mode, count, type, indices);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElements, glad_start, glad_redundant);
+}
+
+static PFNGLPOLYGONOFFSETPROC glad_real_glPolygonOffset = NULL;
+static void APIENTRY glad_instrument_glPolygonOffset(GLfloat factor, GLfloat units) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPolygonOffset(factor, units);
+    glad_instrument_record(GLAD_INSTRUMENT_glPolygonOffset, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYTEXIMAGE1DPROC glad_real_glCopyTexImage1D = NULL;
+static void APIENTRY glad_instrument_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyTexImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYTEXIMAGE2DPROC glad_real_glCopyTexImage2D = NULL;
+static void APIENTRY glad_instrument_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyTexImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_real_glCopyTexSubImage1D = NULL;
+static void APIENTRY glad_instrument_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyTexSubImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_real_glCopyTexSubImage2D = NULL;
+static void APIENTRY glad_instrument_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyTexSubImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSUBIMAGE1DPROC glad_real_glTexSubImage1D = NULL;
+static void APIENTRY glad_instrument_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexSubImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSUBIMAGE2DPROC glad_real_glTexSubImage2D = NULL;
+static void APIENTRY glad_instrument_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexSubImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLBINDTEXTUREPROC glad_real_glBindTexture = NULL;
+static void APIENTRY glad_instrument_glBindTexture(GLenum target, GLuint texture) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_bind_texture(target, texture);
+    glad_start = glad_instrument_now();
+    glad_real_glBindTexture(target, texture);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindTexture, glad_start, glad_redundant);
+}
+
+static PFNGLDELETETEXTURESPROC glad_real_glDeleteTextures = NULL;
+static void APIENTRY glad_instrument_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_delete_textures(n, textures);
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteTextures(n, textures);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteTextures, glad_start, glad_redundant);
+}
+
+static PFNGLGENTEXTURESPROC glad_real_glGenTextures = NULL;
+static void APIENTRY glad_instrument_glGenTextures(GLsizei n, GLuint *textures) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenTextures(n, textures);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenTextures, glad_start, glad_redundant);
+}
+
+static PFNGLISTEXTUREPROC glad_real_glIsTexture = NULL;
+static GLboolean APIENTRY glad_instrument_glIsTexture(GLuint texture) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsTexture(texture);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsTexture, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLDRAWRANGEELEMENTSPROC glad_real_glDrawRangeElements = NULL;
+static void APIENTRY glad_instrument_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawRangeElements(mode, start, end, count, type, indices);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawRangeElements, glad_start, glad_redundant);
+}
+
+static PFNGLTEXIMAGE3DPROC glad_real_glTexImage3D = NULL;
+static void APIENTRY glad_instrument_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexImage3D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSUBIMAGE3DPROC glad_real_glTexSubImage3D = NULL;
+static void APIENTRY glad_instrument_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexSubImage3D, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_real_glCopyTexSubImage3D = NULL;
+static void APIENTRY glad_instrument_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyTexSubImage3D, glad_start, glad_redundant);
+}
+
+static PFNGLACTIVETEXTUREPROC glad_real_glActiveTexture = NULL;
+static void APIENTRY glad_instrument_glActiveTexture(GLenum texture) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_active_texture(texture);
+    glad_start = glad_instrument_now();
+    glad_real_glActiveTexture(texture);
+    glad_instrument_record(GLAD_INSTRUMENT_glActiveTexture, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLECOVERAGEPROC glad_real_glSampleCoverage = NULL;
+static void APIENTRY glad_instrument_glSampleCoverage(GLfloat value, GLboolean invert) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSampleCoverage(value, invert);
+    glad_instrument_record(GLAD_INSTRUMENT_glSampleCoverage, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_real_glCompressedTexImage3D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexImage3D, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_real_glCompressedTexImage2D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_real_glCompressedTexImage1D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_real_glCompressedTexSubImage3D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexSubImage3D, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_real_glCompressedTexSubImage2D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexSubImage2D, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_real_glCompressedTexSubImage1D = NULL;
+static void APIENTRY glad_instrument_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompressedTexSubImage1D, glad_start, glad_redundant);
+}
+
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_real_glGetCompressedTexImage = NULL;
+static void APIENTRY glad_instrument_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetCompressedTexImage(target, level, img);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetCompressedTexImage, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDFUNCSEPARATEPROC glad_real_glBlendFuncSeparate = NULL;
+static void APIENTRY glad_instrument_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendFuncSeparate, glad_start, glad_redundant);
+}
+
+static PFNGLMULTIDRAWARRAYSPROC glad_real_glMultiDrawArrays = NULL;
+static void APIENTRY glad_instrument_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiDrawArrays(mode, first, count, drawcount);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiDrawArrays, glad_start, glad_redundant);
+}
+
+static PFNGLMULTIDRAWELEMENTSPROC glad_real_glMultiDrawElements = NULL;
+static void APIENTRY glad_instrument_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiDrawElements(mode, count, type, indices, drawcount);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiDrawElements, glad_start, glad_redundant);
+}
+
+static PFNGLPOINTPARAMETERFPROC glad_real_glPointParameterf = NULL;
+static void APIENTRY glad_instrument_glPointParameterf(GLenum pname, GLfloat param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPointParameterf(pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glPointParameterf, glad_start, glad_redundant);
+}
+
+static PFNGLPOINTPARAMETERFVPROC glad_real_glPointParameterfv = NULL;
+static void APIENTRY glad_instrument_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPointParameterfv(pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glPointParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLPOINTPARAMETERIPROC glad_real_glPointParameteri = NULL;
+static void APIENTRY glad_instrument_glPointParameteri(GLenum pname, GLint param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPointParameteri(pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glPointParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLPOINTPARAMETERIVPROC glad_real_glPointParameteriv = NULL;
+static void APIENTRY glad_instrument_glPointParameteriv(GLenum pname, const GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPointParameteriv(pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glPointParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDCOLORPROC glad_real_glBlendColor = NULL;
+static void APIENTRY glad_instrument_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendColor(red, green, blue, alpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendColor, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDEQUATIONPROC glad_real_glBlendEquation = NULL;
+static void APIENTRY glad_instrument_glBlendEquation(GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendEquation(mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendEquation, glad_start, glad_redundant);
+}
+
+static PFNGLGENQUERIESPROC glad_real_glGenQueries = NULL;
+static void APIENTRY glad_instrument_glGenQueries(GLsizei n, GLuint *ids) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenQueries(n, ids);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenQueries, glad_start, glad_redundant);
+}
+
+static PFNGLDELETEQUERIESPROC glad_real_glDeleteQueries = NULL;
+static void APIENTRY glad_instrument_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteQueries(n, ids);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteQueries, glad_start, glad_redundant);
+}
+
+static PFNGLISQUERYPROC glad_real_glIsQuery = NULL;
+static GLboolean APIENTRY glad_instrument_glIsQuery(GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsQuery(id);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsQuery, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBEGINQUERYPROC glad_real_glBeginQuery = NULL;
+static void APIENTRY glad_instrument_glBeginQuery(GLenum target, GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBeginQuery(target, id);
+    glad_instrument_record(GLAD_INSTRUMENT_glBeginQuery, glad_start, glad_redundant);
+}
+
+static PFNGLENDQUERYPROC glad_real_glEndQuery = NULL;
+static void APIENTRY glad_instrument_glEndQuery(GLenum target) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEndQuery(target);
+    glad_instrument_record(GLAD_INSTRUMENT_glEndQuery, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYIVPROC glad_real_glGetQueryiv = NULL;
+static void APIENTRY glad_instrument_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryiv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYOBJECTIVPROC glad_real_glGetQueryObjectiv = NULL;
+static void APIENTRY glad_instrument_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryObjectiv(id, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryObjectiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYOBJECTUIVPROC glad_real_glGetQueryObjectuiv = NULL;
+static void APIENTRY glad_instrument_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryObjectuiv(id, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryObjectuiv, glad_start, glad_redundant);
+}
+
+static PFNGLBINDBUFFERPROC glad_real_glBindBuffer = NULL;
+static void APIENTRY glad_instrument_glBindBuffer(GLenum target, GLuint buffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindBuffer(target, buffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindBuffer, glad_start, glad_redundant);
+}
+
+static PFNGLDELETEBUFFERSPROC glad_real_glDeleteBuffers = NULL;
+static void APIENTRY glad_instrument_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteBuffers(n, buffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteBuffers, glad_start, glad_redundant);
+}
+
+static PFNGLGENBUFFERSPROC glad_real_glGenBuffers = NULL;
+static void APIENTRY glad_instrument_glGenBuffers(GLsizei n, GLuint *buffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenBuffers(n, buffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenBuffers, glad_start, glad_redundant);
+}
+
+static PFNGLISBUFFERPROC glad_real_glIsBuffer = NULL;
+static GLboolean APIENTRY glad_instrument_glIsBuffer(GLuint buffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsBuffer(buffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsBuffer, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBUFFERDATAPROC glad_real_glBufferData = NULL;
+static void APIENTRY glad_instrument_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBufferData(target, size, data, usage);
+    glad_instrument_record(GLAD_INSTRUMENT_glBufferData, glad_start, glad_redundant);
+}
+
+static PFNGLBUFFERSUBDATAPROC glad_real_glBufferSubData = NULL;
+static void APIENTRY glad_instrument_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBufferSubData(target, offset, size, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glBufferSubData, glad_start, glad_redundant);
+}
+
+static PFNGLGETBUFFERSUBDATAPROC glad_real_glGetBufferSubData = NULL;
+static void APIENTRY glad_instrument_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBufferSubData(target, offset, size, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBufferSubData, glad_start, glad_redundant);
+}
+
+static PFNGLMAPBUFFERPROC glad_real_glMapBuffer = NULL;
+static void * APIENTRY glad_instrument_glMapBuffer(GLenum target, GLenum access) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    void * glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glMapBuffer(target, access);
+    glad_instrument_record(GLAD_INSTRUMENT_glMapBuffer, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLUNMAPBUFFERPROC glad_real_glUnmapBuffer = NULL;
+static GLboolean APIENTRY glad_instrument_glUnmapBuffer(GLenum target) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glUnmapBuffer(target);
+    glad_instrument_record(GLAD_INSTRUMENT_glUnmapBuffer, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETBUFFERPARAMETERIVPROC glad_real_glGetBufferParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBufferParameteriv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBufferParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLGETBUFFERPOINTERVPROC glad_real_glGetBufferPointerv = NULL;
+static void APIENTRY glad_instrument_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBufferPointerv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBufferPointerv, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_real_glBlendEquationSeparate = NULL;
+static void APIENTRY glad_instrument_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendEquationSeparate(modeRGB, modeAlpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendEquationSeparate, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWBUFFERSPROC glad_real_glDrawBuffers = NULL;
+static void APIENTRY glad_instrument_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawBuffers(n, bufs);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawBuffers, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILOPSEPARATEPROC glad_real_glStencilOpSeparate = NULL;
+static void APIENTRY glad_instrument_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilOpSeparate, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILFUNCSEPARATEPROC glad_real_glStencilFuncSeparate = NULL;
+static void APIENTRY glad_instrument_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilFuncSeparate(face, func, ref, mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilFuncSeparate, glad_start, glad_redundant);
+}
+
+static PFNGLSTENCILMASKSEPARATEPROC glad_real_glStencilMaskSeparate = NULL;
+static void APIENTRY glad_instrument_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glStencilMaskSeparate(face, mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glStencilMaskSeparate, glad_start, glad_redundant);
+}
+
+static PFNGLATTACHSHADERPROC glad_real_glAttachShader = NULL;
+static void APIENTRY glad_instrument_glAttachShader(GLuint program, GLuint shader) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glAttachShader(program, shader);
+    glad_instrument_record(GLAD_INSTRUMENT_glAttachShader, glad_start, glad_redundant);
+}
+
+static PFNGLBINDATTRIBLOCATIONPROC glad_real_glBindAttribLocation = NULL;
+static void APIENTRY glad_instrument_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindAttribLocation(program, index, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindAttribLocation, glad_start, glad_redundant);
+}
+
+static PFNGLCOMPILESHADERPROC glad_real_glCompileShader = NULL;
+static void APIENTRY glad_instrument_glCompileShader(GLuint shader) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCompileShader(shader);
+    glad_instrument_record(GLAD_INSTRUMENT_glCompileShader, glad_start, glad_redundant);
+}
+
+static PFNGLCREATEPROGRAMPROC glad_real_glCreateProgram = NULL;
+static GLuint APIENTRY glad_instrument_glCreateProgram(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glCreateProgram();
+    glad_instrument_record(GLAD_INSTRUMENT_glCreateProgram, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLCREATESHADERPROC glad_real_glCreateShader = NULL;
+static GLuint APIENTRY glad_instrument_glCreateShader(GLenum type) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glCreateShader(type);
+    glad_instrument_record(GLAD_INSTRUMENT_glCreateShader, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLDELETEPROGRAMPROC glad_real_glDeleteProgram = NULL;
+static void APIENTRY glad_instrument_glDeleteProgram(GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_forget_program(program);
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteProgram(program);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteProgram, glad_start, glad_redundant);
+}
+
+static PFNGLDELETESHADERPROC glad_real_glDeleteShader = NULL;
+static void APIENTRY glad_instrument_glDeleteShader(GLuint shader) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteShader(shader);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteShader, glad_start, glad_redundant);
+}
+
+static PFNGLDETACHSHADERPROC glad_real_glDetachShader = NULL;
+static void APIENTRY glad_instrument_glDetachShader(GLuint program, GLuint shader) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDetachShader(program, shader);
+    glad_instrument_record(GLAD_INSTRUMENT_glDetachShader, glad_start, glad_redundant);
+}
+
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_real_glDisableVertexAttribArray = NULL;
+static void APIENTRY glad_instrument_glDisableVertexAttribArray(GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDisableVertexAttribArray(index);
+    glad_instrument_record(GLAD_INSTRUMENT_glDisableVertexAttribArray, glad_start, glad_redundant);
+}
+
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_real_glEnableVertexAttribArray = NULL;
+static void APIENTRY glad_instrument_glEnableVertexAttribArray(GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEnableVertexAttribArray(index);
+    glad_instrument_record(GLAD_INSTRUMENT_glEnableVertexAttribArray, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEATTRIBPROC glad_real_glGetActiveAttrib = NULL;
+static void APIENTRY glad_instrument_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveAttrib, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEUNIFORMPROC glad_real_glGetActiveUniform = NULL;
+static void APIENTRY glad_instrument_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveUniform, glad_start, glad_redundant);
+}
+
+static PFNGLGETATTACHEDSHADERSPROC glad_real_glGetAttachedShaders = NULL;
+static void APIENTRY glad_instrument_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetAttachedShaders(program, maxCount, count, shaders);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetAttachedShaders, glad_start, glad_redundant);
+}
+
+static PFNGLGETATTRIBLOCATIONPROC glad_real_glGetAttribLocation = NULL;
+static GLint APIENTRY glad_instrument_glGetAttribLocation(GLuint program, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetAttribLocation(program, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetAttribLocation, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETPROGRAMIVPROC glad_real_glGetProgramiv = NULL;
+static void APIENTRY glad_instrument_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramiv(program, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMINFOLOGPROC glad_real_glGetProgramInfoLog = NULL;
+static void APIENTRY glad_instrument_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramInfoLog, glad_start, glad_redundant);
+}
+
+static PFNGLGETSHADERIVPROC glad_real_glGetShaderiv = NULL;
+static void APIENTRY glad_instrument_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetShaderiv(shader, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetShaderiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSHADERINFOLOGPROC glad_real_glGetShaderInfoLog = NULL;
+static void APIENTRY glad_instrument_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetShaderInfoLog, glad_start, glad_redundant);
+}
+
+static PFNGLGETSHADERSOURCEPROC glad_real_glGetShaderSource = NULL;
+static void APIENTRY glad_instrument_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetShaderSource(shader, bufSize, length, source);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetShaderSource, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMLOCATIONPROC glad_real_glGetUniformLocation = NULL;
+static GLint APIENTRY glad_instrument_glGetUniformLocation(GLuint program, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetUniformLocation(program, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformLocation, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETUNIFORMFVPROC glad_real_glGetUniformfv = NULL;
+static void APIENTRY glad_instrument_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformfv(program, location, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformfv, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMIVPROC glad_real_glGetUniformiv = NULL;
+static void APIENTRY glad_instrument_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformiv(program, location, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBDVPROC glad_real_glGetVertexAttribdv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribdv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribdv, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBFVPROC glad_real_glGetVertexAttribfv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribfv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribfv, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBIVPROC glad_real_glGetVertexAttribiv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribiv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_real_glGetVertexAttribPointerv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribPointerv(index, pname, pointer);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribPointerv, glad_start, glad_redundant);
+}
+
+static PFNGLISPROGRAMPROC glad_real_glIsProgram = NULL;
+static GLboolean APIENTRY glad_instrument_glIsProgram(GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsProgram(program);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsProgram, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLISSHADERPROC glad_real_glIsShader = NULL;
+static GLboolean APIENTRY glad_instrument_glIsShader(GLuint shader) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsShader(shader);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsShader, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLLINKPROGRAMPROC glad_real_glLinkProgram = NULL;
+static void APIENTRY glad_instrument_glLinkProgram(GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_forget_program(program);
+    glad_start = glad_instrument_now();
+    glad_real_glLinkProgram(program);
+    glad_instrument_record(GLAD_INSTRUMENT_glLinkProgram, glad_start, glad_redundant);
+}
+
+static PFNGLSHADERSOURCEPROC glad_real_glShaderSource = NULL;
+static void APIENTRY glad_instrument_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glShaderSource(shader, count, string, length);
+    glad_instrument_record(GLAD_INSTRUMENT_glShaderSource, glad_start, glad_redundant);
+}
+
+static PFNGLUSEPROGRAMPROC glad_real_glUseProgram = NULL;
+static void APIENTRY glad_instrument_glUseProgram(GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_use_program(program);
+    glad_start = glad_instrument_now();
+    glad_real_glUseProgram(program);
+    glad_instrument_record(GLAD_INSTRUMENT_glUseProgram, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1FPROC glad_real_glUniform1f = NULL;
+static void APIENTRY glad_instrument_glUniform1f(GLint location, GLfloat v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1f, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1f(location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1f, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2FPROC glad_real_glUniform2f = NULL;
+static void APIENTRY glad_instrument_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2f, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2f(location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2f, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3FPROC glad_real_glUniform3f = NULL;
+static void APIENTRY glad_instrument_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3f, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3f(location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3f, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4FPROC glad_real_glUniform4f = NULL;
+static void APIENTRY glad_instrument_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4f, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4f(location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4f, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1IPROC glad_real_glUniform1i = NULL;
+static void APIENTRY glad_instrument_glUniform1i(GLint location, GLint v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1i, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1i(location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1i, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2IPROC glad_real_glUniform2i = NULL;
+static void APIENTRY glad_instrument_glUniform2i(GLint location, GLint v0, GLint v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2i, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2i(location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2i, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3IPROC glad_real_glUniform3i = NULL;
+static void APIENTRY glad_instrument_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3i, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3i(location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3i, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4IPROC glad_real_glUniform4i = NULL;
+static void APIENTRY glad_instrument_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4i, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4i(location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4i, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1FVPROC glad_real_glUniform1fv = NULL;
+static void APIENTRY glad_instrument_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1fv, glad_instrument_program, location, value, (size_t)count * 1 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1fv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2FVPROC glad_real_glUniform2fv = NULL;
+static void APIENTRY glad_instrument_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2fv, glad_instrument_program, location, value, (size_t)count * 2 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2fv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3FVPROC glad_real_glUniform3fv = NULL;
+static void APIENTRY glad_instrument_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3fv, glad_instrument_program, location, value, (size_t)count * 3 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3fv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4FVPROC glad_real_glUniform4fv = NULL;
+static void APIENTRY glad_instrument_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4fv, glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4fv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1IVPROC glad_real_glUniform1iv = NULL;
+static void APIENTRY glad_instrument_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1iv, glad_instrument_program, location, value, (size_t)count * 1 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1iv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1iv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2IVPROC glad_real_glUniform2iv = NULL;
+static void APIENTRY glad_instrument_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2iv, glad_instrument_program, location, value, (size_t)count * 2 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2iv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2iv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3IVPROC glad_real_glUniform3iv = NULL;
+static void APIENTRY glad_instrument_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3iv, glad_instrument_program, location, value, (size_t)count * 3 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3iv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3iv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4IVPROC glad_real_glUniform4iv = NULL;
+static void APIENTRY glad_instrument_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4iv, glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4iv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4iv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2FVPROC glad_real_glUniformMatrix2fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3FVPROC glad_real_glUniformMatrix3fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 9 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4FVPROC glad_real_glUniformMatrix4fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 16 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4fv, glad_start, glad_redundant);
+}
+
+static PFNGLVALIDATEPROGRAMPROC glad_real_glValidateProgram = NULL;
+static void APIENTRY glad_instrument_glValidateProgram(GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glValidateProgram(program);
+    glad_instrument_record(GLAD_INSTRUMENT_glValidateProgram, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1DPROC glad_real_glVertexAttrib1d = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1d(GLuint index, GLdouble x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1d(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1DVPROC glad_real_glVertexAttrib1dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1FPROC glad_real_glVertexAttrib1f = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1f(GLuint index, GLfloat x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1f(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1f, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1FVPROC glad_real_glVertexAttrib1fv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1fv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1fv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1SPROC glad_real_glVertexAttrib1s = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1s(GLuint index, GLshort x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1s(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1s, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB1SVPROC glad_real_glVertexAttrib1sv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib1sv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib1sv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2DPROC glad_real_glVertexAttrib2d = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2d(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2DVPROC glad_real_glVertexAttrib2dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2FPROC glad_real_glVertexAttrib2f = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2f(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2f, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2FVPROC glad_real_glVertexAttrib2fv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2fv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2fv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2SPROC glad_real_glVertexAttrib2s = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2s(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2s, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB2SVPROC glad_real_glVertexAttrib2sv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib2sv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib2sv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3DPROC glad_real_glVertexAttrib3d = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3d(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3DVPROC glad_real_glVertexAttrib3dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3FPROC glad_real_glVertexAttrib3f = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3f(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3f, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3FVPROC glad_real_glVertexAttrib3fv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3fv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3fv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3SPROC glad_real_glVertexAttrib3s = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3s(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3s, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB3SVPROC glad_real_glVertexAttrib3sv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib3sv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib3sv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NBVPROC glad_real_glVertexAttrib4Nbv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nbv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nbv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NIVPROC glad_real_glVertexAttrib4Niv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Niv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Niv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NSVPROC glad_real_glVertexAttrib4Nsv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nsv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nsv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NUBPROC glad_real_glVertexAttrib4Nub = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nub(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nub, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NUBVPROC glad_real_glVertexAttrib4Nubv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nubv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nubv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NUIVPROC glad_real_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nuiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nuiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4NUSVPROC glad_real_glVertexAttrib4Nusv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4Nusv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4Nusv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4BVPROC glad_real_glVertexAttrib4bv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4bv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4bv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4DPROC glad_real_glVertexAttrib4d = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4d(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4DVPROC glad_real_glVertexAttrib4dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4FPROC glad_real_glVertexAttrib4f = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4f(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4f, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4FVPROC glad_real_glVertexAttrib4fv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4fv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4fv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4IVPROC glad_real_glVertexAttrib4iv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4iv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4iv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4SPROC glad_real_glVertexAttrib4s = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4s(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4s, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4SVPROC glad_real_glVertexAttrib4sv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4sv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4sv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4UBVPROC glad_real_glVertexAttrib4ubv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4ubv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4ubv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4UIVPROC glad_real_glVertexAttrib4uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4uiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIB4USVPROC glad_real_glVertexAttrib4usv = NULL;
+static void APIENTRY glad_instrument_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttrib4usv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttrib4usv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBPOINTERPROC glad_real_glVertexAttribPointer = NULL;
+static void APIENTRY glad_instrument_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribPointer, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_real_glUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 6 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2x3fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2x3fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_real_glUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 6 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3x2fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3x2fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_real_glUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 8 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2x4fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2x4fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_real_glUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 8 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4x2fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4x2fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_real_glUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 12 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3x4fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3x4fv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_real_glUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 12 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4x3fv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4x3fv, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORMASKIPROC glad_real_glColorMaski = NULL;
+static void APIENTRY glad_instrument_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorMaski(index, r, g, b, a);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorMaski, glad_start, glad_redundant);
+}
+
+static PFNGLGETBOOLEANI_VPROC glad_real_glGetBooleani_v = NULL;
+static void APIENTRY glad_instrument_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBooleani_v(target, index, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBooleani_v, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTEGERI_VPROC glad_real_glGetIntegeri_v = NULL;
+static void APIENTRY glad_instrument_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetIntegeri_v(target, index, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetIntegeri_v, glad_start, glad_redundant);
+}
+
+static PFNGLENABLEIPROC glad_real_glEnablei = NULL;
+static void APIENTRY glad_instrument_glEnablei(GLenum target, GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEnablei(target, index);
+    glad_instrument_record(GLAD_INSTRUMENT_glEnablei, glad_start, glad_redundant);
+}
+
+static PFNGLDISABLEIPROC glad_real_glDisablei = NULL;
+static void APIENTRY glad_instrument_glDisablei(GLenum target, GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDisablei(target, index);
+    glad_instrument_record(GLAD_INSTRUMENT_glDisablei, glad_start, glad_redundant);
+}
+
+static PFNGLISENABLEDIPROC glad_real_glIsEnabledi = NULL;
+static GLboolean APIENTRY glad_instrument_glIsEnabledi(GLenum target, GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsEnabledi(target, index);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsEnabledi, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_real_glBeginTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glBeginTransformFeedback(GLenum primitiveMode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBeginTransformFeedback(primitiveMode);
+    glad_instrument_record(GLAD_INSTRUMENT_glBeginTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_real_glEndTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glEndTransformFeedback(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEndTransformFeedback();
+    glad_instrument_record(GLAD_INSTRUMENT_glEndTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLBINDBUFFERRANGEPROC glad_real_glBindBufferRange = NULL;
+static void APIENTRY glad_instrument_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindBufferRange(target, index, buffer, offset, size);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindBufferRange, glad_start, glad_redundant);
+}
+
+static PFNGLBINDBUFFERBASEPROC glad_real_glBindBufferBase = NULL;
+static void APIENTRY glad_instrument_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindBufferBase(target, index, buffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindBufferBase, glad_start, glad_redundant);
+}
+
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_real_glTransformFeedbackVaryings = NULL;
+static void APIENTRY glad_instrument_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+    glad_instrument_record(GLAD_INSTRUMENT_glTransformFeedbackVaryings, glad_start, glad_redundant);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_real_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY glad_instrument_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTransformFeedbackVarying, glad_start, glad_redundant);
+}
+
+static PFNGLCLAMPCOLORPROC glad_real_glClampColor = NULL;
+static void APIENTRY glad_instrument_glClampColor(GLenum target, GLenum clamp) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClampColor(target, clamp);
+    glad_instrument_record(GLAD_INSTRUMENT_glClampColor, glad_start, glad_redundant);
+}
+
+static PFNGLBEGINCONDITIONALRENDERPROC glad_real_glBeginConditionalRender = NULL;
+static void APIENTRY glad_instrument_glBeginConditionalRender(GLuint id, GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBeginConditionalRender(id, mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glBeginConditionalRender, glad_start, glad_redundant);
+}
+
+static PFNGLENDCONDITIONALRENDERPROC glad_real_glEndConditionalRender = NULL;
+static void APIENTRY glad_instrument_glEndConditionalRender(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEndConditionalRender();
+    glad_instrument_record(GLAD_INSTRUMENT_glEndConditionalRender, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_real_glVertexAttribIPointer = NULL;
+static void APIENTRY glad_instrument_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribIPointer(index, size, type, stride, pointer);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribIPointer, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBIIVPROC glad_real_glGetVertexAttribIiv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribIiv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribIiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_real_glGetVertexAttribIuiv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribIuiv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribIuiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI1IPROC glad_real_glVertexAttribI1i = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI1i(GLuint index, GLint x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI1i(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI1i, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI2IPROC glad_real_glVertexAttribI2i = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI2i(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI2i, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI3IPROC glad_real_glVertexAttribI3i = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI3i(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI3i, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4IPROC glad_real_glVertexAttribI4i = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4i(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4i, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI1UIPROC glad_real_glVertexAttribI1ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI1ui(GLuint index, GLuint x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI1ui(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI1ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI2UIPROC glad_real_glVertexAttribI2ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI2ui(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI2ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI3UIPROC glad_real_glVertexAttribI3ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI3ui(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI3ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4UIPROC glad_real_glVertexAttribI4ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4ui(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI1IVPROC glad_real_glVertexAttribI1iv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI1iv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI1iv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI2IVPROC glad_real_glVertexAttribI2iv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI2iv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI2iv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI3IVPROC glad_real_glVertexAttribI3iv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI3iv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI3iv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4IVPROC glad_real_glVertexAttribI4iv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4iv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4iv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI1UIVPROC glad_real_glVertexAttribI1uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI1uiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI2UIVPROC glad_real_glVertexAttribI2uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI2uiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI3UIVPROC glad_real_glVertexAttribI3uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI3uiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4UIVPROC glad_real_glVertexAttribI4uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4uiv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4BVPROC glad_real_glVertexAttribI4bv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4bv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4bv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4SVPROC glad_real_glVertexAttribI4sv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4sv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4sv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4UBVPROC glad_real_glVertexAttribI4ubv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4ubv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4ubv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBI4USVPROC glad_real_glVertexAttribI4usv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribI4usv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribI4usv, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMUIVPROC glad_real_glGetUniformuiv = NULL;
+static void APIENTRY glad_instrument_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformuiv(program, location, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformuiv, glad_start, glad_redundant);
+}
+
+static PFNGLBINDFRAGDATALOCATIONPROC glad_real_glBindFragDataLocation = NULL;
+static void APIENTRY glad_instrument_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindFragDataLocation(program, color, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindFragDataLocation, glad_start, glad_redundant);
+}
+
+static PFNGLGETFRAGDATALOCATIONPROC glad_real_glGetFragDataLocation = NULL;
+static GLint APIENTRY glad_instrument_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetFragDataLocation(program, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFragDataLocation, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLUNIFORM1UIPROC glad_real_glUniform1ui = NULL;
+static void APIENTRY glad_instrument_glUniform1ui(GLint location, GLuint v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1ui, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1ui(location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1ui, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2UIPROC glad_real_glUniform2ui = NULL;
+static void APIENTRY glad_instrument_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2ui, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2ui(location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2ui, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3UIPROC glad_real_glUniform3ui = NULL;
+static void APIENTRY glad_instrument_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3ui, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3ui(location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3ui, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4UIPROC glad_real_glUniform4ui = NULL;
+static void APIENTRY glad_instrument_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4ui, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4ui(location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4ui, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1UIVPROC glad_real_glUniform1uiv = NULL;
+static void APIENTRY glad_instrument_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1uiv, glad_instrument_program, location, value, (size_t)count * 1 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1uiv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2UIVPROC glad_real_glUniform2uiv = NULL;
+static void APIENTRY glad_instrument_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2uiv, glad_instrument_program, location, value, (size_t)count * 2 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2uiv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3UIVPROC glad_real_glUniform3uiv = NULL;
+static void APIENTRY glad_instrument_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3uiv, glad_instrument_program, location, value, (size_t)count * 3 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3uiv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4UIVPROC glad_real_glUniform4uiv = NULL;
+static void APIENTRY glad_instrument_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4uiv, glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4uiv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERIIVPROC glad_real_glTexParameterIiv = NULL;
+static void APIENTRY glad_instrument_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameterIiv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameterIiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXPARAMETERIUIVPROC glad_real_glTexParameterIuiv = NULL;
+static void APIENTRY glad_instrument_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexParameterIuiv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexParameterIuiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXPARAMETERIIVPROC glad_real_glGetTexParameterIiv = NULL;
+static void APIENTRY glad_instrument_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexParameterIiv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexParameterIiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETTEXPARAMETERIUIVPROC glad_real_glGetTexParameterIuiv = NULL;
+static void APIENTRY glad_instrument_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetTexParameterIuiv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetTexParameterIuiv, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERIVPROC glad_real_glClearBufferiv = NULL;
+static void APIENTRY glad_instrument_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferiv(buffer, drawbuffer, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferiv, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERUIVPROC glad_real_glClearBufferuiv = NULL;
+static void APIENTRY glad_instrument_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferuiv(buffer, drawbuffer, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferuiv, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERFVPROC glad_real_glClearBufferfv = NULL;
+static void APIENTRY glad_instrument_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferfv(buffer, drawbuffer, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferfv, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERFIPROC glad_real_glClearBufferfi = NULL;
+static void APIENTRY glad_instrument_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferfi, glad_start, glad_redundant);
+}
+
+static PFNGLGETSTRINGIPROC glad_real_glGetStringi = NULL;
+static const GLubyte * APIENTRY glad_instrument_glGetStringi(GLenum name, GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    const GLubyte * glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetStringi(name, index);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetStringi, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLISRENDERBUFFERPROC glad_real_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY glad_instrument_glIsRenderbuffer(GLuint renderbuffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsRenderbuffer(renderbuffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsRenderbuffer, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBINDRENDERBUFFERPROC glad_real_glBindRenderbuffer = NULL;
+static void APIENTRY glad_instrument_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindRenderbuffer(target, renderbuffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindRenderbuffer, glad_start, glad_redundant);
+}
+
+static PFNGLDELETERENDERBUFFERSPROC glad_real_glDeleteRenderbuffers = NULL;
+static void APIENTRY glad_instrument_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteRenderbuffers(n, renderbuffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteRenderbuffers, glad_start, glad_redundant);
+}
+
+static PFNGLGENRENDERBUFFERSPROC glad_real_glGenRenderbuffers = NULL;
+static void APIENTRY glad_instrument_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenRenderbuffers(n, renderbuffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenRenderbuffers, glad_start, glad_redundant);
+}
+
+static PFNGLRENDERBUFFERSTORAGEPROC glad_real_glRenderbufferStorage = NULL;
+static void APIENTRY glad_instrument_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glRenderbufferStorage(target, internalformat, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glRenderbufferStorage, glad_start, glad_redundant);
+}
+
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_real_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetRenderbufferParameteriv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetRenderbufferParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLISFRAMEBUFFERPROC glad_real_glIsFramebuffer = NULL;
+static GLboolean APIENTRY glad_instrument_glIsFramebuffer(GLuint framebuffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsFramebuffer(framebuffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsFramebuffer, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBINDFRAMEBUFFERPROC glad_real_glBindFramebuffer = NULL;
+static void APIENTRY glad_instrument_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindFramebuffer(target, framebuffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindFramebuffer, glad_start, glad_redundant);
+}
+
+static PFNGLDELETEFRAMEBUFFERSPROC glad_real_glDeleteFramebuffers = NULL;
+static void APIENTRY glad_instrument_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteFramebuffers(n, framebuffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteFramebuffers, glad_start, glad_redundant);
+}
+
+static PFNGLGENFRAMEBUFFERSPROC glad_real_glGenFramebuffers = NULL;
+static void APIENTRY glad_instrument_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenFramebuffers(n, framebuffers);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenFramebuffers, glad_start, glad_redundant);
+}
+
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_real_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY glad_instrument_glCheckFramebufferStatus(GLenum target) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLenum glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glCheckFramebufferStatus(target);
+    glad_instrument_record(GLAD_INSTRUMENT_glCheckFramebufferStatus, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_real_glFramebufferTexture1D = NULL;
+static void APIENTRY glad_instrument_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferTexture1D, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_real_glFramebufferTexture2D = NULL;
+static void APIENTRY glad_instrument_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferTexture2D, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_real_glFramebufferTexture3D = NULL;
+static void APIENTRY glad_instrument_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferTexture3D, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_real_glFramebufferRenderbuffer = NULL;
+static void APIENTRY glad_instrument_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferRenderbuffer, glad_start, glad_redundant);
+}
+
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_real_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFramebufferAttachmentParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLGENERATEMIPMAPPROC glad_real_glGenerateMipmap = NULL;
+static void APIENTRY glad_instrument_glGenerateMipmap(GLenum target) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenerateMipmap(target);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenerateMipmap, glad_start, glad_redundant);
+}
+
+static PFNGLBLITFRAMEBUFFERPROC glad_real_glBlitFramebuffer = NULL;
+static void APIENTRY glad_instrument_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlitFramebuffer, glad_start, glad_redundant);
+}
+
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_real_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY glad_instrument_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glRenderbufferStorageMultisample, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_real_glFramebufferTextureLayer = NULL;
+static void APIENTRY glad_instrument_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferTextureLayer, glad_start, glad_redundant);
+}
+
+static PFNGLMAPBUFFERRANGEPROC glad_real_glMapBufferRange = NULL;
+static void * APIENTRY glad_instrument_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    void * glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glMapBufferRange(target, offset, length, access);
+    glad_instrument_record(GLAD_INSTRUMENT_glMapBufferRange, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_real_glFlushMappedBufferRange = NULL;
+static void APIENTRY glad_instrument_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFlushMappedBufferRange(target, offset, length);
+    glad_instrument_record(GLAD_INSTRUMENT_glFlushMappedBufferRange, glad_start, glad_redundant);
+}
+
+static PFNGLBINDVERTEXARRAYPROC glad_real_glBindVertexArray = NULL;
+static void APIENTRY glad_instrument_glBindVertexArray(GLuint array) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_bind_vertex_array(array);
+    glad_start = glad_instrument_now();
+    glad_real_glBindVertexArray(array);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindVertexArray, glad_start, glad_redundant);
+}
+
+static PFNGLDELETEVERTEXARRAYSPROC glad_real_glDeleteVertexArrays = NULL;
+static void APIENTRY glad_instrument_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_delete_vertex_arrays(n, arrays);
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteVertexArrays(n, arrays);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteVertexArrays, glad_start, glad_redundant);
+}
+
+static PFNGLGENVERTEXARRAYSPROC glad_real_glGenVertexArrays = NULL;
+static void APIENTRY glad_instrument_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenVertexArrays(n, arrays);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenVertexArrays, glad_start, glad_redundant);
+}
+
+static PFNGLISVERTEXARRAYPROC glad_real_glIsVertexArray = NULL;
+static GLboolean APIENTRY glad_instrument_glIsVertexArray(GLuint array) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsVertexArray(array);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsVertexArray, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_real_glDrawArraysInstanced = NULL;
+static void APIENTRY glad_instrument_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawArraysInstanced(mode, first, count, instancecount);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawArraysInstanced, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_real_glDrawElementsInstanced = NULL;
+static void APIENTRY glad_instrument_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsInstanced, glad_start, glad_redundant);
+}
+
+static PFNGLTEXBUFFERPROC glad_real_glTexBuffer = NULL;
+static void APIENTRY glad_instrument_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexBuffer(target, internalformat, buffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexBuffer, glad_start, glad_redundant);
+}
+
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_real_glPrimitiveRestartIndex = NULL;
+static void APIENTRY glad_instrument_glPrimitiveRestartIndex(GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPrimitiveRestartIndex(index);
+    glad_instrument_record(GLAD_INSTRUMENT_glPrimitiveRestartIndex, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYBUFFERSUBDATAPROC glad_real_glCopyBufferSubData = NULL;
+static void APIENTRY glad_instrument_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyBufferSubData, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMINDICESPROC glad_real_glGetUniformIndices = NULL;
+static void APIENTRY glad_instrument_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformIndices, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_real_glGetActiveUniformsiv = NULL;
+static void APIENTRY glad_instrument_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveUniformsiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_real_glGetActiveUniformName = NULL;
+static void APIENTRY glad_instrument_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveUniformName, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_real_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY glad_instrument_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetUniformBlockIndex(program, uniformBlockName);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformBlockIndex, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_real_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY glad_instrument_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveUniformBlockiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_real_glGetActiveUniformBlockName = NULL;
+static void APIENTRY glad_instrument_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveUniformBlockName, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_real_glUniformBlockBinding = NULL;
+static void APIENTRY glad_instrument_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformBlockBinding, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_real_glDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_instrument_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsBaseVertex, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_real_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY glad_instrument_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawRangeElementsBaseVertex, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_real_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsInstancedBaseVertex, glad_start, glad_redundant);
+}
+
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_real_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_instrument_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiDrawElementsBaseVertex, glad_start, glad_redundant);
+}
+
+static PFNGLPROVOKINGVERTEXPROC glad_real_glProvokingVertex = NULL;
+static void APIENTRY glad_instrument_glProvokingVertex(GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glProvokingVertex(mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glProvokingVertex, glad_start, glad_redundant);
+}
+
+static PFNGLFENCESYNCPROC glad_real_glFenceSync = NULL;
+static GLsync APIENTRY glad_instrument_glFenceSync(GLenum condition, GLbitfield flags) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLsync glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glFenceSync(condition, flags);
+    glad_instrument_record(GLAD_INSTRUMENT_glFenceSync, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLISSYNCPROC glad_real_glIsSync = NULL;
+static GLboolean APIENTRY glad_instrument_glIsSync(GLsync sync) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsSync(sync);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsSync, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLDELETESYNCPROC glad_real_glDeleteSync = NULL;
+static void APIENTRY glad_instrument_glDeleteSync(GLsync sync) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteSync(sync);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteSync, glad_start, glad_redundant);
+}
+
+static PFNGLCLIENTWAITSYNCPROC glad_real_glClientWaitSync = NULL;
+static GLenum APIENTRY glad_instrument_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLenum glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glClientWaitSync(sync, flags, timeout);
+    glad_instrument_record(GLAD_INSTRUMENT_glClientWaitSync, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLWAITSYNCPROC glad_real_glWaitSync = NULL;
+static void APIENTRY glad_instrument_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glWaitSync(sync, flags, timeout);
+    glad_instrument_record(GLAD_INSTRUMENT_glWaitSync, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTEGER64VPROC glad_real_glGetInteger64v = NULL;
+static void APIENTRY glad_instrument_glGetInteger64v(GLenum pname, GLint64 *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetInteger64v(pname, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetInteger64v, glad_start, glad_redundant);
+}
+
+static PFNGLGETSYNCIVPROC glad_real_glGetSynciv = NULL;
+static void APIENTRY glad_instrument_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetSynciv(sync, pname, bufSize, length, values);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSynciv, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTEGER64I_VPROC glad_real_glGetInteger64i_v = NULL;
+static void APIENTRY glad_instrument_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetInteger64i_v(target, index, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetInteger64i_v, glad_start, glad_redundant);
+}
+
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_real_glGetBufferParameteri64v = NULL;
+static void APIENTRY glad_instrument_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetBufferParameteri64v(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetBufferParameteri64v, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_real_glFramebufferTexture = NULL;
+static void APIENTRY glad_instrument_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferTexture(target, attachment, texture, level);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferTexture, glad_start, glad_redundant);
+}
+
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_real_glTexImage2DMultisample = NULL;
+static void APIENTRY glad_instrument_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexImage2DMultisample, glad_start, glad_redundant);
+}
+
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_real_glTexImage3DMultisample = NULL;
+static void APIENTRY glad_instrument_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexImage3DMultisample, glad_start, glad_redundant);
+}
+
+static PFNGLGETMULTISAMPLEFVPROC glad_real_glGetMultisamplefv = NULL;
+static void APIENTRY glad_instrument_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetMultisamplefv(pname, index, val);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetMultisamplefv, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLEMASKIPROC glad_real_glSampleMaski = NULL;
+static void APIENTRY glad_instrument_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSampleMaski(maskNumber, mask);
+    glad_instrument_record(GLAD_INSTRUMENT_glSampleMaski, glad_start, glad_redundant);
+}
+
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_real_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY glad_instrument_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindFragDataLocationIndexed, glad_start, glad_redundant);
+}
+
+static PFNGLGETFRAGDATAINDEXPROC glad_real_glGetFragDataIndex = NULL;
+static GLint APIENTRY glad_instrument_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetFragDataIndex(program, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFragDataIndex, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGENSAMPLERSPROC glad_real_glGenSamplers = NULL;
+static void APIENTRY glad_instrument_glGenSamplers(GLsizei count, GLuint *samplers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenSamplers(count, samplers);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenSamplers, glad_start, glad_redundant);
+}
+
+static PFNGLDELETESAMPLERSPROC glad_real_glDeleteSamplers = NULL;
+static void APIENTRY glad_instrument_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteSamplers(count, samplers);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteSamplers, glad_start, glad_redundant);
+}
+
+static PFNGLISSAMPLERPROC glad_real_glIsSampler = NULL;
+static GLboolean APIENTRY glad_instrument_glIsSampler(GLuint sampler) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsSampler(sampler);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsSampler, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBINDSAMPLERPROC glad_real_glBindSampler = NULL;
+static void APIENTRY glad_instrument_glBindSampler(GLuint unit, GLuint sampler) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindSampler(unit, sampler);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindSampler, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERIPROC glad_real_glSamplerParameteri = NULL;
+static void APIENTRY glad_instrument_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameteri(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERIVPROC glad_real_glSamplerParameteriv = NULL;
+static void APIENTRY glad_instrument_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameteriv(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERFPROC glad_real_glSamplerParameterf = NULL;
+static void APIENTRY glad_instrument_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameterf(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameterf, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERFVPROC glad_real_glSamplerParameterfv = NULL;
+static void APIENTRY glad_instrument_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameterfv(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERIIVPROC glad_real_glSamplerParameterIiv = NULL;
+static void APIENTRY glad_instrument_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameterIiv(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameterIiv, glad_start, glad_redundant);
+}
+
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_real_glSamplerParameterIuiv = NULL;
+static void APIENTRY glad_instrument_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSamplerParameterIuiv(sampler, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glSamplerParameterIuiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_real_glGetSamplerParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetSamplerParameteriv(sampler, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSamplerParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_real_glGetSamplerParameterIiv = NULL;
+static void APIENTRY glad_instrument_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetSamplerParameterIiv(sampler, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSamplerParameterIiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_real_glGetSamplerParameterfv = NULL;
+static void APIENTRY glad_instrument_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetSamplerParameterfv(sampler, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSamplerParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_real_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY glad_instrument_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetSamplerParameterIuiv(sampler, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSamplerParameterIuiv, glad_start, glad_redundant);
+}
+
+static PFNGLQUERYCOUNTERPROC glad_real_glQueryCounter = NULL;
+static void APIENTRY glad_instrument_glQueryCounter(GLuint id, GLenum target) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glQueryCounter(id, target);
+    glad_instrument_record(GLAD_INSTRUMENT_glQueryCounter, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYOBJECTI64VPROC glad_real_glGetQueryObjecti64v = NULL;
+static void APIENTRY glad_instrument_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryObjecti64v(id, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryObjecti64v, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYOBJECTUI64VPROC glad_real_glGetQueryObjectui64v = NULL;
+static void APIENTRY glad_instrument_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryObjectui64v(id, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryObjectui64v, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBDIVISORPROC glad_real_glVertexAttribDivisor = NULL;
+static void APIENTRY glad_instrument_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribDivisor(index, divisor);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribDivisor, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP1UIPROC glad_real_glVertexAttribP1ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP1ui(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP1ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP1UIVPROC glad_real_glVertexAttribP1uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP1uiv(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP2UIPROC glad_real_glVertexAttribP2ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP2ui(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP2ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP2UIVPROC glad_real_glVertexAttribP2uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP2uiv(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP3UIPROC glad_real_glVertexAttribP3ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP3ui(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP3UIVPROC glad_real_glVertexAttribP3uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP3uiv(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP4UIPROC glad_real_glVertexAttribP4ui = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP4ui(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP4ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBP4UIVPROC glad_real_glVertexAttribP4uiv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribP4uiv(index, type, normalized, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribP4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP2UIPROC glad_real_glVertexP2ui = NULL;
+static void APIENTRY glad_instrument_glVertexP2ui(GLenum type, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP2ui(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP2ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP2UIVPROC glad_real_glVertexP2uiv = NULL;
+static void APIENTRY glad_instrument_glVertexP2uiv(GLenum type, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP2uiv(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP3UIPROC glad_real_glVertexP3ui = NULL;
+static void APIENTRY glad_instrument_glVertexP3ui(GLenum type, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP3ui(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP3UIVPROC glad_real_glVertexP3uiv = NULL;
+static void APIENTRY glad_instrument_glVertexP3uiv(GLenum type, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP3uiv(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP4UIPROC glad_real_glVertexP4ui = NULL;
+static void APIENTRY glad_instrument_glVertexP4ui(GLenum type, GLuint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP4ui(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP4ui, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXP4UIVPROC glad_real_glVertexP4uiv = NULL;
+static void APIENTRY glad_instrument_glVertexP4uiv(GLenum type, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexP4uiv(type, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexP4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP1UIPROC glad_real_glTexCoordP1ui = NULL;
+static void APIENTRY glad_instrument_glTexCoordP1ui(GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP1ui(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP1ui, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP1UIVPROC glad_real_glTexCoordP1uiv = NULL;
+static void APIENTRY glad_instrument_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP1uiv(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP2UIPROC glad_real_glTexCoordP2ui = NULL;
+static void APIENTRY glad_instrument_glTexCoordP2ui(GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP2ui(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP2ui, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP2UIVPROC glad_real_glTexCoordP2uiv = NULL;
+static void APIENTRY glad_instrument_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP2uiv(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP3UIPROC glad_real_glTexCoordP3ui = NULL;
+static void APIENTRY glad_instrument_glTexCoordP3ui(GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP3ui(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP3UIVPROC glad_real_glTexCoordP3uiv = NULL;
+static void APIENTRY glad_instrument_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP3uiv(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP4UIPROC glad_real_glTexCoordP4ui = NULL;
+static void APIENTRY glad_instrument_glTexCoordP4ui(GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP4ui(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP4ui, glad_start, glad_redundant);
+}
+
+static PFNGLTEXCOORDP4UIVPROC glad_real_glTexCoordP4uiv = NULL;
+static void APIENTRY glad_instrument_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexCoordP4uiv(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexCoordP4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP1UIPROC glad_real_glMultiTexCoordP1ui = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP1ui(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP1ui, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP1UIVPROC glad_real_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP1uiv(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP2UIPROC glad_real_glMultiTexCoordP2ui = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP2ui(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP2ui, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP2UIVPROC glad_real_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP2uiv(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP3UIPROC glad_real_glMultiTexCoordP3ui = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP3ui(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP3UIVPROC glad_real_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP3uiv(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP4UIPROC glad_real_glMultiTexCoordP4ui = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP4ui(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP4ui, glad_start, glad_redundant);
+}
+
+static PFNGLMULTITEXCOORDP4UIVPROC glad_real_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY glad_instrument_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiTexCoordP4uiv(texture, type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiTexCoordP4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLNORMALP3UIPROC glad_real_glNormalP3ui = NULL;
+static void APIENTRY glad_instrument_glNormalP3ui(GLenum type, GLuint coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glNormalP3ui(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glNormalP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLNORMALP3UIVPROC glad_real_glNormalP3uiv = NULL;
+static void APIENTRY glad_instrument_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glNormalP3uiv(type, coords);
+    glad_instrument_record(GLAD_INSTRUMENT_glNormalP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORP3UIPROC glad_real_glColorP3ui = NULL;
+static void APIENTRY glad_instrument_glColorP3ui(GLenum type, GLuint color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorP3ui(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORP3UIVPROC glad_real_glColorP3uiv = NULL;
+static void APIENTRY glad_instrument_glColorP3uiv(GLenum type, const GLuint *color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorP3uiv(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORP4UIPROC glad_real_glColorP4ui = NULL;
+static void APIENTRY glad_instrument_glColorP4ui(GLenum type, GLuint color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorP4ui(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorP4ui, glad_start, glad_redundant);
+}
+
+static PFNGLCOLORP4UIVPROC glad_real_glColorP4uiv = NULL;
+static void APIENTRY glad_instrument_glColorP4uiv(GLenum type, const GLuint *color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glColorP4uiv(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glColorP4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLSECONDARYCOLORP3UIPROC glad_real_glSecondaryColorP3ui = NULL;
+static void APIENTRY glad_instrument_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSecondaryColorP3ui(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glSecondaryColorP3ui, glad_start, glad_redundant);
+}
+
+static PFNGLSECONDARYCOLORP3UIVPROC glad_real_glSecondaryColorP3uiv = NULL;
+static void APIENTRY glad_instrument_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glSecondaryColorP3uiv(type, color);
+    glad_instrument_record(GLAD_INSTRUMENT_glSecondaryColorP3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLMINSAMPLESHADINGPROC glad_real_glMinSampleShading = NULL;
+static void APIENTRY glad_instrument_glMinSampleShading(GLfloat value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMinSampleShading(value);
+    glad_instrument_record(GLAD_INSTRUMENT_glMinSampleShading, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDEQUATIONIPROC glad_real_glBlendEquationi = NULL;
+static void APIENTRY glad_instrument_glBlendEquationi(GLuint buf, GLenum mode) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendEquationi(buf, mode);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendEquationi, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_real_glBlendEquationSeparatei = NULL;
+static void APIENTRY glad_instrument_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendEquationSeparatei, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDFUNCIPROC glad_real_glBlendFunci = NULL;
+static void APIENTRY glad_instrument_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendFunci(buf, src, dst);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendFunci, glad_start, glad_redundant);
+}
+
+static PFNGLBLENDFUNCSEPARATEIPROC glad_real_glBlendFuncSeparatei = NULL;
+static void APIENTRY glad_instrument_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    glad_instrument_record(GLAD_INSTRUMENT_glBlendFuncSeparatei, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWARRAYSINDIRECTPROC glad_real_glDrawArraysIndirect = NULL;
+static void APIENTRY glad_instrument_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawArraysIndirect(mode, indirect);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawArraysIndirect, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_real_glDrawElementsIndirect = NULL;
+static void APIENTRY glad_instrument_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsIndirect(mode, type, indirect);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsIndirect, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1DPROC glad_real_glUniform1d = NULL;
+static void APIENTRY glad_instrument_glUniform1d(GLint location, GLdouble x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[1] = {x}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1d, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1d(location, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1d, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2DPROC glad_real_glUniform2d = NULL;
+static void APIENTRY glad_instrument_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[2] = {x, y}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2d, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2d(location, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2d, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3DPROC glad_real_glUniform3d = NULL;
+static void APIENTRY glad_instrument_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[3] = {x, y, z}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3d, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3d(location, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3d, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4DPROC glad_real_glUniform4d = NULL;
+static void APIENTRY glad_instrument_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[4] = {x, y, z, w}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4d, glad_instrument_program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4d(location, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4d, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM1DVPROC glad_real_glUniform1dv = NULL;
+static void APIENTRY glad_instrument_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1dv, glad_instrument_program, location, value, (size_t)count * 1 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform1dv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform1dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM2DVPROC glad_real_glUniform2dv = NULL;
+static void APIENTRY glad_instrument_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2dv, glad_instrument_program, location, value, (size_t)count * 2 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform2dv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform2dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM3DVPROC glad_real_glUniform3dv = NULL;
+static void APIENTRY glad_instrument_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3dv, glad_instrument_program, location, value, (size_t)count * 3 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform3dv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform3dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORM4DVPROC glad_real_glUniform4dv = NULL;
+static void APIENTRY glad_instrument_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4dv, glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniform4dv(location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniform4dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2DVPROC glad_real_glUniformMatrix2dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 4 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3DVPROC glad_real_glUniformMatrix3dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 9 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4DVPROC glad_real_glUniformMatrix4dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 16 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_real_glUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 6 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2x3dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2x3dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_real_glUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 8 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix2x4dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix2x4dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_real_glUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 6 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3x2dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3x2dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_real_glUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 12 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix3x4dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix3x4dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_real_glUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 8 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4x2dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4x2dv, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_real_glUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_instrument_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), glad_instrument_program, location, value, (size_t)count * 12 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glUniformMatrix4x3dv(location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformMatrix4x3dv, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMDVPROC glad_real_glGetUniformdv = NULL;
+static void APIENTRY glad_instrument_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformdv(program, location, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformdv, glad_start, glad_redundant);
+}
+
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_real_glGetSubroutineUniformLocation = NULL;
+static GLint APIENTRY glad_instrument_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetSubroutineUniformLocation(program, shadertype, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSubroutineUniformLocation, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETSUBROUTINEINDEXPROC glad_real_glGetSubroutineIndex = NULL;
+static GLuint APIENTRY glad_instrument_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetSubroutineIndex(program, shadertype, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetSubroutineIndex, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_real_glGetActiveSubroutineUniformiv = NULL;
+static void APIENTRY glad_instrument_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveSubroutineUniformiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_real_glGetActiveSubroutineUniformName = NULL;
+static void APIENTRY glad_instrument_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveSubroutineUniformName, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_real_glGetActiveSubroutineName = NULL;
+static void APIENTRY glad_instrument_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveSubroutineName, glad_start, glad_redundant);
+}
+
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_real_glUniformSubroutinesuiv = NULL;
+static void APIENTRY glad_instrument_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glUniformSubroutinesuiv(shadertype, count, indices);
+    glad_instrument_record(GLAD_INSTRUMENT_glUniformSubroutinesuiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_real_glGetUniformSubroutineuiv = NULL;
+static void APIENTRY glad_instrument_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetUniformSubroutineuiv(shadertype, location, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetUniformSubroutineuiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMSTAGEIVPROC glad_real_glGetProgramStageiv = NULL;
+static void APIENTRY glad_instrument_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramStageiv(program, shadertype, pname, values);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramStageiv, glad_start, glad_redundant);
+}
+
+static PFNGLPATCHPARAMETERIPROC glad_real_glPatchParameteri = NULL;
+static void APIENTRY glad_instrument_glPatchParameteri(GLenum pname, GLint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPatchParameteri(pname, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glPatchParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLPATCHPARAMETERFVPROC glad_real_glPatchParameterfv = NULL;
+static void APIENTRY glad_instrument_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPatchParameterfv(pname, values);
+    glad_instrument_record(GLAD_INSTRUMENT_glPatchParameterfv, glad_start, glad_redundant);
+}
+
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_real_glBindTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glBindTransformFeedback(GLenum target, GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindTransformFeedback(target, id);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_real_glDeleteTransformFeedbacks = NULL;
+static void APIENTRY glad_instrument_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteTransformFeedbacks(n, ids);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteTransformFeedbacks, glad_start, glad_redundant);
+}
+
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_real_glGenTransformFeedbacks = NULL;
+static void APIENTRY glad_instrument_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenTransformFeedbacks(n, ids);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenTransformFeedbacks, glad_start, glad_redundant);
+}
+
+static PFNGLISTRANSFORMFEEDBACKPROC glad_real_glIsTransformFeedback = NULL;
+static GLboolean APIENTRY glad_instrument_glIsTransformFeedback(GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsTransformFeedback(id);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsTransformFeedback, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_real_glPauseTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glPauseTransformFeedback(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPauseTransformFeedback();
+    glad_instrument_record(GLAD_INSTRUMENT_glPauseTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_real_glResumeTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glResumeTransformFeedback(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glResumeTransformFeedback();
+    glad_instrument_record(GLAD_INSTRUMENT_glResumeTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_real_glDrawTransformFeedback = NULL;
+static void APIENTRY glad_instrument_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawTransformFeedback(mode, id);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawTransformFeedback, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_real_glDrawTransformFeedbackStream = NULL;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawTransformFeedbackStream(mode, id, stream);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawTransformFeedbackStream, glad_start, glad_redundant);
+}
+
+static PFNGLBEGINQUERYINDEXEDPROC glad_real_glBeginQueryIndexed = NULL;
+static void APIENTRY glad_instrument_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBeginQueryIndexed(target, index, id);
+    glad_instrument_record(GLAD_INSTRUMENT_glBeginQueryIndexed, glad_start, glad_redundant);
+}
+
+static PFNGLENDQUERYINDEXEDPROC glad_real_glEndQueryIndexed = NULL;
+static void APIENTRY glad_instrument_glEndQueryIndexed(GLenum target, GLuint index) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glEndQueryIndexed(target, index);
+    glad_instrument_record(GLAD_INSTRUMENT_glEndQueryIndexed, glad_start, glad_redundant);
+}
+
+static PFNGLGETQUERYINDEXEDIVPROC glad_real_glGetQueryIndexediv = NULL;
+static void APIENTRY glad_instrument_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetQueryIndexediv(target, index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetQueryIndexediv, glad_start, glad_redundant);
+}
+
+static PFNGLRELEASESHADERCOMPILERPROC glad_real_glReleaseShaderCompiler = NULL;
+static void APIENTRY glad_instrument_glReleaseShaderCompiler(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glReleaseShaderCompiler();
+    glad_instrument_record(GLAD_INSTRUMENT_glReleaseShaderCompiler, glad_start, glad_redundant);
+}
+
+static PFNGLSHADERBINARYPROC glad_real_glShaderBinary = NULL;
+static void APIENTRY glad_instrument_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glShaderBinary(count, shaders, binaryFormat, binary, length);
+    glad_instrument_record(GLAD_INSTRUMENT_glShaderBinary, glad_start, glad_redundant);
+}
+
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_real_glGetShaderPrecisionFormat = NULL;
+static void APIENTRY glad_instrument_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetShaderPrecisionFormat, glad_start, glad_redundant);
+}
+
+static PFNGLDEPTHRANGEFPROC glad_real_glDepthRangef = NULL;
+static void APIENTRY glad_instrument_glDepthRangef(GLfloat n, GLfloat f) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthRangef(n, f);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthRangef, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARDEPTHFPROC glad_real_glClearDepthf = NULL;
+static void APIENTRY glad_instrument_glClearDepthf(GLfloat d) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearDepthf(d);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearDepthf, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMBINARYPROC glad_real_glGetProgramBinary = NULL;
+static void APIENTRY glad_instrument_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramBinary, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMBINARYPROC glad_real_glProgramBinary = NULL;
+static void APIENTRY glad_instrument_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glProgramBinary(program, binaryFormat, binary, length);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramBinary, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMPARAMETERIPROC glad_real_glProgramParameteri = NULL;
+static void APIENTRY glad_instrument_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glProgramParameteri(program, pname, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLUSEPROGRAMSTAGESPROC glad_real_glUseProgramStages = NULL;
+static void APIENTRY glad_instrument_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glUseProgramStages(pipeline, stages, program);
+    glad_instrument_record(GLAD_INSTRUMENT_glUseProgramStages, glad_start, glad_redundant);
+}
+
+static PFNGLACTIVESHADERPROGRAMPROC glad_real_glActiveShaderProgram = NULL;
+static void APIENTRY glad_instrument_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glActiveShaderProgram(pipeline, program);
+    glad_instrument_record(GLAD_INSTRUMENT_glActiveShaderProgram, glad_start, glad_redundant);
+}
+
+static PFNGLCREATESHADERPROGRAMVPROC glad_real_glCreateShaderProgramv = NULL;
+static GLuint APIENTRY glad_instrument_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glCreateShaderProgramv(type, count, strings);
+    glad_instrument_record(GLAD_INSTRUMENT_glCreateShaderProgramv, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLBINDPROGRAMPIPELINEPROC glad_real_glBindProgramPipeline = NULL;
+static void APIENTRY glad_instrument_glBindProgramPipeline(GLuint pipeline) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindProgramPipeline(pipeline);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindProgramPipeline, glad_start, glad_redundant);
+}
+
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_real_glDeleteProgramPipelines = NULL;
+static void APIENTRY glad_instrument_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDeleteProgramPipelines(n, pipelines);
+    glad_instrument_record(GLAD_INSTRUMENT_glDeleteProgramPipelines, glad_start, glad_redundant);
+}
+
+static PFNGLGENPROGRAMPIPELINESPROC glad_real_glGenProgramPipelines = NULL;
+static void APIENTRY glad_instrument_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGenProgramPipelines(n, pipelines);
+    glad_instrument_record(GLAD_INSTRUMENT_glGenProgramPipelines, glad_start, glad_redundant);
+}
+
+static PFNGLISPROGRAMPIPELINEPROC glad_real_glIsProgramPipeline = NULL;
+static GLboolean APIENTRY glad_instrument_glIsProgramPipeline(GLuint pipeline) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLboolean glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glIsProgramPipeline(pipeline);
+    glad_instrument_record(GLAD_INSTRUMENT_glIsProgramPipeline, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_real_glGetProgramPipelineiv = NULL;
+static void APIENTRY glad_instrument_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramPipelineiv(pipeline, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramPipelineiv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1IPROC glad_real_glProgramUniform1i = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1i, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1i(program, location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1i, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1IVPROC glad_real_glProgramUniform1iv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1iv, program, location, value, (size_t)count * 1 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1iv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1iv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1FPROC glad_real_glProgramUniform1f = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1f, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1f(program, location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1f, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1FVPROC glad_real_glProgramUniform1fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1fv, program, location, value, (size_t)count * 1 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1fv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1DPROC glad_real_glProgramUniform1d = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1d, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1d(program, location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1d, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1DVPROC glad_real_glProgramUniform1dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1dv, program, location, value, (size_t)count * 1 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1dv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1UIPROC glad_real_glProgramUniform1ui = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[1] = {v0}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1ui, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1ui(program, location, v0);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1ui, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_real_glProgramUniform1uiv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform1uiv, program, location, value, (size_t)count * 1 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform1uiv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform1uiv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2IPROC glad_real_glProgramUniform2i = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2i, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2i(program, location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2i, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2IVPROC glad_real_glProgramUniform2iv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2iv, program, location, value, (size_t)count * 2 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2iv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2iv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2FPROC glad_real_glProgramUniform2f = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2f, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2f(program, location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2f, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2FVPROC glad_real_glProgramUniform2fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2fv, program, location, value, (size_t)count * 2 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2fv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2DPROC glad_real_glProgramUniform2d = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2d, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2d(program, location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2d, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2DVPROC glad_real_glProgramUniform2dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2dv, program, location, value, (size_t)count * 2 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2dv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2UIPROC glad_real_glProgramUniform2ui = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[2] = {v0, v1}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2ui, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2ui(program, location, v0, v1);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2ui, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_real_glProgramUniform2uiv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform2uiv, program, location, value, (size_t)count * 2 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform2uiv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform2uiv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3IPROC glad_real_glProgramUniform3i = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3i, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3i(program, location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3i, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3IVPROC glad_real_glProgramUniform3iv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3iv, program, location, value, (size_t)count * 3 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3iv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3iv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3FPROC glad_real_glProgramUniform3f = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3f, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3f(program, location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3f, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3FVPROC glad_real_glProgramUniform3fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3fv, program, location, value, (size_t)count * 3 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3fv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3DPROC glad_real_glProgramUniform3d = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3d, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3d(program, location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3d, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3DVPROC glad_real_glProgramUniform3dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3dv, program, location, value, (size_t)count * 3 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3dv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3UIPROC glad_real_glProgramUniform3ui = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[3] = {v0, v1, v2}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3ui, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3ui(program, location, v0, v1, v2);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3ui, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_real_glProgramUniform3uiv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform3uiv, program, location, value, (size_t)count * 3 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform3uiv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform3uiv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4IPROC glad_real_glProgramUniform4i = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLint v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4i, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4i(program, location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4i, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4IVPROC glad_real_glProgramUniform4iv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4iv, program, location, value, (size_t)count * 4 * sizeof(GLint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4iv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4iv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4FPROC glad_real_glProgramUniform4f = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLfloat v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4f, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4f(program, location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4f, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4FVPROC glad_real_glProgramUniform4fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4fv, program, location, value, (size_t)count * 4 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4fv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4DPROC glad_real_glProgramUniform4d = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLdouble v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4d, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4d(program, location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4d, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4DVPROC glad_real_glProgramUniform4dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4dv, program, location, value, (size_t)count * 4 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4dv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4UIPROC glad_real_glProgramUniform4ui = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    { GLuint v[4] = {v0, v1, v2, v3}; glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4ui, program, location, v, sizeof(v)); }
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4ui, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_real_glProgramUniform4uiv = NULL;
+static void APIENTRY glad_instrument_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniform4uiv, program, location, value, (size_t)count * 4 * sizeof(GLuint));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniform4uiv(program, location, count, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniform4uiv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_real_glProgramUniformMatrix2fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 4 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_real_glProgramUniformMatrix3fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 9 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_real_glProgramUniformMatrix4fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 16 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_real_glProgramUniformMatrix2dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 4 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_real_glProgramUniformMatrix3dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 9 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_real_glProgramUniformMatrix4dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 16 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_real_glProgramUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 6 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2x3fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_real_glProgramUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 6 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3x2fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_real_glProgramUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 8 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2x4fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_real_glProgramUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x2fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 8 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4x2fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_real_glProgramUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x4fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 12 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3x4fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_real_glProgramUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x3fv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 12 * sizeof(GLfloat));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4x3fv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_real_glProgramUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 6 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2x3dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_real_glProgramUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 6 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3x2dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_real_glProgramUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix2x4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 8 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix2x4dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_real_glProgramUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x2dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 8 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4x2dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_real_glProgramUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix3x4dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 12 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix3x4dv, glad_start, glad_redundant);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_real_glProgramUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_redundant = glad_instrument_uniform(GLAD_INSTRUMENT_glUniformMatrix4x3dv + (transpose ? GLAD_INSTRUMENT_COUNT : 0), program, location, value, (size_t)count * 12 * sizeof(GLdouble));
+    glad_start = glad_instrument_now();
+    glad_real_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+    glad_instrument_record(GLAD_INSTRUMENT_glProgramUniformMatrix4x3dv, glad_start, glad_redundant);
+}
+
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_real_glValidateProgramPipeline = NULL;
+static void APIENTRY glad_instrument_glValidateProgramPipeline(GLuint pipeline) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glValidateProgramPipeline(pipeline);
+    glad_instrument_record(GLAD_INSTRUMENT_glValidateProgramPipeline, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_real_glGetProgramPipelineInfoLog = NULL;
+static void APIENTRY glad_instrument_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramPipelineInfoLog, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL1DPROC glad_real_glVertexAttribL1d = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL1d(GLuint index, GLdouble x) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL1d(index, x);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL1d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL2DPROC glad_real_glVertexAttribL2d = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL2d(index, x, y);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL2d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL3DPROC glad_real_glVertexAttribL3d = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL3d(index, x, y, z);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL3d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL4DPROC glad_real_glVertexAttribL4d = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL4d(index, x, y, z, w);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL4d, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL1DVPROC glad_real_glVertexAttribL1dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL1dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL1dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL2DVPROC glad_real_glVertexAttribL2dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL2dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL2dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL3DVPROC glad_real_glVertexAttribL3dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL3dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL3dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBL4DVPROC glad_real_glVertexAttribL4dv = NULL;
+static void APIENTRY glad_instrument_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribL4dv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribL4dv, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_real_glVertexAttribLPointer = NULL;
+static void APIENTRY glad_instrument_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribLPointer(index, size, type, stride, pointer);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribLPointer, glad_start, glad_redundant);
+}
+
+static PFNGLGETVERTEXATTRIBLDVPROC glad_real_glGetVertexAttribLdv = NULL;
+static void APIENTRY glad_instrument_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetVertexAttribLdv(index, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetVertexAttribLdv, glad_start, glad_redundant);
+}
+
+static PFNGLVIEWPORTARRAYVPROC glad_real_glViewportArrayv = NULL;
+static void APIENTRY glad_instrument_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glViewportArrayv(first, count, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glViewportArrayv, glad_start, glad_redundant);
+}
+
+static PFNGLVIEWPORTINDEXEDFPROC glad_real_glViewportIndexedf = NULL;
+static void APIENTRY glad_instrument_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glViewportIndexedf(index, x, y, w, h);
+    glad_instrument_record(GLAD_INSTRUMENT_glViewportIndexedf, glad_start, glad_redundant);
+}
+
+static PFNGLVIEWPORTINDEXEDFVPROC glad_real_glViewportIndexedfv = NULL;
+static void APIENTRY glad_instrument_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glViewportIndexedfv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glViewportIndexedfv, glad_start, glad_redundant);
+}
+
+static PFNGLSCISSORARRAYVPROC glad_real_glScissorArrayv = NULL;
+static void APIENTRY glad_instrument_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glScissorArrayv(first, count, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glScissorArrayv, glad_start, glad_redundant);
+}
+
+static PFNGLSCISSORINDEXEDPROC glad_real_glScissorIndexed = NULL;
+static void APIENTRY glad_instrument_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glScissorIndexed(index, left, bottom, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glScissorIndexed, glad_start, glad_redundant);
+}
+
+static PFNGLSCISSORINDEXEDVPROC glad_real_glScissorIndexedv = NULL;
+static void APIENTRY glad_instrument_glScissorIndexedv(GLuint index, const GLint *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glScissorIndexedv(index, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glScissorIndexedv, glad_start, glad_redundant);
+}
+
+static PFNGLDEPTHRANGEARRAYVPROC glad_real_glDepthRangeArrayv = NULL;
+static void APIENTRY glad_instrument_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthRangeArrayv(first, count, v);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthRangeArrayv, glad_start, glad_redundant);
+}
+
+static PFNGLDEPTHRANGEINDEXEDPROC glad_real_glDepthRangeIndexed = NULL;
+static void APIENTRY glad_instrument_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDepthRangeIndexed(index, n, f);
+    glad_instrument_record(GLAD_INSTRUMENT_glDepthRangeIndexed, glad_start, glad_redundant);
+}
+
+static PFNGLGETFLOATI_VPROC glad_real_glGetFloati_v = NULL;
+static void APIENTRY glad_instrument_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetFloati_v(target, index, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFloati_v, glad_start, glad_redundant);
+}
+
+static PFNGLGETDOUBLEI_VPROC glad_real_glGetDoublei_v = NULL;
+static void APIENTRY glad_instrument_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetDoublei_v(target, index, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetDoublei_v, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_real_glDrawArraysInstancedBaseInstance = NULL;
+static void APIENTRY glad_instrument_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawArraysInstancedBaseInstance, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_real_glDrawElementsInstancedBaseInstance = NULL;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsInstancedBaseInstance, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_real_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawElementsInstancedBaseVertexBaseInstance, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTERNALFORMATIVPROC glad_real_glGetInternalformativ = NULL;
+static void APIENTRY glad_instrument_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetInternalformativ(target, internalformat, pname, count, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetInternalformativ, glad_start, glad_redundant);
+}
+
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_real_glGetActiveAtomicCounterBufferiv = NULL;
+static void APIENTRY glad_instrument_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetActiveAtomicCounterBufferiv, glad_start, glad_redundant);
+}
+
+static PFNGLBINDIMAGETEXTUREPROC glad_real_glBindImageTexture = NULL;
+static void APIENTRY glad_instrument_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindImageTexture, glad_start, glad_redundant);
+}
+
+static PFNGLMEMORYBARRIERPROC glad_real_glMemoryBarrier = NULL;
+static void APIENTRY glad_instrument_glMemoryBarrier(GLbitfield barriers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMemoryBarrier(barriers);
+    glad_instrument_record(GLAD_INSTRUMENT_glMemoryBarrier, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSTORAGE1DPROC glad_real_glTexStorage1D = NULL;
+static void APIENTRY glad_instrument_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexStorage1D(target, levels, internalformat, width);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexStorage1D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSTORAGE2DPROC glad_real_glTexStorage2D = NULL;
+static void APIENTRY glad_instrument_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexStorage2D(target, levels, internalformat, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexStorage2D, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSTORAGE3DPROC glad_real_glTexStorage3D = NULL;
+static void APIENTRY glad_instrument_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexStorage3D(target, levels, internalformat, width, height, depth);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexStorage3D, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_real_glDrawTransformFeedbackInstanced = NULL;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawTransformFeedbackInstanced, glad_start, glad_redundant);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_real_glDrawTransformFeedbackStreamInstanced = NULL;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+    glad_instrument_record(GLAD_INSTRUMENT_glDrawTransformFeedbackStreamInstanced, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERDATAPROC glad_real_glClearBufferData = NULL;
+static void APIENTRY glad_instrument_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferData(target, internalformat, format, type, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferData, glad_start, glad_redundant);
+}
+
+static PFNGLCLEARBUFFERSUBDATAPROC glad_real_glClearBufferSubData = NULL;
+static void APIENTRY glad_instrument_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+    glad_instrument_record(GLAD_INSTRUMENT_glClearBufferSubData, glad_start, glad_redundant);
+}
+
+static PFNGLDISPATCHCOMPUTEPROC glad_real_glDispatchCompute = NULL;
+static void APIENTRY glad_instrument_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+    glad_instrument_record(GLAD_INSTRUMENT_glDispatchCompute, glad_start, glad_redundant);
+}
+
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_real_glDispatchComputeIndirect = NULL;
+static void APIENTRY glad_instrument_glDispatchComputeIndirect(GLintptr indirect) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDispatchComputeIndirect(indirect);
+    glad_instrument_record(GLAD_INSTRUMENT_glDispatchComputeIndirect, glad_start, glad_redundant);
+}
+
+static PFNGLCOPYIMAGESUBDATAPROC glad_real_glCopyImageSubData = NULL;
+static void APIENTRY glad_instrument_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    glad_instrument_record(GLAD_INSTRUMENT_glCopyImageSubData, glad_start, glad_redundant);
+}
+
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_real_glFramebufferParameteri = NULL;
+static void APIENTRY glad_instrument_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glFramebufferParameteri(target, pname, param);
+    glad_instrument_record(GLAD_INSTRUMENT_glFramebufferParameteri, glad_start, glad_redundant);
+}
+
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_real_glGetFramebufferParameteriv = NULL;
+static void APIENTRY glad_instrument_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetFramebufferParameteriv(target, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetFramebufferParameteriv, glad_start, glad_redundant);
+}
+
+static PFNGLGETINTERNALFORMATI64VPROC glad_real_glGetInternalformati64v = NULL;
+static void APIENTRY glad_instrument_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetInternalformati64v(target, internalformat, pname, count, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetInternalformati64v, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_real_glInvalidateTexSubImage = NULL;
+static void APIENTRY glad_instrument_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateTexSubImage, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATETEXIMAGEPROC glad_real_glInvalidateTexImage = NULL;
+static void APIENTRY glad_instrument_glInvalidateTexImage(GLuint texture, GLint level) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateTexImage(texture, level);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateTexImage, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_real_glInvalidateBufferSubData = NULL;
+static void APIENTRY glad_instrument_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateBufferSubData(buffer, offset, length);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateBufferSubData, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATEBUFFERDATAPROC glad_real_glInvalidateBufferData = NULL;
+static void APIENTRY glad_instrument_glInvalidateBufferData(GLuint buffer) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateBufferData(buffer);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateBufferData, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_real_glInvalidateFramebuffer = NULL;
+static void APIENTRY glad_instrument_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateFramebuffer(target, numAttachments, attachments);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateFramebuffer, glad_start, glad_redundant);
+}
+
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_real_glInvalidateSubFramebuffer = NULL;
+static void APIENTRY glad_instrument_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    glad_instrument_record(GLAD_INSTRUMENT_glInvalidateSubFramebuffer, glad_start, glad_redundant);
+}
+
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_real_glMultiDrawArraysIndirect = NULL;
+static void APIENTRY glad_instrument_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiDrawArraysIndirect, glad_start, glad_redundant);
+}
+
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_real_glMultiDrawElementsIndirect = NULL;
+static void APIENTRY glad_instrument_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    glad_instrument_record(GLAD_INSTRUMENT_glMultiDrawElementsIndirect, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_real_glGetProgramInterfaceiv = NULL;
+static void APIENTRY glad_instrument_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramInterfaceiv(program, programInterface, pname, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramInterfaceiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_real_glGetProgramResourceIndex = NULL;
+static GLuint APIENTRY glad_instrument_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetProgramResourceIndex(program, programInterface, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramResourceIndex, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_real_glGetProgramResourceName = NULL;
+static void APIENTRY glad_instrument_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramResourceName, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_real_glGetProgramResourceiv = NULL;
+static void APIENTRY glad_instrument_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramResourceiv, glad_start, glad_redundant);
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_real_glGetProgramResourceLocation = NULL;
+static GLint APIENTRY glad_instrument_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetProgramResourceLocation(program, programInterface, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramResourceLocation, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_real_glGetProgramResourceLocationIndex = NULL;
+static GLint APIENTRY glad_instrument_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetProgramResourceLocationIndex(program, programInterface, name);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetProgramResourceLocationIndex, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_real_glShaderStorageBlockBinding = NULL;
+static void APIENTRY glad_instrument_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+    glad_instrument_record(GLAD_INSTRUMENT_glShaderStorageBlockBinding, glad_start, glad_redundant);
+}
+
+static PFNGLTEXBUFFERRANGEPROC glad_real_glTexBufferRange = NULL;
+static void APIENTRY glad_instrument_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexBufferRange(target, internalformat, buffer, offset, size);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexBufferRange, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_real_glTexStorage2DMultisample = NULL;
+static void APIENTRY glad_instrument_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexStorage2DMultisample, glad_start, glad_redundant);
+}
+
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_real_glTexStorage3DMultisample = NULL;
+static void APIENTRY glad_instrument_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_instrument_record(GLAD_INSTRUMENT_glTexStorage3DMultisample, glad_start, glad_redundant);
+}
+
+static PFNGLTEXTUREVIEWPROC glad_real_glTextureView = NULL;
+static void APIENTRY glad_instrument_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    glad_instrument_record(GLAD_INSTRUMENT_glTextureView, glad_start, glad_redundant);
+}
+
+static PFNGLBINDVERTEXBUFFERPROC glad_real_glBindVertexBuffer = NULL;
+static void APIENTRY glad_instrument_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+    glad_instrument_record(GLAD_INSTRUMENT_glBindVertexBuffer, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBFORMATPROC glad_real_glVertexAttribFormat = NULL;
+static void APIENTRY glad_instrument_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribFormat, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBIFORMATPROC glad_real_glVertexAttribIFormat = NULL;
+static void APIENTRY glad_instrument_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribIFormat, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBLFORMATPROC glad_real_glVertexAttribLFormat = NULL;
+static void APIENTRY glad_instrument_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribLFormat, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXATTRIBBINDINGPROC glad_real_glVertexAttribBinding = NULL;
+static void APIENTRY glad_instrument_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexAttribBinding(attribindex, bindingindex);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexAttribBinding, glad_start, glad_redundant);
+}
+
+static PFNGLVERTEXBINDINGDIVISORPROC glad_real_glVertexBindingDivisor = NULL;
+static void APIENTRY glad_instrument_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glVertexBindingDivisor(bindingindex, divisor);
+    glad_instrument_record(GLAD_INSTRUMENT_glVertexBindingDivisor, glad_start, glad_redundant);
+}
+
+static PFNGLDEBUGMESSAGECONTROLPROC glad_real_glDebugMessageControl = NULL;
+static void APIENTRY glad_instrument_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+    glad_instrument_record(GLAD_INSTRUMENT_glDebugMessageControl, glad_start, glad_redundant);
+}
+
+static PFNGLDEBUGMESSAGEINSERTPROC glad_real_glDebugMessageInsert = NULL;
+static void APIENTRY glad_instrument_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDebugMessageInsert(source, type, id, severity, length, buf);
+    glad_instrument_record(GLAD_INSTRUMENT_glDebugMessageInsert, glad_start, glad_redundant);
+}
+
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_real_glDebugMessageCallback = NULL;
+static void APIENTRY glad_instrument_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glDebugMessageCallback(callback, userParam);
+    glad_instrument_record(GLAD_INSTRUMENT_glDebugMessageCallback, glad_start, glad_redundant);
+}
+
+static PFNGLGETDEBUGMESSAGELOGPROC glad_real_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY glad_instrument_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    GLuint glad_result;
+    glad_start = glad_instrument_now();
+    glad_result = glad_real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetDebugMessageLog, glad_start, glad_redundant);
+    return glad_result;
+}
+
+static PFNGLPUSHDEBUGGROUPPROC glad_real_glPushDebugGroup = NULL;
+static void APIENTRY glad_instrument_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPushDebugGroup(source, id, length, message);
+    glad_instrument_record(GLAD_INSTRUMENT_glPushDebugGroup, glad_start, glad_redundant);
+}
+
+static PFNGLPOPDEBUGGROUPPROC glad_real_glPopDebugGroup = NULL;
+static void APIENTRY glad_instrument_glPopDebugGroup(void) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glPopDebugGroup();
+    glad_instrument_record(GLAD_INSTRUMENT_glPopDebugGroup, glad_start, glad_redundant);
+}
+
+static PFNGLOBJECTLABELPROC glad_real_glObjectLabel = NULL;
+static void APIENTRY glad_instrument_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glObjectLabel(identifier, name, length, label);
+    glad_instrument_record(GLAD_INSTRUMENT_glObjectLabel, glad_start, glad_redundant);
+}
+
+static PFNGLGETOBJECTLABELPROC glad_real_glGetObjectLabel = NULL;
+static void APIENTRY glad_instrument_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetObjectLabel(identifier, name, bufSize, length, label);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetObjectLabel, glad_start, glad_redundant);
+}
+
+static PFNGLOBJECTPTRLABELPROC glad_real_glObjectPtrLabel = NULL;
+static void APIENTRY glad_instrument_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glObjectPtrLabel(ptr, length, label);
+    glad_instrument_record(GLAD_INSTRUMENT_glObjectPtrLabel, glad_start, glad_redundant);
+}
+
+static PFNGLGETOBJECTPTRLABELPROC glad_real_glGetObjectPtrLabel = NULL;
+static void APIENTRY glad_instrument_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+    glad_instrument_record(GLAD_INSTRUMENT_glGetObjectPtrLabel, glad_start, glad_redundant);
+}
+
+static PFNGLBUFFERSTORAGEPROC glad_real_glBufferStorage = NULL;
+static void APIENTRY glad_instrument_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    int glad_redundant = 0;
+    unsigned long long glad_start;
+    glad_start = glad_instrument_now();
+    glad_real_glBufferStorage(target, size, data, flags);
+    glad_instrument_record(GLAD_INSTRUMENT_glBufferStorage, glad_start, glad_redundant);
+}
+
+static void glad_instrument_wrap_all(void) {
+    if(glad_glCullFace != NULL && glad_glCullFace != glad_instrument_glCullFace) {
+        glad_real_glCullFace = glad_glCullFace;
+        glad_glCullFace = glad_instrument_glCullFace;
+    }
+    if(glad_glFrontFace != NULL && glad_glFrontFace != glad_instrument_glFrontFace) {
+        glad_real_glFrontFace = glad_glFrontFace;
+        glad_glFrontFace = glad_instrument_glFrontFace;
+    }
+    if(glad_glHint != NULL && glad_glHint != glad_instrument_glHint) {
+        glad_real_glHint = glad_glHint;
+        glad_glHint = glad_instrument_glHint;
+    }
+    if(glad_glLineWidth != NULL && glad_glLineWidth != glad_instrument_glLineWidth) {
+        glad_real_glLineWidth = glad_glLineWidth;
+        glad_glLineWidth = glad_instrument_glLineWidth;
+    }
+    if(glad_glPointSize != NULL && glad_glPointSize != glad_instrument_glPointSize) {
+        glad_real_glPointSize = glad_glPointSize;
+        glad_glPointSize = glad_instrument_glPointSize;
+    }
+    if(glad_glPolygonMode != NULL && glad_glPolygonMode != glad_instrument_glPolygonMode) {
+        glad_real_glPolygonMode = glad_glPolygonMode;
+        glad_glPolygonMode = glad_instrument_glPolygonMode;
+    }
+    if(glad_glScissor != NULL && glad_glScissor != glad_instrument_glScissor) {
+        glad_real_glScissor = glad_glScissor;
+        glad_glScissor = glad_instrument_glScissor;
+    }
+    if(glad_glTexParameterf != NULL && glad_glTexParameterf != glad_instrument_glTexParameterf) {
+        glad_real_glTexParameterf = glad_glTexParameterf;
+        glad_glTexParameterf = glad_instrument_glTexParameterf;
+    }
+    if(glad_glTexParameterfv != NULL && glad_glTexParameterfv != glad_instrument_glTexParameterfv) {
+        glad_real_glTexParameterfv = glad_glTexParameterfv;
+        glad_glTexParameterfv = glad_instrument_glTexParameterfv;
+    }
+    if(glad_glTexParameteri != NULL && glad_glTexParameteri != glad_instrument_glTexParameteri) {
+        glad_real_glTexParameteri = glad_glTexParameteri;
+        glad_glTexParameteri = glad_instrument_glTexParameteri;
+    }
+    if(glad_glTexParameteriv != NULL && glad_glTexParameteriv != glad_instrument_glTexParameteriv) {
+        glad_real_glTexParameteriv = glad_glTexParameteriv;
+        glad_glTexParameteriv = glad_instrument_glTexParameteriv;
+    }
+    if(glad_glTexImage1D != NULL && glad_glTexImage1D != glad_instrument_glTexImage1D) {
+        glad_real_glTexImage1D = glad_glTexImage1D;
+        glad_glTexImage1D = glad_instrument_glTexImage1D;
+    }
+    if(glad_glTexImage2D != NULL && glad_glTexImage2D != glad_instrument_glTexImage2D) {
+        glad_real_glTexImage2D = glad_glTexImage2D;
+        glad_glTexImage2D = glad_instrument_glTexImage2D;
+    }
+    if(glad_glDrawBuffer != NULL && glad_glDrawBuffer != glad_instrument_glDrawBuffer) {
+        glad_real_glDrawBuffer = glad_glDrawBuffer;
+        glad_glDrawBuffer = glad_instrument_glDrawBuffer;
+    }
+    if(glad_glClear != NULL && glad_glClear != glad_instrument_glClear) {
+        glad_real_glClear = glad_glClear;
+        glad_glClear = glad_instrument_glClear;
+    }
+    if(glad_glClearColor != NULL && glad_glClearColor != glad_instrument_glClearColor) {
+        glad_real_glClearColor = glad_glClearColor;
+        glad_glClearColor = glad_instrument_glClearColor;
+    }
+    if(glad_glClearStencil != NULL && glad_glClearStencil != glad_instrument_glClearStencil) {
+        glad_real_glClearStencil = glad_glClearStencil;
+        glad_glClearStencil = glad_instrument_glClearStencil;
+    }
+    if(glad_glClearDepth != NULL && glad_glClearDepth != glad_instrument_glClearDepth) {
+        glad_real_glClearDepth = glad_glClearDepth;
+        glad_glClearDepth = glad_instrument_glClearDepth;
+    }
+    if(glad_glStencilMask != NULL && glad_glStencilMask != glad_instrument_glStencilMask) {
+        glad_real_glStencilMask = glad_glStencilMask;
+        glad_glStencilMask = glad_instrument_glStencilMask;
+    }
+    if(glad_glColorMask != NULL && glad_glColorMask != glad_instrument_glColorMask) {
+        glad_real_glColorMask = glad_glColorMask;
+        glad_glColorMask = glad_instrument_glColorMask;
+    }
+    if(glad_glDepthMask != NULL && glad_glDepthMask != glad_instrument_glDepthMask) {
+        glad_real_glDepthMask = glad_glDepthMask;
+        glad_glDepthMask = glad_instrument_glDepthMask;
+    }
+    if(glad_glDisable != NULL && glad_glDisable != glad_instrument_glDisable) {
+        glad_real_glDisable = glad_glDisable;
+        glad_glDisable = glad_instrument_glDisable;
+    }
+    if(glad_glEnable != NULL && glad_glEnable != glad_instrument_glEnable) {
+        glad_real_glEnable = glad_glEnable;
+        glad_glEnable = glad_instrument_glEnable;
+    }
+    if(glad_glFinish != NULL && glad_glFinish != glad_instrument_glFinish) {
+        glad_real_glFinish = glad_glFinish;
+        glad_glFinish = glad_instrument_glFinish;
+    }
+    if(glad_glFlush != NULL && glad_glFlush != glad_instrument_glFlush) {
+        glad_real_glFlush = glad_glFlush;
+        glad_glFlush = glad_instrument_glFlush;
+    }
+    if(glad_glBlendFunc != NULL && glad_glBlendFunc != glad_instrument_glBlendFunc) {
+        glad_real_glBlendFunc = glad_glBlendFunc;
+        glad_glBlendFunc = glad_instrument_glBlendFunc;
+    }
+    if(glad_glLogicOp != NULL && glad_glLogicOp != glad_instrument_glLogicOp) {
+        glad_real_glLogicOp = glad_glLogicOp;
+        glad_glLogicOp = glad_instrument_glLogicOp;
+    }
+    if(glad_glStencilFunc != NULL && glad_glStencilFunc != glad_instrument_glStencilFunc) {
+        glad_real_glStencilFunc = glad_glStencilFunc;
+        glad_glStencilFunc = glad_instrument_glStencilFunc;
+    }
+    if(glad_glStencilOp != NULL && glad_glStencilOp != glad_instrument_glStencilOp) {
+        glad_real_glStencilOp = glad_glStencilOp;
+        glad_glStencilOp = glad_instrument_glStencilOp;
+    }
+    if(glad_glDepthFunc != NULL && glad_glDepthFunc != glad_instrument_glDepthFunc) {
+        glad_real_glDepthFunc = glad_glDepthFunc;
+        glad_glDepthFunc = glad_instrument_glDepthFunc;
+    }
+    if(glad_glPixelStoref != NULL && glad_glPixelStoref != glad_instrument_glPixelStoref) {
+        glad_real_glPixelStoref = glad_glPixelStoref;
+        glad_glPixelStoref = glad_instrument_glPixelStoref;
+    }
+    if(glad_glPixelStorei != NULL && glad_glPixelStorei != glad_instrument_glPixelStorei) {
+        glad_real_glPixelStorei = glad_glPixelStorei;
+        glad_glPixelStorei = glad_instrument_glPixelStorei;
+    }
+    if(glad_glReadBuffer != NULL && glad_glReadBuffer != glad_instrument_glReadBuffer) {
+        glad_real_glReadBuffer = glad_glReadBuffer;
+        glad_glReadBuffer = glad_instrument_glReadBuffer;
+    }
+    if(glad_glReadPixels != NULL && glad_glReadPixels != glad_instrument_glReadPixels) {
+        glad_real_glReadPixels = glad_glReadPixels;
+        glad_glReadPixels = glad_instrument_glReadPixels;
+    }
+    if(glad_glGetBooleanv != NULL && glad_glGetBooleanv != glad_instrument_glGetBooleanv) {
+        glad_real_glGetBooleanv = glad_glGetBooleanv;
+        glad_glGetBooleanv = glad_instrument_glGetBooleanv;
+    }
+    if(glad_glGetDoublev != NULL && glad_glGetDoublev != glad_instrument_glGetDoublev) {
+        glad_real_glGetDoublev = glad_glGetDoublev;
+        glad_glGetDoublev = glad_instrument_glGetDoublev;
+    }
+    if(glad_glGetError != NULL && glad_glGetError != glad_instrument_glGetError) {
+        glad_real_glGetError = glad_glGetError;
+        glad_glGetError = glad_instrument_glGetError;
+    }
+    if(glad_glGetFloatv != NULL && glad_glGetFloatv != glad_instrument_glGetFloatv) {
+        glad_real_glGetFloatv = glad_glGetFloatv;
+        glad_glGetFloatv = glad_instrument_glGetFloatv;
+    }
+    if(glad_glGetIntegerv != NULL && glad_glGetIntegerv != glad_instrument_glGetIntegerv) {
+        glad_real_glGetIntegerv = glad_glGetIntegerv;
+        glad_glGetIntegerv = glad_instrument_glGetIntegerv;
+    }
+    if(glad_glGetString != NULL && glad_glGetString != glad_instrument_glGetString) {
+        glad_real_glGetString = glad_glGetString;
+        glad_glGetString = glad_instrument_glGetString;
+    }
+    if(glad_glGetTexImage != NULL && glad_glGetTexImage != glad_instrument_glGetTexImage) {
+        glad_real_glGetTexImage = glad_glGetTexImage;
+        glad_glGetTexImage = glad_instrument_glGetTexImage;
+    }
+    if(glad_glGetTexParameterfv != NULL && glad_glGetTexParameterfv != glad_instrument_glGetTexParameterfv) {
+        glad_real_glGetTexParameterfv = glad_glGetTexParameterfv;
+        glad_glGetTexParameterfv = glad_instrument_glGetTexParameterfv;
+    }
+    if(glad_glGetTexParameteriv != NULL && glad_glGetTexParameteriv != glad_instrument_glGetTexParameteriv) {
+        glad_real_glGetTexParameteriv = glad_glGetTexParameteriv;
+        glad_glGetTexParameteriv = glad_instrument_glGetTexParameteriv;
+    }
+    if(glad_glGetTexLevelParameterfv != NULL && glad_glGetTexLevelParameterfv != glad_instrument_glGetTexLevelParameterfv) {
+        glad_real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+        glad_glGetTexLevelParameterfv = glad_instrument_glGetTexLevelParameterfv;
+    }
+    if(glad_glGetTexLevelParameteriv != NULL && glad_glGetTexLevelParameteriv != glad_instrument_glGetTexLevelParameteriv) {
+        glad_real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+        glad_glGetTexLevelParameteriv = glad_instrument_glGetTexLevelParameteriv;
+    }
+    if(glad_glIsEnabled != NULL && glad_glIsEnabled != glad_instrument_glIsEnabled) {
+        glad_real_glIsEnabled = glad_glIsEnabled;
+        glad_glIsEnabled = glad_instrument_glIsEnabled;
+    }
+    if(glad_glDepthRange != NULL && glad_glDepthRange != glad_instrument_glDepthRange) {
+        glad_real_glDepthRange = glad_glDepthRange;
+        glad_glDepthRange = glad_instrument_glDepthRange;
+    }
+    if(glad_glViewport != NULL && glad_glViewport != glad_instrument_glViewport) {
+        glad_real_glViewport = glad_glViewport;
+        glad_glViewport = glad_instrument_glViewport;
+    }
+    if(glad_glDrawArrays != NULL && glad_glDrawArrays != glad_instrument_glDrawArrays) {
+        glad_real_glDrawArrays = glad_glDrawArrays;
+        glad_glDrawArrays = glad_instrument_glDrawArrays;
+    }
+    if(glad_glDrawElements != NULL && glad_glDrawElements != glad_instrument_glDrawElements) {
+        glad_real_glDrawElements = glad_glDrawElements;
+        glad_glDrawElements = glad_instrument_glDrawElements;
+    }
+    if(glad_glPolygonOffset != NULL && glad_glPolygonOffset != glad_instrument_glPolygonOffset) {
+        glad_real_glPolygonOffset = glad_glPolygonOffset;
+        glad_glPolygonOffset = glad_instrument_glPolygonOffset;
+    }
+    if(glad_glCopyTexImage1D != NULL && glad_glCopyTexImage1D != glad_instrument_glCopyTexImage1D) {
+        glad_real_glCopyTexImage1D = glad_glCopyTexImage1D;
+        glad_glCopyTexImage1D = glad_instrument_glCopyTexImage1D;
+    }
+    if(glad_glCopyTexImage2D != NULL && glad_glCopyTexImage2D != glad_instrument_glCopyTexImage2D) {
+        glad_real_glCopyTexImage2D = glad_glCopyTexImage2D;
+        glad_glCopyTexImage2D = glad_instrument_glCopyTexImage2D;
+    }
+    if(glad_glCopyTexSubImage1D != NULL && glad_glCopyTexSubImage1D != glad_instrument_glCopyTexSubImage1D) {
+        glad_real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+        glad_glCopyTexSubImage1D = glad_instrument_glCopyTexSubImage1D;
+    }
+    if(glad_glCopyTexSubImage2D != NULL && glad_glCopyTexSubImage2D != glad_instrument_glCopyTexSubImage2D) {
+        glad_real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+        glad_glCopyTexSubImage2D = glad_instrument_glCopyTexSubImage2D;
+    }
+    if(glad_glTexSubImage1D != NULL && glad_glTexSubImage1D != glad_instrument_glTexSubImage1D) {
+        glad_real_glTexSubImage1D = glad_glTexSubImage1D;
+        glad_glTexSubImage1D = glad_instrument_glTexSubImage1D;
+    }
+    if(glad_glTexSubImage2D != NULL && glad_glTexSubImage2D != glad_instrument_glTexSubImage2D) {
+        glad_real_glTexSubImage2D = glad_glTexSubImage2D;
+        glad_glTexSubImage2D = glad_instrument_glTexSubImage2D;
+    }
+    if(glad_glBindTexture != NULL && glad_glBindTexture != glad_instrument_glBindTexture) {
+        glad_real_glBindTexture = glad_glBindTexture;
+        glad_glBindTexture = glad_instrument_glBindTexture;
+    }
+    if(glad_glDeleteTextures != NULL && glad_glDeleteTextures != glad_instrument_glDeleteTextures) {
+        glad_real_glDeleteTextures = glad_glDeleteTextures;
+        glad_glDeleteTextures = glad_instrument_glDeleteTextures;
+    }
+    if(glad_glGenTextures != NULL && glad_glGenTextures != glad_instrument_glGenTextures) {
+        glad_real_glGenTextures = glad_glGenTextures;
+        glad_glGenTextures = glad_instrument_glGenTextures;
+    }
+    if(glad_glIsTexture != NULL && glad_glIsTexture != glad_instrument_glIsTexture) {
+        glad_real_glIsTexture = glad_glIsTexture;
+        glad_glIsTexture = glad_instrument_glIsTexture;
+    }
+    if(glad_glDrawRangeElements != NULL && glad_glDrawRangeElements != glad_instrument_glDrawRangeElements) {
+        glad_real_glDrawRangeElements = glad_glDrawRangeElements;
+        glad_glDrawRangeElements = glad_instrument_glDrawRangeElements;
+    }
+    if(glad_glTexImage3D != NULL && glad_glTexImage3D != glad_instrument_glTexImage3D) {
+        glad_real_glTexImage3D = glad_glTexImage3D;
+        glad_glTexImage3D = glad_instrument_glTexImage3D;
+    }
+    if(glad_glTexSubImage3D != NULL && glad_glTexSubImage3D != glad_instrument_glTexSubImage3D) {
+        glad_real_glTexSubImage3D = glad_glTexSubImage3D;
+        glad_glTexSubImage3D = glad_instrument_glTexSubImage3D;
+    }
+    if(glad_glCopyTexSubImage3D != NULL && glad_glCopyTexSubImage3D != glad_instrument_glCopyTexSubImage3D) {
+        glad_real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+        glad_glCopyTexSubImage3D = glad_instrument_glCopyTexSubImage3D;
+    }
+    if(glad_glActiveTexture != NULL && glad_glActiveTexture != glad_instrument_glActiveTexture) {
+        glad_real_glActiveTexture = glad_glActiveTexture;
+        glad_glActiveTexture = glad_instrument_glActiveTexture;
+    }
+    if(glad_glSampleCoverage != NULL && glad_glSampleCoverage != glad_instrument_glSampleCoverage) {
+        glad_real_glSampleCoverage = glad_glSampleCoverage;
+        glad_glSampleCoverage = glad_instrument_glSampleCoverage;
+    }
+    if(glad_glCompressedTexImage3D != NULL && glad_glCompressedTexImage3D != glad_instrument_glCompressedTexImage3D) {
+        glad_real_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+        glad_glCompressedTexImage3D = glad_instrument_glCompressedTexImage3D;
+    }
+    if(glad_glCompressedTexImage2D != NULL && glad_glCompressedTexImage2D != glad_instrument_glCompressedTexImage2D) {
+        glad_real_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+        glad_glCompressedTexImage2D = glad_instrument_glCompressedTexImage2D;
+    }
+    if(glad_glCompressedTexImage1D != NULL && glad_glCompressedTexImage1D != glad_instrument_glCompressedTexImage1D) {
+        glad_real_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+        glad_glCompressedTexImage1D = glad_instrument_glCompressedTexImage1D;
+    }
+    if(glad_glCompressedTexSubImage3D != NULL && glad_glCompressedTexSubImage3D != glad_instrument_glCompressedTexSubImage3D) {
+        glad_real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+        glad_glCompressedTexSubImage3D = glad_instrument_glCompressedTexSubImage3D;
+    }
+    if(glad_glCompressedTexSubImage2D != NULL && glad_glCompressedTexSubImage2D != glad_instrument_glCompressedTexSubImage2D) {
+        glad_real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+        glad_glCompressedTexSubImage2D = glad_instrument_glCompressedTexSubImage2D;
+    }
+    if(glad_glCompressedTexSubImage1D != NULL && glad_glCompressedTexSubImage1D != glad_instrument_glCompressedTexSubImage1D) {
+        glad_real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+        glad_glCompressedTexSubImage1D = glad_instrument_glCompressedTexSubImage1D;
+    }
+    if(glad_glGetCompressedTexImage != NULL && glad_glGetCompressedTexImage != glad_instrument_glGetCompressedTexImage) {
+        glad_real_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+        glad_glGetCompressedTexImage = glad_instrument_glGetCompressedTexImage;
+    }
+    if(glad_glBlendFuncSeparate != NULL && glad_glBlendFuncSeparate != glad_instrument_glBlendFuncSeparate) {
+        glad_real_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+        glad_glBlendFuncSeparate = glad_instrument_glBlendFuncSeparate;
+    }
+    if(glad_glMultiDrawArrays != NULL && glad_glMultiDrawArrays != glad_instrument_glMultiDrawArrays) {
+        glad_real_glMultiDrawArrays = glad_glMultiDrawArrays;
+        glad_glMultiDrawArrays = glad_instrument_glMultiDrawArrays;
+    }
+    if(glad_glMultiDrawElements != NULL && glad_glMultiDrawElements != glad_instrument_glMultiDrawElements) {
+        glad_real_glMultiDrawElements = glad_glMultiDrawElements;
+        glad_glMultiDrawElements = glad_instrument_glMultiDrawElements;
+    }
+    if(glad_glPointParameterf != NULL && glad_glPointParameterf != glad_instrument_glPointParameterf) {
+        glad_real_glPointParameterf = glad_glPointParameterf;
+        glad_glPointParameterf = glad_instrument_glPointParameterf;
+    }
+    if(glad_glPointParameterfv != NULL && glad_glPointParameterfv != glad_instrument_glPointParameterfv) {
+        glad_real_glPointParameterfv = glad_glPointParameterfv;
+        glad_glPointParameterfv = glad_instrument_glPointParameterfv;
+    }
+    if(glad_glPointParameteri != NULL && glad_glPointParameteri != glad_instrument_glPointParameteri) {
+        glad_real_glPointParameteri = glad_glPointParameteri;
+        glad_glPointParameteri = glad_instrument_glPointParameteri;
+    }
+    if(glad_glPointParameteriv != NULL && glad_glPointParameteriv != glad_instrument_glPointParameteriv) {
+        glad_real_glPointParameteriv = glad_glPointParameteriv;
+        glad_glPointParameteriv = glad_instrument_glPointParameteriv;
+    }
+    if(glad_glBlendColor != NULL && glad_glBlendColor != glad_instrument_glBlendColor) {
+        glad_real_glBlendColor = glad_glBlendColor;
+        glad_glBlendColor = glad_instrument_glBlendColor;
+    }
+    if(glad_glBlendEquation != NULL && glad_glBlendEquation != glad_instrument_glBlendEquation) {
+        glad_real_glBlendEquation = glad_glBlendEquation;
+        glad_glBlendEquation = glad_instrument_glBlendEquation;
+    }
+    if(glad_glGenQueries != NULL && glad_glGenQueries != glad_instrument_glGenQueries) {
+        glad_real_glGenQueries = glad_glGenQueries;
+        glad_glGenQueries = glad_instrument_glGenQueries;
+    }
+    if(glad_glDeleteQueries != NULL && glad_glDeleteQueries != glad_instrument_glDeleteQueries) {
+        glad_real_glDeleteQueries = glad_glDeleteQueries;
+        glad_glDeleteQueries = glad_instrument_glDeleteQueries;
+    }
+    if(glad_glIsQuery != NULL && glad_glIsQuery != glad_instrument_glIsQuery) {
+        glad_real_glIsQuery = glad_glIsQuery;
+        glad_glIsQuery = glad_instrument_glIsQuery;
+    }
+    if(glad_glBeginQuery != NULL && glad_glBeginQuery != glad_instrument_glBeginQuery) {
+        glad_real_glBeginQuery = glad_glBeginQuery;
+        glad_glBeginQuery = glad_instrument_glBeginQuery;
+    }
+    if(glad_glEndQuery != NULL && glad_glEndQuery != glad_instrument_glEndQuery) {
+        glad_real_glEndQuery = glad_glEndQuery;
+        glad_glEndQuery = glad_instrument_glEndQuery;
+    }
+    if(glad_glGetQueryiv != NULL && glad_glGetQueryiv != glad_instrument_glGetQueryiv) {
+        glad_real_glGetQueryiv = glad_glGetQueryiv;
+        glad_glGetQueryiv = glad_instrument_glGetQueryiv;
+    }
+    if(glad_glGetQueryObjectiv != NULL && glad_glGetQueryObjectiv != glad_instrument_glGetQueryObjectiv) {
+        glad_real_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+        glad_glGetQueryObjectiv = glad_instrument_glGetQueryObjectiv;
+    }
+    if(glad_glGetQueryObjectuiv != NULL && glad_glGetQueryObjectuiv != glad_instrument_glGetQueryObjectuiv) {
+        glad_real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+        glad_glGetQueryObjectuiv = glad_instrument_glGetQueryObjectuiv;
+    }
+    if(glad_glBindBuffer != NULL && glad_glBindBuffer != glad_instrument_glBindBuffer) {
+        glad_real_glBindBuffer = glad_glBindBuffer;
+        glad_glBindBuffer = glad_instrument_glBindBuffer;
+    }
+    if(glad_glDeleteBuffers != NULL && glad_glDeleteBuffers != glad_instrument_glDeleteBuffers) {
+        glad_real_glDeleteBuffers = glad_glDeleteBuffers;
+        glad_glDeleteBuffers = glad_instrument_glDeleteBuffers;
+    }
+    if(glad_glGenBuffers != NULL && glad_glGenBuffers != glad_instrument_glGenBuffers) {
+        glad_real_glGenBuffers = glad_glGenBuffers;
+        glad_glGenBuffers = glad_instrument_glGenBuffers;
+    }
+    if(glad_glIsBuffer != NULL && glad_glIsBuffer != glad_instrument_glIsBuffer) {
+        glad_real_glIsBuffer = glad_glIsBuffer;
+        glad_glIsBuffer = glad_instrument_glIsBuffer;
+    }
+    if(glad_glBufferData != NULL && glad_glBufferData != glad_instrument_glBufferData) {
+        glad_real_glBufferData = glad_glBufferData;
+        glad_glBufferData = glad_instrument_glBufferData;
+    }
+    if(glad_glBufferSubData != NULL && glad_glBufferSubData != glad_instrument_glBufferSubData) {
+        glad_real_glBufferSubData = glad_glBufferSubData;
+        glad_glBufferSubData = glad_instrument_glBufferSubData;
+    }
+    if(glad_glGetBufferSubData != NULL && glad_glGetBufferSubData != glad_instrument_glGetBufferSubData) {
+        glad_real_glGetBufferSubData = glad_glGetBufferSubData;
+        glad_glGetBufferSubData = glad_instrument_glGetBufferSubData;
+    }
+    if(glad_glMapBuffer != NULL && glad_glMapBuffer != glad_instrument_glMapBuffer) {
+        glad_real_glMapBuffer = glad_glMapBuffer;
+        glad_glMapBuffer = glad_instrument_glMapBuffer;
+    }
+    if(glad_glUnmapBuffer != NULL && glad_glUnmapBuffer != glad_instrument_glUnmapBuffer) {
+        glad_real_glUnmapBuffer = glad_glUnmapBuffer;
+        glad_glUnmapBuffer = glad_instrument_glUnmapBuffer;
+    }
+    if(glad_glGetBufferParameteriv != NULL && glad_glGetBufferParameteriv != glad_instrument_glGetBufferParameteriv) {
+        glad_real_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+        glad_glGetBufferParameteriv = glad_instrument_glGetBufferParameteriv;
+    }
+    if(glad_glGetBufferPointerv != NULL && glad_glGetBufferPointerv != glad_instrument_glGetBufferPointerv) {
+        glad_real_glGetBufferPointerv = glad_glGetBufferPointerv;
+        glad_glGetBufferPointerv = glad_instrument_glGetBufferPointerv;
+    }
+    if(glad_glBlendEquationSeparate != NULL && glad_glBlendEquationSeparate != glad_instrument_glBlendEquationSeparate) {
+        glad_real_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+        glad_glBlendEquationSeparate = glad_instrument_glBlendEquationSeparate;
+    }
+    if(glad_glDrawBuffers != NULL && glad_glDrawBuffers != glad_instrument_glDrawBuffers) {
+        glad_real_glDrawBuffers = glad_glDrawBuffers;
+        glad_glDrawBuffers = glad_instrument_glDrawBuffers;
+    }
+    if(glad_glStencilOpSeparate != NULL && glad_glStencilOpSeparate != glad_instrument_glStencilOpSeparate) {
+        glad_real_glStencilOpSeparate = glad_glStencilOpSeparate;
+        glad_glStencilOpSeparate = glad_instrument_glStencilOpSeparate;
+    }
+    if(glad_glStencilFuncSeparate != NULL && glad_glStencilFuncSeparate != glad_instrument_glStencilFuncSeparate) {
+        glad_real_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+        glad_glStencilFuncSeparate = glad_instrument_glStencilFuncSeparate;
+    }
+    if(glad_glStencilMaskSeparate != NULL && glad_glStencilMaskSeparate != glad_instrument_glStencilMaskSeparate) {
+        glad_real_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+        glad_glStencilMaskSeparate = glad_instrument_glStencilMaskSeparate;
+    }
+    if(glad_glAttachShader != NULL && glad_glAttachShader != glad_instrument_glAttachShader) {
+        glad_real_glAttachShader = glad_glAttachShader;
+        glad_glAttachShader = glad_instrument_glAttachShader;
+    }
+    if(glad_glBindAttribLocation != NULL && glad_glBindAttribLocation != glad_instrument_glBindAttribLocation) {
+        glad_real_glBindAttribLocation = glad_glBindAttribLocation;
+        glad_glBindAttribLocation = glad_instrument_glBindAttribLocation;
+    }
+    if(glad_glCompileShader != NULL && glad_glCompileShader != glad_instrument_glCompileShader) {
+        glad_real_glCompileShader = glad_glCompileShader;
+        glad_glCompileShader = glad_instrument_glCompileShader;
+    }
+    if(glad_glCreateProgram != NULL && glad_glCreateProgram != glad_instrument_glCreateProgram) {
+        glad_real_glCreateProgram = glad_glCreateProgram;
+        glad_glCreateProgram = glad_instrument_glCreateProgram;
+    }
+    if(glad_glCreateShader != NULL && glad_glCreateShader != glad_instrument_glCreateShader) {
+        glad_real_glCreateShader = glad_glCreateShader;
+        glad_glCreateShader = glad_instrument_glCreateShader;
+    }
+    if(glad_glDeleteProgram != NULL && glad_glDeleteProgram != glad_instrument_glDeleteProgram) {
+        glad_real_glDeleteProgram = glad_glDeleteProgram;
+        glad_glDeleteProgram = glad_instrument_glDeleteProgram;
+    }
+    if(glad_glDeleteShader != NULL && glad_glDeleteShader != glad_instrument_glDeleteShader) {
+        glad_real_glDeleteShader = glad_glDeleteShader;
+        glad_glDeleteShader = glad_instrument_glDeleteShader;
+    }
+    if(glad_glDetachShader != NULL && glad_glDetachShader != glad_instrument_glDetachShader) {
+        glad_real_glDetachShader = glad_glDetachShader;
+        glad_glDetachShader = glad_instrument_glDetachShader;
+    }
+    if(glad_glDisableVertexAttribArray != NULL && glad_glDisableVertexAttribArray != glad_instrument_glDisableVertexAttribArray) {
+        glad_real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+        glad_glDisableVertexAttribArray = glad_instrument_glDisableVertexAttribArray;
+    }
+    if(glad_glEnableVertexAttribArray != NULL && glad_glEnableVertexAttribArray != glad_instrument_glEnableVertexAttribArray) {
+        glad_real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+        glad_glEnableVertexAttribArray = glad_instrument_glEnableVertexAttribArray;
+    }
+    if(glad_glGetActiveAttrib != NULL && glad_glGetActiveAttrib != glad_instrument_glGetActiveAttrib) {
+        glad_real_glGetActiveAttrib = glad_glGetActiveAttrib;
+        glad_glGetActiveAttrib = glad_instrument_glGetActiveAttrib;
+    }
+    if(glad_glGetActiveUniform != NULL && glad_glGetActiveUniform != glad_instrument_glGetActiveUniform) {
+        glad_real_glGetActiveUniform = glad_glGetActiveUniform;
+        glad_glGetActiveUniform = glad_instrument_glGetActiveUniform;
+    }
+    if(glad_glGetAttachedShaders != NULL && glad_glGetAttachedShaders != glad_instrument_glGetAttachedShaders) {
+        glad_real_glGetAttachedShaders = glad_glGetAttachedShaders;
+        glad_glGetAttachedShaders = glad_instrument_glGetAttachedShaders;
+    }
+    if(glad_glGetAttribLocation != NULL && glad_glGetAttribLocation != glad_instrument_glGetAttribLocation) {
+        glad_real_glGetAttribLocation = glad_glGetAttribLocation;
+        glad_glGetAttribLocation = glad_instrument_glGetAttribLocation;
+    }
+    if(glad_glGetProgramiv != NULL && glad_glGetProgramiv != glad_instrument_glGetProgramiv) {
+        glad_real_glGetProgramiv = glad_glGetProgramiv;
+        glad_glGetProgramiv = glad_instrument_glGetProgramiv;
+    }
+    if(glad_glGetProgramInfoLog != NULL && glad_glGetProgramInfoLog != glad_instrument_glGetProgramInfoLog) {
+        glad_real_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+        glad_glGetProgramInfoLog = glad_instrument_glGetProgramInfoLog;
+    }
+    if(glad_glGetShaderiv != NULL && glad_glGetShaderiv != glad_instrument_glGetShaderiv) {
+        glad_real_glGetShaderiv = glad_glGetShaderiv;
+        glad_glGetShaderiv = glad_instrument_glGetShaderiv;
+    }
+    if(glad_glGetShaderInfoLog != NULL && glad_glGetShaderInfoLog != glad_instrument_glGetShaderInfoLog) {
+        glad_real_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+        glad_glGetShaderInfoLog = glad_instrument_glGetShaderInfoLog;
+    }
+    if(glad_glGetShaderSource != NULL && glad_glGetShaderSource != glad_instrument_glGetShaderSource) {
+        glad_real_glGetShaderSource = glad_glGetShaderSource;
+        glad_glGetShaderSource = glad_instrument_glGetShaderSource;
+    }
+    if(glad_glGetUniformLocation != NULL && glad_glGetUniformLocation != glad_instrument_glGetUniformLocation) {
+        glad_real_glGetUniformLocation = glad_glGetUniformLocation;
+        glad_glGetUniformLocation = glad_instrument_glGetUniformLocation;
+    }
+    if(glad_glGetUniformfv != NULL && glad_glGetUniformfv != glad_instrument_glGetUniformfv) {
+        glad_real_glGetUniformfv = glad_glGetUniformfv;
+        glad_glGetUniformfv = glad_instrument_glGetUniformfv;
+    }
+    if(glad_glGetUniformiv != NULL && glad_glGetUniformiv != glad_instrument_glGetUniformiv) {
+        glad_real_glGetUniformiv = glad_glGetUniformiv;
+        glad_glGetUniformiv = glad_instrument_glGetUniformiv;
+    }
+    if(glad_glGetVertexAttribdv != NULL && glad_glGetVertexAttribdv != glad_instrument_glGetVertexAttribdv) {
+        glad_real_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+        glad_glGetVertexAttribdv = glad_instrument_glGetVertexAttribdv;
+    }
+    if(glad_glGetVertexAttribfv != NULL && glad_glGetVertexAttribfv != glad_instrument_glGetVertexAttribfv) {
+        glad_real_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+        glad_glGetVertexAttribfv = glad_instrument_glGetVertexAttribfv;
+    }
+    if(glad_glGetVertexAttribiv != NULL && glad_glGetVertexAttribiv != glad_instrument_glGetVertexAttribiv) {
+        glad_real_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+        glad_glGetVertexAttribiv = glad_instrument_glGetVertexAttribiv;
+    }
+    if(glad_glGetVertexAttribPointerv != NULL && glad_glGetVertexAttribPointerv != glad_instrument_glGetVertexAttribPointerv) {
+        glad_real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+        glad_glGetVertexAttribPointerv = glad_instrument_glGetVertexAttribPointerv;
+    }
+    if(glad_glIsProgram != NULL && glad_glIsProgram != glad_instrument_glIsProgram) {
+        glad_real_glIsProgram = glad_glIsProgram;
+        glad_glIsProgram = glad_instrument_glIsProgram;
+    }
+    if(glad_glIsShader != NULL && glad_glIsShader != glad_instrument_glIsShader) {
+        glad_real_glIsShader = glad_glIsShader;
+        glad_glIsShader = glad_instrument_glIsShader;
+    }
+    if(glad_glLinkProgram != NULL && glad_glLinkProgram != glad_instrument_glLinkProgram) {
+        glad_real_glLinkProgram = glad_glLinkProgram;
+        glad_glLinkProgram = glad_instrument_glLinkProgram;
+    }
+    if(glad_glShaderSource != NULL && glad_glShaderSource != glad_instrument_glShaderSource) {
+        glad_real_glShaderSource = glad_glShaderSource;
+        glad_glShaderSource = glad_instrument_glShaderSource;
+    }
+    if(glad_glUseProgram != NULL && glad_glUseProgram != glad_instrument_glUseProgram) {
+        glad_real_glUseProgram = glad_glUseProgram;
+        glad_glUseProgram = glad_instrument_glUseProgram;
+    }
+    if(glad_glUniform1f != NULL && glad_glUniform1f != glad_instrument_glUniform1f) {
+        glad_real_glUniform1f = glad_glUniform1f;
+        glad_glUniform1f = glad_instrument_glUniform1f;
+    }
+    if(glad_glUniform2f != NULL && glad_glUniform2f != glad_instrument_glUniform2f) {
+        glad_real_glUniform2f = glad_glUniform2f;
+        glad_glUniform2f = glad_instrument_glUniform2f;
+    }
+    if(glad_glUniform3f != NULL && glad_glUniform3f != glad_instrument_glUniform3f) {
+        glad_real_glUniform3f = glad_glUniform3f;
+        glad_glUniform3f = glad_instrument_glUniform3f;
+    }
+    if(glad_glUniform4f != NULL && glad_glUniform4f != glad_instrument_glUniform4f) {
+        glad_real_glUniform4f = glad_glUniform4f;
+        glad_glUniform4f = glad_instrument_glUniform4f;
+    }
+    if(glad_glUniform1i != NULL && glad_glUniform1i != glad_instrument_glUniform1i) {
+        glad_real_glUniform1i = glad_glUniform1i;
+        glad_glUniform1i = glad_instrument_glUniform1i;
+    }
+    if(glad_glUniform2i != NULL && glad_glUniform2i != glad_instrument_glUniform2i) {
+        glad_real_glUniform2i = glad_glUniform2i;
+        glad_glUniform2i = glad_instrument_glUniform2i;
+    }
+    if(glad_glUniform3i != NULL && glad_glUniform3i != glad_instrument_glUniform3i) {
+        glad_real_glUniform3i = glad_glUniform3i;
+        glad_glUniform3i = glad_instrument_glUniform3i;
+    }
+    if(glad_glUniform4i != NULL && glad_glUniform4i != glad_instrument_glUniform4i) {
+        glad_real_glUniform4i = glad_glUniform4i;
+        glad_glUniform4i = glad_instrument_glUniform4i;
+    }
+    if(glad_glUniform1fv != NULL && glad_glUniform1fv != glad_instrument_glUniform1fv) {
+        glad_real_glUniform1fv = glad_glUniform1fv;
+        glad_glUniform1fv = glad_instrument_glUniform1fv;
+    }
+    if(glad_glUniform2fv != NULL && glad_glUniform2fv != glad_instrument_glUniform2fv) {
+        glad_real_glUniform2fv = glad_glUniform2fv;
+        glad_glUniform2fv = glad_instrument_glUniform2fv;
+    }
+    if(glad_glUniform3fv != NULL && glad_glUniform3fv != glad_instrument_glUniform3fv) {
+        glad_real_glUniform3fv = glad_glUniform3fv;
+        glad_glUniform3fv = glad_instrument_glUniform3fv;
+    }
+    if(glad_glUniform4fv != NULL && glad_glUniform4fv != glad_instrument_glUniform4fv) {
+        glad_real_glUniform4fv = glad_glUniform4fv;
+        glad_glUniform4fv = glad_instrument_glUniform4fv;
+    }
+    if(glad_glUniform1iv != NULL && glad_glUniform1iv != glad_instrument_glUniform1iv) {
+        glad_real_glUniform1iv = glad_glUniform1iv;
+        glad_glUniform1iv = glad_instrument_glUniform1iv;
+    }
+    if(glad_glUniform2iv != NULL && glad_glUniform2iv != glad_instrument_glUniform2iv) {
+        glad_real_glUniform2iv = glad_glUniform2iv;
+        glad_glUniform2iv = glad_instrument_glUniform2iv;
+    }
+    if(glad_glUniform3iv != NULL && glad_glUniform3iv != glad_instrument_glUniform3iv) {
+        glad_real_glUniform3iv = glad_glUniform3iv;
+        glad_glUniform3iv = glad_instrument_glUniform3iv;
+    }
+    if(glad_glUniform4iv != NULL && glad_glUniform4iv != glad_instrument_glUniform4iv) {
+        glad_real_glUniform4iv = glad_glUniform4iv;
+        glad_glUniform4iv = glad_instrument_glUniform4iv;
+    }
+    if(glad_glUniformMatrix2fv != NULL && glad_glUniformMatrix2fv != glad_instrument_glUniformMatrix2fv) {
+        glad_real_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+        glad_glUniformMatrix2fv = glad_instrument_glUniformMatrix2fv;
+    }
+    if(glad_glUniformMatrix3fv != NULL && glad_glUniformMatrix3fv != glad_instrument_glUniformMatrix3fv) {
+        glad_real_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+        glad_glUniformMatrix3fv = glad_instrument_glUniformMatrix3fv;
+    }
+    if(glad_glUniformMatrix4fv != NULL && glad_glUniformMatrix4fv != glad_instrument_glUniformMatrix4fv) {
+        glad_real_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+        glad_glUniformMatrix4fv = glad_instrument_glUniformMatrix4fv;
+    }
+    if(glad_glValidateProgram != NULL && glad_glValidateProgram != glad_instrument_glValidateProgram) {
+        glad_real_glValidateProgram = glad_glValidateProgram;
+        glad_glValidateProgram = glad_instrument_glValidateProgram;
+    }
+    if(glad_glVertexAttrib1d != NULL && glad_glVertexAttrib1d != glad_instrument_glVertexAttrib1d) {
+        glad_real_glVertexAttrib1d = glad_glVertexAttrib1d;
+        glad_glVertexAttrib1d = glad_instrument_glVertexAttrib1d;
+    }
+    if(glad_glVertexAttrib1dv != NULL && glad_glVertexAttrib1dv != glad_instrument_glVertexAttrib1dv) {
+        glad_real_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+        glad_glVertexAttrib1dv = glad_instrument_glVertexAttrib1dv;
+    }
+    if(glad_glVertexAttrib1f != NULL && glad_glVertexAttrib1f != glad_instrument_glVertexAttrib1f) {
+        glad_real_glVertexAttrib1f = glad_glVertexAttrib1f;
+        glad_glVertexAttrib1f = glad_instrument_glVertexAttrib1f;
+    }
+    if(glad_glVertexAttrib1fv != NULL && glad_glVertexAttrib1fv != glad_instrument_glVertexAttrib1fv) {
+        glad_real_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+        glad_glVertexAttrib1fv = glad_instrument_glVertexAttrib1fv;
+    }
+    if(glad_glVertexAttrib1s != NULL && glad_glVertexAttrib1s != glad_instrument_glVertexAttrib1s) {
+        glad_real_glVertexAttrib1s = glad_glVertexAttrib1s;
+        glad_glVertexAttrib1s = glad_instrument_glVertexAttrib1s;
+    }
+    if(glad_glVertexAttrib1sv != NULL && glad_glVertexAttrib1sv != glad_instrument_glVertexAttrib1sv) {
+        glad_real_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+        glad_glVertexAttrib1sv = glad_instrument_glVertexAttrib1sv;
+    }
+    if(glad_glVertexAttrib2d != NULL && glad_glVertexAttrib2d != glad_instrument_glVertexAttrib2d) {
+        glad_real_glVertexAttrib2d = glad_glVertexAttrib2d;
+        glad_glVertexAttrib2d = glad_instrument_glVertexAttrib2d;
+    }
+    if(glad_glVertexAttrib2dv != NULL && glad_glVertexAttrib2dv != glad_instrument_glVertexAttrib2dv) {
+        glad_real_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+        glad_glVertexAttrib2dv = glad_instrument_glVertexAttrib2dv;
+    }
+    if(glad_glVertexAttrib2f != NULL && glad_glVertexAttrib2f != glad_instrument_glVertexAttrib2f) {
+        glad_real_glVertexAttrib2f = glad_glVertexAttrib2f;
+        glad_glVertexAttrib2f = glad_instrument_glVertexAttrib2f;
+    }
+    if(glad_glVertexAttrib2fv != NULL && glad_glVertexAttrib2fv != glad_instrument_glVertexAttrib2fv) {
+        glad_real_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+        glad_glVertexAttrib2fv = glad_instrument_glVertexAttrib2fv;
+    }
+    if(glad_glVertexAttrib2s != NULL && glad_glVertexAttrib2s != glad_instrument_glVertexAttrib2s) {
+        glad_real_glVertexAttrib2s = glad_glVertexAttrib2s;
+        glad_glVertexAttrib2s = glad_instrument_glVertexAttrib2s;
+    }
+    if(glad_glVertexAttrib2sv != NULL && glad_glVertexAttrib2sv != glad_instrument_glVertexAttrib2sv) {
+        glad_real_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+        glad_glVertexAttrib2sv = glad_instrument_glVertexAttrib2sv;
+    }
+    if(glad_glVertexAttrib3d != NULL && glad_glVertexAttrib3d != glad_instrument_glVertexAttrib3d) {
+        glad_real_glVertexAttrib3d = glad_glVertexAttrib3d;
+        glad_glVertexAttrib3d = glad_instrument_glVertexAttrib3d;
+    }
+    if(glad_glVertexAttrib3dv != NULL && glad_glVertexAttrib3dv != glad_instrument_glVertexAttrib3dv) {
+        glad_real_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+        glad_glVertexAttrib3dv = glad_instrument_glVertexAttrib3dv;
+    }
+    if(glad_glVertexAttrib3f != NULL && glad_glVertexAttrib3f != glad_instrument_glVertexAttrib3f) {
+        glad_real_glVertexAttrib3f = glad_glVertexAttrib3f;
+        glad_glVertexAttrib3f = glad_instrument_glVertexAttrib3f;
+    }
+    if(glad_glVertexAttrib3fv != NULL && glad_glVertexAttrib3fv != glad_instrument_glVertexAttrib3fv) {
+        glad_real_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+        glad_glVertexAttrib3fv = glad_instrument_glVertexAttrib3fv;
+    }
+    if(glad_glVertexAttrib3s != NULL && glad_glVertexAttrib3s != glad_instrument_glVertexAttrib3s) {
+        glad_real_glVertexAttrib3s = glad_glVertexAttrib3s;
+        glad_glVertexAttrib3s = glad_instrument_glVertexAttrib3s;
+    }
+    if(glad_glVertexAttrib3sv != NULL && glad_glVertexAttrib3sv != glad_instrument_glVertexAttrib3sv) {
+        glad_real_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+        glad_glVertexAttrib3sv = glad_instrument_glVertexAttrib3sv;
+    }
+    if(glad_glVertexAttrib4Nbv != NULL && glad_glVertexAttrib4Nbv != glad_instrument_glVertexAttrib4Nbv) {
+        glad_real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+        glad_glVertexAttrib4Nbv = glad_instrument_glVertexAttrib4Nbv;
+    }
+    if(glad_glVertexAttrib4Niv != NULL && glad_glVertexAttrib4Niv != glad_instrument_glVertexAttrib4Niv) {
+        glad_real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+        glad_glVertexAttrib4Niv = glad_instrument_glVertexAttrib4Niv;
+    }
+    if(glad_glVertexAttrib4Nsv != NULL && glad_glVertexAttrib4Nsv != glad_instrument_glVertexAttrib4Nsv) {
+        glad_real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+        glad_glVertexAttrib4Nsv = glad_instrument_glVertexAttrib4Nsv;
+    }
+    if(glad_glVertexAttrib4Nub != NULL && glad_glVertexAttrib4Nub != glad_instrument_glVertexAttrib4Nub) {
+        glad_real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+        glad_glVertexAttrib4Nub = glad_instrument_glVertexAttrib4Nub;
+    }
+    if(glad_glVertexAttrib4Nubv != NULL && glad_glVertexAttrib4Nubv != glad_instrument_glVertexAttrib4Nubv) {
+        glad_real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+        glad_glVertexAttrib4Nubv = glad_instrument_glVertexAttrib4Nubv;
+    }
+    if(glad_glVertexAttrib4Nuiv != NULL && glad_glVertexAttrib4Nuiv != glad_instrument_glVertexAttrib4Nuiv) {
+        glad_real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+        glad_glVertexAttrib4Nuiv = glad_instrument_glVertexAttrib4Nuiv;
+    }
+    if(glad_glVertexAttrib4Nusv != NULL && glad_glVertexAttrib4Nusv != glad_instrument_glVertexAttrib4Nusv) {
+        glad_real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+        glad_glVertexAttrib4Nusv = glad_instrument_glVertexAttrib4Nusv;
+    }
+    if(glad_glVertexAttrib4bv != NULL && glad_glVertexAttrib4bv != glad_instrument_glVertexAttrib4bv) {
+        glad_real_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+        glad_glVertexAttrib4bv = glad_instrument_glVertexAttrib4bv;
+    }
+    if(glad_glVertexAttrib4d != NULL && glad_glVertexAttrib4d != glad_instrument_glVertexAttrib4d) {
+        glad_real_glVertexAttrib4d = glad_glVertexAttrib4d;
+        glad_glVertexAttrib4d = glad_instrument_glVertexAttrib4d;
+    }
+    if(glad_glVertexAttrib4dv != NULL && glad_glVertexAttrib4dv != glad_instrument_glVertexAttrib4dv) {
+        glad_real_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+        glad_glVertexAttrib4dv = glad_instrument_glVertexAttrib4dv;
+    }
+    if(glad_glVertexAttrib4f != NULL && glad_glVertexAttrib4f != glad_instrument_glVertexAttrib4f) {
+        glad_real_glVertexAttrib4f = glad_glVertexAttrib4f;
+        glad_glVertexAttrib4f = glad_instrument_glVertexAttrib4f;
+    }
+    if(glad_glVertexAttrib4fv != NULL && glad_glVertexAttrib4fv != glad_instrument_glVertexAttrib4fv) {
+        glad_real_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+        glad_glVertexAttrib4fv = glad_instrument_glVertexAttrib4fv;
+    }
+    if(glad_glVertexAttrib4iv != NULL && glad_glVertexAttrib4iv != glad_instrument_glVertexAttrib4iv) {
+        glad_real_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+        glad_glVertexAttrib4iv = glad_instrument_glVertexAttrib4iv;
+    }
+    if(glad_glVertexAttrib4s != NULL && glad_glVertexAttrib4s != glad_instrument_glVertexAttrib4s) {
+        glad_real_glVertexAttrib4s = glad_glVertexAttrib4s;
+        glad_glVertexAttrib4s = glad_instrument_glVertexAttrib4s;
+    }
+    if(glad_glVertexAttrib4sv != NULL && glad_glVertexAttrib4sv != glad_instrument_glVertexAttrib4sv) {
+        glad_real_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+        glad_glVertexAttrib4sv = glad_instrument_glVertexAttrib4sv;
+    }
+    if(glad_glVertexAttrib4ubv != NULL && glad_glVertexAttrib4ubv != glad_instrument_glVertexAttrib4ubv) {
+        glad_real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+        glad_glVertexAttrib4ubv = glad_instrument_glVertexAttrib4ubv;
+    }
+    if(glad_glVertexAttrib4uiv != NULL && glad_glVertexAttrib4uiv != glad_instrument_glVertexAttrib4uiv) {
+        glad_real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+        glad_glVertexAttrib4uiv = glad_instrument_glVertexAttrib4uiv;
+    }
+    if(glad_glVertexAttrib4usv != NULL && glad_glVertexAttrib4usv != glad_instrument_glVertexAttrib4usv) {
+        glad_real_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+        glad_glVertexAttrib4usv = glad_instrument_glVertexAttrib4usv;
+    }
+    if(glad_glVertexAttribPointer != NULL && glad_glVertexAttribPointer != glad_instrument_glVertexAttribPointer) {
+        glad_real_glVertexAttribPointer = glad_glVertexAttribPointer;
+        glad_glVertexAttribPointer = glad_instrument_glVertexAttribPointer;
+    }
+    if(glad_glUniformMatrix2x3fv != NULL && glad_glUniformMatrix2x3fv != glad_instrument_glUniformMatrix2x3fv) {
+        glad_real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+        glad_glUniformMatrix2x3fv = glad_instrument_glUniformMatrix2x3fv;
+    }
+    if(glad_glUniformMatrix3x2fv != NULL && glad_glUniformMatrix3x2fv != glad_instrument_glUniformMatrix3x2fv) {
+        glad_real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+        glad_glUniformMatrix3x2fv = glad_instrument_glUniformMatrix3x2fv;
+    }
+    if(glad_glUniformMatrix2x4fv != NULL && glad_glUniformMatrix2x4fv != glad_instrument_glUniformMatrix2x4fv) {
+        glad_real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+        glad_glUniformMatrix2x4fv = glad_instrument_glUniformMatrix2x4fv;
+    }
+    if(glad_glUniformMatrix4x2fv != NULL && glad_glUniformMatrix4x2fv != glad_instrument_glUniformMatrix4x2fv) {
+        glad_real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+        glad_glUniformMatrix4x2fv = glad_instrument_glUniformMatrix4x2fv;
+    }
+    if(glad_glUniformMatrix3x4fv != NULL && glad_glUniformMatrix3x4fv != glad_instrument_glUniformMatrix3x4fv) {
+        glad_real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+        glad_glUniformMatrix3x4fv = glad_instrument_glUniformMatrix3x4fv;
+    }
+    if(glad_glUniformMatrix4x3fv != NULL && glad_glUniformMatrix4x3fv != glad_instrument_glUniformMatrix4x3fv) {
+        glad_real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+        glad_glUniformMatrix4x3fv = glad_instrument_glUniformMatrix4x3fv;
+    }
+    if(glad_glColorMaski != NULL && glad_glColorMaski != glad_instrument_glColorMaski) {
+        glad_real_glColorMaski = glad_glColorMaski;
+        glad_glColorMaski = glad_instrument_glColorMaski;
+    }
+    if(glad_glGetBooleani_v != NULL && glad_glGetBooleani_v != glad_instrument_glGetBooleani_v) {
+        glad_real_glGetBooleani_v = glad_glGetBooleani_v;
+        glad_glGetBooleani_v = glad_instrument_glGetBooleani_v;
+    }
+    if(glad_glGetIntegeri_v != NULL && glad_glGetIntegeri_v != glad_instrument_glGetIntegeri_v) {
+        glad_real_glGetIntegeri_v = glad_glGetIntegeri_v;
+        glad_glGetIntegeri_v = glad_instrument_glGetIntegeri_v;
+    }
+    if(glad_glEnablei != NULL && glad_glEnablei != glad_instrument_glEnablei) {
+        glad_real_glEnablei = glad_glEnablei;
+        glad_glEnablei = glad_instrument_glEnablei;
+    }
+    if(glad_glDisablei != NULL && glad_glDisablei != glad_instrument_glDisablei) {
+        glad_real_glDisablei = glad_glDisablei;
+        glad_glDisablei = glad_instrument_glDisablei;
+    }
+    if(glad_glIsEnabledi != NULL && glad_glIsEnabledi != glad_instrument_glIsEnabledi) {
+        glad_real_glIsEnabledi = glad_glIsEnabledi;
+        glad_glIsEnabledi = glad_instrument_glIsEnabledi;
+    }
+    if(glad_glBeginTransformFeedback != NULL && glad_glBeginTransformFeedback != glad_instrument_glBeginTransformFeedback) {
+        glad_real_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+        glad_glBeginTransformFeedback = glad_instrument_glBeginTransformFeedback;
+    }
+    if(glad_glEndTransformFeedback != NULL && glad_glEndTransformFeedback != glad_instrument_glEndTransformFeedback) {
+        glad_real_glEndTransformFeedback = glad_glEndTransformFeedback;
+        glad_glEndTransformFeedback = glad_instrument_glEndTransformFeedback;
+    }
+    if(glad_glBindBufferRange != NULL && glad_glBindBufferRange != glad_instrument_glBindBufferRange) {
+        glad_real_glBindBufferRange = glad_glBindBufferRange;
+        glad_glBindBufferRange = glad_instrument_glBindBufferRange;
+    }
+    if(glad_glBindBufferBase != NULL && glad_glBindBufferBase != glad_instrument_glBindBufferBase) {
+        glad_real_glBindBufferBase = glad_glBindBufferBase;
+        glad_glBindBufferBase = glad_instrument_glBindBufferBase;
+    }
+    if(glad_glTransformFeedbackVaryings != NULL && glad_glTransformFeedbackVaryings != glad_instrument_glTransformFeedbackVaryings) {
+        glad_real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+        glad_glTransformFeedbackVaryings = glad_instrument_glTransformFeedbackVaryings;
+    }
+    if(glad_glGetTransformFeedbackVarying != NULL && glad_glGetTransformFeedbackVarying != glad_instrument_glGetTransformFeedbackVarying) {
+        glad_real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+        glad_glGetTransformFeedbackVarying = glad_instrument_glGetTransformFeedbackVarying;
+    }
+    if(glad_glClampColor != NULL && glad_glClampColor != glad_instrument_glClampColor) {
+        glad_real_glClampColor = glad_glClampColor;
+        glad_glClampColor = glad_instrument_glClampColor;
+    }
+    if(glad_glBeginConditionalRender != NULL && glad_glBeginConditionalRender != glad_instrument_glBeginConditionalRender) {
+        glad_real_glBeginConditionalRender = glad_glBeginConditionalRender;
+        glad_glBeginConditionalRender = glad_instrument_glBeginConditionalRender;
+    }
+    if(glad_glEndConditionalRender != NULL && glad_glEndConditionalRender != glad_instrument_glEndConditionalRender) {
+        glad_real_glEndConditionalRender = glad_glEndConditionalRender;
+        glad_glEndConditionalRender = glad_instrument_glEndConditionalRender;
+    }
+    if(glad_glVertexAttribIPointer != NULL && glad_glVertexAttribIPointer != glad_instrument_glVertexAttribIPointer) {
+        glad_real_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+        glad_glVertexAttribIPointer = glad_instrument_glVertexAttribIPointer;
+    }
+    if(glad_glGetVertexAttribIiv != NULL && glad_glGetVertexAttribIiv != glad_instrument_glGetVertexAttribIiv) {
+        glad_real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+        glad_glGetVertexAttribIiv = glad_instrument_glGetVertexAttribIiv;
+    }
+    if(glad_glGetVertexAttribIuiv != NULL && glad_glGetVertexAttribIuiv != glad_instrument_glGetVertexAttribIuiv) {
+        glad_real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+        glad_glGetVertexAttribIuiv = glad_instrument_glGetVertexAttribIuiv;
+    }
+    if(glad_glVertexAttribI1i != NULL && glad_glVertexAttribI1i != glad_instrument_glVertexAttribI1i) {
+        glad_real_glVertexAttribI1i = glad_glVertexAttribI1i;
+        glad_glVertexAttribI1i = glad_instrument_glVertexAttribI1i;
+    }
+    if(glad_glVertexAttribI2i != NULL && glad_glVertexAttribI2i != glad_instrument_glVertexAttribI2i) {
+        glad_real_glVertexAttribI2i = glad_glVertexAttribI2i;
+        glad_glVertexAttribI2i = glad_instrument_glVertexAttribI2i;
+    }
+    if(glad_glVertexAttribI3i != NULL && glad_glVertexAttribI3i != glad_instrument_glVertexAttribI3i) {
+        glad_real_glVertexAttribI3i = glad_glVertexAttribI3i;
+        glad_glVertexAttribI3i = glad_instrument_glVertexAttribI3i;
+    }
+    if(glad_glVertexAttribI4i != NULL && glad_glVertexAttribI4i != glad_instrument_glVertexAttribI4i) {
+        glad_real_glVertexAttribI4i = glad_glVertexAttribI4i;
+        glad_glVertexAttribI4i = glad_instrument_glVertexAttribI4i;
+    }
+    if(glad_glVertexAttribI1ui != NULL && glad_glVertexAttribI1ui != glad_instrument_glVertexAttribI1ui) {
+        glad_real_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+        glad_glVertexAttribI1ui = glad_instrument_glVertexAttribI1ui;
+    }
+    if(glad_glVertexAttribI2ui != NULL && glad_glVertexAttribI2ui != glad_instrument_glVertexAttribI2ui) {
+        glad_real_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+        glad_glVertexAttribI2ui = glad_instrument_glVertexAttribI2ui;
+    }
+    if(glad_glVertexAttribI3ui != NULL && glad_glVertexAttribI3ui != glad_instrument_glVertexAttribI3ui) {
+        glad_real_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+        glad_glVertexAttribI3ui = glad_instrument_glVertexAttribI3ui;
+    }
+    if(glad_glVertexAttribI4ui != NULL && glad_glVertexAttribI4ui != glad_instrument_glVertexAttribI4ui) {
+        glad_real_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+        glad_glVertexAttribI4ui = glad_instrument_glVertexAttribI4ui;
+    }
+    if(glad_glVertexAttribI1iv != NULL && glad_glVertexAttribI1iv != glad_instrument_glVertexAttribI1iv) {
+        glad_real_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+        glad_glVertexAttribI1iv = glad_instrument_glVertexAttribI1iv;
+    }
+    if(glad_glVertexAttribI2iv != NULL && glad_glVertexAttribI2iv != glad_instrument_glVertexAttribI2iv) {
+        glad_real_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+        glad_glVertexAttribI2iv = glad_instrument_glVertexAttribI2iv;
+    }
+    if(glad_glVertexAttribI3iv != NULL && glad_glVertexAttribI3iv != glad_instrument_glVertexAttribI3iv) {
+        glad_real_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+        glad_glVertexAttribI3iv = glad_instrument_glVertexAttribI3iv;
+    }
+    if(glad_glVertexAttribI4iv != NULL && glad_glVertexAttribI4iv != glad_instrument_glVertexAttribI4iv) {
+        glad_real_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+        glad_glVertexAttribI4iv = glad_instrument_glVertexAttribI4iv;
+    }
+    if(glad_glVertexAttribI1uiv != NULL && glad_glVertexAttribI1uiv != glad_instrument_glVertexAttribI1uiv) {
+        glad_real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+        glad_glVertexAttribI1uiv = glad_instrument_glVertexAttribI1uiv;
+    }
+    if(glad_glVertexAttribI2uiv != NULL && glad_glVertexAttribI2uiv != glad_instrument_glVertexAttribI2uiv) {
+        glad_real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+        glad_glVertexAttribI2uiv = glad_instrument_glVertexAttribI2uiv;
+    }
+    if(glad_glVertexAttribI3uiv != NULL && glad_glVertexAttribI3uiv != glad_instrument_glVertexAttribI3uiv) {
+        glad_real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+        glad_glVertexAttribI3uiv = glad_instrument_glVertexAttribI3uiv;
+    }
+    if(glad_glVertexAttribI4uiv != NULL && glad_glVertexAttribI4uiv != glad_instrument_glVertexAttribI4uiv) {
+        glad_real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+        glad_glVertexAttribI4uiv = glad_instrument_glVertexAttribI4uiv;
+    }
+    if(glad_glVertexAttribI4bv != NULL && glad_glVertexAttribI4bv != glad_instrument_glVertexAttribI4bv) {
+        glad_real_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+        glad_glVertexAttribI4bv = glad_instrument_glVertexAttribI4bv;
+    }
+    if(glad_glVertexAttribI4sv != NULL && glad_glVertexAttribI4sv != glad_instrument_glVertexAttribI4sv) {
+        glad_real_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+        glad_glVertexAttribI4sv = glad_instrument_glVertexAttribI4sv;
+    }
+    if(glad_glVertexAttribI4ubv != NULL && glad_glVertexAttribI4ubv != glad_instrument_glVertexAttribI4ubv) {
+        glad_real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+        glad_glVertexAttribI4ubv = glad_instrument_glVertexAttribI4ubv;
+    }
+    if(glad_glVertexAttribI4usv != NULL && glad_glVertexAttribI4usv != glad_instrument_glVertexAttribI4usv) {
+        glad_real_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+        glad_glVertexAttribI4usv = glad_instrument_glVertexAttribI4usv;
+    }
+    if(glad_glGetUniformuiv != NULL && glad_glGetUniformuiv != glad_instrument_glGetUniformuiv) {
+        glad_real_glGetUniformuiv = glad_glGetUniformuiv;
+        glad_glGetUniformuiv = glad_instrument_glGetUniformuiv;
+    }
+    if(glad_glBindFragDataLocation != NULL && glad_glBindFragDataLocation != glad_instrument_glBindFragDataLocation) {
+        glad_real_glBindFragDataLocation = glad_glBindFragDataLocation;
+        glad_glBindFragDataLocation = glad_instrument_glBindFragDataLocation;
+    }
+    if(glad_glGetFragDataLocation != NULL && glad_glGetFragDataLocation != glad_instrument_glGetFragDataLocation) {
+        glad_real_glGetFragDataLocation = glad_glGetFragDataLocation;
+        glad_glGetFragDataLocation = glad_instrument_glGetFragDataLocation;
+    }
+    if(glad_glUniform1ui != NULL && glad_glUniform1ui != glad_instrument_glUniform1ui) {
+        glad_real_glUniform1ui = glad_glUniform1ui;
+        glad_glUniform1ui = glad_instrument_glUniform1ui;
+    }
+    if(glad_glUniform2ui != NULL && glad_glUniform2ui != glad_instrument_glUniform2ui) {
+        glad_real_glUniform2ui = glad_glUniform2ui;
+        glad_glUniform2ui = glad_instrument_glUniform2ui;
+    }
+    if(glad_glUniform3ui != NULL && glad_glUniform3ui != glad_instrument_glUniform3ui) {
+        glad_real_glUniform3ui = glad_glUniform3ui;
+        glad_glUniform3ui = glad_instrument_glUniform3ui;
+    }
+    if(glad_glUniform4ui != NULL && glad_glUniform4ui != glad_instrument_glUniform4ui) {
+        glad_real_glUniform4ui = glad_glUniform4ui;
+        glad_glUniform4ui = glad_instrument_glUniform4ui;
+    }
+    if(glad_glUniform1uiv != NULL && glad_glUniform1uiv != glad_instrument_glUniform1uiv) {
+        glad_real_glUniform1uiv = glad_glUniform1uiv;
+        glad_glUniform1uiv = glad_instrument_glUniform1uiv;
+    }
+    if(glad_glUniform2uiv != NULL && glad_glUniform2uiv != glad_instrument_glUniform2uiv) {
+        glad_real_glUniform2uiv = glad_glUniform2uiv;
+        glad_glUniform2uiv = glad_instrument_glUniform2uiv;
+    }
+    if(glad_glUniform3uiv != NULL && glad_glUniform3uiv != glad_instrument_glUniform3uiv) {
+        glad_real_glUniform3uiv = glad_glUniform3uiv;
+        glad_glUniform3uiv = glad_instrument_glUniform3uiv;
+    }
+    if(glad_glUniform4uiv != NULL && glad_glUniform4uiv != glad_instrument_glUniform4uiv) {
+        glad_real_glUniform4uiv = glad_glUniform4uiv;
+        glad_glUniform4uiv = glad_instrument_glUniform4uiv;
+    }
+    if(glad_glTexParameterIiv != NULL && glad_glTexParameterIiv != glad_instrument_glTexParameterIiv) {
+        glad_real_glTexParameterIiv = glad_glTexParameterIiv;
+        glad_glTexParameterIiv = glad_instrument_glTexParameterIiv;
+    }
+    if(glad_glTexParameterIuiv != NULL && glad_glTexParameterIuiv != glad_instrument_glTexParameterIuiv) {
+        glad_real_glTexParameterIuiv = glad_glTexParameterIuiv;
+        glad_glTexParameterIuiv = glad_instrument_glTexParameterIuiv;
+    }
+    if(glad_glGetTexParameterIiv != NULL && glad_glGetTexParameterIiv != glad_instrument_glGetTexParameterIiv) {
+        glad_real_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+        glad_glGetTexParameterIiv = glad_instrument_glGetTexParameterIiv;
+    }
+    if(glad_glGetTexParameterIuiv != NULL && glad_glGetTexParameterIuiv != glad_instrument_glGetTexParameterIuiv) {
+        glad_real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+        glad_glGetTexParameterIuiv = glad_instrument_glGetTexParameterIuiv;
+    }
+    if(glad_glClearBufferiv != NULL && glad_glClearBufferiv != glad_instrument_glClearBufferiv) {
+        glad_real_glClearBufferiv = glad_glClearBufferiv;
+        glad_glClearBufferiv = glad_instrument_glClearBufferiv;
+    }
+    if(glad_glClearBufferuiv != NULL && glad_glClearBufferuiv != glad_instrument_glClearBufferuiv) {
+        glad_real_glClearBufferuiv = glad_glClearBufferuiv;
+        glad_glClearBufferuiv = glad_instrument_glClearBufferuiv;
+    }
+    if(glad_glClearBufferfv != NULL && glad_glClearBufferfv != glad_instrument_glClearBufferfv) {
+        glad_real_glClearBufferfv = glad_glClearBufferfv;
+        glad_glClearBufferfv = glad_instrument_glClearBufferfv;
+    }
+    if(glad_glClearBufferfi != NULL && glad_glClearBufferfi != glad_instrument_glClearBufferfi) {
+        glad_real_glClearBufferfi = glad_glClearBufferfi;
+        glad_glClearBufferfi = glad_instrument_glClearBufferfi;
+    }
+    if(glad_glGetStringi != NULL && glad_glGetStringi != glad_instrument_glGetStringi) {
+        glad_real_glGetStringi = glad_glGetStringi;
+        glad_glGetStringi = glad_instrument_glGetStringi;
+    }
+    if(glad_glIsRenderbuffer != NULL && glad_glIsRenderbuffer != glad_instrument_glIsRenderbuffer) {
+        glad_real_glIsRenderbuffer = glad_glIsRenderbuffer;
+        glad_glIsRenderbuffer = glad_instrument_glIsRenderbuffer;
+    }
+    if(glad_glBindRenderbuffer != NULL && glad_glBindRenderbuffer != glad_instrument_glBindRenderbuffer) {
+        glad_real_glBindRenderbuffer = glad_glBindRenderbuffer;
+        glad_glBindRenderbuffer = glad_instrument_glBindRenderbuffer;
+    }
+    if(glad_glDeleteRenderbuffers != NULL && glad_glDeleteRenderbuffers != glad_instrument_glDeleteRenderbuffers) {
+        glad_real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+        glad_glDeleteRenderbuffers = glad_instrument_glDeleteRenderbuffers;
+    }
+    if(glad_glGenRenderbuffers != NULL && glad_glGenRenderbuffers != glad_instrument_glGenRenderbuffers) {
+        glad_real_glGenRenderbuffers = glad_glGenRenderbuffers;
+        glad_glGenRenderbuffers = glad_instrument_glGenRenderbuffers;
+    }
+    if(glad_glRenderbufferStorage != NULL && glad_glRenderbufferStorage != glad_instrument_glRenderbufferStorage) {
+        glad_real_glRenderbufferStorage = glad_glRenderbufferStorage;
+        glad_glRenderbufferStorage = glad_instrument_glRenderbufferStorage;
+    }
+    if(glad_glGetRenderbufferParameteriv != NULL && glad_glGetRenderbufferParameteriv != glad_instrument_glGetRenderbufferParameteriv) {
+        glad_real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+        glad_glGetRenderbufferParameteriv = glad_instrument_glGetRenderbufferParameteriv;
+    }
+    if(glad_glIsFramebuffer != NULL && glad_glIsFramebuffer != glad_instrument_glIsFramebuffer) {
+        glad_real_glIsFramebuffer = glad_glIsFramebuffer;
+        glad_glIsFramebuffer = glad_instrument_glIsFramebuffer;
+    }
+    if(glad_glBindFramebuffer != NULL && glad_glBindFramebuffer != glad_instrument_glBindFramebuffer) {
+        glad_real_glBindFramebuffer = glad_glBindFramebuffer;
+        glad_glBindFramebuffer = glad_instrument_glBindFramebuffer;
+    }
+    if(glad_glDeleteFramebuffers != NULL && glad_glDeleteFramebuffers != glad_instrument_glDeleteFramebuffers) {
+        glad_real_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+        glad_glDeleteFramebuffers = glad_instrument_glDeleteFramebuffers;
+    }
+    if(glad_glGenFramebuffers != NULL && glad_glGenFramebuffers != glad_instrument_glGenFramebuffers) {
+        glad_real_glGenFramebuffers = glad_glGenFramebuffers;
+        glad_glGenFramebuffers = glad_instrument_glGenFramebuffers;
+    }
+    if(glad_glCheckFramebufferStatus != NULL && glad_glCheckFramebufferStatus != glad_instrument_glCheckFramebufferStatus) {
+        glad_real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+        glad_glCheckFramebufferStatus = glad_instrument_glCheckFramebufferStatus;
+    }
+    if(glad_glFramebufferTexture1D != NULL && glad_glFramebufferTexture1D != glad_instrument_glFramebufferTexture1D) {
+        glad_real_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+        glad_glFramebufferTexture1D = glad_instrument_glFramebufferTexture1D;
+    }
+    if(glad_glFramebufferTexture2D != NULL && glad_glFramebufferTexture2D != glad_instrument_glFramebufferTexture2D) {
+        glad_real_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+        glad_glFramebufferTexture2D = glad_instrument_glFramebufferTexture2D;
+    }
+    if(glad_glFramebufferTexture3D != NULL && glad_glFramebufferTexture3D != glad_instrument_glFramebufferTexture3D) {
+        glad_real_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+        glad_glFramebufferTexture3D = glad_instrument_glFramebufferTexture3D;
+    }
+    if(glad_glFramebufferRenderbuffer != NULL && glad_glFramebufferRenderbuffer != glad_instrument_glFramebufferRenderbuffer) {
+        glad_real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+        glad_glFramebufferRenderbuffer = glad_instrument_glFramebufferRenderbuffer;
+    }
+    if(glad_glGetFramebufferAttachmentParameteriv != NULL && glad_glGetFramebufferAttachmentParameteriv != glad_instrument_glGetFramebufferAttachmentParameteriv) {
+        glad_real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+        glad_glGetFramebufferAttachmentParameteriv = glad_instrument_glGetFramebufferAttachmentParameteriv;
+    }
+    if(glad_glGenerateMipmap != NULL && glad_glGenerateMipmap != glad_instrument_glGenerateMipmap) {
+        glad_real_glGenerateMipmap = glad_glGenerateMipmap;
+        glad_glGenerateMipmap = glad_instrument_glGenerateMipmap;
+    }
+    if(glad_glBlitFramebuffer != NULL && glad_glBlitFramebuffer != glad_instrument_glBlitFramebuffer) {
+        glad_real_glBlitFramebuffer = glad_glBlitFramebuffer;
+        glad_glBlitFramebuffer = glad_instrument_glBlitFramebuffer;
+    }
+    if(glad_glRenderbufferStorageMultisample != NULL && glad_glRenderbufferStorageMultisample != glad_instrument_glRenderbufferStorageMultisample) {
+        glad_real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+        glad_glRenderbufferStorageMultisample = glad_instrument_glRenderbufferStorageMultisample;
+    }
+    if(glad_glFramebufferTextureLayer != NULL && glad_glFramebufferTextureLayer != glad_instrument_glFramebufferTextureLayer) {
+        glad_real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+        glad_glFramebufferTextureLayer = glad_instrument_glFramebufferTextureLayer;
+    }
+    if(glad_glMapBufferRange != NULL && glad_glMapBufferRange != glad_instrument_glMapBufferRange) {
+        glad_real_glMapBufferRange = glad_glMapBufferRange;
+        glad_glMapBufferRange = glad_instrument_glMapBufferRange;
+    }
+    if(glad_glFlushMappedBufferRange != NULL && glad_glFlushMappedBufferRange != glad_instrument_glFlushMappedBufferRange) {
+        glad_real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+        glad_glFlushMappedBufferRange = glad_instrument_glFlushMappedBufferRange;
+    }
+    if(glad_glBindVertexArray != NULL && glad_glBindVertexArray != glad_instrument_glBindVertexArray) {
+        glad_real_glBindVertexArray = glad_glBindVertexArray;
+        glad_glBindVertexArray = glad_instrument_glBindVertexArray;
+    }
+    if(glad_glDeleteVertexArrays != NULL && glad_glDeleteVertexArrays != glad_instrument_glDeleteVertexArrays) {
+        glad_real_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+        glad_glDeleteVertexArrays = glad_instrument_glDeleteVertexArrays;
+    }
+    if(glad_glGenVertexArrays != NULL && glad_glGenVertexArrays != glad_instrument_glGenVertexArrays) {
+        glad_real_glGenVertexArrays = glad_glGenVertexArrays;
+        glad_glGenVertexArrays = glad_instrument_glGenVertexArrays;
+    }
+    if(glad_glIsVertexArray != NULL && glad_glIsVertexArray != glad_instrument_glIsVertexArray) {
+        glad_real_glIsVertexArray = glad_glIsVertexArray;
+        glad_glIsVertexArray = glad_instrument_glIsVertexArray;
+    }
+    if(glad_glDrawArraysInstanced != NULL && glad_glDrawArraysInstanced != glad_instrument_glDrawArraysInstanced) {
+        glad_real_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+        glad_glDrawArraysInstanced = glad_instrument_glDrawArraysInstanced;
+    }
+    if(glad_glDrawElementsInstanced != NULL && glad_glDrawElementsInstanced != glad_instrument_glDrawElementsInstanced) {
+        glad_real_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+        glad_glDrawElementsInstanced = glad_instrument_glDrawElementsInstanced;
+    }
+    if(glad_glTexBuffer != NULL && glad_glTexBuffer != glad_instrument_glTexBuffer) {
+        glad_real_glTexBuffer = glad_glTexBuffer;
+        glad_glTexBuffer = glad_instrument_glTexBuffer;
+    }
+    if(glad_glPrimitiveRestartIndex != NULL && glad_glPrimitiveRestartIndex != glad_instrument_glPrimitiveRestartIndex) {
+        glad_real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+        glad_glPrimitiveRestartIndex = glad_instrument_glPrimitiveRestartIndex;
+    }
+    if(glad_glCopyBufferSubData != NULL && glad_glCopyBufferSubData != glad_instrument_glCopyBufferSubData) {
+        glad_real_glCopyBufferSubData = glad_glCopyBufferSubData;
+        glad_glCopyBufferSubData = glad_instrument_glCopyBufferSubData;
+    }
+    if(glad_glGetUniformIndices != NULL && glad_glGetUniformIndices != glad_instrument_glGetUniformIndices) {
+        glad_real_glGetUniformIndices = glad_glGetUniformIndices;
+        glad_glGetUniformIndices = glad_instrument_glGetUniformIndices;
+    }
+    if(glad_glGetActiveUniformsiv != NULL && glad_glGetActiveUniformsiv != glad_instrument_glGetActiveUniformsiv) {
+        glad_real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+        glad_glGetActiveUniformsiv = glad_instrument_glGetActiveUniformsiv;
+    }
+    if(glad_glGetActiveUniformName != NULL && glad_glGetActiveUniformName != glad_instrument_glGetActiveUniformName) {
+        glad_real_glGetActiveUniformName = glad_glGetActiveUniformName;
+        glad_glGetActiveUniformName = glad_instrument_glGetActiveUniformName;
+    }
+    if(glad_glGetUniformBlockIndex != NULL && glad_glGetUniformBlockIndex != glad_instrument_glGetUniformBlockIndex) {
+        glad_real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+        glad_glGetUniformBlockIndex = glad_instrument_glGetUniformBlockIndex;
+    }
+    if(glad_glGetActiveUniformBlockiv != NULL && glad_glGetActiveUniformBlockiv != glad_instrument_glGetActiveUniformBlockiv) {
+        glad_real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+        glad_glGetActiveUniformBlockiv = glad_instrument_glGetActiveUniformBlockiv;
+    }
+    if(glad_glGetActiveUniformBlockName != NULL && glad_glGetActiveUniformBlockName != glad_instrument_glGetActiveUniformBlockName) {
+        glad_real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+        glad_glGetActiveUniformBlockName = glad_instrument_glGetActiveUniformBlockName;
+    }
+    if(glad_glUniformBlockBinding != NULL && glad_glUniformBlockBinding != glad_instrument_glUniformBlockBinding) {
+        glad_real_glUniformBlockBinding = glad_glUniformBlockBinding;
+        glad_glUniformBlockBinding = glad_instrument_glUniformBlockBinding;
+    }
+    if(glad_glDrawElementsBaseVertex != NULL && glad_glDrawElementsBaseVertex != glad_instrument_glDrawElementsBaseVertex) {
+        glad_real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+        glad_glDrawElementsBaseVertex = glad_instrument_glDrawElementsBaseVertex;
+    }
+    if(glad_glDrawRangeElementsBaseVertex != NULL && glad_glDrawRangeElementsBaseVertex != glad_instrument_glDrawRangeElementsBaseVertex) {
+        glad_real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+        glad_glDrawRangeElementsBaseVertex = glad_instrument_glDrawRangeElementsBaseVertex;
+    }
+    if(glad_glDrawElementsInstancedBaseVertex != NULL && glad_glDrawElementsInstancedBaseVertex != glad_instrument_glDrawElementsInstancedBaseVertex) {
+        glad_real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+        glad_glDrawElementsInstancedBaseVertex = glad_instrument_glDrawElementsInstancedBaseVertex;
+    }
+    if(glad_glMultiDrawElementsBaseVertex != NULL && glad_glMultiDrawElementsBaseVertex != glad_instrument_glMultiDrawElementsBaseVertex) {
+        glad_real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+        glad_glMultiDrawElementsBaseVertex = glad_instrument_glMultiDrawElementsBaseVertex;
+    }
+    if(glad_glProvokingVertex != NULL && glad_glProvokingVertex != glad_instrument_glProvokingVertex) {
+        glad_real_glProvokingVertex = glad_glProvokingVertex;
+        glad_glProvokingVertex = glad_instrument_glProvokingVertex;
+    }
+    if(glad_glFenceSync != NULL && glad_glFenceSync != glad_instrument_glFenceSync) {
+        glad_real_glFenceSync = glad_glFenceSync;
+        glad_glFenceSync = glad_instrument_glFenceSync;
+    }
+    if(glad_glIsSync != NULL && glad_glIsSync != glad_instrument_glIsSync) {
+        glad_real_glIsSync = glad_glIsSync;
+        glad_glIsSync = glad_instrument_glIsSync;
+    }
+    if(glad_glDeleteSync != NULL && glad_glDeleteSync != glad_instrument_glDeleteSync) {
+        glad_real_glDeleteSync = glad_glDeleteSync;
+        glad_glDeleteSync = glad_instrument_glDeleteSync;
+    }
+    if(glad_glClientWaitSync != NULL && glad_glClientWaitSync != glad_instrument_glClientWaitSync) {
+        glad_real_glClientWaitSync = glad_glClientWaitSync;
+        glad_glClientWaitSync = glad_instrument_glClientWaitSync;
+    }
+    if(glad_glWaitSync != NULL && glad_glWaitSync != glad_instrument_glWaitSync) {
+        glad_real_glWaitSync = glad_glWaitSync;
+        glad_glWaitSync = glad_instrument_glWaitSync;
+    }
+    if(glad_glGetInteger64v != NULL && glad_glGetInteger64v != glad_instrument_glGetInteger64v) {
+        glad_real_glGetInteger64v = glad_glGetInteger64v;
+        glad_glGetInteger64v = glad_instrument_glGetInteger64v;
+    }
+    if(glad_glGetSynciv != NULL && glad_glGetSynciv != glad_instrument_glGetSynciv) {
+        glad_real_glGetSynciv = glad_glGetSynciv;
+        glad_glGetSynciv = glad_instrument_glGetSynciv;
+    }
+    if(glad_glGetInteger64i_v != NULL && glad_glGetInteger64i_v != glad_instrument_glGetInteger64i_v) {
+        glad_real_glGetInteger64i_v = glad_glGetInteger64i_v;
+        glad_glGetInteger64i_v = glad_instrument_glGetInteger64i_v;
+    }
+    if(glad_glGetBufferParameteri64v != NULL && glad_glGetBufferParameteri64v != glad_instrument_glGetBufferParameteri64v) {
+        glad_real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+        glad_glGetBufferParameteri64v = glad_instrument_glGetBufferParameteri64v;
+    }
+    if(glad_glFramebufferTexture != NULL && glad_glFramebufferTexture != glad_instrument_glFramebufferTexture) {
+        glad_real_glFramebufferTexture = glad_glFramebufferTexture;
+        glad_glFramebufferTexture = glad_instrument_glFramebufferTexture;
+    }
+    if(glad_glTexImage2DMultisample != NULL && glad_glTexImage2DMultisample != glad_instrument_glTexImage2DMultisample) {
+        glad_real_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+        glad_glTexImage2DMultisample = glad_instrument_glTexImage2DMultisample;
+    }
+    if(glad_glTexImage3DMultisample != NULL && glad_glTexImage3DMultisample != glad_instrument_glTexImage3DMultisample) {
+        glad_real_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+        glad_glTexImage3DMultisample = glad_instrument_glTexImage3DMultisample;
+    }
+    if(glad_glGetMultisamplefv != NULL && glad_glGetMultisamplefv != glad_instrument_glGetMultisamplefv) {
+        glad_real_glGetMultisamplefv = glad_glGetMultisamplefv;
+        glad_glGetMultisamplefv = glad_instrument_glGetMultisamplefv;
+    }
+    if(glad_glSampleMaski != NULL && glad_glSampleMaski != glad_instrument_glSampleMaski) {
+        glad_real_glSampleMaski = glad_glSampleMaski;
+        glad_glSampleMaski = glad_instrument_glSampleMaski;
+    }
+    if(glad_glBindFragDataLocationIndexed != NULL && glad_glBindFragDataLocationIndexed != glad_instrument_glBindFragDataLocationIndexed) {
+        glad_real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+        glad_glBindFragDataLocationIndexed = glad_instrument_glBindFragDataLocationIndexed;
+    }
+    if(glad_glGetFragDataIndex != NULL && glad_glGetFragDataIndex != glad_instrument_glGetFragDataIndex) {
+        glad_real_glGetFragDataIndex = glad_glGetFragDataIndex;
+        glad_glGetFragDataIndex = glad_instrument_glGetFragDataIndex;
+    }
+    if(glad_glGenSamplers != NULL && glad_glGenSamplers != glad_instrument_glGenSamplers) {
+        glad_real_glGenSamplers = glad_glGenSamplers;
+        glad_glGenSamplers = glad_instrument_glGenSamplers;
+    }
+    if(glad_glDeleteSamplers != NULL && glad_glDeleteSamplers != glad_instrument_glDeleteSamplers) {
+        glad_real_glDeleteSamplers = glad_glDeleteSamplers;
+        glad_glDeleteSamplers = glad_instrument_glDeleteSamplers;
+    }
+    if(glad_glIsSampler != NULL && glad_glIsSampler != glad_instrument_glIsSampler) {
+        glad_real_glIsSampler = glad_glIsSampler;
+        glad_glIsSampler = glad_instrument_glIsSampler;
+    }
+    if(glad_glBindSampler != NULL && glad_glBindSampler != glad_instrument_glBindSampler) {
+        glad_real_glBindSampler = glad_glBindSampler;
+        glad_glBindSampler = glad_instrument_glBindSampler;
+    }
+    if(glad_glSamplerParameteri != NULL && glad_glSamplerParameteri != glad_instrument_glSamplerParameteri) {
+        glad_real_glSamplerParameteri = glad_glSamplerParameteri;
+        glad_glSamplerParameteri = glad_instrument_glSamplerParameteri;
+    }
+    if(glad_glSamplerParameteriv != NULL && glad_glSamplerParameteriv != glad_instrument_glSamplerParameteriv) {
+        glad_real_glSamplerParameteriv = glad_glSamplerParameteriv;
+        glad_glSamplerParameteriv = glad_instrument_glSamplerParameteriv;
+    }
+    if(glad_glSamplerParameterf != NULL && glad_glSamplerParameterf != glad_instrument_glSamplerParameterf) {
+        glad_real_glSamplerParameterf = glad_glSamplerParameterf;
+        glad_glSamplerParameterf = glad_instrument_glSamplerParameterf;
+    }
+    if(glad_glSamplerParameterfv != NULL && glad_glSamplerParameterfv != glad_instrument_glSamplerParameterfv) {
+        glad_real_glSamplerParameterfv = glad_glSamplerParameterfv;
+        glad_glSamplerParameterfv = glad_instrument_glSamplerParameterfv;
+    }
+    if(glad_glSamplerParameterIiv != NULL && glad_glSamplerParameterIiv != glad_instrument_glSamplerParameterIiv) {
+        glad_real_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+        glad_glSamplerParameterIiv = glad_instrument_glSamplerParameterIiv;
+    }
+    if(glad_glSamplerParameterIuiv != NULL && glad_glSamplerParameterIuiv != glad_instrument_glSamplerParameterIuiv) {
+        glad_real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+        glad_glSamplerParameterIuiv = glad_instrument_glSamplerParameterIuiv;
+    }
+    if(glad_glGetSamplerParameteriv != NULL && glad_glGetSamplerParameteriv != glad_instrument_glGetSamplerParameteriv) {
+        glad_real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+        glad_glGetSamplerParameteriv = glad_instrument_glGetSamplerParameteriv;
+    }
+    if(glad_glGetSamplerParameterIiv != NULL && glad_glGetSamplerParameterIiv != glad_instrument_glGetSamplerParameterIiv) {
+        glad_real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+        glad_glGetSamplerParameterIiv = glad_instrument_glGetSamplerParameterIiv;
+    }
+    if(glad_glGetSamplerParameterfv != NULL && glad_glGetSamplerParameterfv != glad_instrument_glGetSamplerParameterfv) {
+        glad_real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+        glad_glGetSamplerParameterfv = glad_instrument_glGetSamplerParameterfv;
+    }
+    if(glad_glGetSamplerParameterIuiv != NULL && glad_glGetSamplerParameterIuiv != glad_instrument_glGetSamplerParameterIuiv) {
+        glad_real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+        glad_glGetSamplerParameterIuiv = glad_instrument_glGetSamplerParameterIuiv;
+    }
+    if(glad_glQueryCounter != NULL && glad_glQueryCounter != glad_instrument_glQueryCounter) {
+        glad_real_glQueryCounter = glad_glQueryCounter;
+        glad_glQueryCounter = glad_instrument_glQueryCounter;
+    }
+    if(glad_glGetQueryObjecti64v != NULL && glad_glGetQueryObjecti64v != glad_instrument_glGetQueryObjecti64v) {
+        glad_real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+        glad_glGetQueryObjecti64v = glad_instrument_glGetQueryObjecti64v;
+    }
+    if(glad_glGetQueryObjectui64v != NULL && glad_glGetQueryObjectui64v != glad_instrument_glGetQueryObjectui64v) {
+        glad_real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+        glad_glGetQueryObjectui64v = glad_instrument_glGetQueryObjectui64v;
+    }
+    if(glad_glVertexAttribDivisor != NULL && glad_glVertexAttribDivisor != glad_instrument_glVertexAttribDivisor) {
+        glad_real_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+        glad_glVertexAttribDivisor = glad_instrument_glVertexAttribDivisor;
+    }
+    if(glad_glVertexAttribP1ui != NULL && glad_glVertexAttribP1ui != glad_instrument_glVertexAttribP1ui) {
+        glad_real_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+        glad_glVertexAttribP1ui = glad_instrument_glVertexAttribP1ui;
+    }
+    if(glad_glVertexAttribP1uiv != NULL && glad_glVertexAttribP1uiv != glad_instrument_glVertexAttribP1uiv) {
+        glad_real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+        glad_glVertexAttribP1uiv = glad_instrument_glVertexAttribP1uiv;
+    }
+    if(glad_glVertexAttribP2ui != NULL && glad_glVertexAttribP2ui != glad_instrument_glVertexAttribP2ui) {
+        glad_real_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+        glad_glVertexAttribP2ui = glad_instrument_glVertexAttribP2ui;
+    }
+    if(glad_glVertexAttribP2uiv != NULL && glad_glVertexAttribP2uiv != glad_instrument_glVertexAttribP2uiv) {
+        glad_real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+        glad_glVertexAttribP2uiv = glad_instrument_glVertexAttribP2uiv;
+    }
+    if(glad_glVertexAttribP3ui != NULL && glad_glVertexAttribP3ui != glad_instrument_glVertexAttribP3ui) {
+        glad_real_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+        glad_glVertexAttribP3ui = glad_instrument_glVertexAttribP3ui;
+    }
+    if(glad_glVertexAttribP3uiv != NULL && glad_glVertexAttribP3uiv != glad_instrument_glVertexAttribP3uiv) {
+        glad_real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+        glad_glVertexAttribP3uiv = glad_instrument_glVertexAttribP3uiv;
+    }
+    if(glad_glVertexAttribP4ui != NULL && glad_glVertexAttribP4ui != glad_instrument_glVertexAttribP4ui) {
+        glad_real_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+        glad_glVertexAttribP4ui = glad_instrument_glVertexAttribP4ui;
+    }
+    if(glad_glVertexAttribP4uiv != NULL && glad_glVertexAttribP4uiv != glad_instrument_glVertexAttribP4uiv) {
+        glad_real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+        glad_glVertexAttribP4uiv = glad_instrument_glVertexAttribP4uiv;
+    }
+    if(glad_glVertexP2ui != NULL && glad_glVertexP2ui != glad_instrument_glVertexP2ui) {
+        glad_real_glVertexP2ui = glad_glVertexP2ui;
+        glad_glVertexP2ui = glad_instrument_glVertexP2ui;
+    }
+    if(glad_glVertexP2uiv != NULL && glad_glVertexP2uiv != glad_instrument_glVertexP2uiv) {
+        glad_real_glVertexP2uiv = glad_glVertexP2uiv;
+        glad_glVertexP2uiv = glad_instrument_glVertexP2uiv;
+    }
+    if(glad_glVertexP3ui != NULL && glad_glVertexP3ui != glad_instrument_glVertexP3ui) {
+        glad_real_glVertexP3ui = glad_glVertexP3ui;
+        glad_glVertexP3ui = glad_instrument_glVertexP3ui;
+    }
+    if(glad_glVertexP3uiv != NULL && glad_glVertexP3uiv != glad_instrument_glVertexP3uiv) {
+        glad_real_glVertexP3uiv = glad_glVertexP3uiv;
+        glad_glVertexP3uiv = glad_instrument_glVertexP3uiv;
+    }
+    if(glad_glVertexP4ui != NULL && glad_glVertexP4ui != glad_instrument_glVertexP4ui) {
+        glad_real_glVertexP4ui = glad_glVertexP4ui;
+        glad_glVertexP4ui = glad_instrument_glVertexP4ui;
+    }
+    if(glad_glVertexP4uiv != NULL && glad_glVertexP4uiv != glad_instrument_glVertexP4uiv) {
+        glad_real_glVertexP4uiv = glad_glVertexP4uiv;
+        glad_glVertexP4uiv = glad_instrument_glVertexP4uiv;
+    }
+    if(glad_glTexCoordP1ui != NULL && glad_glTexCoordP1ui != glad_instrument_glTexCoordP1ui) {
+        glad_real_glTexCoordP1ui = glad_glTexCoordP1ui;
+        glad_glTexCoordP1ui = glad_instrument_glTexCoordP1ui;
+    }
+    if(glad_glTexCoordP1uiv != NULL && glad_glTexCoordP1uiv != glad_instrument_glTexCoordP1uiv) {
+        glad_real_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+        glad_glTexCoordP1uiv = glad_instrument_glTexCoordP1uiv;
+    }
+    if(glad_glTexCoordP2ui != NULL && glad_glTexCoordP2ui != glad_instrument_glTexCoordP2ui) {
+        glad_real_glTexCoordP2ui = glad_glTexCoordP2ui;
+        glad_glTexCoordP2ui = glad_instrument_glTexCoordP2ui;
+    }
+    if(glad_glTexCoordP2uiv != NULL && glad_glTexCoordP2uiv != glad_instrument_glTexCoordP2uiv) {
+        glad_real_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+        glad_glTexCoordP2uiv = glad_instrument_glTexCoordP2uiv;
+    }
+    if(glad_glTexCoordP3ui != NULL && glad_glTexCoordP3ui != glad_instrument_glTexCoordP3ui) {
+        glad_real_glTexCoordP3ui = glad_glTexCoordP3ui;
+        glad_glTexCoordP3ui = glad_instrument_glTexCoordP3ui;
+    }
+    if(glad_glTexCoordP3uiv != NULL && glad_glTexCoordP3uiv != glad_instrument_glTexCoordP3uiv) {
+        glad_real_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+        glad_glTexCoordP3uiv = glad_instrument_glTexCoordP3uiv;
+    }
+    if(glad_glTexCoordP4ui != NULL && glad_glTexCoordP4ui != glad_instrument_glTexCoordP4ui) {
+        glad_real_glTexCoordP4ui = glad_glTexCoordP4ui;
+        glad_glTexCoordP4ui = glad_instrument_glTexCoordP4ui;
+    }
+    if(glad_glTexCoordP4uiv != NULL && glad_glTexCoordP4uiv != glad_instrument_glTexCoordP4uiv) {
+        glad_real_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+        glad_glTexCoordP4uiv = glad_instrument_glTexCoordP4uiv;
+    }
+    if(glad_glMultiTexCoordP1ui != NULL && glad_glMultiTexCoordP1ui != glad_instrument_glMultiTexCoordP1ui) {
+        glad_real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+        glad_glMultiTexCoordP1ui = glad_instrument_glMultiTexCoordP1ui;
+    }
+    if(glad_glMultiTexCoordP1uiv != NULL && glad_glMultiTexCoordP1uiv != glad_instrument_glMultiTexCoordP1uiv) {
+        glad_real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+        glad_glMultiTexCoordP1uiv = glad_instrument_glMultiTexCoordP1uiv;
+    }
+    if(glad_glMultiTexCoordP2ui != NULL && glad_glMultiTexCoordP2ui != glad_instrument_glMultiTexCoordP2ui) {
+        glad_real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+        glad_glMultiTexCoordP2ui = glad_instrument_glMultiTexCoordP2ui;
+    }
+    if(glad_glMultiTexCoordP2uiv != NULL && glad_glMultiTexCoordP2uiv != glad_instrument_glMultiTexCoordP2uiv) {
+        glad_real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+        glad_glMultiTexCoordP2uiv = glad_instrument_glMultiTexCoordP2uiv;
+    }
+    if(glad_glMultiTexCoordP3ui != NULL && glad_glMultiTexCoordP3ui != glad_instrument_glMultiTexCoordP3ui) {
+        glad_real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+        glad_glMultiTexCoordP3ui = glad_instrument_glMultiTexCoordP3ui;
+    }
+    if(glad_glMultiTexCoordP3uiv != NULL && glad_glMultiTexCoordP3uiv != glad_instrument_glMultiTexCoordP3uiv) {
+        glad_real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+        glad_glMultiTexCoordP3uiv = glad_instrument_glMultiTexCoordP3uiv;
+    }
+    if(glad_glMultiTexCoordP4ui != NULL && glad_glMultiTexCoordP4ui != glad_instrument_glMultiTexCoordP4ui) {
+        glad_real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+        glad_glMultiTexCoordP4ui = glad_instrument_glMultiTexCoordP4ui;
+    }
+    if(glad_glMultiTexCoordP4uiv != NULL && glad_glMultiTexCoordP4uiv != glad_instrument_glMultiTexCoordP4uiv) {
+        glad_real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+        glad_glMultiTexCoordP4uiv = glad_instrument_glMultiTexCoordP4uiv;
+    }
+    if(glad_glNormalP3ui != NULL && glad_glNormalP3ui != glad_instrument_glNormalP3ui) {
+        glad_real_glNormalP3ui = glad_glNormalP3ui;
+        glad_glNormalP3ui = glad_instrument_glNormalP3ui;
+    }
+    if(glad_glNormalP3uiv != NULL && glad_glNormalP3uiv != glad_instrument_glNormalP3uiv) {
+        glad_real_glNormalP3uiv = glad_glNormalP3uiv;
+        glad_glNormalP3uiv = glad_instrument_glNormalP3uiv;
+    }
+    if(glad_glColorP3ui != NULL && glad_glColorP3ui != glad_instrument_glColorP3ui) {
+        glad_real_glColorP3ui = glad_glColorP3ui;
+        glad_glColorP3ui = glad_instrument_glColorP3ui;
+    }
+    if(glad_glColorP3uiv != NULL && glad_glColorP3uiv != glad_instrument_glColorP3uiv) {
+        glad_real_glColorP3uiv = glad_glColorP3uiv;
+        glad_glColorP3uiv = glad_instrument_glColorP3uiv;
+    }
+    if(glad_glColorP4ui != NULL && glad_glColorP4ui != glad_instrument_glColorP4ui) {
+        glad_real_glColorP4ui = glad_glColorP4ui;
+        glad_glColorP4ui = glad_instrument_glColorP4ui;
+    }
+    if(glad_glColorP4uiv != NULL && glad_glColorP4uiv != glad_instrument_glColorP4uiv) {
+        glad_real_glColorP4uiv = glad_glColorP4uiv;
+        glad_glColorP4uiv = glad_instrument_glColorP4uiv;
+    }
+    if(glad_glSecondaryColorP3ui != NULL && glad_glSecondaryColorP3ui != glad_instrument_glSecondaryColorP3ui) {
+        glad_real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+        glad_glSecondaryColorP3ui = glad_instrument_glSecondaryColorP3ui;
+    }
+    if(glad_glSecondaryColorP3uiv != NULL && glad_glSecondaryColorP3uiv != glad_instrument_glSecondaryColorP3uiv) {
+        glad_real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+        glad_glSecondaryColorP3uiv = glad_instrument_glSecondaryColorP3uiv;
+    }
+    if(glad_glMinSampleShading != NULL && glad_glMinSampleShading != glad_instrument_glMinSampleShading) {
+        glad_real_glMinSampleShading = glad_glMinSampleShading;
+        glad_glMinSampleShading = glad_instrument_glMinSampleShading;
+    }
+    if(glad_glBlendEquationi != NULL && glad_glBlendEquationi != glad_instrument_glBlendEquationi) {
+        glad_real_glBlendEquationi = glad_glBlendEquationi;
+        glad_glBlendEquationi = glad_instrument_glBlendEquationi;
+    }
+    if(glad_glBlendEquationSeparatei != NULL && glad_glBlendEquationSeparatei != glad_instrument_glBlendEquationSeparatei) {
+        glad_real_glBlendEquationSeparatei = glad_glBlendEquationSeparatei;
+        glad_glBlendEquationSeparatei = glad_instrument_glBlendEquationSeparatei;
+    }
+    if(glad_glBlendFunci != NULL && glad_glBlendFunci != glad_instrument_glBlendFunci) {
+        glad_real_glBlendFunci = glad_glBlendFunci;
+        glad_glBlendFunci = glad_instrument_glBlendFunci;
+    }
+    if(glad_glBlendFuncSeparatei != NULL && glad_glBlendFuncSeparatei != glad_instrument_glBlendFuncSeparatei) {
+        glad_real_glBlendFuncSeparatei = glad_glBlendFuncSeparatei;
+        glad_glBlendFuncSeparatei = glad_instrument_glBlendFuncSeparatei;
+    }
+    if(glad_glDrawArraysIndirect != NULL && glad_glDrawArraysIndirect != glad_instrument_glDrawArraysIndirect) {
+        glad_real_glDrawArraysIndirect = glad_glDrawArraysIndirect;
+        glad_glDrawArraysIndirect = glad_instrument_glDrawArraysIndirect;
+    }
+    if(glad_glDrawElementsIndirect != NULL && glad_glDrawElementsIndirect != glad_instrument_glDrawElementsIndirect) {
+        glad_real_glDrawElementsIndirect = glad_glDrawElementsIndirect;
+        glad_glDrawElementsIndirect = glad_instrument_glDrawElementsIndirect;
+    }
+    if(glad_glUniform1d != NULL && glad_glUniform1d != glad_instrument_glUniform1d) {
+        glad_real_glUniform1d = glad_glUniform1d;
+        glad_glUniform1d = glad_instrument_glUniform1d;
+    }
+    if(glad_glUniform2d != NULL && glad_glUniform2d != glad_instrument_glUniform2d) {
+        glad_real_glUniform2d = glad_glUniform2d;
+        glad_glUniform2d = glad_instrument_glUniform2d;
+    }
+    if(glad_glUniform3d != NULL && glad_glUniform3d != glad_instrument_glUniform3d) {
+        glad_real_glUniform3d = glad_glUniform3d;
+        glad_glUniform3d = glad_instrument_glUniform3d;
+    }
+    if(glad_glUniform4d != NULL && glad_glUniform4d != glad_instrument_glUniform4d) {
+        glad_real_glUniform4d = glad_glUniform4d;
+        glad_glUniform4d = glad_instrument_glUniform4d;
+    }
+    if(glad_glUniform1dv != NULL && glad_glUniform1dv != glad_instrument_glUniform1dv) {
+        glad_real_glUniform1dv = glad_glUniform1dv;
+        glad_glUniform1dv = glad_instrument_glUniform1dv;
+    }
+    if(glad_glUniform2dv != NULL && glad_glUniform2dv != glad_instrument_glUniform2dv) {
+        glad_real_glUniform2dv = glad_glUniform2dv;
+        glad_glUniform2dv = glad_instrument_glUniform2dv;
+    }
+    if(glad_glUniform3dv != NULL && glad_glUniform3dv != glad_instrument_glUniform3dv) {
+        glad_real_glUniform3dv = glad_glUniform3dv;
+        glad_glUniform3dv = glad_instrument_glUniform3dv;
+    }
+    if(glad_glUniform4dv != NULL && glad_glUniform4dv != glad_instrument_glUniform4dv) {
+        glad_real_glUniform4dv = glad_glUniform4dv;
+        glad_glUniform4dv = glad_instrument_glUniform4dv;
+    }
+    if(glad_glUniformMatrix2dv != NULL && glad_glUniformMatrix2dv != glad_instrument_glUniformMatrix2dv) {
+        glad_real_glUniformMatrix2dv = glad_glUniformMatrix2dv;
+        glad_glUniformMatrix2dv = glad_instrument_glUniformMatrix2dv;
+    }
+    if(glad_glUniformMatrix3dv != NULL && glad_glUniformMatrix3dv != glad_instrument_glUniformMatrix3dv) {
+        glad_real_glUniformMatrix3dv = glad_glUniformMatrix3dv;
+        glad_glUniformMatrix3dv = glad_instrument_glUniformMatrix3dv;
+    }
+    if(glad_glUniformMatrix4dv != NULL && glad_glUniformMatrix4dv != glad_instrument_glUniformMatrix4dv) {
+        glad_real_glUniformMatrix4dv = glad_glUniformMatrix4dv;
+        glad_glUniformMatrix4dv = glad_instrument_glUniformMatrix4dv;
+    }
+    if(glad_glUniformMatrix2x3dv != NULL && glad_glUniformMatrix2x3dv != glad_instrument_glUniformMatrix2x3dv) {
+        glad_real_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+        glad_glUniformMatrix2x3dv = glad_instrument_glUniformMatrix2x3dv;
+    }
+    if(glad_glUniformMatrix2x4dv != NULL && glad_glUniformMatrix2x4dv != glad_instrument_glUniformMatrix2x4dv) {
+        glad_real_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+        glad_glUniformMatrix2x4dv = glad_instrument_glUniformMatrix2x4dv;
+    }
+    if(glad_glUniformMatrix3x2dv != NULL && glad_glUniformMatrix3x2dv != glad_instrument_glUniformMatrix3x2dv) {
+        glad_real_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+        glad_glUniformMatrix3x2dv = glad_instrument_glUniformMatrix3x2dv;
+    }
+    if(glad_glUniformMatrix3x4dv != NULL && glad_glUniformMatrix3x4dv != glad_instrument_glUniformMatrix3x4dv) {
+        glad_real_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+        glad_glUniformMatrix3x4dv = glad_instrument_glUniformMatrix3x4dv;
+    }
+    if(glad_glUniformMatrix4x2dv != NULL && glad_glUniformMatrix4x2dv != glad_instrument_glUniformMatrix4x2dv) {
+        glad_real_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+        glad_glUniformMatrix4x2dv = glad_instrument_glUniformMatrix4x2dv;
+    }
+    if(glad_glUniformMatrix4x3dv != NULL && glad_glUniformMatrix4x3dv != glad_instrument_glUniformMatrix4x3dv) {
+        glad_real_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+        glad_glUniformMatrix4x3dv = glad_instrument_glUniformMatrix4x3dv;
+    }
+    if(glad_glGetUniformdv != NULL && glad_glGetUniformdv != glad_instrument_glGetUniformdv) {
+        glad_real_glGetUniformdv = glad_glGetUniformdv;
+        glad_glGetUniformdv = glad_instrument_glGetUniformdv;
+    }
+    if(glad_glGetSubroutineUniformLocation != NULL && glad_glGetSubroutineUniformLocation != glad_instrument_glGetSubroutineUniformLocation) {
+        glad_real_glGetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation;
+        glad_glGetSubroutineUniformLocation = glad_instrument_glGetSubroutineUniformLocation;
+    }
+    if(glad_glGetSubroutineIndex != NULL && glad_glGetSubroutineIndex != glad_instrument_glGetSubroutineIndex) {
+        glad_real_glGetSubroutineIndex = glad_glGetSubroutineIndex;
+        glad_glGetSubroutineIndex = glad_instrument_glGetSubroutineIndex;
+    }
+    if(glad_glGetActiveSubroutineUniformiv != NULL && glad_glGetActiveSubroutineUniformiv != glad_instrument_glGetActiveSubroutineUniformiv) {
+        glad_real_glGetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv;
+        glad_glGetActiveSubroutineUniformiv = glad_instrument_glGetActiveSubroutineUniformiv;
+    }
+    if(glad_glGetActiveSubroutineUniformName != NULL && glad_glGetActiveSubroutineUniformName != glad_instrument_glGetActiveSubroutineUniformName) {
+        glad_real_glGetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName;
+        glad_glGetActiveSubroutineUniformName = glad_instrument_glGetActiveSubroutineUniformName;
+    }
+    if(glad_glGetActiveSubroutineName != NULL && glad_glGetActiveSubroutineName != glad_instrument_glGetActiveSubroutineName) {
+        glad_real_glGetActiveSubroutineName = glad_glGetActiveSubroutineName;
+        glad_glGetActiveSubroutineName = glad_instrument_glGetActiveSubroutineName;
+    }
+    if(glad_glUniformSubroutinesuiv != NULL && glad_glUniformSubroutinesuiv != glad_instrument_glUniformSubroutinesuiv) {
+        glad_real_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+        glad_glUniformSubroutinesuiv = glad_instrument_glUniformSubroutinesuiv;
+    }
+    if(glad_glGetUniformSubroutineuiv != NULL && glad_glGetUniformSubroutineuiv != glad_instrument_glGetUniformSubroutineuiv) {
+        glad_real_glGetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv;
+        glad_glGetUniformSubroutineuiv = glad_instrument_glGetUniformSubroutineuiv;
+    }
+    if(glad_glGetProgramStageiv != NULL && glad_glGetProgramStageiv != glad_instrument_glGetProgramStageiv) {
+        glad_real_glGetProgramStageiv = glad_glGetProgramStageiv;
+        glad_glGetProgramStageiv = glad_instrument_glGetProgramStageiv;
+    }
+    if(glad_glPatchParameteri != NULL && glad_glPatchParameteri != glad_instrument_glPatchParameteri) {
+        glad_real_glPatchParameteri = glad_glPatchParameteri;
+        glad_glPatchParameteri = glad_instrument_glPatchParameteri;
+    }
+    if(glad_glPatchParameterfv != NULL && glad_glPatchParameterfv != glad_instrument_glPatchParameterfv) {
+        glad_real_glPatchParameterfv = glad_glPatchParameterfv;
+        glad_glPatchParameterfv = glad_instrument_glPatchParameterfv;
+    }
+    if(glad_glBindTransformFeedback != NULL && glad_glBindTransformFeedback != glad_instrument_glBindTransformFeedback) {
+        glad_real_glBindTransformFeedback = glad_glBindTransformFeedback;
+        glad_glBindTransformFeedback = glad_instrument_glBindTransformFeedback;
+    }
+    if(glad_glDeleteTransformFeedbacks != NULL && glad_glDeleteTransformFeedbacks != glad_instrument_glDeleteTransformFeedbacks) {
+        glad_real_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+        glad_glDeleteTransformFeedbacks = glad_instrument_glDeleteTransformFeedbacks;
+    }
+    if(glad_glGenTransformFeedbacks != NULL && glad_glGenTransformFeedbacks != glad_instrument_glGenTransformFeedbacks) {
+        glad_real_glGenTransformFeedbacks = glad_glGenTransformFeedbacks;
+        glad_glGenTransformFeedbacks = glad_instrument_glGenTransformFeedbacks;
+    }
+    if(glad_glIsTransformFeedback != NULL && glad_glIsTransformFeedback != glad_instrument_glIsTransformFeedback) {
+        glad_real_glIsTransformFeedback = glad_glIsTransformFeedback;
+        glad_glIsTransformFeedback = glad_instrument_glIsTransformFeedback;
+    }
+    if(glad_glPauseTransformFeedback != NULL && glad_glPauseTransformFeedback != glad_instrument_glPauseTransformFeedback) {
+        glad_real_glPauseTransformFeedback = glad_glPauseTransformFeedback;
+        glad_glPauseTransformFeedback = glad_instrument_glPauseTransformFeedback;
+    }
+    if(glad_glResumeTransformFeedback != NULL && glad_glResumeTransformFeedback != glad_instrument_glResumeTransformFeedback) {
+        glad_real_glResumeTransformFeedback = glad_glResumeTransformFeedback;
+        glad_glResumeTransformFeedback = glad_instrument_glResumeTransformFeedback;
+    }
+    if(glad_glDrawTransformFeedback != NULL && glad_glDrawTransformFeedback != glad_instrument_glDrawTransformFeedback) {
+        glad_real_glDrawTransformFeedback = glad_glDrawTransformFeedback;
+        glad_glDrawTransformFeedback = glad_instrument_glDrawTransformFeedback;
+    }
+    if(glad_glDrawTransformFeedbackStream != NULL && glad_glDrawTransformFeedbackStream != glad_instrument_glDrawTransformFeedbackStream) {
+        glad_real_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+        glad_glDrawTransformFeedbackStream = glad_instrument_glDrawTransformFeedbackStream;
+    }
+    if(glad_glBeginQueryIndexed != NULL && glad_glBeginQueryIndexed != glad_instrument_glBeginQueryIndexed) {
+        glad_real_glBeginQueryIndexed = glad_glBeginQueryIndexed;
+        glad_glBeginQueryIndexed = glad_instrument_glBeginQueryIndexed;
+    }
+    if(glad_glEndQueryIndexed != NULL && glad_glEndQueryIndexed != glad_instrument_glEndQueryIndexed) {
+        glad_real_glEndQueryIndexed = glad_glEndQueryIndexed;
+        glad_glEndQueryIndexed = glad_instrument_glEndQueryIndexed;
+    }
+    if(glad_glGetQueryIndexediv != NULL && glad_glGetQueryIndexediv != glad_instrument_glGetQueryIndexediv) {
+        glad_real_glGetQueryIndexediv = glad_glGetQueryIndexediv;
+        glad_glGetQueryIndexediv = glad_instrument_glGetQueryIndexediv;
+    }
+    if(glad_glReleaseShaderCompiler != NULL && glad_glReleaseShaderCompiler != glad_instrument_glReleaseShaderCompiler) {
+        glad_real_glReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+        glad_glReleaseShaderCompiler = glad_instrument_glReleaseShaderCompiler;
+    }
+    if(glad_glShaderBinary != NULL && glad_glShaderBinary != glad_instrument_glShaderBinary) {
+        glad_real_glShaderBinary = glad_glShaderBinary;
+        glad_glShaderBinary = glad_instrument_glShaderBinary;
+    }
+    if(glad_glGetShaderPrecisionFormat != NULL && glad_glGetShaderPrecisionFormat != glad_instrument_glGetShaderPrecisionFormat) {
+        glad_real_glGetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+        glad_glGetShaderPrecisionFormat = glad_instrument_glGetShaderPrecisionFormat;
+    }
+    if(glad_glDepthRangef != NULL && glad_glDepthRangef != glad_instrument_glDepthRangef) {
+        glad_real_glDepthRangef = glad_glDepthRangef;
+        glad_glDepthRangef = glad_instrument_glDepthRangef;
+    }
+    if(glad_glClearDepthf != NULL && glad_glClearDepthf != glad_instrument_glClearDepthf) {
+        glad_real_glClearDepthf = glad_glClearDepthf;
+        glad_glClearDepthf = glad_instrument_glClearDepthf;
+    }
+    if(glad_glGetProgramBinary != NULL && glad_glGetProgramBinary != glad_instrument_glGetProgramBinary) {
+        glad_real_glGetProgramBinary = glad_glGetProgramBinary;
+        glad_glGetProgramBinary = glad_instrument_glGetProgramBinary;
+    }
+    if(glad_glProgramBinary != NULL && glad_glProgramBinary != glad_instrument_glProgramBinary) {
+        glad_real_glProgramBinary = glad_glProgramBinary;
+        glad_glProgramBinary = glad_instrument_glProgramBinary;
+    }
+    if(glad_glProgramParameteri != NULL && glad_glProgramParameteri != glad_instrument_glProgramParameteri) {
+        glad_real_glProgramParameteri = glad_glProgramParameteri;
+        glad_glProgramParameteri = glad_instrument_glProgramParameteri;
+    }
+    if(glad_glUseProgramStages != NULL && glad_glUseProgramStages != glad_instrument_glUseProgramStages) {
+        glad_real_glUseProgramStages = glad_glUseProgramStages;
+        glad_glUseProgramStages = glad_instrument_glUseProgramStages;
+    }
+    if(glad_glActiveShaderProgram != NULL && glad_glActiveShaderProgram != glad_instrument_glActiveShaderProgram) {
+        glad_real_glActiveShaderProgram = glad_glActiveShaderProgram;
+        glad_glActiveShaderProgram = glad_instrument_glActiveShaderProgram;
+    }
+    if(glad_glCreateShaderProgramv != NULL && glad_glCreateShaderProgramv != glad_instrument_glCreateShaderProgramv) {
+        glad_real_glCreateShaderProgramv = glad_glCreateShaderProgramv;
+        glad_glCreateShaderProgramv = glad_instrument_glCreateShaderProgramv;
+    }
+    if(glad_glBindProgramPipeline != NULL && glad_glBindProgramPipeline != glad_instrument_glBindProgramPipeline) {
+        glad_real_glBindProgramPipeline = glad_glBindProgramPipeline;
+        glad_glBindProgramPipeline = glad_instrument_glBindProgramPipeline;
+    }
+    if(glad_glDeleteProgramPipelines != NULL && glad_glDeleteProgramPipelines != glad_instrument_glDeleteProgramPipelines) {
+        glad_real_glDeleteProgramPipelines = glad_glDeleteProgramPipelines;
+        glad_glDeleteProgramPipelines = glad_instrument_glDeleteProgramPipelines;
+    }
+    if(glad_glGenProgramPipelines != NULL && glad_glGenProgramPipelines != glad_instrument_glGenProgramPipelines) {
+        glad_real_glGenProgramPipelines = glad_glGenProgramPipelines;
+        glad_glGenProgramPipelines = glad_instrument_glGenProgramPipelines;
+    }
+    if(glad_glIsProgramPipeline != NULL && glad_glIsProgramPipeline != glad_instrument_glIsProgramPipeline) {
+        glad_real_glIsProgramPipeline = glad_glIsProgramPipeline;
+        glad_glIsProgramPipeline = glad_instrument_glIsProgramPipeline;
+    }
+    if(glad_glGetProgramPipelineiv != NULL && glad_glGetProgramPipelineiv != glad_instrument_glGetProgramPipelineiv) {
+        glad_real_glGetProgramPipelineiv = glad_glGetProgramPipelineiv;
+        glad_glGetProgramPipelineiv = glad_instrument_glGetProgramPipelineiv;
+    }
+    if(glad_glProgramUniform1i != NULL && glad_glProgramUniform1i != glad_instrument_glProgramUniform1i) {
+        glad_real_glProgramUniform1i = glad_glProgramUniform1i;
+        glad_glProgramUniform1i = glad_instrument_glProgramUniform1i;
+    }
+    if(glad_glProgramUniform1iv != NULL && glad_glProgramUniform1iv != glad_instrument_glProgramUniform1iv) {
+        glad_real_glProgramUniform1iv = glad_glProgramUniform1iv;
+        glad_glProgramUniform1iv = glad_instrument_glProgramUniform1iv;
+    }
+    if(glad_glProgramUniform1f != NULL && glad_glProgramUniform1f != glad_instrument_glProgramUniform1f) {
+        glad_real_glProgramUniform1f = glad_glProgramUniform1f;
+        glad_glProgramUniform1f = glad_instrument_glProgramUniform1f;
+    }
+    if(glad_glProgramUniform1fv != NULL && glad_glProgramUniform1fv != glad_instrument_glProgramUniform1fv) {
+        glad_real_glProgramUniform1fv = glad_glProgramUniform1fv;
+        glad_glProgramUniform1fv = glad_instrument_glProgramUniform1fv;
+    }
+    if(glad_glProgramUniform1d != NULL && glad_glProgramUniform1d != glad_instrument_glProgramUniform1d) {
+        glad_real_glProgramUniform1d = glad_glProgramUniform1d;
+        glad_glProgramUniform1d = glad_instrument_glProgramUniform1d;
+    }
+    if(glad_glProgramUniform1dv != NULL && glad_glProgramUniform1dv != glad_instrument_glProgramUniform1dv) {
+        glad_real_glProgramUniform1dv = glad_glProgramUniform1dv;
+        glad_glProgramUniform1dv = glad_instrument_glProgramUniform1dv;
+    }
+    if(glad_glProgramUniform1ui != NULL && glad_glProgramUniform1ui != glad_instrument_glProgramUniform1ui) {
+        glad_real_glProgramUniform1ui = glad_glProgramUniform1ui;
+        glad_glProgramUniform1ui = glad_instrument_glProgramUniform1ui;
+    }
+    if(glad_glProgramUniform1uiv != NULL && glad_glProgramUniform1uiv != glad_instrument_glProgramUniform1uiv) {
+        glad_real_glProgramUniform1uiv = glad_glProgramUniform1uiv;
+        glad_glProgramUniform1uiv = glad_instrument_glProgramUniform1uiv;
+    }
+    if(glad_glProgramUniform2i != NULL && glad_glProgramUniform2i != glad_instrument_glProgramUniform2i) {
+        glad_real_glProgramUniform2i = glad_glProgramUniform2i;
+        glad_glProgramUniform2i = glad_instrument_glProgramUniform2i;
+    }
+    if(glad_glProgramUniform2iv != NULL && glad_glProgramUniform2iv != glad_instrument_glProgramUniform2iv) {
+        glad_real_glProgramUniform2iv = glad_glProgramUniform2iv;
+        glad_glProgramUniform2iv = glad_instrument_glProgramUniform2iv;
+    }
+    if(glad_glProgramUniform2f != NULL && glad_glProgramUniform2f != glad_instrument_glProgramUniform2f) {
+        glad_real_glProgramUniform2f = glad_glProgramUniform2f;
+        glad_glProgramUniform2f = glad_instrument_glProgramUniform2f;
+    }
+    if(glad_glProgramUniform2fv != NULL && glad_glProgramUniform2fv != glad_instrument_glProgramUniform2fv) {
+        glad_real_glProgramUniform2fv = glad_glProgramUniform2fv;
+        glad_glProgramUniform2fv = glad_instrument_glProgramUniform2fv;
+    }
+    if(glad_glProgramUniform2d != NULL && glad_glProgramUniform2d != glad_instrument_glProgramUniform2d) {
+        glad_real_glProgramUniform2d = glad_glProgramUniform2d;
+        glad_glProgramUniform2d = glad_instrument_glProgramUniform2d;
+    }
+    if(glad_glProgramUniform2dv != NULL && glad_glProgramUniform2dv != glad_instrument_glProgramUniform2dv) {
+        glad_real_glProgramUniform2dv = glad_glProgramUniform2dv;
+        glad_glProgramUniform2dv = glad_instrument_glProgramUniform2dv;
+    }
+    if(glad_glProgramUniform2ui != NULL && glad_glProgramUniform2ui != glad_instrument_glProgramUniform2ui) {
+        glad_real_glProgramUniform2ui = glad_glProgramUniform2ui;
+        glad_glProgramUniform2ui = glad_instrument_glProgramUniform2ui;
+    }
+    if(glad_glProgramUniform2uiv != NULL && glad_glProgramUniform2uiv != glad_instrument_glProgramUniform2uiv) {
+        glad_real_glProgramUniform2uiv = glad_glProgramUniform2uiv;
+        glad_glProgramUniform2uiv = glad_instrument_glProgramUniform2uiv;
+    }
+    if(glad_glProgramUniform3i != NULL && glad_glProgramUniform3i != glad_instrument_glProgramUniform3i) {
+        glad_real_glProgramUniform3i = glad_glProgramUniform3i;
+        glad_glProgramUniform3i = glad_instrument_glProgramUniform3i;
+    }
+    if(glad_glProgramUniform3iv != NULL && glad_glProgramUniform3iv != glad_instrument_glProgramUniform3iv) {
+        glad_real_glProgramUniform3iv = glad_glProgramUniform3iv;
+        glad_glProgramUniform3iv = glad_instrument_glProgramUniform3iv;
+    }
+    if(glad_glProgramUniform3f != NULL && glad_glProgramUniform3f != glad_instrument_glProgramUniform3f) {
+        glad_real_glProgramUniform3f = glad_glProgramUniform3f;
+        glad_glProgramUniform3f = glad_instrument_glProgramUniform3f;
+    }
+    if(glad_glProgramUniform3fv != NULL && glad_glProgramUniform3fv != glad_instrument_glProgramUniform3fv) {
+        glad_real_glProgramUniform3fv = glad_glProgramUniform3fv;
+        glad_glProgramUniform3fv = glad_instrument_glProgramUniform3fv;
+    }
+    if(glad_glProgramUniform3d != NULL && glad_glProgramUniform3d != glad_instrument_glProgramUniform3d) {
+        glad_real_glProgramUniform3d = glad_glProgramUniform3d;
+        glad_glProgramUniform3d = glad_instrument_glProgramUniform3d;
+    }
+    if(glad_glProgramUniform3dv != NULL && glad_glProgramUniform3dv != glad_instrument_glProgramUniform3dv) {
+        glad_real_glProgramUniform3dv = glad_glProgramUniform3dv;
+        glad_glProgramUniform3dv = glad_instrument_glProgramUniform3dv;
+    }
+    if(glad_glProgramUniform3ui != NULL && glad_glProgramUniform3ui != glad_instrument_glProgramUniform3ui) {
+        glad_real_glProgramUniform3ui = glad_glProgramUniform3ui;
+        glad_glProgramUniform3ui = glad_instrument_glProgramUniform3ui;
+    }
+    if(glad_glProgramUniform3uiv != NULL && glad_glProgramUniform3uiv != glad_instrument_glProgramUniform3uiv) {
+        glad_real_glProgramUniform3uiv = glad_glProgramUniform3uiv;
+        glad_glProgramUniform3uiv = glad_instrument_glProgramUniform3uiv;
+    }
+    if(glad_glProgramUniform4i != NULL && glad_glProgramUniform4i != glad_instrument_glProgramUniform4i) {
+        glad_real_glProgramUniform4i = glad_glProgramUniform4i;
+        glad_glProgramUniform4i = glad_instrument_glProgramUniform4i;
+    }
+    if(glad_glProgramUniform4iv != NULL && glad_glProgramUniform4iv != glad_instrument_glProgramUniform4iv) {
+        glad_real_glProgramUniform4iv = glad_glProgramUniform4iv;
+        glad_glProgramUniform4iv = glad_instrument_glProgramUniform4iv;
+    }
+    if(glad_glProgramUniform4f != NULL && glad_glProgramUniform4f != glad_instrument_glProgramUniform4f) {
+        glad_real_glProgramUniform4f = glad_glProgramUniform4f;
+        glad_glProgramUniform4f = glad_instrument_glProgramUniform4f;
+    }
+    if(glad_glProgramUniform4fv != NULL && glad_glProgramUniform4fv != glad_instrument_glProgramUniform4fv) {
+        glad_real_glProgramUniform4fv = glad_glProgramUniform4fv;
+        glad_glProgramUniform4fv = glad_instrument_glProgramUniform4fv;
+    }
+    if(glad_glProgramUniform4d != NULL && glad_glProgramUniform4d != glad_instrument_glProgramUniform4d) {
+        glad_real_glProgramUniform4d = glad_glProgramUniform4d;
+        glad_glProgramUniform4d = glad_instrument_glProgramUniform4d;
+    }
+    if(glad_glProgramUniform4dv != NULL && glad_glProgramUniform4dv != glad_instrument_glProgramUniform4dv) {
+        glad_real_glProgramUniform4dv = glad_glProgramUniform4dv;
+        glad_glProgramUniform4dv = glad_instrument_glProgramUniform4dv;
+    }
+    if(glad_glProgramUniform4ui != NULL && glad_glProgramUniform4ui != glad_instrument_glProgramUniform4ui) {
+        glad_real_glProgramUniform4ui = glad_glProgramUniform4ui;
+        glad_glProgramUniform4ui = glad_instrument_glProgramUniform4ui;
+    }
+    if(glad_glProgramUniform4uiv != NULL && glad_glProgramUniform4uiv != glad_instrument_glProgramUniform4uiv) {
+        glad_real_glProgramUniform4uiv = glad_glProgramUniform4uiv;
+        glad_glProgramUniform4uiv = glad_instrument_glProgramUniform4uiv;
+    }
+    if(glad_glProgramUniformMatrix2fv != NULL && glad_glProgramUniformMatrix2fv != glad_instrument_glProgramUniformMatrix2fv) {
+        glad_real_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+        glad_glProgramUniformMatrix2fv = glad_instrument_glProgramUniformMatrix2fv;
+    }
+    if(glad_glProgramUniformMatrix3fv != NULL && glad_glProgramUniformMatrix3fv != glad_instrument_glProgramUniformMatrix3fv) {
+        glad_real_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+        glad_glProgramUniformMatrix3fv = glad_instrument_glProgramUniformMatrix3fv;
+    }
+    if(glad_glProgramUniformMatrix4fv != NULL && glad_glProgramUniformMatrix4fv != glad_instrument_glProgramUniformMatrix4fv) {
+        glad_real_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+        glad_glProgramUniformMatrix4fv = glad_instrument_glProgramUniformMatrix4fv;
+    }
+    if(glad_glProgramUniformMatrix2dv != NULL && glad_glProgramUniformMatrix2dv != glad_instrument_glProgramUniformMatrix2dv) {
+        glad_real_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+        glad_glProgramUniformMatrix2dv = glad_instrument_glProgramUniformMatrix2dv;
+    }
+    if(glad_glProgramUniformMatrix3dv != NULL && glad_glProgramUniformMatrix3dv != glad_instrument_glProgramUniformMatrix3dv) {
+        glad_real_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+        glad_glProgramUniformMatrix3dv = glad_instrument_glProgramUniformMatrix3dv;
+    }
+    if(glad_glProgramUniformMatrix4dv != NULL && glad_glProgramUniformMatrix4dv != glad_instrument_glProgramUniformMatrix4dv) {
+        glad_real_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+        glad_glProgramUniformMatrix4dv = glad_instrument_glProgramUniformMatrix4dv;
+    }
+    if(glad_glProgramUniformMatrix2x3fv != NULL && glad_glProgramUniformMatrix2x3fv != glad_instrument_glProgramUniformMatrix2x3fv) {
+        glad_real_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+        glad_glProgramUniformMatrix2x3fv = glad_instrument_glProgramUniformMatrix2x3fv;
+    }
+    if(glad_glProgramUniformMatrix3x2fv != NULL && glad_glProgramUniformMatrix3x2fv != glad_instrument_glProgramUniformMatrix3x2fv) {
+        glad_real_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+        glad_glProgramUniformMatrix3x2fv = glad_instrument_glProgramUniformMatrix3x2fv;
+    }
+    if(glad_glProgramUniformMatrix2x4fv != NULL && glad_glProgramUniformMatrix2x4fv != glad_instrument_glProgramUniformMatrix2x4fv) {
+        glad_real_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+        glad_glProgramUniformMatrix2x4fv = glad_instrument_glProgramUniformMatrix2x4fv;
+    }
+    if(glad_glProgramUniformMatrix4x2fv != NULL && glad_glProgramUniformMatrix4x2fv != glad_instrument_glProgramUniformMatrix4x2fv) {
+        glad_real_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+        glad_glProgramUniformMatrix4x2fv = glad_instrument_glProgramUniformMatrix4x2fv;
+    }
+    if(glad_glProgramUniformMatrix3x4fv != NULL && glad_glProgramUniformMatrix3x4fv != glad_instrument_glProgramUniformMatrix3x4fv) {
+        glad_real_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+        glad_glProgramUniformMatrix3x4fv = glad_instrument_glProgramUniformMatrix3x4fv;
+    }
+    if(glad_glProgramUniformMatrix4x3fv != NULL && glad_glProgramUniformMatrix4x3fv != glad_instrument_glProgramUniformMatrix4x3fv) {
+        glad_real_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+        glad_glProgramUniformMatrix4x3fv = glad_instrument_glProgramUniformMatrix4x3fv;
+    }
+    if(glad_glProgramUniformMatrix2x3dv != NULL && glad_glProgramUniformMatrix2x3dv != glad_instrument_glProgramUniformMatrix2x3dv) {
+        glad_real_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+        glad_glProgramUniformMatrix2x3dv = glad_instrument_glProgramUniformMatrix2x3dv;
+    }
+    if(glad_glProgramUniformMatrix3x2dv != NULL && glad_glProgramUniformMatrix3x2dv != glad_instrument_glProgramUniformMatrix3x2dv) {
+        glad_real_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+        glad_glProgramUniformMatrix3x2dv = glad_instrument_glProgramUniformMatrix3x2dv;
+    }
+    if(glad_glProgramUniformMatrix2x4dv != NULL && glad_glProgramUniformMatrix2x4dv != glad_instrument_glProgramUniformMatrix2x4dv) {
+        glad_real_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+        glad_glProgramUniformMatrix2x4dv = glad_instrument_glProgramUniformMatrix2x4dv;
+    }
+    if(glad_glProgramUniformMatrix4x2dv != NULL && glad_glProgramUniformMatrix4x2dv != glad_instrument_glProgramUniformMatrix4x2dv) {
+        glad_real_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+        glad_glProgramUniformMatrix4x2dv = glad_instrument_glProgramUniformMatrix4x2dv;
+    }
+    if(glad_glProgramUniformMatrix3x4dv != NULL && glad_glProgramUniformMatrix3x4dv != glad_instrument_glProgramUniformMatrix3x4dv) {
+        glad_real_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+        glad_glProgramUniformMatrix3x4dv = glad_instrument_glProgramUniformMatrix3x4dv;
+    }
+    if(glad_glProgramUniformMatrix4x3dv != NULL && glad_glProgramUniformMatrix4x3dv != glad_instrument_glProgramUniformMatrix4x3dv) {
+        glad_real_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+        glad_glProgramUniformMatrix4x3dv = glad_instrument_glProgramUniformMatrix4x3dv;
+    }
+    if(glad_glValidateProgramPipeline != NULL && glad_glValidateProgramPipeline != glad_instrument_glValidateProgramPipeline) {
+        glad_real_glValidateProgramPipeline = glad_glValidateProgramPipeline;
+        glad_glValidateProgramPipeline = glad_instrument_glValidateProgramPipeline;
+    }
+    if(glad_glGetProgramPipelineInfoLog != NULL && glad_glGetProgramPipelineInfoLog != glad_instrument_glGetProgramPipelineInfoLog) {
+        glad_real_glGetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog;
+        glad_glGetProgramPipelineInfoLog = glad_instrument_glGetProgramPipelineInfoLog;
+    }
+    if(glad_glVertexAttribL1d != NULL && glad_glVertexAttribL1d != glad_instrument_glVertexAttribL1d) {
+        glad_real_glVertexAttribL1d = glad_glVertexAttribL1d;
+        glad_glVertexAttribL1d = glad_instrument_glVertexAttribL1d;
+    }
+    if(glad_glVertexAttribL2d != NULL && glad_glVertexAttribL2d != glad_instrument_glVertexAttribL2d) {
+        glad_real_glVertexAttribL2d = glad_glVertexAttribL2d;
+        glad_glVertexAttribL2d = glad_instrument_glVertexAttribL2d;
+    }
+    if(glad_glVertexAttribL3d != NULL && glad_glVertexAttribL3d != glad_instrument_glVertexAttribL3d) {
+        glad_real_glVertexAttribL3d = glad_glVertexAttribL3d;
+        glad_glVertexAttribL3d = glad_instrument_glVertexAttribL3d;
+    }
+    if(glad_glVertexAttribL4d != NULL && glad_glVertexAttribL4d != glad_instrument_glVertexAttribL4d) {
+        glad_real_glVertexAttribL4d = glad_glVertexAttribL4d;
+        glad_glVertexAttribL4d = glad_instrument_glVertexAttribL4d;
+    }
+    if(glad_glVertexAttribL1dv != NULL && glad_glVertexAttribL1dv != glad_instrument_glVertexAttribL1dv) {
+        glad_real_glVertexAttribL1dv = glad_glVertexAttribL1dv;
+        glad_glVertexAttribL1dv = glad_instrument_glVertexAttribL1dv;
+    }
+    if(glad_glVertexAttribL2dv != NULL && glad_glVertexAttribL2dv != glad_instrument_glVertexAttribL2dv) {
+        glad_real_glVertexAttribL2dv = glad_glVertexAttribL2dv;
+        glad_glVertexAttribL2dv = glad_instrument_glVertexAttribL2dv;
+    }
+    if(glad_glVertexAttribL3dv != NULL && glad_glVertexAttribL3dv != glad_instrument_glVertexAttribL3dv) {
+        glad_real_glVertexAttribL3dv = glad_glVertexAttribL3dv;
+        glad_glVertexAttribL3dv = glad_instrument_glVertexAttribL3dv;
+    }
+    if(glad_glVertexAttribL4dv != NULL && glad_glVertexAttribL4dv != glad_instrument_glVertexAttribL4dv) {
+        glad_real_glVertexAttribL4dv = glad_glVertexAttribL4dv;
+        glad_glVertexAttribL4dv = glad_instrument_glVertexAttribL4dv;
+    }
+    if(glad_glVertexAttribLPointer != NULL && glad_glVertexAttribLPointer != glad_instrument_glVertexAttribLPointer) {
+        glad_real_glVertexAttribLPointer = glad_glVertexAttribLPointer;
+        glad_glVertexAttribLPointer = glad_instrument_glVertexAttribLPointer;
+    }
+    if(glad_glGetVertexAttribLdv != NULL && glad_glGetVertexAttribLdv != glad_instrument_glGetVertexAttribLdv) {
+        glad_real_glGetVertexAttribLdv = glad_glGetVertexAttribLdv;
+        glad_glGetVertexAttribLdv = glad_instrument_glGetVertexAttribLdv;
+    }
+    if(glad_glViewportArrayv != NULL && glad_glViewportArrayv != glad_instrument_glViewportArrayv) {
+        glad_real_glViewportArrayv = glad_glViewportArrayv;
+        glad_glViewportArrayv = glad_instrument_glViewportArrayv;
+    }
+    if(glad_glViewportIndexedf != NULL && glad_glViewportIndexedf != glad_instrument_glViewportIndexedf) {
+        glad_real_glViewportIndexedf = glad_glViewportIndexedf;
+        glad_glViewportIndexedf = glad_instrument_glViewportIndexedf;
+    }
+    if(glad_glViewportIndexedfv != NULL && glad_glViewportIndexedfv != glad_instrument_glViewportIndexedfv) {
+        glad_real_glViewportIndexedfv = glad_glViewportIndexedfv;
+        glad_glViewportIndexedfv = glad_instrument_glViewportIndexedfv;
+    }
+    if(glad_glScissorArrayv != NULL && glad_glScissorArrayv != glad_instrument_glScissorArrayv) {
+        glad_real_glScissorArrayv = glad_glScissorArrayv;
+        glad_glScissorArrayv = glad_instrument_glScissorArrayv;
+    }
+    if(glad_glScissorIndexed != NULL && glad_glScissorIndexed != glad_instrument_glScissorIndexed) {
+        glad_real_glScissorIndexed = glad_glScissorIndexed;
+        glad_glScissorIndexed = glad_instrument_glScissorIndexed;
+    }
+    if(glad_glScissorIndexedv != NULL && glad_glScissorIndexedv != glad_instrument_glScissorIndexedv) {
+        glad_real_glScissorIndexedv = glad_glScissorIndexedv;
+        glad_glScissorIndexedv = glad_instrument_glScissorIndexedv;
+    }
+    if(glad_glDepthRangeArrayv != NULL && glad_glDepthRangeArrayv != glad_instrument_glDepthRangeArrayv) {
+        glad_real_glDepthRangeArrayv = glad_glDepthRangeArrayv;
+        glad_glDepthRangeArrayv = glad_instrument_glDepthRangeArrayv;
+    }
+    if(glad_glDepthRangeIndexed != NULL && glad_glDepthRangeIndexed != glad_instrument_glDepthRangeIndexed) {
+        glad_real_glDepthRangeIndexed = glad_glDepthRangeIndexed;
+        glad_glDepthRangeIndexed = glad_instrument_glDepthRangeIndexed;
+    }
+    if(glad_glGetFloati_v != NULL && glad_glGetFloati_v != glad_instrument_glGetFloati_v) {
+        glad_real_glGetFloati_v = glad_glGetFloati_v;
+        glad_glGetFloati_v = glad_instrument_glGetFloati_v;
+    }
+    if(glad_glGetDoublei_v != NULL && glad_glGetDoublei_v != glad_instrument_glGetDoublei_v) {
+        glad_real_glGetDoublei_v = glad_glGetDoublei_v;
+        glad_glGetDoublei_v = glad_instrument_glGetDoublei_v;
+    }
+    if(glad_glDrawArraysInstancedBaseInstance != NULL && glad_glDrawArraysInstancedBaseInstance != glad_instrument_glDrawArraysInstancedBaseInstance) {
+        glad_real_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+        glad_glDrawArraysInstancedBaseInstance = glad_instrument_glDrawArraysInstancedBaseInstance;
+    }
+    if(glad_glDrawElementsInstancedBaseInstance != NULL && glad_glDrawElementsInstancedBaseInstance != glad_instrument_glDrawElementsInstancedBaseInstance) {
+        glad_real_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+        glad_glDrawElementsInstancedBaseInstance = glad_instrument_glDrawElementsInstancedBaseInstance;
+    }
+    if(glad_glDrawElementsInstancedBaseVertexBaseInstance != NULL && glad_glDrawElementsInstancedBaseVertexBaseInstance != glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance) {
+        glad_real_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+        glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance;
+    }
+    if(glad_glGetInternalformativ != NULL && glad_glGetInternalformativ != glad_instrument_glGetInternalformativ) {
+        glad_real_glGetInternalformativ = glad_glGetInternalformativ;
+        glad_glGetInternalformativ = glad_instrument_glGetInternalformativ;
+    }
+    if(glad_glGetActiveAtomicCounterBufferiv != NULL && glad_glGetActiveAtomicCounterBufferiv != glad_instrument_glGetActiveAtomicCounterBufferiv) {
+        glad_real_glGetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv;
+        glad_glGetActiveAtomicCounterBufferiv = glad_instrument_glGetActiveAtomicCounterBufferiv;
+    }
+    if(glad_glBindImageTexture != NULL && glad_glBindImageTexture != glad_instrument_glBindImageTexture) {
+        glad_real_glBindImageTexture = glad_glBindImageTexture;
+        glad_glBindImageTexture = glad_instrument_glBindImageTexture;
+    }
+    if(glad_glMemoryBarrier != NULL && glad_glMemoryBarrier != glad_instrument_glMemoryBarrier) {
+        glad_real_glMemoryBarrier = glad_glMemoryBarrier;
+        glad_glMemoryBarrier = glad_instrument_glMemoryBarrier;
+    }
+    if(glad_glTexStorage1D != NULL && glad_glTexStorage1D != glad_instrument_glTexStorage1D) {
+        glad_real_glTexStorage1D = glad_glTexStorage1D;
+        glad_glTexStorage1D = glad_instrument_glTexStorage1D;
+    }
+    if(glad_glTexStorage2D != NULL && glad_glTexStorage2D != glad_instrument_glTexStorage2D) {
+        glad_real_glTexStorage2D = glad_glTexStorage2D;
+        glad_glTexStorage2D = glad_instrument_glTexStorage2D;
+    }
+    if(glad_glTexStorage3D != NULL && glad_glTexStorage3D != glad_instrument_glTexStorage3D) {
+        glad_real_glTexStorage3D = glad_glTexStorage3D;
+        glad_glTexStorage3D = glad_instrument_glTexStorage3D;
+    }
+    if(glad_glDrawTransformFeedbackInstanced != NULL && glad_glDrawTransformFeedbackInstanced != glad_instrument_glDrawTransformFeedbackInstanced) {
+        glad_real_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+        glad_glDrawTransformFeedbackInstanced = glad_instrument_glDrawTransformFeedbackInstanced;
+    }
+    if(glad_glDrawTransformFeedbackStreamInstanced != NULL && glad_glDrawTransformFeedbackStreamInstanced != glad_instrument_glDrawTransformFeedbackStreamInstanced) {
+        glad_real_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+        glad_glDrawTransformFeedbackStreamInstanced = glad_instrument_glDrawTransformFeedbackStreamInstanced;
+    }
+    if(glad_glClearBufferData != NULL && glad_glClearBufferData != glad_instrument_glClearBufferData) {
+        glad_real_glClearBufferData = glad_glClearBufferData;
+        glad_glClearBufferData = glad_instrument_glClearBufferData;
+    }
+    if(glad_glClearBufferSubData != NULL && glad_glClearBufferSubData != glad_instrument_glClearBufferSubData) {
+        glad_real_glClearBufferSubData = glad_glClearBufferSubData;
+        glad_glClearBufferSubData = glad_instrument_glClearBufferSubData;
+    }
+    if(glad_glDispatchCompute != NULL && glad_glDispatchCompute != glad_instrument_glDispatchCompute) {
+        glad_real_glDispatchCompute = glad_glDispatchCompute;
+        glad_glDispatchCompute = glad_instrument_glDispatchCompute;
+    }
+    if(glad_glDispatchComputeIndirect != NULL && glad_glDispatchComputeIndirect != glad_instrument_glDispatchComputeIndirect) {
+        glad_real_glDispatchComputeIndirect = glad_glDispatchComputeIndirect;
+        glad_glDispatchComputeIndirect = glad_instrument_glDispatchComputeIndirect;
+    }
+    if(glad_glCopyImageSubData != NULL && glad_glCopyImageSubData != glad_instrument_glCopyImageSubData) {
+        glad_real_glCopyImageSubData = glad_glCopyImageSubData;
+        glad_glCopyImageSubData = glad_instrument_glCopyImageSubData;
+    }
+    if(glad_glFramebufferParameteri != NULL && glad_glFramebufferParameteri != glad_instrument_glFramebufferParameteri) {
+        glad_real_glFramebufferParameteri = glad_glFramebufferParameteri;
+        glad_glFramebufferParameteri = glad_instrument_glFramebufferParameteri;
+    }
+    if(glad_glGetFramebufferParameteriv != NULL && glad_glGetFramebufferParameteriv != glad_instrument_glGetFramebufferParameteriv) {
+        glad_real_glGetFramebufferParameteriv = glad_glGetFramebufferParameteriv;
+        glad_glGetFramebufferParameteriv = glad_instrument_glGetFramebufferParameteriv;
+    }
+    if(glad_glGetInternalformati64v != NULL && glad_glGetInternalformati64v != glad_instrument_glGetInternalformati64v) {
+        glad_real_glGetInternalformati64v = glad_glGetInternalformati64v;
+        glad_glGetInternalformati64v = glad_instrument_glGetInternalformati64v;
+    }
+    if(glad_glInvalidateTexSubImage != NULL && glad_glInvalidateTexSubImage != glad_instrument_glInvalidateTexSubImage) {
+        glad_real_glInvalidateTexSubImage = glad_glInvalidateTexSubImage;
+        glad_glInvalidateTexSubImage = glad_instrument_glInvalidateTexSubImage;
+    }
+    if(glad_glInvalidateTexImage != NULL && glad_glInvalidateTexImage != glad_instrument_glInvalidateTexImage) {
+        glad_real_glInvalidateTexImage = glad_glInvalidateTexImage;
+        glad_glInvalidateTexImage = glad_instrument_glInvalidateTexImage;
+    }
+    if(glad_glInvalidateBufferSubData != NULL && glad_glInvalidateBufferSubData != glad_instrument_glInvalidateBufferSubData) {
+        glad_real_glInvalidateBufferSubData = glad_glInvalidateBufferSubData;
+        glad_glInvalidateBufferSubData = glad_instrument_glInvalidateBufferSubData;
+    }
+    if(glad_glInvalidateBufferData != NULL && glad_glInvalidateBufferData != glad_instrument_glInvalidateBufferData) {
+        glad_real_glInvalidateBufferData = glad_glInvalidateBufferData;
+        glad_glInvalidateBufferData = glad_instrument_glInvalidateBufferData;
+    }
+    if(glad_glInvalidateFramebuffer != NULL && glad_glInvalidateFramebuffer != glad_instrument_glInvalidateFramebuffer) {
+        glad_real_glInvalidateFramebuffer = glad_glInvalidateFramebuffer;
+        glad_glInvalidateFramebuffer = glad_instrument_glInvalidateFramebuffer;
+    }
+    if(glad_glInvalidateSubFramebuffer != NULL && glad_glInvalidateSubFramebuffer != glad_instrument_glInvalidateSubFramebuffer) {
+        glad_real_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+        glad_glInvalidateSubFramebuffer = glad_instrument_glInvalidateSubFramebuffer;
+    }
+    if(glad_glMultiDrawArraysIndirect != NULL && glad_glMultiDrawArraysIndirect != glad_instrument_glMultiDrawArraysIndirect) {
+        glad_real_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+        glad_glMultiDrawArraysIndirect = glad_instrument_glMultiDrawArraysIndirect;
+    }
+    if(glad_glMultiDrawElementsIndirect != NULL && glad_glMultiDrawElementsIndirect != glad_instrument_glMultiDrawElementsIndirect) {
+        glad_real_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+        glad_glMultiDrawElementsIndirect = glad_instrument_glMultiDrawElementsIndirect;
+    }
+    if(glad_glGetProgramInterfaceiv != NULL && glad_glGetProgramInterfaceiv != glad_instrument_glGetProgramInterfaceiv) {
+        glad_real_glGetProgramInterfaceiv = glad_glGetProgramInterfaceiv;
+        glad_glGetProgramInterfaceiv = glad_instrument_glGetProgramInterfaceiv;
+    }
+    if(glad_glGetProgramResourceIndex != NULL && glad_glGetProgramResourceIndex != glad_instrument_glGetProgramResourceIndex) {
+        glad_real_glGetProgramResourceIndex = glad_glGetProgramResourceIndex;
+        glad_glGetProgramResourceIndex = glad_instrument_glGetProgramResourceIndex;
+    }
+    if(glad_glGetProgramResourceName != NULL && glad_glGetProgramResourceName != glad_instrument_glGetProgramResourceName) {
+        glad_real_glGetProgramResourceName = glad_glGetProgramResourceName;
+        glad_glGetProgramResourceName = glad_instrument_glGetProgramResourceName;
+    }
+    if(glad_glGetProgramResourceiv != NULL && glad_glGetProgramResourceiv != glad_instrument_glGetProgramResourceiv) {
+        glad_real_glGetProgramResourceiv = glad_glGetProgramResourceiv;
+        glad_glGetProgramResourceiv = glad_instrument_glGetProgramResourceiv;
+    }
+    if(glad_glGetProgramResourceLocation != NULL && glad_glGetProgramResourceLocation != glad_instrument_glGetProgramResourceLocation) {
+        glad_real_glGetProgramResourceLocation = glad_glGetProgramResourceLocation;
+        glad_glGetProgramResourceLocation = glad_instrument_glGetProgramResourceLocation;
+    }
+    if(glad_glGetProgramResourceLocationIndex != NULL && glad_glGetProgramResourceLocationIndex != glad_instrument_glGetProgramResourceLocationIndex) {
+        glad_real_glGetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex;
+        glad_glGetProgramResourceLocationIndex = glad_instrument_glGetProgramResourceLocationIndex;
+    }
+    if(glad_glShaderStorageBlockBinding != NULL && glad_glShaderStorageBlockBinding != glad_instrument_glShaderStorageBlockBinding) {
+        glad_real_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+        glad_glShaderStorageBlockBinding = glad_instrument_glShaderStorageBlockBinding;
+    }
+    if(glad_glTexBufferRange != NULL && glad_glTexBufferRange != glad_instrument_glTexBufferRange) {
+        glad_real_glTexBufferRange = glad_glTexBufferRange;
+        glad_glTexBufferRange = glad_instrument_glTexBufferRange;
+    }
+    if(glad_glTexStorage2DMultisample != NULL && glad_glTexStorage2DMultisample != glad_instrument_glTexStorage2DMultisample) {
+        glad_real_glTexStorage2DMultisample = glad_glTexStorage2DMultisample;
+        glad_glTexStorage2DMultisample = glad_instrument_glTexStorage2DMultisample;
+    }
+    if(glad_glTexStorage3DMultisample != NULL && glad_glTexStorage3DMultisample != glad_instrument_glTexStorage3DMultisample) {
+        glad_real_glTexStorage3DMultisample = glad_glTexStorage3DMultisample;
+        glad_glTexStorage3DMultisample = glad_instrument_glTexStorage3DMultisample;
+    }
+    if(glad_glTextureView != NULL && glad_glTextureView != glad_instrument_glTextureView) {
+        glad_real_glTextureView = glad_glTextureView;
+        glad_glTextureView = glad_instrument_glTextureView;
+    }
+    if(glad_glBindVertexBuffer != NULL && glad_glBindVertexBuffer != glad_instrument_glBindVertexBuffer) {
+        glad_real_glBindVertexBuffer = glad_glBindVertexBuffer;
+        glad_glBindVertexBuffer = glad_instrument_glBindVertexBuffer;
+    }
+    if(glad_glVertexAttribFormat != NULL && glad_glVertexAttribFormat != glad_instrument_glVertexAttribFormat) {
+        glad_real_glVertexAttribFormat = glad_glVertexAttribFormat;
+        glad_glVertexAttribFormat = glad_instrument_glVertexAttribFormat;
+    }
+    if(glad_glVertexAttribIFormat != NULL && glad_glVertexAttribIFormat != glad_instrument_glVertexAttribIFormat) {
+        glad_real_glVertexAttribIFormat = glad_glVertexAttribIFormat;
+        glad_glVertexAttribIFormat = glad_instrument_glVertexAttribIFormat;
+    }
+    if(glad_glVertexAttribLFormat != NULL && glad_glVertexAttribLFormat != glad_instrument_glVertexAttribLFormat) {
+        glad_real_glVertexAttribLFormat = glad_glVertexAttribLFormat;
+        glad_glVertexAttribLFormat = glad_instrument_glVertexAttribLFormat;
+    }
+    if(glad_glVertexAttribBinding != NULL && glad_glVertexAttribBinding != glad_instrument_glVertexAttribBinding) {
+        glad_real_glVertexAttribBinding = glad_glVertexAttribBinding;
+        glad_glVertexAttribBinding = glad_instrument_glVertexAttribBinding;
+    }
+    if(glad_glVertexBindingDivisor != NULL && glad_glVertexBindingDivisor != glad_instrument_glVertexBindingDivisor) {
+        glad_real_glVertexBindingDivisor = glad_glVertexBindingDivisor;
+        glad_glVertexBindingDivisor = glad_instrument_glVertexBindingDivisor;
+    }
+    if(glad_glDebugMessageControl != NULL && glad_glDebugMessageControl != glad_instrument_glDebugMessageControl) {
+        glad_real_glDebugMessageControl = glad_glDebugMessageControl;
+        glad_glDebugMessageControl = glad_instrument_glDebugMessageControl;
+    }
+    if(glad_glDebugMessageInsert != NULL && glad_glDebugMessageInsert != glad_instrument_glDebugMessageInsert) {
+        glad_real_glDebugMessageInsert = glad_glDebugMessageInsert;
+        glad_glDebugMessageInsert = glad_instrument_glDebugMessageInsert;
+    }
+    if(glad_glDebugMessageCallback != NULL && glad_glDebugMessageCallback != glad_instrument_glDebugMessageCallback) {
+        glad_real_glDebugMessageCallback = glad_glDebugMessageCallback;
+        glad_glDebugMessageCallback = glad_instrument_glDebugMessageCallback;
+    }
+    if(glad_glGetDebugMessageLog != NULL && glad_glGetDebugMessageLog != glad_instrument_glGetDebugMessageLog) {
+        glad_real_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+        glad_glGetDebugMessageLog = glad_instrument_glGetDebugMessageLog;
+    }
+    if(glad_glPushDebugGroup != NULL && glad_glPushDebugGroup != glad_instrument_glPushDebugGroup) {
+        glad_real_glPushDebugGroup = glad_glPushDebugGroup;
+        glad_glPushDebugGroup = glad_instrument_glPushDebugGroup;
+    }
+    if(glad_glPopDebugGroup != NULL && glad_glPopDebugGroup != glad_instrument_glPopDebugGroup) {
+        glad_real_glPopDebugGroup = glad_glPopDebugGroup;
+        glad_glPopDebugGroup = glad_instrument_glPopDebugGroup;
+    }
+    if(glad_glObjectLabel != NULL && glad_glObjectLabel != glad_instrument_glObjectLabel) {
+        glad_real_glObjectLabel = glad_glObjectLabel;
+        glad_glObjectLabel = glad_instrument_glObjectLabel;
+    }
+    if(glad_glGetObjectLabel != NULL && glad_glGetObjectLabel != glad_instrument_glGetObjectLabel) {
+        glad_real_glGetObjectLabel = glad_glGetObjectLabel;
+        glad_glGetObjectLabel = glad_instrument_glGetObjectLabel;
+    }
+    if(glad_glObjectPtrLabel != NULL && glad_glObjectPtrLabel != glad_instrument_glObjectPtrLabel) {
+        glad_real_glObjectPtrLabel = glad_glObjectPtrLabel;
+        glad_glObjectPtrLabel = glad_instrument_glObjectPtrLabel;
+    }
+    if(glad_glGetObjectPtrLabel != NULL && glad_glGetObjectPtrLabel != glad_instrument_glGetObjectPtrLabel) {
+        glad_real_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+        glad_glGetObjectPtrLabel = glad_instrument_glGetObjectPtrLabel;
+    }
+    if(glad_glBufferStorage != NULL && glad_glBufferStorage != glad_instrument_glBufferStorage) {
+        glad_real_glBufferStorage = glad_glBufferStorage;
+        glad_glBufferStorage = glad_instrument_glBufferStorage;
+    }
+}
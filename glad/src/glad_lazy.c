@@ -0,0 +1,100 @@
+/*
+
+    Lazy loading build of the loader (GLAD_LAZY_LOAD), included by glad.c in
+    place of the extension helpers of the regular build.
+
+    gladLoadGLLoader only resolves glGetString up front. Every other glad_gl*
+    pointer starts on a stub from glad_lazy_gen.h that resolves the entry
+    point on its first call, then replaces itself. The loader passed to
+    gladLoadGLLoader must therefore stay valid as long as GL is used (it is
+    for glfwGetProcAddress and for gladLoadGL, which keeps libGL open).
+    As in the regular build, only the pointers of the versions and
+    extensions the context supports are set, the others stay NULL: check
+    the GLAD_GL_VERSION_* and extension flags before calling them. A stub
+    whose entry point the loader can't find resolves to NULL and crashes on
+    its first call, where the regular build would have left the pointer
+    NULL. The first calls of each entry point should come from the thread
+    owning the context.
+
+    Extensions are matched while walking the driver strings against a perfect
+    hash table of the extensions glad was generated with: no string is copied
+    and has_ext is a single comparison.
+
+*/
+
+static GLADloadproc glad_lazy_loader = NULL;
+
+struct glad_lazy_entry {
+    const char *name;
+    void *proc;
+};
+
+static unsigned int glad_lazy_hash(unsigned int seed, const char *name, size_t length) {
+    unsigned int hash = 2166136261u ^ seed;
+    size_t i;
+    for(i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+#include "glad_lazy_gen.h"
+
+static int glad_lazy_compare(const void *name, const void *entry) {
+    return strcmp((const char *)name, ((const struct glad_lazy_entry *)entry)->name);
+}
+
+/* Loader handed to the load_GL_* functions: returns the stub of an entry point. */
+static void* glad_lazy_stub(const char *name) {
+    const struct glad_lazy_entry *entry = (const struct glad_lazy_entry *)bsearch(name, glad_lazy_entries,
+        sizeof(glad_lazy_entries) / sizeof(glad_lazy_entries[0]), sizeof(glad_lazy_entries[0]), glad_lazy_compare);
+    return entry != NULL ? entry->proc : glad_lazy_loader(name);
+}
+
+static int glad_ext_found[GLAD_EXT_HASH_SIZE];
+
+static void glad_ext_mark(const char *name, size_t length) {
+    unsigned int slot = glad_lazy_hash(glad_ext_seed, name, length) & (GLAD_EXT_HASH_SIZE - 1);
+    const char *known = glad_ext_names[slot];
+    if(known != NULL && strncmp(known, name, length) == 0 && known[length] == '\0') {
+        glad_ext_found[slot] = 1;
+    }
+}
+
+static int get_exts(void) {
+    memset(glad_ext_found, 0, sizeof(glad_ext_found));
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        const char *ext = (const char *)glGetString(GL_EXTENSIONS);
+        while(ext != NULL && *ext != '\0') {
+            const char *end = strchr(ext, ' ');
+            if(end == NULL) {
+                end = ext + strlen(ext);
+            }
+            glad_ext_mark(ext, (size_t)(end - ext));
+            ext = *end != '\0' ? end + 1 : end;
+        }
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        GLint index, count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for(index = 0; index < count; index++) {
+            const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+            if(ext != NULL) {
+                glad_ext_mark(ext, strlen(ext));
+            }
+        }
+    }
+#endif
+    return 1;
+}
+
+static void free_exts(void) {
+}
+
+static int has_ext(const char *ext) {
+    size_t length = strlen(ext);
+    unsigned int slot = glad_lazy_hash(glad_ext_seed, ext, length) & (GLAD_EXT_HASH_SIZE - 1);
+    return glad_ext_names[slot] != NULL && strcmp(glad_ext_names[slot], ext) == 0 && glad_ext_found[slot];
+}
@@ -0,0 +1,6219 @@
+/* Generated by wrappers.py from glad.h, do not edit. */
+
+static PFNGLCULLFACEPROC glad_lazy_real_glCullFace = NULL;
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+    if(glad_lazy_real_glCullFace == NULL) {
+        glad_lazy_real_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_loader("glCullFace");
+        if(glad_glCullFace == glad_lazy_glCullFace) glad_glCullFace = glad_lazy_real_glCullFace;
+    }
+    glad_lazy_real_glCullFace(mode);
+}
+
+static PFNGLFRONTFACEPROC glad_lazy_real_glFrontFace = NULL;
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+    if(glad_lazy_real_glFrontFace == NULL) {
+        glad_lazy_real_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_loader("glFrontFace");
+        if(glad_glFrontFace == glad_lazy_glFrontFace) glad_glFrontFace = glad_lazy_real_glFrontFace;
+    }
+    glad_lazy_real_glFrontFace(mode);
+}
+
+static PFNGLHINTPROC glad_lazy_real_glHint = NULL;
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+    if(glad_lazy_real_glHint == NULL) {
+        glad_lazy_real_glHint = (PFNGLHINTPROC)glad_lazy_loader("glHint");
+        if(glad_glHint == glad_lazy_glHint) glad_glHint = glad_lazy_real_glHint;
+    }
+    glad_lazy_real_glHint(target, mode);
+}
+
+static PFNGLLINEWIDTHPROC glad_lazy_real_glLineWidth = NULL;
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+    if(glad_lazy_real_glLineWidth == NULL) {
+        glad_lazy_real_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_loader("glLineWidth");
+        if(glad_glLineWidth == glad_lazy_glLineWidth) glad_glLineWidth = glad_lazy_real_glLineWidth;
+    }
+    glad_lazy_real_glLineWidth(width);
+}
+
+static PFNGLPOINTSIZEPROC glad_lazy_real_glPointSize = NULL;
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+    if(glad_lazy_real_glPointSize == NULL) {
+        glad_lazy_real_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_loader("glPointSize");
+        if(glad_glPointSize == glad_lazy_glPointSize) glad_glPointSize = glad_lazy_real_glPointSize;
+    }
+    glad_lazy_real_glPointSize(size);
+}
+
+static PFNGLPOLYGONMODEPROC glad_lazy_real_glPolygonMode = NULL;
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+    if(glad_lazy_real_glPolygonMode == NULL) {
+        glad_lazy_real_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_loader("glPolygonMode");
+        if(glad_glPolygonMode == glad_lazy_glPolygonMode) glad_glPolygonMode = glad_lazy_real_glPolygonMode;
+    }
+    glad_lazy_real_glPolygonMode(face, mode);
+}
+
+static PFNGLSCISSORPROC glad_lazy_real_glScissor = NULL;
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glScissor == NULL) {
+        glad_lazy_real_glScissor = (PFNGLSCISSORPROC)glad_lazy_loader("glScissor");
+        if(glad_glScissor == glad_lazy_glScissor) glad_glScissor = glad_lazy_real_glScissor;
+    }
+    glad_lazy_real_glScissor(x, y, width, height);
+}
+
+static PFNGLTEXPARAMETERFPROC glad_lazy_real_glTexParameterf = NULL;
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    if(glad_lazy_real_glTexParameterf == NULL) {
+        glad_lazy_real_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_loader("glTexParameterf");
+        if(glad_glTexParameterf == glad_lazy_glTexParameterf) glad_glTexParameterf = glad_lazy_real_glTexParameterf;
+    }
+    glad_lazy_real_glTexParameterf(target, pname, param);
+}
+
+static PFNGLTEXPARAMETERFVPROC glad_lazy_real_glTexParameterfv = NULL;
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    if(glad_lazy_real_glTexParameterfv == NULL) {
+        glad_lazy_real_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_loader("glTexParameterfv");
+        if(glad_glTexParameterfv == glad_lazy_glTexParameterfv) glad_glTexParameterfv = glad_lazy_real_glTexParameterfv;
+    }
+    glad_lazy_real_glTexParameterfv(target, pname, params);
+}
+
+static PFNGLTEXPARAMETERIPROC glad_lazy_real_glTexParameteri = NULL;
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    if(glad_lazy_real_glTexParameteri == NULL) {
+        glad_lazy_real_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_loader("glTexParameteri");
+        if(glad_glTexParameteri == glad_lazy_glTexParameteri) glad_glTexParameteri = glad_lazy_real_glTexParameteri;
+    }
+    glad_lazy_real_glTexParameteri(target, pname, param);
+}
+
+static PFNGLTEXPARAMETERIVPROC glad_lazy_real_glTexParameteriv = NULL;
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    if(glad_lazy_real_glTexParameteriv == NULL) {
+        glad_lazy_real_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_loader("glTexParameteriv");
+        if(glad_glTexParameteriv == glad_lazy_glTexParameteriv) glad_glTexParameteriv = glad_lazy_real_glTexParameteriv;
+    }
+    glad_lazy_real_glTexParameteriv(target, pname, params);
+}
+
+static PFNGLTEXIMAGE1DPROC glad_lazy_real_glTexImage1D = NULL;
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexImage1D == NULL) {
+        glad_lazy_real_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_loader("glTexImage1D");
+        if(glad_glTexImage1D == glad_lazy_glTexImage1D) glad_glTexImage1D = glad_lazy_real_glTexImage1D;
+    }
+    glad_lazy_real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static PFNGLTEXIMAGE2DPROC glad_lazy_real_glTexImage2D = NULL;
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexImage2D == NULL) {
+        glad_lazy_real_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_loader("glTexImage2D");
+        if(glad_glTexImage2D == glad_lazy_glTexImage2D) glad_glTexImage2D = glad_lazy_real_glTexImage2D;
+    }
+    glad_lazy_real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static PFNGLDRAWBUFFERPROC glad_lazy_real_glDrawBuffer = NULL;
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+    if(glad_lazy_real_glDrawBuffer == NULL) {
+        glad_lazy_real_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_loader("glDrawBuffer");
+        if(glad_glDrawBuffer == glad_lazy_glDrawBuffer) glad_glDrawBuffer = glad_lazy_real_glDrawBuffer;
+    }
+    glad_lazy_real_glDrawBuffer(buf);
+}
+
+static PFNGLCLEARPROC glad_lazy_real_glClear = NULL;
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+    if(glad_lazy_real_glClear == NULL) {
+        glad_lazy_real_glClear = (PFNGLCLEARPROC)glad_lazy_loader("glClear");
+        if(glad_glClear == glad_lazy_glClear) glad_glClear = glad_lazy_real_glClear;
+    }
+    glad_lazy_real_glClear(mask);
+}
+
+static PFNGLCLEARCOLORPROC glad_lazy_real_glClearColor = NULL;
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if(glad_lazy_real_glClearColor == NULL) {
+        glad_lazy_real_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_loader("glClearColor");
+        if(glad_glClearColor == glad_lazy_glClearColor) glad_glClearColor = glad_lazy_real_glClearColor;
+    }
+    glad_lazy_real_glClearColor(red, green, blue, alpha);
+}
+
+static PFNGLCLEARSTENCILPROC glad_lazy_real_glClearStencil = NULL;
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+    if(glad_lazy_real_glClearStencil == NULL) {
+        glad_lazy_real_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_loader("glClearStencil");
+        if(glad_glClearStencil == glad_lazy_glClearStencil) glad_glClearStencil = glad_lazy_real_glClearStencil;
+    }
+    glad_lazy_real_glClearStencil(s);
+}
+
+static PFNGLCLEARDEPTHPROC glad_lazy_real_glClearDepth = NULL;
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+    if(glad_lazy_real_glClearDepth == NULL) {
+        glad_lazy_real_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_loader("glClearDepth");
+        if(glad_glClearDepth == glad_lazy_glClearDepth) glad_glClearDepth = glad_lazy_real_glClearDepth;
+    }
+    glad_lazy_real_glClearDepth(depth);
+}
+
+static PFNGLSTENCILMASKPROC glad_lazy_real_glStencilMask = NULL;
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+    if(glad_lazy_real_glStencilMask == NULL) {
+        glad_lazy_real_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_loader("glStencilMask");
+        if(glad_glStencilMask == glad_lazy_glStencilMask) glad_glStencilMask = glad_lazy_real_glStencilMask;
+    }
+    glad_lazy_real_glStencilMask(mask);
+}
+
+static PFNGLCOLORMASKPROC glad_lazy_real_glColorMask = NULL;
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    if(glad_lazy_real_glColorMask == NULL) {
+        glad_lazy_real_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_loader("glColorMask");
+        if(glad_glColorMask == glad_lazy_glColorMask) glad_glColorMask = glad_lazy_real_glColorMask;
+    }
+    glad_lazy_real_glColorMask(red, green, blue, alpha);
+}
+
+static PFNGLDEPTHMASKPROC glad_lazy_real_glDepthMask = NULL;
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+    if(glad_lazy_real_glDepthMask == NULL) {
+        glad_lazy_real_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_loader("glDepthMask");
+        if(glad_glDepthMask == glad_lazy_glDepthMask) glad_glDepthMask = glad_lazy_real_glDepthMask;
+    }
+    glad_lazy_real_glDepthMask(flag);
+}
+
+static PFNGLDISABLEPROC glad_lazy_real_glDisable = NULL;
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+    if(glad_lazy_real_glDisable == NULL) {
+        glad_lazy_real_glDisable = (PFNGLDISABLEPROC)glad_lazy_loader("glDisable");
+        if(glad_glDisable == glad_lazy_glDisable) glad_glDisable = glad_lazy_real_glDisable;
+    }
+    glad_lazy_real_glDisable(cap);
+}
+
+static PFNGLENABLEPROC glad_lazy_real_glEnable = NULL;
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+    if(glad_lazy_real_glEnable == NULL) {
+        glad_lazy_real_glEnable = (PFNGLENABLEPROC)glad_lazy_loader("glEnable");
+        if(glad_glEnable == glad_lazy_glEnable) glad_glEnable = glad_lazy_real_glEnable;
+    }
+    glad_lazy_real_glEnable(cap);
+}
+
+static PFNGLFINISHPROC glad_lazy_real_glFinish = NULL;
+static void APIENTRY glad_lazy_glFinish(void) {
+    if(glad_lazy_real_glFinish == NULL) {
+        glad_lazy_real_glFinish = (PFNGLFINISHPROC)glad_lazy_loader("glFinish");
+        if(glad_glFinish == glad_lazy_glFinish) glad_glFinish = glad_lazy_real_glFinish;
+    }
+    glad_lazy_real_glFinish();
+}
+
+static PFNGLFLUSHPROC glad_lazy_real_glFlush = NULL;
+static void APIENTRY glad_lazy_glFlush(void) {
+    if(glad_lazy_real_glFlush == NULL) {
+        glad_lazy_real_glFlush = (PFNGLFLUSHPROC)glad_lazy_loader("glFlush");
+        if(glad_glFlush == glad_lazy_glFlush) glad_glFlush = glad_lazy_real_glFlush;
+    }
+    glad_lazy_real_glFlush();
+}
+
+static PFNGLBLENDFUNCPROC glad_lazy_real_glBlendFunc = NULL;
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    if(glad_lazy_real_glBlendFunc == NULL) {
+        glad_lazy_real_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_loader("glBlendFunc");
+        if(glad_glBlendFunc == glad_lazy_glBlendFunc) glad_glBlendFunc = glad_lazy_real_glBlendFunc;
+    }
+    glad_lazy_real_glBlendFunc(sfactor, dfactor);
+}
+
+static PFNGLLOGICOPPROC glad_lazy_real_glLogicOp = NULL;
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+    if(glad_lazy_real_glLogicOp == NULL) {
+        glad_lazy_real_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_loader("glLogicOp");
+        if(glad_glLogicOp == glad_lazy_glLogicOp) glad_glLogicOp = glad_lazy_real_glLogicOp;
+    }
+    glad_lazy_real_glLogicOp(opcode);
+}
+
+static PFNGLSTENCILFUNCPROC glad_lazy_real_glStencilFunc = NULL;
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    if(glad_lazy_real_glStencilFunc == NULL) {
+        glad_lazy_real_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_loader("glStencilFunc");
+        if(glad_glStencilFunc == glad_lazy_glStencilFunc) glad_glStencilFunc = glad_lazy_real_glStencilFunc;
+    }
+    glad_lazy_real_glStencilFunc(func, ref, mask);
+}
+
+static PFNGLSTENCILOPPROC glad_lazy_real_glStencilOp = NULL;
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    if(glad_lazy_real_glStencilOp == NULL) {
+        glad_lazy_real_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_loader("glStencilOp");
+        if(glad_glStencilOp == glad_lazy_glStencilOp) glad_glStencilOp = glad_lazy_real_glStencilOp;
+    }
+    glad_lazy_real_glStencilOp(fail, zfail, zpass);
+}
+
+static PFNGLDEPTHFUNCPROC glad_lazy_real_glDepthFunc = NULL;
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+    if(glad_lazy_real_glDepthFunc == NULL) {
+        glad_lazy_real_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_loader("glDepthFunc");
+        if(glad_glDepthFunc == glad_lazy_glDepthFunc) glad_glDepthFunc = glad_lazy_real_glDepthFunc;
+    }
+    glad_lazy_real_glDepthFunc(func);
+}
+
+static PFNGLPIXELSTOREFPROC glad_lazy_real_glPixelStoref = NULL;
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+    if(glad_lazy_real_glPixelStoref == NULL) {
+        glad_lazy_real_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_loader("glPixelStoref");
+        if(glad_glPixelStoref == glad_lazy_glPixelStoref) glad_glPixelStoref = glad_lazy_real_glPixelStoref;
+    }
+    glad_lazy_real_glPixelStoref(pname, param);
+}
+
+static PFNGLPIXELSTOREIPROC glad_lazy_real_glPixelStorei = NULL;
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+    if(glad_lazy_real_glPixelStorei == NULL) {
+        glad_lazy_real_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_loader("glPixelStorei");
+        if(glad_glPixelStorei == glad_lazy_glPixelStorei) glad_glPixelStorei = glad_lazy_real_glPixelStorei;
+    }
+    glad_lazy_real_glPixelStorei(pname, param);
+}
+
+static PFNGLREADBUFFERPROC glad_lazy_real_glReadBuffer = NULL;
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+    if(glad_lazy_real_glReadBuffer == NULL) {
+        glad_lazy_real_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_loader("glReadBuffer");
+        if(glad_glReadBuffer == glad_lazy_glReadBuffer) glad_glReadBuffer = glad_lazy_real_glReadBuffer;
+    }
+    glad_lazy_real_glReadBuffer(src);
+}
+
+static PFNGLREADPIXELSPROC glad_lazy_real_glReadPixels = NULL;
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    if(glad_lazy_real_glReadPixels == NULL) {
+        glad_lazy_real_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_loader("glReadPixels");
+        if(glad_glReadPixels == glad_lazy_glReadPixels) glad_glReadPixels = glad_lazy_real_glReadPixels;
+    }
+    glad_lazy_real_glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static PFNGLGETBOOLEANVPROC glad_lazy_real_glGetBooleanv = NULL;
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+    if(glad_lazy_real_glGetBooleanv == NULL) {
+        glad_lazy_real_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_loader("glGetBooleanv");
+        if(glad_glGetBooleanv == glad_lazy_glGetBooleanv) glad_glGetBooleanv = glad_lazy_real_glGetBooleanv;
+    }
+    glad_lazy_real_glGetBooleanv(pname, data);
+}
+
+static PFNGLGETDOUBLEVPROC glad_lazy_real_glGetDoublev = NULL;
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+    if(glad_lazy_real_glGetDoublev == NULL) {
+        glad_lazy_real_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_loader("glGetDoublev");
+        if(glad_glGetDoublev == glad_lazy_glGetDoublev) glad_glGetDoublev = glad_lazy_real_glGetDoublev;
+    }
+    glad_lazy_real_glGetDoublev(pname, data);
+}
+
+static PFNGLGETERRORPROC glad_lazy_real_glGetError = NULL;
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+    if(glad_lazy_real_glGetError == NULL) {
+        glad_lazy_real_glGetError = (PFNGLGETERRORPROC)glad_lazy_loader("glGetError");
+        if(glad_glGetError == glad_lazy_glGetError) glad_glGetError = glad_lazy_real_glGetError;
+    }
+    return glad_lazy_real_glGetError();
+}
+
+static PFNGLGETFLOATVPROC glad_lazy_real_glGetFloatv = NULL;
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+    if(glad_lazy_real_glGetFloatv == NULL) {
+        glad_lazy_real_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_loader("glGetFloatv");
+        if(glad_glGetFloatv == glad_lazy_glGetFloatv) glad_glGetFloatv = glad_lazy_real_glGetFloatv;
+    }
+    glad_lazy_real_glGetFloatv(pname, data);
+}
+
+static PFNGLGETINTEGERVPROC glad_lazy_real_glGetIntegerv = NULL;
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+    if(glad_lazy_real_glGetIntegerv == NULL) {
+        glad_lazy_real_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_loader("glGetIntegerv");
+        if(glad_glGetIntegerv == glad_lazy_glGetIntegerv) glad_glGetIntegerv = glad_lazy_real_glGetIntegerv;
+    }
+    glad_lazy_real_glGetIntegerv(pname, data);
+}
+
+static PFNGLGETSTRINGPROC glad_lazy_real_glGetString = NULL;
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+    if(glad_lazy_real_glGetString == NULL) {
+        glad_lazy_real_glGetString = (PFNGLGETSTRINGPROC)glad_lazy_loader("glGetString");
+        if(glad_glGetString == glad_lazy_glGetString) glad_glGetString = glad_lazy_real_glGetString;
+    }
+    return glad_lazy_real_glGetString(name);
+}
+
+static PFNGLGETTEXIMAGEPROC glad_lazy_real_glGetTexImage = NULL;
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    if(glad_lazy_real_glGetTexImage == NULL) {
+        glad_lazy_real_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_loader("glGetTexImage");
+        if(glad_glGetTexImage == glad_lazy_glGetTexImage) glad_glGetTexImage = glad_lazy_real_glGetTexImage;
+    }
+    glad_lazy_real_glGetTexImage(target, level, format, type, pixels);
+}
+
+static PFNGLGETTEXPARAMETERFVPROC glad_lazy_real_glGetTexParameterfv = NULL;
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    if(glad_lazy_real_glGetTexParameterfv == NULL) {
+        glad_lazy_real_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_loader("glGetTexParameterfv");
+        if(glad_glGetTexParameterfv == glad_lazy_glGetTexParameterfv) glad_glGetTexParameterfv = glad_lazy_real_glGetTexParameterfv;
+    }
+    glad_lazy_real_glGetTexParameterfv(target, pname, params);
+}
+
+static PFNGLGETTEXPARAMETERIVPROC glad_lazy_real_glGetTexParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetTexParameteriv == NULL) {
+        glad_lazy_real_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_loader("glGetTexParameteriv");
+        if(glad_glGetTexParameteriv == glad_lazy_glGetTexParameteriv) glad_glGetTexParameteriv = glad_lazy_real_glGetTexParameteriv;
+    }
+    glad_lazy_real_glGetTexParameteriv(target, pname, params);
+}
+
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_lazy_real_glGetTexLevelParameterfv = NULL;
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    if(glad_lazy_real_glGetTexLevelParameterfv == NULL) {
+        glad_lazy_real_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_loader("glGetTexLevelParameterfv");
+        if(glad_glGetTexLevelParameterfv == glad_lazy_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = glad_lazy_real_glGetTexLevelParameterfv;
+    }
+    glad_lazy_real_glGetTexLevelParameterfv(target, level, pname, params);
+}
+
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_lazy_real_glGetTexLevelParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetTexLevelParameteriv == NULL) {
+        glad_lazy_real_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_loader("glGetTexLevelParameteriv");
+        if(glad_glGetTexLevelParameteriv == glad_lazy_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = glad_lazy_real_glGetTexLevelParameteriv;
+    }
+    glad_lazy_real_glGetTexLevelParameteriv(target, level, pname, params);
+}
+
+static PFNGLISENABLEDPROC glad_lazy_real_glIsEnabled = NULL;
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+    if(glad_lazy_real_glIsEnabled == NULL) {
+        glad_lazy_real_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_loader("glIsEnabled");
+        if(glad_glIsEnabled == glad_lazy_glIsEnabled) glad_glIsEnabled = glad_lazy_real_glIsEnabled;
+    }
+    return glad_lazy_real_glIsEnabled(cap);
+}
+
+static PFNGLDEPTHRANGEPROC glad_lazy_real_glDepthRange = NULL;
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+    if(glad_lazy_real_glDepthRange == NULL) {
+        glad_lazy_real_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_loader("glDepthRange");
+        if(glad_glDepthRange == glad_lazy_glDepthRange) glad_glDepthRange = glad_lazy_real_glDepthRange;
+    }
+    glad_lazy_real_glDepthRange(n, f);
+}
+
+static PFNGLVIEWPORTPROC glad_lazy_real_glViewport = NULL;
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glViewport == NULL) {
+        glad_lazy_real_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_loader("glViewport");
+        if(glad_glViewport == glad_lazy_glViewport) glad_glViewport = glad_lazy_real_glViewport;
+    }
+    glad_lazy_real_glViewport(x, y, width, height);
+}
+
+static PFNGLDRAWARRAYSPROC glad_lazy_real_glDrawArrays = NULL;
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    if(glad_lazy_real_glDrawArrays == NULL) {
+        glad_lazy_real_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_loader("glDrawArrays");
+        if(glad_glDrawArrays == glad_lazy_glDrawArrays) glad_glDrawArrays = glad_lazy_real_glDrawArrays;
+    }
+    glad_lazy_real_glDrawArrays(mode, first, count);
+}
+
+static PFNGLDRAWELEMENTSPROC glad_lazy_real_glDrawElements = NULL;
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    if(glad_lazy_real_glDrawElements == NULL) {
+        glad_lazy_real_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_loader("glDrawElements");
+        if(glad_glDrawElements == glad_lazy_glDrawElements) glad_glDrawElements = glad_lazy_real_glDrawElements;
+    }
+    glad_lazy_real_glDrawElements(mode, count, type, indices);
+}
+
+static PFNGLPOLYGONOFFSETPROC glad_lazy_real_glPolygonOffset = NULL;
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+    if(glad_lazy_real_glPolygonOffset == NULL) {
+        glad_lazy_real_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_loader("glPolygonOffset");
+        if(glad_glPolygonOffset == glad_lazy_glPolygonOffset) glad_glPolygonOffset = glad_lazy_real_glPolygonOffset;
+    }
+    glad_lazy_real_glPolygonOffset(factor, units);
+}
+
+static PFNGLCOPYTEXIMAGE1DPROC glad_lazy_real_glCopyTexImage1D = NULL;
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    if(glad_lazy_real_glCopyTexImage1D == NULL) {
+        glad_lazy_real_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_loader("glCopyTexImage1D");
+        if(glad_glCopyTexImage1D == glad_lazy_glCopyTexImage1D) glad_glCopyTexImage1D = glad_lazy_real_glCopyTexImage1D;
+    }
+    glad_lazy_real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static PFNGLCOPYTEXIMAGE2DPROC glad_lazy_real_glCopyTexImage2D = NULL;
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    if(glad_lazy_real_glCopyTexImage2D == NULL) {
+        glad_lazy_real_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_loader("glCopyTexImage2D");
+        if(glad_glCopyTexImage2D == glad_lazy_glCopyTexImage2D) glad_glCopyTexImage2D = glad_lazy_real_glCopyTexImage2D;
+    }
+    glad_lazy_real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_lazy_real_glCopyTexSubImage1D = NULL;
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    if(glad_lazy_real_glCopyTexSubImage1D == NULL) {
+        glad_lazy_real_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_loader("glCopyTexSubImage1D");
+        if(glad_glCopyTexSubImage1D == glad_lazy_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = glad_lazy_real_glCopyTexSubImage1D;
+    }
+    glad_lazy_real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_lazy_real_glCopyTexSubImage2D = NULL;
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glCopyTexSubImage2D == NULL) {
+        glad_lazy_real_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_loader("glCopyTexSubImage2D");
+        if(glad_glCopyTexSubImage2D == glad_lazy_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = glad_lazy_real_glCopyTexSubImage2D;
+    }
+    glad_lazy_real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static PFNGLTEXSUBIMAGE1DPROC glad_lazy_real_glTexSubImage1D = NULL;
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexSubImage1D == NULL) {
+        glad_lazy_real_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_loader("glTexSubImage1D");
+        if(glad_glTexSubImage1D == glad_lazy_glTexSubImage1D) glad_glTexSubImage1D = glad_lazy_real_glTexSubImage1D;
+    }
+    glad_lazy_real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static PFNGLTEXSUBIMAGE2DPROC glad_lazy_real_glTexSubImage2D = NULL;
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexSubImage2D == NULL) {
+        glad_lazy_real_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_loader("glTexSubImage2D");
+        if(glad_glTexSubImage2D == glad_lazy_glTexSubImage2D) glad_glTexSubImage2D = glad_lazy_real_glTexSubImage2D;
+    }
+    glad_lazy_real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static PFNGLBINDTEXTUREPROC glad_lazy_real_glBindTexture = NULL;
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+    if(glad_lazy_real_glBindTexture == NULL) {
+        glad_lazy_real_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_loader("glBindTexture");
+        if(glad_glBindTexture == glad_lazy_glBindTexture) glad_glBindTexture = glad_lazy_real_glBindTexture;
+    }
+    glad_lazy_real_glBindTexture(target, texture);
+}
+
+static PFNGLDELETETEXTURESPROC glad_lazy_real_glDeleteTextures = NULL;
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    if(glad_lazy_real_glDeleteTextures == NULL) {
+        glad_lazy_real_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_loader("glDeleteTextures");
+        if(glad_glDeleteTextures == glad_lazy_glDeleteTextures) glad_glDeleteTextures = glad_lazy_real_glDeleteTextures;
+    }
+    glad_lazy_real_glDeleteTextures(n, textures);
+}
+
+static PFNGLGENTEXTURESPROC glad_lazy_real_glGenTextures = NULL;
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+    if(glad_lazy_real_glGenTextures == NULL) {
+        glad_lazy_real_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_loader("glGenTextures");
+        if(glad_glGenTextures == glad_lazy_glGenTextures) glad_glGenTextures = glad_lazy_real_glGenTextures;
+    }
+    glad_lazy_real_glGenTextures(n, textures);
+}
+
+static PFNGLISTEXTUREPROC glad_lazy_real_glIsTexture = NULL;
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+    if(glad_lazy_real_glIsTexture == NULL) {
+        glad_lazy_real_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_loader("glIsTexture");
+        if(glad_glIsTexture == glad_lazy_glIsTexture) glad_glIsTexture = glad_lazy_real_glIsTexture;
+    }
+    return glad_lazy_real_glIsTexture(texture);
+}
+
+static PFNGLDRAWRANGEELEMENTSPROC glad_lazy_real_glDrawRangeElements = NULL;
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    if(glad_lazy_real_glDrawRangeElements == NULL) {
+        glad_lazy_real_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_loader("glDrawRangeElements");
+        if(glad_glDrawRangeElements == glad_lazy_glDrawRangeElements) glad_glDrawRangeElements = glad_lazy_real_glDrawRangeElements;
+    }
+    glad_lazy_real_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static PFNGLTEXIMAGE3DPROC glad_lazy_real_glTexImage3D = NULL;
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexImage3D == NULL) {
+        glad_lazy_real_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_loader("glTexImage3D");
+        if(glad_glTexImage3D == glad_lazy_glTexImage3D) glad_glTexImage3D = glad_lazy_real_glTexImage3D;
+    }
+    glad_lazy_real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static PFNGLTEXSUBIMAGE3DPROC glad_lazy_real_glTexSubImage3D = NULL;
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if(glad_lazy_real_glTexSubImage3D == NULL) {
+        glad_lazy_real_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_loader("glTexSubImage3D");
+        if(glad_glTexSubImage3D == glad_lazy_glTexSubImage3D) glad_glTexSubImage3D = glad_lazy_real_glTexSubImage3D;
+    }
+    glad_lazy_real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_lazy_real_glCopyTexSubImage3D = NULL;
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glCopyTexSubImage3D == NULL) {
+        glad_lazy_real_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_loader("glCopyTexSubImage3D");
+        if(glad_glCopyTexSubImage3D == glad_lazy_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = glad_lazy_real_glCopyTexSubImage3D;
+    }
+    glad_lazy_real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static PFNGLACTIVETEXTUREPROC glad_lazy_real_glActiveTexture = NULL;
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+    if(glad_lazy_real_glActiveTexture == NULL) {
+        glad_lazy_real_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_loader("glActiveTexture");
+        if(glad_glActiveTexture == glad_lazy_glActiveTexture) glad_glActiveTexture = glad_lazy_real_glActiveTexture;
+    }
+    glad_lazy_real_glActiveTexture(texture);
+}
+
+static PFNGLSAMPLECOVERAGEPROC glad_lazy_real_glSampleCoverage = NULL;
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+    if(glad_lazy_real_glSampleCoverage == NULL) {
+        glad_lazy_real_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_loader("glSampleCoverage");
+        if(glad_glSampleCoverage == glad_lazy_glSampleCoverage) glad_glSampleCoverage = glad_lazy_real_glSampleCoverage;
+    }
+    glad_lazy_real_glSampleCoverage(value, invert);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_lazy_real_glCompressedTexImage3D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexImage3D == NULL) {
+        glad_lazy_real_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_loader("glCompressedTexImage3D");
+        if(glad_glCompressedTexImage3D == glad_lazy_glCompressedTexImage3D) glad_glCompressedTexImage3D = glad_lazy_real_glCompressedTexImage3D;
+    }
+    glad_lazy_real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_lazy_real_glCompressedTexImage2D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexImage2D == NULL) {
+        glad_lazy_real_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_loader("glCompressedTexImage2D");
+        if(glad_glCompressedTexImage2D == glad_lazy_glCompressedTexImage2D) glad_glCompressedTexImage2D = glad_lazy_real_glCompressedTexImage2D;
+    }
+    glad_lazy_real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_lazy_real_glCompressedTexImage1D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexImage1D == NULL) {
+        glad_lazy_real_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_loader("glCompressedTexImage1D");
+        if(glad_glCompressedTexImage1D == glad_lazy_glCompressedTexImage1D) glad_glCompressedTexImage1D = glad_lazy_real_glCompressedTexImage1D;
+    }
+    glad_lazy_real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_lazy_real_glCompressedTexSubImage3D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexSubImage3D == NULL) {
+        glad_lazy_real_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_loader("glCompressedTexSubImage3D");
+        if(glad_glCompressedTexSubImage3D == glad_lazy_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = glad_lazy_real_glCompressedTexSubImage3D;
+    }
+    glad_lazy_real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_lazy_real_glCompressedTexSubImage2D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexSubImage2D == NULL) {
+        glad_lazy_real_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_loader("glCompressedTexSubImage2D");
+        if(glad_glCompressedTexSubImage2D == glad_lazy_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = glad_lazy_real_glCompressedTexSubImage2D;
+    }
+    glad_lazy_real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_lazy_real_glCompressedTexSubImage1D = NULL;
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    if(glad_lazy_real_glCompressedTexSubImage1D == NULL) {
+        glad_lazy_real_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_loader("glCompressedTexSubImage1D");
+        if(glad_glCompressedTexSubImage1D == glad_lazy_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = glad_lazy_real_glCompressedTexSubImage1D;
+    }
+    glad_lazy_real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_lazy_real_glGetCompressedTexImage = NULL;
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    if(glad_lazy_real_glGetCompressedTexImage == NULL) {
+        glad_lazy_real_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_loader("glGetCompressedTexImage");
+        if(glad_glGetCompressedTexImage == glad_lazy_glGetCompressedTexImage) glad_glGetCompressedTexImage = glad_lazy_real_glGetCompressedTexImage;
+    }
+    glad_lazy_real_glGetCompressedTexImage(target, level, img);
+}
+
+static PFNGLBLENDFUNCSEPARATEPROC glad_lazy_real_glBlendFuncSeparate = NULL;
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    if(glad_lazy_real_glBlendFuncSeparate == NULL) {
+        glad_lazy_real_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_loader("glBlendFuncSeparate");
+        if(glad_glBlendFuncSeparate == glad_lazy_glBlendFuncSeparate) glad_glBlendFuncSeparate = glad_lazy_real_glBlendFuncSeparate;
+    }
+    glad_lazy_real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static PFNGLMULTIDRAWARRAYSPROC glad_lazy_real_glMultiDrawArrays = NULL;
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    if(glad_lazy_real_glMultiDrawArrays == NULL) {
+        glad_lazy_real_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_loader("glMultiDrawArrays");
+        if(glad_glMultiDrawArrays == glad_lazy_glMultiDrawArrays) glad_glMultiDrawArrays = glad_lazy_real_glMultiDrawArrays;
+    }
+    glad_lazy_real_glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static PFNGLMULTIDRAWELEMENTSPROC glad_lazy_real_glMultiDrawElements = NULL;
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    if(glad_lazy_real_glMultiDrawElements == NULL) {
+        glad_lazy_real_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_loader("glMultiDrawElements");
+        if(glad_glMultiDrawElements == glad_lazy_glMultiDrawElements) glad_glMultiDrawElements = glad_lazy_real_glMultiDrawElements;
+    }
+    glad_lazy_real_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static PFNGLPOINTPARAMETERFPROC glad_lazy_real_glPointParameterf = NULL;
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+    if(glad_lazy_real_glPointParameterf == NULL) {
+        glad_lazy_real_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_loader("glPointParameterf");
+        if(glad_glPointParameterf == glad_lazy_glPointParameterf) glad_glPointParameterf = glad_lazy_real_glPointParameterf;
+    }
+    glad_lazy_real_glPointParameterf(pname, param);
+}
+
+static PFNGLPOINTPARAMETERFVPROC glad_lazy_real_glPointParameterfv = NULL;
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    if(glad_lazy_real_glPointParameterfv == NULL) {
+        glad_lazy_real_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_loader("glPointParameterfv");
+        if(glad_glPointParameterfv == glad_lazy_glPointParameterfv) glad_glPointParameterfv = glad_lazy_real_glPointParameterfv;
+    }
+    glad_lazy_real_glPointParameterfv(pname, params);
+}
+
+static PFNGLPOINTPARAMETERIPROC glad_lazy_real_glPointParameteri = NULL;
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+    if(glad_lazy_real_glPointParameteri == NULL) {
+        glad_lazy_real_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_loader("glPointParameteri");
+        if(glad_glPointParameteri == glad_lazy_glPointParameteri) glad_glPointParameteri = glad_lazy_real_glPointParameteri;
+    }
+    glad_lazy_real_glPointParameteri(pname, param);
+}
+
+static PFNGLPOINTPARAMETERIVPROC glad_lazy_real_glPointParameteriv = NULL;
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+    if(glad_lazy_real_glPointParameteriv == NULL) {
+        glad_lazy_real_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_loader("glPointParameteriv");
+        if(glad_glPointParameteriv == glad_lazy_glPointParameteriv) glad_glPointParameteriv = glad_lazy_real_glPointParameteriv;
+    }
+    glad_lazy_real_glPointParameteriv(pname, params);
+}
+
+static PFNGLBLENDCOLORPROC glad_lazy_real_glBlendColor = NULL;
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if(glad_lazy_real_glBlendColor == NULL) {
+        glad_lazy_real_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_loader("glBlendColor");
+        if(glad_glBlendColor == glad_lazy_glBlendColor) glad_glBlendColor = glad_lazy_real_glBlendColor;
+    }
+    glad_lazy_real_glBlendColor(red, green, blue, alpha);
+}
+
+static PFNGLBLENDEQUATIONPROC glad_lazy_real_glBlendEquation = NULL;
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+    if(glad_lazy_real_glBlendEquation == NULL) {
+        glad_lazy_real_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_loader("glBlendEquation");
+        if(glad_glBlendEquation == glad_lazy_glBlendEquation) glad_glBlendEquation = glad_lazy_real_glBlendEquation;
+    }
+    glad_lazy_real_glBlendEquation(mode);
+}
+
+static PFNGLGENQUERIESPROC glad_lazy_real_glGenQueries = NULL;
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+    if(glad_lazy_real_glGenQueries == NULL) {
+        glad_lazy_real_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_loader("glGenQueries");
+        if(glad_glGenQueries == glad_lazy_glGenQueries) glad_glGenQueries = glad_lazy_real_glGenQueries;
+    }
+    glad_lazy_real_glGenQueries(n, ids);
+}
+
+static PFNGLDELETEQUERIESPROC glad_lazy_real_glDeleteQueries = NULL;
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    if(glad_lazy_real_glDeleteQueries == NULL) {
+        glad_lazy_real_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_loader("glDeleteQueries");
+        if(glad_glDeleteQueries == glad_lazy_glDeleteQueries) glad_glDeleteQueries = glad_lazy_real_glDeleteQueries;
+    }
+    glad_lazy_real_glDeleteQueries(n, ids);
+}
+
+static PFNGLISQUERYPROC glad_lazy_real_glIsQuery = NULL;
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+    if(glad_lazy_real_glIsQuery == NULL) {
+        glad_lazy_real_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_loader("glIsQuery");
+        if(glad_glIsQuery == glad_lazy_glIsQuery) glad_glIsQuery = glad_lazy_real_glIsQuery;
+    }
+    return glad_lazy_real_glIsQuery(id);
+}
+
+static PFNGLBEGINQUERYPROC glad_lazy_real_glBeginQuery = NULL;
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+    if(glad_lazy_real_glBeginQuery == NULL) {
+        glad_lazy_real_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_loader("glBeginQuery");
+        if(glad_glBeginQuery == glad_lazy_glBeginQuery) glad_glBeginQuery = glad_lazy_real_glBeginQuery;
+    }
+    glad_lazy_real_glBeginQuery(target, id);
+}
+
+static PFNGLENDQUERYPROC glad_lazy_real_glEndQuery = NULL;
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+    if(glad_lazy_real_glEndQuery == NULL) {
+        glad_lazy_real_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_loader("glEndQuery");
+        if(glad_glEndQuery == glad_lazy_glEndQuery) glad_glEndQuery = glad_lazy_real_glEndQuery;
+    }
+    glad_lazy_real_glEndQuery(target);
+}
+
+static PFNGLGETQUERYIVPROC glad_lazy_real_glGetQueryiv = NULL;
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetQueryiv == NULL) {
+        glad_lazy_real_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_loader("glGetQueryiv");
+        if(glad_glGetQueryiv == glad_lazy_glGetQueryiv) glad_glGetQueryiv = glad_lazy_real_glGetQueryiv;
+    }
+    glad_lazy_real_glGetQueryiv(target, pname, params);
+}
+
+static PFNGLGETQUERYOBJECTIVPROC glad_lazy_real_glGetQueryObjectiv = NULL;
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetQueryObjectiv == NULL) {
+        glad_lazy_real_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_loader("glGetQueryObjectiv");
+        if(glad_glGetQueryObjectiv == glad_lazy_glGetQueryObjectiv) glad_glGetQueryObjectiv = glad_lazy_real_glGetQueryObjectiv;
+    }
+    glad_lazy_real_glGetQueryObjectiv(id, pname, params);
+}
+
+static PFNGLGETQUERYOBJECTUIVPROC glad_lazy_real_glGetQueryObjectuiv = NULL;
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    if(glad_lazy_real_glGetQueryObjectuiv == NULL) {
+        glad_lazy_real_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_loader("glGetQueryObjectuiv");
+        if(glad_glGetQueryObjectuiv == glad_lazy_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = glad_lazy_real_glGetQueryObjectuiv;
+    }
+    glad_lazy_real_glGetQueryObjectuiv(id, pname, params);
+}
+
+static PFNGLBINDBUFFERPROC glad_lazy_real_glBindBuffer = NULL;
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+    if(glad_lazy_real_glBindBuffer == NULL) {
+        glad_lazy_real_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_loader("glBindBuffer");
+        if(glad_glBindBuffer == glad_lazy_glBindBuffer) glad_glBindBuffer = glad_lazy_real_glBindBuffer;
+    }
+    glad_lazy_real_glBindBuffer(target, buffer);
+}
+
+static PFNGLDELETEBUFFERSPROC glad_lazy_real_glDeleteBuffers = NULL;
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    if(glad_lazy_real_glDeleteBuffers == NULL) {
+        glad_lazy_real_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_loader("glDeleteBuffers");
+        if(glad_glDeleteBuffers == glad_lazy_glDeleteBuffers) glad_glDeleteBuffers = glad_lazy_real_glDeleteBuffers;
+    }
+    glad_lazy_real_glDeleteBuffers(n, buffers);
+}
+
+static PFNGLGENBUFFERSPROC glad_lazy_real_glGenBuffers = NULL;
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+    if(glad_lazy_real_glGenBuffers == NULL) {
+        glad_lazy_real_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_loader("glGenBuffers");
+        if(glad_glGenBuffers == glad_lazy_glGenBuffers) glad_glGenBuffers = glad_lazy_real_glGenBuffers;
+    }
+    glad_lazy_real_glGenBuffers(n, buffers);
+}
+
+static PFNGLISBUFFERPROC glad_lazy_real_glIsBuffer = NULL;
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+    if(glad_lazy_real_glIsBuffer == NULL) {
+        glad_lazy_real_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_loader("glIsBuffer");
+        if(glad_glIsBuffer == glad_lazy_glIsBuffer) glad_glIsBuffer = glad_lazy_real_glIsBuffer;
+    }
+    return glad_lazy_real_glIsBuffer(buffer);
+}
+
+static PFNGLBUFFERDATAPROC glad_lazy_real_glBufferData = NULL;
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    if(glad_lazy_real_glBufferData == NULL) {
+        glad_lazy_real_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_loader("glBufferData");
+        if(glad_glBufferData == glad_lazy_glBufferData) glad_glBufferData = glad_lazy_real_glBufferData;
+    }
+    glad_lazy_real_glBufferData(target, size, data, usage);
+}
+
+static PFNGLBUFFERSUBDATAPROC glad_lazy_real_glBufferSubData = NULL;
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    if(glad_lazy_real_glBufferSubData == NULL) {
+        glad_lazy_real_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_loader("glBufferSubData");
+        if(glad_glBufferSubData == glad_lazy_glBufferSubData) glad_glBufferSubData = glad_lazy_real_glBufferSubData;
+    }
+    glad_lazy_real_glBufferSubData(target, offset, size, data);
+}
+
+static PFNGLGETBUFFERSUBDATAPROC glad_lazy_real_glGetBufferSubData = NULL;
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    if(glad_lazy_real_glGetBufferSubData == NULL) {
+        glad_lazy_real_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_loader("glGetBufferSubData");
+        if(glad_glGetBufferSubData == glad_lazy_glGetBufferSubData) glad_glGetBufferSubData = glad_lazy_real_glGetBufferSubData;
+    }
+    glad_lazy_real_glGetBufferSubData(target, offset, size, data);
+}
+
+static PFNGLMAPBUFFERPROC glad_lazy_real_glMapBuffer = NULL;
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+    if(glad_lazy_real_glMapBuffer == NULL) {
+        glad_lazy_real_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_loader("glMapBuffer");
+        if(glad_glMapBuffer == glad_lazy_glMapBuffer) glad_glMapBuffer = glad_lazy_real_glMapBuffer;
+    }
+    return glad_lazy_real_glMapBuffer(target, access);
+}
+
+static PFNGLUNMAPBUFFERPROC glad_lazy_real_glUnmapBuffer = NULL;
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+    if(glad_lazy_real_glUnmapBuffer == NULL) {
+        glad_lazy_real_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_loader("glUnmapBuffer");
+        if(glad_glUnmapBuffer == glad_lazy_glUnmapBuffer) glad_glUnmapBuffer = glad_lazy_real_glUnmapBuffer;
+    }
+    return glad_lazy_real_glUnmapBuffer(target);
+}
+
+static PFNGLGETBUFFERPARAMETERIVPROC glad_lazy_real_glGetBufferParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetBufferParameteriv == NULL) {
+        glad_lazy_real_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_loader("glGetBufferParameteriv");
+        if(glad_glGetBufferParameteriv == glad_lazy_glGetBufferParameteriv) glad_glGetBufferParameteriv = glad_lazy_real_glGetBufferParameteriv;
+    }
+    glad_lazy_real_glGetBufferParameteriv(target, pname, params);
+}
+
+static PFNGLGETBUFFERPOINTERVPROC glad_lazy_real_glGetBufferPointerv = NULL;
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    if(glad_lazy_real_glGetBufferPointerv == NULL) {
+        glad_lazy_real_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_loader("glGetBufferPointerv");
+        if(glad_glGetBufferPointerv == glad_lazy_glGetBufferPointerv) glad_glGetBufferPointerv = glad_lazy_real_glGetBufferPointerv;
+    }
+    glad_lazy_real_glGetBufferPointerv(target, pname, params);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_lazy_real_glBlendEquationSeparate = NULL;
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    if(glad_lazy_real_glBlendEquationSeparate == NULL) {
+        glad_lazy_real_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_loader("glBlendEquationSeparate");
+        if(glad_glBlendEquationSeparate == glad_lazy_glBlendEquationSeparate) glad_glBlendEquationSeparate = glad_lazy_real_glBlendEquationSeparate;
+    }
+    glad_lazy_real_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static PFNGLDRAWBUFFERSPROC glad_lazy_real_glDrawBuffers = NULL;
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    if(glad_lazy_real_glDrawBuffers == NULL) {
+        glad_lazy_real_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_loader("glDrawBuffers");
+        if(glad_glDrawBuffers == glad_lazy_glDrawBuffers) glad_glDrawBuffers = glad_lazy_real_glDrawBuffers;
+    }
+    glad_lazy_real_glDrawBuffers(n, bufs);
+}
+
+static PFNGLSTENCILOPSEPARATEPROC glad_lazy_real_glStencilOpSeparate = NULL;
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    if(glad_lazy_real_glStencilOpSeparate == NULL) {
+        glad_lazy_real_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_loader("glStencilOpSeparate");
+        if(glad_glStencilOpSeparate == glad_lazy_glStencilOpSeparate) glad_glStencilOpSeparate = glad_lazy_real_glStencilOpSeparate;
+    }
+    glad_lazy_real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static PFNGLSTENCILFUNCSEPARATEPROC glad_lazy_real_glStencilFuncSeparate = NULL;
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    if(glad_lazy_real_glStencilFuncSeparate == NULL) {
+        glad_lazy_real_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_loader("glStencilFuncSeparate");
+        if(glad_glStencilFuncSeparate == glad_lazy_glStencilFuncSeparate) glad_glStencilFuncSeparate = glad_lazy_real_glStencilFuncSeparate;
+    }
+    glad_lazy_real_glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static PFNGLSTENCILMASKSEPARATEPROC glad_lazy_real_glStencilMaskSeparate = NULL;
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    if(glad_lazy_real_glStencilMaskSeparate == NULL) {
+        glad_lazy_real_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_loader("glStencilMaskSeparate");
+        if(glad_glStencilMaskSeparate == glad_lazy_glStencilMaskSeparate) glad_glStencilMaskSeparate = glad_lazy_real_glStencilMaskSeparate;
+    }
+    glad_lazy_real_glStencilMaskSeparate(face, mask);
+}
+
+static PFNGLATTACHSHADERPROC glad_lazy_real_glAttachShader = NULL;
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+    if(glad_lazy_real_glAttachShader == NULL) {
+        glad_lazy_real_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_loader("glAttachShader");
+        if(glad_glAttachShader == glad_lazy_glAttachShader) glad_glAttachShader = glad_lazy_real_glAttachShader;
+    }
+    glad_lazy_real_glAttachShader(program, shader);
+}
+
+static PFNGLBINDATTRIBLOCATIONPROC glad_lazy_real_glBindAttribLocation = NULL;
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    if(glad_lazy_real_glBindAttribLocation == NULL) {
+        glad_lazy_real_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_loader("glBindAttribLocation");
+        if(glad_glBindAttribLocation == glad_lazy_glBindAttribLocation) glad_glBindAttribLocation = glad_lazy_real_glBindAttribLocation;
+    }
+    glad_lazy_real_glBindAttribLocation(program, index, name);
+}
+
+static PFNGLCOMPILESHADERPROC glad_lazy_real_glCompileShader = NULL;
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+    if(glad_lazy_real_glCompileShader == NULL) {
+        glad_lazy_real_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_loader("glCompileShader");
+        if(glad_glCompileShader == glad_lazy_glCompileShader) glad_glCompileShader = glad_lazy_real_glCompileShader;
+    }
+    glad_lazy_real_glCompileShader(shader);
+}
+
+static PFNGLCREATEPROGRAMPROC glad_lazy_real_glCreateProgram = NULL;
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+    if(glad_lazy_real_glCreateProgram == NULL) {
+        glad_lazy_real_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_loader("glCreateProgram");
+        if(glad_glCreateProgram == glad_lazy_glCreateProgram) glad_glCreateProgram = glad_lazy_real_glCreateProgram;
+    }
+    return glad_lazy_real_glCreateProgram();
+}
+
+static PFNGLCREATESHADERPROC glad_lazy_real_glCreateShader = NULL;
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+    if(glad_lazy_real_glCreateShader == NULL) {
+        glad_lazy_real_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_loader("glCreateShader");
+        if(glad_glCreateShader == glad_lazy_glCreateShader) glad_glCreateShader = glad_lazy_real_glCreateShader;
+    }
+    return glad_lazy_real_glCreateShader(type);
+}
+
+static PFNGLDELETEPROGRAMPROC glad_lazy_real_glDeleteProgram = NULL;
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+    if(glad_lazy_real_glDeleteProgram == NULL) {
+        glad_lazy_real_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_loader("glDeleteProgram");
+        if(glad_glDeleteProgram == glad_lazy_glDeleteProgram) glad_glDeleteProgram = glad_lazy_real_glDeleteProgram;
+    }
+    glad_lazy_real_glDeleteProgram(program);
+}
+
+static PFNGLDELETESHADERPROC glad_lazy_real_glDeleteShader = NULL;
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+    if(glad_lazy_real_glDeleteShader == NULL) {
+        glad_lazy_real_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_loader("glDeleteShader");
+        if(glad_glDeleteShader == glad_lazy_glDeleteShader) glad_glDeleteShader = glad_lazy_real_glDeleteShader;
+    }
+    glad_lazy_real_glDeleteShader(shader);
+}
+
+static PFNGLDETACHSHADERPROC glad_lazy_real_glDetachShader = NULL;
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+    if(glad_lazy_real_glDetachShader == NULL) {
+        glad_lazy_real_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_loader("glDetachShader");
+        if(glad_glDetachShader == glad_lazy_glDetachShader) glad_glDetachShader = glad_lazy_real_glDetachShader;
+    }
+    glad_lazy_real_glDetachShader(program, shader);
+}
+
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_lazy_real_glDisableVertexAttribArray = NULL;
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+    if(glad_lazy_real_glDisableVertexAttribArray == NULL) {
+        glad_lazy_real_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_loader("glDisableVertexAttribArray");
+        if(glad_glDisableVertexAttribArray == glad_lazy_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = glad_lazy_real_glDisableVertexAttribArray;
+    }
+    glad_lazy_real_glDisableVertexAttribArray(index);
+}
+
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_lazy_real_glEnableVertexAttribArray = NULL;
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+    if(glad_lazy_real_glEnableVertexAttribArray == NULL) {
+        glad_lazy_real_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_loader("glEnableVertexAttribArray");
+        if(glad_glEnableVertexAttribArray == glad_lazy_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = glad_lazy_real_glEnableVertexAttribArray;
+    }
+    glad_lazy_real_glEnableVertexAttribArray(index);
+}
+
+static PFNGLGETACTIVEATTRIBPROC glad_lazy_real_glGetActiveAttrib = NULL;
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    if(glad_lazy_real_glGetActiveAttrib == NULL) {
+        glad_lazy_real_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_loader("glGetActiveAttrib");
+        if(glad_glGetActiveAttrib == glad_lazy_glGetActiveAttrib) glad_glGetActiveAttrib = glad_lazy_real_glGetActiveAttrib;
+    }
+    glad_lazy_real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+static PFNGLGETACTIVEUNIFORMPROC glad_lazy_real_glGetActiveUniform = NULL;
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    if(glad_lazy_real_glGetActiveUniform == NULL) {
+        glad_lazy_real_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_loader("glGetActiveUniform");
+        if(glad_glGetActiveUniform == glad_lazy_glGetActiveUniform) glad_glGetActiveUniform = glad_lazy_real_glGetActiveUniform;
+    }
+    glad_lazy_real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+static PFNGLGETATTACHEDSHADERSPROC glad_lazy_real_glGetAttachedShaders = NULL;
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    if(glad_lazy_real_glGetAttachedShaders == NULL) {
+        glad_lazy_real_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_loader("glGetAttachedShaders");
+        if(glad_glGetAttachedShaders == glad_lazy_glGetAttachedShaders) glad_glGetAttachedShaders = glad_lazy_real_glGetAttachedShaders;
+    }
+    glad_lazy_real_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+
+static PFNGLGETATTRIBLOCATIONPROC glad_lazy_real_glGetAttribLocation = NULL;
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+    if(glad_lazy_real_glGetAttribLocation == NULL) {
+        glad_lazy_real_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_loader("glGetAttribLocation");
+        if(glad_glGetAttribLocation == glad_lazy_glGetAttribLocation) glad_glGetAttribLocation = glad_lazy_real_glGetAttribLocation;
+    }
+    return glad_lazy_real_glGetAttribLocation(program, name);
+}
+
+static PFNGLGETPROGRAMIVPROC glad_lazy_real_glGetProgramiv = NULL;
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetProgramiv == NULL) {
+        glad_lazy_real_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_loader("glGetProgramiv");
+        if(glad_glGetProgramiv == glad_lazy_glGetProgramiv) glad_glGetProgramiv = glad_lazy_real_glGetProgramiv;
+    }
+    glad_lazy_real_glGetProgramiv(program, pname, params);
+}
+
+static PFNGLGETPROGRAMINFOLOGPROC glad_lazy_real_glGetProgramInfoLog = NULL;
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if(glad_lazy_real_glGetProgramInfoLog == NULL) {
+        glad_lazy_real_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_loader("glGetProgramInfoLog");
+        if(glad_glGetProgramInfoLog == glad_lazy_glGetProgramInfoLog) glad_glGetProgramInfoLog = glad_lazy_real_glGetProgramInfoLog;
+    }
+    glad_lazy_real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+static PFNGLGETSHADERIVPROC glad_lazy_real_glGetShaderiv = NULL;
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetShaderiv == NULL) {
+        glad_lazy_real_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_loader("glGetShaderiv");
+        if(glad_glGetShaderiv == glad_lazy_glGetShaderiv) glad_glGetShaderiv = glad_lazy_real_glGetShaderiv;
+    }
+    glad_lazy_real_glGetShaderiv(shader, pname, params);
+}
+
+static PFNGLGETSHADERINFOLOGPROC glad_lazy_real_glGetShaderInfoLog = NULL;
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if(glad_lazy_real_glGetShaderInfoLog == NULL) {
+        glad_lazy_real_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_loader("glGetShaderInfoLog");
+        if(glad_glGetShaderInfoLog == glad_lazy_glGetShaderInfoLog) glad_glGetShaderInfoLog = glad_lazy_real_glGetShaderInfoLog;
+    }
+    glad_lazy_real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+static PFNGLGETSHADERSOURCEPROC glad_lazy_real_glGetShaderSource = NULL;
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    if(glad_lazy_real_glGetShaderSource == NULL) {
+        glad_lazy_real_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_loader("glGetShaderSource");
+        if(glad_glGetShaderSource == glad_lazy_glGetShaderSource) glad_glGetShaderSource = glad_lazy_real_glGetShaderSource;
+    }
+    glad_lazy_real_glGetShaderSource(shader, bufSize, length, source);
+}
+
+static PFNGLGETUNIFORMLOCATIONPROC glad_lazy_real_glGetUniformLocation = NULL;
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+    if(glad_lazy_real_glGetUniformLocation == NULL) {
+        glad_lazy_real_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_loader("glGetUniformLocation");
+        if(glad_glGetUniformLocation == glad_lazy_glGetUniformLocation) glad_glGetUniformLocation = glad_lazy_real_glGetUniformLocation;
+    }
+    return glad_lazy_real_glGetUniformLocation(program, name);
+}
+
+static PFNGLGETUNIFORMFVPROC glad_lazy_real_glGetUniformfv = NULL;
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    if(glad_lazy_real_glGetUniformfv == NULL) {
+        glad_lazy_real_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_loader("glGetUniformfv");
+        if(glad_glGetUniformfv == glad_lazy_glGetUniformfv) glad_glGetUniformfv = glad_lazy_real_glGetUniformfv;
+    }
+    glad_lazy_real_glGetUniformfv(program, location, params);
+}
+
+static PFNGLGETUNIFORMIVPROC glad_lazy_real_glGetUniformiv = NULL;
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    if(glad_lazy_real_glGetUniformiv == NULL) {
+        glad_lazy_real_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_loader("glGetUniformiv");
+        if(glad_glGetUniformiv == glad_lazy_glGetUniformiv) glad_glGetUniformiv = glad_lazy_real_glGetUniformiv;
+    }
+    glad_lazy_real_glGetUniformiv(program, location, params);
+}
+
+static PFNGLGETVERTEXATTRIBDVPROC glad_lazy_real_glGetVertexAttribdv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    if(glad_lazy_real_glGetVertexAttribdv == NULL) {
+        glad_lazy_real_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_loader("glGetVertexAttribdv");
+        if(glad_glGetVertexAttribdv == glad_lazy_glGetVertexAttribdv) glad_glGetVertexAttribdv = glad_lazy_real_glGetVertexAttribdv;
+    }
+    glad_lazy_real_glGetVertexAttribdv(index, pname, params);
+}
+
+static PFNGLGETVERTEXATTRIBFVPROC glad_lazy_real_glGetVertexAttribfv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    if(glad_lazy_real_glGetVertexAttribfv == NULL) {
+        glad_lazy_real_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_loader("glGetVertexAttribfv");
+        if(glad_glGetVertexAttribfv == glad_lazy_glGetVertexAttribfv) glad_glGetVertexAttribfv = glad_lazy_real_glGetVertexAttribfv;
+    }
+    glad_lazy_real_glGetVertexAttribfv(index, pname, params);
+}
+
+static PFNGLGETVERTEXATTRIBIVPROC glad_lazy_real_glGetVertexAttribiv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetVertexAttribiv == NULL) {
+        glad_lazy_real_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_loader("glGetVertexAttribiv");
+        if(glad_glGetVertexAttribiv == glad_lazy_glGetVertexAttribiv) glad_glGetVertexAttribiv = glad_lazy_real_glGetVertexAttribiv;
+    }
+    glad_lazy_real_glGetVertexAttribiv(index, pname, params);
+}
+
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_lazy_real_glGetVertexAttribPointerv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    if(glad_lazy_real_glGetVertexAttribPointerv == NULL) {
+        glad_lazy_real_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_loader("glGetVertexAttribPointerv");
+        if(glad_glGetVertexAttribPointerv == glad_lazy_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = glad_lazy_real_glGetVertexAttribPointerv;
+    }
+    glad_lazy_real_glGetVertexAttribPointerv(index, pname, pointer);
+}
+
+static PFNGLISPROGRAMPROC glad_lazy_real_glIsProgram = NULL;
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+    if(glad_lazy_real_glIsProgram == NULL) {
+        glad_lazy_real_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_loader("glIsProgram");
+        if(glad_glIsProgram == glad_lazy_glIsProgram) glad_glIsProgram = glad_lazy_real_glIsProgram;
+    }
+    return glad_lazy_real_glIsProgram(program);
+}
+
+static PFNGLISSHADERPROC glad_lazy_real_glIsShader = NULL;
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+    if(glad_lazy_real_glIsShader == NULL) {
+        glad_lazy_real_glIsShader = (PFNGLISSHADERPROC)glad_lazy_loader("glIsShader");
+        if(glad_glIsShader == glad_lazy_glIsShader) glad_glIsShader = glad_lazy_real_glIsShader;
+    }
+    return glad_lazy_real_glIsShader(shader);
+}
+
+static PFNGLLINKPROGRAMPROC glad_lazy_real_glLinkProgram = NULL;
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+    if(glad_lazy_real_glLinkProgram == NULL) {
+        glad_lazy_real_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_loader("glLinkProgram");
+        if(glad_glLinkProgram == glad_lazy_glLinkProgram) glad_glLinkProgram = glad_lazy_real_glLinkProgram;
+    }
+    glad_lazy_real_glLinkProgram(program);
+}
+
+static PFNGLSHADERSOURCEPROC glad_lazy_real_glShaderSource = NULL;
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    if(glad_lazy_real_glShaderSource == NULL) {
+        glad_lazy_real_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_loader("glShaderSource");
+        if(glad_glShaderSource == glad_lazy_glShaderSource) glad_glShaderSource = glad_lazy_real_glShaderSource;
+    }
+    glad_lazy_real_glShaderSource(shader, count, string, length);
+}
+
+static PFNGLUSEPROGRAMPROC glad_lazy_real_glUseProgram = NULL;
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+    if(glad_lazy_real_glUseProgram == NULL) {
+        glad_lazy_real_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_loader("glUseProgram");
+        if(glad_glUseProgram == glad_lazy_glUseProgram) glad_glUseProgram = glad_lazy_real_glUseProgram;
+    }
+    glad_lazy_real_glUseProgram(program);
+}
+
+static PFNGLUNIFORM1FPROC glad_lazy_real_glUniform1f = NULL;
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+    if(glad_lazy_real_glUniform1f == NULL) {
+        glad_lazy_real_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_loader("glUniform1f");
+        if(glad_glUniform1f == glad_lazy_glUniform1f) glad_glUniform1f = glad_lazy_real_glUniform1f;
+    }
+    glad_lazy_real_glUniform1f(location, v0);
+}
+
+static PFNGLUNIFORM2FPROC glad_lazy_real_glUniform2f = NULL;
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    if(glad_lazy_real_glUniform2f == NULL) {
+        glad_lazy_real_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_loader("glUniform2f");
+        if(glad_glUniform2f == glad_lazy_glUniform2f) glad_glUniform2f = glad_lazy_real_glUniform2f;
+    }
+    glad_lazy_real_glUniform2f(location, v0, v1);
+}
+
+static PFNGLUNIFORM3FPROC glad_lazy_real_glUniform3f = NULL;
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if(glad_lazy_real_glUniform3f == NULL) {
+        glad_lazy_real_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_loader("glUniform3f");
+        if(glad_glUniform3f == glad_lazy_glUniform3f) glad_glUniform3f = glad_lazy_real_glUniform3f;
+    }
+    glad_lazy_real_glUniform3f(location, v0, v1, v2);
+}
+
+static PFNGLUNIFORM4FPROC glad_lazy_real_glUniform4f = NULL;
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if(glad_lazy_real_glUniform4f == NULL) {
+        glad_lazy_real_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_loader("glUniform4f");
+        if(glad_glUniform4f == glad_lazy_glUniform4f) glad_glUniform4f = glad_lazy_real_glUniform4f;
+    }
+    glad_lazy_real_glUniform4f(location, v0, v1, v2, v3);
+}
+
+static PFNGLUNIFORM1IPROC glad_lazy_real_glUniform1i = NULL;
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+    if(glad_lazy_real_glUniform1i == NULL) {
+        glad_lazy_real_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_loader("glUniform1i");
+        if(glad_glUniform1i == glad_lazy_glUniform1i) glad_glUniform1i = glad_lazy_real_glUniform1i;
+    }
+    glad_lazy_real_glUniform1i(location, v0);
+}
+
+static PFNGLUNIFORM2IPROC glad_lazy_real_glUniform2i = NULL;
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+    if(glad_lazy_real_glUniform2i == NULL) {
+        glad_lazy_real_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_loader("glUniform2i");
+        if(glad_glUniform2i == glad_lazy_glUniform2i) glad_glUniform2i = glad_lazy_real_glUniform2i;
+    }
+    glad_lazy_real_glUniform2i(location, v0, v1);
+}
+
+static PFNGLUNIFORM3IPROC glad_lazy_real_glUniform3i = NULL;
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    if(glad_lazy_real_glUniform3i == NULL) {
+        glad_lazy_real_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_loader("glUniform3i");
+        if(glad_glUniform3i == glad_lazy_glUniform3i) glad_glUniform3i = glad_lazy_real_glUniform3i;
+    }
+    glad_lazy_real_glUniform3i(location, v0, v1, v2);
+}
+
+static PFNGLUNIFORM4IPROC glad_lazy_real_glUniform4i = NULL;
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if(glad_lazy_real_glUniform4i == NULL) {
+        glad_lazy_real_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_loader("glUniform4i");
+        if(glad_glUniform4i == glad_lazy_glUniform4i) glad_glUniform4i = glad_lazy_real_glUniform4i;
+    }
+    glad_lazy_real_glUniform4i(location, v0, v1, v2, v3);
+}
+
+static PFNGLUNIFORM1FVPROC glad_lazy_real_glUniform1fv = NULL;
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glUniform1fv == NULL) {
+        glad_lazy_real_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_loader("glUniform1fv");
+        if(glad_glUniform1fv == glad_lazy_glUniform1fv) glad_glUniform1fv = glad_lazy_real_glUniform1fv;
+    }
+    glad_lazy_real_glUniform1fv(location, count, value);
+}
+
+static PFNGLUNIFORM2FVPROC glad_lazy_real_glUniform2fv = NULL;
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glUniform2fv == NULL) {
+        glad_lazy_real_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_loader("glUniform2fv");
+        if(glad_glUniform2fv == glad_lazy_glUniform2fv) glad_glUniform2fv = glad_lazy_real_glUniform2fv;
+    }
+    glad_lazy_real_glUniform2fv(location, count, value);
+}
+
+static PFNGLUNIFORM3FVPROC glad_lazy_real_glUniform3fv = NULL;
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glUniform3fv == NULL) {
+        glad_lazy_real_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_loader("glUniform3fv");
+        if(glad_glUniform3fv == glad_lazy_glUniform3fv) glad_glUniform3fv = glad_lazy_real_glUniform3fv;
+    }
+    glad_lazy_real_glUniform3fv(location, count, value);
+}
+
+static PFNGLUNIFORM4FVPROC glad_lazy_real_glUniform4fv = NULL;
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glUniform4fv == NULL) {
+        glad_lazy_real_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_loader("glUniform4fv");
+        if(glad_glUniform4fv == glad_lazy_glUniform4fv) glad_glUniform4fv = glad_lazy_real_glUniform4fv;
+    }
+    glad_lazy_real_glUniform4fv(location, count, value);
+}
+
+static PFNGLUNIFORM1IVPROC glad_lazy_real_glUniform1iv = NULL;
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glUniform1iv == NULL) {
+        glad_lazy_real_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_loader("glUniform1iv");
+        if(glad_glUniform1iv == glad_lazy_glUniform1iv) glad_glUniform1iv = glad_lazy_real_glUniform1iv;
+    }
+    glad_lazy_real_glUniform1iv(location, count, value);
+}
+
+static PFNGLUNIFORM2IVPROC glad_lazy_real_glUniform2iv = NULL;
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glUniform2iv == NULL) {
+        glad_lazy_real_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_loader("glUniform2iv");
+        if(glad_glUniform2iv == glad_lazy_glUniform2iv) glad_glUniform2iv = glad_lazy_real_glUniform2iv;
+    }
+    glad_lazy_real_glUniform2iv(location, count, value);
+}
+
+static PFNGLUNIFORM3IVPROC glad_lazy_real_glUniform3iv = NULL;
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glUniform3iv == NULL) {
+        glad_lazy_real_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_loader("glUniform3iv");
+        if(glad_glUniform3iv == glad_lazy_glUniform3iv) glad_glUniform3iv = glad_lazy_real_glUniform3iv;
+    }
+    glad_lazy_real_glUniform3iv(location, count, value);
+}
+
+static PFNGLUNIFORM4IVPROC glad_lazy_real_glUniform4iv = NULL;
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glUniform4iv == NULL) {
+        glad_lazy_real_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_loader("glUniform4iv");
+        if(glad_glUniform4iv == glad_lazy_glUniform4iv) glad_glUniform4iv = glad_lazy_real_glUniform4iv;
+    }
+    glad_lazy_real_glUniform4iv(location, count, value);
+}
+
+static PFNGLUNIFORMMATRIX2FVPROC glad_lazy_real_glUniformMatrix2fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix2fv == NULL) {
+        glad_lazy_real_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_loader("glUniformMatrix2fv");
+        if(glad_glUniformMatrix2fv == glad_lazy_glUniformMatrix2fv) glad_glUniformMatrix2fv = glad_lazy_real_glUniformMatrix2fv;
+    }
+    glad_lazy_real_glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3FVPROC glad_lazy_real_glUniformMatrix3fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix3fv == NULL) {
+        glad_lazy_real_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_loader("glUniformMatrix3fv");
+        if(glad_glUniformMatrix3fv == glad_lazy_glUniformMatrix3fv) glad_glUniformMatrix3fv = glad_lazy_real_glUniformMatrix3fv;
+    }
+    glad_lazy_real_glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4FVPROC glad_lazy_real_glUniformMatrix4fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix4fv == NULL) {
+        glad_lazy_real_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_loader("glUniformMatrix4fv");
+        if(glad_glUniformMatrix4fv == glad_lazy_glUniformMatrix4fv) glad_glUniformMatrix4fv = glad_lazy_real_glUniformMatrix4fv;
+    }
+    glad_lazy_real_glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static PFNGLVALIDATEPROGRAMPROC glad_lazy_real_glValidateProgram = NULL;
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+    if(glad_lazy_real_glValidateProgram == NULL) {
+        glad_lazy_real_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_loader("glValidateProgram");
+        if(glad_glValidateProgram == glad_lazy_glValidateProgram) glad_glValidateProgram = glad_lazy_real_glValidateProgram;
+    }
+    glad_lazy_real_glValidateProgram(program);
+}
+
+static PFNGLVERTEXATTRIB1DPROC glad_lazy_real_glVertexAttrib1d = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+    if(glad_lazy_real_glVertexAttrib1d == NULL) {
+        glad_lazy_real_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_loader("glVertexAttrib1d");
+        if(glad_glVertexAttrib1d == glad_lazy_glVertexAttrib1d) glad_glVertexAttrib1d = glad_lazy_real_glVertexAttrib1d;
+    }
+    glad_lazy_real_glVertexAttrib1d(index, x);
+}
+
+static PFNGLVERTEXATTRIB1DVPROC glad_lazy_real_glVertexAttrib1dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttrib1dv == NULL) {
+        glad_lazy_real_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_loader("glVertexAttrib1dv");
+        if(glad_glVertexAttrib1dv == glad_lazy_glVertexAttrib1dv) glad_glVertexAttrib1dv = glad_lazy_real_glVertexAttrib1dv;
+    }
+    glad_lazy_real_glVertexAttrib1dv(index, v);
+}
+
+static PFNGLVERTEXATTRIB1FPROC glad_lazy_real_glVertexAttrib1f = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+    if(glad_lazy_real_glVertexAttrib1f == NULL) {
+        glad_lazy_real_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_loader("glVertexAttrib1f");
+        if(glad_glVertexAttrib1f == glad_lazy_glVertexAttrib1f) glad_glVertexAttrib1f = glad_lazy_real_glVertexAttrib1f;
+    }
+    glad_lazy_real_glVertexAttrib1f(index, x);
+}
+
+static PFNGLVERTEXATTRIB1FVPROC glad_lazy_real_glVertexAttrib1fv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    if(glad_lazy_real_glVertexAttrib1fv == NULL) {
+        glad_lazy_real_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_loader("glVertexAttrib1fv");
+        if(glad_glVertexAttrib1fv == glad_lazy_glVertexAttrib1fv) glad_glVertexAttrib1fv = glad_lazy_real_glVertexAttrib1fv;
+    }
+    glad_lazy_real_glVertexAttrib1fv(index, v);
+}
+
+static PFNGLVERTEXATTRIB1SPROC glad_lazy_real_glVertexAttrib1s = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+    if(glad_lazy_real_glVertexAttrib1s == NULL) {
+        glad_lazy_real_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_loader("glVertexAttrib1s");
+        if(glad_glVertexAttrib1s == glad_lazy_glVertexAttrib1s) glad_glVertexAttrib1s = glad_lazy_real_glVertexAttrib1s;
+    }
+    glad_lazy_real_glVertexAttrib1s(index, x);
+}
+
+static PFNGLVERTEXATTRIB1SVPROC glad_lazy_real_glVertexAttrib1sv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttrib1sv == NULL) {
+        glad_lazy_real_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_loader("glVertexAttrib1sv");
+        if(glad_glVertexAttrib1sv == glad_lazy_glVertexAttrib1sv) glad_glVertexAttrib1sv = glad_lazy_real_glVertexAttrib1sv;
+    }
+    glad_lazy_real_glVertexAttrib1sv(index, v);
+}
+
+static PFNGLVERTEXATTRIB2DPROC glad_lazy_real_glVertexAttrib2d = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    if(glad_lazy_real_glVertexAttrib2d == NULL) {
+        glad_lazy_real_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_loader("glVertexAttrib2d");
+        if(glad_glVertexAttrib2d == glad_lazy_glVertexAttrib2d) glad_glVertexAttrib2d = glad_lazy_real_glVertexAttrib2d;
+    }
+    glad_lazy_real_glVertexAttrib2d(index, x, y);
+}
+
+static PFNGLVERTEXATTRIB2DVPROC glad_lazy_real_glVertexAttrib2dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttrib2dv == NULL) {
+        glad_lazy_real_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_loader("glVertexAttrib2dv");
+        if(glad_glVertexAttrib2dv == glad_lazy_glVertexAttrib2dv) glad_glVertexAttrib2dv = glad_lazy_real_glVertexAttrib2dv;
+    }
+    glad_lazy_real_glVertexAttrib2dv(index, v);
+}
+
+static PFNGLVERTEXATTRIB2FPROC glad_lazy_real_glVertexAttrib2f = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    if(glad_lazy_real_glVertexAttrib2f == NULL) {
+        glad_lazy_real_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_loader("glVertexAttrib2f");
+        if(glad_glVertexAttrib2f == glad_lazy_glVertexAttrib2f) glad_glVertexAttrib2f = glad_lazy_real_glVertexAttrib2f;
+    }
+    glad_lazy_real_glVertexAttrib2f(index, x, y);
+}
+
+static PFNGLVERTEXATTRIB2FVPROC glad_lazy_real_glVertexAttrib2fv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    if(glad_lazy_real_glVertexAttrib2fv == NULL) {
+        glad_lazy_real_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_loader("glVertexAttrib2fv");
+        if(glad_glVertexAttrib2fv == glad_lazy_glVertexAttrib2fv) glad_glVertexAttrib2fv = glad_lazy_real_glVertexAttrib2fv;
+    }
+    glad_lazy_real_glVertexAttrib2fv(index, v);
+}
+
+static PFNGLVERTEXATTRIB2SPROC glad_lazy_real_glVertexAttrib2s = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    if(glad_lazy_real_glVertexAttrib2s == NULL) {
+        glad_lazy_real_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_loader("glVertexAttrib2s");
+        if(glad_glVertexAttrib2s == glad_lazy_glVertexAttrib2s) glad_glVertexAttrib2s = glad_lazy_real_glVertexAttrib2s;
+    }
+    glad_lazy_real_glVertexAttrib2s(index, x, y);
+}
+
+static PFNGLVERTEXATTRIB2SVPROC glad_lazy_real_glVertexAttrib2sv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttrib2sv == NULL) {
+        glad_lazy_real_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_loader("glVertexAttrib2sv");
+        if(glad_glVertexAttrib2sv == glad_lazy_glVertexAttrib2sv) glad_glVertexAttrib2sv = glad_lazy_real_glVertexAttrib2sv;
+    }
+    glad_lazy_real_glVertexAttrib2sv(index, v);
+}
+
+static PFNGLVERTEXATTRIB3DPROC glad_lazy_real_glVertexAttrib3d = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if(glad_lazy_real_glVertexAttrib3d == NULL) {
+        glad_lazy_real_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_loader("glVertexAttrib3d");
+        if(glad_glVertexAttrib3d == glad_lazy_glVertexAttrib3d) glad_glVertexAttrib3d = glad_lazy_real_glVertexAttrib3d;
+    }
+    glad_lazy_real_glVertexAttrib3d(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIB3DVPROC glad_lazy_real_glVertexAttrib3dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttrib3dv == NULL) {
+        glad_lazy_real_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_loader("glVertexAttrib3dv");
+        if(glad_glVertexAttrib3dv == glad_lazy_glVertexAttrib3dv) glad_glVertexAttrib3dv = glad_lazy_real_glVertexAttrib3dv;
+    }
+    glad_lazy_real_glVertexAttrib3dv(index, v);
+}
+
+static PFNGLVERTEXATTRIB3FPROC glad_lazy_real_glVertexAttrib3f = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    if(glad_lazy_real_glVertexAttrib3f == NULL) {
+        glad_lazy_real_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_loader("glVertexAttrib3f");
+        if(glad_glVertexAttrib3f == glad_lazy_glVertexAttrib3f) glad_glVertexAttrib3f = glad_lazy_real_glVertexAttrib3f;
+    }
+    glad_lazy_real_glVertexAttrib3f(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIB3FVPROC glad_lazy_real_glVertexAttrib3fv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    if(glad_lazy_real_glVertexAttrib3fv == NULL) {
+        glad_lazy_real_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_loader("glVertexAttrib3fv");
+        if(glad_glVertexAttrib3fv == glad_lazy_glVertexAttrib3fv) glad_glVertexAttrib3fv = glad_lazy_real_glVertexAttrib3fv;
+    }
+    glad_lazy_real_glVertexAttrib3fv(index, v);
+}
+
+static PFNGLVERTEXATTRIB3SPROC glad_lazy_real_glVertexAttrib3s = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    if(glad_lazy_real_glVertexAttrib3s == NULL) {
+        glad_lazy_real_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_loader("glVertexAttrib3s");
+        if(glad_glVertexAttrib3s == glad_lazy_glVertexAttrib3s) glad_glVertexAttrib3s = glad_lazy_real_glVertexAttrib3s;
+    }
+    glad_lazy_real_glVertexAttrib3s(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIB3SVPROC glad_lazy_real_glVertexAttrib3sv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttrib3sv == NULL) {
+        glad_lazy_real_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_loader("glVertexAttrib3sv");
+        if(glad_glVertexAttrib3sv == glad_lazy_glVertexAttrib3sv) glad_glVertexAttrib3sv = glad_lazy_real_glVertexAttrib3sv;
+    }
+    glad_lazy_real_glVertexAttrib3sv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NBVPROC glad_lazy_real_glVertexAttrib4Nbv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    if(glad_lazy_real_glVertexAttrib4Nbv == NULL) {
+        glad_lazy_real_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_loader("glVertexAttrib4Nbv");
+        if(glad_glVertexAttrib4Nbv == glad_lazy_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = glad_lazy_real_glVertexAttrib4Nbv;
+    }
+    glad_lazy_real_glVertexAttrib4Nbv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NIVPROC glad_lazy_real_glVertexAttrib4Niv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttrib4Niv == NULL) {
+        glad_lazy_real_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_loader("glVertexAttrib4Niv");
+        if(glad_glVertexAttrib4Niv == glad_lazy_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = glad_lazy_real_glVertexAttrib4Niv;
+    }
+    glad_lazy_real_glVertexAttrib4Niv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NSVPROC glad_lazy_real_glVertexAttrib4Nsv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttrib4Nsv == NULL) {
+        glad_lazy_real_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_loader("glVertexAttrib4Nsv");
+        if(glad_glVertexAttrib4Nsv == glad_lazy_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = glad_lazy_real_glVertexAttrib4Nsv;
+    }
+    glad_lazy_real_glVertexAttrib4Nsv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NUBPROC glad_lazy_real_glVertexAttrib4Nub = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    if(glad_lazy_real_glVertexAttrib4Nub == NULL) {
+        glad_lazy_real_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_loader("glVertexAttrib4Nub");
+        if(glad_glVertexAttrib4Nub == glad_lazy_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = glad_lazy_real_glVertexAttrib4Nub;
+    }
+    glad_lazy_real_glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIB4NUBVPROC glad_lazy_real_glVertexAttrib4Nubv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    if(glad_lazy_real_glVertexAttrib4Nubv == NULL) {
+        glad_lazy_real_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_loader("glVertexAttrib4Nubv");
+        if(glad_glVertexAttrib4Nubv == glad_lazy_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = glad_lazy_real_glVertexAttrib4Nubv;
+    }
+    glad_lazy_real_glVertexAttrib4Nubv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NUIVPROC glad_lazy_real_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttrib4Nuiv == NULL) {
+        glad_lazy_real_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_loader("glVertexAttrib4Nuiv");
+        if(glad_glVertexAttrib4Nuiv == glad_lazy_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = glad_lazy_real_glVertexAttrib4Nuiv;
+    }
+    glad_lazy_real_glVertexAttrib4Nuiv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4NUSVPROC glad_lazy_real_glVertexAttrib4Nusv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    if(glad_lazy_real_glVertexAttrib4Nusv == NULL) {
+        glad_lazy_real_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_loader("glVertexAttrib4Nusv");
+        if(glad_glVertexAttrib4Nusv == glad_lazy_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = glad_lazy_real_glVertexAttrib4Nusv;
+    }
+    glad_lazy_real_glVertexAttrib4Nusv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4BVPROC glad_lazy_real_glVertexAttrib4bv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    if(glad_lazy_real_glVertexAttrib4bv == NULL) {
+        glad_lazy_real_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_loader("glVertexAttrib4bv");
+        if(glad_glVertexAttrib4bv == glad_lazy_glVertexAttrib4bv) glad_glVertexAttrib4bv = glad_lazy_real_glVertexAttrib4bv;
+    }
+    glad_lazy_real_glVertexAttrib4bv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4DPROC glad_lazy_real_glVertexAttrib4d = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if(glad_lazy_real_glVertexAttrib4d == NULL) {
+        glad_lazy_real_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_loader("glVertexAttrib4d");
+        if(glad_glVertexAttrib4d == glad_lazy_glVertexAttrib4d) glad_glVertexAttrib4d = glad_lazy_real_glVertexAttrib4d;
+    }
+    glad_lazy_real_glVertexAttrib4d(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIB4DVPROC glad_lazy_real_glVertexAttrib4dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttrib4dv == NULL) {
+        glad_lazy_real_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_loader("glVertexAttrib4dv");
+        if(glad_glVertexAttrib4dv == glad_lazy_glVertexAttrib4dv) glad_glVertexAttrib4dv = glad_lazy_real_glVertexAttrib4dv;
+    }
+    glad_lazy_real_glVertexAttrib4dv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4FPROC glad_lazy_real_glVertexAttrib4f = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if(glad_lazy_real_glVertexAttrib4f == NULL) {
+        glad_lazy_real_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_loader("glVertexAttrib4f");
+        if(glad_glVertexAttrib4f == glad_lazy_glVertexAttrib4f) glad_glVertexAttrib4f = glad_lazy_real_glVertexAttrib4f;
+    }
+    glad_lazy_real_glVertexAttrib4f(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIB4FVPROC glad_lazy_real_glVertexAttrib4fv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    if(glad_lazy_real_glVertexAttrib4fv == NULL) {
+        glad_lazy_real_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_loader("glVertexAttrib4fv");
+        if(glad_glVertexAttrib4fv == glad_lazy_glVertexAttrib4fv) glad_glVertexAttrib4fv = glad_lazy_real_glVertexAttrib4fv;
+    }
+    glad_lazy_real_glVertexAttrib4fv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4IVPROC glad_lazy_real_glVertexAttrib4iv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttrib4iv == NULL) {
+        glad_lazy_real_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_loader("glVertexAttrib4iv");
+        if(glad_glVertexAttrib4iv == glad_lazy_glVertexAttrib4iv) glad_glVertexAttrib4iv = glad_lazy_real_glVertexAttrib4iv;
+    }
+    glad_lazy_real_glVertexAttrib4iv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4SPROC glad_lazy_real_glVertexAttrib4s = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    if(glad_lazy_real_glVertexAttrib4s == NULL) {
+        glad_lazy_real_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_loader("glVertexAttrib4s");
+        if(glad_glVertexAttrib4s == glad_lazy_glVertexAttrib4s) glad_glVertexAttrib4s = glad_lazy_real_glVertexAttrib4s;
+    }
+    glad_lazy_real_glVertexAttrib4s(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIB4SVPROC glad_lazy_real_glVertexAttrib4sv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttrib4sv == NULL) {
+        glad_lazy_real_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_loader("glVertexAttrib4sv");
+        if(glad_glVertexAttrib4sv == glad_lazy_glVertexAttrib4sv) glad_glVertexAttrib4sv = glad_lazy_real_glVertexAttrib4sv;
+    }
+    glad_lazy_real_glVertexAttrib4sv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4UBVPROC glad_lazy_real_glVertexAttrib4ubv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    if(glad_lazy_real_glVertexAttrib4ubv == NULL) {
+        glad_lazy_real_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_loader("glVertexAttrib4ubv");
+        if(glad_glVertexAttrib4ubv == glad_lazy_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = glad_lazy_real_glVertexAttrib4ubv;
+    }
+    glad_lazy_real_glVertexAttrib4ubv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4UIVPROC glad_lazy_real_glVertexAttrib4uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttrib4uiv == NULL) {
+        glad_lazy_real_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_loader("glVertexAttrib4uiv");
+        if(glad_glVertexAttrib4uiv == glad_lazy_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = glad_lazy_real_glVertexAttrib4uiv;
+    }
+    glad_lazy_real_glVertexAttrib4uiv(index, v);
+}
+
+static PFNGLVERTEXATTRIB4USVPROC glad_lazy_real_glVertexAttrib4usv = NULL;
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    if(glad_lazy_real_glVertexAttrib4usv == NULL) {
+        glad_lazy_real_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_loader("glVertexAttrib4usv");
+        if(glad_glVertexAttrib4usv == glad_lazy_glVertexAttrib4usv) glad_glVertexAttrib4usv = glad_lazy_real_glVertexAttrib4usv;
+    }
+    glad_lazy_real_glVertexAttrib4usv(index, v);
+}
+
+static PFNGLVERTEXATTRIBPOINTERPROC glad_lazy_real_glVertexAttribPointer = NULL;
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    if(glad_lazy_real_glVertexAttribPointer == NULL) {
+        glad_lazy_real_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_loader("glVertexAttribPointer");
+        if(glad_glVertexAttribPointer == glad_lazy_glVertexAttribPointer) glad_glVertexAttribPointer = glad_lazy_real_glVertexAttribPointer;
+    }
+    glad_lazy_real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_lazy_real_glUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix2x3fv == NULL) {
+        glad_lazy_real_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_loader("glUniformMatrix2x3fv");
+        if(glad_glUniformMatrix2x3fv == glad_lazy_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = glad_lazy_real_glUniformMatrix2x3fv;
+    }
+    glad_lazy_real_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_lazy_real_glUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix3x2fv == NULL) {
+        glad_lazy_real_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_loader("glUniformMatrix3x2fv");
+        if(glad_glUniformMatrix3x2fv == glad_lazy_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = glad_lazy_real_glUniformMatrix3x2fv;
+    }
+    glad_lazy_real_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_lazy_real_glUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix2x4fv == NULL) {
+        glad_lazy_real_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_loader("glUniformMatrix2x4fv");
+        if(glad_glUniformMatrix2x4fv == glad_lazy_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = glad_lazy_real_glUniformMatrix2x4fv;
+    }
+    glad_lazy_real_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_lazy_real_glUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix4x2fv == NULL) {
+        glad_lazy_real_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_loader("glUniformMatrix4x2fv");
+        if(glad_glUniformMatrix4x2fv == glad_lazy_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = glad_lazy_real_glUniformMatrix4x2fv;
+    }
+    glad_lazy_real_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_lazy_real_glUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix3x4fv == NULL) {
+        glad_lazy_real_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_loader("glUniformMatrix3x4fv");
+        if(glad_glUniformMatrix3x4fv == glad_lazy_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = glad_lazy_real_glUniformMatrix3x4fv;
+    }
+    glad_lazy_real_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_lazy_real_glUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glUniformMatrix4x3fv == NULL) {
+        glad_lazy_real_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_loader("glUniformMatrix4x3fv");
+        if(glad_glUniformMatrix4x3fv == glad_lazy_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = glad_lazy_real_glUniformMatrix4x3fv;
+    }
+    glad_lazy_real_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static PFNGLCOLORMASKIPROC glad_lazy_real_glColorMaski = NULL;
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if(glad_lazy_real_glColorMaski == NULL) {
+        glad_lazy_real_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_loader("glColorMaski");
+        if(glad_glColorMaski == glad_lazy_glColorMaski) glad_glColorMaski = glad_lazy_real_glColorMaski;
+    }
+    glad_lazy_real_glColorMaski(index, r, g, b, a);
+}
+
+static PFNGLGETBOOLEANI_VPROC glad_lazy_real_glGetBooleani_v = NULL;
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    if(glad_lazy_real_glGetBooleani_v == NULL) {
+        glad_lazy_real_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_loader("glGetBooleani_v");
+        if(glad_glGetBooleani_v == glad_lazy_glGetBooleani_v) glad_glGetBooleani_v = glad_lazy_real_glGetBooleani_v;
+    }
+    glad_lazy_real_glGetBooleani_v(target, index, data);
+}
+
+static PFNGLGETINTEGERI_VPROC glad_lazy_real_glGetIntegeri_v = NULL;
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    if(glad_lazy_real_glGetIntegeri_v == NULL) {
+        glad_lazy_real_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_loader("glGetIntegeri_v");
+        if(glad_glGetIntegeri_v == glad_lazy_glGetIntegeri_v) glad_glGetIntegeri_v = glad_lazy_real_glGetIntegeri_v;
+    }
+    glad_lazy_real_glGetIntegeri_v(target, index, data);
+}
+
+static PFNGLENABLEIPROC glad_lazy_real_glEnablei = NULL;
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+    if(glad_lazy_real_glEnablei == NULL) {
+        glad_lazy_real_glEnablei = (PFNGLENABLEIPROC)glad_lazy_loader("glEnablei");
+        if(glad_glEnablei == glad_lazy_glEnablei) glad_glEnablei = glad_lazy_real_glEnablei;
+    }
+    glad_lazy_real_glEnablei(target, index);
+}
+
+static PFNGLDISABLEIPROC glad_lazy_real_glDisablei = NULL;
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+    if(glad_lazy_real_glDisablei == NULL) {
+        glad_lazy_real_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_loader("glDisablei");
+        if(glad_glDisablei == glad_lazy_glDisablei) glad_glDisablei = glad_lazy_real_glDisablei;
+    }
+    glad_lazy_real_glDisablei(target, index);
+}
+
+static PFNGLISENABLEDIPROC glad_lazy_real_glIsEnabledi = NULL;
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+    if(glad_lazy_real_glIsEnabledi == NULL) {
+        glad_lazy_real_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_loader("glIsEnabledi");
+        if(glad_glIsEnabledi == glad_lazy_glIsEnabledi) glad_glIsEnabledi = glad_lazy_real_glIsEnabledi;
+    }
+    return glad_lazy_real_glIsEnabledi(target, index);
+}
+
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_lazy_real_glBeginTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+    if(glad_lazy_real_glBeginTransformFeedback == NULL) {
+        glad_lazy_real_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_loader("glBeginTransformFeedback");
+        if(glad_glBeginTransformFeedback == glad_lazy_glBeginTransformFeedback) glad_glBeginTransformFeedback = glad_lazy_real_glBeginTransformFeedback;
+    }
+    glad_lazy_real_glBeginTransformFeedback(primitiveMode);
+}
+
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_lazy_real_glEndTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+    if(glad_lazy_real_glEndTransformFeedback == NULL) {
+        glad_lazy_real_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_loader("glEndTransformFeedback");
+        if(glad_glEndTransformFeedback == glad_lazy_glEndTransformFeedback) glad_glEndTransformFeedback = glad_lazy_real_glEndTransformFeedback;
+    }
+    glad_lazy_real_glEndTransformFeedback();
+}
+
+static PFNGLBINDBUFFERRANGEPROC glad_lazy_real_glBindBufferRange = NULL;
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if(glad_lazy_real_glBindBufferRange == NULL) {
+        glad_lazy_real_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_loader("glBindBufferRange");
+        if(glad_glBindBufferRange == glad_lazy_glBindBufferRange) glad_glBindBufferRange = glad_lazy_real_glBindBufferRange;
+    }
+    glad_lazy_real_glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static PFNGLBINDBUFFERBASEPROC glad_lazy_real_glBindBufferBase = NULL;
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    if(glad_lazy_real_glBindBufferBase == NULL) {
+        glad_lazy_real_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_loader("glBindBufferBase");
+        if(glad_glBindBufferBase == glad_lazy_glBindBufferBase) glad_glBindBufferBase = glad_lazy_real_glBindBufferBase;
+    }
+    glad_lazy_real_glBindBufferBase(target, index, buffer);
+}
+
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_lazy_real_glTransformFeedbackVaryings = NULL;
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    if(glad_lazy_real_glTransformFeedbackVaryings == NULL) {
+        glad_lazy_real_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_loader("glTransformFeedbackVaryings");
+        if(glad_glTransformFeedbackVaryings == glad_lazy_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = glad_lazy_real_glTransformFeedbackVaryings;
+    }
+    glad_lazy_real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_lazy_real_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    if(glad_lazy_real_glGetTransformFeedbackVarying == NULL) {
+        glad_lazy_real_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_loader("glGetTransformFeedbackVarying");
+        if(glad_glGetTransformFeedbackVarying == glad_lazy_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = glad_lazy_real_glGetTransformFeedbackVarying;
+    }
+    glad_lazy_real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+static PFNGLCLAMPCOLORPROC glad_lazy_real_glClampColor = NULL;
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+    if(glad_lazy_real_glClampColor == NULL) {
+        glad_lazy_real_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_loader("glClampColor");
+        if(glad_glClampColor == glad_lazy_glClampColor) glad_glClampColor = glad_lazy_real_glClampColor;
+    }
+    glad_lazy_real_glClampColor(target, clamp);
+}
+
+static PFNGLBEGINCONDITIONALRENDERPROC glad_lazy_real_glBeginConditionalRender = NULL;
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+    if(glad_lazy_real_glBeginConditionalRender == NULL) {
+        glad_lazy_real_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_loader("glBeginConditionalRender");
+        if(glad_glBeginConditionalRender == glad_lazy_glBeginConditionalRender) glad_glBeginConditionalRender = glad_lazy_real_glBeginConditionalRender;
+    }
+    glad_lazy_real_glBeginConditionalRender(id, mode);
+}
+
+static PFNGLENDCONDITIONALRENDERPROC glad_lazy_real_glEndConditionalRender = NULL;
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+    if(glad_lazy_real_glEndConditionalRender == NULL) {
+        glad_lazy_real_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_loader("glEndConditionalRender");
+        if(glad_glEndConditionalRender == glad_lazy_glEndConditionalRender) glad_glEndConditionalRender = glad_lazy_real_glEndConditionalRender;
+    }
+    glad_lazy_real_glEndConditionalRender();
+}
+
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_lazy_real_glVertexAttribIPointer = NULL;
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if(glad_lazy_real_glVertexAttribIPointer == NULL) {
+        glad_lazy_real_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_loader("glVertexAttribIPointer");
+        if(glad_glVertexAttribIPointer == glad_lazy_glVertexAttribIPointer) glad_glVertexAttribIPointer = glad_lazy_real_glVertexAttribIPointer;
+    }
+    glad_lazy_real_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static PFNGLGETVERTEXATTRIBIIVPROC glad_lazy_real_glGetVertexAttribIiv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetVertexAttribIiv == NULL) {
+        glad_lazy_real_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_loader("glGetVertexAttribIiv");
+        if(glad_glGetVertexAttribIiv == glad_lazy_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = glad_lazy_real_glGetVertexAttribIiv;
+    }
+    glad_lazy_real_glGetVertexAttribIiv(index, pname, params);
+}
+
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_lazy_real_glGetVertexAttribIuiv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    if(glad_lazy_real_glGetVertexAttribIuiv == NULL) {
+        glad_lazy_real_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_loader("glGetVertexAttribIuiv");
+        if(glad_glGetVertexAttribIuiv == glad_lazy_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = glad_lazy_real_glGetVertexAttribIuiv;
+    }
+    glad_lazy_real_glGetVertexAttribIuiv(index, pname, params);
+}
+
+static PFNGLVERTEXATTRIBI1IPROC glad_lazy_real_glVertexAttribI1i = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+    if(glad_lazy_real_glVertexAttribI1i == NULL) {
+        glad_lazy_real_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_loader("glVertexAttribI1i");
+        if(glad_glVertexAttribI1i == glad_lazy_glVertexAttribI1i) glad_glVertexAttribI1i = glad_lazy_real_glVertexAttribI1i;
+    }
+    glad_lazy_real_glVertexAttribI1i(index, x);
+}
+
+static PFNGLVERTEXATTRIBI2IPROC glad_lazy_real_glVertexAttribI2i = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    if(glad_lazy_real_glVertexAttribI2i == NULL) {
+        glad_lazy_real_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_loader("glVertexAttribI2i");
+        if(glad_glVertexAttribI2i == glad_lazy_glVertexAttribI2i) glad_glVertexAttribI2i = glad_lazy_real_glVertexAttribI2i;
+    }
+    glad_lazy_real_glVertexAttribI2i(index, x, y);
+}
+
+static PFNGLVERTEXATTRIBI3IPROC glad_lazy_real_glVertexAttribI3i = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    if(glad_lazy_real_glVertexAttribI3i == NULL) {
+        glad_lazy_real_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_loader("glVertexAttribI3i");
+        if(glad_glVertexAttribI3i == glad_lazy_glVertexAttribI3i) glad_glVertexAttribI3i = glad_lazy_real_glVertexAttribI3i;
+    }
+    glad_lazy_real_glVertexAttribI3i(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIBI4IPROC glad_lazy_real_glVertexAttribI4i = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    if(glad_lazy_real_glVertexAttribI4i == NULL) {
+        glad_lazy_real_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_loader("glVertexAttribI4i");
+        if(glad_glVertexAttribI4i == glad_lazy_glVertexAttribI4i) glad_glVertexAttribI4i = glad_lazy_real_glVertexAttribI4i;
+    }
+    glad_lazy_real_glVertexAttribI4i(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIBI1UIPROC glad_lazy_real_glVertexAttribI1ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+    if(glad_lazy_real_glVertexAttribI1ui == NULL) {
+        glad_lazy_real_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_loader("glVertexAttribI1ui");
+        if(glad_glVertexAttribI1ui == glad_lazy_glVertexAttribI1ui) glad_glVertexAttribI1ui = glad_lazy_real_glVertexAttribI1ui;
+    }
+    glad_lazy_real_glVertexAttribI1ui(index, x);
+}
+
+static PFNGLVERTEXATTRIBI2UIPROC glad_lazy_real_glVertexAttribI2ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    if(glad_lazy_real_glVertexAttribI2ui == NULL) {
+        glad_lazy_real_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_loader("glVertexAttribI2ui");
+        if(glad_glVertexAttribI2ui == glad_lazy_glVertexAttribI2ui) glad_glVertexAttribI2ui = glad_lazy_real_glVertexAttribI2ui;
+    }
+    glad_lazy_real_glVertexAttribI2ui(index, x, y);
+}
+
+static PFNGLVERTEXATTRIBI3UIPROC glad_lazy_real_glVertexAttribI3ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    if(glad_lazy_real_glVertexAttribI3ui == NULL) {
+        glad_lazy_real_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_loader("glVertexAttribI3ui");
+        if(glad_glVertexAttribI3ui == glad_lazy_glVertexAttribI3ui) glad_glVertexAttribI3ui = glad_lazy_real_glVertexAttribI3ui;
+    }
+    glad_lazy_real_glVertexAttribI3ui(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIBI4UIPROC glad_lazy_real_glVertexAttribI4ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    if(glad_lazy_real_glVertexAttribI4ui == NULL) {
+        glad_lazy_real_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_loader("glVertexAttribI4ui");
+        if(glad_glVertexAttribI4ui == glad_lazy_glVertexAttribI4ui) glad_glVertexAttribI4ui = glad_lazy_real_glVertexAttribI4ui;
+    }
+    glad_lazy_real_glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIBI1IVPROC glad_lazy_real_glVertexAttribI1iv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttribI1iv == NULL) {
+        glad_lazy_real_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_loader("glVertexAttribI1iv");
+        if(glad_glVertexAttribI1iv == glad_lazy_glVertexAttribI1iv) glad_glVertexAttribI1iv = glad_lazy_real_glVertexAttribI1iv;
+    }
+    glad_lazy_real_glVertexAttribI1iv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI2IVPROC glad_lazy_real_glVertexAttribI2iv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttribI2iv == NULL) {
+        glad_lazy_real_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_loader("glVertexAttribI2iv");
+        if(glad_glVertexAttribI2iv == glad_lazy_glVertexAttribI2iv) glad_glVertexAttribI2iv = glad_lazy_real_glVertexAttribI2iv;
+    }
+    glad_lazy_real_glVertexAttribI2iv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI3IVPROC glad_lazy_real_glVertexAttribI3iv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttribI3iv == NULL) {
+        glad_lazy_real_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_loader("glVertexAttribI3iv");
+        if(glad_glVertexAttribI3iv == glad_lazy_glVertexAttribI3iv) glad_glVertexAttribI3iv = glad_lazy_real_glVertexAttribI3iv;
+    }
+    glad_lazy_real_glVertexAttribI3iv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4IVPROC glad_lazy_real_glVertexAttribI4iv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glVertexAttribI4iv == NULL) {
+        glad_lazy_real_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_loader("glVertexAttribI4iv");
+        if(glad_glVertexAttribI4iv == glad_lazy_glVertexAttribI4iv) glad_glVertexAttribI4iv = glad_lazy_real_glVertexAttribI4iv;
+    }
+    glad_lazy_real_glVertexAttribI4iv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI1UIVPROC glad_lazy_real_glVertexAttribI1uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttribI1uiv == NULL) {
+        glad_lazy_real_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_loader("glVertexAttribI1uiv");
+        if(glad_glVertexAttribI1uiv == glad_lazy_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = glad_lazy_real_glVertexAttribI1uiv;
+    }
+    glad_lazy_real_glVertexAttribI1uiv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI2UIVPROC glad_lazy_real_glVertexAttribI2uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttribI2uiv == NULL) {
+        glad_lazy_real_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_loader("glVertexAttribI2uiv");
+        if(glad_glVertexAttribI2uiv == glad_lazy_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = glad_lazy_real_glVertexAttribI2uiv;
+    }
+    glad_lazy_real_glVertexAttribI2uiv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI3UIVPROC glad_lazy_real_glVertexAttribI3uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttribI3uiv == NULL) {
+        glad_lazy_real_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_loader("glVertexAttribI3uiv");
+        if(glad_glVertexAttribI3uiv == glad_lazy_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = glad_lazy_real_glVertexAttribI3uiv;
+    }
+    glad_lazy_real_glVertexAttribI3uiv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4UIVPROC glad_lazy_real_glVertexAttribI4uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    if(glad_lazy_real_glVertexAttribI4uiv == NULL) {
+        glad_lazy_real_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_loader("glVertexAttribI4uiv");
+        if(glad_glVertexAttribI4uiv == glad_lazy_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = glad_lazy_real_glVertexAttribI4uiv;
+    }
+    glad_lazy_real_glVertexAttribI4uiv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4BVPROC glad_lazy_real_glVertexAttribI4bv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    if(glad_lazy_real_glVertexAttribI4bv == NULL) {
+        glad_lazy_real_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_loader("glVertexAttribI4bv");
+        if(glad_glVertexAttribI4bv == glad_lazy_glVertexAttribI4bv) glad_glVertexAttribI4bv = glad_lazy_real_glVertexAttribI4bv;
+    }
+    glad_lazy_real_glVertexAttribI4bv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4SVPROC glad_lazy_real_glVertexAttribI4sv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    if(glad_lazy_real_glVertexAttribI4sv == NULL) {
+        glad_lazy_real_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_loader("glVertexAttribI4sv");
+        if(glad_glVertexAttribI4sv == glad_lazy_glVertexAttribI4sv) glad_glVertexAttribI4sv = glad_lazy_real_glVertexAttribI4sv;
+    }
+    glad_lazy_real_glVertexAttribI4sv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4UBVPROC glad_lazy_real_glVertexAttribI4ubv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    if(glad_lazy_real_glVertexAttribI4ubv == NULL) {
+        glad_lazy_real_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_loader("glVertexAttribI4ubv");
+        if(glad_glVertexAttribI4ubv == glad_lazy_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = glad_lazy_real_glVertexAttribI4ubv;
+    }
+    glad_lazy_real_glVertexAttribI4ubv(index, v);
+}
+
+static PFNGLVERTEXATTRIBI4USVPROC glad_lazy_real_glVertexAttribI4usv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    if(glad_lazy_real_glVertexAttribI4usv == NULL) {
+        glad_lazy_real_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_loader("glVertexAttribI4usv");
+        if(glad_glVertexAttribI4usv == glad_lazy_glVertexAttribI4usv) glad_glVertexAttribI4usv = glad_lazy_real_glVertexAttribI4usv;
+    }
+    glad_lazy_real_glVertexAttribI4usv(index, v);
+}
+
+static PFNGLGETUNIFORMUIVPROC glad_lazy_real_glGetUniformuiv = NULL;
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    if(glad_lazy_real_glGetUniformuiv == NULL) {
+        glad_lazy_real_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_loader("glGetUniformuiv");
+        if(glad_glGetUniformuiv == glad_lazy_glGetUniformuiv) glad_glGetUniformuiv = glad_lazy_real_glGetUniformuiv;
+    }
+    glad_lazy_real_glGetUniformuiv(program, location, params);
+}
+
+static PFNGLBINDFRAGDATALOCATIONPROC glad_lazy_real_glBindFragDataLocation = NULL;
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    if(glad_lazy_real_glBindFragDataLocation == NULL) {
+        glad_lazy_real_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_loader("glBindFragDataLocation");
+        if(glad_glBindFragDataLocation == glad_lazy_glBindFragDataLocation) glad_glBindFragDataLocation = glad_lazy_real_glBindFragDataLocation;
+    }
+    glad_lazy_real_glBindFragDataLocation(program, color, name);
+}
+
+static PFNGLGETFRAGDATALOCATIONPROC glad_lazy_real_glGetFragDataLocation = NULL;
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    if(glad_lazy_real_glGetFragDataLocation == NULL) {
+        glad_lazy_real_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_loader("glGetFragDataLocation");
+        if(glad_glGetFragDataLocation == glad_lazy_glGetFragDataLocation) glad_glGetFragDataLocation = glad_lazy_real_glGetFragDataLocation;
+    }
+    return glad_lazy_real_glGetFragDataLocation(program, name);
+}
+
+static PFNGLUNIFORM1UIPROC glad_lazy_real_glUniform1ui = NULL;
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+    if(glad_lazy_real_glUniform1ui == NULL) {
+        glad_lazy_real_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_loader("glUniform1ui");
+        if(glad_glUniform1ui == glad_lazy_glUniform1ui) glad_glUniform1ui = glad_lazy_real_glUniform1ui;
+    }
+    glad_lazy_real_glUniform1ui(location, v0);
+}
+
+static PFNGLUNIFORM2UIPROC glad_lazy_real_glUniform2ui = NULL;
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    if(glad_lazy_real_glUniform2ui == NULL) {
+        glad_lazy_real_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_loader("glUniform2ui");
+        if(glad_glUniform2ui == glad_lazy_glUniform2ui) glad_glUniform2ui = glad_lazy_real_glUniform2ui;
+    }
+    glad_lazy_real_glUniform2ui(location, v0, v1);
+}
+
+static PFNGLUNIFORM3UIPROC glad_lazy_real_glUniform3ui = NULL;
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if(glad_lazy_real_glUniform3ui == NULL) {
+        glad_lazy_real_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_loader("glUniform3ui");
+        if(glad_glUniform3ui == glad_lazy_glUniform3ui) glad_glUniform3ui = glad_lazy_real_glUniform3ui;
+    }
+    glad_lazy_real_glUniform3ui(location, v0, v1, v2);
+}
+
+static PFNGLUNIFORM4UIPROC glad_lazy_real_glUniform4ui = NULL;
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if(glad_lazy_real_glUniform4ui == NULL) {
+        glad_lazy_real_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_loader("glUniform4ui");
+        if(glad_glUniform4ui == glad_lazy_glUniform4ui) glad_glUniform4ui = glad_lazy_real_glUniform4ui;
+    }
+    glad_lazy_real_glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static PFNGLUNIFORM1UIVPROC glad_lazy_real_glUniform1uiv = NULL;
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glUniform1uiv == NULL) {
+        glad_lazy_real_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_loader("glUniform1uiv");
+        if(glad_glUniform1uiv == glad_lazy_glUniform1uiv) glad_glUniform1uiv = glad_lazy_real_glUniform1uiv;
+    }
+    glad_lazy_real_glUniform1uiv(location, count, value);
+}
+
+static PFNGLUNIFORM2UIVPROC glad_lazy_real_glUniform2uiv = NULL;
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glUniform2uiv == NULL) {
+        glad_lazy_real_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_loader("glUniform2uiv");
+        if(glad_glUniform2uiv == glad_lazy_glUniform2uiv) glad_glUniform2uiv = glad_lazy_real_glUniform2uiv;
+    }
+    glad_lazy_real_glUniform2uiv(location, count, value);
+}
+
+static PFNGLUNIFORM3UIVPROC glad_lazy_real_glUniform3uiv = NULL;
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glUniform3uiv == NULL) {
+        glad_lazy_real_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_loader("glUniform3uiv");
+        if(glad_glUniform3uiv == glad_lazy_glUniform3uiv) glad_glUniform3uiv = glad_lazy_real_glUniform3uiv;
+    }
+    glad_lazy_real_glUniform3uiv(location, count, value);
+}
+
+static PFNGLUNIFORM4UIVPROC glad_lazy_real_glUniform4uiv = NULL;
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glUniform4uiv == NULL) {
+        glad_lazy_real_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_loader("glUniform4uiv");
+        if(glad_glUniform4uiv == glad_lazy_glUniform4uiv) glad_glUniform4uiv = glad_lazy_real_glUniform4uiv;
+    }
+    glad_lazy_real_glUniform4uiv(location, count, value);
+}
+
+static PFNGLTEXPARAMETERIIVPROC glad_lazy_real_glTexParameterIiv = NULL;
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    if(glad_lazy_real_glTexParameterIiv == NULL) {
+        glad_lazy_real_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_loader("glTexParameterIiv");
+        if(glad_glTexParameterIiv == glad_lazy_glTexParameterIiv) glad_glTexParameterIiv = glad_lazy_real_glTexParameterIiv;
+    }
+    glad_lazy_real_glTexParameterIiv(target, pname, params);
+}
+
+static PFNGLTEXPARAMETERIUIVPROC glad_lazy_real_glTexParameterIuiv = NULL;
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    if(glad_lazy_real_glTexParameterIuiv == NULL) {
+        glad_lazy_real_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_loader("glTexParameterIuiv");
+        if(glad_glTexParameterIuiv == glad_lazy_glTexParameterIuiv) glad_glTexParameterIuiv = glad_lazy_real_glTexParameterIuiv;
+    }
+    glad_lazy_real_glTexParameterIuiv(target, pname, params);
+}
+
+static PFNGLGETTEXPARAMETERIIVPROC glad_lazy_real_glGetTexParameterIiv = NULL;
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetTexParameterIiv == NULL) {
+        glad_lazy_real_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_loader("glGetTexParameterIiv");
+        if(glad_glGetTexParameterIiv == glad_lazy_glGetTexParameterIiv) glad_glGetTexParameterIiv = glad_lazy_real_glGetTexParameterIiv;
+    }
+    glad_lazy_real_glGetTexParameterIiv(target, pname, params);
+}
+
+static PFNGLGETTEXPARAMETERIUIVPROC glad_lazy_real_glGetTexParameterIuiv = NULL;
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    if(glad_lazy_real_glGetTexParameterIuiv == NULL) {
+        glad_lazy_real_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_loader("glGetTexParameterIuiv");
+        if(glad_glGetTexParameterIuiv == glad_lazy_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = glad_lazy_real_glGetTexParameterIuiv;
+    }
+    glad_lazy_real_glGetTexParameterIuiv(target, pname, params);
+}
+
+static PFNGLCLEARBUFFERIVPROC glad_lazy_real_glClearBufferiv = NULL;
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    if(glad_lazy_real_glClearBufferiv == NULL) {
+        glad_lazy_real_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_loader("glClearBufferiv");
+        if(glad_glClearBufferiv == glad_lazy_glClearBufferiv) glad_glClearBufferiv = glad_lazy_real_glClearBufferiv;
+    }
+    glad_lazy_real_glClearBufferiv(buffer, drawbuffer, value);
+}
+
+static PFNGLCLEARBUFFERUIVPROC glad_lazy_real_glClearBufferuiv = NULL;
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    if(glad_lazy_real_glClearBufferuiv == NULL) {
+        glad_lazy_real_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_loader("glClearBufferuiv");
+        if(glad_glClearBufferuiv == glad_lazy_glClearBufferuiv) glad_glClearBufferuiv = glad_lazy_real_glClearBufferuiv;
+    }
+    glad_lazy_real_glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static PFNGLCLEARBUFFERFVPROC glad_lazy_real_glClearBufferfv = NULL;
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    if(glad_lazy_real_glClearBufferfv == NULL) {
+        glad_lazy_real_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_loader("glClearBufferfv");
+        if(glad_glClearBufferfv == glad_lazy_glClearBufferfv) glad_glClearBufferfv = glad_lazy_real_glClearBufferfv;
+    }
+    glad_lazy_real_glClearBufferfv(buffer, drawbuffer, value);
+}
+
+static PFNGLCLEARBUFFERFIPROC glad_lazy_real_glClearBufferfi = NULL;
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if(glad_lazy_real_glClearBufferfi == NULL) {
+        glad_lazy_real_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_loader("glClearBufferfi");
+        if(glad_glClearBufferfi == glad_lazy_glClearBufferfi) glad_glClearBufferfi = glad_lazy_real_glClearBufferfi;
+    }
+    glad_lazy_real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static PFNGLGETSTRINGIPROC glad_lazy_real_glGetStringi = NULL;
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+    if(glad_lazy_real_glGetStringi == NULL) {
+        glad_lazy_real_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_loader("glGetStringi");
+        if(glad_glGetStringi == glad_lazy_glGetStringi) glad_glGetStringi = glad_lazy_real_glGetStringi;
+    }
+    return glad_lazy_real_glGetStringi(name, index);
+}
+
+static PFNGLISRENDERBUFFERPROC glad_lazy_real_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+    if(glad_lazy_real_glIsRenderbuffer == NULL) {
+        glad_lazy_real_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_loader("glIsRenderbuffer");
+        if(glad_glIsRenderbuffer == glad_lazy_glIsRenderbuffer) glad_glIsRenderbuffer = glad_lazy_real_glIsRenderbuffer;
+    }
+    return glad_lazy_real_glIsRenderbuffer(renderbuffer);
+}
+
+static PFNGLBINDRENDERBUFFERPROC glad_lazy_real_glBindRenderbuffer = NULL;
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    if(glad_lazy_real_glBindRenderbuffer == NULL) {
+        glad_lazy_real_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_loader("glBindRenderbuffer");
+        if(glad_glBindRenderbuffer == glad_lazy_glBindRenderbuffer) glad_glBindRenderbuffer = glad_lazy_real_glBindRenderbuffer;
+    }
+    glad_lazy_real_glBindRenderbuffer(target, renderbuffer);
+}
+
+static PFNGLDELETERENDERBUFFERSPROC glad_lazy_real_glDeleteRenderbuffers = NULL;
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    if(glad_lazy_real_glDeleteRenderbuffers == NULL) {
+        glad_lazy_real_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_loader("glDeleteRenderbuffers");
+        if(glad_glDeleteRenderbuffers == glad_lazy_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = glad_lazy_real_glDeleteRenderbuffers;
+    }
+    glad_lazy_real_glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static PFNGLGENRENDERBUFFERSPROC glad_lazy_real_glGenRenderbuffers = NULL;
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    if(glad_lazy_real_glGenRenderbuffers == NULL) {
+        glad_lazy_real_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_loader("glGenRenderbuffers");
+        if(glad_glGenRenderbuffers == glad_lazy_glGenRenderbuffers) glad_glGenRenderbuffers = glad_lazy_real_glGenRenderbuffers;
+    }
+    glad_lazy_real_glGenRenderbuffers(n, renderbuffers);
+}
+
+static PFNGLRENDERBUFFERSTORAGEPROC glad_lazy_real_glRenderbufferStorage = NULL;
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glRenderbufferStorage == NULL) {
+        glad_lazy_real_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_loader("glRenderbufferStorage");
+        if(glad_glRenderbufferStorage == glad_lazy_glRenderbufferStorage) glad_glRenderbufferStorage = glad_lazy_real_glRenderbufferStorage;
+    }
+    glad_lazy_real_glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_lazy_real_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetRenderbufferParameteriv == NULL) {
+        glad_lazy_real_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_loader("glGetRenderbufferParameteriv");
+        if(glad_glGetRenderbufferParameteriv == glad_lazy_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = glad_lazy_real_glGetRenderbufferParameteriv;
+    }
+    glad_lazy_real_glGetRenderbufferParameteriv(target, pname, params);
+}
+
+static PFNGLISFRAMEBUFFERPROC glad_lazy_real_glIsFramebuffer = NULL;
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+    if(glad_lazy_real_glIsFramebuffer == NULL) {
+        glad_lazy_real_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_loader("glIsFramebuffer");
+        if(glad_glIsFramebuffer == glad_lazy_glIsFramebuffer) glad_glIsFramebuffer = glad_lazy_real_glIsFramebuffer;
+    }
+    return glad_lazy_real_glIsFramebuffer(framebuffer);
+}
+
+static PFNGLBINDFRAMEBUFFERPROC glad_lazy_real_glBindFramebuffer = NULL;
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    if(glad_lazy_real_glBindFramebuffer == NULL) {
+        glad_lazy_real_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_loader("glBindFramebuffer");
+        if(glad_glBindFramebuffer == glad_lazy_glBindFramebuffer) glad_glBindFramebuffer = glad_lazy_real_glBindFramebuffer;
+    }
+    glad_lazy_real_glBindFramebuffer(target, framebuffer);
+}
+
+static PFNGLDELETEFRAMEBUFFERSPROC glad_lazy_real_glDeleteFramebuffers = NULL;
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    if(glad_lazy_real_glDeleteFramebuffers == NULL) {
+        glad_lazy_real_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_loader("glDeleteFramebuffers");
+        if(glad_glDeleteFramebuffers == glad_lazy_glDeleteFramebuffers) glad_glDeleteFramebuffers = glad_lazy_real_glDeleteFramebuffers;
+    }
+    glad_lazy_real_glDeleteFramebuffers(n, framebuffers);
+}
+
+static PFNGLGENFRAMEBUFFERSPROC glad_lazy_real_glGenFramebuffers = NULL;
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    if(glad_lazy_real_glGenFramebuffers == NULL) {
+        glad_lazy_real_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_loader("glGenFramebuffers");
+        if(glad_glGenFramebuffers == glad_lazy_glGenFramebuffers) glad_glGenFramebuffers = glad_lazy_real_glGenFramebuffers;
+    }
+    glad_lazy_real_glGenFramebuffers(n, framebuffers);
+}
+
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_lazy_real_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+    if(glad_lazy_real_glCheckFramebufferStatus == NULL) {
+        glad_lazy_real_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_loader("glCheckFramebufferStatus");
+        if(glad_glCheckFramebufferStatus == glad_lazy_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = glad_lazy_real_glCheckFramebufferStatus;
+    }
+    return glad_lazy_real_glCheckFramebufferStatus(target);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_lazy_real_glFramebufferTexture1D = NULL;
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if(glad_lazy_real_glFramebufferTexture1D == NULL) {
+        glad_lazy_real_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_loader("glFramebufferTexture1D");
+        if(glad_glFramebufferTexture1D == glad_lazy_glFramebufferTexture1D) glad_glFramebufferTexture1D = glad_lazy_real_glFramebufferTexture1D;
+    }
+    glad_lazy_real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_lazy_real_glFramebufferTexture2D = NULL;
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if(glad_lazy_real_glFramebufferTexture2D == NULL) {
+        glad_lazy_real_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_loader("glFramebufferTexture2D");
+        if(glad_glFramebufferTexture2D == glad_lazy_glFramebufferTexture2D) glad_glFramebufferTexture2D = glad_lazy_real_glFramebufferTexture2D;
+    }
+    glad_lazy_real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_lazy_real_glFramebufferTexture3D = NULL;
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    if(glad_lazy_real_glFramebufferTexture3D == NULL) {
+        glad_lazy_real_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_loader("glFramebufferTexture3D");
+        if(glad_glFramebufferTexture3D == glad_lazy_glFramebufferTexture3D) glad_glFramebufferTexture3D = glad_lazy_real_glFramebufferTexture3D;
+    }
+    glad_lazy_real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_lazy_real_glFramebufferRenderbuffer = NULL;
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if(glad_lazy_real_glFramebufferRenderbuffer == NULL) {
+        glad_lazy_real_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_loader("glFramebufferRenderbuffer");
+        if(glad_glFramebufferRenderbuffer == glad_lazy_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = glad_lazy_real_glFramebufferRenderbuffer;
+    }
+    glad_lazy_real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_lazy_real_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetFramebufferAttachmentParameteriv == NULL) {
+        glad_lazy_real_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_loader("glGetFramebufferAttachmentParameteriv");
+        if(glad_glGetFramebufferAttachmentParameteriv == glad_lazy_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = glad_lazy_real_glGetFramebufferAttachmentParameteriv;
+    }
+    glad_lazy_real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+static PFNGLGENERATEMIPMAPPROC glad_lazy_real_glGenerateMipmap = NULL;
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+    if(glad_lazy_real_glGenerateMipmap == NULL) {
+        glad_lazy_real_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_loader("glGenerateMipmap");
+        if(glad_glGenerateMipmap == glad_lazy_glGenerateMipmap) glad_glGenerateMipmap = glad_lazy_real_glGenerateMipmap;
+    }
+    glad_lazy_real_glGenerateMipmap(target);
+}
+
+static PFNGLBLITFRAMEBUFFERPROC glad_lazy_real_glBlitFramebuffer = NULL;
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if(glad_lazy_real_glBlitFramebuffer == NULL) {
+        glad_lazy_real_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_loader("glBlitFramebuffer");
+        if(glad_glBlitFramebuffer == glad_lazy_glBlitFramebuffer) glad_glBlitFramebuffer = glad_lazy_real_glBlitFramebuffer;
+    }
+    glad_lazy_real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_lazy_real_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glRenderbufferStorageMultisample == NULL) {
+        glad_lazy_real_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_loader("glRenderbufferStorageMultisample");
+        if(glad_glRenderbufferStorageMultisample == glad_lazy_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = glad_lazy_real_glRenderbufferStorageMultisample;
+    }
+    glad_lazy_real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_lazy_real_glFramebufferTextureLayer = NULL;
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if(glad_lazy_real_glFramebufferTextureLayer == NULL) {
+        glad_lazy_real_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_loader("glFramebufferTextureLayer");
+        if(glad_glFramebufferTextureLayer == glad_lazy_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = glad_lazy_real_glFramebufferTextureLayer;
+    }
+    glad_lazy_real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static PFNGLMAPBUFFERRANGEPROC glad_lazy_real_glMapBufferRange = NULL;
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if(glad_lazy_real_glMapBufferRange == NULL) {
+        glad_lazy_real_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_loader("glMapBufferRange");
+        if(glad_glMapBufferRange == glad_lazy_glMapBufferRange) glad_glMapBufferRange = glad_lazy_real_glMapBufferRange;
+    }
+    return glad_lazy_real_glMapBufferRange(target, offset, length, access);
+}
+
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_lazy_real_glFlushMappedBufferRange = NULL;
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    if(glad_lazy_real_glFlushMappedBufferRange == NULL) {
+        glad_lazy_real_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_loader("glFlushMappedBufferRange");
+        if(glad_glFlushMappedBufferRange == glad_lazy_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = glad_lazy_real_glFlushMappedBufferRange;
+    }
+    glad_lazy_real_glFlushMappedBufferRange(target, offset, length);
+}
+
+static PFNGLBINDVERTEXARRAYPROC glad_lazy_real_glBindVertexArray = NULL;
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+    if(glad_lazy_real_glBindVertexArray == NULL) {
+        glad_lazy_real_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_loader("glBindVertexArray");
+        if(glad_glBindVertexArray == glad_lazy_glBindVertexArray) glad_glBindVertexArray = glad_lazy_real_glBindVertexArray;
+    }
+    glad_lazy_real_glBindVertexArray(array);
+}
+
+static PFNGLDELETEVERTEXARRAYSPROC glad_lazy_real_glDeleteVertexArrays = NULL;
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    if(glad_lazy_real_glDeleteVertexArrays == NULL) {
+        glad_lazy_real_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_loader("glDeleteVertexArrays");
+        if(glad_glDeleteVertexArrays == glad_lazy_glDeleteVertexArrays) glad_glDeleteVertexArrays = glad_lazy_real_glDeleteVertexArrays;
+    }
+    glad_lazy_real_glDeleteVertexArrays(n, arrays);
+}
+
+static PFNGLGENVERTEXARRAYSPROC glad_lazy_real_glGenVertexArrays = NULL;
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    if(glad_lazy_real_glGenVertexArrays == NULL) {
+        glad_lazy_real_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_loader("glGenVertexArrays");
+        if(glad_glGenVertexArrays == glad_lazy_glGenVertexArrays) glad_glGenVertexArrays = glad_lazy_real_glGenVertexArrays;
+    }
+    glad_lazy_real_glGenVertexArrays(n, arrays);
+}
+
+static PFNGLISVERTEXARRAYPROC glad_lazy_real_glIsVertexArray = NULL;
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+    if(glad_lazy_real_glIsVertexArray == NULL) {
+        glad_lazy_real_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_loader("glIsVertexArray");
+        if(glad_glIsVertexArray == glad_lazy_glIsVertexArray) glad_glIsVertexArray = glad_lazy_real_glIsVertexArray;
+    }
+    return glad_lazy_real_glIsVertexArray(array);
+}
+
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_lazy_real_glDrawArraysInstanced = NULL;
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    if(glad_lazy_real_glDrawArraysInstanced == NULL) {
+        glad_lazy_real_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_loader("glDrawArraysInstanced");
+        if(glad_glDrawArraysInstanced == glad_lazy_glDrawArraysInstanced) glad_glDrawArraysInstanced = glad_lazy_real_glDrawArraysInstanced;
+    }
+    glad_lazy_real_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_lazy_real_glDrawElementsInstanced = NULL;
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    if(glad_lazy_real_glDrawElementsInstanced == NULL) {
+        glad_lazy_real_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_loader("glDrawElementsInstanced");
+        if(glad_glDrawElementsInstanced == glad_lazy_glDrawElementsInstanced) glad_glDrawElementsInstanced = glad_lazy_real_glDrawElementsInstanced;
+    }
+    glad_lazy_real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static PFNGLTEXBUFFERPROC glad_lazy_real_glTexBuffer = NULL;
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    if(glad_lazy_real_glTexBuffer == NULL) {
+        glad_lazy_real_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_loader("glTexBuffer");
+        if(glad_glTexBuffer == glad_lazy_glTexBuffer) glad_glTexBuffer = glad_lazy_real_glTexBuffer;
+    }
+    glad_lazy_real_glTexBuffer(target, internalformat, buffer);
+}
+
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_lazy_real_glPrimitiveRestartIndex = NULL;
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+    if(glad_lazy_real_glPrimitiveRestartIndex == NULL) {
+        glad_lazy_real_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_loader("glPrimitiveRestartIndex");
+        if(glad_glPrimitiveRestartIndex == glad_lazy_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = glad_lazy_real_glPrimitiveRestartIndex;
+    }
+    glad_lazy_real_glPrimitiveRestartIndex(index);
+}
+
+static PFNGLCOPYBUFFERSUBDATAPROC glad_lazy_real_glCopyBufferSubData = NULL;
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if(glad_lazy_real_glCopyBufferSubData == NULL) {
+        glad_lazy_real_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_loader("glCopyBufferSubData");
+        if(glad_glCopyBufferSubData == glad_lazy_glCopyBufferSubData) glad_glCopyBufferSubData = glad_lazy_real_glCopyBufferSubData;
+    }
+    glad_lazy_real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static PFNGLGETUNIFORMINDICESPROC glad_lazy_real_glGetUniformIndices = NULL;
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    if(glad_lazy_real_glGetUniformIndices == NULL) {
+        glad_lazy_real_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_loader("glGetUniformIndices");
+        if(glad_glGetUniformIndices == glad_lazy_glGetUniformIndices) glad_glGetUniformIndices = glad_lazy_real_glGetUniformIndices;
+    }
+    glad_lazy_real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_lazy_real_glGetActiveUniformsiv = NULL;
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetActiveUniformsiv == NULL) {
+        glad_lazy_real_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_loader("glGetActiveUniformsiv");
+        if(glad_glGetActiveUniformsiv == glad_lazy_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = glad_lazy_real_glGetActiveUniformsiv;
+    }
+    glad_lazy_real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_lazy_real_glGetActiveUniformName = NULL;
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    if(glad_lazy_real_glGetActiveUniformName == NULL) {
+        glad_lazy_real_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_loader("glGetActiveUniformName");
+        if(glad_glGetActiveUniformName == glad_lazy_glGetActiveUniformName) glad_glGetActiveUniformName = glad_lazy_real_glGetActiveUniformName;
+    }
+    glad_lazy_real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_lazy_real_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    if(glad_lazy_real_glGetUniformBlockIndex == NULL) {
+        glad_lazy_real_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_loader("glGetUniformBlockIndex");
+        if(glad_glGetUniformBlockIndex == glad_lazy_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = glad_lazy_real_glGetUniformBlockIndex;
+    }
+    return glad_lazy_real_glGetUniformBlockIndex(program, uniformBlockName);
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_lazy_real_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetActiveUniformBlockiv == NULL) {
+        glad_lazy_real_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_loader("glGetActiveUniformBlockiv");
+        if(glad_glGetActiveUniformBlockiv == glad_lazy_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = glad_lazy_real_glGetActiveUniformBlockiv;
+    }
+    glad_lazy_real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_lazy_real_glGetActiveUniformBlockName = NULL;
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    if(glad_lazy_real_glGetActiveUniformBlockName == NULL) {
+        glad_lazy_real_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_loader("glGetActiveUniformBlockName");
+        if(glad_glGetActiveUniformBlockName == glad_lazy_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = glad_lazy_real_glGetActiveUniformBlockName;
+    }
+    glad_lazy_real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_lazy_real_glUniformBlockBinding = NULL;
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    if(glad_lazy_real_glUniformBlockBinding == NULL) {
+        glad_lazy_real_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_loader("glUniformBlockBinding");
+        if(glad_glUniformBlockBinding == glad_lazy_glUniformBlockBinding) glad_glUniformBlockBinding = glad_lazy_real_glUniformBlockBinding;
+    }
+    glad_lazy_real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_lazy_real_glDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if(glad_lazy_real_glDrawElementsBaseVertex == NULL) {
+        glad_lazy_real_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_loader("glDrawElementsBaseVertex");
+        if(glad_glDrawElementsBaseVertex == glad_lazy_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = glad_lazy_real_glDrawElementsBaseVertex;
+    }
+    glad_lazy_real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_lazy_real_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if(glad_lazy_real_glDrawRangeElementsBaseVertex == NULL) {
+        glad_lazy_real_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_loader("glDrawRangeElementsBaseVertex");
+        if(glad_glDrawRangeElementsBaseVertex == glad_lazy_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = glad_lazy_real_glDrawRangeElementsBaseVertex;
+    }
+    glad_lazy_real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_lazy_real_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    if(glad_lazy_real_glDrawElementsInstancedBaseVertex == NULL) {
+        glad_lazy_real_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_loader("glDrawElementsInstancedBaseVertex");
+        if(glad_glDrawElementsInstancedBaseVertex == glad_lazy_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = glad_lazy_real_glDrawElementsInstancedBaseVertex;
+    }
+    glad_lazy_real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_lazy_real_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    if(glad_lazy_real_glMultiDrawElementsBaseVertex == NULL) {
+        glad_lazy_real_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_loader("glMultiDrawElementsBaseVertex");
+        if(glad_glMultiDrawElementsBaseVertex == glad_lazy_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = glad_lazy_real_glMultiDrawElementsBaseVertex;
+    }
+    glad_lazy_real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+static PFNGLPROVOKINGVERTEXPROC glad_lazy_real_glProvokingVertex = NULL;
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+    if(glad_lazy_real_glProvokingVertex == NULL) {
+        glad_lazy_real_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_loader("glProvokingVertex");
+        if(glad_glProvokingVertex == glad_lazy_glProvokingVertex) glad_glProvokingVertex = glad_lazy_real_glProvokingVertex;
+    }
+    glad_lazy_real_glProvokingVertex(mode);
+}
+
+static PFNGLFENCESYNCPROC glad_lazy_real_glFenceSync = NULL;
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+    if(glad_lazy_real_glFenceSync == NULL) {
+        glad_lazy_real_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_loader("glFenceSync");
+        if(glad_glFenceSync == glad_lazy_glFenceSync) glad_glFenceSync = glad_lazy_real_glFenceSync;
+    }
+    return glad_lazy_real_glFenceSync(condition, flags);
+}
+
+static PFNGLISSYNCPROC glad_lazy_real_glIsSync = NULL;
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+    if(glad_lazy_real_glIsSync == NULL) {
+        glad_lazy_real_glIsSync = (PFNGLISSYNCPROC)glad_lazy_loader("glIsSync");
+        if(glad_glIsSync == glad_lazy_glIsSync) glad_glIsSync = glad_lazy_real_glIsSync;
+    }
+    return glad_lazy_real_glIsSync(sync);
+}
+
+static PFNGLDELETESYNCPROC glad_lazy_real_glDeleteSync = NULL;
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+    if(glad_lazy_real_glDeleteSync == NULL) {
+        glad_lazy_real_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_loader("glDeleteSync");
+        if(glad_glDeleteSync == glad_lazy_glDeleteSync) glad_glDeleteSync = glad_lazy_real_glDeleteSync;
+    }
+    glad_lazy_real_glDeleteSync(sync);
+}
+
+static PFNGLCLIENTWAITSYNCPROC glad_lazy_real_glClientWaitSync = NULL;
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if(glad_lazy_real_glClientWaitSync == NULL) {
+        glad_lazy_real_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_loader("glClientWaitSync");
+        if(glad_glClientWaitSync == glad_lazy_glClientWaitSync) glad_glClientWaitSync = glad_lazy_real_glClientWaitSync;
+    }
+    return glad_lazy_real_glClientWaitSync(sync, flags, timeout);
+}
+
+static PFNGLWAITSYNCPROC glad_lazy_real_glWaitSync = NULL;
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if(glad_lazy_real_glWaitSync == NULL) {
+        glad_lazy_real_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_loader("glWaitSync");
+        if(glad_glWaitSync == glad_lazy_glWaitSync) glad_glWaitSync = glad_lazy_real_glWaitSync;
+    }
+    glad_lazy_real_glWaitSync(sync, flags, timeout);
+}
+
+static PFNGLGETINTEGER64VPROC glad_lazy_real_glGetInteger64v = NULL;
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+    if(glad_lazy_real_glGetInteger64v == NULL) {
+        glad_lazy_real_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_loader("glGetInteger64v");
+        if(glad_glGetInteger64v == glad_lazy_glGetInteger64v) glad_glGetInteger64v = glad_lazy_real_glGetInteger64v;
+    }
+    glad_lazy_real_glGetInteger64v(pname, data);
+}
+
+static PFNGLGETSYNCIVPROC glad_lazy_real_glGetSynciv = NULL;
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+    if(glad_lazy_real_glGetSynciv == NULL) {
+        glad_lazy_real_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_loader("glGetSynciv");
+        if(glad_glGetSynciv == glad_lazy_glGetSynciv) glad_glGetSynciv = glad_lazy_real_glGetSynciv;
+    }
+    glad_lazy_real_glGetSynciv(sync, pname, bufSize, length, values);
+}
+
+static PFNGLGETINTEGER64I_VPROC glad_lazy_real_glGetInteger64i_v = NULL;
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    if(glad_lazy_real_glGetInteger64i_v == NULL) {
+        glad_lazy_real_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_loader("glGetInteger64i_v");
+        if(glad_glGetInteger64i_v == glad_lazy_glGetInteger64i_v) glad_glGetInteger64i_v = glad_lazy_real_glGetInteger64i_v;
+    }
+    glad_lazy_real_glGetInteger64i_v(target, index, data);
+}
+
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_lazy_real_glGetBufferParameteri64v = NULL;
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    if(glad_lazy_real_glGetBufferParameteri64v == NULL) {
+        glad_lazy_real_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_loader("glGetBufferParameteri64v");
+        if(glad_glGetBufferParameteri64v == glad_lazy_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = glad_lazy_real_glGetBufferParameteri64v;
+    }
+    glad_lazy_real_glGetBufferParameteri64v(target, pname, params);
+}
+
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_lazy_real_glFramebufferTexture = NULL;
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if(glad_lazy_real_glFramebufferTexture == NULL) {
+        glad_lazy_real_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_loader("glFramebufferTexture");
+        if(glad_glFramebufferTexture == glad_lazy_glFramebufferTexture) glad_glFramebufferTexture = glad_lazy_real_glFramebufferTexture;
+    }
+    glad_lazy_real_glFramebufferTexture(target, attachment, texture, level);
+}
+
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_lazy_real_glTexImage2DMultisample = NULL;
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if(glad_lazy_real_glTexImage2DMultisample == NULL) {
+        glad_lazy_real_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_loader("glTexImage2DMultisample");
+        if(glad_glTexImage2DMultisample == glad_lazy_glTexImage2DMultisample) glad_glTexImage2DMultisample = glad_lazy_real_glTexImage2DMultisample;
+    }
+    glad_lazy_real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_lazy_real_glTexImage3DMultisample = NULL;
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if(glad_lazy_real_glTexImage3DMultisample == NULL) {
+        glad_lazy_real_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_loader("glTexImage3DMultisample");
+        if(glad_glTexImage3DMultisample == glad_lazy_glTexImage3DMultisample) glad_glTexImage3DMultisample = glad_lazy_real_glTexImage3DMultisample;
+    }
+    glad_lazy_real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static PFNGLGETMULTISAMPLEFVPROC glad_lazy_real_glGetMultisamplefv = NULL;
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    if(glad_lazy_real_glGetMultisamplefv == NULL) {
+        glad_lazy_real_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_loader("glGetMultisamplefv");
+        if(glad_glGetMultisamplefv == glad_lazy_glGetMultisamplefv) glad_glGetMultisamplefv = glad_lazy_real_glGetMultisamplefv;
+    }
+    glad_lazy_real_glGetMultisamplefv(pname, index, val);
+}
+
+static PFNGLSAMPLEMASKIPROC glad_lazy_real_glSampleMaski = NULL;
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    if(glad_lazy_real_glSampleMaski == NULL) {
+        glad_lazy_real_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_loader("glSampleMaski");
+        if(glad_glSampleMaski == glad_lazy_glSampleMaski) glad_glSampleMaski = glad_lazy_real_glSampleMaski;
+    }
+    glad_lazy_real_glSampleMaski(maskNumber, mask);
+}
+
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_lazy_real_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    if(glad_lazy_real_glBindFragDataLocationIndexed == NULL) {
+        glad_lazy_real_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_loader("glBindFragDataLocationIndexed");
+        if(glad_glBindFragDataLocationIndexed == glad_lazy_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = glad_lazy_real_glBindFragDataLocationIndexed;
+    }
+    glad_lazy_real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static PFNGLGETFRAGDATAINDEXPROC glad_lazy_real_glGetFragDataIndex = NULL;
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    if(glad_lazy_real_glGetFragDataIndex == NULL) {
+        glad_lazy_real_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_loader("glGetFragDataIndex");
+        if(glad_glGetFragDataIndex == glad_lazy_glGetFragDataIndex) glad_glGetFragDataIndex = glad_lazy_real_glGetFragDataIndex;
+    }
+    return glad_lazy_real_glGetFragDataIndex(program, name);
+}
+
+static PFNGLGENSAMPLERSPROC glad_lazy_real_glGenSamplers = NULL;
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+    if(glad_lazy_real_glGenSamplers == NULL) {
+        glad_lazy_real_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_loader("glGenSamplers");
+        if(glad_glGenSamplers == glad_lazy_glGenSamplers) glad_glGenSamplers = glad_lazy_real_glGenSamplers;
+    }
+    glad_lazy_real_glGenSamplers(count, samplers);
+}
+
+static PFNGLDELETESAMPLERSPROC glad_lazy_real_glDeleteSamplers = NULL;
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    if(glad_lazy_real_glDeleteSamplers == NULL) {
+        glad_lazy_real_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_loader("glDeleteSamplers");
+        if(glad_glDeleteSamplers == glad_lazy_glDeleteSamplers) glad_glDeleteSamplers = glad_lazy_real_glDeleteSamplers;
+    }
+    glad_lazy_real_glDeleteSamplers(count, samplers);
+}
+
+static PFNGLISSAMPLERPROC glad_lazy_real_glIsSampler = NULL;
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+    if(glad_lazy_real_glIsSampler == NULL) {
+        glad_lazy_real_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_loader("glIsSampler");
+        if(glad_glIsSampler == glad_lazy_glIsSampler) glad_glIsSampler = glad_lazy_real_glIsSampler;
+    }
+    return glad_lazy_real_glIsSampler(sampler);
+}
+
+static PFNGLBINDSAMPLERPROC glad_lazy_real_glBindSampler = NULL;
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+    if(glad_lazy_real_glBindSampler == NULL) {
+        glad_lazy_real_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_loader("glBindSampler");
+        if(glad_glBindSampler == glad_lazy_glBindSampler) glad_glBindSampler = glad_lazy_real_glBindSampler;
+    }
+    glad_lazy_real_glBindSampler(unit, sampler);
+}
+
+static PFNGLSAMPLERPARAMETERIPROC glad_lazy_real_glSamplerParameteri = NULL;
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    if(glad_lazy_real_glSamplerParameteri == NULL) {
+        glad_lazy_real_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_loader("glSamplerParameteri");
+        if(glad_glSamplerParameteri == glad_lazy_glSamplerParameteri) glad_glSamplerParameteri = glad_lazy_real_glSamplerParameteri;
+    }
+    glad_lazy_real_glSamplerParameteri(sampler, pname, param);
+}
+
+static PFNGLSAMPLERPARAMETERIVPROC glad_lazy_real_glSamplerParameteriv = NULL;
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    if(glad_lazy_real_glSamplerParameteriv == NULL) {
+        glad_lazy_real_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_loader("glSamplerParameteriv");
+        if(glad_glSamplerParameteriv == glad_lazy_glSamplerParameteriv) glad_glSamplerParameteriv = glad_lazy_real_glSamplerParameteriv;
+    }
+    glad_lazy_real_glSamplerParameteriv(sampler, pname, param);
+}
+
+static PFNGLSAMPLERPARAMETERFPROC glad_lazy_real_glSamplerParameterf = NULL;
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    if(glad_lazy_real_glSamplerParameterf == NULL) {
+        glad_lazy_real_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_loader("glSamplerParameterf");
+        if(glad_glSamplerParameterf == glad_lazy_glSamplerParameterf) glad_glSamplerParameterf = glad_lazy_real_glSamplerParameterf;
+    }
+    glad_lazy_real_glSamplerParameterf(sampler, pname, param);
+}
+
+static PFNGLSAMPLERPARAMETERFVPROC glad_lazy_real_glSamplerParameterfv = NULL;
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    if(glad_lazy_real_glSamplerParameterfv == NULL) {
+        glad_lazy_real_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_loader("glSamplerParameterfv");
+        if(glad_glSamplerParameterfv == glad_lazy_glSamplerParameterfv) glad_glSamplerParameterfv = glad_lazy_real_glSamplerParameterfv;
+    }
+    glad_lazy_real_glSamplerParameterfv(sampler, pname, param);
+}
+
+static PFNGLSAMPLERPARAMETERIIVPROC glad_lazy_real_glSamplerParameterIiv = NULL;
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    if(glad_lazy_real_glSamplerParameterIiv == NULL) {
+        glad_lazy_real_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_loader("glSamplerParameterIiv");
+        if(glad_glSamplerParameterIiv == glad_lazy_glSamplerParameterIiv) glad_glSamplerParameterIiv = glad_lazy_real_glSamplerParameterIiv;
+    }
+    glad_lazy_real_glSamplerParameterIiv(sampler, pname, param);
+}
+
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_lazy_real_glSamplerParameterIuiv = NULL;
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    if(glad_lazy_real_glSamplerParameterIuiv == NULL) {
+        glad_lazy_real_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_loader("glSamplerParameterIuiv");
+        if(glad_glSamplerParameterIuiv == glad_lazy_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = glad_lazy_real_glSamplerParameterIuiv;
+    }
+    glad_lazy_real_glSamplerParameterIuiv(sampler, pname, param);
+}
+
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_lazy_real_glGetSamplerParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetSamplerParameteriv == NULL) {
+        glad_lazy_real_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_loader("glGetSamplerParameteriv");
+        if(glad_glGetSamplerParameteriv == glad_lazy_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = glad_lazy_real_glGetSamplerParameteriv;
+    }
+    glad_lazy_real_glGetSamplerParameteriv(sampler, pname, params);
+}
+
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_lazy_real_glGetSamplerParameterIiv = NULL;
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetSamplerParameterIiv == NULL) {
+        glad_lazy_real_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_loader("glGetSamplerParameterIiv");
+        if(glad_glGetSamplerParameterIiv == glad_lazy_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = glad_lazy_real_glGetSamplerParameterIiv;
+    }
+    glad_lazy_real_glGetSamplerParameterIiv(sampler, pname, params);
+}
+
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_lazy_real_glGetSamplerParameterfv = NULL;
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    if(glad_lazy_real_glGetSamplerParameterfv == NULL) {
+        glad_lazy_real_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_loader("glGetSamplerParameterfv");
+        if(glad_glGetSamplerParameterfv == glad_lazy_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = glad_lazy_real_glGetSamplerParameterfv;
+    }
+    glad_lazy_real_glGetSamplerParameterfv(sampler, pname, params);
+}
+
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_lazy_real_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    if(glad_lazy_real_glGetSamplerParameterIuiv == NULL) {
+        glad_lazy_real_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_loader("glGetSamplerParameterIuiv");
+        if(glad_glGetSamplerParameterIuiv == glad_lazy_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = glad_lazy_real_glGetSamplerParameterIuiv;
+    }
+    glad_lazy_real_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+
+static PFNGLQUERYCOUNTERPROC glad_lazy_real_glQueryCounter = NULL;
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+    if(glad_lazy_real_glQueryCounter == NULL) {
+        glad_lazy_real_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_loader("glQueryCounter");
+        if(glad_glQueryCounter == glad_lazy_glQueryCounter) glad_glQueryCounter = glad_lazy_real_glQueryCounter;
+    }
+    glad_lazy_real_glQueryCounter(id, target);
+}
+
+static PFNGLGETQUERYOBJECTI64VPROC glad_lazy_real_glGetQueryObjecti64v = NULL;
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    if(glad_lazy_real_glGetQueryObjecti64v == NULL) {
+        glad_lazy_real_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_loader("glGetQueryObjecti64v");
+        if(glad_glGetQueryObjecti64v == glad_lazy_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = glad_lazy_real_glGetQueryObjecti64v;
+    }
+    glad_lazy_real_glGetQueryObjecti64v(id, pname, params);
+}
+
+static PFNGLGETQUERYOBJECTUI64VPROC glad_lazy_real_glGetQueryObjectui64v = NULL;
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    if(glad_lazy_real_glGetQueryObjectui64v == NULL) {
+        glad_lazy_real_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_loader("glGetQueryObjectui64v");
+        if(glad_glGetQueryObjectui64v == glad_lazy_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = glad_lazy_real_glGetQueryObjectui64v;
+    }
+    glad_lazy_real_glGetQueryObjectui64v(id, pname, params);
+}
+
+static PFNGLVERTEXATTRIBDIVISORPROC glad_lazy_real_glVertexAttribDivisor = NULL;
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    if(glad_lazy_real_glVertexAttribDivisor == NULL) {
+        glad_lazy_real_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_loader("glVertexAttribDivisor");
+        if(glad_glVertexAttribDivisor == glad_lazy_glVertexAttribDivisor) glad_glVertexAttribDivisor = glad_lazy_real_glVertexAttribDivisor;
+    }
+    glad_lazy_real_glVertexAttribDivisor(index, divisor);
+}
+
+static PFNGLVERTEXATTRIBP1UIPROC glad_lazy_real_glVertexAttribP1ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if(glad_lazy_real_glVertexAttribP1ui == NULL) {
+        glad_lazy_real_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_loader("glVertexAttribP1ui");
+        if(glad_glVertexAttribP1ui == glad_lazy_glVertexAttribP1ui) glad_glVertexAttribP1ui = glad_lazy_real_glVertexAttribP1ui;
+    }
+    glad_lazy_real_glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP1UIVPROC glad_lazy_real_glVertexAttribP1uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if(glad_lazy_real_glVertexAttribP1uiv == NULL) {
+        glad_lazy_real_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_loader("glVertexAttribP1uiv");
+        if(glad_glVertexAttribP1uiv == glad_lazy_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = glad_lazy_real_glVertexAttribP1uiv;
+    }
+    glad_lazy_real_glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP2UIPROC glad_lazy_real_glVertexAttribP2ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if(glad_lazy_real_glVertexAttribP2ui == NULL) {
+        glad_lazy_real_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_loader("glVertexAttribP2ui");
+        if(glad_glVertexAttribP2ui == glad_lazy_glVertexAttribP2ui) glad_glVertexAttribP2ui = glad_lazy_real_glVertexAttribP2ui;
+    }
+    glad_lazy_real_glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP2UIVPROC glad_lazy_real_glVertexAttribP2uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if(glad_lazy_real_glVertexAttribP2uiv == NULL) {
+        glad_lazy_real_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_loader("glVertexAttribP2uiv");
+        if(glad_glVertexAttribP2uiv == glad_lazy_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = glad_lazy_real_glVertexAttribP2uiv;
+    }
+    glad_lazy_real_glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP3UIPROC glad_lazy_real_glVertexAttribP3ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if(glad_lazy_real_glVertexAttribP3ui == NULL) {
+        glad_lazy_real_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_loader("glVertexAttribP3ui");
+        if(glad_glVertexAttribP3ui == glad_lazy_glVertexAttribP3ui) glad_glVertexAttribP3ui = glad_lazy_real_glVertexAttribP3ui;
+    }
+    glad_lazy_real_glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP3UIVPROC glad_lazy_real_glVertexAttribP3uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if(glad_lazy_real_glVertexAttribP3uiv == NULL) {
+        glad_lazy_real_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_loader("glVertexAttribP3uiv");
+        if(glad_glVertexAttribP3uiv == glad_lazy_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = glad_lazy_real_glVertexAttribP3uiv;
+    }
+    glad_lazy_real_glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP4UIPROC glad_lazy_real_glVertexAttribP4ui = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if(glad_lazy_real_glVertexAttribP4ui == NULL) {
+        glad_lazy_real_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_loader("glVertexAttribP4ui");
+        if(glad_glVertexAttribP4ui == glad_lazy_glVertexAttribP4ui) glad_glVertexAttribP4ui = glad_lazy_real_glVertexAttribP4ui;
+    }
+    glad_lazy_real_glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static PFNGLVERTEXATTRIBP4UIVPROC glad_lazy_real_glVertexAttribP4uiv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if(glad_lazy_real_glVertexAttribP4uiv == NULL) {
+        glad_lazy_real_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_loader("glVertexAttribP4uiv");
+        if(glad_glVertexAttribP4uiv == glad_lazy_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = glad_lazy_real_glVertexAttribP4uiv;
+    }
+    glad_lazy_real_glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+static PFNGLVERTEXP2UIPROC glad_lazy_real_glVertexP2ui = NULL;
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+    if(glad_lazy_real_glVertexP2ui == NULL) {
+        glad_lazy_real_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_loader("glVertexP2ui");
+        if(glad_glVertexP2ui == glad_lazy_glVertexP2ui) glad_glVertexP2ui = glad_lazy_real_glVertexP2ui;
+    }
+    glad_lazy_real_glVertexP2ui(type, value);
+}
+
+static PFNGLVERTEXP2UIVPROC glad_lazy_real_glVertexP2uiv = NULL;
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+    if(glad_lazy_real_glVertexP2uiv == NULL) {
+        glad_lazy_real_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_loader("glVertexP2uiv");
+        if(glad_glVertexP2uiv == glad_lazy_glVertexP2uiv) glad_glVertexP2uiv = glad_lazy_real_glVertexP2uiv;
+    }
+    glad_lazy_real_glVertexP2uiv(type, value);
+}
+
+static PFNGLVERTEXP3UIPROC glad_lazy_real_glVertexP3ui = NULL;
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+    if(glad_lazy_real_glVertexP3ui == NULL) {
+        glad_lazy_real_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_loader("glVertexP3ui");
+        if(glad_glVertexP3ui == glad_lazy_glVertexP3ui) glad_glVertexP3ui = glad_lazy_real_glVertexP3ui;
+    }
+    glad_lazy_real_glVertexP3ui(type, value);
+}
+
+static PFNGLVERTEXP3UIVPROC glad_lazy_real_glVertexP3uiv = NULL;
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+    if(glad_lazy_real_glVertexP3uiv == NULL) {
+        glad_lazy_real_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_loader("glVertexP3uiv");
+        if(glad_glVertexP3uiv == glad_lazy_glVertexP3uiv) glad_glVertexP3uiv = glad_lazy_real_glVertexP3uiv;
+    }
+    glad_lazy_real_glVertexP3uiv(type, value);
+}
+
+static PFNGLVERTEXP4UIPROC glad_lazy_real_glVertexP4ui = NULL;
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+    if(glad_lazy_real_glVertexP4ui == NULL) {
+        glad_lazy_real_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_loader("glVertexP4ui");
+        if(glad_glVertexP4ui == glad_lazy_glVertexP4ui) glad_glVertexP4ui = glad_lazy_real_glVertexP4ui;
+    }
+    glad_lazy_real_glVertexP4ui(type, value);
+}
+
+static PFNGLVERTEXP4UIVPROC glad_lazy_real_glVertexP4uiv = NULL;
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+    if(glad_lazy_real_glVertexP4uiv == NULL) {
+        glad_lazy_real_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_loader("glVertexP4uiv");
+        if(glad_glVertexP4uiv == glad_lazy_glVertexP4uiv) glad_glVertexP4uiv = glad_lazy_real_glVertexP4uiv;
+    }
+    glad_lazy_real_glVertexP4uiv(type, value);
+}
+
+static PFNGLTEXCOORDP1UIPROC glad_lazy_real_glTexCoordP1ui = NULL;
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+    if(glad_lazy_real_glTexCoordP1ui == NULL) {
+        glad_lazy_real_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_loader("glTexCoordP1ui");
+        if(glad_glTexCoordP1ui == glad_lazy_glTexCoordP1ui) glad_glTexCoordP1ui = glad_lazy_real_glTexCoordP1ui;
+    }
+    glad_lazy_real_glTexCoordP1ui(type, coords);
+}
+
+static PFNGLTEXCOORDP1UIVPROC glad_lazy_real_glTexCoordP1uiv = NULL;
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glTexCoordP1uiv == NULL) {
+        glad_lazy_real_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_loader("glTexCoordP1uiv");
+        if(glad_glTexCoordP1uiv == glad_lazy_glTexCoordP1uiv) glad_glTexCoordP1uiv = glad_lazy_real_glTexCoordP1uiv;
+    }
+    glad_lazy_real_glTexCoordP1uiv(type, coords);
+}
+
+static PFNGLTEXCOORDP2UIPROC glad_lazy_real_glTexCoordP2ui = NULL;
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+    if(glad_lazy_real_glTexCoordP2ui == NULL) {
+        glad_lazy_real_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_loader("glTexCoordP2ui");
+        if(glad_glTexCoordP2ui == glad_lazy_glTexCoordP2ui) glad_glTexCoordP2ui = glad_lazy_real_glTexCoordP2ui;
+    }
+    glad_lazy_real_glTexCoordP2ui(type, coords);
+}
+
+static PFNGLTEXCOORDP2UIVPROC glad_lazy_real_glTexCoordP2uiv = NULL;
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glTexCoordP2uiv == NULL) {
+        glad_lazy_real_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_loader("glTexCoordP2uiv");
+        if(glad_glTexCoordP2uiv == glad_lazy_glTexCoordP2uiv) glad_glTexCoordP2uiv = glad_lazy_real_glTexCoordP2uiv;
+    }
+    glad_lazy_real_glTexCoordP2uiv(type, coords);
+}
+
+static PFNGLTEXCOORDP3UIPROC glad_lazy_real_glTexCoordP3ui = NULL;
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+    if(glad_lazy_real_glTexCoordP3ui == NULL) {
+        glad_lazy_real_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_loader("glTexCoordP3ui");
+        if(glad_glTexCoordP3ui == glad_lazy_glTexCoordP3ui) glad_glTexCoordP3ui = glad_lazy_real_glTexCoordP3ui;
+    }
+    glad_lazy_real_glTexCoordP3ui(type, coords);
+}
+
+static PFNGLTEXCOORDP3UIVPROC glad_lazy_real_glTexCoordP3uiv = NULL;
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glTexCoordP3uiv == NULL) {
+        glad_lazy_real_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_loader("glTexCoordP3uiv");
+        if(glad_glTexCoordP3uiv == glad_lazy_glTexCoordP3uiv) glad_glTexCoordP3uiv = glad_lazy_real_glTexCoordP3uiv;
+    }
+    glad_lazy_real_glTexCoordP3uiv(type, coords);
+}
+
+static PFNGLTEXCOORDP4UIPROC glad_lazy_real_glTexCoordP4ui = NULL;
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+    if(glad_lazy_real_glTexCoordP4ui == NULL) {
+        glad_lazy_real_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_loader("glTexCoordP4ui");
+        if(glad_glTexCoordP4ui == glad_lazy_glTexCoordP4ui) glad_glTexCoordP4ui = glad_lazy_real_glTexCoordP4ui;
+    }
+    glad_lazy_real_glTexCoordP4ui(type, coords);
+}
+
+static PFNGLTEXCOORDP4UIVPROC glad_lazy_real_glTexCoordP4uiv = NULL;
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glTexCoordP4uiv == NULL) {
+        glad_lazy_real_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_loader("glTexCoordP4uiv");
+        if(glad_glTexCoordP4uiv == glad_lazy_glTexCoordP4uiv) glad_glTexCoordP4uiv = glad_lazy_real_glTexCoordP4uiv;
+    }
+    glad_lazy_real_glTexCoordP4uiv(type, coords);
+}
+
+static PFNGLMULTITEXCOORDP1UIPROC glad_lazy_real_glMultiTexCoordP1ui = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    if(glad_lazy_real_glMultiTexCoordP1ui == NULL) {
+        glad_lazy_real_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_loader("glMultiTexCoordP1ui");
+        if(glad_glMultiTexCoordP1ui == glad_lazy_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = glad_lazy_real_glMultiTexCoordP1ui;
+    }
+    glad_lazy_real_glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP1UIVPROC glad_lazy_real_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glMultiTexCoordP1uiv == NULL) {
+        glad_lazy_real_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_loader("glMultiTexCoordP1uiv");
+        if(glad_glMultiTexCoordP1uiv == glad_lazy_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = glad_lazy_real_glMultiTexCoordP1uiv;
+    }
+    glad_lazy_real_glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP2UIPROC glad_lazy_real_glMultiTexCoordP2ui = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    if(glad_lazy_real_glMultiTexCoordP2ui == NULL) {
+        glad_lazy_real_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_loader("glMultiTexCoordP2ui");
+        if(glad_glMultiTexCoordP2ui == glad_lazy_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = glad_lazy_real_glMultiTexCoordP2ui;
+    }
+    glad_lazy_real_glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP2UIVPROC glad_lazy_real_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glMultiTexCoordP2uiv == NULL) {
+        glad_lazy_real_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_loader("glMultiTexCoordP2uiv");
+        if(glad_glMultiTexCoordP2uiv == glad_lazy_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = glad_lazy_real_glMultiTexCoordP2uiv;
+    }
+    glad_lazy_real_glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP3UIPROC glad_lazy_real_glMultiTexCoordP3ui = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    if(glad_lazy_real_glMultiTexCoordP3ui == NULL) {
+        glad_lazy_real_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_loader("glMultiTexCoordP3ui");
+        if(glad_glMultiTexCoordP3ui == glad_lazy_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = glad_lazy_real_glMultiTexCoordP3ui;
+    }
+    glad_lazy_real_glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP3UIVPROC glad_lazy_real_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glMultiTexCoordP3uiv == NULL) {
+        glad_lazy_real_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_loader("glMultiTexCoordP3uiv");
+        if(glad_glMultiTexCoordP3uiv == glad_lazy_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = glad_lazy_real_glMultiTexCoordP3uiv;
+    }
+    glad_lazy_real_glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP4UIPROC glad_lazy_real_glMultiTexCoordP4ui = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    if(glad_lazy_real_glMultiTexCoordP4ui == NULL) {
+        glad_lazy_real_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_loader("glMultiTexCoordP4ui");
+        if(glad_glMultiTexCoordP4ui == glad_lazy_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = glad_lazy_real_glMultiTexCoordP4ui;
+    }
+    glad_lazy_real_glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static PFNGLMULTITEXCOORDP4UIVPROC glad_lazy_real_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glMultiTexCoordP4uiv == NULL) {
+        glad_lazy_real_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_loader("glMultiTexCoordP4uiv");
+        if(glad_glMultiTexCoordP4uiv == glad_lazy_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = glad_lazy_real_glMultiTexCoordP4uiv;
+    }
+    glad_lazy_real_glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static PFNGLNORMALP3UIPROC glad_lazy_real_glNormalP3ui = NULL;
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+    if(glad_lazy_real_glNormalP3ui == NULL) {
+        glad_lazy_real_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_loader("glNormalP3ui");
+        if(glad_glNormalP3ui == glad_lazy_glNormalP3ui) glad_glNormalP3ui = glad_lazy_real_glNormalP3ui;
+    }
+    glad_lazy_real_glNormalP3ui(type, coords);
+}
+
+static PFNGLNORMALP3UIVPROC glad_lazy_real_glNormalP3uiv = NULL;
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    if(glad_lazy_real_glNormalP3uiv == NULL) {
+        glad_lazy_real_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_loader("glNormalP3uiv");
+        if(glad_glNormalP3uiv == glad_lazy_glNormalP3uiv) glad_glNormalP3uiv = glad_lazy_real_glNormalP3uiv;
+    }
+    glad_lazy_real_glNormalP3uiv(type, coords);
+}
+
+static PFNGLCOLORP3UIPROC glad_lazy_real_glColorP3ui = NULL;
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+    if(glad_lazy_real_glColorP3ui == NULL) {
+        glad_lazy_real_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_loader("glColorP3ui");
+        if(glad_glColorP3ui == glad_lazy_glColorP3ui) glad_glColorP3ui = glad_lazy_real_glColorP3ui;
+    }
+    glad_lazy_real_glColorP3ui(type, color);
+}
+
+static PFNGLCOLORP3UIVPROC glad_lazy_real_glColorP3uiv = NULL;
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+    if(glad_lazy_real_glColorP3uiv == NULL) {
+        glad_lazy_real_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_loader("glColorP3uiv");
+        if(glad_glColorP3uiv == glad_lazy_glColorP3uiv) glad_glColorP3uiv = glad_lazy_real_glColorP3uiv;
+    }
+    glad_lazy_real_glColorP3uiv(type, color);
+}
+
+static PFNGLCOLORP4UIPROC glad_lazy_real_glColorP4ui = NULL;
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+    if(glad_lazy_real_glColorP4ui == NULL) {
+        glad_lazy_real_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_loader("glColorP4ui");
+        if(glad_glColorP4ui == glad_lazy_glColorP4ui) glad_glColorP4ui = glad_lazy_real_glColorP4ui;
+    }
+    glad_lazy_real_glColorP4ui(type, color);
+}
+
+static PFNGLCOLORP4UIVPROC glad_lazy_real_glColorP4uiv = NULL;
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+    if(glad_lazy_real_glColorP4uiv == NULL) {
+        glad_lazy_real_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_loader("glColorP4uiv");
+        if(glad_glColorP4uiv == glad_lazy_glColorP4uiv) glad_glColorP4uiv = glad_lazy_real_glColorP4uiv;
+    }
+    glad_lazy_real_glColorP4uiv(type, color);
+}
+
+static PFNGLSECONDARYCOLORP3UIPROC glad_lazy_real_glSecondaryColorP3ui = NULL;
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    if(glad_lazy_real_glSecondaryColorP3ui == NULL) {
+        glad_lazy_real_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_loader("glSecondaryColorP3ui");
+        if(glad_glSecondaryColorP3ui == glad_lazy_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = glad_lazy_real_glSecondaryColorP3ui;
+    }
+    glad_lazy_real_glSecondaryColorP3ui(type, color);
+}
+
+static PFNGLSECONDARYCOLORP3UIVPROC glad_lazy_real_glSecondaryColorP3uiv = NULL;
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    if(glad_lazy_real_glSecondaryColorP3uiv == NULL) {
+        glad_lazy_real_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_loader("glSecondaryColorP3uiv");
+        if(glad_glSecondaryColorP3uiv == glad_lazy_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = glad_lazy_real_glSecondaryColorP3uiv;
+    }
+    glad_lazy_real_glSecondaryColorP3uiv(type, color);
+}
+
+static PFNGLMINSAMPLESHADINGPROC glad_lazy_real_glMinSampleShading = NULL;
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) {
+    if(glad_lazy_real_glMinSampleShading == NULL) {
+        glad_lazy_real_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glad_lazy_loader("glMinSampleShading");
+        if(glad_glMinSampleShading == glad_lazy_glMinSampleShading) glad_glMinSampleShading = glad_lazy_real_glMinSampleShading;
+    }
+    glad_lazy_real_glMinSampleShading(value);
+}
+
+static PFNGLBLENDEQUATIONIPROC glad_lazy_real_glBlendEquationi = NULL;
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+    if(glad_lazy_real_glBlendEquationi == NULL) {
+        glad_lazy_real_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glad_lazy_loader("glBlendEquationi");
+        if(glad_glBlendEquationi == glad_lazy_glBlendEquationi) glad_glBlendEquationi = glad_lazy_real_glBlendEquationi;
+    }
+    glad_lazy_real_glBlendEquationi(buf, mode);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_lazy_real_glBlendEquationSeparatei = NULL;
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if(glad_lazy_real_glBlendEquationSeparatei == NULL) {
+        glad_lazy_real_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glad_lazy_loader("glBlendEquationSeparatei");
+        if(glad_glBlendEquationSeparatei == glad_lazy_glBlendEquationSeparatei) glad_glBlendEquationSeparatei = glad_lazy_real_glBlendEquationSeparatei;
+    }
+    glad_lazy_real_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static PFNGLBLENDFUNCIPROC glad_lazy_real_glBlendFunci = NULL;
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    if(glad_lazy_real_glBlendFunci == NULL) {
+        glad_lazy_real_glBlendFunci = (PFNGLBLENDFUNCIPROC)glad_lazy_loader("glBlendFunci");
+        if(glad_glBlendFunci == glad_lazy_glBlendFunci) glad_glBlendFunci = glad_lazy_real_glBlendFunci;
+    }
+    glad_lazy_real_glBlendFunci(buf, src, dst);
+}
+
+static PFNGLBLENDFUNCSEPARATEIPROC glad_lazy_real_glBlendFuncSeparatei = NULL;
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if(glad_lazy_real_glBlendFuncSeparatei == NULL) {
+        glad_lazy_real_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glad_lazy_loader("glBlendFuncSeparatei");
+        if(glad_glBlendFuncSeparatei == glad_lazy_glBlendFuncSeparatei) glad_glBlendFuncSeparatei = glad_lazy_real_glBlendFuncSeparatei;
+    }
+    glad_lazy_real_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static PFNGLDRAWARRAYSINDIRECTPROC glad_lazy_real_glDrawArraysIndirect = NULL;
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    if(glad_lazy_real_glDrawArraysIndirect == NULL) {
+        glad_lazy_real_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_loader("glDrawArraysIndirect");
+        if(glad_glDrawArraysIndirect == glad_lazy_glDrawArraysIndirect) glad_glDrawArraysIndirect = glad_lazy_real_glDrawArraysIndirect;
+    }
+    glad_lazy_real_glDrawArraysIndirect(mode, indirect);
+}
+
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_lazy_real_glDrawElementsIndirect = NULL;
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    if(glad_lazy_real_glDrawElementsIndirect == NULL) {
+        glad_lazy_real_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_loader("glDrawElementsIndirect");
+        if(glad_glDrawElementsIndirect == glad_lazy_glDrawElementsIndirect) glad_glDrawElementsIndirect = glad_lazy_real_glDrawElementsIndirect;
+    }
+    glad_lazy_real_glDrawElementsIndirect(mode, type, indirect);
+}
+
+static PFNGLUNIFORM1DPROC glad_lazy_real_glUniform1d = NULL;
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) {
+    if(glad_lazy_real_glUniform1d == NULL) {
+        glad_lazy_real_glUniform1d = (PFNGLUNIFORM1DPROC)glad_lazy_loader("glUniform1d");
+        if(glad_glUniform1d == glad_lazy_glUniform1d) glad_glUniform1d = glad_lazy_real_glUniform1d;
+    }
+    glad_lazy_real_glUniform1d(location, x);
+}
+
+static PFNGLUNIFORM2DPROC glad_lazy_real_glUniform2d = NULL;
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    if(glad_lazy_real_glUniform2d == NULL) {
+        glad_lazy_real_glUniform2d = (PFNGLUNIFORM2DPROC)glad_lazy_loader("glUniform2d");
+        if(glad_glUniform2d == glad_lazy_glUniform2d) glad_glUniform2d = glad_lazy_real_glUniform2d;
+    }
+    glad_lazy_real_glUniform2d(location, x, y);
+}
+
+static PFNGLUNIFORM3DPROC glad_lazy_real_glUniform3d = NULL;
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    if(glad_lazy_real_glUniform3d == NULL) {
+        glad_lazy_real_glUniform3d = (PFNGLUNIFORM3DPROC)glad_lazy_loader("glUniform3d");
+        if(glad_glUniform3d == glad_lazy_glUniform3d) glad_glUniform3d = glad_lazy_real_glUniform3d;
+    }
+    glad_lazy_real_glUniform3d(location, x, y, z);
+}
+
+static PFNGLUNIFORM4DPROC glad_lazy_real_glUniform4d = NULL;
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if(glad_lazy_real_glUniform4d == NULL) {
+        glad_lazy_real_glUniform4d = (PFNGLUNIFORM4DPROC)glad_lazy_loader("glUniform4d");
+        if(glad_glUniform4d == glad_lazy_glUniform4d) glad_glUniform4d = glad_lazy_real_glUniform4d;
+    }
+    glad_lazy_real_glUniform4d(location, x, y, z, w);
+}
+
+static PFNGLUNIFORM1DVPROC glad_lazy_real_glUniform1dv = NULL;
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glUniform1dv == NULL) {
+        glad_lazy_real_glUniform1dv = (PFNGLUNIFORM1DVPROC)glad_lazy_loader("glUniform1dv");
+        if(glad_glUniform1dv == glad_lazy_glUniform1dv) glad_glUniform1dv = glad_lazy_real_glUniform1dv;
+    }
+    glad_lazy_real_glUniform1dv(location, count, value);
+}
+
+static PFNGLUNIFORM2DVPROC glad_lazy_real_glUniform2dv = NULL;
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glUniform2dv == NULL) {
+        glad_lazy_real_glUniform2dv = (PFNGLUNIFORM2DVPROC)glad_lazy_loader("glUniform2dv");
+        if(glad_glUniform2dv == glad_lazy_glUniform2dv) glad_glUniform2dv = glad_lazy_real_glUniform2dv;
+    }
+    glad_lazy_real_glUniform2dv(location, count, value);
+}
+
+static PFNGLUNIFORM3DVPROC glad_lazy_real_glUniform3dv = NULL;
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glUniform3dv == NULL) {
+        glad_lazy_real_glUniform3dv = (PFNGLUNIFORM3DVPROC)glad_lazy_loader("glUniform3dv");
+        if(glad_glUniform3dv == glad_lazy_glUniform3dv) glad_glUniform3dv = glad_lazy_real_glUniform3dv;
+    }
+    glad_lazy_real_glUniform3dv(location, count, value);
+}
+
+static PFNGLUNIFORM4DVPROC glad_lazy_real_glUniform4dv = NULL;
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glUniform4dv == NULL) {
+        glad_lazy_real_glUniform4dv = (PFNGLUNIFORM4DVPROC)glad_lazy_loader("glUniform4dv");
+        if(glad_glUniform4dv == glad_lazy_glUniform4dv) glad_glUniform4dv = glad_lazy_real_glUniform4dv;
+    }
+    glad_lazy_real_glUniform4dv(location, count, value);
+}
+
+static PFNGLUNIFORMMATRIX2DVPROC glad_lazy_real_glUniformMatrix2dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix2dv == NULL) {
+        glad_lazy_real_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glad_lazy_loader("glUniformMatrix2dv");
+        if(glad_glUniformMatrix2dv == glad_lazy_glUniformMatrix2dv) glad_glUniformMatrix2dv = glad_lazy_real_glUniformMatrix2dv;
+    }
+    glad_lazy_real_glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3DVPROC glad_lazy_real_glUniformMatrix3dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix3dv == NULL) {
+        glad_lazy_real_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glad_lazy_loader("glUniformMatrix3dv");
+        if(glad_glUniformMatrix3dv == glad_lazy_glUniformMatrix3dv) glad_glUniformMatrix3dv = glad_lazy_real_glUniformMatrix3dv;
+    }
+    glad_lazy_real_glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4DVPROC glad_lazy_real_glUniformMatrix4dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix4dv == NULL) {
+        glad_lazy_real_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glad_lazy_loader("glUniformMatrix4dv");
+        if(glad_glUniformMatrix4dv == glad_lazy_glUniformMatrix4dv) glad_glUniformMatrix4dv = glad_lazy_real_glUniformMatrix4dv;
+    }
+    glad_lazy_real_glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_lazy_real_glUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix2x3dv == NULL) {
+        glad_lazy_real_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glad_lazy_loader("glUniformMatrix2x3dv");
+        if(glad_glUniformMatrix2x3dv == glad_lazy_glUniformMatrix2x3dv) glad_glUniformMatrix2x3dv = glad_lazy_real_glUniformMatrix2x3dv;
+    }
+    glad_lazy_real_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_lazy_real_glUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix2x4dv == NULL) {
+        glad_lazy_real_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glad_lazy_loader("glUniformMatrix2x4dv");
+        if(glad_glUniformMatrix2x4dv == glad_lazy_glUniformMatrix2x4dv) glad_glUniformMatrix2x4dv = glad_lazy_real_glUniformMatrix2x4dv;
+    }
+    glad_lazy_real_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_lazy_real_glUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix3x2dv == NULL) {
+        glad_lazy_real_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glad_lazy_loader("glUniformMatrix3x2dv");
+        if(glad_glUniformMatrix3x2dv == glad_lazy_glUniformMatrix3x2dv) glad_glUniformMatrix3x2dv = glad_lazy_real_glUniformMatrix3x2dv;
+    }
+    glad_lazy_real_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_lazy_real_glUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix3x4dv == NULL) {
+        glad_lazy_real_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glad_lazy_loader("glUniformMatrix3x4dv");
+        if(glad_glUniformMatrix3x4dv == glad_lazy_glUniformMatrix3x4dv) glad_glUniformMatrix3x4dv = glad_lazy_real_glUniformMatrix3x4dv;
+    }
+    glad_lazy_real_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_lazy_real_glUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix4x2dv == NULL) {
+        glad_lazy_real_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glad_lazy_loader("glUniformMatrix4x2dv");
+        if(glad_glUniformMatrix4x2dv == glad_lazy_glUniformMatrix4x2dv) glad_glUniformMatrix4x2dv = glad_lazy_real_glUniformMatrix4x2dv;
+    }
+    glad_lazy_real_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_lazy_real_glUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glUniformMatrix4x3dv == NULL) {
+        glad_lazy_real_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glad_lazy_loader("glUniformMatrix4x3dv");
+        if(glad_glUniformMatrix4x3dv == glad_lazy_glUniformMatrix4x3dv) glad_glUniformMatrix4x3dv = glad_lazy_real_glUniformMatrix4x3dv;
+    }
+    glad_lazy_real_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+static PFNGLGETUNIFORMDVPROC glad_lazy_real_glGetUniformdv = NULL;
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    if(glad_lazy_real_glGetUniformdv == NULL) {
+        glad_lazy_real_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glad_lazy_loader("glGetUniformdv");
+        if(glad_glGetUniformdv == glad_lazy_glGetUniformdv) glad_glGetUniformdv = glad_lazy_real_glGetUniformdv;
+    }
+    glad_lazy_real_glGetUniformdv(program, location, params);
+}
+
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_lazy_real_glGetSubroutineUniformLocation = NULL;
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    if(glad_lazy_real_glGetSubroutineUniformLocation == NULL) {
+        glad_lazy_real_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_lazy_loader("glGetSubroutineUniformLocation");
+        if(glad_glGetSubroutineUniformLocation == glad_lazy_glGetSubroutineUniformLocation) glad_glGetSubroutineUniformLocation = glad_lazy_real_glGetSubroutineUniformLocation;
+    }
+    return glad_lazy_real_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+
+static PFNGLGETSUBROUTINEINDEXPROC glad_lazy_real_glGetSubroutineIndex = NULL;
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    if(glad_lazy_real_glGetSubroutineIndex == NULL) {
+        glad_lazy_real_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glad_lazy_loader("glGetSubroutineIndex");
+        if(glad_glGetSubroutineIndex == glad_lazy_glGetSubroutineIndex) glad_glGetSubroutineIndex = glad_lazy_real_glGetSubroutineIndex;
+    }
+    return glad_lazy_real_glGetSubroutineIndex(program, shadertype, name);
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_lazy_real_glGetActiveSubroutineUniformiv = NULL;
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    if(glad_lazy_real_glGetActiveSubroutineUniformiv == NULL) {
+        glad_lazy_real_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_lazy_loader("glGetActiveSubroutineUniformiv");
+        if(glad_glGetActiveSubroutineUniformiv == glad_lazy_glGetActiveSubroutineUniformiv) glad_glGetActiveSubroutineUniformiv = glad_lazy_real_glGetActiveSubroutineUniformiv;
+    }
+    glad_lazy_real_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_lazy_real_glGetActiveSubroutineUniformName = NULL;
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    if(glad_lazy_real_glGetActiveSubroutineUniformName == NULL) {
+        glad_lazy_real_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_lazy_loader("glGetActiveSubroutineUniformName");
+        if(glad_glGetActiveSubroutineUniformName == glad_lazy_glGetActiveSubroutineUniformName) glad_glGetActiveSubroutineUniformName = glad_lazy_real_glGetActiveSubroutineUniformName;
+    }
+    glad_lazy_real_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_lazy_real_glGetActiveSubroutineName = NULL;
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    if(glad_lazy_real_glGetActiveSubroutineName == NULL) {
+        glad_lazy_real_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glad_lazy_loader("glGetActiveSubroutineName");
+        if(glad_glGetActiveSubroutineName == glad_lazy_glGetActiveSubroutineName) glad_glGetActiveSubroutineName = glad_lazy_real_glGetActiveSubroutineName;
+    }
+    glad_lazy_real_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_lazy_real_glUniformSubroutinesuiv = NULL;
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    if(glad_lazy_real_glUniformSubroutinesuiv == NULL) {
+        glad_lazy_real_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glad_lazy_loader("glUniformSubroutinesuiv");
+        if(glad_glUniformSubroutinesuiv == glad_lazy_glUniformSubroutinesuiv) glad_glUniformSubroutinesuiv = glad_lazy_real_glUniformSubroutinesuiv;
+    }
+    glad_lazy_real_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_lazy_real_glGetUniformSubroutineuiv = NULL;
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    if(glad_lazy_real_glGetUniformSubroutineuiv == NULL) {
+        glad_lazy_real_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_lazy_loader("glGetUniformSubroutineuiv");
+        if(glad_glGetUniformSubroutineuiv == glad_lazy_glGetUniformSubroutineuiv) glad_glGetUniformSubroutineuiv = glad_lazy_real_glGetUniformSubroutineuiv;
+    }
+    glad_lazy_real_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+
+static PFNGLGETPROGRAMSTAGEIVPROC glad_lazy_real_glGetProgramStageiv = NULL;
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    if(glad_lazy_real_glGetProgramStageiv == NULL) {
+        glad_lazy_real_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glad_lazy_loader("glGetProgramStageiv");
+        if(glad_glGetProgramStageiv == glad_lazy_glGetProgramStageiv) glad_glGetProgramStageiv = glad_lazy_real_glGetProgramStageiv;
+    }
+    glad_lazy_real_glGetProgramStageiv(program, shadertype, pname, values);
+}
+
+static PFNGLPATCHPARAMETERIPROC glad_lazy_real_glPatchParameteri = NULL;
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) {
+    if(glad_lazy_real_glPatchParameteri == NULL) {
+        glad_lazy_real_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glad_lazy_loader("glPatchParameteri");
+        if(glad_glPatchParameteri == glad_lazy_glPatchParameteri) glad_glPatchParameteri = glad_lazy_real_glPatchParameteri;
+    }
+    glad_lazy_real_glPatchParameteri(pname, value);
+}
+
+static PFNGLPATCHPARAMETERFVPROC glad_lazy_real_glPatchParameterfv = NULL;
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    if(glad_lazy_real_glPatchParameterfv == NULL) {
+        glad_lazy_real_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glad_lazy_loader("glPatchParameterfv");
+        if(glad_glPatchParameterfv == glad_lazy_glPatchParameterfv) glad_glPatchParameterfv = glad_lazy_real_glPatchParameterfv;
+    }
+    glad_lazy_real_glPatchParameterfv(pname, values);
+}
+
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_lazy_real_glBindTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+    if(glad_lazy_real_glBindTransformFeedback == NULL) {
+        glad_lazy_real_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glad_lazy_loader("glBindTransformFeedback");
+        if(glad_glBindTransformFeedback == glad_lazy_glBindTransformFeedback) glad_glBindTransformFeedback = glad_lazy_real_glBindTransformFeedback;
+    }
+    glad_lazy_real_glBindTransformFeedback(target, id);
+}
+
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_lazy_real_glDeleteTransformFeedbacks = NULL;
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    if(glad_lazy_real_glDeleteTransformFeedbacks == NULL) {
+        glad_lazy_real_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_lazy_loader("glDeleteTransformFeedbacks");
+        if(glad_glDeleteTransformFeedbacks == glad_lazy_glDeleteTransformFeedbacks) glad_glDeleteTransformFeedbacks = glad_lazy_real_glDeleteTransformFeedbacks;
+    }
+    glad_lazy_real_glDeleteTransformFeedbacks(n, ids);
+}
+
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_lazy_real_glGenTransformFeedbacks = NULL;
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    if(glad_lazy_real_glGenTransformFeedbacks == NULL) {
+        glad_lazy_real_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glad_lazy_loader("glGenTransformFeedbacks");
+        if(glad_glGenTransformFeedbacks == glad_lazy_glGenTransformFeedbacks) glad_glGenTransformFeedbacks = glad_lazy_real_glGenTransformFeedbacks;
+    }
+    glad_lazy_real_glGenTransformFeedbacks(n, ids);
+}
+
+static PFNGLISTRANSFORMFEEDBACKPROC glad_lazy_real_glIsTransformFeedback = NULL;
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) {
+    if(glad_lazy_real_glIsTransformFeedback == NULL) {
+        glad_lazy_real_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glad_lazy_loader("glIsTransformFeedback");
+        if(glad_glIsTransformFeedback == glad_lazy_glIsTransformFeedback) glad_glIsTransformFeedback = glad_lazy_real_glIsTransformFeedback;
+    }
+    return glad_lazy_real_glIsTransformFeedback(id);
+}
+
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_lazy_real_glPauseTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+    if(glad_lazy_real_glPauseTransformFeedback == NULL) {
+        glad_lazy_real_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_lazy_loader("glPauseTransformFeedback");
+        if(glad_glPauseTransformFeedback == glad_lazy_glPauseTransformFeedback) glad_glPauseTransformFeedback = glad_lazy_real_glPauseTransformFeedback;
+    }
+    glad_lazy_real_glPauseTransformFeedback();
+}
+
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_lazy_real_glResumeTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+    if(glad_lazy_real_glResumeTransformFeedback == NULL) {
+        glad_lazy_real_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_lazy_loader("glResumeTransformFeedback");
+        if(glad_glResumeTransformFeedback == glad_lazy_glResumeTransformFeedback) glad_glResumeTransformFeedback = glad_lazy_real_glResumeTransformFeedback;
+    }
+    glad_lazy_real_glResumeTransformFeedback();
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_lazy_real_glDrawTransformFeedback = NULL;
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    if(glad_lazy_real_glDrawTransformFeedback == NULL) {
+        glad_lazy_real_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_lazy_loader("glDrawTransformFeedback");
+        if(glad_glDrawTransformFeedback == glad_lazy_glDrawTransformFeedback) glad_glDrawTransformFeedback = glad_lazy_real_glDrawTransformFeedback;
+    }
+    glad_lazy_real_glDrawTransformFeedback(mode, id);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_lazy_real_glDrawTransformFeedbackStream = NULL;
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    if(glad_lazy_real_glDrawTransformFeedbackStream == NULL) {
+        glad_lazy_real_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_lazy_loader("glDrawTransformFeedbackStream");
+        if(glad_glDrawTransformFeedbackStream == glad_lazy_glDrawTransformFeedbackStream) glad_glDrawTransformFeedbackStream = glad_lazy_real_glDrawTransformFeedbackStream;
+    }
+    glad_lazy_real_glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static PFNGLBEGINQUERYINDEXEDPROC glad_lazy_real_glBeginQueryIndexed = NULL;
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    if(glad_lazy_real_glBeginQueryIndexed == NULL) {
+        glad_lazy_real_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glad_lazy_loader("glBeginQueryIndexed");
+        if(glad_glBeginQueryIndexed == glad_lazy_glBeginQueryIndexed) glad_glBeginQueryIndexed = glad_lazy_real_glBeginQueryIndexed;
+    }
+    glad_lazy_real_glBeginQueryIndexed(target, index, id);
+}
+
+static PFNGLENDQUERYINDEXEDPROC glad_lazy_real_glEndQueryIndexed = NULL;
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+    if(glad_lazy_real_glEndQueryIndexed == NULL) {
+        glad_lazy_real_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glad_lazy_loader("glEndQueryIndexed");
+        if(glad_glEndQueryIndexed == glad_lazy_glEndQueryIndexed) glad_glEndQueryIndexed = glad_lazy_real_glEndQueryIndexed;
+    }
+    glad_lazy_real_glEndQueryIndexed(target, index);
+}
+
+static PFNGLGETQUERYINDEXEDIVPROC glad_lazy_real_glGetQueryIndexediv = NULL;
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetQueryIndexediv == NULL) {
+        glad_lazy_real_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glad_lazy_loader("glGetQueryIndexediv");
+        if(glad_glGetQueryIndexediv == glad_lazy_glGetQueryIndexediv) glad_glGetQueryIndexediv = glad_lazy_real_glGetQueryIndexediv;
+    }
+    glad_lazy_real_glGetQueryIndexediv(target, index, pname, params);
+}
+
+static PFNGLRELEASESHADERCOMPILERPROC glad_lazy_real_glReleaseShaderCompiler = NULL;
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+    if(glad_lazy_real_glReleaseShaderCompiler == NULL) {
+        glad_lazy_real_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glad_lazy_loader("glReleaseShaderCompiler");
+        if(glad_glReleaseShaderCompiler == glad_lazy_glReleaseShaderCompiler) glad_glReleaseShaderCompiler = glad_lazy_real_glReleaseShaderCompiler;
+    }
+    glad_lazy_real_glReleaseShaderCompiler();
+}
+
+static PFNGLSHADERBINARYPROC glad_lazy_real_glShaderBinary = NULL;
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if(glad_lazy_real_glShaderBinary == NULL) {
+        glad_lazy_real_glShaderBinary = (PFNGLSHADERBINARYPROC)glad_lazy_loader("glShaderBinary");
+        if(glad_glShaderBinary == glad_lazy_glShaderBinary) glad_glShaderBinary = glad_lazy_real_glShaderBinary;
+    }
+    glad_lazy_real_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_lazy_real_glGetShaderPrecisionFormat = NULL;
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    if(glad_lazy_real_glGetShaderPrecisionFormat == NULL) {
+        glad_lazy_real_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glad_lazy_loader("glGetShaderPrecisionFormat");
+        if(glad_glGetShaderPrecisionFormat == glad_lazy_glGetShaderPrecisionFormat) glad_glGetShaderPrecisionFormat = glad_lazy_real_glGetShaderPrecisionFormat;
+    }
+    glad_lazy_real_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+static PFNGLDEPTHRANGEFPROC glad_lazy_real_glDepthRangef = NULL;
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) {
+    if(glad_lazy_real_glDepthRangef == NULL) {
+        glad_lazy_real_glDepthRangef = (PFNGLDEPTHRANGEFPROC)glad_lazy_loader("glDepthRangef");
+        if(glad_glDepthRangef == glad_lazy_glDepthRangef) glad_glDepthRangef = glad_lazy_real_glDepthRangef;
+    }
+    glad_lazy_real_glDepthRangef(n, f);
+}
+
+static PFNGLCLEARDEPTHFPROC glad_lazy_real_glClearDepthf = NULL;
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) {
+    if(glad_lazy_real_glClearDepthf == NULL) {
+        glad_lazy_real_glClearDepthf = (PFNGLCLEARDEPTHFPROC)glad_lazy_loader("glClearDepthf");
+        if(glad_glClearDepthf == glad_lazy_glClearDepthf) glad_glClearDepthf = glad_lazy_real_glClearDepthf;
+    }
+    glad_lazy_real_glClearDepthf(d);
+}
+
+static PFNGLGETPROGRAMBINARYPROC glad_lazy_real_glGetProgramBinary = NULL;
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    if(glad_lazy_real_glGetProgramBinary == NULL) {
+        glad_lazy_real_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_loader("glGetProgramBinary");
+        if(glad_glGetProgramBinary == glad_lazy_glGetProgramBinary) glad_glGetProgramBinary = glad_lazy_real_glGetProgramBinary;
+    }
+    glad_lazy_real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+static PFNGLPROGRAMBINARYPROC glad_lazy_real_glProgramBinary = NULL;
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if(glad_lazy_real_glProgramBinary == NULL) {
+        glad_lazy_real_glProgramBinary = (PFNGLPROGRAMBINARYPROC)glad_lazy_loader("glProgramBinary");
+        if(glad_glProgramBinary == glad_lazy_glProgramBinary) glad_glProgramBinary = glad_lazy_real_glProgramBinary;
+    }
+    glad_lazy_real_glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static PFNGLPROGRAMPARAMETERIPROC glad_lazy_real_glProgramParameteri = NULL;
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    if(glad_lazy_real_glProgramParameteri == NULL) {
+        glad_lazy_real_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_loader("glProgramParameteri");
+        if(glad_glProgramParameteri == glad_lazy_glProgramParameteri) glad_glProgramParameteri = glad_lazy_real_glProgramParameteri;
+    }
+    glad_lazy_real_glProgramParameteri(program, pname, value);
+}
+
+static PFNGLUSEPROGRAMSTAGESPROC glad_lazy_real_glUseProgramStages = NULL;
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    if(glad_lazy_real_glUseProgramStages == NULL) {
+        glad_lazy_real_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glad_lazy_loader("glUseProgramStages");
+        if(glad_glUseProgramStages == glad_lazy_glUseProgramStages) glad_glUseProgramStages = glad_lazy_real_glUseProgramStages;
+    }
+    glad_lazy_real_glUseProgramStages(pipeline, stages, program);
+}
+
+static PFNGLACTIVESHADERPROGRAMPROC glad_lazy_real_glActiveShaderProgram = NULL;
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    if(glad_lazy_real_glActiveShaderProgram == NULL) {
+        glad_lazy_real_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glad_lazy_loader("glActiveShaderProgram");
+        if(glad_glActiveShaderProgram == glad_lazy_glActiveShaderProgram) glad_glActiveShaderProgram = glad_lazy_real_glActiveShaderProgram;
+    }
+    glad_lazy_real_glActiveShaderProgram(pipeline, program);
+}
+
+static PFNGLCREATESHADERPROGRAMVPROC glad_lazy_real_glCreateShaderProgramv = NULL;
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    if(glad_lazy_real_glCreateShaderProgramv == NULL) {
+        glad_lazy_real_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glad_lazy_loader("glCreateShaderProgramv");
+        if(glad_glCreateShaderProgramv == glad_lazy_glCreateShaderProgramv) glad_glCreateShaderProgramv = glad_lazy_real_glCreateShaderProgramv;
+    }
+    return glad_lazy_real_glCreateShaderProgramv(type, count, strings);
+}
+
+static PFNGLBINDPROGRAMPIPELINEPROC glad_lazy_real_glBindProgramPipeline = NULL;
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) {
+    if(glad_lazy_real_glBindProgramPipeline == NULL) {
+        glad_lazy_real_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glad_lazy_loader("glBindProgramPipeline");
+        if(glad_glBindProgramPipeline == glad_lazy_glBindProgramPipeline) glad_glBindProgramPipeline = glad_lazy_real_glBindProgramPipeline;
+    }
+    glad_lazy_real_glBindProgramPipeline(pipeline);
+}
+
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_lazy_real_glDeleteProgramPipelines = NULL;
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    if(glad_lazy_real_glDeleteProgramPipelines == NULL) {
+        glad_lazy_real_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glad_lazy_loader("glDeleteProgramPipelines");
+        if(glad_glDeleteProgramPipelines == glad_lazy_glDeleteProgramPipelines) glad_glDeleteProgramPipelines = glad_lazy_real_glDeleteProgramPipelines;
+    }
+    glad_lazy_real_glDeleteProgramPipelines(n, pipelines);
+}
+
+static PFNGLGENPROGRAMPIPELINESPROC glad_lazy_real_glGenProgramPipelines = NULL;
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    if(glad_lazy_real_glGenProgramPipelines == NULL) {
+        glad_lazy_real_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glad_lazy_loader("glGenProgramPipelines");
+        if(glad_glGenProgramPipelines == glad_lazy_glGenProgramPipelines) glad_glGenProgramPipelines = glad_lazy_real_glGenProgramPipelines;
+    }
+    glad_lazy_real_glGenProgramPipelines(n, pipelines);
+}
+
+static PFNGLISPROGRAMPIPELINEPROC glad_lazy_real_glIsProgramPipeline = NULL;
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) {
+    if(glad_lazy_real_glIsProgramPipeline == NULL) {
+        glad_lazy_real_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glad_lazy_loader("glIsProgramPipeline");
+        if(glad_glIsProgramPipeline == glad_lazy_glIsProgramPipeline) glad_glIsProgramPipeline = glad_lazy_real_glIsProgramPipeline;
+    }
+    return glad_lazy_real_glIsProgramPipeline(pipeline);
+}
+
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_lazy_real_glGetProgramPipelineiv = NULL;
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetProgramPipelineiv == NULL) {
+        glad_lazy_real_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glad_lazy_loader("glGetProgramPipelineiv");
+        if(glad_glGetProgramPipelineiv == glad_lazy_glGetProgramPipelineiv) glad_glGetProgramPipelineiv = glad_lazy_real_glGetProgramPipelineiv;
+    }
+    glad_lazy_real_glGetProgramPipelineiv(pipeline, pname, params);
+}
+
+static PFNGLPROGRAMUNIFORM1IPROC glad_lazy_real_glProgramUniform1i = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    if(glad_lazy_real_glProgramUniform1i == NULL) {
+        glad_lazy_real_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glad_lazy_loader("glProgramUniform1i");
+        if(glad_glProgramUniform1i == glad_lazy_glProgramUniform1i) glad_glProgramUniform1i = glad_lazy_real_glProgramUniform1i;
+    }
+    glad_lazy_real_glProgramUniform1i(program, location, v0);
+}
+
+static PFNGLPROGRAMUNIFORM1IVPROC glad_lazy_real_glProgramUniform1iv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glProgramUniform1iv == NULL) {
+        glad_lazy_real_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glad_lazy_loader("glProgramUniform1iv");
+        if(glad_glProgramUniform1iv == glad_lazy_glProgramUniform1iv) glad_glProgramUniform1iv = glad_lazy_real_glProgramUniform1iv;
+    }
+    glad_lazy_real_glProgramUniform1iv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM1FPROC glad_lazy_real_glProgramUniform1f = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    if(glad_lazy_real_glProgramUniform1f == NULL) {
+        glad_lazy_real_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glad_lazy_loader("glProgramUniform1f");
+        if(glad_glProgramUniform1f == glad_lazy_glProgramUniform1f) glad_glProgramUniform1f = glad_lazy_real_glProgramUniform1f;
+    }
+    glad_lazy_real_glProgramUniform1f(program, location, v0);
+}
+
+static PFNGLPROGRAMUNIFORM1FVPROC glad_lazy_real_glProgramUniform1fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniform1fv == NULL) {
+        glad_lazy_real_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glad_lazy_loader("glProgramUniform1fv");
+        if(glad_glProgramUniform1fv == glad_lazy_glProgramUniform1fv) glad_glProgramUniform1fv = glad_lazy_real_glProgramUniform1fv;
+    }
+    glad_lazy_real_glProgramUniform1fv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM1DPROC glad_lazy_real_glProgramUniform1d = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    if(glad_lazy_real_glProgramUniform1d == NULL) {
+        glad_lazy_real_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glad_lazy_loader("glProgramUniform1d");
+        if(glad_glProgramUniform1d == glad_lazy_glProgramUniform1d) glad_glProgramUniform1d = glad_lazy_real_glProgramUniform1d;
+    }
+    glad_lazy_real_glProgramUniform1d(program, location, v0);
+}
+
+static PFNGLPROGRAMUNIFORM1DVPROC glad_lazy_real_glProgramUniform1dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniform1dv == NULL) {
+        glad_lazy_real_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glad_lazy_loader("glProgramUniform1dv");
+        if(glad_glProgramUniform1dv == glad_lazy_glProgramUniform1dv) glad_glProgramUniform1dv = glad_lazy_real_glProgramUniform1dv;
+    }
+    glad_lazy_real_glProgramUniform1dv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM1UIPROC glad_lazy_real_glProgramUniform1ui = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    if(glad_lazy_real_glProgramUniform1ui == NULL) {
+        glad_lazy_real_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glad_lazy_loader("glProgramUniform1ui");
+        if(glad_glProgramUniform1ui == glad_lazy_glProgramUniform1ui) glad_glProgramUniform1ui = glad_lazy_real_glProgramUniform1ui;
+    }
+    glad_lazy_real_glProgramUniform1ui(program, location, v0);
+}
+
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_lazy_real_glProgramUniform1uiv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glProgramUniform1uiv == NULL) {
+        glad_lazy_real_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glad_lazy_loader("glProgramUniform1uiv");
+        if(glad_glProgramUniform1uiv == glad_lazy_glProgramUniform1uiv) glad_glProgramUniform1uiv = glad_lazy_real_glProgramUniform1uiv;
+    }
+    glad_lazy_real_glProgramUniform1uiv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM2IPROC glad_lazy_real_glProgramUniform2i = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    if(glad_lazy_real_glProgramUniform2i == NULL) {
+        glad_lazy_real_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glad_lazy_loader("glProgramUniform2i");
+        if(glad_glProgramUniform2i == glad_lazy_glProgramUniform2i) glad_glProgramUniform2i = glad_lazy_real_glProgramUniform2i;
+    }
+    glad_lazy_real_glProgramUniform2i(program, location, v0, v1);
+}
+
+static PFNGLPROGRAMUNIFORM2IVPROC glad_lazy_real_glProgramUniform2iv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glProgramUniform2iv == NULL) {
+        glad_lazy_real_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glad_lazy_loader("glProgramUniform2iv");
+        if(glad_glProgramUniform2iv == glad_lazy_glProgramUniform2iv) glad_glProgramUniform2iv = glad_lazy_real_glProgramUniform2iv;
+    }
+    glad_lazy_real_glProgramUniform2iv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM2FPROC glad_lazy_real_glProgramUniform2f = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    if(glad_lazy_real_glProgramUniform2f == NULL) {
+        glad_lazy_real_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glad_lazy_loader("glProgramUniform2f");
+        if(glad_glProgramUniform2f == glad_lazy_glProgramUniform2f) glad_glProgramUniform2f = glad_lazy_real_glProgramUniform2f;
+    }
+    glad_lazy_real_glProgramUniform2f(program, location, v0, v1);
+}
+
+static PFNGLPROGRAMUNIFORM2FVPROC glad_lazy_real_glProgramUniform2fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniform2fv == NULL) {
+        glad_lazy_real_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glad_lazy_loader("glProgramUniform2fv");
+        if(glad_glProgramUniform2fv == glad_lazy_glProgramUniform2fv) glad_glProgramUniform2fv = glad_lazy_real_glProgramUniform2fv;
+    }
+    glad_lazy_real_glProgramUniform2fv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM2DPROC glad_lazy_real_glProgramUniform2d = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    if(glad_lazy_real_glProgramUniform2d == NULL) {
+        glad_lazy_real_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glad_lazy_loader("glProgramUniform2d");
+        if(glad_glProgramUniform2d == glad_lazy_glProgramUniform2d) glad_glProgramUniform2d = glad_lazy_real_glProgramUniform2d;
+    }
+    glad_lazy_real_glProgramUniform2d(program, location, v0, v1);
+}
+
+static PFNGLPROGRAMUNIFORM2DVPROC glad_lazy_real_glProgramUniform2dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniform2dv == NULL) {
+        glad_lazy_real_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glad_lazy_loader("glProgramUniform2dv");
+        if(glad_glProgramUniform2dv == glad_lazy_glProgramUniform2dv) glad_glProgramUniform2dv = glad_lazy_real_glProgramUniform2dv;
+    }
+    glad_lazy_real_glProgramUniform2dv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM2UIPROC glad_lazy_real_glProgramUniform2ui = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    if(glad_lazy_real_glProgramUniform2ui == NULL) {
+        glad_lazy_real_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glad_lazy_loader("glProgramUniform2ui");
+        if(glad_glProgramUniform2ui == glad_lazy_glProgramUniform2ui) glad_glProgramUniform2ui = glad_lazy_real_glProgramUniform2ui;
+    }
+    glad_lazy_real_glProgramUniform2ui(program, location, v0, v1);
+}
+
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_lazy_real_glProgramUniform2uiv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glProgramUniform2uiv == NULL) {
+        glad_lazy_real_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glad_lazy_loader("glProgramUniform2uiv");
+        if(glad_glProgramUniform2uiv == glad_lazy_glProgramUniform2uiv) glad_glProgramUniform2uiv = glad_lazy_real_glProgramUniform2uiv;
+    }
+    glad_lazy_real_glProgramUniform2uiv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM3IPROC glad_lazy_real_glProgramUniform3i = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    if(glad_lazy_real_glProgramUniform3i == NULL) {
+        glad_lazy_real_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glad_lazy_loader("glProgramUniform3i");
+        if(glad_glProgramUniform3i == glad_lazy_glProgramUniform3i) glad_glProgramUniform3i = glad_lazy_real_glProgramUniform3i;
+    }
+    glad_lazy_real_glProgramUniform3i(program, location, v0, v1, v2);
+}
+
+static PFNGLPROGRAMUNIFORM3IVPROC glad_lazy_real_glProgramUniform3iv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glProgramUniform3iv == NULL) {
+        glad_lazy_real_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glad_lazy_loader("glProgramUniform3iv");
+        if(glad_glProgramUniform3iv == glad_lazy_glProgramUniform3iv) glad_glProgramUniform3iv = glad_lazy_real_glProgramUniform3iv;
+    }
+    glad_lazy_real_glProgramUniform3iv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM3FPROC glad_lazy_real_glProgramUniform3f = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if(glad_lazy_real_glProgramUniform3f == NULL) {
+        glad_lazy_real_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glad_lazy_loader("glProgramUniform3f");
+        if(glad_glProgramUniform3f == glad_lazy_glProgramUniform3f) glad_glProgramUniform3f = glad_lazy_real_glProgramUniform3f;
+    }
+    glad_lazy_real_glProgramUniform3f(program, location, v0, v1, v2);
+}
+
+static PFNGLPROGRAMUNIFORM3FVPROC glad_lazy_real_glProgramUniform3fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniform3fv == NULL) {
+        glad_lazy_real_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glad_lazy_loader("glProgramUniform3fv");
+        if(glad_glProgramUniform3fv == glad_lazy_glProgramUniform3fv) glad_glProgramUniform3fv = glad_lazy_real_glProgramUniform3fv;
+    }
+    glad_lazy_real_glProgramUniform3fv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM3DPROC glad_lazy_real_glProgramUniform3d = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    if(glad_lazy_real_glProgramUniform3d == NULL) {
+        glad_lazy_real_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glad_lazy_loader("glProgramUniform3d");
+        if(glad_glProgramUniform3d == glad_lazy_glProgramUniform3d) glad_glProgramUniform3d = glad_lazy_real_glProgramUniform3d;
+    }
+    glad_lazy_real_glProgramUniform3d(program, location, v0, v1, v2);
+}
+
+static PFNGLPROGRAMUNIFORM3DVPROC glad_lazy_real_glProgramUniform3dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniform3dv == NULL) {
+        glad_lazy_real_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glad_lazy_loader("glProgramUniform3dv");
+        if(glad_glProgramUniform3dv == glad_lazy_glProgramUniform3dv) glad_glProgramUniform3dv = glad_lazy_real_glProgramUniform3dv;
+    }
+    glad_lazy_real_glProgramUniform3dv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM3UIPROC glad_lazy_real_glProgramUniform3ui = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if(glad_lazy_real_glProgramUniform3ui == NULL) {
+        glad_lazy_real_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glad_lazy_loader("glProgramUniform3ui");
+        if(glad_glProgramUniform3ui == glad_lazy_glProgramUniform3ui) glad_glProgramUniform3ui = glad_lazy_real_glProgramUniform3ui;
+    }
+    glad_lazy_real_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_lazy_real_glProgramUniform3uiv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glProgramUniform3uiv == NULL) {
+        glad_lazy_real_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glad_lazy_loader("glProgramUniform3uiv");
+        if(glad_glProgramUniform3uiv == glad_lazy_glProgramUniform3uiv) glad_glProgramUniform3uiv = glad_lazy_real_glProgramUniform3uiv;
+    }
+    glad_lazy_real_glProgramUniform3uiv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM4IPROC glad_lazy_real_glProgramUniform4i = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if(glad_lazy_real_glProgramUniform4i == NULL) {
+        glad_lazy_real_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glad_lazy_loader("glProgramUniform4i");
+        if(glad_glProgramUniform4i == glad_lazy_glProgramUniform4i) glad_glProgramUniform4i = glad_lazy_real_glProgramUniform4i;
+    }
+    glad_lazy_real_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+
+static PFNGLPROGRAMUNIFORM4IVPROC glad_lazy_real_glProgramUniform4iv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if(glad_lazy_real_glProgramUniform4iv == NULL) {
+        glad_lazy_real_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glad_lazy_loader("glProgramUniform4iv");
+        if(glad_glProgramUniform4iv == glad_lazy_glProgramUniform4iv) glad_glProgramUniform4iv = glad_lazy_real_glProgramUniform4iv;
+    }
+    glad_lazy_real_glProgramUniform4iv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM4FPROC glad_lazy_real_glProgramUniform4f = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if(glad_lazy_real_glProgramUniform4f == NULL) {
+        glad_lazy_real_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glad_lazy_loader("glProgramUniform4f");
+        if(glad_glProgramUniform4f == glad_lazy_glProgramUniform4f) glad_glProgramUniform4f = glad_lazy_real_glProgramUniform4f;
+    }
+    glad_lazy_real_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+
+static PFNGLPROGRAMUNIFORM4FVPROC glad_lazy_real_glProgramUniform4fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniform4fv == NULL) {
+        glad_lazy_real_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glad_lazy_loader("glProgramUniform4fv");
+        if(glad_glProgramUniform4fv == glad_lazy_glProgramUniform4fv) glad_glProgramUniform4fv = glad_lazy_real_glProgramUniform4fv;
+    }
+    glad_lazy_real_glProgramUniform4fv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM4DPROC glad_lazy_real_glProgramUniform4d = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    if(glad_lazy_real_glProgramUniform4d == NULL) {
+        glad_lazy_real_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glad_lazy_loader("glProgramUniform4d");
+        if(glad_glProgramUniform4d == glad_lazy_glProgramUniform4d) glad_glProgramUniform4d = glad_lazy_real_glProgramUniform4d;
+    }
+    glad_lazy_real_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+
+static PFNGLPROGRAMUNIFORM4DVPROC glad_lazy_real_glProgramUniform4dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniform4dv == NULL) {
+        glad_lazy_real_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glad_lazy_loader("glProgramUniform4dv");
+        if(glad_glProgramUniform4dv == glad_lazy_glProgramUniform4dv) glad_glProgramUniform4dv = glad_lazy_real_glProgramUniform4dv;
+    }
+    glad_lazy_real_glProgramUniform4dv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORM4UIPROC glad_lazy_real_glProgramUniform4ui = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if(glad_lazy_real_glProgramUniform4ui == NULL) {
+        glad_lazy_real_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glad_lazy_loader("glProgramUniform4ui");
+        if(glad_glProgramUniform4ui == glad_lazy_glProgramUniform4ui) glad_glProgramUniform4ui = glad_lazy_real_glProgramUniform4ui;
+    }
+    glad_lazy_real_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_lazy_real_glProgramUniform4uiv = NULL;
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if(glad_lazy_real_glProgramUniform4uiv == NULL) {
+        glad_lazy_real_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glad_lazy_loader("glProgramUniform4uiv");
+        if(glad_glProgramUniform4uiv == glad_lazy_glProgramUniform4uiv) glad_glProgramUniform4uiv = glad_lazy_real_glProgramUniform4uiv;
+    }
+    glad_lazy_real_glProgramUniform4uiv(program, location, count, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_lazy_real_glProgramUniformMatrix2fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_lazy_loader("glProgramUniformMatrix2fv");
+        if(glad_glProgramUniformMatrix2fv == glad_lazy_glProgramUniformMatrix2fv) glad_glProgramUniformMatrix2fv = glad_lazy_real_glProgramUniformMatrix2fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_lazy_real_glProgramUniformMatrix3fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_lazy_loader("glProgramUniformMatrix3fv");
+        if(glad_glProgramUniformMatrix3fv == glad_lazy_glProgramUniformMatrix3fv) glad_glProgramUniformMatrix3fv = glad_lazy_real_glProgramUniformMatrix3fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_lazy_real_glProgramUniformMatrix4fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_lazy_loader("glProgramUniformMatrix4fv");
+        if(glad_glProgramUniformMatrix4fv == glad_lazy_glProgramUniformMatrix4fv) glad_glProgramUniformMatrix4fv = glad_lazy_real_glProgramUniformMatrix4fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_lazy_real_glProgramUniformMatrix2dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_lazy_loader("glProgramUniformMatrix2dv");
+        if(glad_glProgramUniformMatrix2dv == glad_lazy_glProgramUniformMatrix2dv) glad_glProgramUniformMatrix2dv = glad_lazy_real_glProgramUniformMatrix2dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_lazy_real_glProgramUniformMatrix3dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_lazy_loader("glProgramUniformMatrix3dv");
+        if(glad_glProgramUniformMatrix3dv == glad_lazy_glProgramUniformMatrix3dv) glad_glProgramUniformMatrix3dv = glad_lazy_real_glProgramUniformMatrix3dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_lazy_real_glProgramUniformMatrix4dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_lazy_loader("glProgramUniformMatrix4dv");
+        if(glad_glProgramUniformMatrix4dv == glad_lazy_glProgramUniformMatrix4dv) glad_glProgramUniformMatrix4dv = glad_lazy_real_glProgramUniformMatrix4dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_lazy_real_glProgramUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2x3fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_lazy_loader("glProgramUniformMatrix2x3fv");
+        if(glad_glProgramUniformMatrix2x3fv == glad_lazy_glProgramUniformMatrix2x3fv) glad_glProgramUniformMatrix2x3fv = glad_lazy_real_glProgramUniformMatrix2x3fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_lazy_real_glProgramUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3x2fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_lazy_loader("glProgramUniformMatrix3x2fv");
+        if(glad_glProgramUniformMatrix3x2fv == glad_lazy_glProgramUniformMatrix3x2fv) glad_glProgramUniformMatrix3x2fv = glad_lazy_real_glProgramUniformMatrix3x2fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_lazy_real_glProgramUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2x4fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_lazy_loader("glProgramUniformMatrix2x4fv");
+        if(glad_glProgramUniformMatrix2x4fv == glad_lazy_glProgramUniformMatrix2x4fv) glad_glProgramUniformMatrix2x4fv = glad_lazy_real_glProgramUniformMatrix2x4fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_lazy_real_glProgramUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4x2fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_lazy_loader("glProgramUniformMatrix4x2fv");
+        if(glad_glProgramUniformMatrix4x2fv == glad_lazy_glProgramUniformMatrix4x2fv) glad_glProgramUniformMatrix4x2fv = glad_lazy_real_glProgramUniformMatrix4x2fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_lazy_real_glProgramUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3x4fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_lazy_loader("glProgramUniformMatrix3x4fv");
+        if(glad_glProgramUniformMatrix3x4fv == glad_lazy_glProgramUniformMatrix3x4fv) glad_glProgramUniformMatrix3x4fv = glad_lazy_real_glProgramUniformMatrix3x4fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_lazy_real_glProgramUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4x3fv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_lazy_loader("glProgramUniformMatrix4x3fv");
+        if(glad_glProgramUniformMatrix4x3fv == glad_lazy_glProgramUniformMatrix4x3fv) glad_glProgramUniformMatrix4x3fv = glad_lazy_real_glProgramUniformMatrix4x3fv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_lazy_real_glProgramUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2x3dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_lazy_loader("glProgramUniformMatrix2x3dv");
+        if(glad_glProgramUniformMatrix2x3dv == glad_lazy_glProgramUniformMatrix2x3dv) glad_glProgramUniformMatrix2x3dv = glad_lazy_real_glProgramUniformMatrix2x3dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_lazy_real_glProgramUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3x2dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_lazy_loader("glProgramUniformMatrix3x2dv");
+        if(glad_glProgramUniformMatrix3x2dv == glad_lazy_glProgramUniformMatrix3x2dv) glad_glProgramUniformMatrix3x2dv = glad_lazy_real_glProgramUniformMatrix3x2dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_lazy_real_glProgramUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix2x4dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_lazy_loader("glProgramUniformMatrix2x4dv");
+        if(glad_glProgramUniformMatrix2x4dv == glad_lazy_glProgramUniformMatrix2x4dv) glad_glProgramUniformMatrix2x4dv = glad_lazy_real_glProgramUniformMatrix2x4dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_lazy_real_glProgramUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4x2dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_lazy_loader("glProgramUniformMatrix4x2dv");
+        if(glad_glProgramUniformMatrix4x2dv == glad_lazy_glProgramUniformMatrix4x2dv) glad_glProgramUniformMatrix4x2dv = glad_lazy_real_glProgramUniformMatrix4x2dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_lazy_real_glProgramUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix3x4dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_lazy_loader("glProgramUniformMatrix3x4dv");
+        if(glad_glProgramUniformMatrix3x4dv == glad_lazy_glProgramUniformMatrix3x4dv) glad_glProgramUniformMatrix3x4dv = glad_lazy_real_glProgramUniformMatrix3x4dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_lazy_real_glProgramUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if(glad_lazy_real_glProgramUniformMatrix4x3dv == NULL) {
+        glad_lazy_real_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_lazy_loader("glProgramUniformMatrix4x3dv");
+        if(glad_glProgramUniformMatrix4x3dv == glad_lazy_glProgramUniformMatrix4x3dv) glad_glProgramUniformMatrix4x3dv = glad_lazy_real_glProgramUniformMatrix4x3dv;
+    }
+    glad_lazy_real_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_lazy_real_glValidateProgramPipeline = NULL;
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) {
+    if(glad_lazy_real_glValidateProgramPipeline == NULL) {
+        glad_lazy_real_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_lazy_loader("glValidateProgramPipeline");
+        if(glad_glValidateProgramPipeline == glad_lazy_glValidateProgramPipeline) glad_glValidateProgramPipeline = glad_lazy_real_glValidateProgramPipeline;
+    }
+    glad_lazy_real_glValidateProgramPipeline(pipeline);
+}
+
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_lazy_real_glGetProgramPipelineInfoLog = NULL;
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if(glad_lazy_real_glGetProgramPipelineInfoLog == NULL) {
+        glad_lazy_real_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_lazy_loader("glGetProgramPipelineInfoLog");
+        if(glad_glGetProgramPipelineInfoLog == glad_lazy_glGetProgramPipelineInfoLog) glad_glGetProgramPipelineInfoLog = glad_lazy_real_glGetProgramPipelineInfoLog;
+    }
+    glad_lazy_real_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+
+static PFNGLVERTEXATTRIBL1DPROC glad_lazy_real_glVertexAttribL1d = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+    if(glad_lazy_real_glVertexAttribL1d == NULL) {
+        glad_lazy_real_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glad_lazy_loader("glVertexAttribL1d");
+        if(glad_glVertexAttribL1d == glad_lazy_glVertexAttribL1d) glad_glVertexAttribL1d = glad_lazy_real_glVertexAttribL1d;
+    }
+    glad_lazy_real_glVertexAttribL1d(index, x);
+}
+
+static PFNGLVERTEXATTRIBL2DPROC glad_lazy_real_glVertexAttribL2d = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    if(glad_lazy_real_glVertexAttribL2d == NULL) {
+        glad_lazy_real_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glad_lazy_loader("glVertexAttribL2d");
+        if(glad_glVertexAttribL2d == glad_lazy_glVertexAttribL2d) glad_glVertexAttribL2d = glad_lazy_real_glVertexAttribL2d;
+    }
+    glad_lazy_real_glVertexAttribL2d(index, x, y);
+}
+
+static PFNGLVERTEXATTRIBL3DPROC glad_lazy_real_glVertexAttribL3d = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if(glad_lazy_real_glVertexAttribL3d == NULL) {
+        glad_lazy_real_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glad_lazy_loader("glVertexAttribL3d");
+        if(glad_glVertexAttribL3d == glad_lazy_glVertexAttribL3d) glad_glVertexAttribL3d = glad_lazy_real_glVertexAttribL3d;
+    }
+    glad_lazy_real_glVertexAttribL3d(index, x, y, z);
+}
+
+static PFNGLVERTEXATTRIBL4DPROC glad_lazy_real_glVertexAttribL4d = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if(glad_lazy_real_glVertexAttribL4d == NULL) {
+        glad_lazy_real_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glad_lazy_loader("glVertexAttribL4d");
+        if(glad_glVertexAttribL4d == glad_lazy_glVertexAttribL4d) glad_glVertexAttribL4d = glad_lazy_real_glVertexAttribL4d;
+    }
+    glad_lazy_real_glVertexAttribL4d(index, x, y, z, w);
+}
+
+static PFNGLVERTEXATTRIBL1DVPROC glad_lazy_real_glVertexAttribL1dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttribL1dv == NULL) {
+        glad_lazy_real_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glad_lazy_loader("glVertexAttribL1dv");
+        if(glad_glVertexAttribL1dv == glad_lazy_glVertexAttribL1dv) glad_glVertexAttribL1dv = glad_lazy_real_glVertexAttribL1dv;
+    }
+    glad_lazy_real_glVertexAttribL1dv(index, v);
+}
+
+static PFNGLVERTEXATTRIBL2DVPROC glad_lazy_real_glVertexAttribL2dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttribL2dv == NULL) {
+        glad_lazy_real_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glad_lazy_loader("glVertexAttribL2dv");
+        if(glad_glVertexAttribL2dv == glad_lazy_glVertexAttribL2dv) glad_glVertexAttribL2dv = glad_lazy_real_glVertexAttribL2dv;
+    }
+    glad_lazy_real_glVertexAttribL2dv(index, v);
+}
+
+static PFNGLVERTEXATTRIBL3DVPROC glad_lazy_real_glVertexAttribL3dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttribL3dv == NULL) {
+        glad_lazy_real_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glad_lazy_loader("glVertexAttribL3dv");
+        if(glad_glVertexAttribL3dv == glad_lazy_glVertexAttribL3dv) glad_glVertexAttribL3dv = glad_lazy_real_glVertexAttribL3dv;
+    }
+    glad_lazy_real_glVertexAttribL3dv(index, v);
+}
+
+static PFNGLVERTEXATTRIBL4DVPROC glad_lazy_real_glVertexAttribL4dv = NULL;
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    if(glad_lazy_real_glVertexAttribL4dv == NULL) {
+        glad_lazy_real_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glad_lazy_loader("glVertexAttribL4dv");
+        if(glad_glVertexAttribL4dv == glad_lazy_glVertexAttribL4dv) glad_glVertexAttribL4dv = glad_lazy_real_glVertexAttribL4dv;
+    }
+    glad_lazy_real_glVertexAttribL4dv(index, v);
+}
+
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_lazy_real_glVertexAttribLPointer = NULL;
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if(glad_lazy_real_glVertexAttribLPointer == NULL) {
+        glad_lazy_real_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glad_lazy_loader("glVertexAttribLPointer");
+        if(glad_glVertexAttribLPointer == glad_lazy_glVertexAttribLPointer) glad_glVertexAttribLPointer = glad_lazy_real_glVertexAttribLPointer;
+    }
+    glad_lazy_real_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+static PFNGLGETVERTEXATTRIBLDVPROC glad_lazy_real_glGetVertexAttribLdv = NULL;
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    if(glad_lazy_real_glGetVertexAttribLdv == NULL) {
+        glad_lazy_real_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glad_lazy_loader("glGetVertexAttribLdv");
+        if(glad_glGetVertexAttribLdv == glad_lazy_glGetVertexAttribLdv) glad_glGetVertexAttribLdv = glad_lazy_real_glGetVertexAttribLdv;
+    }
+    glad_lazy_real_glGetVertexAttribLdv(index, pname, params);
+}
+
+static PFNGLVIEWPORTARRAYVPROC glad_lazy_real_glViewportArrayv = NULL;
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    if(glad_lazy_real_glViewportArrayv == NULL) {
+        glad_lazy_real_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glad_lazy_loader("glViewportArrayv");
+        if(glad_glViewportArrayv == glad_lazy_glViewportArrayv) glad_glViewportArrayv = glad_lazy_real_glViewportArrayv;
+    }
+    glad_lazy_real_glViewportArrayv(first, count, v);
+}
+
+static PFNGLVIEWPORTINDEXEDFPROC glad_lazy_real_glViewportIndexedf = NULL;
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    if(glad_lazy_real_glViewportIndexedf == NULL) {
+        glad_lazy_real_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glad_lazy_loader("glViewportIndexedf");
+        if(glad_glViewportIndexedf == glad_lazy_glViewportIndexedf) glad_glViewportIndexedf = glad_lazy_real_glViewportIndexedf;
+    }
+    glad_lazy_real_glViewportIndexedf(index, x, y, w, h);
+}
+
+static PFNGLVIEWPORTINDEXEDFVPROC glad_lazy_real_glViewportIndexedfv = NULL;
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    if(glad_lazy_real_glViewportIndexedfv == NULL) {
+        glad_lazy_real_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glad_lazy_loader("glViewportIndexedfv");
+        if(glad_glViewportIndexedfv == glad_lazy_glViewportIndexedfv) glad_glViewportIndexedfv = glad_lazy_real_glViewportIndexedfv;
+    }
+    glad_lazy_real_glViewportIndexedfv(index, v);
+}
+
+static PFNGLSCISSORARRAYVPROC glad_lazy_real_glScissorArrayv = NULL;
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    if(glad_lazy_real_glScissorArrayv == NULL) {
+        glad_lazy_real_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glad_lazy_loader("glScissorArrayv");
+        if(glad_glScissorArrayv == glad_lazy_glScissorArrayv) glad_glScissorArrayv = glad_lazy_real_glScissorArrayv;
+    }
+    glad_lazy_real_glScissorArrayv(first, count, v);
+}
+
+static PFNGLSCISSORINDEXEDPROC glad_lazy_real_glScissorIndexed = NULL;
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glScissorIndexed == NULL) {
+        glad_lazy_real_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glad_lazy_loader("glScissorIndexed");
+        if(glad_glScissorIndexed == glad_lazy_glScissorIndexed) glad_glScissorIndexed = glad_lazy_real_glScissorIndexed;
+    }
+    glad_lazy_real_glScissorIndexed(index, left, bottom, width, height);
+}
+
+static PFNGLSCISSORINDEXEDVPROC glad_lazy_real_glScissorIndexedv = NULL;
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+    if(glad_lazy_real_glScissorIndexedv == NULL) {
+        glad_lazy_real_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glad_lazy_loader("glScissorIndexedv");
+        if(glad_glScissorIndexedv == glad_lazy_glScissorIndexedv) glad_glScissorIndexedv = glad_lazy_real_glScissorIndexedv;
+    }
+    glad_lazy_real_glScissorIndexedv(index, v);
+}
+
+static PFNGLDEPTHRANGEARRAYVPROC glad_lazy_real_glDepthRangeArrayv = NULL;
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    if(glad_lazy_real_glDepthRangeArrayv == NULL) {
+        glad_lazy_real_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glad_lazy_loader("glDepthRangeArrayv");
+        if(glad_glDepthRangeArrayv == glad_lazy_glDepthRangeArrayv) glad_glDepthRangeArrayv = glad_lazy_real_glDepthRangeArrayv;
+    }
+    glad_lazy_real_glDepthRangeArrayv(first, count, v);
+}
+
+static PFNGLDEPTHRANGEINDEXEDPROC glad_lazy_real_glDepthRangeIndexed = NULL;
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    if(glad_lazy_real_glDepthRangeIndexed == NULL) {
+        glad_lazy_real_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glad_lazy_loader("glDepthRangeIndexed");
+        if(glad_glDepthRangeIndexed == glad_lazy_glDepthRangeIndexed) glad_glDepthRangeIndexed = glad_lazy_real_glDepthRangeIndexed;
+    }
+    glad_lazy_real_glDepthRangeIndexed(index, n, f);
+}
+
+static PFNGLGETFLOATI_VPROC glad_lazy_real_glGetFloati_v = NULL;
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    if(glad_lazy_real_glGetFloati_v == NULL) {
+        glad_lazy_real_glGetFloati_v = (PFNGLGETFLOATI_VPROC)glad_lazy_loader("glGetFloati_v");
+        if(glad_glGetFloati_v == glad_lazy_glGetFloati_v) glad_glGetFloati_v = glad_lazy_real_glGetFloati_v;
+    }
+    glad_lazy_real_glGetFloati_v(target, index, data);
+}
+
+static PFNGLGETDOUBLEI_VPROC glad_lazy_real_glGetDoublei_v = NULL;
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    if(glad_lazy_real_glGetDoublei_v == NULL) {
+        glad_lazy_real_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glad_lazy_loader("glGetDoublei_v");
+        if(glad_glGetDoublei_v == glad_lazy_glGetDoublei_v) glad_glGetDoublei_v = glad_lazy_real_glGetDoublei_v;
+    }
+    glad_lazy_real_glGetDoublei_v(target, index, data);
+}
+
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_lazy_real_glDrawArraysInstancedBaseInstance = NULL;
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    if(glad_lazy_real_glDrawArraysInstancedBaseInstance == NULL) {
+        glad_lazy_real_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_loader("glDrawArraysInstancedBaseInstance");
+        if(glad_glDrawArraysInstancedBaseInstance == glad_lazy_glDrawArraysInstancedBaseInstance) glad_glDrawArraysInstancedBaseInstance = glad_lazy_real_glDrawArraysInstancedBaseInstance;
+    }
+    glad_lazy_real_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_lazy_real_glDrawElementsInstancedBaseInstance = NULL;
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    if(glad_lazy_real_glDrawElementsInstancedBaseInstance == NULL) {
+        glad_lazy_real_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_loader("glDrawElementsInstancedBaseInstance");
+        if(glad_glDrawElementsInstancedBaseInstance == glad_lazy_glDrawElementsInstancedBaseInstance) glad_glDrawElementsInstancedBaseInstance = glad_lazy_real_glDrawElementsInstancedBaseInstance;
+    }
+    glad_lazy_real_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    if(glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance == NULL) {
+        glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_loader("glDrawElementsInstancedBaseVertexBaseInstance");
+        if(glad_glDrawElementsInstancedBaseVertexBaseInstance == glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance) glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance;
+    }
+    glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static PFNGLGETINTERNALFORMATIVPROC glad_lazy_real_glGetInternalformativ = NULL;
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    if(glad_lazy_real_glGetInternalformativ == NULL) {
+        glad_lazy_real_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glad_lazy_loader("glGetInternalformativ");
+        if(glad_glGetInternalformativ == glad_lazy_glGetInternalformativ) glad_glGetInternalformativ = glad_lazy_real_glGetInternalformativ;
+    }
+    glad_lazy_real_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_lazy_real_glGetActiveAtomicCounterBufferiv = NULL;
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetActiveAtomicCounterBufferiv == NULL) {
+        glad_lazy_real_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_lazy_loader("glGetActiveAtomicCounterBufferiv");
+        if(glad_glGetActiveAtomicCounterBufferiv == glad_lazy_glGetActiveAtomicCounterBufferiv) glad_glGetActiveAtomicCounterBufferiv = glad_lazy_real_glGetActiveAtomicCounterBufferiv;
+    }
+    glad_lazy_real_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+
+static PFNGLBINDIMAGETEXTUREPROC glad_lazy_real_glBindImageTexture = NULL;
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    if(glad_lazy_real_glBindImageTexture == NULL) {
+        glad_lazy_real_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glad_lazy_loader("glBindImageTexture");
+        if(glad_glBindImageTexture == glad_lazy_glBindImageTexture) glad_glBindImageTexture = glad_lazy_real_glBindImageTexture;
+    }
+    glad_lazy_real_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static PFNGLMEMORYBARRIERPROC glad_lazy_real_glMemoryBarrier = NULL;
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) {
+    if(glad_lazy_real_glMemoryBarrier == NULL) {
+        glad_lazy_real_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glad_lazy_loader("glMemoryBarrier");
+        if(glad_glMemoryBarrier == glad_lazy_glMemoryBarrier) glad_glMemoryBarrier = glad_lazy_real_glMemoryBarrier;
+    }
+    glad_lazy_real_glMemoryBarrier(barriers);
+}
+
+static PFNGLTEXSTORAGE1DPROC glad_lazy_real_glTexStorage1D = NULL;
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if(glad_lazy_real_glTexStorage1D == NULL) {
+        glad_lazy_real_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glad_lazy_loader("glTexStorage1D");
+        if(glad_glTexStorage1D == glad_lazy_glTexStorage1D) glad_glTexStorage1D = glad_lazy_real_glTexStorage1D;
+    }
+    glad_lazy_real_glTexStorage1D(target, levels, internalformat, width);
+}
+
+static PFNGLTEXSTORAGE2DPROC glad_lazy_real_glTexStorage2D = NULL;
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glTexStorage2D == NULL) {
+        glad_lazy_real_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glad_lazy_loader("glTexStorage2D");
+        if(glad_glTexStorage2D == glad_lazy_glTexStorage2D) glad_glTexStorage2D = glad_lazy_real_glTexStorage2D;
+    }
+    glad_lazy_real_glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static PFNGLTEXSTORAGE3DPROC glad_lazy_real_glTexStorage3D = NULL;
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if(glad_lazy_real_glTexStorage3D == NULL) {
+        glad_lazy_real_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glad_lazy_loader("glTexStorage3D");
+        if(glad_glTexStorage3D == glad_lazy_glTexStorage3D) glad_glTexStorage3D = glad_lazy_real_glTexStorage3D;
+    }
+    glad_lazy_real_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_lazy_real_glDrawTransformFeedbackInstanced = NULL;
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    if(glad_lazy_real_glDrawTransformFeedbackInstanced == NULL) {
+        glad_lazy_real_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_lazy_loader("glDrawTransformFeedbackInstanced");
+        if(glad_glDrawTransformFeedbackInstanced == glad_lazy_glDrawTransformFeedbackInstanced) glad_glDrawTransformFeedbackInstanced = glad_lazy_real_glDrawTransformFeedbackInstanced;
+    }
+    glad_lazy_real_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_lazy_real_glDrawTransformFeedbackStreamInstanced = NULL;
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    if(glad_lazy_real_glDrawTransformFeedbackStreamInstanced == NULL) {
+        glad_lazy_real_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_lazy_loader("glDrawTransformFeedbackStreamInstanced");
+        if(glad_glDrawTransformFeedbackStreamInstanced == glad_lazy_glDrawTransformFeedbackStreamInstanced) glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_real_glDrawTransformFeedbackStreamInstanced;
+    }
+    glad_lazy_real_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+static PFNGLCLEARBUFFERDATAPROC glad_lazy_real_glClearBufferData = NULL;
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    if(glad_lazy_real_glClearBufferData == NULL) {
+        glad_lazy_real_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glad_lazy_loader("glClearBufferData");
+        if(glad_glClearBufferData == glad_lazy_glClearBufferData) glad_glClearBufferData = glad_lazy_real_glClearBufferData;
+    }
+    glad_lazy_real_glClearBufferData(target, internalformat, format, type, data);
+}
+
+static PFNGLCLEARBUFFERSUBDATAPROC glad_lazy_real_glClearBufferSubData = NULL;
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    if(glad_lazy_real_glClearBufferSubData == NULL) {
+        glad_lazy_real_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glad_lazy_loader("glClearBufferSubData");
+        if(glad_glClearBufferSubData == glad_lazy_glClearBufferSubData) glad_glClearBufferSubData = glad_lazy_real_glClearBufferSubData;
+    }
+    glad_lazy_real_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+static PFNGLDISPATCHCOMPUTEPROC glad_lazy_real_glDispatchCompute = NULL;
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    if(glad_lazy_real_glDispatchCompute == NULL) {
+        glad_lazy_real_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glad_lazy_loader("glDispatchCompute");
+        if(glad_glDispatchCompute == glad_lazy_glDispatchCompute) glad_glDispatchCompute = glad_lazy_real_glDispatchCompute;
+    }
+    glad_lazy_real_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_lazy_real_glDispatchComputeIndirect = NULL;
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) {
+    if(glad_lazy_real_glDispatchComputeIndirect == NULL) {
+        glad_lazy_real_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_lazy_loader("glDispatchComputeIndirect");
+        if(glad_glDispatchComputeIndirect == glad_lazy_glDispatchComputeIndirect) glad_glDispatchComputeIndirect = glad_lazy_real_glDispatchComputeIndirect;
+    }
+    glad_lazy_real_glDispatchComputeIndirect(indirect);
+}
+
+static PFNGLCOPYIMAGESUBDATAPROC glad_lazy_real_glCopyImageSubData = NULL;
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if(glad_lazy_real_glCopyImageSubData == NULL) {
+        glad_lazy_real_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glad_lazy_loader("glCopyImageSubData");
+        if(glad_glCopyImageSubData == glad_lazy_glCopyImageSubData) glad_glCopyImageSubData = glad_lazy_real_glCopyImageSubData;
+    }
+    glad_lazy_real_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_lazy_real_glFramebufferParameteri = NULL;
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    if(glad_lazy_real_glFramebufferParameteri == NULL) {
+        glad_lazy_real_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glad_lazy_loader("glFramebufferParameteri");
+        if(glad_glFramebufferParameteri == glad_lazy_glFramebufferParameteri) glad_glFramebufferParameteri = glad_lazy_real_glFramebufferParameteri;
+    }
+    glad_lazy_real_glFramebufferParameteri(target, pname, param);
+}
+
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_lazy_real_glGetFramebufferParameteriv = NULL;
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetFramebufferParameteriv == NULL) {
+        glad_lazy_real_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_lazy_loader("glGetFramebufferParameteriv");
+        if(glad_glGetFramebufferParameteriv == glad_lazy_glGetFramebufferParameteriv) glad_glGetFramebufferParameteriv = glad_lazy_real_glGetFramebufferParameteriv;
+    }
+    glad_lazy_real_glGetFramebufferParameteriv(target, pname, params);
+}
+
+static PFNGLGETINTERNALFORMATI64VPROC glad_lazy_real_glGetInternalformati64v = NULL;
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+    if(glad_lazy_real_glGetInternalformati64v == NULL) {
+        glad_lazy_real_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glad_lazy_loader("glGetInternalformati64v");
+        if(glad_glGetInternalformati64v == glad_lazy_glGetInternalformati64v) glad_glGetInternalformati64v = glad_lazy_real_glGetInternalformati64v;
+    }
+    glad_lazy_real_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_lazy_real_glInvalidateTexSubImage = NULL;
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    if(glad_lazy_real_glInvalidateTexSubImage == NULL) {
+        glad_lazy_real_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_loader("glInvalidateTexSubImage");
+        if(glad_glInvalidateTexSubImage == glad_lazy_glInvalidateTexSubImage) glad_glInvalidateTexSubImage = glad_lazy_real_glInvalidateTexSubImage;
+    }
+    glad_lazy_real_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static PFNGLINVALIDATETEXIMAGEPROC glad_lazy_real_glInvalidateTexImage = NULL;
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+    if(glad_lazy_real_glInvalidateTexImage == NULL) {
+        glad_lazy_real_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_loader("glInvalidateTexImage");
+        if(glad_glInvalidateTexImage == glad_lazy_glInvalidateTexImage) glad_glInvalidateTexImage = glad_lazy_real_glInvalidateTexImage;
+    }
+    glad_lazy_real_glInvalidateTexImage(texture, level);
+}
+
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_lazy_real_glInvalidateBufferSubData = NULL;
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if(glad_lazy_real_glInvalidateBufferSubData == NULL) {
+        glad_lazy_real_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_loader("glInvalidateBufferSubData");
+        if(glad_glInvalidateBufferSubData == glad_lazy_glInvalidateBufferSubData) glad_glInvalidateBufferSubData = glad_lazy_real_glInvalidateBufferSubData;
+    }
+    glad_lazy_real_glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static PFNGLINVALIDATEBUFFERDATAPROC glad_lazy_real_glInvalidateBufferData = NULL;
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+    if(glad_lazy_real_glInvalidateBufferData == NULL) {
+        glad_lazy_real_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_loader("glInvalidateBufferData");
+        if(glad_glInvalidateBufferData == glad_lazy_glInvalidateBufferData) glad_glInvalidateBufferData = glad_lazy_real_glInvalidateBufferData;
+    }
+    glad_lazy_real_glInvalidateBufferData(buffer);
+}
+
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_lazy_real_glInvalidateFramebuffer = NULL;
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    if(glad_lazy_real_glInvalidateFramebuffer == NULL) {
+        glad_lazy_real_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_loader("glInvalidateFramebuffer");
+        if(glad_glInvalidateFramebuffer == glad_lazy_glInvalidateFramebuffer) glad_glInvalidateFramebuffer = glad_lazy_real_glInvalidateFramebuffer;
+    }
+    glad_lazy_real_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_lazy_real_glInvalidateSubFramebuffer = NULL;
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if(glad_lazy_real_glInvalidateSubFramebuffer == NULL) {
+        glad_lazy_real_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_loader("glInvalidateSubFramebuffer");
+        if(glad_glInvalidateSubFramebuffer == glad_lazy_glInvalidateSubFramebuffer) glad_glInvalidateSubFramebuffer = glad_lazy_real_glInvalidateSubFramebuffer;
+    }
+    glad_lazy_real_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_lazy_real_glMultiDrawArraysIndirect = NULL;
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if(glad_lazy_real_glMultiDrawArraysIndirect == NULL) {
+        glad_lazy_real_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_loader("glMultiDrawArraysIndirect");
+        if(glad_glMultiDrawArraysIndirect == glad_lazy_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = glad_lazy_real_glMultiDrawArraysIndirect;
+    }
+    glad_lazy_real_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_lazy_real_glMultiDrawElementsIndirect = NULL;
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if(glad_lazy_real_glMultiDrawElementsIndirect == NULL) {
+        glad_lazy_real_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_loader("glMultiDrawElementsIndirect");
+        if(glad_glMultiDrawElementsIndirect == glad_lazy_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = glad_lazy_real_glMultiDrawElementsIndirect;
+    }
+    glad_lazy_real_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_lazy_real_glGetProgramInterfaceiv = NULL;
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    if(glad_lazy_real_glGetProgramInterfaceiv == NULL) {
+        glad_lazy_real_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glad_lazy_loader("glGetProgramInterfaceiv");
+        if(glad_glGetProgramInterfaceiv == glad_lazy_glGetProgramInterfaceiv) glad_glGetProgramInterfaceiv = glad_lazy_real_glGetProgramInterfaceiv;
+    }
+    glad_lazy_real_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_lazy_real_glGetProgramResourceIndex = NULL;
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    if(glad_lazy_real_glGetProgramResourceIndex == NULL) {
+        glad_lazy_real_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_lazy_loader("glGetProgramResourceIndex");
+        if(glad_glGetProgramResourceIndex == glad_lazy_glGetProgramResourceIndex) glad_glGetProgramResourceIndex = glad_lazy_real_glGetProgramResourceIndex;
+    }
+    return glad_lazy_real_glGetProgramResourceIndex(program, programInterface, name);
+}
+
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_lazy_real_glGetProgramResourceName = NULL;
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    if(glad_lazy_real_glGetProgramResourceName == NULL) {
+        glad_lazy_real_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glad_lazy_loader("glGetProgramResourceName");
+        if(glad_glGetProgramResourceName == glad_lazy_glGetProgramResourceName) glad_glGetProgramResourceName = glad_lazy_real_glGetProgramResourceName;
+    }
+    glad_lazy_real_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_lazy_real_glGetProgramResourceiv = NULL;
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    if(glad_lazy_real_glGetProgramResourceiv == NULL) {
+        glad_lazy_real_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glad_lazy_loader("glGetProgramResourceiv");
+        if(glad_glGetProgramResourceiv == glad_lazy_glGetProgramResourceiv) glad_glGetProgramResourceiv = glad_lazy_real_glGetProgramResourceiv;
+    }
+    glad_lazy_real_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_lazy_real_glGetProgramResourceLocation = NULL;
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    if(glad_lazy_real_glGetProgramResourceLocation == NULL) {
+        glad_lazy_real_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_lazy_loader("glGetProgramResourceLocation");
+        if(glad_glGetProgramResourceLocation == glad_lazy_glGetProgramResourceLocation) glad_glGetProgramResourceLocation = glad_lazy_real_glGetProgramResourceLocation;
+    }
+    return glad_lazy_real_glGetProgramResourceLocation(program, programInterface, name);
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_lazy_real_glGetProgramResourceLocationIndex = NULL;
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    if(glad_lazy_real_glGetProgramResourceLocationIndex == NULL) {
+        glad_lazy_real_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_lazy_loader("glGetProgramResourceLocationIndex");
+        if(glad_glGetProgramResourceLocationIndex == glad_lazy_glGetProgramResourceLocationIndex) glad_glGetProgramResourceLocationIndex = glad_lazy_real_glGetProgramResourceLocationIndex;
+    }
+    return glad_lazy_real_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_lazy_real_glShaderStorageBlockBinding = NULL;
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    if(glad_lazy_real_glShaderStorageBlockBinding == NULL) {
+        glad_lazy_real_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_lazy_loader("glShaderStorageBlockBinding");
+        if(glad_glShaderStorageBlockBinding == glad_lazy_glShaderStorageBlockBinding) glad_glShaderStorageBlockBinding = glad_lazy_real_glShaderStorageBlockBinding;
+    }
+    glad_lazy_real_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+static PFNGLTEXBUFFERRANGEPROC glad_lazy_real_glTexBufferRange = NULL;
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if(glad_lazy_real_glTexBufferRange == NULL) {
+        glad_lazy_real_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glad_lazy_loader("glTexBufferRange");
+        if(glad_glTexBufferRange == glad_lazy_glTexBufferRange) glad_glTexBufferRange = glad_lazy_real_glTexBufferRange;
+    }
+    glad_lazy_real_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_lazy_real_glTexStorage2DMultisample = NULL;
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if(glad_lazy_real_glTexStorage2DMultisample == NULL) {
+        glad_lazy_real_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_lazy_loader("glTexStorage2DMultisample");
+        if(glad_glTexStorage2DMultisample == glad_lazy_glTexStorage2DMultisample) glad_glTexStorage2DMultisample = glad_lazy_real_glTexStorage2DMultisample;
+    }
+    glad_lazy_real_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_lazy_real_glTexStorage3DMultisample = NULL;
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if(glad_lazy_real_glTexStorage3DMultisample == NULL) {
+        glad_lazy_real_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_lazy_loader("glTexStorage3DMultisample");
+        if(glad_glTexStorage3DMultisample == glad_lazy_glTexStorage3DMultisample) glad_glTexStorage3DMultisample = glad_lazy_real_glTexStorage3DMultisample;
+    }
+    glad_lazy_real_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static PFNGLTEXTUREVIEWPROC glad_lazy_real_glTextureView = NULL;
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    if(glad_lazy_real_glTextureView == NULL) {
+        glad_lazy_real_glTextureView = (PFNGLTEXTUREVIEWPROC)glad_lazy_loader("glTextureView");
+        if(glad_glTextureView == glad_lazy_glTextureView) glad_glTextureView = glad_lazy_real_glTextureView;
+    }
+    glad_lazy_real_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static PFNGLBINDVERTEXBUFFERPROC glad_lazy_real_glBindVertexBuffer = NULL;
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if(glad_lazy_real_glBindVertexBuffer == NULL) {
+        glad_lazy_real_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glad_lazy_loader("glBindVertexBuffer");
+        if(glad_glBindVertexBuffer == glad_lazy_glBindVertexBuffer) glad_glBindVertexBuffer = glad_lazy_real_glBindVertexBuffer;
+    }
+    glad_lazy_real_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static PFNGLVERTEXATTRIBFORMATPROC glad_lazy_real_glVertexAttribFormat = NULL;
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if(glad_lazy_real_glVertexAttribFormat == NULL) {
+        glad_lazy_real_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glad_lazy_loader("glVertexAttribFormat");
+        if(glad_glVertexAttribFormat == glad_lazy_glVertexAttribFormat) glad_glVertexAttribFormat = glad_lazy_real_glVertexAttribFormat;
+    }
+    glad_lazy_real_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static PFNGLVERTEXATTRIBIFORMATPROC glad_lazy_real_glVertexAttribIFormat = NULL;
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if(glad_lazy_real_glVertexAttribIFormat == NULL) {
+        glad_lazy_real_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glad_lazy_loader("glVertexAttribIFormat");
+        if(glad_glVertexAttribIFormat == glad_lazy_glVertexAttribIFormat) glad_glVertexAttribIFormat = glad_lazy_real_glVertexAttribIFormat;
+    }
+    glad_lazy_real_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static PFNGLVERTEXATTRIBLFORMATPROC glad_lazy_real_glVertexAttribLFormat = NULL;
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if(glad_lazy_real_glVertexAttribLFormat == NULL) {
+        glad_lazy_real_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glad_lazy_loader("glVertexAttribLFormat");
+        if(glad_glVertexAttribLFormat == glad_lazy_glVertexAttribLFormat) glad_glVertexAttribLFormat = glad_lazy_real_glVertexAttribLFormat;
+    }
+    glad_lazy_real_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static PFNGLVERTEXATTRIBBINDINGPROC glad_lazy_real_glVertexAttribBinding = NULL;
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    if(glad_lazy_real_glVertexAttribBinding == NULL) {
+        glad_lazy_real_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glad_lazy_loader("glVertexAttribBinding");
+        if(glad_glVertexAttribBinding == glad_lazy_glVertexAttribBinding) glad_glVertexAttribBinding = glad_lazy_real_glVertexAttribBinding;
+    }
+    glad_lazy_real_glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static PFNGLVERTEXBINDINGDIVISORPROC glad_lazy_real_glVertexBindingDivisor = NULL;
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    if(glad_lazy_real_glVertexBindingDivisor == NULL) {
+        glad_lazy_real_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glad_lazy_loader("glVertexBindingDivisor");
+        if(glad_glVertexBindingDivisor == glad_lazy_glVertexBindingDivisor) glad_glVertexBindingDivisor = glad_lazy_real_glVertexBindingDivisor;
+    }
+    glad_lazy_real_glVertexBindingDivisor(bindingindex, divisor);
+}
+
+static PFNGLDEBUGMESSAGECONTROLPROC glad_lazy_real_glDebugMessageControl = NULL;
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    if(glad_lazy_real_glDebugMessageControl == NULL) {
+        glad_lazy_real_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_loader("glDebugMessageControl");
+        if(glad_glDebugMessageControl == glad_lazy_glDebugMessageControl) glad_glDebugMessageControl = glad_lazy_real_glDebugMessageControl;
+    }
+    glad_lazy_real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+static PFNGLDEBUGMESSAGEINSERTPROC glad_lazy_real_glDebugMessageInsert = NULL;
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    if(glad_lazy_real_glDebugMessageInsert == NULL) {
+        glad_lazy_real_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_loader("glDebugMessageInsert");
+        if(glad_glDebugMessageInsert == glad_lazy_glDebugMessageInsert) glad_glDebugMessageInsert = glad_lazy_real_glDebugMessageInsert;
+    }
+    glad_lazy_real_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_lazy_real_glDebugMessageCallback = NULL;
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    if(glad_lazy_real_glDebugMessageCallback == NULL) {
+        glad_lazy_real_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_loader("glDebugMessageCallback");
+        if(glad_glDebugMessageCallback == glad_lazy_glDebugMessageCallback) glad_glDebugMessageCallback = glad_lazy_real_glDebugMessageCallback;
+    }
+    glad_lazy_real_glDebugMessageCallback(callback, userParam);
+}
+
+static PFNGLGETDEBUGMESSAGELOGPROC glad_lazy_real_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    if(glad_lazy_real_glGetDebugMessageLog == NULL) {
+        glad_lazy_real_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_loader("glGetDebugMessageLog");
+        if(glad_glGetDebugMessageLog == glad_lazy_glGetDebugMessageLog) glad_glGetDebugMessageLog = glad_lazy_real_glGetDebugMessageLog;
+    }
+    return glad_lazy_real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static PFNGLPUSHDEBUGGROUPPROC glad_lazy_real_glPushDebugGroup = NULL;
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    if(glad_lazy_real_glPushDebugGroup == NULL) {
+        glad_lazy_real_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glad_lazy_loader("glPushDebugGroup");
+        if(glad_glPushDebugGroup == glad_lazy_glPushDebugGroup) glad_glPushDebugGroup = glad_lazy_real_glPushDebugGroup;
+    }
+    glad_lazy_real_glPushDebugGroup(source, id, length, message);
+}
+
+static PFNGLPOPDEBUGGROUPPROC glad_lazy_real_glPopDebugGroup = NULL;
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+    if(glad_lazy_real_glPopDebugGroup == NULL) {
+        glad_lazy_real_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glad_lazy_loader("glPopDebugGroup");
+        if(glad_glPopDebugGroup == glad_lazy_glPopDebugGroup) glad_glPopDebugGroup = glad_lazy_real_glPopDebugGroup;
+    }
+    glad_lazy_real_glPopDebugGroup();
+}
+
+static PFNGLOBJECTLABELPROC glad_lazy_real_glObjectLabel = NULL;
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    if(glad_lazy_real_glObjectLabel == NULL) {
+        glad_lazy_real_glObjectLabel = (PFNGLOBJECTLABELPROC)glad_lazy_loader("glObjectLabel");
+        if(glad_glObjectLabel == glad_lazy_glObjectLabel) glad_glObjectLabel = glad_lazy_real_glObjectLabel;
+    }
+    glad_lazy_real_glObjectLabel(identifier, name, length, label);
+}
+
+static PFNGLGETOBJECTLABELPROC glad_lazy_real_glGetObjectLabel = NULL;
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if(glad_lazy_real_glGetObjectLabel == NULL) {
+        glad_lazy_real_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glad_lazy_loader("glGetObjectLabel");
+        if(glad_glGetObjectLabel == glad_lazy_glGetObjectLabel) glad_glGetObjectLabel = glad_lazy_real_glGetObjectLabel;
+    }
+    glad_lazy_real_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+
+static PFNGLOBJECTPTRLABELPROC glad_lazy_real_glObjectPtrLabel = NULL;
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    if(glad_lazy_real_glObjectPtrLabel == NULL) {
+        glad_lazy_real_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glad_lazy_loader("glObjectPtrLabel");
+        if(glad_glObjectPtrLabel == glad_lazy_glObjectPtrLabel) glad_glObjectPtrLabel = glad_lazy_real_glObjectPtrLabel;
+    }
+    glad_lazy_real_glObjectPtrLabel(ptr, length, label);
+}
+
+static PFNGLGETOBJECTPTRLABELPROC glad_lazy_real_glGetObjectPtrLabel = NULL;
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if(glad_lazy_real_glGetObjectPtrLabel == NULL) {
+        glad_lazy_real_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glad_lazy_loader("glGetObjectPtrLabel");
+        if(glad_glGetObjectPtrLabel == glad_lazy_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = glad_lazy_real_glGetObjectPtrLabel;
+    }
+    glad_lazy_real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+
+static PFNGLBUFFERSTORAGEPROC glad_lazy_real_glBufferStorage = NULL;
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    if(glad_lazy_real_glBufferStorage == NULL) {
+        glad_lazy_real_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glad_lazy_loader("glBufferStorage");
+        if(glad_glBufferStorage == glad_lazy_glBufferStorage) glad_glBufferStorage = glad_lazy_real_glBufferStorage;
+    }
+    glad_lazy_real_glBufferStorage(target, size, data, flags);
+}
+
+static void glad_lazy_reset(void) {
+    glad_lazy_real_glCullFace = NULL;
+    glad_lazy_real_glFrontFace = NULL;
+    glad_lazy_real_glHint = NULL;
+    glad_lazy_real_glLineWidth = NULL;
+    glad_lazy_real_glPointSize = NULL;
+    glad_lazy_real_glPolygonMode = NULL;
+    glad_lazy_real_glScissor = NULL;
+    glad_lazy_real_glTexParameterf = NULL;
+    glad_lazy_real_glTexParameterfv = NULL;
+    glad_lazy_real_glTexParameteri = NULL;
+    glad_lazy_real_glTexParameteriv = NULL;
+    glad_lazy_real_glTexImage1D = NULL;
+    glad_lazy_real_glTexImage2D = NULL;
+    glad_lazy_real_glDrawBuffer = NULL;
+    glad_lazy_real_glClear = NULL;
+    glad_lazy_real_glClearColor = NULL;
+    glad_lazy_real_glClearStencil = NULL;
+    glad_lazy_real_glClearDepth = NULL;
+    glad_lazy_real_glStencilMask = NULL;
+    glad_lazy_real_glColorMask = NULL;
+    glad_lazy_real_glDepthMask = NULL;
+    glad_lazy_real_glDisable = NULL;
+    glad_lazy_real_glEnable = NULL;
+    glad_lazy_real_glFinish = NULL;
+    glad_lazy_real_glFlush = NULL;
+    glad_lazy_real_glBlendFunc = NULL;
+    glad_lazy_real_glLogicOp = NULL;
+    glad_lazy_real_glStencilFunc = NULL;
+    glad_lazy_real_glStencilOp = NULL;
+    glad_lazy_real_glDepthFunc = NULL;
+    glad_lazy_real_glPixelStoref = NULL;
+    glad_lazy_real_glPixelStorei = NULL;
+    glad_lazy_real_glReadBuffer = NULL;
+    glad_lazy_real_glReadPixels = NULL;
+    glad_lazy_real_glGetBooleanv = NULL;
+    glad_lazy_real_glGetDoublev = NULL;
+    glad_lazy_real_glGetError = NULL;
+    glad_lazy_real_glGetFloatv = NULL;
+    glad_lazy_real_glGetIntegerv = NULL;
+    glad_lazy_real_glGetString = NULL;
+    glad_lazy_real_glGetTexImage = NULL;
+    glad_lazy_real_glGetTexParameterfv = NULL;
+    glad_lazy_real_glGetTexParameteriv = NULL;
+    glad_lazy_real_glGetTexLevelParameterfv = NULL;
+    glad_lazy_real_glGetTexLevelParameteriv = NULL;
+    glad_lazy_real_glIsEnabled = NULL;
+    glad_lazy_real_glDepthRange = NULL;
+    glad_lazy_real_glViewport = NULL;
+    glad_lazy_real_glDrawArrays = NULL;
+    glad_lazy_real_glDrawElements = NULL;
+    glad_lazy_real_glPolygonOffset = NULL;
+    glad_lazy_real_glCopyTexImage1D = NULL;
+    glad_lazy_real_glCopyTexImage2D = NULL;
+    glad_lazy_real_glCopyTexSubImage1D = NULL;
+    glad_lazy_real_glCopyTexSubImage2D = NULL;
+    glad_lazy_real_glTexSubImage1D = NULL;
+    glad_lazy_real_glTexSubImage2D = NULL;
+    glad_lazy_real_glBindTexture = NULL;
+    glad_lazy_real_glDeleteTextures = NULL;
+    glad_lazy_real_glGenTextures = NULL;
+    glad_lazy_real_glIsTexture = NULL;
+    glad_lazy_real_glDrawRangeElements = NULL;
+    glad_lazy_real_glTexImage3D = NULL;
+    glad_lazy_real_glTexSubImage3D = NULL;
+    glad_lazy_real_glCopyTexSubImage3D = NULL;
+    glad_lazy_real_glActiveTexture = NULL;
+    glad_lazy_real_glSampleCoverage = NULL;
+    glad_lazy_real_glCompressedTexImage3D = NULL;
+    glad_lazy_real_glCompressedTexImage2D = NULL;
+    glad_lazy_real_glCompressedTexImage1D = NULL;
+    glad_lazy_real_glCompressedTexSubImage3D = NULL;
+    glad_lazy_real_glCompressedTexSubImage2D = NULL;
+    glad_lazy_real_glCompressedTexSubImage1D = NULL;
+    glad_lazy_real_glGetCompressedTexImage = NULL;
+    glad_lazy_real_glBlendFuncSeparate = NULL;
+    glad_lazy_real_glMultiDrawArrays = NULL;
+    glad_lazy_real_glMultiDrawElements = NULL;
+    glad_lazy_real_glPointParameterf = NULL;
+    glad_lazy_real_glPointParameterfv = NULL;
+    glad_lazy_real_glPointParameteri = NULL;
+    glad_lazy_real_glPointParameteriv = NULL;
+    glad_lazy_real_glBlendColor = NULL;
+    glad_lazy_real_glBlendEquation = NULL;
+    glad_lazy_real_glGenQueries = NULL;
+    glad_lazy_real_glDeleteQueries = NULL;
+    glad_lazy_real_glIsQuery = NULL;
+    glad_lazy_real_glBeginQuery = NULL;
+    glad_lazy_real_glEndQuery = NULL;
+    glad_lazy_real_glGetQueryiv = NULL;
+    glad_lazy_real_glGetQueryObjectiv = NULL;
+    glad_lazy_real_glGetQueryObjectuiv = NULL;
+    glad_lazy_real_glBindBuffer = NULL;
+    glad_lazy_real_glDeleteBuffers = NULL;
+    glad_lazy_real_glGenBuffers = NULL;
+    glad_lazy_real_glIsBuffer = NULL;
+    glad_lazy_real_glBufferData = NULL;
+    glad_lazy_real_glBufferSubData = NULL;
+    glad_lazy_real_glGetBufferSubData = NULL;
+    glad_lazy_real_glMapBuffer = NULL;
+    glad_lazy_real_glUnmapBuffer = NULL;
+    glad_lazy_real_glGetBufferParameteriv = NULL;
+    glad_lazy_real_glGetBufferPointerv = NULL;
+    glad_lazy_real_glBlendEquationSeparate = NULL;
+    glad_lazy_real_glDrawBuffers = NULL;
+    glad_lazy_real_glStencilOpSeparate = NULL;
+    glad_lazy_real_glStencilFuncSeparate = NULL;
+    glad_lazy_real_glStencilMaskSeparate = NULL;
+    glad_lazy_real_glAttachShader = NULL;
+    glad_lazy_real_glBindAttribLocation = NULL;
+    glad_lazy_real_glCompileShader = NULL;
+    glad_lazy_real_glCreateProgram = NULL;
+    glad_lazy_real_glCreateShader = NULL;
+    glad_lazy_real_glDeleteProgram = NULL;
+    glad_lazy_real_glDeleteShader = NULL;
+    glad_lazy_real_glDetachShader = NULL;
+    glad_lazy_real_glDisableVertexAttribArray = NULL;
+    glad_lazy_real_glEnableVertexAttribArray = NULL;
+    glad_lazy_real_glGetActiveAttrib = NULL;
+    glad_lazy_real_glGetActiveUniform = NULL;
+    glad_lazy_real_glGetAttachedShaders = NULL;
+    glad_lazy_real_glGetAttribLocation = NULL;
+    glad_lazy_real_glGetProgramiv = NULL;
+    glad_lazy_real_glGetProgramInfoLog = NULL;
+    glad_lazy_real_glGetShaderiv = NULL;
+    glad_lazy_real_glGetShaderInfoLog = NULL;
+    glad_lazy_real_glGetShaderSource = NULL;
+    glad_lazy_real_glGetUniformLocation = NULL;
+    glad_lazy_real_glGetUniformfv = NULL;
+    glad_lazy_real_glGetUniformiv = NULL;
+    glad_lazy_real_glGetVertexAttribdv = NULL;
+    glad_lazy_real_glGetVertexAttribfv = NULL;
+    glad_lazy_real_glGetVertexAttribiv = NULL;
+    glad_lazy_real_glGetVertexAttribPointerv = NULL;
+    glad_lazy_real_glIsProgram = NULL;
+    glad_lazy_real_glIsShader = NULL;
+    glad_lazy_real_glLinkProgram = NULL;
+    glad_lazy_real_glShaderSource = NULL;
+    glad_lazy_real_glUseProgram = NULL;
+    glad_lazy_real_glUniform1f = NULL;
+    glad_lazy_real_glUniform2f = NULL;
+    glad_lazy_real_glUniform3f = NULL;
+    glad_lazy_real_glUniform4f = NULL;
+    glad_lazy_real_glUniform1i = NULL;
+    glad_lazy_real_glUniform2i = NULL;
+    glad_lazy_real_glUniform3i = NULL;
+    glad_lazy_real_glUniform4i = NULL;
+    glad_lazy_real_glUniform1fv = NULL;
+    glad_lazy_real_glUniform2fv = NULL;
+    glad_lazy_real_glUniform3fv = NULL;
+    glad_lazy_real_glUniform4fv = NULL;
+    glad_lazy_real_glUniform1iv = NULL;
+    glad_lazy_real_glUniform2iv = NULL;
+    glad_lazy_real_glUniform3iv = NULL;
+    glad_lazy_real_glUniform4iv = NULL;
+    glad_lazy_real_glUniformMatrix2fv = NULL;
+    glad_lazy_real_glUniformMatrix3fv = NULL;
+    glad_lazy_real_glUniformMatrix4fv = NULL;
+    glad_lazy_real_glValidateProgram = NULL;
+    glad_lazy_real_glVertexAttrib1d = NULL;
+    glad_lazy_real_glVertexAttrib1dv = NULL;
+    glad_lazy_real_glVertexAttrib1f = NULL;
+    glad_lazy_real_glVertexAttrib1fv = NULL;
+    glad_lazy_real_glVertexAttrib1s = NULL;
+    glad_lazy_real_glVertexAttrib1sv = NULL;
+    glad_lazy_real_glVertexAttrib2d = NULL;
+    glad_lazy_real_glVertexAttrib2dv = NULL;
+    glad_lazy_real_glVertexAttrib2f = NULL;
+    glad_lazy_real_glVertexAttrib2fv = NULL;
+    glad_lazy_real_glVertexAttrib2s = NULL;
+    glad_lazy_real_glVertexAttrib2sv = NULL;
+    glad_lazy_real_glVertexAttrib3d = NULL;
+    glad_lazy_real_glVertexAttrib3dv = NULL;
+    glad_lazy_real_glVertexAttrib3f = NULL;
+    glad_lazy_real_glVertexAttrib3fv = NULL;
+    glad_lazy_real_glVertexAttrib3s = NULL;
+    glad_lazy_real_glVertexAttrib3sv = NULL;
+    glad_lazy_real_glVertexAttrib4Nbv = NULL;
+    glad_lazy_real_glVertexAttrib4Niv = NULL;
+    glad_lazy_real_glVertexAttrib4Nsv = NULL;
+    glad_lazy_real_glVertexAttrib4Nub = NULL;
+    glad_lazy_real_glVertexAttrib4Nubv = NULL;
+    glad_lazy_real_glVertexAttrib4Nuiv = NULL;
+    glad_lazy_real_glVertexAttrib4Nusv = NULL;
+    glad_lazy_real_glVertexAttrib4bv = NULL;
+    glad_lazy_real_glVertexAttrib4d = NULL;
+    glad_lazy_real_glVertexAttrib4dv = NULL;
+    glad_lazy_real_glVertexAttrib4f = NULL;
+    glad_lazy_real_glVertexAttrib4fv = NULL;
+    glad_lazy_real_glVertexAttrib4iv = NULL;
+    glad_lazy_real_glVertexAttrib4s = NULL;
+    glad_lazy_real_glVertexAttrib4sv = NULL;
+    glad_lazy_real_glVertexAttrib4ubv = NULL;
+    glad_lazy_real_glVertexAttrib4uiv = NULL;
+    glad_lazy_real_glVertexAttrib4usv = NULL;
+    glad_lazy_real_glVertexAttribPointer = NULL;
+    glad_lazy_real_glUniformMatrix2x3fv = NULL;
+    glad_lazy_real_glUniformMatrix3x2fv = NULL;
+    glad_lazy_real_glUniformMatrix2x4fv = NULL;
+    glad_lazy_real_glUniformMatrix4x2fv = NULL;
+    glad_lazy_real_glUniformMatrix3x4fv = NULL;
+    glad_lazy_real_glUniformMatrix4x3fv = NULL;
+    glad_lazy_real_glColorMaski = NULL;
+    glad_lazy_real_glGetBooleani_v = NULL;
+    glad_lazy_real_glGetIntegeri_v = NULL;
+    glad_lazy_real_glEnablei = NULL;
+    glad_lazy_real_glDisablei = NULL;
+    glad_lazy_real_glIsEnabledi = NULL;
+    glad_lazy_real_glBeginTransformFeedback = NULL;
+    glad_lazy_real_glEndTransformFeedback = NULL;
+    glad_lazy_real_glBindBufferRange = NULL;
+    glad_lazy_real_glBindBufferBase = NULL;
+    glad_lazy_real_glTransformFeedbackVaryings = NULL;
+    glad_lazy_real_glGetTransformFeedbackVarying = NULL;
+    glad_lazy_real_glClampColor = NULL;
+    glad_lazy_real_glBeginConditionalRender = NULL;
+    glad_lazy_real_glEndConditionalRender = NULL;
+    glad_lazy_real_glVertexAttribIPointer = NULL;
+    glad_lazy_real_glGetVertexAttribIiv = NULL;
+    glad_lazy_real_glGetVertexAttribIuiv = NULL;
+    glad_lazy_real_glVertexAttribI1i = NULL;
+    glad_lazy_real_glVertexAttribI2i = NULL;
+    glad_lazy_real_glVertexAttribI3i = NULL;
+    glad_lazy_real_glVertexAttribI4i = NULL;
+    glad_lazy_real_glVertexAttribI1ui = NULL;
+    glad_lazy_real_glVertexAttribI2ui = NULL;
+    glad_lazy_real_glVertexAttribI3ui = NULL;
+    glad_lazy_real_glVertexAttribI4ui = NULL;
+    glad_lazy_real_glVertexAttribI1iv = NULL;
+    glad_lazy_real_glVertexAttribI2iv = NULL;
+    glad_lazy_real_glVertexAttribI3iv = NULL;
+    glad_lazy_real_glVertexAttribI4iv = NULL;
+    glad_lazy_real_glVertexAttribI1uiv = NULL;
+    glad_lazy_real_glVertexAttribI2uiv = NULL;
+    glad_lazy_real_glVertexAttribI3uiv = NULL;
+    glad_lazy_real_glVertexAttribI4uiv = NULL;
+    glad_lazy_real_glVertexAttribI4bv = NULL;
+    glad_lazy_real_glVertexAttribI4sv = NULL;
+    glad_lazy_real_glVertexAttribI4ubv = NULL;
+    glad_lazy_real_glVertexAttribI4usv = NULL;
+    glad_lazy_real_glGetUniformuiv = NULL;
+    glad_lazy_real_glBindFragDataLocation = NULL;
+    glad_lazy_real_glGetFragDataLocation = NULL;
+    glad_lazy_real_glUniform1ui = NULL;
+    glad_lazy_real_glUniform2ui = NULL;
+    glad_lazy_real_glUniform3ui = NULL;
+    glad_lazy_real_glUniform4ui = NULL;
+    glad_lazy_real_glUniform1uiv = NULL;
+    glad_lazy_real_glUniform2uiv = NULL;
+    glad_lazy_real_glUniform3uiv = NULL;
+    glad_lazy_real_glUniform4uiv = NULL;
+    glad_lazy_real_glTexParameterIiv = NULL;
+    glad_lazy_real_glTexParameterIuiv = NULL;
+    glad_lazy_real_glGetTexParameterIiv = NULL;
+    glad_lazy_real_glGetTexParameterIuiv = NULL;
+    glad_lazy_real_glClearBufferiv = NULL;
+    glad_lazy_real_glClearBufferuiv = NULL;
+    glad_lazy_real_glClearBufferfv = NULL;
+    glad_lazy_real_glClearBufferfi = NULL;
+    glad_lazy_real_glGetStringi = NULL;
+    glad_lazy_real_glIsRenderbuffer = NULL;
+    glad_lazy_real_glBindRenderbuffer = NULL;
+    glad_lazy_real_glDeleteRenderbuffers = NULL;
+    glad_lazy_real_glGenRenderbuffers = NULL;
+    glad_lazy_real_glRenderbufferStorage = NULL;
+    glad_lazy_real_glGetRenderbufferParameteriv = NULL;
+    glad_lazy_real_glIsFramebuffer = NULL;
+    glad_lazy_real_glBindFramebuffer = NULL;
+    glad_lazy_real_glDeleteFramebuffers = NULL;
+    glad_lazy_real_glGenFramebuffers = NULL;
+    glad_lazy_real_glCheckFramebufferStatus = NULL;
+    glad_lazy_real_glFramebufferTexture1D = NULL;
+    glad_lazy_real_glFramebufferTexture2D = NULL;
+    glad_lazy_real_glFramebufferTexture3D = NULL;
+    glad_lazy_real_glFramebufferRenderbuffer = NULL;
+    glad_lazy_real_glGetFramebufferAttachmentParameteriv = NULL;
+    glad_lazy_real_glGenerateMipmap = NULL;
+    glad_lazy_real_glBlitFramebuffer = NULL;
+    glad_lazy_real_glRenderbufferStorageMultisample = NULL;
+    glad_lazy_real_glFramebufferTextureLayer = NULL;
+    glad_lazy_real_glMapBufferRange = NULL;
+    glad_lazy_real_glFlushMappedBufferRange = NULL;
+    glad_lazy_real_glBindVertexArray = NULL;
+    glad_lazy_real_glDeleteVertexArrays = NULL;
+    glad_lazy_real_glGenVertexArrays = NULL;
+    glad_lazy_real_glIsVertexArray = NULL;
+    glad_lazy_real_glDrawArraysInstanced = NULL;
+    glad_lazy_real_glDrawElementsInstanced = NULL;
+    glad_lazy_real_glTexBuffer = NULL;
+    glad_lazy_real_glPrimitiveRestartIndex = NULL;
+    glad_lazy_real_glCopyBufferSubData = NULL;
+    glad_lazy_real_glGetUniformIndices = NULL;
+    glad_lazy_real_glGetActiveUniformsiv = NULL;
+    glad_lazy_real_glGetActiveUniformName = NULL;
+    glad_lazy_real_glGetUniformBlockIndex = NULL;
+    glad_lazy_real_glGetActiveUniformBlockiv = NULL;
+    glad_lazy_real_glGetActiveUniformBlockName = NULL;
+    glad_lazy_real_glUniformBlockBinding = NULL;
+    glad_lazy_real_glDrawElementsBaseVertex = NULL;
+    glad_lazy_real_glDrawRangeElementsBaseVertex = NULL;
+    glad_lazy_real_glDrawElementsInstancedBaseVertex = NULL;
+    glad_lazy_real_glMultiDrawElementsBaseVertex = NULL;
+    glad_lazy_real_glProvokingVertex = NULL;
+    glad_lazy_real_glFenceSync = NULL;
+    glad_lazy_real_glIsSync = NULL;
+    glad_lazy_real_glDeleteSync = NULL;
+    glad_lazy_real_glClientWaitSync = NULL;
+    glad_lazy_real_glWaitSync = NULL;
+    glad_lazy_real_glGetInteger64v = NULL;
+    glad_lazy_real_glGetSynciv = NULL;
+    glad_lazy_real_glGetInteger64i_v = NULL;
+    glad_lazy_real_glGetBufferParameteri64v = NULL;
+    glad_lazy_real_glFramebufferTexture = NULL;
+    glad_lazy_real_glTexImage2DMultisample = NULL;
+    glad_lazy_real_glTexImage3DMultisample = NULL;
+    glad_lazy_real_glGetMultisamplefv = NULL;
+    glad_lazy_real_glSampleMaski = NULL;
+    glad_lazy_real_glBindFragDataLocationIndexed = NULL;
+    glad_lazy_real_glGetFragDataIndex = NULL;
+    glad_lazy_real_glGenSamplers = NULL;
+    glad_lazy_real_glDeleteSamplers = NULL;
+    glad_lazy_real_glIsSampler = NULL;
+    glad_lazy_real_glBindSampler = NULL;
+    glad_lazy_real_glSamplerParameteri = NULL;
+    glad_lazy_real_glSamplerParameteriv = NULL;
+    glad_lazy_real_glSamplerParameterf = NULL;
+    glad_lazy_real_glSamplerParameterfv = NULL;
+    glad_lazy_real_glSamplerParameterIiv = NULL;
+    glad_lazy_real_glSamplerParameterIuiv = NULL;
+    glad_lazy_real_glGetSamplerParameteriv = NULL;
+    glad_lazy_real_glGetSamplerParameterIiv = NULL;
+    glad_lazy_real_glGetSamplerParameterfv = NULL;
+    glad_lazy_real_glGetSamplerParameterIuiv = NULL;
+    glad_lazy_real_glQueryCounter = NULL;
+    glad_lazy_real_glGetQueryObjecti64v = NULL;
+    glad_lazy_real_glGetQueryObjectui64v = NULL;
+    glad_lazy_real_glVertexAttribDivisor = NULL;
+    glad_lazy_real_glVertexAttribP1ui = NULL;
+    glad_lazy_real_glVertexAttribP1uiv = NULL;
+    glad_lazy_real_glVertexAttribP2ui = NULL;
+    glad_lazy_real_glVertexAttribP2uiv = NULL;
+    glad_lazy_real_glVertexAttribP3ui = NULL;
+    glad_lazy_real_glVertexAttribP3uiv = NULL;
+    glad_lazy_real_glVertexAttribP4ui = NULL;
+    glad_lazy_real_glVertexAttribP4uiv = NULL;
+    glad_lazy_real_glVertexP2ui = NULL;
+    glad_lazy_real_glVertexP2uiv = NULL;
+    glad_lazy_real_glVertexP3ui = NULL;
+    glad_lazy_real_glVertexP3uiv = NULL;
+    glad_lazy_real_glVertexP4ui = NULL;
+    glad_lazy_real_glVertexP4uiv = NULL;
+    glad_lazy_real_glTexCoordP1ui = NULL;
+    glad_lazy_real_glTexCoordP1uiv = NULL;
+    glad_lazy_real_glTexCoordP2ui = NULL;
+    glad_lazy_real_glTexCoordP2uiv = NULL;
+    glad_lazy_real_glTexCoordP3ui = NULL;
+    glad_lazy_real_glTexCoordP3uiv = NULL;
+    glad_lazy_real_glTexCoordP4ui = NULL;
+    glad_lazy_real_glTexCoordP4uiv = NULL;
+    glad_lazy_real_glMultiTexCoordP1ui = NULL;
+    glad_lazy_real_glMultiTexCoordP1uiv = NULL;
+    glad_lazy_real_glMultiTexCoordP2ui = NULL;
+    glad_lazy_real_glMultiTexCoordP2uiv = NULL;
+    glad_lazy_real_glMultiTexCoordP3ui = NULL;
+    glad_lazy_real_glMultiTexCoordP3uiv = NULL;
+    glad_lazy_real_glMultiTexCoordP4ui = NULL;
+    glad_lazy_real_glMultiTexCoordP4uiv = NULL;
+    glad_lazy_real_glNormalP3ui = NULL;
+    glad_lazy_real_glNormalP3uiv = NULL;
+    glad_lazy_real_glColorP3ui = NULL;
+    glad_lazy_real_glColorP3uiv = NULL;
+    glad_lazy_real_glColorP4ui = NULL;
+    glad_lazy_real_glColorP4uiv = NULL;
+    glad_lazy_real_glSecondaryColorP3ui = NULL;
+    glad_lazy_real_glSecondaryColorP3uiv = NULL;
+    glad_lazy_real_glMinSampleShading = NULL;
+    glad_lazy_real_glBlendEquationi = NULL;
+    glad_lazy_real_glBlendEquationSeparatei = NULL;
+    glad_lazy_real_glBlendFunci = NULL;
+    glad_lazy_real_glBlendFuncSeparatei = NULL;
+    glad_lazy_real_glDrawArraysIndirect = NULL;
+    glad_lazy_real_glDrawElementsIndirect = NULL;
+    glad_lazy_real_glUniform1d = NULL;
+    glad_lazy_real_glUniform2d = NULL;
+    glad_lazy_real_glUniform3d = NULL;
+    glad_lazy_real_glUniform4d = NULL;
+    glad_lazy_real_glUniform1dv = NULL;
+    glad_lazy_real_glUniform2dv = NULL;
+    glad_lazy_real_glUniform3dv = NULL;
+    glad_lazy_real_glUniform4dv = NULL;
+    glad_lazy_real_glUniformMatrix2dv = NULL;
+    glad_lazy_real_glUniformMatrix3dv = NULL;
+    glad_lazy_real_glUniformMatrix4dv = NULL;
+    glad_lazy_real_glUniformMatrix2x3dv = NULL;
+    glad_lazy_real_glUniformMatrix2x4dv = NULL;
+    glad_lazy_real_glUniformMatrix3x2dv = NULL;
+    glad_lazy_real_glUniformMatrix3x4dv = NULL;
+    glad_lazy_real_glUniformMatrix4x2dv = NULL;
+    glad_lazy_real_glUniformMatrix4x3dv = NULL;
+    glad_lazy_real_glGetUniformdv = NULL;
+    glad_lazy_real_glGetSubroutineUniformLocation = NULL;
+    glad_lazy_real_glGetSubroutineIndex = NULL;
+    glad_lazy_real_glGetActiveSubroutineUniformiv = NULL;
+    glad_lazy_real_glGetActiveSubroutineUniformName = NULL;
+    glad_lazy_real_glGetActiveSubroutineName = NULL;
+    glad_lazy_real_glUniformSubroutinesuiv = NULL;
+    glad_lazy_real_glGetUniformSubroutineuiv = NULL;
+    glad_lazy_real_glGetProgramStageiv = NULL;
+    glad_lazy_real_glPatchParameteri = NULL;
+    glad_lazy_real_glPatchParameterfv = NULL;
+    glad_lazy_real_glBindTransformFeedback = NULL;
+    glad_lazy_real_glDeleteTransformFeedbacks = NULL;
+    glad_lazy_real_glGenTransformFeedbacks = NULL;
+    glad_lazy_real_glIsTransformFeedback = NULL;
+    glad_lazy_real_glPauseTransformFeedback = NULL;
+    glad_lazy_real_glResumeTransformFeedback = NULL;
+    glad_lazy_real_glDrawTransformFeedback = NULL;
+    glad_lazy_real_glDrawTransformFeedbackStream = NULL;
+    glad_lazy_real_glBeginQueryIndexed = NULL;
+    glad_lazy_real_glEndQueryIndexed = NULL;
+    glad_lazy_real_glGetQueryIndexediv = NULL;
+    glad_lazy_real_glReleaseShaderCompiler = NULL;
+    glad_lazy_real_glShaderBinary = NULL;
+    glad_lazy_real_glGetShaderPrecisionFormat = NULL;
+    glad_lazy_real_glDepthRangef = NULL;
+    glad_lazy_real_glClearDepthf = NULL;
+    glad_lazy_real_glGetProgramBinary = NULL;
+    glad_lazy_real_glProgramBinary = NULL;
+    glad_lazy_real_glProgramParameteri = NULL;
+    glad_lazy_real_glUseProgramStages = NULL;
+    glad_lazy_real_glActiveShaderProgram = NULL;
+    glad_lazy_real_glCreateShaderProgramv = NULL;
+    glad_lazy_real_glBindProgramPipeline = NULL;
+    glad_lazy_real_glDeleteProgramPipelines = NULL;
+    glad_lazy_real_glGenProgramPipelines = NULL;
+    glad_lazy_real_glIsProgramPipeline = NULL;
+    glad_lazy_real_glGetProgramPipelineiv = NULL;
+    glad_lazy_real_glProgramUniform1i = NULL;
+    glad_lazy_real_glProgramUniform1iv = NULL;
+    glad_lazy_real_glProgramUniform1f = NULL;
+    glad_lazy_real_glProgramUniform1fv = NULL;
+    glad_lazy_real_glProgramUniform1d = NULL;
+    glad_lazy_real_glProgramUniform1dv = NULL;
+    glad_lazy_real_glProgramUniform1ui = NULL;
+    glad_lazy_real_glProgramUniform1uiv = NULL;
+    glad_lazy_real_glProgramUniform2i = NULL;
+    glad_lazy_real_glProgramUniform2iv = NULL;
+    glad_lazy_real_glProgramUniform2f = NULL;
+    glad_lazy_real_glProgramUniform2fv = NULL;
+    glad_lazy_real_glProgramUniform2d = NULL;
+    glad_lazy_real_glProgramUniform2dv = NULL;
+    glad_lazy_real_glProgramUniform2ui = NULL;
+    glad_lazy_real_glProgramUniform2uiv = NULL;
+    glad_lazy_real_glProgramUniform3i = NULL;
+    glad_lazy_real_glProgramUniform3iv = NULL;
+    glad_lazy_real_glProgramUniform3f = NULL;
+    glad_lazy_real_glProgramUniform3fv = NULL;
+    glad_lazy_real_glProgramUniform3d = NULL;
+    glad_lazy_real_glProgramUniform3dv = NULL;
+    glad_lazy_real_glProgramUniform3ui = NULL;
+    glad_lazy_real_glProgramUniform3uiv = NULL;
+    glad_lazy_real_glProgramUniform4i = NULL;
+    glad_lazy_real_glProgramUniform4iv = NULL;
+    glad_lazy_real_glProgramUniform4f = NULL;
+    glad_lazy_real_glProgramUniform4fv = NULL;
+    glad_lazy_real_glProgramUniform4d = NULL;
+    glad_lazy_real_glProgramUniform4dv = NULL;
+    glad_lazy_real_glProgramUniform4ui = NULL;
+    glad_lazy_real_glProgramUniform4uiv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2x3fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3x2fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2x4fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4x2fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3x4fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4x3fv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2x3dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3x2dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix2x4dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4x2dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix3x4dv = NULL;
+    glad_lazy_real_glProgramUniformMatrix4x3dv = NULL;
+    glad_lazy_real_glValidateProgramPipeline = NULL;
+    glad_lazy_real_glGetProgramPipelineInfoLog = NULL;
+    glad_lazy_real_glVertexAttribL1d = NULL;
+    glad_lazy_real_glVertexAttribL2d = NULL;
+    glad_lazy_real_glVertexAttribL3d = NULL;
+    glad_lazy_real_glVertexAttribL4d = NULL;
+    glad_lazy_real_glVertexAttribL1dv = NULL;
+    glad_lazy_real_glVertexAttribL2dv = NULL;
+    glad_lazy_real_glVertexAttribL3dv = NULL;
+    glad_lazy_real_glVertexAttribL4dv = NULL;
+    glad_lazy_real_glVertexAttribLPointer = NULL;
+    glad_lazy_real_glGetVertexAttribLdv = NULL;
+    glad_lazy_real_glViewportArrayv = NULL;
+    glad_lazy_real_glViewportIndexedf = NULL;
+    glad_lazy_real_glViewportIndexedfv = NULL;
+    glad_lazy_real_glScissorArrayv = NULL;
+    glad_lazy_real_glScissorIndexed = NULL;
+    glad_lazy_real_glScissorIndexedv = NULL;
+    glad_lazy_real_glDepthRangeArrayv = NULL;
+    glad_lazy_real_glDepthRangeIndexed = NULL;
+    glad_lazy_real_glGetFloati_v = NULL;
+    glad_lazy_real_glGetDoublei_v = NULL;
+    glad_lazy_real_glDrawArraysInstancedBaseInstance = NULL;
+    glad_lazy_real_glDrawElementsInstancedBaseInstance = NULL;
+    glad_lazy_real_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+    glad_lazy_real_glGetInternalformativ = NULL;
+    glad_lazy_real_glGetActiveAtomicCounterBufferiv = NULL;
+    glad_lazy_real_glBindImageTexture = NULL;
+    glad_lazy_real_glMemoryBarrier = NULL;
+    glad_lazy_real_glTexStorage1D = NULL;
+    glad_lazy_real_glTexStorage2D = NULL;
+    glad_lazy_real_glTexStorage3D = NULL;
+    glad_lazy_real_glDrawTransformFeedbackInstanced = NULL;
+    glad_lazy_real_glDrawTransformFeedbackStreamInstanced = NULL;
+    glad_lazy_real_glClearBufferData = NULL;
+    glad_lazy_real_glClearBufferSubData = NULL;
+    glad_lazy_real_glDispatchCompute = NULL;
+    glad_lazy_real_glDispatchComputeIndirect = NULL;
+    glad_lazy_real_glCopyImageSubData = NULL;
+    glad_lazy_real_glFramebufferParameteri = NULL;
+    glad_lazy_real_glGetFramebufferParameteriv = NULL;
+    glad_lazy_real_glGetInternalformati64v = NULL;
+    glad_lazy_real_glInvalidateTexSubImage = NULL;
+    glad_lazy_real_glInvalidateTexImage = NULL;
+    glad_lazy_real_glInvalidateBufferSubData = NULL;
+    glad_lazy_real_glInvalidateBufferData = NULL;
+    glad_lazy_real_glInvalidateFramebuffer = NULL;
+    glad_lazy_real_glInvalidateSubFramebuffer = NULL;
+    glad_lazy_real_glMultiDrawArraysIndirect = NULL;
+    glad_lazy_real_glMultiDrawElementsIndirect = NULL;
+    glad_lazy_real_glGetProgramInterfaceiv = NULL;
+    glad_lazy_real_glGetProgramResourceIndex = NULL;
+    glad_lazy_real_glGetProgramResourceName = NULL;
+    glad_lazy_real_glGetProgramResourceiv = NULL;
+    glad_lazy_real_glGetProgramResourceLocation = NULL;
+    glad_lazy_real_glGetProgramResourceLocationIndex = NULL;
+    glad_lazy_real_glShaderStorageBlockBinding = NULL;
+    glad_lazy_real_glTexBufferRange = NULL;
+    glad_lazy_real_glTexStorage2DMultisample = NULL;
+    glad_lazy_real_glTexStorage3DMultisample = NULL;
+    glad_lazy_real_glTextureView = NULL;
+    glad_lazy_real_glBindVertexBuffer = NULL;
+    glad_lazy_real_glVertexAttribFormat = NULL;
+    glad_lazy_real_glVertexAttribIFormat = NULL;
+    glad_lazy_real_glVertexAttribLFormat = NULL;
+    glad_lazy_real_glVertexAttribBinding = NULL;
+    glad_lazy_real_glVertexBindingDivisor = NULL;
+    glad_lazy_real_glDebugMessageControl = NULL;
+    glad_lazy_real_glDebugMessageInsert = NULL;
+    glad_lazy_real_glDebugMessageCallback = NULL;
+    glad_lazy_real_glGetDebugMessageLog = NULL;
+    glad_lazy_real_glPushDebugGroup = NULL;
+    glad_lazy_real_glPopDebugGroup = NULL;
+    glad_lazy_real_glObjectLabel = NULL;
+    glad_lazy_real_glGetObjectLabel = NULL;
+    glad_lazy_real_glObjectPtrLabel = NULL;
+    glad_lazy_real_glGetObjectPtrLabel = NULL;
+    glad_lazy_real_glBufferStorage = NULL;
+}
+
+/* sorted by name for glad_lazy_stub */
+static const struct glad_lazy_entry glad_lazy_entries[] = {
+    { "glActiveShaderProgram", (void*)glad_lazy_glActiveShaderProgram },
+    { "glActiveTexture", (void*)glad_lazy_glActiveTexture },
+    { "glAttachShader", (void*)glad_lazy_glAttachShader },
+    { "glBeginConditionalRender", (void*)glad_lazy_glBeginConditionalRender },
+    { "glBeginQuery", (void*)glad_lazy_glBeginQuery },
+    { "glBeginQueryIndexed", (void*)glad_lazy_glBeginQueryIndexed },
+    { "glBeginTransformFeedback", (void*)glad_lazy_glBeginTransformFeedback },
+    { "glBindAttribLocation", (void*)glad_lazy_glBindAttribLocation },
+    { "glBindBuffer", (void*)glad_lazy_glBindBuffer },
+    { "glBindBufferBase", (void*)glad_lazy_glBindBufferBase },
+    { "glBindBufferRange", (void*)glad_lazy_glBindBufferRange },
+    { "glBindFragDataLocation", (void*)glad_lazy_glBindFragDataLocation },
+    { "glBindFragDataLocationIndexed", (void*)glad_lazy_glBindFragDataLocationIndexed },
+    { "glBindFramebuffer", (void*)glad_lazy_glBindFramebuffer },
+    { "glBindImageTexture", (void*)glad_lazy_glBindImageTexture },
+    { "glBindProgramPipeline", (void*)glad_lazy_glBindProgramPipeline },
+    { "glBindRenderbuffer", (void*)glad_lazy_glBindRenderbuffer },
+    { "glBindSampler", (void*)glad_lazy_glBindSampler },
+    { "glBindTexture", (void*)glad_lazy_glBindTexture },
+    { "glBindTransformFeedback", (void*)glad_lazy_glBindTransformFeedback },
+    { "glBindVertexArray", (void*)glad_lazy_glBindVertexArray },
+    { "glBindVertexBuffer", (void*)glad_lazy_glBindVertexBuffer },
+    { "glBlendColor", (void*)glad_lazy_glBlendColor },
+    { "glBlendEquation", (void*)glad_lazy_glBlendEquation },
+    { "glBlendEquationSeparate", (void*)glad_lazy_glBlendEquationSeparate },
+    { "glBlendEquationSeparatei", (void*)glad_lazy_glBlendEquationSeparatei },
+    { "glBlendEquationi", (void*)glad_lazy_glBlendEquationi },
+    { "glBlendFunc", (void*)glad_lazy_glBlendFunc },
+    { "glBlendFuncSeparate", (void*)glad_lazy_glBlendFuncSeparate },
+    { "glBlendFuncSeparatei", (void*)glad_lazy_glBlendFuncSeparatei },
+    { "glBlendFunci", (void*)glad_lazy_glBlendFunci },
+    { "glBlitFramebuffer", (void*)glad_lazy_glBlitFramebuffer },
+    { "glBufferData", (void*)glad_lazy_glBufferData },
+    { "glBufferStorage", (void*)glad_lazy_glBufferStorage },
+    { "glBufferSubData", (void*)glad_lazy_glBufferSubData },
+    { "glCheckFramebufferStatus", (void*)glad_lazy_glCheckFramebufferStatus },
+    { "glClampColor", (void*)glad_lazy_glClampColor },
+    { "glClear", (void*)glad_lazy_glClear },
+    { "glClearBufferData", (void*)glad_lazy_glClearBufferData },
+    { "glClearBufferSubData", (void*)glad_lazy_glClearBufferSubData },
+    { "glClearBufferfi", (void*)glad_lazy_glClearBufferfi },
+    { "glClearBufferfv", (void*)glad_lazy_glClearBufferfv },
+    { "glClearBufferiv", (void*)glad_lazy_glClearBufferiv },
+    { "glClearBufferuiv", (void*)glad_lazy_glClearBufferuiv },
+    { "glClearColor", (void*)glad_lazy_glClearColor },
+    { "glClearDepth", (void*)glad_lazy_glClearDepth },
+    { "glClearDepthf", (void*)glad_lazy_glClearDepthf },
+    { "glClearStencil", (void*)glad_lazy_glClearStencil },
+    { "glClientWaitSync", (void*)glad_lazy_glClientWaitSync },
+    { "glColorMask", (void*)glad_lazy_glColorMask },
+    { "glColorMaski", (void*)glad_lazy_glColorMaski },
+    { "glColorP3ui", (void*)glad_lazy_glColorP3ui },
+    { "glColorP3uiv", (void*)glad_lazy_glColorP3uiv },
+    { "glColorP4ui", (void*)glad_lazy_glColorP4ui },
+    { "glColorP4uiv", (void*)glad_lazy_glColorP4uiv },
+    { "glCompileShader", (void*)glad_lazy_glCompileShader },
+    { "glCompressedTexImage1D", (void*)glad_lazy_glCompressedTexImage1D },
+    { "glCompressedTexImage2D", (void*)glad_lazy_glCompressedTexImage2D },
+    { "glCompressedTexImage3D", (void*)glad_lazy_glCompressedTexImage3D },
+    { "glCompressedTexSubImage1D", (void*)glad_lazy_glCompressedTexSubImage1D },
+    { "glCompressedTexSubImage2D", (void*)glad_lazy_glCompressedTexSubImage2D },
+    { "glCompressedTexSubImage3D", (void*)glad_lazy_glCompressedTexSubImage3D },
+    { "glCopyBufferSubData", (void*)glad_lazy_glCopyBufferSubData },
+    { "glCopyImageSubData", (void*)glad_lazy_glCopyImageSubData },
+    { "glCopyTexImage1D", (void*)glad_lazy_glCopyTexImage1D },
+    { "glCopyTexImage2D", (void*)glad_lazy_glCopyTexImage2D },
+    { "glCopyTexSubImage1D", (void*)glad_lazy_glCopyTexSubImage1D },
+    { "glCopyTexSubImage2D", (void*)glad_lazy_glCopyTexSubImage2D },
+    { "glCopyTexSubImage3D", (void*)glad_lazy_glCopyTexSubImage3D },
+    { "glCreateProgram", (void*)glad_lazy_glCreateProgram },
+    { "glCreateShader", (void*)glad_lazy_glCreateShader },
+    { "glCreateShaderProgramv", (void*)glad_lazy_glCreateShaderProgramv },
+    { "glCullFace", (void*)glad_lazy_glCullFace },
+    { "glDebugMessageCallback", (void*)glad_lazy_glDebugMessageCallback },
+    { "glDebugMessageControl", (void*)glad_lazy_glDebugMessageControl },
+    { "glDebugMessageInsert", (void*)glad_lazy_glDebugMessageInsert },
+    { "glDeleteBuffers", (void*)glad_lazy_glDeleteBuffers },
+    { "glDeleteFramebuffers", (void*)glad_lazy_glDeleteFramebuffers },
+    { "glDeleteProgram", (void*)glad_lazy_glDeleteProgram },
+    { "glDeleteProgramPipelines", (void*)glad_lazy_glDeleteProgramPipelines },
+    { "glDeleteQueries", (void*)glad_lazy_glDeleteQueries },
+    { "glDeleteRenderbuffers", (void*)glad_lazy_glDeleteRenderbuffers },
+    { "glDeleteSamplers", (void*)glad_lazy_glDeleteSamplers },
+    { "glDeleteShader", (void*)glad_lazy_glDeleteShader },
+    { "glDeleteSync", (void*)glad_lazy_glDeleteSync },
+    { "glDeleteTextures", (void*)glad_lazy_glDeleteTextures },
+    { "glDeleteTransformFeedbacks", (void*)glad_lazy_glDeleteTransformFeedbacks },
+    { "glDeleteVertexArrays", (void*)glad_lazy_glDeleteVertexArrays },
+    { "glDepthFunc", (void*)glad_lazy_glDepthFunc },
+    { "glDepthMask", (void*)glad_lazy_glDepthMask },
+    { "glDepthRange", (void*)glad_lazy_glDepthRange },
+    { "glDepthRangeArrayv", (void*)glad_lazy_glDepthRangeArrayv },
+    { "glDepthRangeIndexed", (void*)glad_lazy_glDepthRangeIndexed },
+    { "glDepthRangef", (void*)glad_lazy_glDepthRangef },
+    { "glDetachShader", (void*)glad_lazy_glDetachShader },
+    { "glDisable", (void*)glad_lazy_glDisable },
+    { "glDisableVertexAttribArray", (void*)glad_lazy_glDisableVertexAttribArray },
+    { "glDisablei", (void*)glad_lazy_glDisablei },
+    { "glDispatchCompute", (void*)glad_lazy_glDispatchCompute },
+    { "glDispatchComputeIndirect", (void*)glad_lazy_glDispatchComputeIndirect },
+    { "glDrawArrays", (void*)glad_lazy_glDrawArrays },
+    { "glDrawArraysIndirect", (void*)glad_lazy_glDrawArraysIndirect },
+    { "glDrawArraysInstanced", (void*)glad_lazy_glDrawArraysInstanced },
+    { "glDrawArraysInstancedBaseInstance", (void*)glad_lazy_glDrawArraysInstancedBaseInstance },
+    { "glDrawBuffer", (void*)glad_lazy_glDrawBuffer },
+    { "glDrawBuffers", (void*)glad_lazy_glDrawBuffers },
+    { "glDrawElements", (void*)glad_lazy_glDrawElements },
+    { "glDrawElementsBaseVertex", (void*)glad_lazy_glDrawElementsBaseVertex },
+    { "glDrawElementsIndirect", (void*)glad_lazy_glDrawElementsIndirect },
+    { "glDrawElementsInstanced", (void*)glad_lazy_glDrawElementsInstanced },
+    { "glDrawElementsInstancedBaseInstance", (void*)glad_lazy_glDrawElementsInstancedBaseInstance },
+    { "glDrawElementsInstancedBaseVertex", (void*)glad_lazy_glDrawElementsInstancedBaseVertex },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", (void*)glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance },
+    { "glDrawRangeElements", (void*)glad_lazy_glDrawRangeElements },
+    { "glDrawRangeElementsBaseVertex", (void*)glad_lazy_glDrawRangeElementsBaseVertex },
+    { "glDrawTransformFeedback", (void*)glad_lazy_glDrawTransformFeedback },
+    { "glDrawTransformFeedbackInstanced", (void*)glad_lazy_glDrawTransformFeedbackInstanced },
+    { "glDrawTransformFeedbackStream", (void*)glad_lazy_glDrawTransformFeedbackStream },
+    { "glDrawTransformFeedbackStreamInstanced", (void*)glad_lazy_glDrawTransformFeedbackStreamInstanced },
+    { "glEnable", (void*)glad_lazy_glEnable },
+    { "glEnableVertexAttribArray", (void*)glad_lazy_glEnableVertexAttribArray },
+    { "glEnablei", (void*)glad_lazy_glEnablei },
+    { "glEndConditionalRender", (void*)glad_lazy_glEndConditionalRender },
+    { "glEndQuery", (void*)glad_lazy_glEndQuery },
+    { "glEndQueryIndexed", (void*)glad_lazy_glEndQueryIndexed },
+    { "glEndTransformFeedback", (void*)glad_lazy_glEndTransformFeedback },
+    { "glFenceSync", (void*)glad_lazy_glFenceSync },
+    { "glFinish", (void*)glad_lazy_glFinish },
+    { "glFlush", (void*)glad_lazy_glFlush },
+    { "glFlushMappedBufferRange", (void*)glad_lazy_glFlushMappedBufferRange },
+    { "glFramebufferParameteri", (void*)glad_lazy_glFramebufferParameteri },
+    { "glFramebufferRenderbuffer", (void*)glad_lazy_glFramebufferRenderbuffer },
+    { "glFramebufferTexture", (void*)glad_lazy_glFramebufferTexture },
+    { "glFramebufferTexture1D", (void*)glad_lazy_glFramebufferTexture1D },
+    { "glFramebufferTexture2D", (void*)glad_lazy_glFramebufferTexture2D },
+    { "glFramebufferTexture3D", (void*)glad_lazy_glFramebufferTexture3D },
+    { "glFramebufferTextureLayer", (void*)glad_lazy_glFramebufferTextureLayer },
+    { "glFrontFace", (void*)glad_lazy_glFrontFace },
+    { "glGenBuffers", (void*)glad_lazy_glGenBuffers },
+    { "glGenFramebuffers", (void*)glad_lazy_glGenFramebuffers },
+    { "glGenProgramPipelines", (void*)glad_lazy_glGenProgramPipelines },
+    { "glGenQueries", (void*)glad_lazy_glGenQueries },
+    { "glGenRenderbuffers", (void*)glad_lazy_glGenRenderbuffers },
+    { "glGenSamplers", (void*)glad_lazy_glGenSamplers },
+    { "glGenTextures", (void*)glad_lazy_glGenTextures },
+    { "glGenTransformFeedbacks", (void*)glad_lazy_glGenTransformFeedbacks },
+    { "glGenVertexArrays", (void*)glad_lazy_glGenVertexArrays },
+    { "glGenerateMipmap", (void*)glad_lazy_glGenerateMipmap },
+    { "glGetActiveAtomicCounterBufferiv", (void*)glad_lazy_glGetActiveAtomicCounterBufferiv },
+    { "glGetActiveAttrib", (void*)glad_lazy_glGetActiveAttrib },
+    { "glGetActiveSubroutineName", (void*)glad_lazy_glGetActiveSubroutineName },
+    { "glGetActiveSubroutineUniformName", (void*)glad_lazy_glGetActiveSubroutineUniformName },
+    { "glGetActiveSubroutineUniformiv", (void*)glad_lazy_glGetActiveSubroutineUniformiv },
+    { "glGetActiveUniform", (void*)glad_lazy_glGetActiveUniform },
+    { "glGetActiveUniformBlockName", (void*)glad_lazy_glGetActiveUniformBlockName },
+    { "glGetActiveUniformBlockiv", (void*)glad_lazy_glGetActiveUniformBlockiv },
+    { "glGetActiveUniformName", (void*)glad_lazy_glGetActiveUniformName },
+    { "glGetActiveUniformsiv", (void*)glad_lazy_glGetActiveUniformsiv },
+    { "glGetAttachedShaders", (void*)glad_lazy_glGetAttachedShaders },
+    { "glGetAttribLocation", (void*)glad_lazy_glGetAttribLocation },
+    { "glGetBooleani_v", (void*)glad_lazy_glGetBooleani_v },
+    { "glGetBooleanv", (void*)glad_lazy_glGetBooleanv },
+    { "glGetBufferParameteri64v", (void*)glad_lazy_glGetBufferParameteri64v },
+    { "glGetBufferParameteriv", (void*)glad_lazy_glGetBufferParameteriv },
+    { "glGetBufferPointerv", (void*)glad_lazy_glGetBufferPointerv },
+    { "glGetBufferSubData", (void*)glad_lazy_glGetBufferSubData },
+    { "glGetCompressedTexImage", (void*)glad_lazy_glGetCompressedTexImage },
+    { "glGetDebugMessageLog", (void*)glad_lazy_glGetDebugMessageLog },
+    { "glGetDoublei_v", (void*)glad_lazy_glGetDoublei_v },
+    { "glGetDoublev", (void*)glad_lazy_glGetDoublev },
+    { "glGetError", (void*)glad_lazy_glGetError },
+    { "glGetFloati_v", (void*)glad_lazy_glGetFloati_v },
+    { "glGetFloatv", (void*)glad_lazy_glGetFloatv },
+    { "glGetFragDataIndex", (void*)glad_lazy_glGetFragDataIndex },
+    { "glGetFragDataLocation", (void*)glad_lazy_glGetFragDataLocation },
+    { "glGetFramebufferAttachmentParameteriv", (void*)glad_lazy_glGetFramebufferAttachmentParameteriv },
+    { "glGetFramebufferParameteriv", (void*)glad_lazy_glGetFramebufferParameteriv },
+    { "glGetInteger64i_v", (void*)glad_lazy_glGetInteger64i_v },
+    { "glGetInteger64v", (void*)glad_lazy_glGetInteger64v },
+    { "glGetIntegeri_v", (void*)glad_lazy_glGetIntegeri_v },
+    { "glGetIntegerv", (void*)glad_lazy_glGetIntegerv },
+    { "glGetInternalformati64v", (void*)glad_lazy_glGetInternalformati64v },
+    { "glGetInternalformativ", (void*)glad_lazy_glGetInternalformativ },
+    { "glGetMultisamplefv", (void*)glad_lazy_glGetMultisamplefv },
+    { "glGetObjectLabel", (void*)glad_lazy_glGetObjectLabel },
+    { "glGetObjectPtrLabel", (void*)glad_lazy_glGetObjectPtrLabel },
+    { "glGetProgramBinary", (void*)glad_lazy_glGetProgramBinary },
+    { "glGetProgramInfoLog", (void*)glad_lazy_glGetProgramInfoLog },
+    { "glGetProgramInterfaceiv", (void*)glad_lazy_glGetProgramInterfaceiv },
+    { "glGetProgramPipelineInfoLog", (void*)glad_lazy_glGetProgramPipelineInfoLog },
+    { "glGetProgramPipelineiv", (void*)glad_lazy_glGetProgramPipelineiv },
+    { "glGetProgramResourceIndex", (void*)glad_lazy_glGetProgramResourceIndex },
+    { "glGetProgramResourceLocation", (void*)glad_lazy_glGetProgramResourceLocation },
+    { "glGetProgramResourceLocationIndex", (void*)glad_lazy_glGetProgramResourceLocationIndex },
+    { "glGetProgramResourceName", (void*)glad_lazy_glGetProgramResourceName },
+    { "glGetProgramResourceiv", (void*)glad_lazy_glGetProgramResourceiv },
+    { "glGetProgramStageiv", (void*)glad_lazy_glGetProgramStageiv },
+    { "glGetProgramiv", (void*)glad_lazy_glGetProgramiv },
+    { "glGetQueryIndexediv", (void*)glad_lazy_glGetQueryIndexediv },
+    { "glGetQueryObjecti64v", (void*)glad_lazy_glGetQueryObjecti64v },
+    { "glGetQueryObjectiv", (void*)glad_lazy_glGetQueryObjectiv },
+    { "glGetQueryObjectui64v", (void*)glad_lazy_glGetQueryObjectui64v },
+    { "glGetQueryObjectuiv", (void*)glad_lazy_glGetQueryObjectuiv },
+    { "glGetQueryiv", (void*)glad_lazy_glGetQueryiv },
+    { "glGetRenderbufferParameteriv", (void*)glad_lazy_glGetRenderbufferParameteriv },
+    { "glGetSamplerParameterIiv", (void*)glad_lazy_glGetSamplerParameterIiv },
+    { "glGetSamplerParameterIuiv", (void*)glad_lazy_glGetSamplerParameterIuiv },
+    { "glGetSamplerParameterfv", (void*)glad_lazy_glGetSamplerParameterfv },
+    { "glGetSamplerParameteriv", (void*)glad_lazy_glGetSamplerParameteriv },
+    { "glGetShaderInfoLog", (void*)glad_lazy_glGetShaderInfoLog },
+    { "glGetShaderPrecisionFormat", (void*)glad_lazy_glGetShaderPrecisionFormat },
+    { "glGetShaderSource", (void*)glad_lazy_glGetShaderSource },
+    { "glGetShaderiv", (void*)glad_lazy_glGetShaderiv },
+    { "glGetString", (void*)glad_lazy_glGetString },
+    { "glGetStringi", (void*)glad_lazy_glGetStringi },
+    { "glGetSubroutineIndex", (void*)glad_lazy_glGetSubroutineIndex },
+    { "glGetSubroutineUniformLocation", (void*)glad_lazy_glGetSubroutineUniformLocation },
+    { "glGetSynciv", (void*)glad_lazy_glGetSynciv },
+    { "glGetTexImage", (void*)glad_lazy_glGetTexImage },
+    { "glGetTexLevelParameterfv", (void*)glad_lazy_glGetTexLevelParameterfv },
+    { "glGetTexLevelParameteriv", (void*)glad_lazy_glGetTexLevelParameteriv },
+    { "glGetTexParameterIiv", (void*)glad_lazy_glGetTexParameterIiv },
+    { "glGetTexParameterIuiv", (void*)glad_lazy_glGetTexParameterIuiv },
+    { "glGetTexParameterfv", (void*)glad_lazy_glGetTexParameterfv },
+    { "glGetTexParameteriv", (void*)glad_lazy_glGetTexParameteriv },
+    { "glGetTransformFeedbackVarying", (void*)glad_lazy_glGetTransformFeedbackVarying },
+    { "glGetUniformBlockIndex", (void*)glad_lazy_glGetUniformBlockIndex },
+    { "glGetUniformIndices", (void*)glad_lazy_glGetUniformIndices },
+    { "glGetUniformLocation", (void*)glad_lazy_glGetUniformLocation },
+    { "glGetUniformSubroutineuiv", (void*)glad_lazy_glGetUniformSubroutineuiv },
+    { "glGetUniformdv", (void*)glad_lazy_glGetUniformdv },
+    { "glGetUniformfv", (void*)glad_lazy_glGetUniformfv },
+    { "glGetUniformiv", (void*)glad_lazy_glGetUniformiv },
+    { "glGetUniformuiv", (void*)glad_lazy_glGetUniformuiv },
+    { "glGetVertexAttribIiv", (void*)glad_lazy_glGetVertexAttribIiv },
+    { "glGetVertexAttribIuiv", (void*)glad_lazy_glGetVertexAttribIuiv },
+    { "glGetVertexAttribLdv", (void*)glad_lazy_glGetVertexAttribLdv },
+    { "glGetVertexAttribPointerv", (void*)glad_lazy_glGetVertexAttribPointerv },
+    { "glGetVertexAttribdv", (void*)glad_lazy_glGetVertexAttribdv },
+    { "glGetVertexAttribfv", (void*)glad_lazy_glGetVertexAttribfv },
+    { "glGetVertexAttribiv", (void*)glad_lazy_glGetVertexAttribiv },
+    { "glHint", (void*)glad_lazy_glHint },
+    { "glInvalidateBufferData", (void*)glad_lazy_glInvalidateBufferData },
+    { "glInvalidateBufferSubData", (void*)glad_lazy_glInvalidateBufferSubData },
+    { "glInvalidateFramebuffer", (void*)glad_lazy_glInvalidateFramebuffer },
+    { "glInvalidateSubFramebuffer", (void*)glad_lazy_glInvalidateSubFramebuffer },
+    { "glInvalidateTexImage", (void*)glad_lazy_glInvalidateTexImage },
+    { "glInvalidateTexSubImage", (void*)glad_lazy_glInvalidateTexSubImage },
+    { "glIsBuffer", (void*)glad_lazy_glIsBuffer },
+    { "glIsEnabled", (void*)glad_lazy_glIsEnabled },
+    { "glIsEnabledi", (void*)glad_lazy_glIsEnabledi },
+    { "glIsFramebuffer", (void*)glad_lazy_glIsFramebuffer },
+    { "glIsProgram", (void*)glad_lazy_glIsProgram },
+    { "glIsProgramPipeline", (void*)glad_lazy_glIsProgramPipeline },
+    { "glIsQuery", (void*)glad_lazy_glIsQuery },
+    { "glIsRenderbuffer", (void*)glad_lazy_glIsRenderbuffer },
+    { "glIsSampler", (void*)glad_lazy_glIsSampler },
+    { "glIsShader", (void*)glad_lazy_glIsShader },
+    { "glIsSync", (void*)glad_lazy_glIsSync },
+    { "glIsTexture", (void*)glad_lazy_glIsTexture },
+    { "glIsTransformFeedback", (void*)glad_lazy_glIsTransformFeedback },
+    { "glIsVertexArray", (void*)glad_lazy_glIsVertexArray },
+    { "glLineWidth", (void*)glad_lazy_glLineWidth },
+    { "glLinkProgram", (void*)glad_lazy_glLinkProgram },
+    { "glLogicOp", (void*)glad_lazy_glLogicOp },
+    { "glMapBuffer", (void*)glad_lazy_glMapBuffer },
+    { "glMapBufferRange", (void*)glad_lazy_glMapBufferRange },
+    { "glMemoryBarrier", (void*)glad_lazy_glMemoryBarrier },
+    { "glMinSampleShading", (void*)glad_lazy_glMinSampleShading },
+    { "glMultiDrawArrays", (void*)glad_lazy_glMultiDrawArrays },
+    { "glMultiDrawArraysIndirect", (void*)glad_lazy_glMultiDrawArraysIndirect },
+    { "glMultiDrawElements", (void*)glad_lazy_glMultiDrawElements },
+    { "glMultiDrawElementsBaseVertex", (void*)glad_lazy_glMultiDrawElementsBaseVertex },
+    { "glMultiDrawElementsIndirect", (void*)glad_lazy_glMultiDrawElementsIndirect },
+    { "glMultiTexCoordP1ui", (void*)glad_lazy_glMultiTexCoordP1ui },
+    { "glMultiTexCoordP1uiv", (void*)glad_lazy_glMultiTexCoordP1uiv },
+    { "glMultiTexCoordP2ui", (void*)glad_lazy_glMultiTexCoordP2ui },
+    { "glMultiTexCoordP2uiv", (void*)glad_lazy_glMultiTexCoordP2uiv },
+    { "glMultiTexCoordP3ui", (void*)glad_lazy_glMultiTexCoordP3ui },
+    { "glMultiTexCoordP3uiv", (void*)glad_lazy_glMultiTexCoordP3uiv },
+    { "glMultiTexCoordP4ui", (void*)glad_lazy_glMultiTexCoordP4ui },
+    { "glMultiTexCoordP4uiv", (void*)glad_lazy_glMultiTexCoordP4uiv },
+    { "glNormalP3ui", (void*)glad_lazy_glNormalP3ui },
+    { "glNormalP3uiv", (void*)glad_lazy_glNormalP3uiv },
+    { "glObjectLabel", (void*)glad_lazy_glObjectLabel },
+    { "glObjectPtrLabel", (void*)glad_lazy_glObjectPtrLabel },
+    { "glPatchParameterfv", (void*)glad_lazy_glPatchParameterfv },
+    { "glPatchParameteri", (void*)glad_lazy_glPatchParameteri },
+    { "glPauseTransformFeedback", (void*)glad_lazy_glPauseTransformFeedback },
+    { "glPixelStoref", (void*)glad_lazy_glPixelStoref },
+    { "glPixelStorei", (void*)glad_lazy_glPixelStorei },
+    { "glPointParameterf", (void*)glad_lazy_glPointParameterf },
+    { "glPointParameterfv", (void*)glad_lazy_glPointParameterfv },
+    { "glPointParameteri", (void*)glad_lazy_glPointParameteri },
+    { "glPointParameteriv", (void*)glad_lazy_glPointParameteriv },
+    { "glPointSize", (void*)glad_lazy_glPointSize },
+    { "glPolygonMode", (void*)glad_lazy_glPolygonMode },
+    { "glPolygonOffset", (void*)glad_lazy_glPolygonOffset },
+    { "glPopDebugGroup", (void*)glad_lazy_glPopDebugGroup },
+    { "glPrimitiveRestartIndex", (void*)glad_lazy_glPrimitiveRestartIndex },
+    { "glProgramBinary", (void*)glad_lazy_glProgramBinary },
+    { "glProgramParameteri", (void*)glad_lazy_glProgramParameteri },
+    { "glProgramUniform1d", (void*)glad_lazy_glProgramUniform1d },
+    { "glProgramUniform1dv", (void*)glad_lazy_glProgramUniform1dv },
+    { "glProgramUniform1f", (void*)glad_lazy_glProgramUniform1f },
+    { "glProgramUniform1fv", (void*)glad_lazy_glProgramUniform1fv },
+    { "glProgramUniform1i", (void*)glad_lazy_glProgramUniform1i },
+    { "glProgramUniform1iv", (void*)glad_lazy_glProgramUniform1iv },
+    { "glProgramUniform1ui", (void*)glad_lazy_glProgramUniform1ui },
+    { "glProgramUniform1uiv", (void*)glad_lazy_glProgramUniform1uiv },
+    { "glProgramUniform2d", (void*)glad_lazy_glProgramUniform2d },
+    { "glProgramUniform2dv", (void*)glad_lazy_glProgramUniform2dv },
+    { "glProgramUniform2f", (void*)glad_lazy_glProgramUniform2f },
+    { "glProgramUniform2fv", (void*)glad_lazy_glProgramUniform2fv },
+    { "glProgramUniform2i", (void*)glad_lazy_glProgramUniform2i },
+    { "glProgramUniform2iv", (void*)glad_lazy_glProgramUniform2iv },
+    { "glProgramUniform2ui", (void*)glad_lazy_glProgramUniform2ui },
+    { "glProgramUniform2uiv", (void*)glad_lazy_glProgramUniform2uiv },
+    { "glProgramUniform3d", (void*)glad_lazy_glProgramUniform3d },
+    { "glProgramUniform3dv", (void*)glad_lazy_glProgramUniform3dv },
+    { "glProgramUniform3f", (void*)glad_lazy_glProgramUniform3f },
+    { "glProgramUniform3fv", (void*)glad_lazy_glProgramUniform3fv },
+    { "glProgramUniform3i", (void*)glad_lazy_glProgramUniform3i },
+    { "glProgramUniform3iv", (void*)glad_lazy_glProgramUniform3iv },
+    { "glProgramUniform3ui", (void*)glad_lazy_glProgramUniform3ui },
+    { "glProgramUniform3uiv", (void*)glad_lazy_glProgramUniform3uiv },
+    { "glProgramUniform4d", (void*)glad_lazy_glProgramUniform4d },
+    { "glProgramUniform4dv", (void*)glad_lazy_glProgramUniform4dv },
+    { "glProgramUniform4f", (void*)glad_lazy_glProgramUniform4f },
+    { "glProgramUniform4fv", (void*)glad_lazy_glProgramUniform4fv },
+    { "glProgramUniform4i", (void*)glad_lazy_glProgramUniform4i },
+    { "glProgramUniform4iv", (void*)glad_lazy_glProgramUniform4iv },
+    { "glProgramUniform4ui", (void*)glad_lazy_glProgramUniform4ui },
+    { "glProgramUniform4uiv", (void*)glad_lazy_glProgramUniform4uiv },
+    { "glProgramUniformMatrix2dv", (void*)glad_lazy_glProgramUniformMatrix2dv },
+    { "glProgramUniformMatrix2fv", (void*)glad_lazy_glProgramUniformMatrix2fv },
+    { "glProgramUniformMatrix2x3dv", (void*)glad_lazy_glProgramUniformMatrix2x3dv },
+    { "glProgramUniformMatrix2x3fv", (void*)glad_lazy_glProgramUniformMatrix2x3fv },
+    { "glProgramUniformMatrix2x4dv", (void*)glad_lazy_glProgramUniformMatrix2x4dv },
+    { "glProgramUniformMatrix2x4fv", (void*)glad_lazy_glProgramUniformMatrix2x4fv },
+    { "glProgramUniformMatrix3dv", (void*)glad_lazy_glProgramUniformMatrix3dv },
+    { "glProgramUniformMatrix3fv", (void*)glad_lazy_glProgramUniformMatrix3fv },
+    { "glProgramUniformMatrix3x2dv", (void*)glad_lazy_glProgramUniformMatrix3x2dv },
+    { "glProgramUniformMatrix3x2fv", (void*)glad_lazy_glProgramUniformMatrix3x2fv },
+    { "glProgramUniformMatrix3x4dv", (void*)glad_lazy_glProgramUniformMatrix3x4dv },
+    { "glProgramUniformMatrix3x4fv", (void*)glad_lazy_glProgramUniformMatrix3x4fv },
+    { "glProgramUniformMatrix4dv", (void*)glad_lazy_glProgramUniformMatrix4dv },
+    { "glProgramUniformMatrix4fv", (void*)glad_lazy_glProgramUniformMatrix4fv },
+    { "glProgramUniformMatrix4x2dv", (void*)glad_lazy_glProgramUniformMatrix4x2dv },
+    { "glProgramUniformMatrix4x2fv", (void*)glad_lazy_glProgramUniformMatrix4x2fv },
+    { "glProgramUniformMatrix4x3dv", (void*)glad_lazy_glProgramUniformMatrix4x3dv },
+    { "glProgramUniformMatrix4x3fv", (void*)glad_lazy_glProgramUniformMatrix4x3fv },
+    { "glProvokingVertex", (void*)glad_lazy_glProvokingVertex },
+    { "glPushDebugGroup", (void*)glad_lazy_glPushDebugGroup },
+    { "glQueryCounter", (void*)glad_lazy_glQueryCounter },
+    { "glReadBuffer", (void*)glad_lazy_glReadBuffer },
+    { "glReadPixels", (void*)glad_lazy_glReadPixels },
+    { "glReleaseShaderCompiler", (void*)glad_lazy_glReleaseShaderCompiler },
+    { "glRenderbufferStorage", (void*)glad_lazy_glRenderbufferStorage },
+    { "glRenderbufferStorageMultisample", (void*)glad_lazy_glRenderbufferStorageMultisample },
+    { "glResumeTransformFeedback", (void*)glad_lazy_glResumeTransformFeedback },
+    { "glSampleCoverage", (void*)glad_lazy_glSampleCoverage },
+    { "glSampleMaski", (void*)glad_lazy_glSampleMaski },
+    { "glSamplerParameterIiv", (void*)glad_lazy_glSamplerParameterIiv },
+    { "glSamplerParameterIuiv", (void*)glad_lazy_glSamplerParameterIuiv },
+    { "glSamplerParameterf", (void*)glad_lazy_glSamplerParameterf },
+    { "glSamplerParameterfv", (void*)glad_lazy_glSamplerParameterfv },
+    { "glSamplerParameteri", (void*)glad_lazy_glSamplerParameteri },
+    { "glSamplerParameteriv", (void*)glad_lazy_glSamplerParameteriv },
+    { "glScissor", (void*)glad_lazy_glScissor },
+    { "glScissorArrayv", (void*)glad_lazy_glScissorArrayv },
+    { "glScissorIndexed", (void*)glad_lazy_glScissorIndexed },
+    { "glScissorIndexedv", (void*)glad_lazy_glScissorIndexedv },
+    { "glSecondaryColorP3ui", (void*)glad_lazy_glSecondaryColorP3ui },
+    { "glSecondaryColorP3uiv", (void*)glad_lazy_glSecondaryColorP3uiv },
+    { "glShaderBinary", (void*)glad_lazy_glShaderBinary },
+    { "glShaderSource", (void*)glad_lazy_glShaderSource },
+    { "glShaderStorageBlockBinding", (void*)glad_lazy_glShaderStorageBlockBinding },
+    { "glStencilFunc", (void*)glad_lazy_glStencilFunc },
+    { "glStencilFuncSeparate", (void*)glad_lazy_glStencilFuncSeparate },
+    { "glStencilMask", (void*)glad_lazy_glStencilMask },
+    { "glStencilMaskSeparate", (void*)glad_lazy_glStencilMaskSeparate },
+    { "glStencilOp", (void*)glad_lazy_glStencilOp },
+    { "glStencilOpSeparate", (void*)glad_lazy_glStencilOpSeparate },
+    { "glTexBuffer", (void*)glad_lazy_glTexBuffer },
+    { "glTexBufferRange", (void*)glad_lazy_glTexBufferRange },
+    { "glTexCoordP1ui", (void*)glad_lazy_glTexCoordP1ui },
+    { "glTexCoordP1uiv", (void*)glad_lazy_glTexCoordP1uiv },
+    { "glTexCoordP2ui", (void*)glad_lazy_glTexCoordP2ui },
+    { "glTexCoordP2uiv", (void*)glad_lazy_glTexCoordP2uiv },
+    { "glTexCoordP3ui", (void*)glad_lazy_glTexCoordP3ui },
+    { "glTexCoordP3uiv", (void*)glad_lazy_glTexCoordP3uiv },
+    { "glTexCoordP4ui", (void*)glad_lazy_glTexCoordP4ui },
+    { "glTexCoordP4uiv", (void*)glad_lazy_glTexCoordP4uiv },
+    { "glTexImage1D", (void*)glad_lazy_glTexImage1D },
+    { "glTexImage2D", (void*)glad_lazy_glTexImage2D },
+    { "glTexImage2DMultisample", (void*)glad_lazy_glTexImage2DMultisample },
+    { "glTexImage3D", (void*)glad_lazy_glTexImage3D },
+    { "glTexImage3DMultisample", (void*)glad_lazy_glTexImage3DMultisample },
+    { "glTexParameterIiv", (void*)glad_lazy_glTexParameterIiv },
+    { "glTexParameterIuiv", (void*)glad_lazy_glTexParameterIuiv },
+    { "glTexParameterf", (void*)glad_lazy_glTexParameterf },
+    { "glTexParameterfv", (void*)glad_lazy_glTexParameterfv },
+    { "glTexParameteri", (void*)glad_lazy_glTexParameteri },
+    { "glTexParameteriv", (void*)glad_lazy_glTexParameteriv },
+    { "glTexStorage1D", (void*)glad_lazy_glTexStorage1D },
+    { "glTexStorage2D", (void*)glad_lazy_glTexStorage2D },
+    { "glTexStorage2DMultisample", (void*)glad_lazy_glTexStorage2DMultisample },
+    { "glTexStorage3D", (void*)glad_lazy_glTexStorage3D },
+    { "glTexStorage3DMultisample", (void*)glad_lazy_glTexStorage3DMultisample },
+    { "glTexSubImage1D", (void*)glad_lazy_glTexSubImage1D },
+    { "glTexSubImage2D", (void*)glad_lazy_glTexSubImage2D },
+    { "glTexSubImage3D", (void*)glad_lazy_glTexSubImage3D },
+    { "glTextureView", (void*)glad_lazy_glTextureView },
+    { "glTransformFeedbackVaryings", (void*)glad_lazy_glTransformFeedbackVaryings },
+    { "glUniform1d", (void*)glad_lazy_glUniform1d },
+    { "glUniform1dv", (void*)glad_lazy_glUniform1dv },
+    { "glUniform1f", (void*)glad_lazy_glUniform1f },
+    { "glUniform1fv", (void*)glad_lazy_glUniform1fv },
+    { "glUniform1i", (void*)glad_lazy_glUniform1i },
+    { "glUniform1iv", (void*)glad_lazy_glUniform1iv },
+    { "glUniform1ui", (void*)glad_lazy_glUniform1ui },
+    { "glUniform1uiv", (void*)glad_lazy_glUniform1uiv },
+    { "glUniform2d", (void*)glad_lazy_glUniform2d },
+    { "glUniform2dv", (void*)glad_lazy_glUniform2dv },
+    { "glUniform2f", (void*)glad_lazy_glUniform2f },
+    { "glUniform2fv", (void*)glad_lazy_glUniform2fv },
+    { "glUniform2i", (void*)glad_lazy_glUniform2i },
+    { "glUniform2iv", (void*)glad_lazy_glUniform2iv },
+    { "glUniform2ui", (void*)glad_lazy_glUniform2ui },
+    { "glUniform2uiv", (void*)glad_lazy_glUniform2uiv },
+    { "glUniform3d", (void*)glad_lazy_glUniform3d },
+    { "glUniform3dv", (void*)glad_lazy_glUniform3dv },
+    { "glUniform3f", (void*)glad_lazy_glUniform3f },
+    { "glUniform3fv", (void*)glad_lazy_glUniform3fv },
+    { "glUniform3i", (void*)glad_lazy_glUniform3i },
+    { "glUniform3iv", (void*)glad_lazy_glUniform3iv },
+    { "glUniform3ui", (void*)glad_lazy_glUniform3ui },
+    { "glUniform3uiv", (void*)glad_lazy_glUniform3uiv },
+    { "glUniform4d", (void*)glad_lazy_glUniform4d },
+    { "glUniform4dv", (void*)glad_lazy_glUniform4dv },
+    { "glUniform4f", (void*)glad_lazy_glUniform4f },
+    { "glUniform4fv", (void*)glad_lazy_glUniform4fv },
+    { "glUniform4i", (void*)glad_lazy_glUniform4i },
+    { "glUniform4iv", (void*)glad_lazy_glUniform4iv },
+    { "glUniform4ui", (void*)glad_lazy_glUniform4ui },
+    { "glUniform4uiv", (void*)glad_lazy_glUniform4uiv },
+    { "glUniformBlockBinding", (void*)glad_lazy_glUniformBlockBinding },
+    { "glUniformMatrix2dv", (void*)glad_lazy_glUniformMatrix2dv },
+    { "glUniformMatrix2fv", (void*)glad_lazy_glUniformMatrix2fv },
+    { "glUniformMatrix2x3dv", (void*)glad_lazy_glUniformMatrix2x3dv },
+    { "glUniformMatrix2x3fv", (void*)glad_lazy_glUniformMatrix2x3fv },
+    { "glUniformMatrix2x4dv", (void*)glad_lazy_glUniformMatrix2x4dv },
+    { "glUniformMatrix2x4fv", (void*)glad_lazy_glUniformMatrix2x4fv },
+    { "glUniformMatrix3dv", (void*)glad_lazy_glUniformMatrix3dv },
+    { "glUniformMatrix3fv", (void*)glad_lazy_glUniformMatrix3fv },
+    { "glUniformMatrix3x2dv", (void*)glad_lazy_glUniformMatrix3x2dv },
+    { "glUniformMatrix3x2fv", (void*)glad_lazy_glUniformMatrix3x2fv },
+    { "glUniformMatrix3x4dv", (void*)glad_lazy_glUniformMatrix3x4dv },
+    { "glUniformMatrix3x4fv", (void*)glad_lazy_glUniformMatrix3x4fv },
+    { "glUniformMatrix4dv", (void*)glad_lazy_glUniformMatrix4dv },
+    { "glUniformMatrix4fv", (void*)glad_lazy_glUniformMatrix4fv },
+    { "glUniformMatrix4x2dv", (void*)glad_lazy_glUniformMatrix4x2dv },
+    { "glUniformMatrix4x2fv", (void*)glad_lazy_glUniformMatrix4x2fv },
+    { "glUniformMatrix4x3dv", (void*)glad_lazy_glUniformMatrix4x3dv },
+    { "glUniformMatrix4x3fv", (void*)glad_lazy_glUniformMatrix4x3fv },
+    { "glUniformSubroutinesuiv", (void*)glad_lazy_glUniformSubroutinesuiv },
+    { "glUnmapBuffer", (void*)glad_lazy_glUnmapBuffer },
+    { "glUseProgram", (void*)glad_lazy_glUseProgram },
+    { "glUseProgramStages", (void*)glad_lazy_glUseProgramStages },
+    { "glValidateProgram", (void*)glad_lazy_glValidateProgram },
+    { "glValidateProgramPipeline", (void*)glad_lazy_glValidateProgramPipeline },
+    { "glVertexAttrib1d", (void*)glad_lazy_glVertexAttrib1d },
+    { "glVertexAttrib1dv", (void*)glad_lazy_glVertexAttrib1dv },
+    { "glVertexAttrib1f", (void*)glad_lazy_glVertexAttrib1f },
+    { "glVertexAttrib1fv", (void*)glad_lazy_glVertexAttrib1fv },
+    { "glVertexAttrib1s", (void*)glad_lazy_glVertexAttrib1s },
+    { "glVertexAttrib1sv", (void*)glad_lazy_glVertexAttrib1sv },
+    { "glVertexAttrib2d", (void*)glad_lazy_glVertexAttrib2d },
+    { "glVertexAttrib2dv", (void*)glad_lazy_glVertexAttrib2dv },
+    { "glVertexAttrib2f", (void*)glad_lazy_glVertexAttrib2f },
+    { "glVertexAttrib2fv", (void*)glad_lazy_glVertexAttrib2fv },
+    { "glVertexAttrib2s", (void*)glad_lazy_glVertexAttrib2s },
+    { "glVertexAttrib2sv", (void*)glad_lazy_glVertexAttrib2sv },
+    { "glVertexAttrib3d", (void*)glad_lazy_glVertexAttrib3d },
+    { "glVertexAttrib3dv", (void*)glad_lazy_glVertexAttrib3dv },
+    { "glVertexAttrib3f", (void*)glad_lazy_glVertexAttrib3f },
+    { "glVertexAttrib3fv", (void*)glad_lazy_glVertexAttrib3fv },
+    { "glVertexAttrib3s", (void*)glad_lazy_glVertexAttrib3s },
+    { "glVertexAttrib3sv", (void*)glad_lazy_glVertexAttrib3sv },
+    { "glVertexAttrib4Nbv", (void*)glad_lazy_glVertexAttrib4Nbv },
+    { "glVertexAttrib4Niv", (void*)glad_lazy_glVertexAttrib4Niv },
+    { "glVertexAttrib4Nsv", (void*)glad_lazy_glVertexAttrib4Nsv },
+    { "glVertexAttrib4Nub", (void*)glad_lazy_glVertexAttrib4Nub },
+    { "glVertexAttrib4Nubv", (void*)glad_lazy_glVertexAttrib4Nubv },
+    { "glVertexAttrib4Nuiv", (void*)glad_lazy_glVertexAttrib4Nuiv },
+    { "glVertexAttrib4Nusv", (void*)glad_lazy_glVertexAttrib4Nusv },
+    { "glVertexAttrib4bv", (void*)glad_lazy_glVertexAttrib4bv },
+    { "glVertexAttrib4d", (void*)glad_lazy_glVertexAttrib4d },
+    { "glVertexAttrib4dv", (void*)glad_lazy_glVertexAttrib4dv },
+    { "glVertexAttrib4f", (void*)glad_lazy_glVertexAttrib4f },
+    { "glVertexAttrib4fv", (void*)glad_lazy_glVertexAttrib4fv },
+    { "glVertexAttrib4iv", (void*)glad_lazy_glVertexAttrib4iv },
+    { "glVertexAttrib4s", (void*)glad_lazy_glVertexAttrib4s },
+    { "glVertexAttrib4sv", (void*)glad_lazy_glVertexAttrib4sv },
+    { "glVertexAttrib4ubv", (void*)glad_lazy_glVertexAttrib4ubv },
+    { "glVertexAttrib4uiv", (void*)glad_lazy_glVertexAttrib4uiv },
+    { "glVertexAttrib4usv", (void*)glad_lazy_glVertexAttrib4usv },
+    { "glVertexAttribBinding", (void*)glad_lazy_glVertexAttribBinding },
+    { "glVertexAttribDivisor", (void*)glad_lazy_glVertexAttribDivisor },
+    { "glVertexAttribFormat", (void*)glad_lazy_glVertexAttribFormat },
+    { "glVertexAttribI1i", (void*)glad_lazy_glVertexAttribI1i },
+    { "glVertexAttribI1iv", (void*)glad_lazy_glVertexAttribI1iv },
+    { "glVertexAttribI1ui", (void*)glad_lazy_glVertexAttribI1ui },
+    { "glVertexAttribI1uiv", (void*)glad_lazy_glVertexAttribI1uiv },
+    { "glVertexAttribI2i", (void*)glad_lazy_glVertexAttribI2i },
+    { "glVertexAttribI2iv", (void*)glad_lazy_glVertexAttribI2iv },
+    { "glVertexAttribI2ui", (void*)glad_lazy_glVertexAttribI2ui },
+    { "glVertexAttribI2uiv", (void*)glad_lazy_glVertexAttribI2uiv },
+    { "glVertexAttribI3i", (void*)glad_lazy_glVertexAttribI3i },
+    { "glVertexAttribI3iv", (void*)glad_lazy_glVertexAttribI3iv },
+    { "glVertexAttribI3ui", (void*)glad_lazy_glVertexAttribI3ui },
+    { "glVertexAttribI3uiv", (void*)glad_lazy_glVertexAttribI3uiv },
+    { "glVertexAttribI4bv", (void*)glad_lazy_glVertexAttribI4bv },
+    { "glVertexAttribI4i", (void*)glad_lazy_glVertexAttribI4i },
+    { "glVertexAttribI4iv", (void*)glad_lazy_glVertexAttribI4iv },
+    { "glVertexAttribI4sv", (void*)glad_lazy_glVertexAttribI4sv },
+    { "glVertexAttribI4ubv", (void*)glad_lazy_glVertexAttribI4ubv },
+    { "glVertexAttribI4ui", (void*)glad_lazy_glVertexAttribI4ui },
+    { "glVertexAttribI4uiv", (void*)glad_lazy_glVertexAttribI4uiv },
+    { "glVertexAttribI4usv", (void*)glad_lazy_glVertexAttribI4usv },
+    { "glVertexAttribIFormat", (void*)glad_lazy_glVertexAttribIFormat },
+    { "glVertexAttribIPointer", (void*)glad_lazy_glVertexAttribIPointer },
+    { "glVertexAttribL1d", (void*)glad_lazy_glVertexAttribL1d },
+    { "glVertexAttribL1dv", (void*)glad_lazy_glVertexAttribL1dv },
+    { "glVertexAttribL2d", (void*)glad_lazy_glVertexAttribL2d },
+    { "glVertexAttribL2dv", (void*)glad_lazy_glVertexAttribL2dv },
+    { "glVertexAttribL3d", (void*)glad_lazy_glVertexAttribL3d },
+    { "glVertexAttribL3dv", (void*)glad_lazy_glVertexAttribL3dv },
+    { "glVertexAttribL4d", (void*)glad_lazy_glVertexAttribL4d },
+    { "glVertexAttribL4dv", (void*)glad_lazy_glVertexAttribL4dv },
+    { "glVertexAttribLFormat", (void*)glad_lazy_glVertexAttribLFormat },
+    { "glVertexAttribLPointer", (void*)glad_lazy_glVertexAttribLPointer },
+    { "glVertexAttribP1ui", (void*)glad_lazy_glVertexAttribP1ui },
+    { "glVertexAttribP1uiv", (void*)glad_lazy_glVertexAttribP1uiv },
+    { "glVertexAttribP2ui", (void*)glad_lazy_glVertexAttribP2ui },
+    { "glVertexAttribP2uiv", (void*)glad_lazy_glVertexAttribP2uiv },
+    { "glVertexAttribP3ui", (void*)glad_lazy_glVertexAttribP3ui },
+    { "glVertexAttribP3uiv", (void*)glad_lazy_glVertexAttribP3uiv },
+    { "glVertexAttribP4ui", (void*)glad_lazy_glVertexAttribP4ui },
+    { "glVertexAttribP4uiv", (void*)glad_lazy_glVertexAttribP4uiv },
+    { "glVertexAttribPointer", (void*)glad_lazy_glVertexAttribPointer },
+    { "glVertexBindingDivisor", (void*)glad_lazy_glVertexBindingDivisor },
+    { "glVertexP2ui", (void*)glad_lazy_glVertexP2ui },
+    { "glVertexP2uiv", (void*)glad_lazy_glVertexP2uiv },
+    { "glVertexP3ui", (void*)glad_lazy_glVertexP3ui },
+    { "glVertexP3uiv", (void*)glad_lazy_glVertexP3uiv },
+    { "glVertexP4ui", (void*)glad_lazy_glVertexP4ui },
+    { "glVertexP4uiv", (void*)glad_lazy_glVertexP4uiv },
+    { "glViewport", (void*)glad_lazy_glViewport },
+    { "glViewportArrayv", (void*)glad_lazy_glViewportArrayv },
+    { "glViewportIndexedf", (void*)glad_lazy_glViewportIndexedf },
+    { "glViewportIndexedfv", (void*)glad_lazy_glViewportIndexedfv },
+    { "glWaitSync", (void*)glad_lazy_glWaitSync },
+};
+
+#define GLAD_EXT_HASH_SIZE 2
+static const unsigned int glad_ext_seed = 0u;
+static const char *glad_ext_names[GLAD_EXT_HASH_SIZE] = {
+    "GL_ARB_multi_draw_indirect",
+    "GL_ARB_buffer_storage",
+};
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+# Generates the per entry point code of the optional loader builds from the
+# typedefs and extension flags in glad.h. Run it again whenever glad.h is
+# regenerated:
+#
+#     python3 wrappers.py
+#
+# src/glad_instrument_gen.h (GLAD_INSTRUMENT): every entry point gets a
+# wrapper that counts and times the call. A few entry points also call a
+# hook from src/glad_instrument.c that tells if the call doesn't change the
+# GL state.
+#
+# src/glad_lazy_gen.h (GLAD_LAZY_LOAD): every entry point gets a stub that
+# resolves it on its first call, and the extensions glad knows about get a
+# perfect hash table, see src/glad_lazy.c.
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+HEADER = os.path.join(HERE, 'include', 'glad', 'glad.h')
+INSTRUMENT_OUTPUT = os.path.join(HERE, 'src', 'glad_instrument_gen.h')
+LAZY_OUTPUT = os.path.join(HERE, 'src', 'glad_lazy_gen.h')
+
+TYPEDEF = re.compile(r'^typedef (.+?) \(APIENTRYP (PFN\w+PROC)\)\((.*)\);$')
+POINTER = re.compile(r'^GLAPI (PFN\w+PROC) glad_(\w+);$')
+EXTENSION = re.compile(r'^GLAPI int GLAD_(GL_\w+);$')
+
+HOOKS = {
+    'glUseProgram': 'glad_instrument_use_program(program)',
+    'glActiveTexture': 'glad_instrument_active_texture(texture)',
+    'glBindTexture': 'glad_instrument_bind_texture(target, texture)',
+    'glBindVertexArray': 'glad_instrument_bind_vertex_array(array)',
+    'glDeleteTextures': 'glad_instrument_delete_textures(n, textures)',
+    'glDeleteVertexArrays': 'glad_instrument_delete_vertex_arrays(n, arrays)',
+    'glLinkProgram': 'glad_instrument_forget_program(program)',
+    'glDeleteProgram': 'glad_instrument_forget_program(program)',
+}
+
+UNIFORM_TYPES = {'f': 'GLfloat', 'i': 'GLint', 'ui': 'GLuint', 'd': 'GLdouble'}
+
+
+def param_name(param):
+    return re.findall(r'\w+', param)[-1]
+
+
+def uniform_hook(name, params):
+    # gl[Program]Uniform{1234}{f,i,ui,d}[v], gl[Program]UniformMatrix{234}[x{234}]{f,d}v
+    # The glProgramUniform calls name their program and are tagged as their
+    # glUniform counterpart, so setting the same value both ways compares equal.
+    m = re.match(r'^gl(Program)?Uniform(([1-4])(f|i|ui|d)(v?))$', name)
+    if m:
+        program, params = ('program', params[1:]) if m.group(1) else ('glad_instrument_program', params)
+        tag = index_name('glUniform' + m.group(2))
+        if m.group(5):
+            return ('glad_redundant = glad_instrument_uniform(%s, %s, location, value, (size_t)count * %s * sizeof(%s));'
+                    % (tag, program, m.group(3), UNIFORM_TYPES[m.group(4)]))
+        values = ', '.join(params[1:])
+        return ('{ %s v[%s] = {%s}; glad_redundant = glad_instrument_uniform(%s, %s, location, v, sizeof(v)); }'
+                % (UNIFORM_TYPES[m.group(4)], m.group(3), values, tag, program))
+    m = re.match(r'^gl(Program)?Uniform(Matrix([2-4])(?:x([2-4]))?(f|d)v)$', name)
+    if m:
+        program = 'program' if m.group(1) else 'glad_instrument_program'
+        size = int(m.group(3)) * int(m.group(4) or m.group(3))
+        return ('glad_redundant = glad_instrument_uniform(%s + (transpose ? GLAD_INSTRUMENT_COUNT : 0), %s, location, value, (size_t)count * %d * sizeof(%s));'
+                % (index_name('glUniform' + m.group(2)), program, size, UNIFORM_TYPES[m.group(5)]))
+    return None
+
+
+def index_name(name):
+    return 'GLAD_INSTRUMENT_' + name
+
+
+def parse():
+    functions = []
+    extensions = []
+    typedefs = {}
+    with open(HEADER) as f:
+        for line in f:
+            line = line.strip()
+            m = TYPEDEF.match(line)
+            if m:
+                typedefs[m.group(2)] = (m.group(1), m.group(3))
+                continue
+            m = POINTER.match(line)
+            if m and m.group(1) in typedefs:
+                ret, params = typedefs[m.group(1)]
+                params = [] if params in ('', 'void') else [p.strip() for p in params.split(',')]
+                functions.append((m.group(2), m.group(1), ret, params))
+                continue
+            m = EXTENSION.match(line)
+            if m and not m.group(1).startswith('GL_VERSION_'):
+                extensions.append(m.group(1))
+    return functions, extensions
+
+
+def write_instrument(functions):
+    out = []
+    out.append('/* Generated by wrappers.py from glad.h, do not edit. */')
+    out.append('')
+    out.append('enum {')
+    for name, _, _, _ in functions:
+        out.append('    %s,' % index_name(name))
+    out.append('    GLAD_INSTRUMENT_COUNT')
+    out.append('};')
+    out.append('')
+    out.append('static const char *glad_instrument_names[GLAD_INSTRUMENT_COUNT] = {')
+    for name, _, _, _ in functions:
+        out.append('    "%s",' % name)
+    out.append('};')
+    out.append('')
+
+    for name, proc, ret, params in functions:
+        names = [param_name(p) for p in params]
+        out.append('static %s glad_real_%s = NULL;' % (proc, name))
+        out.append('static %s APIENTRY glad_instrument_%s(%s) {' % (ret, name, ', '.join(params) or 'void'))
+        out.append('    int glad_redundant = 0;')
+        out.append('    unsigned long long glad_start;')
+        if ret != 'void':
+            out.append('    %s glad_result;' % ret)
+        hook = HOOKS.get(name)
+        if hook:
+            out.append('    glad_redundant = %s;' % hook)
+        else:
+            hook = uniform_hook(name, names)
+            if hook:
+                out.append('    ' + hook)
+        out.append('    glad_start = glad_instrument_now();')
+        call = 'glad_real_%s(%s);' % (name, ', '.join(names))
+        out.append('    ' + (call if ret == 'void' else 'glad_result = ' + call))
+        out.append('    glad_instrument_record(%s, glad_start, glad_redundant);' % index_name(name))
+        if ret != 'void':
+            out.append('    return glad_result;')
+        out.append('}')
+        out.append('')
+
+    out.append('static void glad_instrument_wrap_all(void) {')
+    for name, _, _, _ in functions:
+        out.append('    if(glad_%s != NULL && glad_%s != glad_instrument_%s) {' % (name, name, name))
+        out.append('        glad_real_%s = glad_%s;' % (name, name))
+        out.append('        glad_%s = glad_instrument_%s;' % (name, name))
+        out.append('    }')
+    out.append('}')
+    out.append('')
+
+    with open(INSTRUMENT_OUTPUT, 'w') as f:
+        f.write('\n'.join(out))
+
+
+def fnv1a(seed, name):
+    h = (2166136261 ^ seed) & 0xffffffff
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def perfect_hash(names):
+    # smallest power of two table with a seed that gives no collision
+    size = 1
+    while size < len(names):
+        size *= 2
+    while True:
+        for seed in range(1 << 16):
+            slots = set(fnv1a(seed, name) & (size - 1) for name in names)
+            if len(slots) == len(names):
+                return size, seed
+        size *= 2
+
+
+def write_lazy(functions, extensions):
+    out = []
+    out.append('/* Generated by wrappers.py from glad.h, do not edit. */')
+    out.append('')
+
+    for name, proc, ret, params in functions:
+        names = [param_name(p) for p in params]
+        out.append('static %s glad_lazy_real_%s = NULL;' % (proc, name))
+        out.append('static %s APIENTRY glad_lazy_%s(%s) {' % (ret, name, ', '.join(params) or 'void'))
+        out.append('    if(glad_lazy_real_%s == NULL) {' % name)
+        out.append('        glad_lazy_real_%s = (%s)glad_lazy_loader("%s");' % (name, proc, name))
+        out.append('        if(glad_%s == glad_lazy_%s) glad_%s = glad_lazy_real_%s;' % (name, name, name, name))
+        out.append('    }')
+        call = 'glad_lazy_real_%s(%s);' % (name, ', '.join(names))
+        out.append('    ' + (call if ret == 'void' else 'return ' + call))
+        out.append('}')
+        out.append('')
+
+    out.append('static void glad_lazy_reset(void) {')
+    for name, _, _, _ in functions:
+        out.append('    glad_lazy_real_%s = NULL;' % name)
+    out.append('}')
+    out.append('')
+
+    out.append('/* sorted by name for glad_lazy_stub */')
+    out.append('static const struct glad_lazy_entry glad_lazy_entries[] = {')
+    for name, _, _, _ in sorted(functions, key=lambda f: f[0].encode()):
+        out.append('    { "%s", (void*)glad_lazy_%s },' % (name, name))
+    out.append('};')
+    out.append('')
+
+    size, seed = perfect_hash(extensions)
+    slots = [None] * size
+    for ext in extensions:
+        slots[fnv1a(seed, ext) & (size - 1)] = ext
+    out.append('#define GLAD_EXT_HASH_SIZE %d' % size)
+    out.append('static const unsigned int glad_ext_seed = %du;' % seed)
+    out.append('static const char *glad_ext_names[GLAD_EXT_HASH_SIZE] = {')
+    for ext in slots:
+        out.append('    %s,' % ('"%s"' % ext if ext else 'NULL'))
+    out.append('};')
+    out.append('')
+
+    with open(LAZY_OUTPUT, 'w') as f:
+        f.write('\n'.join(out))
+
+
+def main():
+    functions, extensions = parse()
+    write_instrument(functions)
+    write_lazy(functions, extensions)
+
+
+if __name__ == '__main__':
+    main()
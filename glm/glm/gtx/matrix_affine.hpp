@@ -0,0 +1,56 @@
+/// @ref gtx_matrix_affine
+/// @file glm/gtx/matrix_affine.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_inverse (dependence)
+///
+/// @defgroup gtx_matrix_affine GLM_GTX_matrix_affine
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_affine.hpp> to use the features of this extension.
+///
+/// Inverses and normal matrices specialized for affine transforms, ie. matrices
+/// whose last row is (0, 0, 0, 1). Results are undefined for other matrices.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_inverse.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_affine is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_matrix_affine extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_affine
+	/// @{
+
+	/// Inverse of a rigid transform (rotation and translation only).
+	/// The rotation is transposed, no division is performed.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> rigidInverse(mat<4, 4, T, Q> const& m);
+
+	/// Inverse of an affine transform built from rotation, non-uniform scale and translation,
+	/// ie. the first three columns are orthogonal. Each column is divided by its squared length
+	/// instead of computing cofactors.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> scaledRigidInverse(mat<4, 4, T, Q> const& m);
+
+	/// Inverse transpose of the upper 3x3 part of an affine transform, to transform normals.
+	/// Equivalent to inverseTranspose(mat3(m)) but built from three cross products.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> normalMatrix(mat<4, 4, T, Q> const& m);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
@@ -0,0 +1,50 @@
+/// @ref gtx_matrix_affine
+
+namespace glm
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> rigidInverse(mat<4, 4, T, Q> const& m)
+	{
+		vec<3, T, Q> const c0(m[0]);
+		vec<3, T, Q> const c1(m[1]);
+		vec<3, T, Q> const c2(m[2]);
+		vec<3, T, Q> const t(m[3]);
+
+		return mat<4, 4, T, Q>(
+			c0.x, c1.x, c2.x, static_cast<T>(0),
+			c0.y, c1.y, c2.y, static_cast<T>(0),
+			c0.z, c1.z, c2.z, static_cast<T>(0),
+			-dot(c0, t), -dot(c1, t), -dot(c2, t), static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> scaledRigidInverse(mat<4, 4, T, Q> const& m)
+	{
+		vec<3, T, Q> const c0(vec<3, T, Q>(m[0]) / dot(vec<3, T, Q>(m[0]), vec<3, T, Q>(m[0])));
+		vec<3, T, Q> const c1(vec<3, T, Q>(m[1]) / dot(vec<3, T, Q>(m[1]), vec<3, T, Q>(m[1])));
+		vec<3, T, Q> const c2(vec<3, T, Q>(m[2]) / dot(vec<3, T, Q>(m[2]), vec<3, T, Q>(m[2])));
+		vec<3, T, Q> const t(m[3]);
+
+		return mat<4, 4, T, Q>(
+			c0.x, c1.x, c2.x, static_cast<T>(0),
+			c0.y, c1.y, c2.y, static_cast<T>(0),
+			c0.z, c1.z, c2.z, static_cast<T>(0),
+			-dot(c0, t), -dot(c1, t), -dot(c2, t), static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> normalMatrix(mat<4, 4, T, Q> const& m)
+	{
+		vec<3, T, Q> const c0(m[0]);
+		vec<3, T, Q> const c1(m[1]);
+		vec<3, T, Q> const c2(m[2]);
+
+		// Columns of the cofactor matrix, which is the inverse transpose scaled by the determinant.
+		vec<3, T, Q> const r0(cross(c1, c2));
+		vec<3, T, Q> const r1(cross(c2, c0));
+		vec<3, T, Q> const r2(cross(c0, c1));
+		T const OneOverDeterminant = static_cast<T>(1) / dot(c0, r0);
+
+		return mat<3, 3, T, Q>(r0 * OneOverDeterminant, r1 * OneOverDeterminant, r2 * OneOverDeterminant);
+	}
+}//namespace glm
@@ -0,0 +1,130 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_batch GLM_GTX_matrix_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_batch.hpp> to use the features of this extension.
+///
+/// Multiply arrays of 4x4 float matrices in one call. Arrays can be stored as
+/// arrays of matrices (AoS) or as 16 component streams (SoA).
+///
+/// On x86 with GCC or Clang the AVX2/FMA kernels are selected at runtime when the
+/// CPU supports them, otherwise the SSE2 kernels are used. Other platforms use
+/// the scalar operator*. Define GLM_FORCE_BATCH_SCALAR to always use operator*.
+///
+/// Batched inverses of affine transforms use SSE2 on x86 and the functions of
+/// GLM_GTX_matrix_affine elsewhere.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "matrix_affine.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_matrix_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_batch
+	/// @{
+
+	/// Structure of arrays storage for 4x4 float matrices.
+	/// c[i * 4 + j] points to the stream holding column i, row j of every matrix.
+	/// From GLM_GTX_matrix_batch extension.
+	struct soa_mat4
+	{
+		float* c[16];
+	};
+
+	/// Instruction set used by the batch functions, chosen once at first use.
+	/// From GLM_GTX_matrix_batch extension.
+	enum batch_isa
+	{
+		BATCH_ISA_SCALAR,
+		BATCH_ISA_SSE2,
+		BATCH_ISA_AVX2
+	};
+
+	/// Returns the instruction set used by the batch functions on this machine.
+	/// From GLM_GTX_matrix_batch extension.
+	GLM_FUNC_DECL batch_isa batchIsa();
+
+	/// Computes Out[i] = A[i] * B[i] for i in [0, Count).
+	/// Out may alias A or B.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchMul(
+		mat<4, 4, float, Q> const* A,
+		mat<4, 4, float, Q> const* B,
+		mat<4, 4, float, Q>* Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = A * B[i] for i in [0, Count), eg. a parent transform applied to its children.
+	/// Out may alias B.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchMul(
+		mat<4, 4, float, Q> const& A,
+		mat<4, 4, float, Q> const* B,
+		mat<4, 4, float, Q>* Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = A[i] * B[i] for i in [0, Count) on SoA storage.
+	/// Out streams must not alias the A or B streams.
+	/// From GLM_GTX_matrix_batch extension.
+	GLM_FUNC_DECL void batchMul(
+		soa_mat4 const& A,
+		soa_mat4 const& B,
+		soa_mat4 const& Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = affineInverse(In[i]) for i in [0, Count).
+	/// In[i] must be affine. Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchAffineInverse(
+		mat<4, 4, float, Q> const* In,
+		mat<4, 4, float, Q>* Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = rigidInverse(In[i]) for i in [0, Count).
+	/// In[i] must only hold a rotation and a translation. Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchRigidInverse(
+		mat<4, 4, float, Q> const* In,
+		mat<4, 4, float, Q>* Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = scaledRigidInverse(In[i]) for i in [0, Count).
+	/// In[i] must only hold a rotation, a scale and a translation. Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchScaledRigidInverse(
+		mat<4, 4, float, Q> const* In,
+		mat<4, 4, float, Q>* Out,
+		std::size_t Count);
+
+	/// Computes Out[i] = normalMatrix(In[i]) for i in [0, Count).
+	/// In[i] must be affine.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchNormalMatrix(
+		mat<4, 4, float, Q> const* In,
+		mat<3, 3, float, Q>* Out,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_batch.inl"
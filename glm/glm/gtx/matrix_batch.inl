@@ -0,0 +1,345 @@
+/// @ref gtx_matrix_batch
+
+#if !defined(GLM_FORCE_BATCH_SCALAR) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#	define GLM_BATCH_X86 1
+#	include <immintrin.h>
+	// Kernels are only plain inline: always_inline would conflict with the target attribute.
+#	if defined(__AVX2__) && defined(__FMA__)
+#		define GLM_BATCH_AVX2_TARGET
+#	else
+#		define GLM_BATCH_AVX2_TARGET __attribute__((target("avx2,fma")))
+#	endif
+#else
+#	define GLM_BATCH_X86 0
+#endif
+
+namespace glm{
+namespace detail
+{
+	// A points to one matrix when StrideA is 0, to an array of matrices when StrideA is 16.
+	inline void batchMul_scalar(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i, A += StrideA, B += 16, Out += 16)
+		{
+			float Result[16];
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Result[c * 4 + r] = A[r] * B[c * 4] + A[4 + r] * B[c * 4 + 1] + A[8 + r] * B[c * 4 + 2] + A[12 + r] * B[c * 4 + 3];
+			for(length_t k = 0; k < 16; ++k)
+				Out[k] = Result[k];
+		}
+	}
+
+	inline void batchMul_scalar(soa_mat4 const& A, soa_mat4 const& B, soa_mat4 const& Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Out.c[c * 4 + r][i] =
+				A.c[r][i] * B.c[c * 4][i] +
+				A.c[4 + r][i] * B.c[c * 4 + 1][i] +
+				A.c[8 + r][i] * B.c[c * 4 + 2][i] +
+				A.c[12 + r][i] * B.c[c * 4 + 3][i];
+	}
+
+#	if GLM_BATCH_X86
+	inline void batchMul_sse2(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i, A += StrideA, B += 16, Out += 16)
+		{
+			__m128 const a0 = _mm_loadu_ps(A);
+			__m128 const a1 = _mm_loadu_ps(A + 4);
+			__m128 const a2 = _mm_loadu_ps(A + 8);
+			__m128 const a3 = _mm_loadu_ps(A + 12);
+
+			for(length_t c = 0; c < 4; ++c)
+			{
+				__m128 const b = _mm_loadu_ps(B + c * 4);
+				__m128 const m0 = _mm_mul_ps(a0, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+				__m128 const m1 = _mm_mul_ps(a1, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)));
+				__m128 const m2 = _mm_mul_ps(a2, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)));
+				__m128 const m3 = _mm_mul_ps(a3, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)));
+				_mm_storeu_ps(Out + c * 4, _mm_add_ps(_mm_add_ps(m0, m1), _mm_add_ps(m2, m3)));
+			}
+		}
+	}
+
+	inline void batchMul_sse2(soa_mat4 const& A, soa_mat4 const& B, soa_mat4 const& Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		for(length_t c = 0; c < 4; ++c)
+		{
+			__m128 const b0 = _mm_loadu_ps(B.c[c * 4] + i);
+			__m128 const b1 = _mm_loadu_ps(B.c[c * 4 + 1] + i);
+			__m128 const b2 = _mm_loadu_ps(B.c[c * 4 + 2] + i);
+			__m128 const b3 = _mm_loadu_ps(B.c[c * 4 + 3] + i);
+			for(length_t r = 0; r < 4; ++r)
+			{
+				__m128 const m0 = _mm_mul_ps(_mm_loadu_ps(A.c[r] + i), b0);
+				__m128 const m1 = _mm_mul_ps(_mm_loadu_ps(A.c[4 + r] + i), b1);
+				__m128 const m2 = _mm_mul_ps(_mm_loadu_ps(A.c[8 + r] + i), b2);
+				__m128 const m3 = _mm_mul_ps(_mm_loadu_ps(A.c[12 + r] + i), b3);
+				_mm_storeu_ps(Out.c[c * 4 + r] + i, _mm_add_ps(_mm_add_ps(m0, m1), _mm_add_ps(m2, m3)));
+			}
+		}
+		batchMul_scalar(A, B, Out, i, Count);
+	}
+
+	// Two columns of the result per 256 bits register: the columns of A are
+	// duplicated in both lanes and each lane broadcasts the factors of its column of B.
+	GLM_BATCH_AVX2_TARGET inline void batchMul_avx2(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i, A += StrideA, B += 16, Out += 16)
+		{
+			__m256 const a0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(A));
+			__m256 const a1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(A + 4));
+			__m256 const a2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(A + 8));
+			__m256 const a3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(A + 12));
+
+			for(length_t c = 0; c < 4; c += 2)
+			{
+				__m256 const b = _mm256_loadu_ps(B + c * 4);
+				__m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+				r = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)), r);
+				r = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)), r);
+				r = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)), r);
+				_mm256_storeu_ps(Out + c * 4, r);
+			}
+		}
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchMul_avx2(soa_mat4 const& A, soa_mat4 const& B, soa_mat4 const& Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		for(length_t c = 0; c < 4; ++c)
+		{
+			__m256 const b0 = _mm256_loadu_ps(B.c[c * 4] + i);
+			__m256 const b1 = _mm256_loadu_ps(B.c[c * 4 + 1] + i);
+			__m256 const b2 = _mm256_loadu_ps(B.c[c * 4 + 2] + i);
+			__m256 const b3 = _mm256_loadu_ps(B.c[c * 4 + 3] + i);
+			for(length_t r = 0; r < 4; ++r)
+			{
+				__m256 m = _mm256_mul_ps(_mm256_loadu_ps(A.c[r] + i), b0);
+				m = _mm256_fmadd_ps(_mm256_loadu_ps(A.c[4 + r] + i), b1, m);
+				m = _mm256_fmadd_ps(_mm256_loadu_ps(A.c[8 + r] + i), b2, m);
+				m = _mm256_fmadd_ps(_mm256_loadu_ps(A.c[12 + r] + i), b3, m);
+				_mm256_storeu_ps(Out.c[c * 4 + r] + i, m);
+			}
+		}
+		batchMul_scalar(A, B, Out, i, Count);
+	}
+
+	enum batch_affine
+	{
+		BATCH_AFFINE_GENERAL,
+		BATCH_AFFINE_RIGID,
+		BATCH_AFFINE_SCALED_RIGID
+	};
+
+	inline __m128 batchCross_sse2(__m128 a, __m128 b)
+	{
+		__m128 const a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 const b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 const c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	// Dot product broadcast to all components.
+	inline __m128 batchDot_sse2(__m128 a, __m128 b)
+	{
+		__m128 const m = _mm_mul_ps(a, b);
+		__m128 const s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// Rows r0, r1 and r2 of the inverse upper 3x3 part of In, w components cleared.
+	inline void batchInverseRows_sse2(float const* In, batch_affine Kind, __m128& r0, __m128& r1, __m128& r2)
+	{
+		__m128 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		__m128 const c0 = _mm_and_ps(_mm_loadu_ps(In), Mask);
+		__m128 const c1 = _mm_and_ps(_mm_loadu_ps(In + 4), Mask);
+		__m128 const c2 = _mm_and_ps(_mm_loadu_ps(In + 8), Mask);
+
+		if(Kind == BATCH_AFFINE_RIGID)
+		{
+			r0 = c0;
+			r1 = c1;
+			r2 = c2;
+		}
+		else if(Kind == BATCH_AFFINE_SCALED_RIGID)
+		{
+			r0 = _mm_div_ps(c0, batchDot_sse2(c0, c0));
+			r1 = _mm_div_ps(c1, batchDot_sse2(c1, c1));
+			r2 = _mm_div_ps(c2, batchDot_sse2(c2, c2));
+		}
+		else
+		{
+			__m128 const x0 = batchCross_sse2(c1, c2);
+			__m128 const x1 = batchCross_sse2(c2, c0);
+			__m128 const x2 = batchCross_sse2(c0, c1);
+			__m128 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), batchDot_sse2(c0, x0));
+			r0 = _mm_mul_ps(x0, OneOverDeterminant);
+			r1 = _mm_mul_ps(x1, OneOverDeterminant);
+			r2 = _mm_mul_ps(x2, OneOverDeterminant);
+		}
+	}
+
+	inline void batchAffineInverse_sse2(float const* In, float* Out, std::size_t Count, batch_affine Kind)
+	{
+		for(std::size_t i = 0; i < Count; ++i, In += 16, Out += 16)
+		{
+			__m128 r0, r1, r2;
+			batchInverseRows_sse2(In, Kind, r0, r1, r2);
+			__m128 const t = _mm_loadu_ps(In + 12);
+
+			__m128 r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			__m128 const m0 = _mm_mul_ps(r0, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+			__m128 const m1 = _mm_mul_ps(r1, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m128 const m2 = _mm_mul_ps(r2, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m128 const c3 = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), _mm_add_ps(_mm_add_ps(m0, m1), m2));
+
+			_mm_storeu_ps(Out, r0);
+			_mm_storeu_ps(Out + 4, r1);
+			_mm_storeu_ps(Out + 8, r2);
+			_mm_storeu_ps(Out + 12, c3);
+		}
+	}
+
+	template<qualifier Q>
+	inline void batchNormalMatrix_sse2(mat<4, 4, float, Q> const* In, mat<3, 3, float, Q>* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// The cofactor rows of the inverse are the columns of the inverse transpose.
+			float Result[12];
+			__m128 r0, r1, r2;
+			batchInverseRows_sse2(&In[i][0][0], BATCH_AFFINE_GENERAL, r0, r1, r2);
+			_mm_storeu_ps(Result, r0);
+			_mm_storeu_ps(Result + 4, r1);
+			_mm_storeu_ps(Result + 8, r2);
+
+			for(length_t c = 0; c < 3; ++c)
+				Out[i][c] = vec<3, float, Q>(Result[c * 4], Result[c * 4 + 1], Result[c * 4 + 2]);
+		}
+	}
+
+	inline batch_isa batchDetectIsa()
+	{
+#		if defined(__AVX2__) && defined(__FMA__)
+			return BATCH_ISA_AVX2;
+#		else
+			__builtin_cpu_init();
+			if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+				return BATCH_ISA_AVX2;
+			return BATCH_ISA_SSE2;
+#		endif
+	}
+#	endif//GLM_BATCH_X86
+
+	inline void batchMul_dispatch(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				batchMul_avx2(A, StrideA, B, Out, Count);
+			else
+				batchMul_sse2(A, StrideA, B, Out, Count);
+#		else
+			batchMul_scalar(A, StrideA, B, Out, Count);
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER batch_isa batchIsa()
+	{
+#		if GLM_BATCH_X86
+			static batch_isa const Isa = detail::batchDetectIsa();
+			return Isa;
+#		else
+			return BATCH_ISA_SCALAR;
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchMul(mat<4, 4, float, Q> const* A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "GLM_GTX_matrix_batch requires tightly packed matrices");
+		if(Count == 0)
+			return;
+		detail::batchMul_dispatch(&A[0][0][0], 16, &B[0][0][0], &Out[0][0][0], Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchMul(mat<4, 4, float, Q> const& A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "GLM_GTX_matrix_batch requires tightly packed matrices");
+		if(Count == 0)
+			return;
+		detail::batchMul_dispatch(&A[0][0], 0, &B[0][0][0], &Out[0][0][0], Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batchMul(soa_mat4 const& A, soa_mat4 const& B, soa_mat4 const& Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				detail::batchMul_avx2(A, B, Out, Count);
+			else
+				detail::batchMul_sse2(A, B, Out, Count);
+#		else
+			detail::batchMul_scalar(A, B, Out, 0, Count);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchAffineInverse(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "GLM_GTX_matrix_batch requires tightly packed matrices");
+#		if GLM_BATCH_X86
+			if(Count > 0)
+				detail::batchAffineInverse_sse2(&In[0][0][0], &Out[0][0][0], Count, detail::BATCH_AFFINE_GENERAL);
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = affineInverse(In[i]);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchRigidInverse(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "GLM_GTX_matrix_batch requires tightly packed matrices");
+#		if GLM_BATCH_X86
+			if(Count > 0)
+				detail::batchAffineInverse_sse2(&In[0][0][0], &Out[0][0][0], Count, detail::BATCH_AFFINE_RIGID);
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = rigidInverse(In[i]);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchScaledRigidInverse(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "GLM_GTX_matrix_batch requires tightly packed matrices");
+#		if GLM_BATCH_X86
+			if(Count > 0)
+				detail::batchAffineInverse_sse2(&In[0][0][0], &Out[0][0][0], Count, detail::BATCH_AFFINE_SCALED_RIGID);
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = scaledRigidInverse(In[i]);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchNormalMatrix(mat<4, 4, float, Q> const* In, mat<3, 3, float, Q>* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			detail::batchNormalMatrix_sse2(In, Out, Count);
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = normalMatrix(In[i]);
+#		endif
+	}
+}//namespace glm
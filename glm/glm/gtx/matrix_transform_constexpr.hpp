@@ -0,0 +1,80 @@
+/// @ref gtx_matrix_transform_constexpr
+/// @file glm/gtx/matrix_transform_constexpr.hpp
+///
+/// @see core (dependence)
+/// @see ext_matrix_transform
+/// @see ext_matrix_clip_space
+///
+/// @defgroup gtx_matrix_transform_constexpr GLM_GTX_matrix_transform_constexpr
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_transform_constexpr.hpp> to use the features of this extension.
+///
+/// constexpr versions of translate, scale, rotate, perspective, ortho and lookAt so that
+/// constant transforms can be evaluated by the compiler and stored in read only data.
+/// The trigonometric functions and square roots are evaluated with series and Newton
+/// iterations in double precision, results match the runtime functions within a few ulp.
+/// Angles of 2^52 turns and more, which doubles only hold as whole turns, are taken as
+/// whole turns, and NaN or infinite angles give NaN.
+///
+/// Requires C++14. Also available when SIMD instructions are enabled (GLM_FORCE_INTRINSICS),
+/// but only for packed qualifiers: the aligned SIMD types are built with intrinsics that can't
+/// be evaluated at compile time.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <limits>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_transform_constexpr is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_matrix_transform_constexpr extension included")
+#	endif
+#endif
+
+#if GLM_CONFIG_CONSTEXP == GLM_DISABLE || !(GLM_LANG & GLM_LANG_CXX14_FLAG)
+#	error "GLM: GLM_GTX_matrix_transform_constexpr requires C++14 constexpr support."
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_transform_constexpr
+	/// @{
+
+	/// constexpr version of translate(m, v).
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, Q> constexprTranslate(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// constexpr version of scale(m, v).
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, Q> constexprScale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// constexpr version of rotate(m, angle, axis). The angle is in radians.
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, Q> constexprRotate(mat<4, 4, T, Q> const& m, T angle, vec<3, T, Q> const& axis);
+
+	/// constexpr version of perspective(fovy, aspect, zNear, zFar), following GLM_FORCE_DEPTH_ZERO_TO_ONE and GLM_FORCE_LEFT_HANDED.
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, defaultp> constexprPerspective(T fovy, T aspect, T zNear, T zFar);
+
+	/// constexpr version of ortho(left, right, bottom, top, zNear, zFar), following GLM_FORCE_DEPTH_ZERO_TO_ONE and GLM_FORCE_LEFT_HANDED.
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, defaultp> constexprOrtho(T left, T right, T bottom, T top, T zNear, T zFar);
+
+	/// constexpr version of lookAt(eye, center, up), following GLM_FORCE_LEFT_HANDED.
+	/// From GLM_GTX_matrix_transform_constexpr extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL constexpr mat<4, 4, T, Q> constexprLookAt(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_transform_constexpr.inl"
@@ -0,0 +1,187 @@
+/// @ref gtx_matrix_transform_constexpr
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER constexpr double constexprSqrt(double x)
+	{
+		if(!(x > 0.0))
+			return 0.0;
+
+		double Result = x > 1.0 ? x : 1.0;
+		for(int i = 0; i < 128; ++i)
+		{
+			double const Next = 0.5 * (Result + x / Result);
+			if(Next >= Result)
+				break;
+			Result = Next;
+		}
+		return Result;
+	}
+
+	// x minus whole turns, in [-pi, pi]. From 2^52 turns on doubles only hold
+	// whole turns, they reduce to 0, and NaN and infinities to NaN, rather
+	// than reaching the cast to long long, undefined out of its range.
+	GLM_FUNC_QUALIFIER constexpr double constexprReduceAngle(double x)
+	{
+		double const Pi = 3.14159265358979323846;
+		double const TwoPi = 6.28318530717958647692;
+
+		double const Turns = x / TwoPi;
+		if(!(Turns > -4503599627370496.0 && Turns < 4503599627370496.0))
+		{
+			double const Max = std::numeric_limits<double>::max();
+			return Turns >= -Max && Turns <= Max ? 0.0 : std::numeric_limits<double>::quiet_NaN();
+		}
+		x -= TwoPi * static_cast<double>(static_cast<long long>(Turns));
+		if(x > Pi)
+			x -= TwoPi;
+		else if(x < -Pi)
+			x += TwoPi;
+		return x;
+	}
+
+	// Taylor series after reducing x to [-pi/2, pi/2].
+	GLM_FUNC_QUALIFIER constexpr double constexprSin(double x)
+	{
+		double const Pi = 3.14159265358979323846;
+
+		x = constexprReduceAngle(x);
+		if(x > Pi / 2.0)
+			x = Pi - x;
+		else if(x < -Pi / 2.0)
+			x = -Pi - x;
+
+		double Term = x;
+		double Result = x;
+		for(int i = 1; i < 12; ++i)
+		{
+			Term *= -x * x / static_cast<double>((2 * i) * (2 * i + 1));
+			Result += Term;
+		}
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER constexpr double constexprCos(double x)
+	{
+		return constexprSin(constexprReduceAngle(x) + 1.57079632679489661923);
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, Q> constexprTranslate(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return mat<4, 4, T, Q>(
+			m[0],
+			m[1],
+			m[2],
+			m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, Q> constexprScale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return mat<4, 4, T, Q>(
+			m[0] * v[0],
+			m[1] * v[1],
+			m[2] * v[2],
+			m[3]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, Q> constexprRotate(mat<4, 4, T, Q> const& m, T angle, vec<3, T, Q> const& v)
+	{
+		T const c = static_cast<T>(detail::constexprCos(static_cast<double>(angle)));
+		T const s = static_cast<T>(detail::constexprSin(static_cast<double>(angle)));
+
+		T const OneOverLength = static_cast<T>(1.0 / detail::constexprSqrt(static_cast<double>(v[0] * v[0] + v[1] * v[1] + v[2] * v[2])));
+		T const x = v[0] * OneOverLength;
+		T const y = v[1] * OneOverLength;
+		T const z = v[2] * OneOverLength;
+		T const tx = (static_cast<T>(1) - c) * x;
+		T const ty = (static_cast<T>(1) - c) * y;
+		T const tz = (static_cast<T>(1) - c) * z;
+
+		vec<4, T, Q> const r0(m[0] * (c + tx * x) + m[1] * (tx * y + s * z) + m[2] * (tx * z - s * y));
+		vec<4, T, Q> const r1(m[0] * (ty * x - s * z) + m[1] * (c + ty * y) + m[2] * (ty * z + s * x));
+		vec<4, T, Q> const r2(m[0] * (tz * x + s * y) + m[1] * (tz * y - s * x) + m[2] * (c + tz * z));
+		return mat<4, 4, T, Q>(r0, r1, r2, m[3]);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, defaultp> constexprPerspective(T fovy, T aspect, T zNear, T zFar)
+	{
+		double const HalfFovy = static_cast<double>(fovy) / 2.0;
+		T const tanHalfFovy = static_cast<T>(detail::constexprSin(HalfFovy) / detail::constexprCos(HalfFovy));
+		T const Handedness = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_LH_BIT) ? static_cast<T>(1) : static_cast<T>(-1);
+
+		T const m22 = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			? Handedness * zFar / (zFar - zNear)
+			: Handedness * (zFar + zNear) / (zFar - zNear);
+		T const m32 = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			? -(zFar * zNear) / (zFar - zNear)
+			: -(static_cast<T>(2) * zFar * zNear) / (zFar - zNear);
+
+		return mat<4, 4, T, defaultp>(
+			static_cast<T>(1) / (aspect * tanHalfFovy), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(1) / tanHalfFovy, static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(0), m22, Handedness,
+			static_cast<T>(0), static_cast<T>(0), m32, static_cast<T>(0));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, defaultp> constexprOrtho(T left, T right, T bottom, T top, T zNear, T zFar)
+	{
+		T const Handedness = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_LH_BIT) ? static_cast<T>(1) : static_cast<T>(-1);
+
+		T const m22 = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			? Handedness * static_cast<T>(1) / (zFar - zNear)
+			: Handedness * static_cast<T>(2) / (zFar - zNear);
+		T const m32 = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			? - zNear / (zFar - zNear)
+			: - (zFar + zNear) / (zFar - zNear);
+
+		return mat<4, 4, T, defaultp>(
+			static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(0), m22, static_cast<T>(0),
+			- (right + left) / (right - left), - (top + bottom) / (top - bottom), m32, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER constexpr mat<4, 4, T, Q> constexprLookAt(vec<3, T, Q> const& eye, vec<3, T, Q> const& center, vec<3, T, Q> const& up)
+	{
+		// f = normalize(center - eye), s = normalize(cross(f, up)), u = cross(s, f) with the right handed convention.
+		T fx = center[0] - eye[0];
+		T fy = center[1] - eye[1];
+		T fz = center[2] - eye[2];
+		T const fLength = static_cast<T>(detail::constexprSqrt(static_cast<double>(fx * fx + fy * fy + fz * fz)));
+		fx /= fLength;
+		fy /= fLength;
+		fz /= fLength;
+
+		bool const LeftHanded = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_LH_BIT) != 0;
+		T sx = LeftHanded ? up[1] * fz - up[2] * fy : fy * up[2] - fz * up[1];
+		T sy = LeftHanded ? up[2] * fx - up[0] * fz : fz * up[0] - fx * up[2];
+		T sz = LeftHanded ? up[0] * fy - up[1] * fx : fx * up[1] - fy * up[0];
+		T const sLength = static_cast<T>(detail::constexprSqrt(static_cast<double>(sx * sx + sy * sy + sz * sz)));
+		sx /= sLength;
+		sy /= sLength;
+		sz /= sLength;
+
+		T const ux = LeftHanded ? fy * sz - fz * sy : sy * fz - sz * fy;
+		T const uy = LeftHanded ? fz * sx - fx * sz : sz * fx - sx * fz;
+		T const uz = LeftHanded ? fx * sy - fy * sx : sx * fy - sy * fx;
+
+		T const Forward = LeftHanded ? static_cast<T>(1) : static_cast<T>(-1);
+
+		return mat<4, 4, T, Q>(
+			sx, ux, Forward * fx, static_cast<T>(0),
+			sy, uy, Forward * fy, static_cast<T>(0),
+			sz, uz, Forward * fz, static_cast<T>(0),
+			-(sx * eye[0] + sy * eye[1] + sz * eye[2]),
+			-(ux * eye[0] + uy * eye[1] + uz * eye[2]),
+			-Forward * (fx * eye[0] + fy * eye[1] + fz * eye[2]),
+			static_cast<T>(1));
+	}
+}//namespace glm
@@ -0,0 +1,108 @@
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_packing_batch GLM_GTX_packing_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/packing_batch.hpp> to use the features of this extension.
+///
+/// Packing of float arrays to the compact vertex attribute formats: half floats, 16 bit
+/// normalized integers, GL_INT_2_10_10_10_REV and octahedral encoded unit vectors.
+///
+/// Kernels use SSE2 or AVX2 like GLM_GTX_matrix_batch, the vec3 kernels SSE2 only.
+/// Unlike the functions of GLM_GTC_packing, which round halfway cases away from zero,
+/// every conversion rounds to nearest even like the GPU and F16C do, so results can
+/// differ from them by one unit on exact ties. Maximum errors:
+/// - half: 2^-11 relative for normal halfs, 2^-25 absolute below 2^-14,
+/// - unorm16 and snorm16: half a unit of the last place, 1 / 131070 and 1 / 65534, the
+///   AVX2 kernels fuse the scale and bias multiply add and may round one unit differently,
+/// - snorm 10_10_10_2: 1 / 1022 per component,
+/// - octahedral on two snorm16: 0.004 degree on the unit sphere.
+/// The snorm bounds hold for the decoding of GL 4.2 and later and of unpackSnorm*,
+/// max(c / (2^(b-1) - 1), -1). Before 4.2, GL decodes normalized vertex attributes as
+/// (2c + 1) / (2^b - 1), which has no exact zero: decoded that way, snorm 10_10_10_2
+/// is off by up to 3 / 1023 per component and octahedral by 0.01 degree.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "matrix_batch.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_packing_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_packing_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_packing_batch
+	/// @{
+
+	/// Encodes a unit vector on the octahedron, both components in [-1, 1].
+	/// From GLM_GTX_packing_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL vec<2, float, Q> packOctahedral(vec<3, float, Q> const& v);
+
+	/// Decodes a unit vector encoded by packOctahedral.
+	/// From GLM_GTX_packing_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL vec<3, float, Q> unpackOctahedral(vec<2, float, Q> const& p);
+
+	/// Computes Out[i] = half(In[i]) for i in [First, Last).
+	/// From GLM_GTX_packing_batch extension.
+	GLM_FUNC_DECL void batchPackHalf(
+		float const* In,
+		uint16* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = unorm16(In[i] * Scale[i % 4] + Bias[i % 4]) for i in [First, Last),
+	/// values are clamped to [0, 1]. Scale and Bias apply per component to arrays of vec4
+	/// or, repeated, to arrays of vec2 and float. First must be a multiple of 4.
+	/// From GLM_GTX_packing_batch extension.
+	GLM_FUNC_DECL void batchPackUnorm16(
+		float const* In,
+		vec4 const& Scale,
+		vec4 const& Bias,
+		uint16* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = snorm16(In[i] * Scale[i % 4] + Bias[i % 4]) for i in [First, Last),
+	/// values are clamped to [-1, 1]. First must be a multiple of 4.
+	/// From GLM_GTX_packing_batch extension.
+	GLM_FUNC_DECL void batchPackSnorm16(
+		float const* In,
+		vec4 const& Scale,
+		vec4 const& Bias,
+		int16* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = packSnorm3x10_1x2(vec4(In[i], 0)) for i in [First, Last), the
+	/// layout of GL_INT_2_10_10_10_REV.
+	/// From GLM_GTX_packing_batch extension.
+	GLM_FUNC_DECL void batchPackSnorm3x10_1x2(
+		vec3 const* In,
+		uint32* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = packSnorm2x16(packOctahedral(In[i])) for i in [First, Last).
+	/// In must hold unit vectors.
+	/// From GLM_GTX_packing_batch extension.
+	GLM_FUNC_DECL void batchPackOctahedral(
+		vec3 const* In,
+		uint32* Out,
+		std::size_t First, std::size_t Last);
+
+	/// @}
+}//namespace glm
+
+#include "packing_batch.inl"
@@ -0,0 +1,399 @@
+/// @ref gtx_packing_batch
+
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Float to half with round to nearest even, by F. Giesen: halfs below 2^-14 are rounded by
+	// adding a float whose exponent leaves exactly the half denormal bits in the mantissa.
+	static uint32 const batchHalfInfinity = 255u << 23;
+	static uint32 const batchHalfMax = (127u + 16u) << 23;
+	static uint32 const batchHalfDenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+	static uint32 const batchHalfNormalMin = 113u << 23;
+
+	inline uint16 batchPackHalf_scalar(float x)
+	{
+		uint32 u;
+		memcpy(&u, &x, sizeof(u));
+		uint32 const Sign = u & 0x80000000u;
+		u ^= Sign;
+
+		uint32 h;
+		if(u >= batchHalfMax)
+			h = u > batchHalfInfinity ? 0x7e00u : 0x7c00u;
+		else if(u < batchHalfNormalMin)
+		{
+			float f, Magic;
+			memcpy(&f, &u, sizeof(f));
+			memcpy(&Magic, &batchHalfDenormMagic, sizeof(Magic));
+			f += Magic;
+			memcpy(&u, &f, sizeof(u));
+			h = u - batchHalfDenormMagic;
+		}
+		else
+		{
+			uint32 const MantissaOdd = (u >> 13) & 1u;
+			u += ((15u - 127u) << 23) + 0xfffu + MantissaOdd;
+			h = u >> 13;
+		}
+		return static_cast<uint16>(h | (Sign >> 16));
+	}
+
+	inline void batchPackHalf_scalar(float const* In, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+			Out[i] = batchPackHalf_scalar(In[i]);
+	}
+
+	// Rounds to nearest even like the SIMD conversions.
+	inline int batchRound(float x)
+	{
+		return static_cast<int>(std::nearbyint(x));
+	}
+
+	// Scale and Bias are premultiplied by the largest value, the SSE2 kernels give the same
+	// results, the AVX2 ones may differ by one unit as the FMA rounds once.
+	inline void batchPackUnorm16_scalar(float const* In, vec4 const& Scale, vec4 const& Bias, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		vec4 const s(Scale * 65535.0f);
+		vec4 const b(Bias * 65535.0f);
+		for(std::size_t i = First; i < Last; ++i)
+			Out[i] = static_cast<uint16>(batchRound(clamp(In[i] * s[i % 4] + b[i % 4], 0.0f, 65535.0f)));
+	}
+
+	inline void batchPackSnorm16_scalar(float const* In, vec4 const& Scale, vec4 const& Bias, int16* Out, std::size_t First, std::size_t Last)
+	{
+		vec4 const s(Scale * 32767.0f);
+		vec4 const b(Bias * 32767.0f);
+		for(std::size_t i = First; i < Last; ++i)
+			Out[i] = static_cast<int16>(batchRound(clamp(In[i] * s[i % 4] + b[i % 4], -32767.0f, 32767.0f)));
+	}
+
+	inline uint32 batchPackSnorm3x10_1x2_scalar(vec3 const& v)
+	{
+		uint32 const x = static_cast<uint32>(batchRound(clamp(v.x, -1.0f, 1.0f) * 511.0f)) & 0x3ffu;
+		uint32 const y = static_cast<uint32>(batchRound(clamp(v.y, -1.0f, 1.0f) * 511.0f)) & 0x3ffu;
+		uint32 const z = static_cast<uint32>(batchRound(clamp(v.z, -1.0f, 1.0f) * 511.0f)) & 0x3ffu;
+		return x | (y << 10) | (z << 20);
+	}
+
+	inline void batchPackSnorm3x10_1x2_scalar(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+			Out[i] = batchPackSnorm3x10_1x2_scalar(In[i]);
+	}
+
+	inline uint32 batchPackOctahedral_scalar(vec3 const& v)
+	{
+		vec2 const p = packOctahedral(v);
+		uint32 const x = static_cast<uint32>(batchRound(clamp(p.x, -1.0f, 1.0f) * 32767.0f)) & 0xffffu;
+		uint32 const y = static_cast<uint32>(batchRound(clamp(p.y, -1.0f, 1.0f) * 32767.0f)) & 0xffffu;
+		return x | (y << 16);
+	}
+
+	inline void batchPackOctahedral_scalar(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+			Out[i] = batchPackOctahedral_scalar(In[i]);
+	}
+
+#	if GLM_BATCH_X86
+	inline __m128i batchPackHalf_sse2(__m128 x)
+	{
+		__m128i u = _mm_castps_si128(x);
+		__m128i const Sign = _mm_and_si128(u, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+		u = _mm_xor_si128(u, Sign);
+
+		// Sign cleared, the signed comparisons order the bit patterns like the values.
+		__m128i const Special = _mm_cmpgt_epi32(u, _mm_set1_epi32(static_cast<int>(batchHalfMax - 1u)));
+		__m128i const Nan = _mm_cmpgt_epi32(u, _mm_set1_epi32(static_cast<int>(batchHalfInfinity)));
+		__m128i const Denormal = _mm_cmplt_epi32(u, _mm_set1_epi32(static_cast<int>(batchHalfNormalMin)));
+
+		__m128i const Inf = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(Nan, _mm_set1_epi32(0x0200)));
+		__m128i const Small = _mm_sub_epi32(
+			_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(batchHalfDenormMagic))))),
+			_mm_set1_epi32(static_cast<int>(batchHalfDenormMagic)));
+		__m128i const MantissaOdd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+		__m128i const Normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(static_cast<int>(((15u - 127u) << 23) + 0xfffu))), MantissaOdd), 13);
+
+		__m128i h = _mm_or_si128(_mm_and_si128(Denormal, Small), _mm_andnot_si128(Denormal, Normal));
+		h = _mm_or_si128(_mm_and_si128(Special, Inf), _mm_andnot_si128(Special, h));
+		return _mm_or_si128(h, _mm_srli_epi32(Sign, 16));
+	}
+
+	// Packs the low 16 bits of each 32 bits lane, SSE2 only has a signed saturating pack: lanes are
+	// sign extended from their low 16 bits first so the saturation leaves them untouched.
+	inline __m128i batchPack16_sse2(__m128i a, __m128i b)
+	{
+		a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+		b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+		return _mm_packs_epi32(a, b);
+	}
+
+	inline void batchPackHalf_sse2(float const* In, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		std::size_t i = First;
+		for(; i + 8 <= Last; i += 8)
+		{
+			__m128i const a = batchPackHalf_sse2(_mm_loadu_ps(In + i));
+			__m128i const b = batchPackHalf_sse2(_mm_loadu_ps(In + i + 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), batchPack16_sse2(a, b));
+		}
+		batchPackHalf_scalar(In, Out, i, Last);
+	}
+
+	inline void batchPackUnorm16_sse2(float const* In, vec4 const& Scale, vec4 const& Bias, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const s = _mm_mul_ps(_mm_loadu_ps(&Scale[0]), _mm_set1_ps(65535.0f));
+		__m128 const b = _mm_mul_ps(_mm_loadu_ps(&Bias[0]), _mm_set1_ps(65535.0f));
+		__m128 const Max = _mm_set1_ps(65535.0f);
+
+		std::size_t i = First;
+		for(; i + 8 <= Last; i += 8)
+		{
+			__m128 const x0 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(In + i), s), b), _mm_setzero_ps()), Max);
+			__m128 const x1 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(In + i + 4), s), b), _mm_setzero_ps()), Max);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), batchPack16_sse2(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1)));
+		}
+		batchPackUnorm16_scalar(In, Scale, Bias, Out, i, Last);
+	}
+
+	inline void batchPackSnorm16_sse2(float const* In, vec4 const& Scale, vec4 const& Bias, int16* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const s = _mm_mul_ps(_mm_loadu_ps(&Scale[0]), _mm_set1_ps(32767.0f));
+		__m128 const b = _mm_mul_ps(_mm_loadu_ps(&Bias[0]), _mm_set1_ps(32767.0f));
+		__m128 const Max = _mm_set1_ps(32767.0f);
+		__m128 const Min = _mm_set1_ps(-32767.0f);
+
+		std::size_t i = First;
+		for(; i + 8 <= Last; i += 8)
+		{
+			__m128 const x0 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(In + i), s), b), Min), Max);
+			__m128 const x1 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(In + i + 4), s), b), Min), Max);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1)));
+		}
+		batchPackSnorm16_scalar(In, Scale, Bias, Out, i, Last);
+	}
+
+	// Loads 4 vec3 and transposes them to x, y and z registers.
+	inline void batchLoadVec3_sse2(float const* p, __m128& x, __m128& y, __m128& z)
+	{
+		__m128 const a = _mm_loadu_ps(p);      // x0 y0 z0 x1
+		__m128 const b = _mm_loadu_ps(p + 4);  // y1 z1 x2 y2
+		__m128 const c = _mm_loadu_ps(p + 8);  // z2 x3 y3 z3
+		x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	inline __m128i batchSnorm_sse2(__m128 x, float Max)
+	{
+		__m128 const m = _mm_set1_ps(Max);
+		return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(x, m), _mm_sub_ps(_mm_setzero_ps(), m)), m));
+	}
+
+	inline void batchPackSnorm3x10_1x2_sse2(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+		__m128i const Mask = _mm_set1_epi32(0x3ff);
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 x, y, z;
+			batchLoadVec3_sse2(&In[i].x, x, y, z);
+			__m128i const px = _mm_and_si128(batchSnorm_sse2(x, 511.0f), Mask);
+			__m128i const py = _mm_slli_epi32(_mm_and_si128(batchSnorm_sse2(y, 511.0f), Mask), 10);
+			__m128i const pz = _mm_slli_epi32(_mm_and_si128(batchSnorm_sse2(z, 511.0f), Mask), 20);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_or_si128(_mm_or_si128(px, py), pz));
+		}
+		batchPackSnorm3x10_1x2_scalar(In, Out, i, Last);
+	}
+
+	inline void batchPackOctahedral_sse2(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+		__m128 const One = _mm_set1_ps(1.0f);
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 x, y, z;
+			batchLoadVec3_sse2(&In[i].x, x, y, z);
+
+			__m128 const L1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(SignMask, x), _mm_andnot_ps(SignMask, y)), _mm_andnot_ps(SignMask, z));
+			__m128 const px = _mm_div_ps(x, L1);
+			__m128 const py = _mm_div_ps(y, L1);
+
+			// Lower hemisphere folded over the diagonals.
+			__m128 const fx = _mm_or_ps(_mm_sub_ps(One, _mm_andnot_ps(SignMask, py)), _mm_and_ps(px, SignMask));
+			__m128 const fy = _mm_or_ps(_mm_sub_ps(One, _mm_andnot_ps(SignMask, px)), _mm_and_ps(py, SignMask));
+			__m128 const Lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+			__m128 const ox = _mm_or_ps(_mm_and_ps(Lower, fx), _mm_andnot_ps(Lower, px));
+			__m128 const oy = _mm_or_ps(_mm_and_ps(Lower, fy), _mm_andnot_ps(Lower, py));
+
+			__m128i const qx = _mm_and_si128(batchSnorm_sse2(ox, 32767.0f), _mm_set1_epi32(0xffff));
+			__m128i const qy = _mm_slli_epi32(batchSnorm_sse2(oy, 32767.0f), 16);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_or_si128(qx, qy));
+		}
+		batchPackOctahedral_scalar(In, Out, i, Last);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline __m256i batchPackHalf_avx2(__m256 x)
+	{
+		__m256i u = _mm256_castps_si256(x);
+		__m256i const Sign = _mm256_and_si256(u, _mm256_set1_epi32(static_cast<int>(0x80000000u)));
+		u = _mm256_xor_si256(u, Sign);
+
+		__m256i const Special = _mm256_cmpgt_epi32(u, _mm256_set1_epi32(static_cast<int>(batchHalfMax - 1u)));
+		__m256i const Nan = _mm256_cmpgt_epi32(u, _mm256_set1_epi32(static_cast<int>(batchHalfInfinity)));
+		__m256i const Denormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(batchHalfNormalMin)), u);
+
+		__m256i const Inf = _mm256_or_si256(_mm256_set1_epi32(0x7c00), _mm256_and_si256(Nan, _mm256_set1_epi32(0x0200)));
+		__m256i const Small = _mm256_sub_epi32(
+			_mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(u), _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(batchHalfDenormMagic))))),
+			_mm256_set1_epi32(static_cast<int>(batchHalfDenormMagic)));
+		__m256i const MantissaOdd = _mm256_and_si256(_mm256_srli_epi32(u, 13), _mm256_set1_epi32(1));
+		__m256i const Normal = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(u, _mm256_set1_epi32(static_cast<int>(((15u - 127u) << 23) + 0xfffu))), MantissaOdd), 13);
+
+		__m256i h = _mm256_blendv_epi8(Normal, Small, Denormal);
+		h = _mm256_blendv_epi8(h, Inf, Special);
+		return _mm256_or_si256(h, _mm256_srli_epi32(Sign, 16));
+	}
+
+	// Packs the low 16 bits of each lane of a and b, in order.
+	GLM_BATCH_AVX2_TARGET inline __m256i batchPack16_avx2(__m256i a, __m256i b)
+	{
+		return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchPackHalf_avx2(float const* In, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		std::size_t i = First;
+		for(; i + 16 <= Last; i += 16)
+		{
+			__m256i const a = batchPackHalf_avx2(_mm256_loadu_ps(In + i));
+			__m256i const b = batchPackHalf_avx2(_mm256_loadu_ps(In + i + 8));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), batchPack16_avx2(a, b));
+		}
+		batchPackHalf_sse2(In, Out, i, Last);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchPackUnorm16_avx2(float const* In, vec4 const& Scale, vec4 const& Bias, uint16* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const s4 = _mm_mul_ps(_mm_loadu_ps(&Scale[0]), _mm_set1_ps(65535.0f));
+		__m128 const b4 = _mm_mul_ps(_mm_loadu_ps(&Bias[0]), _mm_set1_ps(65535.0f));
+		__m256 const s = _mm256_insertf128_ps(_mm256_castps128_ps256(s4), s4, 1);
+		__m256 const b = _mm256_insertf128_ps(_mm256_castps128_ps256(b4), b4, 1);
+		__m256 const Max = _mm256_set1_ps(65535.0f);
+
+		std::size_t i = First;
+		for(; i + 16 <= Last; i += 16)
+		{
+			__m256 const x0 = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(_mm256_loadu_ps(In + i), s, b), _mm256_setzero_ps()), Max);
+			__m256 const x1 = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(_mm256_loadu_ps(In + i + 8), s, b), _mm256_setzero_ps()), Max);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), batchPack16_avx2(_mm256_cvtps_epi32(x0), _mm256_cvtps_epi32(x1)));
+		}
+		batchPackUnorm16_sse2(In, Scale, Bias, Out, i, Last);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchPackSnorm16_avx2(float const* In, vec4 const& Scale, vec4 const& Bias, int16* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const s4 = _mm_mul_ps(_mm_loadu_ps(&Scale[0]), _mm_set1_ps(32767.0f));
+		__m128 const b4 = _mm_mul_ps(_mm_loadu_ps(&Bias[0]), _mm_set1_ps(32767.0f));
+		__m256 const s = _mm256_insertf128_ps(_mm256_castps128_ps256(s4), s4, 1);
+		__m256 const b = _mm256_insertf128_ps(_mm256_castps128_ps256(b4), b4, 1);
+		__m256 const Max = _mm256_set1_ps(32767.0f);
+		__m256 const Min = _mm256_set1_ps(-32767.0f);
+
+		std::size_t i = First;
+		for(; i + 16 <= Last; i += 16)
+		{
+			__m256 const x0 = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(_mm256_loadu_ps(In + i), s, b), Min), Max);
+			__m256 const x1 = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(_mm256_loadu_ps(In + i + 8), s, b), Min), Max);
+			__m256i const Packed = _mm256_packs_epi32(_mm256_cvtps_epi32(x0), _mm256_cvtps_epi32(x1));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), _mm256_permute4x64_epi64(Packed, _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+		batchPackSnorm16_sse2(In, Scale, Bias, Out, i, Last);
+	}
+#	endif//GLM_BATCH_X86
+}//namespace detail
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, float, Q> packOctahedral(vec<3, float, Q> const& v)
+	{
+		vec<2, float, Q> const p(vec<2, float, Q>(v.x, v.y) / (abs(v.x) + abs(v.y) + abs(v.z)));
+		if(v.z >= 0.0f)
+			return p;
+		return vec<2, float, Q>(
+			std::copysign(1.0f - abs(p.y), p.x),
+			std::copysign(1.0f - abs(p.x), p.y));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, float, Q> unpackOctahedral(vec<2, float, Q> const& p)
+	{
+		vec<3, float, Q> v(p.x, p.y, 1.0f - abs(p.x) - abs(p.y));
+		if(v.z < 0.0f)
+		{
+			v.x = std::copysign(1.0f - abs(p.y), p.x);
+			v.y = std::copysign(1.0f - abs(p.x), p.y);
+		}
+		return normalize(v);
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackHalf(float const* In, uint16* Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				detail::batchPackHalf_avx2(In, Out, First, Last);
+			else
+				detail::batchPackHalf_sse2(In, Out, First, Last);
+#		else
+			detail::batchPackHalf_scalar(In, Out, First, Last);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackUnorm16(float const* In, vec4 const& Scale, vec4 const& Bias, uint16* Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				detail::batchPackUnorm16_avx2(In, Scale, Bias, Out, First, Last);
+			else
+				detail::batchPackUnorm16_sse2(In, Scale, Bias, Out, First, Last);
+#		else
+			detail::batchPackUnorm16_scalar(In, Scale, Bias, Out, First, Last);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackSnorm16(float const* In, vec4 const& Scale, vec4 const& Bias, int16* Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				detail::batchPackSnorm16_avx2(In, Scale, Bias, Out, First, Last);
+			else
+				detail::batchPackSnorm16_sse2(In, Scale, Bias, Out, First, Last);
+#		else
+			detail::batchPackSnorm16_scalar(In, Scale, Bias, Out, First, Last);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackSnorm3x10_1x2(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			detail::batchPackSnorm3x10_1x2_sse2(In, Out, First, Last);
+#		else
+			detail::batchPackSnorm3x10_1x2_scalar(In, Out, First, Last);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackOctahedral(vec3 const* In, uint32* Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			detail::batchPackOctahedral_sse2(In, Out, First, Last);
+#		else
+			detail::batchPackOctahedral_scalar(In, Out, First, Last);
+#		endif
+	}
+}//namespace glm
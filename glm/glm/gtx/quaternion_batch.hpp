@@ -0,0 +1,110 @@
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_batch.hpp> to use the features of this extension.
+///
+/// Interpolate and convert arrays of float quaternions stored as structure of arrays.
+///
+/// Kernels are selected like GLM_GTX_matrix_batch: AVX2/FMA when the CPU supports it,
+/// SSE2 otherwise on x86, scalar code elsewhere. Every function only touches the
+/// elements in [First, Last) so disjoint ranges can be processed by several threads.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "matrix_batch.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Structure of arrays storage for float quaternions.
+	/// From GLM_GTX_quaternion_batch extension.
+	struct soa_quat
+	{
+		float* x;
+		float* y;
+		float* z;
+		float* w;
+	};
+
+	/// Normalized linear interpolation along the shortest path:
+	/// Out[i] = normalize(mix(A[i], +/-B[i], a[i])) for i in [First, Last).
+	/// Out may alias A or B.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchNlerp(
+		soa_quat const& A,
+		soa_quat const& B,
+		float const* a,
+		soa_quat const& Out,
+		std::size_t First, std::size_t Last);
+
+	/// Same as batchNlerp with a single interpolation factor for every element.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchNlerp(
+		soa_quat const& A,
+		soa_quat const& B,
+		float a,
+		soa_quat const& Out,
+		std::size_t First, std::size_t Last);
+
+	/// Approximated spherical linear interpolation along the shortest path.
+	/// The interpolation factor is corrected by a polynomial in a and cos(theta) before
+	/// running batchNlerp, no trigonometric function is evaluated.
+	/// The rotation angle between the result and slerp(A[i], B[i], a[i]) is less than 4e-4 radians
+	/// (3.9e-4 at most, measured by tools/quatbatch over 200 thousand random pairs, a in [0, 1]).
+	/// Out may alias A or B.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchFastSlerp(
+		soa_quat const& A,
+		soa_quat const& B,
+		float const* a,
+		soa_quat const& Out,
+		std::size_t First, std::size_t Last);
+
+	/// Same as batchFastSlerp with a single interpolation factor for every element.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchFastSlerp(
+		soa_quat const& A,
+		soa_quat const& B,
+		float a,
+		soa_quat const& Out,
+		std::size_t First, std::size_t Last);
+
+	/// Out[i] = mat4_cast(q[i]) for i in [First, Last). Quaternions must be normalized.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchMat4Cast(
+		soa_quat const& q,
+		mat<4, 4, float, defaultp>* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Same as batchMat4Cast, writing into structure of arrays matrices.
+	/// From GLM_GTX_quaternion_batch extension.
+	GLM_FUNC_DECL void batchMat4Cast(
+		soa_quat const& q,
+		soa_mat4 const& Out,
+		std::size_t First, std::size_t Last);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,325 @@
+/// @ref gtx_quaternion_batch
+
+namespace glm{
+namespace detail
+{
+	// Interpolation factor correction approximating slerp with nlerp,
+	// from "Approximating slerp", Arseny Kapoulkine, 2015.
+	// d is the absolute value of the cosine between the quaternions.
+	inline float batchSlerpFactor(float d, float a)
+	{
+		float const A = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+		float const B = 0.848013f + d * (-1.06021f + d * 0.215638f);
+		float const k = A * (a - 0.5f) * (a - 0.5f) + B;
+		return a + a * (a - 0.5f) * (a - 1.0f) * k;
+	}
+
+	// a points to one factor when StrideA is 0, to an array of factors when StrideA is 1.
+	inline void batchBlend_scalar(soa_quat const& A, soa_quat const& B, float const* a, std::size_t StrideA, soa_quat const& Out, std::size_t First, std::size_t Last, bool Slerp)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+		{
+			float const ax = A.x[i], ay = A.y[i], az = A.z[i], aw = A.w[i];
+			float const bx = B.x[i], by = B.y[i], bz = B.z[i], bw = B.w[i];
+
+			float d = ax * bx + ay * by + az * bz + aw * bw;
+			float const Sign = d < 0.0f ? -1.0f : 1.0f;
+			d *= Sign;
+
+			float const t = Slerp ? batchSlerpFactor(d, a[i * StrideA]) : a[i * StrideA];
+			float const s = 1.0f - t;
+			float const u = t * Sign;
+
+			float const x = ax * s + bx * u;
+			float const y = ay * s + by * u;
+			float const z = az * s + bz * u;
+			float const w = aw * s + bw * u;
+			float const OneOverLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+
+			Out.x[i] = x * OneOverLength;
+			Out.y[i] = y * OneOverLength;
+			Out.z[i] = z * OneOverLength;
+			Out.w[i] = w * OneOverLength;
+		}
+	}
+
+	// Rotation part of mat4_cast, columns c0, c1 and c2.
+	inline void batchRotation_scalar(float x, float y, float z, float w, float Result[9])
+	{
+		float const xx = x * x, yy = y * y, zz = z * z;
+		float const xz = x * z, xy = x * y, yz = y * z;
+		float const wx = w * x, wy = w * y, wz = w * z;
+
+		Result[0] = 1.0f - 2.0f * (yy + zz);
+		Result[1] = 2.0f * (xy + wz);
+		Result[2] = 2.0f * (xz - wy);
+		Result[3] = 2.0f * (xy - wz);
+		Result[4] = 1.0f - 2.0f * (xx + zz);
+		Result[5] = 2.0f * (yz + wx);
+		Result[6] = 2.0f * (xz + wy);
+		Result[7] = 2.0f * (yz - wx);
+		Result[8] = 1.0f - 2.0f * (xx + yy);
+	}
+
+	inline void batchMat4Cast_scalar(soa_quat const& q, float* Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+		{
+			float r[9];
+			batchRotation_scalar(q.x[i], q.y[i], q.z[i], q.w[i], r);
+			float* m = Out + i * 16;
+			m[0] = r[0]; m[1] = r[1]; m[2] = r[2]; m[3] = 0.0f;
+			m[4] = r[3]; m[5] = r[4]; m[6] = r[5]; m[7] = 0.0f;
+			m[8] = r[6]; m[9] = r[7]; m[10] = r[8]; m[11] = 0.0f;
+			m[12] = 0.0f; m[13] = 0.0f; m[14] = 0.0f; m[15] = 1.0f;
+		}
+	}
+
+	inline void batchMat4Cast_scalar(soa_quat const& q, soa_mat4 const& Out, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+		{
+			float r[9];
+			batchRotation_scalar(q.x[i], q.y[i], q.z[i], q.w[i], r);
+			for(length_t c = 0; c < 3; ++c)
+			{
+				for(length_t k = 0; k < 3; ++k)
+					Out.c[c * 4 + k][i] = r[c * 3 + k];
+				Out.c[c * 4 + 3][i] = 0.0f;
+			}
+			Out.c[12][i] = 0.0f;
+			Out.c[13][i] = 0.0f;
+			Out.c[14][i] = 0.0f;
+			Out.c[15][i] = 1.0f;
+		}
+	}
+
+#	if GLM_BATCH_X86
+	inline __m128 batchSlerpFactor_sse2(__m128 d, __m128 a)
+	{
+		__m128 A = _mm_add_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(-1.43519f)));
+		A = _mm_add_ps(_mm_set1_ps(-3.2452f), _mm_mul_ps(d, A));
+		A = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(d, A));
+		__m128 B = _mm_add_ps(_mm_set1_ps(-1.06021f), _mm_mul_ps(d, _mm_set1_ps(0.215638f)));
+		B = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(d, B));
+		__m128 const h = _mm_sub_ps(a, _mm_set1_ps(0.5f));
+		__m128 const k = _mm_add_ps(_mm_mul_ps(A, _mm_mul_ps(h, h)), B);
+		__m128 const p = _mm_mul_ps(_mm_mul_ps(a, h), _mm_sub_ps(a, _mm_set1_ps(1.0f)));
+		return _mm_add_ps(a, _mm_mul_ps(p, k));
+	}
+
+	inline void batchBlend_sse2(soa_quat const& A, soa_quat const& B, float const* a, std::size_t StrideA, soa_quat const& Out, std::size_t First, std::size_t Last, bool Slerp)
+	{
+		__m128 const SignMask = _mm_set1_ps(-0.0f);
+		__m128 const One = _mm_set1_ps(1.0f);
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 const ax = _mm_loadu_ps(A.x + i), ay = _mm_loadu_ps(A.y + i), az = _mm_loadu_ps(A.z + i), aw = _mm_loadu_ps(A.w + i);
+			__m128 const bx = _mm_loadu_ps(B.x + i), by = _mm_loadu_ps(B.y + i), bz = _mm_loadu_ps(B.z + i), bw = _mm_loadu_ps(B.w + i);
+
+			__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			__m128 const Sign = _mm_and_ps(d, SignMask);
+			d = _mm_xor_ps(d, Sign);
+
+			__m128 t = StrideA ? _mm_loadu_ps(a + i) : _mm_set1_ps(*a);
+			if(Slerp)
+				t = batchSlerpFactor_sse2(d, t);
+			__m128 const s = _mm_sub_ps(One, t);
+			__m128 const u = _mm_xor_ps(t, Sign);
+
+			__m128 const x = _mm_add_ps(_mm_mul_ps(ax, s), _mm_mul_ps(bx, u));
+			__m128 const y = _mm_add_ps(_mm_mul_ps(ay, s), _mm_mul_ps(by, u));
+			__m128 const z = _mm_add_ps(_mm_mul_ps(az, s), _mm_mul_ps(bz, u));
+			__m128 const w = _mm_add_ps(_mm_mul_ps(aw, s), _mm_mul_ps(bw, u));
+			__m128 const Length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w))));
+
+			_mm_storeu_ps(Out.x + i, _mm_div_ps(x, Length));
+			_mm_storeu_ps(Out.y + i, _mm_div_ps(y, Length));
+			_mm_storeu_ps(Out.z + i, _mm_div_ps(z, Length));
+			_mm_storeu_ps(Out.w + i, _mm_div_ps(w, Length));
+		}
+		batchBlend_scalar(A, B, a, StrideA, Out, i, Last, Slerp);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline __m256 batchSlerpFactor_avx2(__m256 d, __m256 a)
+	{
+		__m256 A = _mm256_fmadd_ps(d, _mm256_set1_ps(-1.43519f), _mm256_set1_ps(3.55645f));
+		A = _mm256_fmadd_ps(d, A, _mm256_set1_ps(-3.2452f));
+		A = _mm256_fmadd_ps(d, A, _mm256_set1_ps(1.0904f));
+		__m256 B = _mm256_fmadd_ps(d, _mm256_set1_ps(0.215638f), _mm256_set1_ps(-1.06021f));
+		B = _mm256_fmadd_ps(d, B, _mm256_set1_ps(0.848013f));
+		__m256 const h = _mm256_sub_ps(a, _mm256_set1_ps(0.5f));
+		__m256 const k = _mm256_fmadd_ps(A, _mm256_mul_ps(h, h), B);
+		__m256 const p = _mm256_mul_ps(_mm256_mul_ps(a, h), _mm256_sub_ps(a, _mm256_set1_ps(1.0f)));
+		return _mm256_fmadd_ps(p, k, a);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchBlend_avx2(soa_quat const& A, soa_quat const& B, float const* a, std::size_t StrideA, soa_quat const& Out, std::size_t First, std::size_t Last, bool Slerp)
+	{
+		__m256 const SignMask = _mm256_set1_ps(-0.0f);
+		__m256 const One = _mm256_set1_ps(1.0f);
+
+		std::size_t i = First;
+		for(; i + 8 <= Last; i += 8)
+		{
+			__m256 const ax = _mm256_loadu_ps(A.x + i), ay = _mm256_loadu_ps(A.y + i), az = _mm256_loadu_ps(A.z + i), aw = _mm256_loadu_ps(A.w + i);
+			__m256 const bx = _mm256_loadu_ps(B.x + i), by = _mm256_loadu_ps(B.y + i), bz = _mm256_loadu_ps(B.z + i), bw = _mm256_loadu_ps(B.w + i);
+
+			__m256 d = _mm256_mul_ps(ax, bx);
+			d = _mm256_fmadd_ps(ay, by, d);
+			d = _mm256_fmadd_ps(az, bz, d);
+			d = _mm256_fmadd_ps(aw, bw, d);
+			__m256 const Sign = _mm256_and_ps(d, SignMask);
+			d = _mm256_xor_ps(d, Sign);
+
+			__m256 t = StrideA ? _mm256_loadu_ps(a + i) : _mm256_set1_ps(*a);
+			if(Slerp)
+				t = batchSlerpFactor_avx2(d, t);
+			__m256 const s = _mm256_sub_ps(One, t);
+			__m256 const u = _mm256_xor_ps(t, Sign);
+
+			__m256 const x = _mm256_fmadd_ps(ax, s, _mm256_mul_ps(bx, u));
+			__m256 const y = _mm256_fmadd_ps(ay, s, _mm256_mul_ps(by, u));
+			__m256 const z = _mm256_fmadd_ps(az, s, _mm256_mul_ps(bz, u));
+			__m256 const w = _mm256_fmadd_ps(aw, s, _mm256_mul_ps(bw, u));
+			__m256 Dot = _mm256_mul_ps(x, x);
+			Dot = _mm256_fmadd_ps(y, y, Dot);
+			Dot = _mm256_fmadd_ps(z, z, Dot);
+			Dot = _mm256_fmadd_ps(w, w, Dot);
+			__m256 const Length = _mm256_sqrt_ps(Dot);
+
+			_mm256_storeu_ps(Out.x + i, _mm256_div_ps(x, Length));
+			_mm256_storeu_ps(Out.y + i, _mm256_div_ps(y, Length));
+			_mm256_storeu_ps(Out.z + i, _mm256_div_ps(z, Length));
+			_mm256_storeu_ps(Out.w + i, _mm256_div_ps(w, Length));
+		}
+		batchBlend_scalar(A, B, a, StrideA, Out, i, Last, Slerp);
+	}
+
+	// Rotation part of mat4_cast for 4 quaternions, r[c * 3 + k] holds column c, row k.
+	inline void batchRotation_sse2(soa_quat const& q, std::size_t i, __m128 r[9])
+	{
+		__m128 const x = _mm_loadu_ps(q.x + i), y = _mm_loadu_ps(q.y + i), z = _mm_loadu_ps(q.z + i), w = _mm_loadu_ps(q.w + i);
+		__m128 const One = _mm_set1_ps(1.0f);
+		__m128 const Two = _mm_set1_ps(2.0f);
+
+		__m128 const xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+		__m128 const xz = _mm_mul_ps(x, z), xy = _mm_mul_ps(x, y), yz = _mm_mul_ps(y, z);
+		__m128 const wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+		r[0] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(yy, zz)));
+		r[1] = _mm_mul_ps(Two, _mm_add_ps(xy, wz));
+		r[2] = _mm_mul_ps(Two, _mm_sub_ps(xz, wy));
+		r[3] = _mm_mul_ps(Two, _mm_sub_ps(xy, wz));
+		r[4] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(xx, zz)));
+		r[5] = _mm_mul_ps(Two, _mm_add_ps(yz, wx));
+		r[6] = _mm_mul_ps(Two, _mm_add_ps(xz, wy));
+		r[7] = _mm_mul_ps(Two, _mm_sub_ps(yz, wx));
+		r[8] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(xx, yy)));
+	}
+
+	inline void batchMat4Cast_sse2(soa_quat const& q, float* Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const Translation = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 r[9];
+			batchRotation_sse2(q, i, r);
+
+			// Transpose each column from one register per row to one register per matrix.
+			for(length_t c = 0; c < 3; ++c)
+			{
+				__m128 m0 = r[c * 3], m1 = r[c * 3 + 1], m2 = r[c * 3 + 2], m3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+				_mm_storeu_ps(Out + (i + 0) * 16 + c * 4, m0);
+				_mm_storeu_ps(Out + (i + 1) * 16 + c * 4, m1);
+				_mm_storeu_ps(Out + (i + 2) * 16 + c * 4, m2);
+				_mm_storeu_ps(Out + (i + 3) * 16 + c * 4, m3);
+			}
+			for(std::size_t k = 0; k < 4; ++k)
+				_mm_storeu_ps(Out + (i + k) * 16 + 12, Translation);
+		}
+		batchMat4Cast_scalar(q, Out, i, Last);
+	}
+
+	inline void batchMat4Cast_sse2(soa_quat const& q, soa_mat4 const& Out, std::size_t First, std::size_t Last)
+	{
+		__m128 const Zero = _mm_setzero_ps();
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 r[9];
+			batchRotation_sse2(q, i, r);
+			for(length_t c = 0; c < 3; ++c)
+			{
+				for(length_t k = 0; k < 3; ++k)
+					_mm_storeu_ps(Out.c[c * 4 + k] + i, r[c * 3 + k]);
+				_mm_storeu_ps(Out.c[c * 4 + 3] + i, Zero);
+			}
+			_mm_storeu_ps(Out.c[12] + i, Zero);
+			_mm_storeu_ps(Out.c[13] + i, Zero);
+			_mm_storeu_ps(Out.c[14] + i, Zero);
+			_mm_storeu_ps(Out.c[15] + i, _mm_set1_ps(1.0f));
+		}
+		batchMat4Cast_scalar(q, Out, i, Last);
+	}
+#	endif//GLM_BATCH_X86
+
+	inline void batchBlend_dispatch(soa_quat const& A, soa_quat const& B, float const* a, std::size_t StrideA, soa_quat const& Out, std::size_t First, std::size_t Last, bool Slerp)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				batchBlend_avx2(A, B, a, StrideA, Out, First, Last, Slerp);
+			else
+				batchBlend_sse2(A, B, a, StrideA, Out, First, Last, Slerp);
+#		else
+			batchBlend_scalar(A, B, a, StrideA, Out, First, Last, Slerp);
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void batchNlerp(soa_quat const& A, soa_quat const& B, float const* a, soa_quat const& Out, std::size_t First, std::size_t Last)
+	{
+		detail::batchBlend_dispatch(A, B, a, 1, Out, First, Last, false);
+	}
+
+	GLM_FUNC_QUALIFIER void batchNlerp(soa_quat const& A, soa_quat const& B, float a, soa_quat const& Out, std::size_t First, std::size_t Last)
+	{
+		detail::batchBlend_dispatch(A, B, &a, 0, Out, First, Last, false);
+	}
+
+	GLM_FUNC_QUALIFIER void batchFastSlerp(soa_quat const& A, soa_quat const& B, float const* a, soa_quat const& Out, std::size_t First, std::size_t Last)
+	{
+		detail::batchBlend_dispatch(A, B, a, 1, Out, First, Last, true);
+	}
+
+	GLM_FUNC_QUALIFIER void batchFastSlerp(soa_quat const& A, soa_quat const& B, float a, soa_quat const& Out, std::size_t First, std::size_t Last)
+	{
+		detail::batchBlend_dispatch(A, B, &a, 0, Out, First, Last, true);
+	}
+
+	GLM_FUNC_QUALIFIER void batchMat4Cast(soa_quat const& q, mat<4, 4, float, defaultp>* Out, std::size_t First, std::size_t Last)
+	{
+		if(First >= Last)
+			return;
+#		if GLM_BATCH_X86
+			detail::batchMat4Cast_sse2(q, &Out[0][0][0], First, Last);
+#		else
+			detail::batchMat4Cast_scalar(q, &Out[0][0][0], First, Last);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchMat4Cast(soa_quat const& q, soa_mat4 const& Out, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			detail::batchMat4Cast_sse2(q, Out, First, Last);
+#		else
+			detail::batchMat4Cast_scalar(q, Out, First, Last);
+#		endif
+	}
+}//namespace glm
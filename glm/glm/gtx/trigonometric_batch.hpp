@@ -0,0 +1,77 @@
+/// @ref gtx_trigonometric_batch
+/// @file glm/gtx/trigonometric_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_trigonometric_batch GLM_GTX_trigonometric_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/trigonometric_batch.hpp> to use the features of this extension.
+///
+/// Sine and cosine of float arrays and rotation matrices built from them.
+///
+/// Angles are reduced to [-pi/4, pi/4] with a two constants Cody-Waite reduction in double
+/// precision then evaluated with the Cephes minimax polynomials, 4 lanes with SSE2 or 8 lanes
+/// with AVX2/FMA (selected like GLM_GTX_matrix_batch). Lanes with |angle| > 2^20 or non finite
+/// fall back to std::sin and std::cos, so every float input is handled.
+///
+/// Maximum error compared to the exact result, measured by tools/trig on every float in [-2^20, 2^20]:
+/// 1.6 ulp for sin and cos, and 1e-7 absolute error.
+/// GLM_GTX_fast_trigonometry is less accurate, its absolute error is 7e-6 in [-pi, pi] and grows with
+/// the angle: 1.5e-5 in [-100, 100], 7e-5 in [-1000, 1000].
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "matrix_batch.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_trigonometric_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_trigonometric_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_trigonometric_batch
+	/// @{
+
+	/// Computes Sin[i] = sin(Angles[i]) and Cos[i] = cos(Angles[i]) for i in [First, Last).
+	/// Angles are in radians. Sin or Cos may alias Angles.
+	/// From GLM_GTX_trigonometric_batch extension.
+	GLM_FUNC_DECL void batchSinCos(
+		float const* Angles,
+		float* Sin,
+		float* Cos,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = rotate(mat4(1), Angles[i], Axis) for i in [First, Last).
+	/// Angles are in radians, Axis doesn't need to be normalized.
+	/// From GLM_GTX_trigonometric_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchRotate(
+		float const* Angles,
+		vec<3, float, Q> const& Axis,
+		mat<4, 4, float, Q>* Out,
+		std::size_t First, std::size_t Last);
+
+	/// Computes Out[i] = rotate(m[i], Angles[i], Axis) for i in [First, Last).
+	/// Out may alias m.
+	/// From GLM_GTX_trigonometric_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void batchRotate(
+		mat<4, 4, float, Q> const* m,
+		float const* Angles,
+		vec<3, float, Q> const& Axis,
+		mat<4, 4, float, Q>* Out,
+		std::size_t First, std::size_t Last);
+
+	/// @}
+}//namespace glm
+
+#include "trigonometric_batch.inl"
@@ -0,0 +1,230 @@
+/// @ref gtx_trigonometric_batch
+
+namespace glm{
+namespace detail
+{
+	// The reduction is done in double precision: pi/2 is split in a 33 bits part, exactly multiplied
+	// by quadrant numbers up to 2^20, and the remaining bits.
+	static double const batchPio2_1 = 1.5707963267341256;
+	static double const batchPio2_2 = 6.077100506506192e-11;
+	static double const batchTwoOverPi = 0.63661977236758134;
+	static float const batchReduceLimit = 1048576.0f;
+
+	// Cephes minimax coefficients on [-pi/4, pi/4].
+	static float const batchSin1 = -1.9515295891e-4f;
+	static float const batchSin2 = 8.3321608736e-3f;
+	static float const batchSin3 = -1.6666654611e-1f;
+	static float const batchCos1 = 2.443315711809948e-5f;
+	static float const batchCos2 = -1.388731625493765e-3f;
+	static float const batchCos3 = 4.166664568298827e-2f;
+
+	inline void batchSinCos_scalar(float x, float& s, float& c)
+	{
+		if(!(std::abs(x) <= batchReduceLimit))
+		{
+			s = std::sin(x);
+			c = std::cos(x);
+			return;
+		}
+
+		double const j = std::floor(static_cast<double>(x) * batchTwoOverPi + 0.5);
+		int const q = static_cast<int>(j);
+		float const r = static_cast<float>((static_cast<double>(x) - j * batchPio2_1) - j * batchPio2_2);
+		float const r2 = r * r;
+		float const ps = r + r * r2 * (batchSin3 + r2 * (batchSin2 + r2 * batchSin1));
+		float const pc = 1.0f - 0.5f * r2 + r2 * r2 * (batchCos3 + r2 * (batchCos2 + r2 * batchCos1));
+
+		switch(q & 3)
+		{
+		case 0: s = ps; c = pc; break;
+		case 1: s = pc; c = -ps; break;
+		case 2: s = -ps; c = -pc; break;
+		default: s = -pc; c = ps; break;
+		}
+	}
+
+	inline void batchSinCos_scalar(float const* Angles, float* Sin, float* Cos, std::size_t First, std::size_t Last)
+	{
+		for(std::size_t i = First; i < Last; ++i)
+			batchSinCos_scalar(Angles[i], Sin[i], Cos[i]);
+	}
+
+#	if GLM_BATCH_X86
+	inline void batchSinCos_sse2(float const* Angles, float* Sin, float* Cos, std::size_t First, std::size_t Last)
+	{
+		__m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		std::size_t i = First;
+		for(; i + 4 <= Last; i += 4)
+		{
+			__m128 const x = _mm_loadu_ps(Angles + i);
+
+			__m128d const xl = _mm_cvtps_pd(x);
+			__m128d const xh = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+			__m128i const ql = _mm_cvtpd_epi32(_mm_mul_pd(xl, _mm_set1_pd(batchTwoOverPi)));
+			__m128i const qh = _mm_cvtpd_epi32(_mm_mul_pd(xh, _mm_set1_pd(batchTwoOverPi)));
+			__m128d const jl = _mm_cvtepi32_pd(ql);
+			__m128d const jh = _mm_cvtepi32_pd(qh);
+			__m128d const rl = _mm_sub_pd(_mm_sub_pd(xl, _mm_mul_pd(jl, _mm_set1_pd(batchPio2_1))), _mm_mul_pd(jl, _mm_set1_pd(batchPio2_2)));
+			__m128d const rh = _mm_sub_pd(_mm_sub_pd(xh, _mm_mul_pd(jh, _mm_set1_pd(batchPio2_1))), _mm_mul_pd(jh, _mm_set1_pd(batchPio2_2)));
+
+			__m128i const q = _mm_unpacklo_epi64(ql, qh);
+			__m128 const r = _mm_movelh_ps(_mm_cvtpd_ps(rl), _mm_cvtpd_ps(rh));
+			__m128 const r2 = _mm_mul_ps(r, r);
+
+			__m128 ps = _mm_add_ps(_mm_set1_ps(batchSin2), _mm_mul_ps(r2, _mm_set1_ps(batchSin1)));
+			ps = _mm_add_ps(_mm_set1_ps(batchSin3), _mm_mul_ps(r2, ps));
+			ps = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), ps));
+
+			__m128 pc = _mm_add_ps(_mm_set1_ps(batchCos2), _mm_mul_ps(r2, _mm_set1_ps(batchCos1)));
+			pc = _mm_add_ps(_mm_set1_ps(batchCos3), _mm_mul_ps(r2, pc));
+			pc = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), pc));
+
+			// Odd quadrants swap sin and cos, sin is negated in quadrants 2 and 3, cos in 1 and 2.
+			__m128 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			__m128 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+			__m128 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+			__m128 const s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, pc), _mm_andnot_ps(Swap, ps)), SinSign);
+			__m128 const c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, ps), _mm_andnot_ps(Swap, pc)), CosSign);
+
+			// Large or non finite angles, the comparison is false for NaN.
+			int const Fallback = _mm_movemask_ps(_mm_cmpnle_ps(_mm_and_ps(x, AbsMask), _mm_set1_ps(batchReduceLimit)));
+
+			_mm_storeu_ps(Sin + i, s);
+			_mm_storeu_ps(Cos + i, c);
+
+			if(Fallback)
+			{
+				float In[4];
+				_mm_storeu_ps(In, x);
+				for(int k = 0; k < 4; ++k)
+					if(Fallback & (1 << k))
+						batchSinCos_scalar(In[k], Sin[i + k], Cos[i + k]);
+			}
+		}
+		batchSinCos_scalar(Angles, Sin, Cos, i, Last);
+	}
+
+	GLM_BATCH_AVX2_TARGET inline void batchSinCos_avx2(float const* Angles, float* Sin, float* Cos, std::size_t First, std::size_t Last)
+	{
+		__m256 const AbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+		std::size_t i = First;
+		for(; i + 8 <= Last; i += 8)
+		{
+			__m256 const x = _mm256_loadu_ps(Angles + i);
+
+			__m256d const xl = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+			__m256d const xh = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+			__m128i const ql = _mm256_cvtpd_epi32(_mm256_mul_pd(xl, _mm256_set1_pd(batchTwoOverPi)));
+			__m128i const qh = _mm256_cvtpd_epi32(_mm256_mul_pd(xh, _mm256_set1_pd(batchTwoOverPi)));
+			__m256d const jl = _mm256_cvtepi32_pd(ql);
+			__m256d const jh = _mm256_cvtepi32_pd(qh);
+			__m256d const rl = _mm256_fnmadd_pd(jl, _mm256_set1_pd(batchPio2_2), _mm256_fnmadd_pd(jl, _mm256_set1_pd(batchPio2_1), xl));
+			__m256d const rh = _mm256_fnmadd_pd(jh, _mm256_set1_pd(batchPio2_2), _mm256_fnmadd_pd(jh, _mm256_set1_pd(batchPio2_1), xh));
+
+			__m256i const q = _mm256_inserti128_si256(_mm256_castsi128_si256(ql), qh, 1);
+			__m256 const r = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(rl)), _mm256_cvtpd_ps(rh), 1);
+			__m256 const r2 = _mm256_mul_ps(r, r);
+
+			__m256 ps = _mm256_fmadd_ps(r2, _mm256_set1_ps(batchSin1), _mm256_set1_ps(batchSin2));
+			ps = _mm256_fmadd_ps(r2, ps, _mm256_set1_ps(batchSin3));
+			ps = _mm256_fmadd_ps(_mm256_mul_ps(r, r2), ps, r);
+
+			__m256 pc = _mm256_fmadd_ps(r2, _mm256_set1_ps(batchCos1), _mm256_set1_ps(batchCos2));
+			pc = _mm256_fmadd_ps(r2, pc, _mm256_set1_ps(batchCos3));
+			pc = _mm256_fmadd_ps(_mm256_mul_ps(r2, r2), pc, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), r2, _mm256_set1_ps(1.0f)));
+
+			__m256 const Swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+			__m256 const SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+			__m256 const CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+			__m256 const s = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, Swap), SinSign);
+			__m256 const c = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, Swap), CosSign);
+
+			int const Fallback = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(x, AbsMask), _mm256_set1_ps(batchReduceLimit), _CMP_NLE_UQ));
+
+			_mm256_storeu_ps(Sin + i, s);
+			_mm256_storeu_ps(Cos + i, c);
+
+			if(Fallback)
+			{
+				float In[8];
+				_mm256_storeu_ps(In, x);
+				for(int k = 0; k < 8; ++k)
+					if(Fallback & (1 << k))
+						batchSinCos_scalar(In[k], Sin[i + k], Cos[i + k]);
+			}
+		}
+		batchSinCos_scalar(Angles, Sin, Cos, i, Last);
+	}
+#	endif//GLM_BATCH_X86
+
+	// Same terms as rotate(mat4(1), angle, v) with v normalized.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, float, Q> batchRotation(float s, float c, vec<3, float, Q> const& axis)
+	{
+		vec<3, float, Q> const temp((1.0f - c) * axis);
+
+		mat<4, 4, float, Q> Result(1.0f);
+		Result[0][0] = c + temp[0] * axis[0];
+		Result[0][1] = temp[0] * axis[1] + s * axis[2];
+		Result[0][2] = temp[0] * axis[2] - s * axis[1];
+
+		Result[1][0] = temp[1] * axis[0] - s * axis[2];
+		Result[1][1] = c + temp[1] * axis[1];
+		Result[1][2] = temp[1] * axis[2] + s * axis[0];
+
+		Result[2][0] = temp[2] * axis[0] + s * axis[1];
+		Result[2][1] = temp[2] * axis[1] - s * axis[0];
+		Result[2][2] = c + temp[2] * axis[2];
+		return Result;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void batchSinCos(float const* Angles, float* Sin, float* Cos, std::size_t First, std::size_t Last)
+	{
+#		if GLM_BATCH_X86
+			if(batchIsa() == BATCH_ISA_AVX2)
+				detail::batchSinCos_avx2(Angles, Sin, Cos, First, Last);
+			else
+				detail::batchSinCos_sse2(Angles, Sin, Cos, First, Last);
+#		else
+			detail::batchSinCos_scalar(Angles, Sin, Cos, First, Last);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchRotate(float const* Angles, vec<3, float, Q> const& Axis, mat<4, 4, float, Q>* Out, std::size_t First, std::size_t Last)
+	{
+		vec<3, float, Q> const axis(normalize(Axis));
+
+		// Sines and cosines are computed by chunks small enough to stay on the stack.
+		float Sin[64];
+		float Cos[64];
+		for(std::size_t Chunk = First; Chunk < Last; Chunk += 64)
+		{
+			std::size_t const Count = Last - Chunk < 64 ? Last - Chunk : 64;
+			batchSinCos(Angles + Chunk, Sin, Cos, 0, Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[Chunk + i] = detail::batchRotation(Sin[i], Cos[i], axis);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batchRotate(mat<4, 4, float, Q> const* m, float const* Angles, vec<3, float, Q> const& Axis, mat<4, 4, float, Q>* Out, std::size_t First, std::size_t Last)
+	{
+		vec<3, float, Q> const axis(normalize(Axis));
+
+		float Sin[64];
+		float Cos[64];
+		mat<4, 4, float, Q> Rotation[64];
+		for(std::size_t Chunk = First; Chunk < Last; Chunk += 64)
+		{
+			std::size_t const Count = Last - Chunk < 64 ? Last - Chunk : 64;
+			batchSinCos(Angles + Chunk, Sin, Cos, 0, Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Rotation[i] = detail::batchRotation(Sin[i], Cos[i], axis);
+			batchMul(m + Chunk, Rotation, Out + Chunk, Count);
+		}
+	}
+}//namespace glm
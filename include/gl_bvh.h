@@ -0,0 +1,902 @@
+// Bounding volume hierarchy
+//
+// Spatial index over the bounding boxes of a scene's objects, for frustum
+// culling, ray picking and proximity queries in logarithmic rather than
+// linear time.
+//
+// The tree is built top down with the surface area heuristic, binning
+// object centers into 16 slabs per axis to pick each split. Large subtrees
+// are built on their own threads, and the binning of the largest nodes is
+// split between threads too. The binary tree is then collapsed into nodes
+// of 4 children whose boxes are stored as arrays of 4 floats, so that one
+// node is tested with a few vector ops (SSE on x86, NEON on ARM). Nodes are
+// laid out depth first, each subtree is a contiguous range of nodes and of
+// objects, and the leaves reference a copy of the object boxes in the same
+// order: queries read memory mostly forward.
+//
+// When objects move, refit() recomputes the boxes bottom up without
+// changing the tree, much cheaper than a build but the tree degrades as
+// objects wander away from where it was built.
+//
+// Rays follow glm/gtx/intersect.hpp: the distance is along the direction,
+// in its units, and hits closer than epsilon are ignored. castRays() takes
+// a per object test with the signature of the glm functions, e.g.
+// glm::intersectRaySphere, or uses intersectRayBox.
+//
+// Header only, needs glm and no GL.
+//
+//     gl::Bvh bvh;
+//     bvh.build(bounds.data(), bounds.size());
+//     bvh.cullFrustum(projection * view, visible);
+//     bvh.castRays(rays.data(), rays.size(), hits.data());
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace gl {
+
+struct Bounds
+{
+    glm::vec3 low;
+    glm::vec3 high;
+};
+
+struct Ray
+{
+    glm::vec3 origin;
+    glm::vec3 direction;
+};
+
+struct RayHit
+{
+    static constexpr std::uint32_t none = 0xffffffffu;
+
+    std::uint32_t object = none;
+    float distance = std::numeric_limits<float>::infinity();
+};
+
+namespace detail {
+
+inline bool bvhIntersectSlabs(const glm::vec3& origin, const glm::vec3& inverse, const glm::vec3& low,
+                              const glm::vec3& high, float& distance)
+{
+    const float epsilon = std::numeric_limits<float>::epsilon();
+    const glm::vec3 t0 = (low - origin) * inverse;
+    const glm::vec3 t1 = (high - origin) * inverse;
+    const glm::vec3 near = glm::min(t0, t1);
+    const glm::vec3 far = glm::max(t0, t1);
+    const float entry = std::max(std::max(near.x, near.y), near.z);
+    const float exit = std::min(std::min(far.x, far.y), far.z);
+    if(!(entry <= exit)) {
+        return false;
+    }
+    distance = entry > epsilon ? entry : exit;
+    return distance > epsilon;
+}
+
+} // namespace detail
+
+// Ray and box, with the semantics of glm::intersectRaySphere: the distance
+// to the entry point along direction, to the exit point when the ray starts
+// inside, false when behind.
+inline bool intersectRayBox(const glm::vec3& origin, const glm::vec3& direction,
+                            const glm::vec3& low, const glm::vec3& high, float& distance)
+{
+    return detail::bvhIntersectSlabs(origin, 1.0f / direction, low, high, distance);
+}
+
+// 4 children, boxes as arrays so that a node is tested at once.
+struct alignas(64) BvhNode
+{
+    static constexpr std::uint32_t empty = 0xffffffffu;
+
+    float lowX[4], lowY[4], lowZ[4];
+    float highX[4], highY[4], highZ[4];
+    std::uint32_t child[4];     // node index, first object of a leaf, or empty
+    std::uint32_t count[4];     // objects in a leaf, 0 for a node
+};
+
+namespace detail {
+
+typedef float BvhFloat4 __attribute__((vector_size(16)));
+typedef std::int32_t BvhInt4 __attribute__((vector_size(16)));
+
+inline BvhFloat4 bvhLoad(const float* values)
+{
+    BvhFloat4 result;
+    __builtin_memcpy(&result, values, sizeof(result));
+    return result;
+}
+
+inline BvhFloat4 bvhSplat(float value) { return BvhFloat4{ value, value, value, value }; }
+
+inline BvhFloat4 bvhMin(BvhFloat4 a, BvhFloat4 b)
+{
+    const BvhInt4 less = a < b;
+    return (BvhFloat4)(((BvhInt4)a & less) | ((BvhInt4)b & ~less));
+}
+
+inline BvhFloat4 bvhMax(BvhFloat4 a, BvhFloat4 b)
+{
+    const BvhInt4 greater = a > b;
+    return (BvhFloat4)(((BvhInt4)a & greater) | ((BvhInt4)b & ~greater));
+}
+
+inline Bounds bvhUnion(const Bounds& a, const Bounds& b)
+{
+    return { glm::min(a.low, b.low), glm::max(a.high, b.high) };
+}
+
+inline Bounds bvhEmptyBounds()
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+    return { glm::vec3(infinity), glm::vec3(-infinity) };
+}
+
+inline float bvhHalfArea(const Bounds& bounds)
+{
+    const glm::vec3 extent = glm::max(bounds.high - bounds.low, glm::vec3(0.0f));
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Runs task(i) for i in [0, count) on count threads, the last on the caller.
+template<typename Task>
+void bvhParallel(unsigned int count, const Task& task)
+{
+    std::vector<std::thread> threads;
+    for(unsigned int i = 0; i + 1 < count; i++) {
+        threads.emplace_back([&task, i]() { task(i); });
+    }
+    if(count > 0) {
+        task(count - 1);
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace detail
+
+class Bvh
+{
+public:
+    static constexpr unsigned int binCount = 16;
+    static constexpr unsigned int maxLeafSize = 8;
+
+    // Builds the tree over count boxes. threadCount 0 uses every core.
+    void build(const Bounds* bounds, std::size_t count, unsigned int threadCount = 0)
+    {
+        threads = threadCount != 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+        nodes.clear();
+        objects.resize(count);
+        leafBounds.resize(count);
+        if(count == 0) {
+            return;
+        }
+
+        BuildState state;
+        state.bounds = bounds;
+        state.centers.resize(count);
+        for(std::size_t i = 0; i < count; i++) {
+            objects[i] = std::uint32_t(i);
+            state.centers[i] = (bounds[i].low + bounds[i].high) * 0.5f;
+        }
+        state.nodes.resize(2 * count);
+        state.nodeCount = 1;
+        state.spareThreads = int(threads) - 1;
+
+        Bounds centerBounds = { state.centers[0], state.centers[0] };
+        Bounds rootBounds = bounds[0];
+        for(std::size_t i = 1; i < count; i++) {
+            centerBounds.low = glm::min(centerBounds.low, state.centers[i]);
+            centerBounds.high = glm::max(centerBounds.high, state.centers[i]);
+            rootBounds = detail::bvhUnion(rootBounds, bounds[i]);
+        }
+        state.nodes[0].bounds = rootBounds;
+        buildBinary(state, 0, 0, std::uint32_t(count), centerBounds);
+
+        // 4 wide nodes, depth first
+        const BuildNode& root = state.nodes[0];
+        if(root.count != 0) {
+            // a single leaf still gets a node, queries start from one
+            nodes.resize(1);
+            clearNode(nodes[0]);
+            setSlot(nodes[0], 0, root.bounds, root.first, root.count);
+        }
+        else {
+            nodes.reserve(count / 2 + 1);
+            collapse(state, 0);
+        }
+        for(std::size_t i = 0; i < count; i++) {
+            leafBounds[i] = bounds[objects[i]];
+        }
+    }
+
+    // Recomputes the boxes for the objects' new bounds, same count and
+    // order as given to build().
+    void refit(const Bounds* bounds)
+    {
+        if(nodes.empty()) {
+            return;
+        }
+        const unsigned int chunks = threads;
+        detail::bvhParallel(chunks, [&](unsigned int chunk) {
+            const std::size_t first = objects.size() * chunk / chunks;
+            const std::size_t last = objects.size() * (chunk + 1) / chunks;
+            for(std::size_t i = first; i < last; i++) {
+                leafBounds[i] = bounds[objects[i]];
+            }
+        });
+
+        // subtrees are contiguous ranges of nodes, children after their
+        // parent: each is refit backwards on its own thread, the few nodes
+        // above them last
+        std::vector<std::uint32_t> roots;
+        std::vector<std::uint32_t> top;
+        collectRefitRoots(0, std::size_t(4) * threads, top, roots);
+
+        std::atomic<std::size_t> next{ 0 };
+        detail::bvhParallel(threads, [&](unsigned int) {
+            for(;;) {
+                const std::size_t i = next.fetch_add(1);
+                if(i >= roots.size()) {
+                    break;
+                }
+                const std::uint32_t end = subtreeEnd(roots[i]);
+                for(std::uint32_t n = end; n-- > roots[i];) {
+                    refitNode(nodes[n]);
+                }
+            }
+        });
+        for(std::size_t i = top.size(); i-- > 0;) {
+            refitNode(nodes[top[i]]);
+        }
+    }
+
+    bool empty() const { return nodes.empty(); }
+    std::size_t nodeCount() const { return nodes.size(); }
+    const std::vector<BvhNode>& nodeArray() const { return nodes; }
+
+    // Objects in leaf order, leaves and subtrees are ranges of it.
+    const std::vector<std::uint32_t>& objectOrder() const { return objects; }
+
+    Bounds bounds() const
+    {
+        Bounds result = detail::bvhEmptyBounds();
+        if(!nodes.empty()) {
+            for(int slot = 0; slot < 4; slot++) {
+                result = detail::bvhUnion(result, slotBounds(nodes[0], slot));
+            }
+        }
+        return result;
+    }
+
+    // Appends the objects whose box intersects the frustum of
+    // viewProjection. Conservative near the corners of the frustum, like
+    // any plane test.
+    void cullFrustum(const glm::mat4& viewProjection, std::vector<std::uint32_t>& visible) const
+    {
+        if(nodes.empty()) {
+            return;
+        }
+        // Gribb and Hartmann, normals pointing inside
+        const glm::mat4 m = glm::transpose(viewProjection);
+        const glm::vec4 planes[6] = { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] };
+
+        struct Entry
+        {
+            std::uint32_t node;
+            std::uint32_t planes;   // bit set: still to be tested
+        };
+        Entry stack[64 * 3];
+        int size = 0;
+        stack[size++] = { 0, 0x3f };
+        while(size > 0) {
+            const Entry entry = stack[--size];
+            const BvhNode& node = nodes[entry.node];
+            const detail::BvhFloat4 lowX = detail::bvhLoad(node.lowX), lowY = detail::bvhLoad(node.lowY), lowZ = detail::bvhLoad(node.lowZ);
+            const detail::BvhFloat4 highX = detail::bvhLoad(node.highX), highY = detail::bvhLoad(node.highY), highZ = detail::bvhLoad(node.highZ);
+
+            detail::BvhInt4 outside = { 0, 0, 0, 0 };
+            detail::BvhInt4 inside[6];
+            for(int p = 0; p < 6; p++) {
+                inside[p] = detail::BvhInt4{ -1, -1, -1, -1 };
+                if((entry.planes & (1u << p)) == 0) {
+                    continue;
+                }
+                const glm::vec4& plane = planes[p];
+                // farthest corner along the normal, and nearest
+                const detail::BvhFloat4 far = detail::bvhSplat(plane.x) * (plane.x > 0.0f ? highX : lowX)
+                                            + detail::bvhSplat(plane.y) * (plane.y > 0.0f ? highY : lowY)
+                                            + detail::bvhSplat(plane.z) * (plane.z > 0.0f ? highZ : lowZ)
+                                            + detail::bvhSplat(plane.w);
+                const detail::BvhFloat4 near = detail::bvhSplat(plane.x) * (plane.x > 0.0f ? lowX : highX)
+                                             + detail::bvhSplat(plane.y) * (plane.y > 0.0f ? lowY : highY)
+                                             + detail::bvhSplat(plane.z) * (plane.z > 0.0f ? lowZ : highZ)
+                                             + detail::bvhSplat(plane.w);
+                outside |= far < detail::bvhSplat(0.0f);
+                inside[p] = near >= detail::bvhSplat(0.0f);
+            }
+
+            for(int slot = 3; slot >= 0; slot--) {
+                if(node.child[slot] == BvhNode::empty || outside[slot] != 0) {
+                    continue;
+                }
+                std::uint32_t remaining = 0;
+                for(int p = 0; p < 6; p++) {
+                    remaining |= inside[p][slot] != 0 ? 0u : (1u << p) & entry.planes;
+                }
+                if(node.count[slot] != 0) {
+                    appendLeaf(node.child[slot], node.count[slot], remaining, planes, visible);
+                }
+                else if(remaining == 0) {
+                    // entirely inside, every object of the subtree
+                    const std::uint32_t first = firstObject(node.child[slot]);
+                    const std::uint32_t last = lastObject(node.child[slot]);
+                    visible.insert(visible.end(), objects.begin() + first, objects.begin() + last);
+                }
+                else {
+                    stack[size++] = { node.child[slot], remaining };
+                }
+            }
+        }
+    }
+
+    // Appends the objects whose box overlaps query.
+    void queryBounds(const Bounds& query, std::vector<std::uint32_t>& found) const
+    {
+        if(nodes.empty()) {
+            return;
+        }
+        std::uint32_t stack[64 * 3];
+        int size = 0;
+        stack[size++] = 0;
+        while(size > 0) {
+            const BvhNode& node = nodes[stack[--size]];
+            const detail::BvhInt4 overlap = (detail::bvhLoad(node.lowX) <= detail::bvhSplat(query.high.x))
+                                          & (detail::bvhLoad(node.highX) >= detail::bvhSplat(query.low.x))
+                                          & (detail::bvhLoad(node.lowY) <= detail::bvhSplat(query.high.y))
+                                          & (detail::bvhLoad(node.highY) >= detail::bvhSplat(query.low.y))
+                                          & (detail::bvhLoad(node.lowZ) <= detail::bvhSplat(query.high.z))
+                                          & (detail::bvhLoad(node.highZ) >= detail::bvhSplat(query.low.z));
+            for(int slot = 3; slot >= 0; slot--) {
+                if(node.child[slot] == BvhNode::empty || overlap[slot] == 0) {
+                    continue;
+                }
+                if(node.count[slot] == 0) {
+                    stack[size++] = node.child[slot];
+                    continue;
+                }
+                for(std::uint32_t i = node.child[slot]; i < node.child[slot] + node.count[slot]; i++) {
+                    const Bounds& b = leafBounds[i];
+                    if(b.low.x <= query.high.x && b.high.x >= query.low.x && b.low.y <= query.high.y
+                       && b.high.y >= query.low.y && b.low.z <= query.high.z && b.high.z >= query.low.z) {
+                        found.push_back(objects[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Nearest object whose box is hit by the ray.
+    RayHit castRay(const Ray& ray) const
+    {
+        const glm::vec3 inverse = 1.0f / ray.direction;
+        return traceRay(ray, [&](std::uint32_t leaf, float& distance) {
+            return detail::bvhIntersectSlabs(ray.origin, inverse, leafBounds[leaf].low, leafBounds[leaf].high, distance);
+        });
+    }
+
+    // Nearest object hit by the ray. test(object, origin, direction,
+    // distance) decides for each object whose box is hit, like the
+    // functions of glm/gtx/intersect.hpp.
+    template<typename Test>
+    RayHit castRay(const Ray& ray, const Test& test) const
+    {
+        return traceRay(ray, [&](std::uint32_t leaf, float& distance) {
+            return test(objects[leaf], ray.origin, ray.direction, distance);
+        });
+    }
+
+    // Nearest hits of count rays, on every thread.
+    void castRays(const Ray* rays, std::size_t count, RayHit* hits) const
+    {
+        forEachRay(count, [&](std::size_t i) { hits[i] = castRay(rays[i]); });
+    }
+
+    template<typename Test>
+    void castRays(const Ray* rays, std::size_t count, RayHit* hits, const Test& test) const
+    {
+        forEachRay(count, [&](std::size_t i) { hits[i] = castRay(rays[i], test); });
+    }
+
+private:
+    struct BuildNode
+    {
+        Bounds bounds;
+        std::uint32_t left = 0;     // children are left and left + 1
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;    // objects of a leaf, 0 for a node
+    };
+
+    struct BuildState
+    {
+        const Bounds* bounds;
+        std::vector<glm::vec3> centers;
+        std::vector<BuildNode> nodes;
+        std::atomic<std::uint32_t> nodeCount;
+        std::atomic<int> spareThreads;
+    };
+
+    struct Bin
+    {
+        Bounds bounds = detail::bvhEmptyBounds();
+        Bounds centers = detail::bvhEmptyBounds();
+        std::uint32_t count = 0;
+
+        void add(const Bounds& box, const glm::vec3& center)
+        {
+            bounds = detail::bvhUnion(bounds, box);
+            centers.low = glm::min(centers.low, center);
+            centers.high = glm::max(centers.high, center);
+            count++;
+        }
+
+        void add(const Bin& other)
+        {
+            bounds = detail::bvhUnion(bounds, other.bounds);
+            centers = detail::bvhUnion(centers, other.centers);
+            count += other.count;
+        }
+    };
+
+    void binRange(const BuildState& state, std::uint32_t first, std::uint32_t last, const Bounds& centerBounds,
+                  const glm::vec3& scale, Bin (&bins)[3][binCount]) const
+    {
+        for(std::uint32_t i = first; i < last; i++) {
+            const std::uint32_t object = objects[i];
+            const glm::vec3& center = state.centers[object];
+            const glm::vec3 position = (center - centerBounds.low) * scale;
+            for(int axis = 0; axis < 3; axis++) {
+                const unsigned int bin = std::min(binCount - 1, unsigned(std::max(0.0f, position[axis])));
+                bins[axis][bin].add(state.bounds[object], center);
+            }
+        }
+    }
+
+    void buildBinary(BuildState& state, std::uint32_t index, std::uint32_t first, std::uint32_t count, const Bounds& centerBounds)
+    {
+        BuildNode& node = state.nodes[index];
+        node.first = first;
+        node.count = count;
+        if(count <= 2) {
+            return;
+        }
+
+        const glm::vec3 extent = centerBounds.high - centerBounds.low;
+        glm::vec3 scale;
+        for(int axis = 0; axis < 3; axis++) {
+            scale[axis] = extent[axis] > 0.0f ? float(binCount) * 0.999f / extent[axis] : 0.0f;
+        }
+
+        Bin bins[3][binCount];
+        const std::uint32_t parallelSize = 1u << 18;
+        if(count >= parallelSize && threads > 1) {
+            // the top nodes are most of the build time, binned on every thread
+            std::vector<Bin> partial(std::size_t(threads) * 3 * binCount);
+            detail::bvhParallel(threads, [&](unsigned int chunk) {
+                Bin local[3][binCount];
+                binRange(state, first + std::uint32_t(std::uint64_t(count) * chunk / threads),
+                         first + std::uint32_t(std::uint64_t(count) * (chunk + 1) / threads), centerBounds, scale, local);
+                std::copy(&local[0][0], &local[0][0] + 3 * binCount, partial.begin() + std::size_t(chunk) * 3 * binCount);
+            });
+            for(unsigned int chunk = 0; chunk < threads; chunk++) {
+                for(unsigned int i = 0; i < 3 * binCount; i++) {
+                    (&bins[0][0])[i].add(partial[std::size_t(chunk) * 3 * binCount + i]);
+                }
+            }
+        }
+        else {
+            binRange(state, first, first + count, centerBounds, scale, bins);
+        }
+
+        // cost of splitting after each bin, swept from both ends
+        float bestCost = std::numeric_limits<float>::infinity();
+        int bestAxis = -1;
+        unsigned int bestSplit = 0;
+        for(int axis = 0; axis < 3; axis++) {
+            if(scale[axis] == 0.0f) {
+                continue;
+            }
+            float rightCost[binCount];
+            Bounds right = detail::bvhEmptyBounds();
+            std::uint32_t rightCount = 0;
+            for(unsigned int i = binCount - 1; i > 0; i--) {
+                right = detail::bvhUnion(right, bins[axis][i].bounds);
+                rightCount += bins[axis][i].count;
+                rightCost[i] = rightCount > 0 ? detail::bvhHalfArea(right) * float(rightCount) : 0.0f;
+            }
+            Bounds left = detail::bvhEmptyBounds();
+            std::uint32_t leftCount = 0;
+            for(unsigned int i = 0; i + 1 < binCount; i++) {
+                left = detail::bvhUnion(left, bins[axis][i].bounds);
+                leftCount += bins[axis][i].count;
+                if(leftCount == 0 || leftCount == count) {
+                    continue;
+                }
+                const float cost = detail::bvhHalfArea(left) * float(leftCount) + rightCost[i + 1];
+                if(cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i + 1;
+                }
+            }
+        }
+
+        // a leaf when splitting doesn't pay, the traversal step costing
+        // about as much as testing an object
+        const float leafCost = detail::bvhHalfArea(node.bounds) * float(count);
+        std::uint32_t middle;
+        Bounds leftCenters, rightCenters, leftBounds, rightBounds;
+        if(bestAxis < 0) {
+            // all centers in one point: halves by index
+            if(count <= maxLeafSize) {
+                return;
+            }
+            middle = first + count / 2;
+            leftCenters = rightCenters = centerBounds;
+            leftBounds = rightBounds = detail::bvhEmptyBounds();
+            for(std::uint32_t i = first; i < first + count; i++) {
+                (i < middle ? leftBounds : rightBounds) = detail::bvhUnion(i < middle ? leftBounds : rightBounds, state.bounds[objects[i]]);
+            }
+        }
+        else {
+            if(count <= maxLeafSize && leafCost <= bestCost + detail::bvhHalfArea(node.bounds)) {
+                return;
+            }
+            const float low = centerBounds.low[bestAxis];
+            const float axisScale = scale[bestAxis];
+            std::uint32_t* split = std::partition(objects.data() + first, objects.data() + first + count, [&](std::uint32_t object) {
+                const float position = (state.centers[object][bestAxis] - low) * axisScale;
+                return std::min(binCount - 1, unsigned(std::max(0.0f, position))) < bestSplit;
+            });
+            middle = std::uint32_t(split - objects.data());
+            leftCenters = rightCenters = detail::bvhEmptyBounds();
+            leftBounds = rightBounds = detail::bvhEmptyBounds();
+            for(unsigned int i = 0; i < binCount; i++) {
+                Bounds& centers = i < bestSplit ? leftCenters : rightCenters;
+                Bounds& boxes = i < bestSplit ? leftBounds : rightBounds;
+                centers = detail::bvhUnion(centers, bins[bestAxis][i].centers);
+                boxes = detail::bvhUnion(boxes, bins[bestAxis][i].bounds);
+            }
+        }
+
+        const std::uint32_t left = state.nodeCount.fetch_add(2);
+        node.left = left;
+        node.count = 0;
+        state.nodes[left].bounds = leftBounds;
+        state.nodes[left + 1].bounds = rightBounds;
+
+        // the left subtree on another thread while some are free
+        const std::uint32_t threadSize = 1u << 14;
+        if(middle - first >= threadSize && first + count - middle >= threadSize && state.spareThreads.fetch_sub(1) > 0) {
+            std::thread thread([&, left, first, middle, leftCenters]() {
+                buildBinary(state, left, first, middle - first, leftCenters);
+            });
+            buildBinary(state, left + 1, middle, first + count - middle, rightCenters);
+            thread.join();
+            state.spareThreads.fetch_add(1);
+        }
+        else {
+            if(middle - first >= threadSize && first + count - middle >= threadSize) {
+                state.spareThreads.fetch_add(1);
+            }
+            buildBinary(state, left, first, middle - first, leftCenters);
+            buildBinary(state, left + 1, middle, first + count - middle, rightCenters);
+        }
+    }
+
+    // Nearest first traversal, test(leaf, distance) with the position of
+    // the object in the leaves.
+    template<typename Test>
+    RayHit traceRay(const Ray& ray, const Test& test) const
+    {
+        RayHit hit;
+        if(nodes.empty()) {
+            return hit;
+        }
+        const glm::vec3 inverse = 1.0f / ray.direction;
+        const detail::BvhFloat4 originX = detail::bvhSplat(ray.origin.x), originY = detail::bvhSplat(ray.origin.y), originZ = detail::bvhSplat(ray.origin.z);
+        const detail::BvhFloat4 inverseX = detail::bvhSplat(inverse.x), inverseY = detail::bvhSplat(inverse.y), inverseZ = detail::bvhSplat(inverse.z);
+
+        struct Entry
+        {
+            std::uint32_t node;
+            float distance;
+        };
+        Entry stack[64 * 3];
+        int size = 0;
+        stack[size++] = { 0, 0.0f };
+        while(size > 0) {
+            const Entry entry = stack[--size];
+            if(entry.distance > hit.distance) {
+                continue;
+            }
+            const BvhNode& node = nodes[entry.node];
+
+            // slabs of the 4 children
+            const detail::BvhFloat4 x0 = (detail::bvhLoad(node.lowX) - originX) * inverseX;
+            const detail::BvhFloat4 x1 = (detail::bvhLoad(node.highX) - originX) * inverseX;
+            const detail::BvhFloat4 y0 = (detail::bvhLoad(node.lowY) - originY) * inverseY;
+            const detail::BvhFloat4 y1 = (detail::bvhLoad(node.highY) - originY) * inverseY;
+            const detail::BvhFloat4 z0 = (detail::bvhLoad(node.lowZ) - originZ) * inverseZ;
+            const detail::BvhFloat4 z1 = (detail::bvhLoad(node.highZ) - originZ) * inverseZ;
+            const detail::BvhFloat4 entryT = detail::bvhMax(detail::bvhMax(detail::bvhMin(x0, x1), detail::bvhMin(y0, y1)),
+                                                            detail::bvhMax(detail::bvhMin(z0, z1), detail::bvhSplat(0.0f)));
+            const detail::BvhFloat4 exitT = detail::bvhMin(detail::bvhMin(detail::bvhMax(x0, x1), detail::bvhMax(y0, y1)),
+                                                           detail::bvhMin(detail::bvhMax(z0, z1), detail::bvhSplat(hit.distance)));
+            const detail::BvhInt4 crossed = entryT <= exitT;
+
+            // nodes pushed farthest first, leaves tested right away
+            Entry children[4];
+            int childCount = 0;
+            for(int slot = 0; slot < 4; slot++) {
+                if(node.child[slot] == BvhNode::empty || crossed[slot] == 0) {
+                    continue;
+                }
+                if(node.count[slot] != 0) {
+                    for(std::uint32_t i = node.child[slot]; i < node.child[slot] + node.count[slot]; i++) {
+                        float distance;
+                        if(test(i, distance) && distance < hit.distance) {
+                            hit.object = objects[i];
+                            hit.distance = distance;
+                        }
+                    }
+                    continue;
+                }
+                Entry child = { node.child[slot], entryT[slot] };
+                int position = childCount++;
+                while(position > 0 && children[position - 1].distance < child.distance) {
+                    children[position] = children[position - 1];
+                    position--;
+                }
+                children[position] = child;
+            }
+            for(int i = 0; i < childCount; i++) {
+                stack[size++] = children[i];
+            }
+        }
+        return hit;
+    }
+
+    template<typename Task>
+    void forEachRay(std::size_t count, const Task& task) const
+    {
+        std::atomic<std::size_t> next{ 0 };
+        const std::size_t batch = 256;
+        detail::bvhParallel(unsigned(std::min<std::size_t>(threads, (count + batch - 1) / batch)), [&](unsigned int) {
+            for(;;) {
+                const std::size_t first = next.fetch_add(batch);
+                if(first >= count) {
+                    break;
+                }
+                const std::size_t last = std::min(count, first + batch);
+                for(std::size_t i = first; i < last; i++) {
+                    task(i);
+                }
+            }
+        });
+    }
+
+    static void clearNode(BvhNode& node)
+    {
+        const float infinity = std::numeric_limits<float>::infinity();
+        for(int slot = 0; slot < 4; slot++) {
+            node.lowX[slot] = node.lowY[slot] = node.lowZ[slot] = infinity;
+            node.highX[slot] = node.highY[slot] = node.highZ[slot] = -infinity;
+            node.child[slot] = BvhNode::empty;
+            node.count[slot] = 0;
+        }
+    }
+
+    static void setSlot(BvhNode& node, int slot, const Bounds& bounds, std::uint32_t child, std::uint32_t count)
+    {
+        node.lowX[slot] = bounds.low.x;
+        node.lowY[slot] = bounds.low.y;
+        node.lowZ[slot] = bounds.low.z;
+        node.highX[slot] = bounds.high.x;
+        node.highY[slot] = bounds.high.y;
+        node.highZ[slot] = bounds.high.z;
+        node.child[slot] = child;
+        node.count[slot] = count;
+    }
+
+    static Bounds slotBounds(const BvhNode& node, int slot)
+    {
+        return { glm::vec3(node.lowX[slot], node.lowY[slot], node.lowZ[slot]),
+                 glm::vec3(node.highX[slot], node.highY[slot], node.highZ[slot]) };
+    }
+
+    // Turns binary node index, a node, into a 4 wide node and its subtree,
+    // returns its index.
+    std::uint32_t collapse(const BuildState& state, std::uint32_t index)
+    {
+        // the children, the largest node replaced by its own two until
+        // there are 4, keeping the order of the objects
+        std::uint32_t children[4] = { state.nodes[index].left, state.nodes[index].left + 1, 0, 0 };
+        int childCount = 2;
+        while(childCount < 4) {
+            int largest = -1;
+            float largestArea = -1.0f;
+            for(int i = 0; i < childCount; i++) {
+                const BuildNode& child = state.nodes[children[i]];
+                const float area = detail::bvhHalfArea(child.bounds);
+                if(child.count == 0 && area > largestArea) {
+                    largest = i;
+                    largestArea = area;
+                }
+            }
+            if(largest < 0) {
+                break;
+            }
+            const std::uint32_t expanded = state.nodes[children[largest]].left;
+            for(int i = childCount; i > largest + 1; i--) {
+                children[i] = children[i - 1];
+            }
+            children[largest] = expanded;
+            children[largest + 1] = expanded + 1;
+            childCount++;
+        }
+
+        const std::uint32_t result = std::uint32_t(nodes.size());
+        nodes.emplace_back();
+        clearNode(nodes[result]);
+        for(int slot = 0; slot < childCount; slot++) {
+            const BuildNode& child = state.nodes[children[slot]];
+            if(child.count != 0) {
+                setSlot(nodes[result], slot, child.bounds, child.first, child.count);
+            }
+            else {
+                const std::uint32_t node = collapse(state, children[slot]);
+                setSlot(nodes[result], slot, child.bounds, node, 0);
+            }
+        }
+        return result;
+    }
+
+    void refitNode(BvhNode& node)
+    {
+        for(int slot = 0; slot < 4; slot++) {
+            if(node.child[slot] == BvhNode::empty) {
+                continue;
+            }
+            Bounds bounds = detail::bvhEmptyBounds();
+            if(node.count[slot] != 0) {
+                for(std::uint32_t i = node.child[slot]; i < node.child[slot] + node.count[slot]; i++) {
+                    bounds = detail::bvhUnion(bounds, leafBounds[i]);
+                }
+            }
+            else {
+                const BvhNode& child = nodes[node.child[slot]];
+                for(int i = 0; i < 4; i++) {
+                    bounds = detail::bvhUnion(bounds, slotBounds(child, i));
+                }
+            }
+            setSlot(node, slot, bounds, node.child[slot], node.count[slot]);
+        }
+    }
+
+    // Splits the tree for refit: nodes refit last in top, in depth first
+    // order, and at least wanted subtrees in roots.
+    void collectRefitRoots(std::uint32_t root, std::size_t wanted, std::vector<std::uint32_t>& top,
+                           std::vector<std::uint32_t>& roots) const
+    {
+        roots.assign(1, root);
+        while(roots.size() < wanted) {
+            // expand the first root that has child nodes
+            std::size_t expandable = roots.size();
+            for(std::size_t i = 0; i < roots.size(); i++) {
+                const BvhNode& node = nodes[roots[i]];
+                for(int slot = 0; slot < 4 && expandable == roots.size(); slot++) {
+                    if(node.child[slot] != BvhNode::empty && node.count[slot] == 0) {
+                        expandable = i;
+                    }
+                }
+            }
+            if(expandable == roots.size()) {
+                break;
+            }
+            const std::uint32_t parent = roots[expandable];
+            roots.erase(roots.begin() + std::ptrdiff_t(expandable));
+            top.push_back(parent);
+            const BvhNode& node = nodes[parent];
+            for(int slot = 0; slot < 4; slot++) {
+                if(node.child[slot] != BvhNode::empty && node.count[slot] == 0) {
+                    roots.push_back(node.child[slot]);
+                }
+            }
+        }
+        std::sort(top.begin(), top.end());
+    }
+
+    // One past the last node of the subtree, the deepest of its last children.
+    std::uint32_t subtreeEnd(std::uint32_t index) const
+    {
+        for(;;) {
+            const BvhNode& node = nodes[index];
+            int last = -1;
+            for(int slot = 0; slot < 4; slot++) {
+                if(node.child[slot] != BvhNode::empty && node.count[slot] == 0) {
+                    last = slot;
+                }
+            }
+            if(last < 0) {
+                return index + 1;
+            }
+            index = node.child[last];
+        }
+    }
+
+    std::uint32_t firstObject(std::uint32_t index) const
+    {
+        for(;;) {
+            const BvhNode& node = nodes[index];
+            if(node.count[0] != 0) {
+                return node.child[0];
+            }
+            index = node.child[0];
+        }
+    }
+
+    std::uint32_t lastObject(std::uint32_t index) const
+    {
+        for(;;) {
+            const BvhNode& node = nodes[index];
+            int last = 3;
+            while(node.child[last] == BvhNode::empty) {
+                last--;
+            }
+            if(node.count[last] != 0) {
+                return node.child[last] + node.count[last];
+            }
+            index = node.child[last];
+        }
+    }
+
+    void appendLeaf(std::uint32_t first, std::uint32_t count, std::uint32_t planeMask, const glm::vec4* planes,
+                    std::vector<std::uint32_t>& visible) const
+    {
+        for(std::uint32_t i = first; i < first + count; i++) {
+            const Bounds& b = leafBounds[i];
+            bool outside = false;
+            for(int p = 0; p < 6 && !outside; p++) {
+                if((planeMask & (1u << p)) == 0) {
+                    continue;
+                }
+                const glm::vec4& plane = planes[p];
+                const glm::vec3 far(plane.x > 0.0f ? b.high.x : b.low.x, plane.y > 0.0f ? b.high.y : b.low.y,
+                                    plane.z > 0.0f ? b.high.z : b.low.z);
+                outside = glm::dot(glm::vec3(plane), far) + plane.w < 0.0f;
+            }
+            if(!outside) {
+                visible.push_back(objects[i]);
+            }
+        }
+    }
+
+    unsigned int threads = 1;
+    std::vector<BvhNode> nodes;
+    std::vector<std::uint32_t> objects;
+    std::vector<Bounds> leafBounds;
+};
+
+} // namespace gl
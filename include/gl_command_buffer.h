@@ -0,0 +1,262 @@
+// Command buffers
+//
+// Draws recorded on any thread, replayed on the GL thread. GL calls have to
+// come from the thread owning the context, deciding what to draw and with
+// which state doesn't: each thread records into its own CommandRecorder, a
+// linear array of 16 byte commands kept from frame to frame, without locks
+// or GL calls. A draw is recorded as a packet, the commands setting its
+// state then the draw itself, filed under a 64 bit sort key such as
+// RenderQueue::makeKey() gives.
+//
+// On the GL thread, CommandQueue gathers the packets of all the recorders,
+// radix sorts them by key and replays them through the StateCache, which
+// drops the binds already in effect. Packets run in key order, not in the
+// order recorded, so each sets all the state its draw needs.
+//
+// Header only, include it after glad, gl_state_cache.h and
+// gl_render_queue.h.
+//
+//     // on each worker thread
+//     gl::CommandRecorder& commands = recorders[jobs.threadIndex()];
+//     commands.begin(gl::RenderQueue::makeKey(0, program, material, mesh, depth));
+//     commands.useProgram(shaderProgram);
+//     commands.bindVertexArray(vao);
+//     commands.bindUniformRange(0, uniforms, offset, sizeof(glm::mat4));
+//     commands.drawArrays(GL_TRIANGLES, 0, 36);
+//
+//     // on the GL thread
+//     queue.sort(recorders.data(), recorders.size());
+//     queue.execute(glState);
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace gl {
+
+enum class CommandType : std::uint8_t
+{
+    UseProgram,
+    BindVertexArray,
+    BindTexture,
+    BindUniformRange,
+    UniformMatrix4,
+    DrawArrays,
+    DrawElements
+};
+
+// One command, its fields' meaning depending on the type:
+//
+//     UseProgram        a program
+//     BindVertexArray   a vertex array
+//     BindTexture       index unit, a target, b texture
+//     BindUniformRange  index binding, a buffer, b offset, c size
+//     UniformMatrix4    a location, b first of the 16 floats in the recorder
+//     DrawArrays        index mode, a first, b count
+//     DrawElements      index mode, extra index type, a count, b byte offset,
+//                       c base vertex
+struct Command
+{
+    CommandType type;
+    std::uint8_t index;
+    std::uint16_t extra;
+    std::uint32_t a;
+    std::uint32_t b;
+    std::uint32_t c;
+};
+
+static_assert(sizeof(Command) == 16, "Command layout");
+
+class CommandRecorder
+{
+public:
+    // Starts the packet of the next draw.
+    void begin(std::uint64_t key)
+    {
+        assert(!open);
+        packets.push_back({ key, std::uint32_t(commands.size()) });
+        open = true;
+    }
+
+    void useProgram(Program program)
+    {
+        push(CommandType::UseProgram, 0, 0, program.id);
+    }
+
+    void bindVertexArray(VertexArray vertexArray)
+    {
+        push(CommandType::BindVertexArray, 0, 0, vertexArray.id);
+    }
+
+    void bindTexture(unsigned int unit, GLenum target, Texture texture)
+    {
+        push(CommandType::BindTexture, std::uint8_t(unit), 0, target, texture.id);
+    }
+
+    // A range of a uniform buffer, offsets and sizes below 4 GiB.
+    void bindUniformRange(GLuint binding, Buffer buffer, GLintptr offset, GLsizeiptr size)
+    {
+        push(CommandType::BindUniformRange, std::uint8_t(binding), 0, buffer.id, std::uint32_t(offset), std::uint32_t(size));
+    }
+
+    // Copies the column major matrix.
+    void uniformMatrix4(GLint location, const GLfloat* matrix)
+    {
+        push(CommandType::UniformMatrix4, 0, 0, std::uint32_t(location), std::uint32_t(uniforms.size()));
+        uniforms.insert(uniforms.end(), matrix, matrix + 16);
+    }
+
+    // Ends the packet with a draw.
+    void drawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        push(CommandType::DrawArrays, std::uint8_t(mode), 0, std::uint32_t(first), std::uint32_t(count));
+        open = false;
+    }
+
+    // Ends the packet with an indexed draw, offset in bytes in the element
+    // array buffer of the vertex array.
+    void drawElements(GLenum mode, GLsizei count, GLenum type, std::size_t offset, GLint baseVertex = 0)
+    {
+        push(CommandType::DrawElements, std::uint8_t(mode), std::uint16_t(type), std::uint32_t(count),
+             std::uint32_t(offset), std::uint32_t(baseVertex));
+        open = false;
+    }
+
+    // Empties the recorder for the next frame, keeping its memory.
+    void clear()
+    {
+        assert(!open);
+        commands.clear();
+        uniforms.clear();
+        packets.clear();
+    }
+
+    std::size_t packetCount() const { return packets.size(); }
+    std::size_t commandCount() const { return commands.size(); }
+
+private:
+    friend class CommandQueue;
+
+    struct Packet
+    {
+        std::uint64_t key;
+        std::uint32_t first;
+    };
+
+    void push(CommandType type, std::uint8_t index, std::uint16_t extra, std::uint32_t a = 0, std::uint32_t b = 0,
+              std::uint32_t c = 0)
+    {
+        assert(open);
+        commands.push_back({ type, index, extra, a, b, c });
+    }
+
+    std::vector<Command> commands;
+    std::vector<GLfloat> uniforms;
+    std::vector<Packet> packets;
+    bool open = false;
+};
+
+class CommandQueue
+{
+public:
+    // Gathers the packets of the recorders in key order, equal keys in the
+    // order of the recorders then of recording. The recorders must not
+    // change until execute() is done. Needs no GL, may run on any thread.
+    // A packet not ended by a draw, begun and never closed, is left out,
+    // execute() would otherwise run on into the next packet or past the
+    // last command.
+    void sort(CommandRecorder* recorders, std::size_t count)
+    {
+        sources = recorders;
+        items.clear();
+        dropped = 0;
+        for(std::size_t i = 0; i < count; i++) {
+            const std::vector<CommandRecorder::Packet>& packets = recorders[i].packets;
+            const std::vector<Command>& commands = recorders[i].commands;
+            for(std::size_t p = 0; p < packets.size(); p++) {
+                const std::size_t end = p + 1 < packets.size() ? packets[p + 1].first : commands.size();
+                const bool closed = end > packets[p].first && (commands[end - 1].type == CommandType::DrawArrays
+                                                               || commands[end - 1].type == CommandType::DrawElements);
+                assert(closed && "packet begun without a draw");
+                if(!closed) {
+                    dropped++;
+                    continue;
+                }
+                items.push_back({ packets[p].key, std::uint32_t(i), packets[p].first });
+            }
+        }
+        detail::radixSortByKey(items, scratch);
+    }
+
+    // Replays the sorted packets. Returns the number of draws.
+    std::size_t execute(StateCache& state)
+    {
+        for(const Item& item : items) {
+            const CommandRecorder& recorder = sources[item.recorder];
+            const Command* command = &recorder.commands[item.first];
+            for(bool drawn = false; !drawn; command++) {
+                switch(command->type) {
+                    case CommandType::UseProgram:
+                        state.useProgram(Program(command->a));
+                        break;
+                    case CommandType::BindVertexArray:
+                        state.bindVertexArray(VertexArray(command->a));
+                        break;
+                    case CommandType::BindTexture:
+                        state.bindTexture(command->index, command->a, Texture(command->b));
+                        break;
+                    case CommandType::BindUniformRange:
+                        state.bindBufferRange(GL_UNIFORM_BUFFER, command->index, Buffer(command->a), GLintptr(command->b),
+                                              GLsizeiptr(command->c));
+                        break;
+                    case CommandType::UniformMatrix4:
+                        glUniformMatrix4fv(GLint(command->a), 1, GL_FALSE, &recorder.uniforms[command->b]);
+                        break;
+                    case CommandType::DrawArrays:
+                        glDrawArrays(command->index, GLint(command->a), GLsizei(command->b));
+                        drawn = true;
+                        break;
+                    case CommandType::DrawElements: {
+                        const void* offset = reinterpret_cast<const void*>(std::uintptr_t(command->b));
+                        if(command->c != 0) {
+                            glDrawElementsBaseVertex(command->index, GLsizei(command->a), command->extra, offset, GLint(command->c));
+                        }
+                        else {
+                            glDrawElements(command->index, GLsizei(command->a), command->extra, offset);
+                        }
+                        drawn = true;
+                        break;
+                    }
+                }
+            }
+        }
+        return items.size();
+    }
+
+    std::size_t size() const { return items.size(); }
+
+    // Packets the last sort() left out for lack of a draw.
+    std::size_t droppedPackets() const { return dropped; }
+
+    // Sorted keys, for tests and tools.
+    std::uint64_t key(std::size_t i) const { return items[i].key; }
+
+private:
+    struct Item
+    {
+        std::uint64_t key;
+        std::uint32_t recorder;
+        std::uint32_t first;
+    };
+
+    CommandRecorder* sources = nullptr;
+    std::vector<Item> items;
+    std::vector<Item> scratch;
+    std::size_t dropped = 0;
+};
+
+} // namespace gl
@@ -0,0 +1,482 @@
+// Entities and components
+//
+// Per object state as components, plain structs, instead of one more array
+// next to cubePositions for each new property. Entities with the same set
+// of components share an archetype, which stores them in chunks of 16 KiB:
+// one array per component type in each chunk, cache line aligned, so a
+// system reading two components of a million entities streams through two
+// arrays and nothing else. Chunks are kept full but the last one, an
+// entity destroyed or changing archetype is replaced by the last entity.
+//
+// Entities are handles, an index plus a generation counted up when the
+// index is destroyed, so a stale handle is seen dead rather than aliasing
+// the entity reusing its index. Components must be trivially copyable, up
+// to 64 types, each an id given on first use.
+//
+// forEach() and forEachChunk() visit the entities having all the listed
+// components, the chunk version giving arrays for loops the compiler can
+// vectorize. Both can spread the chunks over threads. Creating, destroying
+// or changing the components of entities is not allowed while iterating,
+// nor from several threads at once.
+//
+// Header only, needs no GL.
+//
+//     gl::EntityWorld world;
+//     for(unsigned int i = 0; i < cubeCount; i++) {
+//         world.create(Transform{ cubePositions[i], glm::radians(20.0f * i) }, Render{ cubeMaterial });
+//     }
+//     world.forEach<Transform, Render>([&](Transform& transform, Render& render) { ... });
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gl {
+
+struct Entity
+{
+    std::uint32_t index = ~0u;
+    std::uint32_t generation = 0;
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+namespace detail {
+
+constexpr unsigned int entityMaxComponents = 64;
+constexpr std::size_t entityChunkBytes = 16 * 1024;
+constexpr std::size_t entityLineBytes = 64;
+
+inline std::atomic<std::uint32_t> entityComponentCount{0};
+
+template<typename Component>
+std::uint32_t entityComponentId()
+{
+    static const std::uint32_t id = entityComponentCount++;
+    assert(id < entityMaxComponents);
+    return id;
+}
+
+struct EntityColumn
+{
+    std::uint32_t id;
+    std::uint32_t size;
+    // byte offset of the column in each chunk
+    std::uint32_t offset;
+};
+
+template<typename Component>
+EntityColumn entityColumn()
+{
+    static_assert(std::is_trivially_copyable<Component>::value, "components are copied as bytes");
+    static_assert(alignof(Component) <= entityLineBytes, "columns are cache line aligned");
+    return { entityComponentId<Component>(), std::uint32_t(sizeof(Component)), 0 };
+}
+
+struct alignas(entityLineBytes) EntityLine
+{
+    unsigned char bytes[entityLineBytes];
+};
+
+// runs task(0) .. task(count - 1) on count threads, the last on the caller
+template<typename Task>
+void entityParallel(unsigned int count, const Task& task)
+{
+    std::vector<std::thread> threads;
+    for(unsigned int i = 0; i + 1 < count; i++) {
+        threads.emplace_back([&task, i]() { task(i); });
+    }
+    if(count > 0) {
+        task(count - 1);
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace detail
+
+class EntityWorld
+{
+public:
+    // A new entity with the given components.
+    template<typename... Components>
+    Entity create(const Components&... components)
+    {
+        std::uint32_t type = findArchetype(maskOf<Components...>());
+        if(type == none) {
+            type = addArchetype({ detail::entityColumn<Components>()... });
+        }
+        const Entity entity = allocate();
+        place(entity, type);
+        ((*component<Components>(entity) = components), ...);
+        return entity;
+    }
+
+    void destroy(Entity entity)
+    {
+        if(!alive(entity)) {
+            return;
+        }
+        Slot& slot = slots[entity.index];
+        removeRow(slot.archetype, slot.row);
+        slot.archetype = none;
+        slot.generation++;
+        freeSlots.push_back(entity.index);
+        live--;
+    }
+
+    bool alive(Entity entity) const
+    {
+        return entity.index < slots.size() && slots[entity.index].generation == entity.generation
+               && slots[entity.index].archetype != none;
+    }
+
+    template<typename Component>
+    bool has(Entity entity) const
+    {
+        return alive(entity) && (archetypes[slots[entity.index].archetype].mask & bit<Component>()) != 0;
+    }
+
+    // The entity's component, nullptr if it is dead or has none. Valid until
+    // the next change of components.
+    template<typename Component>
+    Component* get(Entity entity)
+    {
+        return has<Component>(entity) ? component<Component>(entity) : nullptr;
+    }
+
+    // Adds a component or overwrites the one the entity has.
+    template<typename Component>
+    void add(Entity entity, const Component& value = Component())
+    {
+        if(!alive(entity)) {
+            return;
+        }
+        if(!has<Component>(entity)) {
+            const Archetype& archetype = archetypes[slots[entity.index].archetype];
+            std::uint32_t type = findArchetype(archetype.mask | bit<Component>());
+            if(type == none) {
+                std::vector<detail::EntityColumn> columns = archetype.columns;
+                columns.push_back(detail::entityColumn<Component>());
+                type = addArchetype(std::move(columns));
+            }
+            move(entity, type);
+        }
+        *component<Component>(entity) = value;
+    }
+
+    template<typename Component>
+    void remove(Entity entity)
+    {
+        if(!has<Component>(entity)) {
+            return;
+        }
+        const Archetype& archetype = archetypes[slots[entity.index].archetype];
+        std::uint32_t type = findArchetype(archetype.mask & ~bit<Component>());
+        if(type == none) {
+            std::vector<detail::EntityColumn> columns = archetype.columns;
+            const std::uint32_t id = detail::entityComponentId<Component>();
+            columns.erase(std::find_if(columns.begin(), columns.end(),
+                                       [id](const detail::EntityColumn& column) { return column.id == id; }));
+            type = addArchetype(std::move(columns));
+        }
+        move(entity, type);
+    }
+
+    // Calls function(count, entities, components...) for each chunk of
+    // entities having all the components, with an array of each. threads 0
+    // uses every core, function is then called concurrently.
+    template<typename... Components, typename Function>
+    void forEachChunk(Function&& function, unsigned int threads = 1)
+    {
+        const std::uint64_t mask = maskOf<Components...>();
+        std::vector<ChunkRef> chunks;
+        for(std::uint32_t type = 0; type < archetypes.size(); type++) {
+            const Archetype& archetype = archetypes[type];
+            if((archetype.mask & mask) != mask || archetype.count == 0) {
+                continue;
+            }
+            const std::uint32_t used = std::uint32_t((archetype.count + archetype.capacity - 1) / archetype.capacity);
+            for(std::uint32_t chunk = 0; chunk < used; chunk++) {
+                chunks.push_back({ type, chunk });
+            }
+        }
+
+        const auto visit = [&](const ChunkRef& ref) {
+            const Archetype& archetype = archetypes[ref.archetype];
+            callChunk<Components...>(archetype, ref.chunk, function, std::index_sequence_for<Components...>());
+        };
+
+        if(threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        // a few chunks per thread at least, starting threads costs more
+        // than running through a chunk
+        const unsigned int workers = std::min<unsigned int>(threads, unsigned((chunks.size() + 3) / 4));
+        if(workers <= 1) {
+            for(const ChunkRef& ref : chunks) {
+                visit(ref);
+            }
+            return;
+        }
+        std::atomic<std::size_t> next{0};
+        detail::entityParallel(workers, [&](unsigned int) {
+            for(std::size_t i = next++; i < chunks.size(); i = next++) {
+                visit(chunks[i]);
+            }
+        });
+    }
+
+    // Calls function(components&...) for each entity having them all.
+    template<typename... Components, typename Function>
+    void forEach(Function&& function, unsigned int threads = 1)
+    {
+        forEachChunk<Components...>([&](std::size_t count, const Entity*, Components*... arrays) {
+            for(std::size_t i = 0; i < count; i++) {
+                function(arrays[i]...);
+            }
+        }, threads);
+    }
+
+    // Live entities.
+    std::size_t size() const { return live; }
+
+    std::size_t archetypeCount() const { return archetypes.size(); }
+
+private:
+    static constexpr std::uint32_t none = ~0u;
+
+    struct Slot
+    {
+        std::uint32_t generation;
+        std::uint32_t archetype;
+        std::uint32_t row;
+    };
+
+    struct Archetype
+    {
+        std::uint64_t mask = 0;
+        // sorted by id, the entity handles first
+        std::vector<detail::EntityColumn> columns;
+        std::int8_t columnOf[detail::entityMaxComponents];
+        std::uint32_t entityOffset = 0;
+        std::uint32_t capacity = 0;
+        std::size_t count = 0;
+        std::vector<std::unique_ptr<detail::EntityLine[]>> chunks;
+    };
+
+    struct ChunkRef
+    {
+        std::uint32_t archetype;
+        std::uint32_t chunk;
+    };
+
+    template<typename Component>
+    static std::uint64_t bit()
+    {
+        return std::uint64_t(1) << detail::entityComponentId<Component>();
+    }
+
+    template<typename... Components>
+    static std::uint64_t maskOf()
+    {
+        return (std::uint64_t(0) | ... | bit<Components>());
+    }
+
+    static unsigned char* rowBase(const Archetype& archetype, std::size_t row, std::uint32_t& index)
+    {
+        index = std::uint32_t(row % archetype.capacity);
+        return archetype.chunks[row / archetype.capacity][0].bytes;
+    }
+
+    template<typename Component>
+    Component* component(Entity entity)
+    {
+        const Slot& slot = slots[entity.index];
+        const Archetype& archetype = archetypes[slot.archetype];
+        const detail::EntityColumn& column = archetype.columns[archetype.columnOf[detail::entityComponentId<Component>()]];
+        std::uint32_t index;
+        unsigned char* base = rowBase(archetype, slot.row, index);
+        return reinterpret_cast<Component*>(base + column.offset) + index;
+    }
+
+    template<typename... Components, typename Function, std::size_t... I>
+    static void callChunk(const Archetype& archetype, std::uint32_t chunk, Function& function,
+                          std::index_sequence<I...>)
+    {
+        const std::array<std::uint32_t, sizeof...(Components)> offsets = {
+            archetype.columns[archetype.columnOf[detail::entityComponentId<Components>()]].offset...
+        };
+        (void)offsets;
+        unsigned char* base = archetype.chunks[chunk][0].bytes;
+        const std::size_t first = std::size_t(chunk) * archetype.capacity;
+        const std::size_t count = std::min<std::size_t>(archetype.capacity, archetype.count - first);
+        function(count, reinterpret_cast<const Entity*>(base + archetype.entityOffset),
+                 reinterpret_cast<Components*>(base + offsets[I])...);
+    }
+
+    // The archetype with these components, none if there is none yet. The
+    // last one found is checked first, entities tend to come in runs of the
+    // same kind.
+    std::uint32_t findArchetype(std::uint64_t mask)
+    {
+        if(lastArchetype < archetypes.size() && archetypes[lastArchetype].mask == mask) {
+            return lastArchetype;
+        }
+        const auto found = archetypeOf.find(mask);
+        if(found == archetypeOf.end()) {
+            return none;
+        }
+        lastArchetype = found->second;
+        return lastArchetype;
+    }
+
+    std::uint32_t addArchetype(std::vector<detail::EntityColumn> columns)
+    {
+        std::uint64_t mask = 0;
+        for(const detail::EntityColumn& column : columns) {
+            assert((mask & (std::uint64_t(1) << column.id)) == 0);
+            mask |= std::uint64_t(1) << column.id;
+        }
+
+        Archetype archetype;
+        archetype.mask = mask;
+        std::sort(columns.begin(), columns.end(),
+                  [](const detail::EntityColumn& a, const detail::EntityColumn& b) { return a.id < b.id; });
+        std::fill(std::begin(archetype.columnOf), std::end(archetype.columnOf), std::int8_t(-1));
+
+        // as many rows as fit with each column starting on a cache line
+        std::size_t rowBytes = sizeof(Entity);
+        for(const detail::EntityColumn& column : columns) {
+            rowBytes += column.size;
+        }
+        const std::size_t lines = detail::entityChunkBytes / detail::entityLineBytes;
+        std::size_t capacity = detail::entityChunkBytes / rowBytes;
+        const auto linesFor = [](std::size_t bytes) { return (bytes + detail::entityLineBytes - 1) / detail::entityLineBytes; };
+        for(;; capacity--) {
+            std::size_t used = linesFor(capacity * sizeof(Entity));
+            for(const detail::EntityColumn& column : columns) {
+                used += linesFor(capacity * column.size);
+            }
+            if(used <= lines || capacity == 1) {
+                break;
+            }
+        }
+
+        std::size_t offset = linesFor(capacity * sizeof(Entity)) * detail::entityLineBytes;
+        for(std::size_t i = 0; i < columns.size(); i++) {
+            columns[i].offset = std::uint32_t(offset);
+            archetype.columnOf[columns[i].id] = std::int8_t(i);
+            offset += linesFor(capacity * columns[i].size) * detail::entityLineBytes;
+        }
+        archetype.capacity = std::uint32_t(capacity);
+        archetype.columns = std::move(columns);
+
+        archetypes.push_back(std::move(archetype));
+        archetypeOf.emplace(mask, std::uint32_t(archetypes.size() - 1));
+        return std::uint32_t(archetypes.size() - 1);
+    }
+
+    Entity allocate()
+    {
+        Entity entity;
+        if(!freeSlots.empty()) {
+            entity.index = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        else {
+            entity.index = std::uint32_t(slots.size());
+            slots.push_back({ 0, none, 0 });
+        }
+        entity.generation = slots[entity.index].generation;
+        live++;
+        return entity;
+    }
+
+    // Appends a row for the entity, components left as they were.
+    void place(Entity entity, std::uint32_t type)
+    {
+        Archetype& archetype = archetypes[type];
+        const std::size_t row = archetype.count++;
+        if(row / archetype.capacity == archetype.chunks.size()) {
+            const std::size_t lines = detail::entityChunkBytes / detail::entityLineBytes;
+            archetype.chunks.emplace_back(new detail::EntityLine[lines]);
+        }
+        std::uint32_t index;
+        unsigned char* base = rowBase(archetype, row, index);
+        reinterpret_cast<Entity*>(base + archetype.entityOffset)[index] = entity;
+        slots[entity.index].archetype = type;
+        slots[entity.index].row = std::uint32_t(row);
+    }
+
+    // Fills the row with the archetype's last one, frees the last chunk
+    // once empty.
+    void removeRow(std::uint32_t type, std::uint32_t row)
+    {
+        Archetype& archetype = archetypes[type];
+        const std::size_t last = --archetype.count;
+        if(row != last) {
+            std::uint32_t to, from;
+            unsigned char* target = rowBase(archetype, row, to);
+            unsigned char* source = rowBase(archetype, last, from);
+            const Entity moved = reinterpret_cast<Entity*>(source + archetype.entityOffset)[from];
+            reinterpret_cast<Entity*>(target + archetype.entityOffset)[to] = moved;
+            for(const detail::EntityColumn& column : archetype.columns) {
+                std::memcpy(target + column.offset + std::size_t(to) * column.size,
+                            source + column.offset + std::size_t(from) * column.size, column.size);
+            }
+            slots[moved.index].row = row;
+        }
+        // keeps one spare chunk, an entity going back and forth at a chunk
+        // boundary doesn't allocate every time
+        const std::size_t used = (archetype.count + archetype.capacity - 1) / archetype.capacity;
+        if(archetype.chunks.size() > used + 1) {
+            archetype.chunks.pop_back();
+        }
+    }
+
+    // Moves the entity to another archetype, copying the components both
+    // have.
+    void move(Entity entity, std::uint32_t type)
+    {
+        const Slot old = slots[entity.index];
+        place(entity, type);
+        const Slot& slot = slots[entity.index];
+        const Archetype& from = archetypes[old.archetype];
+        const Archetype& to = archetypes[type];
+        std::uint32_t fromIndex, toIndex;
+        const unsigned char* source = rowBase(from, old.row, fromIndex);
+        unsigned char* target = rowBase(to, slot.row, toIndex);
+        for(const detail::EntityColumn& column : from.columns) {
+            const std::int8_t other = to.columnOf[column.id];
+            if(other >= 0) {
+                std::memcpy(target + to.columns[other].offset + std::size_t(toIndex) * column.size,
+                            source + column.offset + std::size_t(fromIndex) * column.size, column.size);
+            }
+        }
+        removeRow(old.archetype, old.row);
+    }
+
+    std::vector<Archetype> archetypes;
+    std::unordered_map<std::uint64_t, std::uint32_t> archetypeOf;
+    std::uint32_t lastArchetype = none;
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> freeSlots;
+    std::size_t live = 0;
+};
+
+} // namespace gl
@@ -0,0 +1,143 @@
+// Frame scheduler
+//
+// Decides whether a loop iteration draws, and how long the loop may sleep
+// before the next one. The examples draw every iteration as fast as they
+// can, though most of their scenes never change. On demand, a frame is
+// drawn only once something asks for it:
+// - invalidate(), from an input or resize callback, or from another thread
+//   when an asset is ready, which then also wakes the loop,
+// - an animation, drawn every iteration while setAnimating(true) or until
+//   the time given to animateUntil(),
+// while wakeAt() wakes the loop without a frame, for work looked at on a
+// timer such as ShaderReloader::update().
+//
+// Times are in seconds on any clock, glfwGetTime() in the examples. Not on
+// demand, every iteration draws and the loop never sleeps.
+//
+// Header only, needs no GL.
+//
+//     gl::FrameScheduler redraw(true);
+//     redraw.setWake(glfwPostEmptyEvent);
+//     while(...) {
+//         const double wait = redraw.waitTime(glfwGetTime());
+//         if(wait == 0.0) {
+//             glfwPollEvents();
+//         }
+//         else if(wait < 0.0) {
+//             glfwWaitEvents();
+//         }
+//         else {
+//             glfwWaitEventsTimeout(wait);
+//         }
+//         if(!redraw.beginFrame(glfwGetTime())) {
+//             continue;
+//         }
+//         ...
+//     }
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <limits>
+
+namespace gl {
+
+class FrameScheduler
+{
+public:
+    explicit FrameScheduler(bool onDemand = false) : demand(onDemand) {}
+
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+    void setOnDemand(bool onDemand) { demand = onDemand; }
+    bool onDemand() const { return demand; }
+
+    // Called by invalidate() to wake a loop waiting for events, must be
+    // safe from any thread, as glfwPostEmptyEvent is.
+    void setWake(std::function<void()> function) { wake = std::move(function); }
+
+    // Asks for a frame. Safe from any thread.
+    void invalidate()
+    {
+        if(!dirty.exchange(true) && wake) {
+            wake();
+        }
+    }
+
+    // Draws every iteration while true.
+    void setAnimating(bool animating) { continuous = animating; }
+
+    // Draws every iteration until time, then once more at or after it so the
+    // animation's last state is shown.
+    void animateUntil(double time)
+    {
+        if(!animation || time > animationEnd) {
+            animationEnd = time;
+        }
+        animation = true;
+    }
+
+    // Wakes the loop at time, without a frame. The earliest time asked for
+    // since the last wake up counts.
+    void wakeAt(double time)
+    {
+        if(time < wakeTime) {
+            wakeTime = time;
+        }
+    }
+
+    // Seconds the loop may wait for events from now: 0 to only poll them, a
+    // negative number to wait until one comes.
+    double waitTime(double now) const
+    {
+        if(!demand || continuous || animation || dirty.load(std::memory_order_relaxed)) {
+            return 0.0;
+        }
+        if(wakeTime == never) {
+            return -1.0;
+        }
+        return wakeTime > now ? wakeTime - now : 0.0;
+    }
+
+    // Whether the iteration draws, clears the request if it does.
+    bool beginFrame(double now)
+    {
+        iterations++;
+        if(now >= wakeTime) {
+            wakeTime = never;
+        }
+        bool draw = !demand || continuous;
+        if(animation) {
+            draw = true;
+            animation = now < animationEnd;
+        }
+        if(dirty.exchange(false)) {
+            draw = true;
+        }
+        if(draw) {
+            frames++;
+        }
+        return draw;
+    }
+
+    // Iterations of the loop and the frames they drew.
+    unsigned long iterationCount() const { return iterations; }
+    unsigned long frameCount() const { return frames; }
+
+private:
+    static constexpr double never = std::numeric_limits<double>::infinity();
+
+    std::atomic<bool> dirty{ true };
+    std::function<void()> wake;
+    bool demand;
+    bool continuous = false;
+    bool animation = false;
+    double animationEnd = 0.0;
+    double wakeTime = never;
+    unsigned long iterations = 0;
+    unsigned long frames = 0;
+};
+
+} // namespace gl
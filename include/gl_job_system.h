@@ -0,0 +1,458 @@
+// Job system
+//
+// A fixed set of threads running small jobs, so the frame's CPU work
+// spreads over the cores instead of all running on the GL thread. Each
+// thread owns a Chase-Lev deque: it pushes and pops jobs at the bottom,
+// without locks, and idle threads steal from the top of the others'.
+// Threads finding no job at all sleep until the next push.
+//
+// Jobs are started against a JobCounter, which counts those not finished,
+// and wait() runs jobs until the counter falls to zero rather than block,
+// so waiting inside a job is fine. parallelFor() splits a range in halves,
+// handing out the upper one, down to the grain: the halves stolen first
+// are the largest.
+//
+// A TaskGraph lists the stages of a frame and which have to finish before
+// each, e.g. input, simulate, cull, build the draw list. Launched, the
+// stages run as jobs as soon as their dependencies are done, while the
+// thread that launched it may keep on, typically submitting the previous
+// frame's draw list to GL.
+//
+// The thread constructing the JobSystem is its thread 0, it and the jobs
+// start jobs. A job started from any other thread runs at once, on it.
+// Captures of a job take 64 bytes at most, capture by reference.
+//
+// Header only, needs no GL.
+//
+//     gl::JobSystem jobs;
+//     jobs.parallelFor(cubeCount, 1024, [&](std::size_t first, std::size_t last) {
+//         for(std::size_t i = first; i < last; i++) {
+//             models[i] = glm::translate(glm::mat4(1.0f), cubePositions[i]);
+//         }
+//     });
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gl {
+
+// Jobs started and not finished yet.
+struct JobCounter
+{
+    std::atomic<std::uint32_t> pending{0};
+
+    bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+namespace detail {
+
+constexpr std::size_t jobStorageBytes = 64;
+
+struct Job
+{
+    void (*call)(Job&);
+    JobCounter* counter;
+    alignas(std::max_align_t) unsigned char storage[jobStorageBytes];
+};
+
+// Chase-Lev work stealing deque with a fixed capacity, as written with C11
+// atomics by Le, Pop, Cohen and Zappa Nardelli. push() and pop() are for
+// the owning thread only, steal() for any.
+class JobDeque
+{
+public:
+    static constexpr std::int64_t capacity = 4096;
+
+    // false when full
+    bool push(Job* job)
+    {
+        const std::int64_t b = bottom.load(std::memory_order_relaxed);
+        const std::int64_t t = top.load(std::memory_order_acquire);
+        if(b - t >= capacity) {
+            return false;
+        }
+        buffer[b & (capacity - 1)].store(job, std::memory_order_relaxed);
+        // a release store rather than the paper's fence, the same on x86
+        // and ARM, and seen by the thread sanitizer
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    Job* pop()
+    {
+        const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        if(t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = buffer[b & (capacity - 1)].load(std::memory_order_relaxed);
+        if(t == b) {
+            // the last job, a thief may be taking it too
+            if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* steal()
+    {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t b = bottom.load(std::memory_order_acquire);
+        if(t >= b) {
+            return nullptr;
+        }
+        Job* job = buffer[t & (capacity - 1)].load(std::memory_order_relaxed);
+        if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return job;
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> top{0};
+    alignas(64) std::atomic<std::int64_t> bottom{0};
+    alignas(64) std::atomic<Job*> buffer[capacity];
+};
+
+struct JobThread
+{
+    const void* system;
+    unsigned int index;
+};
+
+inline thread_local JobThread jobThread = { nullptr, 0 };
+
+} // namespace detail
+
+class JobSystem
+{
+public:
+    // threads counts the calling thread, 0 is one per core.
+    explicit JobSystem(unsigned int threads = 0)
+    {
+        if(threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for(unsigned int i = 0; i < threads; i++) {
+            workers.emplace_back(new Worker);
+        }
+        detail::jobThread = { this, 0 };
+        for(unsigned int i = 1; i < threads; i++) {
+            workerThreads.emplace_back([this, i]() { work(i); });
+        }
+    }
+
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(std::thread& thread : workerThreads) {
+            thread.join();
+        }
+        for(std::unique_ptr<Worker>& worker : workers) {
+            for(detail::Job* job : worker->free) {
+                delete job;
+            }
+        }
+        if(detail::jobThread.system == this) {
+            detail::jobThread = { nullptr, 0 };
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned int threadCount() const { return unsigned(workers.size()); }
+
+    // The calling thread's index, below threadCount() on the system's
+    // threads, e.g. to pick per thread data in a job. threadCount() on any
+    // other thread.
+    unsigned int threadIndex() const
+    {
+        const unsigned int index = current();
+        return index != none ? index : threadCount();
+    }
+
+    // Starts function() as a job counted by counter.
+    template<typename Function>
+    void run(JobCounter& counter, Function&& function)
+    {
+        using Callable = typename std::decay<Function>::type;
+        static_assert(sizeof(Callable) <= detail::jobStorageBytes, "job captures too large, capture by reference");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "job captures overaligned");
+
+        const unsigned int index = current();
+        if(index == none) {
+            function();
+            return;
+        }
+        Worker& worker = *workers[index];
+        detail::Job* job;
+        if(!worker.free.empty()) {
+            job = worker.free.back();
+            worker.free.pop_back();
+        }
+        else {
+            job = new detail::Job;
+        }
+        new(job->storage) Callable(std::forward<Function>(function));
+        job->call = [](detail::Job& self) {
+            Callable& callable = *std::launder(reinterpret_cast<Callable*>(self.storage));
+            callable();
+            callable.~Callable();
+        };
+        job->counter = &counter;
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+        if(!worker.deque.push(job)) {
+            // full, the jobs queued are plenty for the other threads
+            execute(index, job);
+            return;
+        }
+        epoch.fetch_add(1);
+        if(sleeping.load() > 0) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            wake.notify_one();
+        }
+    }
+
+    // Runs jobs until those of counter are finished.
+    void wait(JobCounter& counter)
+    {
+        const unsigned int index = current();
+        while(!counter.done()) {
+            detail::Job* job = index != none ? find(index) : nullptr;
+            if(job != nullptr) {
+                execute(index, job);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Calls function(first, last) over [0, count) in ranges of grain to
+    // twice grain indices, returns once all are done.
+    template<typename Function>
+    void parallelFor(std::size_t count, std::size_t grain, const Function& function)
+    {
+        grain = std::max<std::size_t>(grain, 1);
+        if(workers.size() == 1 || count <= grain || current() == none) {
+            if(count > 0) {
+                function(std::size_t(0), count);
+            }
+            return;
+        }
+        JobCounter counter;
+        splitRange(counter, 0, count, grain, function);
+        wait(counter);
+    }
+
+private:
+    static constexpr unsigned int none = ~0u;
+    // jobs kept for reuse per thread, the ones past it are deleted
+    static constexpr std::size_t maxFreeJobs = 1024;
+
+    struct alignas(64) Worker
+    {
+        detail::JobDeque deque;
+        std::vector<detail::Job*> free;
+        std::uint32_t random = 0;
+    };
+
+    unsigned int current() const
+    {
+        return detail::jobThread.system == this ? detail::jobThread.index : none;
+    }
+
+    template<typename Function>
+    void splitRange(JobCounter& counter, std::size_t first, std::size_t last, std::size_t grain, const Function& function)
+    {
+        while(last - first >= 2 * grain) {
+            const std::size_t middle = first + (last - first) / 2;
+            run(counter, [this, &counter, middle, last, grain, &function]() {
+                splitRange(counter, middle, last, grain, function);
+            });
+            last = middle;
+        }
+        function(first, last);
+    }
+
+    // The thread's own newest job, else the oldest of another thread,
+    // starting from a random one.
+    detail::Job* find(unsigned int index)
+    {
+        Worker& worker = *workers[index];
+        if(detail::Job* job = worker.deque.pop()) {
+            return job;
+        }
+        const unsigned int count = unsigned(workers.size());
+        worker.random = worker.random * 1664525u + 1013904223u + index;
+        const unsigned int start = (worker.random >> 16) % count;
+        for(unsigned int i = 0; i < count; i++) {
+            const unsigned int victim = (start + i) % count;
+            if(victim == index) {
+                continue;
+            }
+            if(detail::Job* job = workers[victim]->deque.steal()) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void execute(unsigned int index, detail::Job* job)
+    {
+        JobCounter* counter = job->counter;
+        job->call(*job);
+        std::vector<detail::Job*>& free = workers[index]->free;
+        if(free.size() < maxFreeJobs) {
+            free.push_back(job);
+        }
+        else {
+            delete job;
+        }
+        // last, the counter may be gone as soon as it reads zero
+        counter->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void work(unsigned int index)
+    {
+        detail::jobThread = { this, index };
+        while(true) {
+            if(detail::Job* job = find(index)) {
+                execute(index, job);
+                continue;
+            }
+            // a push after reading the epoch changes it, the thread then
+            // won't sleep
+            const std::uint32_t seen = epoch.load();
+            bool found = false;
+            for(int spin = 0; spin < 64 && !found; spin++) {
+                if(detail::Job* job = find(index)) {
+                    execute(index, job);
+                    found = true;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+            if(found) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleeping++;
+            wake.wait(lock, [&]() { return stopping || epoch.load() != seen; });
+            sleeping--;
+            if(stopping) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> workerThreads;
+    std::atomic<std::uint32_t> epoch{0};
+    std::atomic<std::uint32_t> sleeping{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+// Stages of a frame and their dependencies, built once and launched every
+// frame. A launch must be finished before the next.
+class TaskGraph
+{
+public:
+    using Task = std::uint32_t;
+
+    // Adds a stage running after those listed, which were added before.
+    Task add(const char* name, std::function<void()> function, std::initializer_list<Task> after = {})
+    {
+        const Task task = Task(nodes.size());
+        nodes.emplace_back(new Node);
+        Node& node = *nodes.back();
+        node.name = name;
+        node.function = std::move(function);
+        for(Task before : after) {
+            assert(before < task);
+            nodes[before]->next.push_back(task);
+            node.dependencies++;
+        }
+        return task;
+    }
+
+    // Starts the stages without dependencies, the others follow as jobs
+    // counted by done.
+    void launch(JobSystem& jobs, JobCounter& done)
+    {
+        for(std::unique_ptr<Node>& node : nodes) {
+            node->remaining.store(node->dependencies, std::memory_order_relaxed);
+        }
+        for(std::unique_ptr<Node>& node : nodes) {
+            if(node->dependencies == 0) {
+                start(jobs, done, *node);
+            }
+        }
+    }
+
+    void run(JobSystem& jobs)
+    {
+        JobCounter done;
+        launch(jobs, done);
+        jobs.wait(done);
+    }
+
+    std::size_t size() const { return nodes.size(); }
+    const char* name(Task task) const { return nodes[task]->name; }
+
+private:
+    struct Node
+    {
+        const char* name = "";
+        std::function<void()> function;
+        std::vector<Task> next;
+        std::uint32_t dependencies = 0;
+        std::atomic<std::uint32_t> remaining{0};
+    };
+
+    void start(JobSystem& jobs, JobCounter& done, Node& node)
+    {
+        jobs.run(done, [this, &jobs, &done, &node]() {
+            node.function();
+            for(Task task : node.next) {
+                if(nodes[task]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    start(jobs, done, *nodes[task]);
+                }
+            }
+        });
+    }
+
+    std::vector<std::unique_ptr<Node>> nodes;
+};
+
+} // namespace gl
@@ -0,0 +1,439 @@
+// Binary mesh file
+//
+// A container laid out exactly as the data is used, so loading is one mmap
+// and a validation pass, with no per vertex parsing: the vertex section is
+// handed as is to glBufferData or copied into a persistent buffer.
+//
+//     MeshFileHeader                    64 bytes
+//     MeshFileSection[sectionCount]     32 bytes each
+//     sections                          each at a multiple of 16 bytes
+//
+// Sections, at most one of each type:
+//     Attributes  MeshFileAttribute[], the glVertexAttribPointer layout
+//     Vertices    interleaved vertices, header.vertexStride bytes each
+//     Indices     GLushort or GLuint, header.indexType
+//     Meshes      MeshFileMesh[], ranges of the index buffer
+//     Materials   MeshFileMaterial[], names and texture paths
+//     Instances   MeshFileInstance[], a mesh and its model matrix
+//
+// Everything is little endian. version changes whenever the layout does,
+// files of another version are rejected rather than converted.
+//
+// Files are written by tools/meshconv. Header only, include it after glad
+// and gl_state_cache.h. mmap makes it POSIX only.
+//
+//     gl::MeshFile file;
+//     if(!file.open("../res/cube.glmf")) {
+//         std::cout << file.error() << std::endl;
+//     }
+//     file.upload(glState, vao, vbo, ibo);
+//     for(const gl::MeshFileInstance& instance : file.instances()) ...
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gl {
+
+static constexpr char meshFileMagic[4] = { 'G', 'L', 'M', 'F' };
+static constexpr std::uint32_t meshFileVersion = 1;
+static constexpr std::uint64_t meshFileAlignment = 16;
+// attribute locations must be below GL's minimum GL_MAX_VERTEX_ATTRIBS
+static constexpr std::uint32_t meshFileMaxAttributes = 16;
+
+enum class MeshFileSectionType : std::uint32_t
+{
+    Attributes = 1,
+    Vertices,
+    Indices,
+    Meshes,
+    Materials,
+    Instances,
+};
+
+struct MeshFileHeader
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t sectionCount;
+    std::uint32_t vertexStride;
+    std::uint64_t fileSize;
+    std::uint32_t indexType;          // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    std::uint32_t reserved0;
+    // position = positionOffset + positionScale * attribute, see
+    // CompiledVertices in gl_vertex_format.h
+    float positionOffset[3];
+    float positionScale[3];
+    std::uint32_t reserved1[2];
+};
+
+struct MeshFileSection
+{
+    MeshFileSectionType type;
+    std::uint32_t elementSize;
+    std::uint64_t count;
+    std::uint64_t offset;             // from the start of the file
+    std::uint64_t size;               // count * elementSize
+};
+
+struct MeshFileAttribute
+{
+    std::uint32_t location;
+    std::int32_t size;
+    std::uint32_t type;
+    std::uint32_t normalized;
+    std::uint32_t offset;
+};
+
+struct MeshFileMesh
+{
+    std::uint32_t firstIndex;
+    std::uint32_t indexCount;
+    std::int32_t baseVertex;
+    std::uint32_t material;           // noMaterial if none
+};
+
+struct MeshFileMaterial
+{
+    char name[48];                    // null terminated
+    char texture[80];                 // relative to the file, empty if none
+};
+
+struct MeshFileInstance
+{
+    float model[16];                  // column major
+    std::uint32_t mesh;
+    std::uint32_t reserved[3];
+};
+
+static constexpr std::uint32_t noMaterial = 0xffffffffu;
+
+static_assert(sizeof(MeshFileHeader) == 64, "MeshFileHeader layout");
+static_assert(sizeof(MeshFileSection) == 32, "MeshFileSection layout");
+static_assert(sizeof(MeshFileAttribute) == 20, "MeshFileAttribute layout");
+static_assert(sizeof(MeshFileMesh) == 16, "MeshFileMesh layout");
+static_assert(sizeof(MeshFileMaterial) == 128, "MeshFileMaterial layout");
+static_assert(sizeof(MeshFileInstance) == 80, "MeshFileInstance layout");
+
+// Typed view of a section, empty when the file has none.
+template<typename T>
+struct MeshFileArray
+{
+    const T* data = nullptr;
+    std::size_t count = 0;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + count; }
+    std::size_t size() const { return count; }
+    const T& operator[](std::size_t i) const { return data[i]; }
+};
+
+class MeshFile
+{
+public:
+    MeshFile() = default;
+    MeshFile(const MeshFile&) = delete;
+    MeshFile& operator=(const MeshFile&) = delete;
+    ~MeshFile() { close(); }
+
+    // Maps the file and validates it. checkIndices also reads every index
+    // to check it is within the vertex section, which touches the whole
+    // index buffer; leave it on for files that come from outside.
+    bool open(const char* path, bool checkIndices = true)
+    {
+        close();
+        const int fd = ::open(path, O_RDONLY);
+        if(fd < 0) {
+            return fail(std::string("can't open ") + path);
+        }
+        struct stat info;
+        if(fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return fail(std::string("can't read ") + path);
+        }
+        mappedSize = std::size_t(info.st_size);
+        void* address = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(address == MAP_FAILED) {
+            mappedSize = 0;
+            return fail(std::string("can't map ") + path);
+        }
+        mapped = static_cast<const unsigned char*>(address);
+        return attach(mapped, mappedSize, checkIndices);
+    }
+
+    // Validates a file already in memory, which must stay valid and be
+    // aligned on 16 bytes. The memory is not owned.
+    bool attach(const void* data, std::size_t size, bool checkIndices = true)
+    {
+        bytes = static_cast<const unsigned char*>(data);
+        byteCount = size;
+        if(!validate(checkIndices)) {
+            bytes = nullptr;
+            byteCount = 0;
+            return false;
+        }
+        return true;
+    }
+
+    void close()
+    {
+        if(mapped != nullptr) {
+            munmap(const_cast<unsigned char*>(mapped), mappedSize);
+        }
+        mapped = nullptr;
+        mappedSize = 0;
+        bytes = nullptr;
+        byteCount = 0;
+        sections = {};
+    }
+
+    bool isOpen() const { return bytes != nullptr; }
+    const std::string& error() const { return message; }
+
+    const MeshFileHeader& header() const { return *reinterpret_cast<const MeshFileHeader*>(bytes); }
+
+    MeshFileArray<MeshFileAttribute> attributes() const { return array<MeshFileAttribute>(MeshFileSectionType::Attributes); }
+    MeshFileArray<MeshFileMesh> meshes() const { return array<MeshFileMesh>(MeshFileSectionType::Meshes); }
+    MeshFileArray<MeshFileMaterial> materials() const { return array<MeshFileMaterial>(MeshFileSectionType::Materials); }
+    MeshFileArray<MeshFileInstance> instances() const { return array<MeshFileInstance>(MeshFileSectionType::Instances); }
+
+    const void* vertexData() const { return data(MeshFileSectionType::Vertices); }
+    std::size_t vertexBytes() const { return bytesOf(MeshFileSectionType::Vertices); }
+    std::size_t vertexCount() const { return count(MeshFileSectionType::Vertices); }
+
+    const void* indexData() const { return data(MeshFileSectionType::Indices); }
+    std::size_t indexBytes() const { return bytesOf(MeshFileSectionType::Indices); }
+    std::size_t indexCount() const { return count(MeshFileSectionType::Indices); }
+    GLenum indexType() const { return header().indexType; }
+
+    // Creates the buffers straight from the mapping and sets the attribute
+    // layout on a new vertex array.
+    void upload(StateCache& state, VertexArray& vao, Buffer& vbo, Buffer& ibo) const
+    {
+        vao = state.createVertexArray();
+        state.bindVertexArray(vao);
+
+        vbo = state.createBuffer();
+        state.bindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(vertexBytes()), vertexData(), GL_STATIC_DRAW);
+
+        // the element array binding belongs to the vertex array
+        ibo = state.createBuffer();
+        state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, GLsizeiptr(indexBytes()), indexData(), GL_STATIC_DRAW);
+
+        const GLsizei stride = GLsizei(header().vertexStride);
+        for(const MeshFileAttribute& attribute : attributes()) {
+            glVertexAttribPointer(attribute.location, attribute.size, attribute.type, GLboolean(attribute.normalized),
+                                  stride, reinterpret_cast<const void*>(std::uintptr_t(attribute.offset)));
+            glEnableVertexAttribArray(attribute.location);
+        }
+    }
+
+    // Bytes taken by an attribute of size components of type, 0 if the
+    // combination is not supported.
+    static std::uint32_t attributeBytes(std::uint32_t type, std::int32_t size)
+    {
+        switch(type) {
+        case GL_FLOAT: return 4 * std::uint32_t(size);
+        case GL_HALF_FLOAT:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT: return 2 * std::uint32_t(size);
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE: return std::uint32_t(size);
+        case GL_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_2_10_10_10_REV: return size == 4 ? 4 : 0;
+        default: return 0;
+        }
+    }
+
+private:
+    static constexpr unsigned int sectionTypes = 6;
+
+    struct SectionView
+    {
+        const MeshFileSection* section[sectionTypes];
+    };
+
+    bool fail(const std::string& text)
+    {
+        message = text;
+        return false;
+    }
+
+    const MeshFileSection* find(MeshFileSectionType type) const
+    {
+        return bytes != nullptr ? sections.section[unsigned(type) - 1] : nullptr;
+    }
+
+    const void* data(MeshFileSectionType type) const
+    {
+        const MeshFileSection* section = find(type);
+        return section != nullptr ? bytes + section->offset : nullptr;
+    }
+
+    std::size_t bytesOf(MeshFileSectionType type) const
+    {
+        const MeshFileSection* section = find(type);
+        return section != nullptr ? std::size_t(section->size) : 0;
+    }
+
+    std::size_t count(MeshFileSectionType type) const
+    {
+        const MeshFileSection* section = find(type);
+        return section != nullptr ? std::size_t(section->count) : 0;
+    }
+
+    template<typename T>
+    MeshFileArray<T> array(MeshFileSectionType type) const
+    {
+        MeshFileArray<T> result;
+        result.data = static_cast<const T*>(data(type));
+        result.count = count(type);
+        return result;
+    }
+
+    static bool terminated(const char* text, std::size_t size)
+    {
+        return std::memchr(text, 0, size) != nullptr;
+    }
+
+    bool validate(bool checkIndices)
+    {
+        sections = {};
+        if((reinterpret_cast<std::uintptr_t>(bytes) & (meshFileAlignment - 1)) != 0) {
+            return fail("mesh file: data not aligned on 16 bytes");
+        }
+        if(byteCount < sizeof(MeshFileHeader)) {
+            return fail("mesh file: truncated header");
+        }
+        const MeshFileHeader& head = header();
+        if(std::memcmp(head.magic, meshFileMagic, sizeof(meshFileMagic)) != 0) {
+            return fail("mesh file: bad magic");
+        }
+        if(head.version != meshFileVersion) {
+            return fail("mesh file: version " + std::to_string(head.version) + ", expected " + std::to_string(meshFileVersion));
+        }
+        if(head.fileSize != byteCount) {
+            return fail("mesh file: size " + std::to_string(byteCount) + ", header says " + std::to_string(head.fileSize));
+        }
+        if(head.sectionCount > sectionTypes
+           || sizeof(MeshFileHeader) + head.sectionCount * sizeof(MeshFileSection) > byteCount) {
+            return fail("mesh file: bad section table");
+        }
+
+        // section table
+        const MeshFileSection* table = reinterpret_cast<const MeshFileSection*>(bytes + sizeof(MeshFileHeader));
+        static const std::uint32_t elementSizes[sectionTypes] = {
+            sizeof(MeshFileAttribute), 0, 0, sizeof(MeshFileMesh), sizeof(MeshFileMaterial), sizeof(MeshFileInstance)
+        };
+        for(std::uint32_t i = 0; i < head.sectionCount; i++) {
+            const MeshFileSection& section = table[i];
+            const std::uint32_t type = std::uint32_t(section.type);
+            if(type < 1 || type > sectionTypes) {
+                return fail("mesh file: unknown section type " + std::to_string(type));
+            }
+            if(sections.section[type - 1] != nullptr) {
+                return fail("mesh file: duplicate section type " + std::to_string(type));
+            }
+            if(section.offset % meshFileAlignment != 0 || section.offset > byteCount || section.size > byteCount - section.offset) {
+                return fail("mesh file: section " + std::to_string(type) + " out of the file or misaligned");
+            }
+            if(section.elementSize == 0 || section.count != section.size / section.elementSize
+               || section.size % section.elementSize != 0) {
+                return fail("mesh file: section " + std::to_string(type) + " size doesn't match its count");
+            }
+            if(elementSizes[type - 1] != 0 && section.elementSize != elementSizes[type - 1]) {
+                return fail("mesh file: section " + std::to_string(type) + " has elements of a different version");
+            }
+            sections.section[type - 1] = &section;
+        }
+
+        // vertices and their layout
+        const MeshFileSection* vertices = find(MeshFileSectionType::Vertices);
+        if(vertices != nullptr && (head.vertexStride == 0 || vertices->elementSize != head.vertexStride)) {
+            return fail("mesh file: vertex stride doesn't match the vertex section");
+        }
+        for(const MeshFileAttribute& attribute : attributes()) {
+            const std::uint32_t size = attributeBytes(attribute.type, attribute.size);
+            if(attribute.location >= meshFileMaxAttributes) {
+                return fail("mesh file: attribute location " + std::to_string(attribute.location) + " out of range");
+            }
+            if(size == 0 || attribute.size < 1 || attribute.size > 4
+               || std::uint64_t(attribute.offset) + size > head.vertexStride) {
+                return fail("mesh file: attribute " + std::to_string(attribute.location) + " out of the vertex");
+            }
+        }
+
+        // indices
+        const MeshFileSection* indices = find(MeshFileSectionType::Indices);
+        const std::uint32_t indexSize = head.indexType == GL_UNSIGNED_SHORT ? 2 : (head.indexType == GL_UNSIGNED_INT ? 4 : 0);
+        if(indices != nullptr && indices->elementSize != indexSize) {
+            return fail("mesh file: index type doesn't match the index section");
+        }
+
+        // references between sections
+        const std::size_t materialCount = materials().size();
+        for(const MeshFileMesh& mesh : meshes()) {
+            if(std::uint64_t(mesh.firstIndex) + mesh.indexCount > indexCount()) {
+                return fail("mesh file: mesh out of the index buffer");
+            }
+            if(mesh.material != noMaterial && mesh.material >= materialCount) {
+                return fail("mesh file: mesh refers to a missing material");
+            }
+            if(checkIndices && !checkMeshIndices(mesh)) {
+                return fail("mesh file: index out of the vertex buffer");
+            }
+        }
+        for(const MeshFileMaterial& material : materials()) {
+            if(!terminated(material.name, sizeof(material.name)) || !terminated(material.texture, sizeof(material.texture))) {
+                return fail("mesh file: material strings not terminated");
+            }
+        }
+        for(const MeshFileInstance& instance : instances()) {
+            if(instance.mesh >= meshes().size()) {
+                return fail("mesh file: instance refers to a missing mesh");
+            }
+        }
+        return true;
+    }
+
+    bool checkMeshIndices(const MeshFileMesh& mesh) const
+    {
+        const std::int64_t vertexLimit = std::int64_t(vertexCount());
+        const void* data = indexData();
+        std::uint32_t largest = 0;
+        if(header().indexType == GL_UNSIGNED_SHORT) {
+            const std::uint16_t* index = static_cast<const std::uint16_t*>(data) + mesh.firstIndex;
+            for(std::uint32_t i = 0; i < mesh.indexCount; i++) {
+                largest = index[i] > largest ? index[i] : largest;
+            }
+        }
+        else {
+            const std::uint32_t* index = static_cast<const std::uint32_t*>(data) + mesh.firstIndex;
+            for(std::uint32_t i = 0; i < mesh.indexCount; i++) {
+                largest = index[i] > largest ? index[i] : largest;
+            }
+        }
+        return mesh.indexCount == 0
+            || (mesh.baseVertex >= 0 && std::int64_t(largest) + mesh.baseVertex < vertexLimit);
+    }
+
+    const unsigned char* mapped = nullptr;
+    std::size_t mappedSize = 0;
+    const unsigned char* bytes = nullptr;
+    std::size_t byteCount = 0;
+    SectionView sections = {};
+    std::string message;
+};
+
+} // namespace gl
@@ -0,0 +1,449 @@
+// Mesh levels of detail
+//
+// Simplifies indexed triangle meshes by edge collapses ordered by quadric
+// error (Garland and Heckbert): each vertex accumulates the planes of its
+// triangles, and collapsing an edge costs the mean squared distance from
+// those planes to where the vertex goes. A collapse moves a vertex onto
+// the other end of the edge rather than to a new position, so every level
+// of detail indexes the original vertices: the levels of a mesh are
+// ranges of one index buffer over one vertex buffer, and switching level
+// is drawing another range, e.g. another MultiDrawRenderer::Mesh.
+//
+// Vertices at the same position with other attributes, the seams of the
+// texture coordinates or of the normals, are never moved, nor are those on
+// non manifold edges. Vertices on open borders only slide along them.
+// Collapses that would flip a triangle are skipped.
+//
+// Collapses are done in passes: the cheapest first, none touching a
+// triangle changed earlier in the pass, then the candidates are evaluated
+// again. This takes O(n log n) per pass and a few passes per halving.
+//
+// The error of a level is the square root of the largest collapse cost, a
+// root mean square distance from planes of the original surface, weighted
+// by area. It is an estimate, not a bound on how far any point moved: a
+// small feature merged into large flat triangles can move further.
+//
+// At run time, selectLod() picks the coarsest level whose error, projected
+// with the glm::perspective parameters, stays under a pixel budget.
+//
+// Header only, needs glm and no GL.
+//
+//     std::vector<std::uint32_t> lodIndices;
+//     std::vector<gl::MeshLod> lods;
+//     gl::buildMeshLods(&model.vertices[0].position.x, model.vertices.size(), sizeof(gl::ObjVertex),
+//                       model.indices.data(), model.indices.size(), lodIndices, lods);
+//     const float scale = gl::lodProjectionScale(glm::radians(45.0f), float(height));
+//     const gl::MeshLod& lod = lods[gl::selectLod(lods.data(), lods.size(), distance, scale)];
+//     glDrawElements(GL_TRIANGLES, lod.indexCount, GL_UNSIGNED_INT, (void*)(lod.firstIndex * sizeof(GLuint)));
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace gl {
+
+struct MeshLod
+{
+    std::uint32_t firstIndex;
+    std::uint32_t indexCount;
+    float error;                // root mean square distance from the original surface, in mesh units
+};
+
+namespace detail {
+
+// Symmetric 3x3 matrix, vector and constant of the squared distance to a
+// set of planes, and the total weight of the planes.
+struct LodQuadric
+{
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0;
+    double c = 0;
+    double weight = 0;
+
+    void addPlane(const glm::dvec3& normal, double distance, double planeWeight)
+    {
+        a00 += planeWeight * normal.x * normal.x;
+        a01 += planeWeight * normal.x * normal.y;
+        a02 += planeWeight * normal.x * normal.z;
+        a11 += planeWeight * normal.y * normal.y;
+        a12 += planeWeight * normal.y * normal.z;
+        a22 += planeWeight * normal.z * normal.z;
+        b0 += planeWeight * normal.x * distance;
+        b1 += planeWeight * normal.y * distance;
+        b2 += planeWeight * normal.z * distance;
+        c += planeWeight * distance * distance;
+        weight += planeWeight;
+    }
+
+    void add(const LodQuadric& other)
+    {
+        a00 += other.a00;
+        a01 += other.a01;
+        a02 += other.a02;
+        a11 += other.a11;
+        a12 += other.a12;
+        a22 += other.a22;
+        b0 += other.b0;
+        b1 += other.b1;
+        b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+    }
+
+    double evaluate(const glm::dvec3& p) const
+    {
+        return p.x * (a00 * p.x + 2.0 * (a01 * p.y + a02 * p.z + b0)) + p.y * (a11 * p.y + 2.0 * (a12 * p.z + b1))
+               + p.z * (a22 * p.z + 2.0 * b2) + c;
+    }
+};
+
+} // namespace detail
+
+// Keeps the state of a simplification, the quadrics and which vertices may
+// move, so that successive simplify() calls build a chain of levels, each
+// from the previous one.
+class MeshSimplifier
+{
+public:
+    // Positions are read as 3 floats every stride bytes.
+    MeshSimplifier(const float* positions, std::size_t vertexCount, std::size_t stride, const std::uint32_t* indices,
+                   std::size_t indexCount)
+        : points(vertexCount), kinds(vertexCount, Manifold), quadrics(vertexCount),
+          current(indices, indices + indexCount / 3 * 3)
+    {
+        for(std::size_t i = 0; i < vertexCount; i++) {
+            const float* p = reinterpret_cast<const float*>(reinterpret_cast<const unsigned char*>(positions) + i * stride);
+            points[i] = glm::vec3(p[0], p[1], p[2]);
+        }
+        classifyVertices();
+        computeQuadrics();
+    }
+
+    // Collapses edges until at most targetIndexCount indices are left or
+    // the next collapse would cost more than maxError, compared as the root
+    // mean square distance error() returns. Returns the largest error so far.
+    float simplify(std::size_t targetIndexCount, float maxError = std::numeric_limits<float>::infinity())
+    {
+        const double errorLimit = double(maxError) * double(maxError);
+        std::vector<Collapse> collapses;
+        std::vector<std::uint32_t> remap(points.size());
+        std::vector<bool> touched(points.size());
+        while(current.size() > targetIndexCount) {
+            buildAdjacency();
+            collectCollapses(collapses, errorLimit);
+            if(collapses.empty()) {
+                break;
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+            for(std::size_t v = 0; v < remap.size(); v++) {
+                remap[v] = std::uint32_t(v);
+            }
+            std::fill(touched.begin(), touched.end(), false);
+            std::size_t triangles = current.size() / 3;
+            const std::size_t targetTriangles = targetIndexCount / 3;
+            std::size_t applied = 0;
+            for(const Collapse& collapse : collapses) {
+                if(triangles <= targetTriangles) {
+                    break;
+                }
+                if(touched[collapse.from] || touched[collapse.to] || flips(collapse)) {
+                    continue;
+                }
+                // the triangles around from change, their vertices wait
+                // for the next pass
+                for(std::uint32_t i = offsets[collapse.from]; i < offsets[collapse.from + 1]; i++) {
+                    const std::uint32_t* triangle = &current[3 * std::size_t(adjacency[i])];
+                    touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+                    triangles -= triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to ? 1 : 0;
+                }
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to].add(quadrics[collapse.from]);
+                largestError = std::max(largestError, collapse.cost);
+                applied++;
+            }
+            if(applied == 0) {
+                break;
+            }
+
+            std::size_t kept = 0;
+            for(std::size_t i = 0; i < current.size(); i += 3) {
+                const std::uint32_t a = remap[current[i]], b = remap[current[i + 1]], c = remap[current[i + 2]];
+                if(a != b && b != c && c != a) {
+                    current[kept++] = a;
+                    current[kept++] = b;
+                    current[kept++] = c;
+                }
+            }
+            current.resize(kept);
+        }
+        return error();
+    }
+
+    const std::vector<std::uint32_t>& indices() const { return current; }
+    float error() const { return float(std::sqrt(largestError)); }
+
+private:
+    enum Kind : std::uint8_t
+    {
+        Manifold,   // free to move
+        Border,     // on an open border, moves along it
+        Locked,     // on a seam or a non manifold edge
+    };
+
+    struct Collapse
+    {
+        std::uint32_t from;
+        std::uint32_t to;
+        double cost;
+    };
+
+    // Vertices sharing a position are one for the topology, and locked.
+    void classifyVertices()
+    {
+        std::vector<std::uint32_t> order(points.size());
+        for(std::size_t i = 0; i < order.size(); i++) {
+            order[i] = std::uint32_t(i);
+        }
+        auto less = [this](std::uint32_t a, std::uint32_t b) {
+            const glm::vec3& p = points[a];
+            const glm::vec3& q = points[b];
+            return p.x != q.x ? p.x < q.x : p.y != q.y ? p.y < q.y : p.z < q.z;
+        };
+        std::sort(order.begin(), order.end(), less);
+        std::vector<std::uint32_t> canonical(points.size());
+        for(std::size_t i = 0; i < order.size(); i++) {
+            if(i > 0 && points[order[i]] == points[order[i - 1]]) {
+                canonical[order[i]] = canonical[order[i - 1]];
+                kinds[order[i]] = kinds[order[i - 1]] = Locked;
+            }
+            else {
+                canonical[order[i]] = order[i];
+            }
+        }
+
+        // directed edges: one without its reverse is on a border, one
+        // found twice is non manifold
+        std::vector<std::uint64_t> edges;
+        edges.reserve(current.size());
+        for(std::size_t i = 0; i < current.size(); i += 3) {
+            for(int k = 0; k < 3; k++) {
+                const std::uint64_t a = canonical[current[i + k]];
+                const std::uint64_t b = canonical[current[i + (k + 1) % 3]];
+                edges.push_back(a << 32 | b);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        std::vector<Kind> canonicalKinds(points.size(), Manifold);
+        for(std::size_t i = 0; i < edges.size(); i++) {
+            const std::uint32_t a = std::uint32_t(edges[i] >> 32);
+            const std::uint32_t b = std::uint32_t(edges[i]);
+            if((i + 1 < edges.size() && edges[i + 1] == edges[i]) || a == b) {
+                canonicalKinds[a] = canonicalKinds[b] = Locked;
+            }
+            else if(!std::binary_search(edges.begin(), edges.end(), std::uint64_t(b) << 32 | a)) {
+                canonicalKinds[a] = std::max(canonicalKinds[a], Border);
+                canonicalKinds[b] = std::max(canonicalKinds[b], Border);
+            }
+        }
+        for(std::size_t i = 0; i < points.size(); i++) {
+            kinds[i] = std::max(kinds[i], canonicalKinds[canonical[i]]);
+        }
+    }
+
+    // Planes of the triangles weighted by their area, and on borders planes
+    // through the edge perpendicular to the triangle, heavier, so that the
+    // outline stays.
+    void computeQuadrics()
+    {
+        for(std::size_t i = 0; i < current.size(); i += 3) {
+            const std::uint32_t v[3] = { current[i], current[i + 1], current[i + 2] };
+            const glm::dvec3 p0(points[v[0]]), p1(points[v[1]]), p2(points[v[2]]);
+            const glm::dvec3 cross = glm::cross(p1 - p0, p2 - p0);
+            const double length = glm::length(cross);
+            if(length == 0.0) {
+                continue;
+            }
+            const glm::dvec3 normal = cross / length;
+            detail::LodQuadric plane;
+            plane.addPlane(normal, -glm::dot(normal, p0), length * 0.5);
+            for(int k = 0; k < 3; k++) {
+                quadrics[v[k]].add(plane);
+            }
+
+            for(int k = 0; k < 3; k++) {
+                const std::uint32_t a = v[k], b = v[(k + 1) % 3];
+                if(kinds[a] != Border || kinds[b] != Border) {
+                    continue;
+                }
+                const glm::dvec3 pa(points[a]), pb(points[b]);
+                const glm::dvec3 edge = pb - pa;
+                const glm::dvec3 side = glm::cross(edge, normal);
+                const double sideLength = glm::length(side);
+                if(sideLength == 0.0) {
+                    continue;
+                }
+                // interior edges between border vertices get it too, only
+                // slightly restricting them
+                detail::LodQuadric border;
+                border.addPlane(side / sideLength, -glm::dot(side / sideLength, pa), 10.0 * glm::dot(edge, edge));
+                quadrics[a].add(border);
+                quadrics[b].add(border);
+            }
+        }
+    }
+
+    // Triangles around each vertex, in offsets and adjacency.
+    void buildAdjacency()
+    {
+        offsets.assign(points.size() + 1, 0);
+        for(std::uint32_t v : current) {
+            offsets[v + 1]++;
+        }
+        for(std::size_t v = 0; v < points.size(); v++) {
+            offsets[v + 1] += offsets[v];
+        }
+        adjacency.resize(current.size());
+        std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for(std::size_t i = 0; i < current.size(); i++) {
+            adjacency[fill[current[i]]++] = std::uint32_t(i / 3);
+        }
+    }
+
+    std::uint32_t sharedTriangles(std::uint32_t a, std::uint32_t b) const
+    {
+        std::uint32_t count = 0;
+        for(std::uint32_t i = offsets[a]; i < offsets[a + 1]; i++) {
+            const std::uint32_t* triangle = &current[3 * std::size_t(adjacency[i])];
+            count += triangle[0] == b || triangle[1] == b || triangle[2] == b ? 1 : 0;
+        }
+        return count;
+    }
+
+    bool canCollapse(std::uint32_t from, std::uint32_t to) const
+    {
+        if(kinds[from] == Manifold) {
+            return true;
+        }
+        // along the border only, not across the mesh between two borders
+        return kinds[from] == Border && kinds[to] == Border && sharedTriangles(from, to) == 1;
+    }
+
+    // Mean squared distance of to from the planes gathered by both ends,
+    // weighted by their area.
+    double cost(std::uint32_t from, std::uint32_t to) const
+    {
+        detail::LodQuadric sum = quadrics[from];
+        sum.add(quadrics[to]);
+        return sum.weight > 0.0 ? std::max(0.0, sum.evaluate(glm::dvec3(points[to]))) / sum.weight : 0.0;
+    }
+
+    // The cheaper direction of each edge that may collapse, each edge seen
+    // from its triangles, once per triangle.
+    void collectCollapses(std::vector<Collapse>& collapses, double errorLimit) const
+    {
+        collapses.clear();
+        for(std::size_t i = 0; i < current.size(); i += 3) {
+            for(int k = 0; k < 3; k++) {
+                const std::uint32_t a = current[i + k], b = current[i + (k + 1) % 3];
+                if(a > b && kinds[a] != Border) {
+                    continue;   // the other triangle has it
+                }
+                const bool forward = canCollapse(a, b);
+                const bool backward = canCollapse(b, a);
+                if(!forward && !backward) {
+                    continue;
+                }
+                const double forwardCost = forward ? cost(a, b) : std::numeric_limits<double>::infinity();
+                const double backwardCost = backward ? cost(b, a) : std::numeric_limits<double>::infinity();
+                const Collapse collapse = forwardCost <= backwardCost ? Collapse{ a, b, forwardCost } : Collapse{ b, a, backwardCost };
+                if(collapse.cost <= errorLimit) {
+                    collapses.push_back(collapse);
+                }
+            }
+        }
+    }
+
+    // Whether moving from onto to turns a remaining triangle over.
+    bool flips(const Collapse& collapse) const
+    {
+        const glm::vec3& target = points[collapse.to];
+        for(std::uint32_t i = offsets[collapse.from]; i < offsets[collapse.from + 1]; i++) {
+            const std::uint32_t* triangle = &current[3 * std::size_t(adjacency[i])];
+            if(triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) {
+                continue;
+            }
+            glm::vec3 p[3] = { points[triangle[0]], points[triangle[1]], points[triangle[2]] };
+            const glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+            for(int k = 0; k < 3; k++) {
+                p[k] = triangle[k] == collapse.from ? target : p[k];
+            }
+            const glm::vec3 after = glm::cross(p[1] - p[0], p[2] - p[0]);
+            if(glm::dot(before, after) <= 0.0f) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<glm::vec3> points;
+    std::vector<Kind> kinds;
+    std::vector<detail::LodQuadric> quadrics;
+    std::vector<std::uint32_t> current;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> adjacency;
+    double largestError = 0.0;
+};
+
+// Appends the levels of detail of a mesh to lodIndices and lods, the full
+// mesh first, then each with about ratio times the triangles of the one
+// before, until maxLevels or until simplification stalls.
+inline void buildMeshLods(const float* positions, std::size_t vertexCount, std::size_t stride, const std::uint32_t* indices,
+                          std::size_t indexCount, std::vector<std::uint32_t>& lodIndices, std::vector<MeshLod>& lods,
+                          unsigned int maxLevels = 8, float ratio = 0.5f)
+{
+    MeshSimplifier simplifier(positions, vertexCount, stride, indices, indexCount);
+    lods.push_back({ std::uint32_t(lodIndices.size()), std::uint32_t(simplifier.indices().size()), 0.0f });
+    lodIndices.insert(lodIndices.end(), simplifier.indices().begin(), simplifier.indices().end());
+    for(unsigned int level = 1; level < maxLevels; level++) {
+        const std::size_t previous = simplifier.indices().size();
+        const std::size_t target = std::size_t(double(previous / 3) * ratio) * 3;
+        const float error = simplifier.simplify(target);
+        // less than a tenth fewer triangles is not worth a level
+        if(simplifier.indices().empty() || simplifier.indices().size() * 10 > previous * 9) {
+            break;
+        }
+        lods.push_back({ std::uint32_t(lodIndices.size()), std::uint32_t(simplifier.indices().size()), error });
+        lodIndices.insert(lodIndices.end(), simplifier.indices().begin(), simplifier.indices().end());
+    }
+}
+
+// Pixels covered by a unit of length at distance 1, from the fovy given to
+// glm::perspective and the height of the viewport in pixels.
+inline float lodProjectionScale(float fovy, float viewportHeight)
+{
+    return viewportHeight / (2.0f * std::tan(fovy * 0.5f));
+}
+
+// The coarsest level whose error, seen at distance and multiplied by
+// scale, the size of the mesh in the world, covers at most maxPixels.
+inline std::size_t selectLod(const MeshLod* lods, std::size_t count, float distance, float projectionScale,
+                             float maxPixels = 1.0f, float scale = 1.0f)
+{
+    const float pixelsPerUnit = projectionScale * scale / std::max(distance, std::numeric_limits<float>::min());
+    std::size_t level = 0;
+    while(level + 1 < count && lods[level + 1].error * pixelsPerUnit <= maxPixels) {
+        level++;
+    }
+    return level;
+}
+
+} // namespace gl
@@ -0,0 +1,242 @@
+// Multi draw indirect renderer
+//
+// Draws many meshes stored in one vertex array (a shared vertex buffer and a
+// shared GL_UNSIGNED_INT index buffer, each mesh being a range of it) with a
+// single glMultiDrawElementsIndirect per frame.
+//
+// Needs GL 4.3 and GL_ARB_buffer_storage (core in 4.4). The draw commands
+// and the model matrices are written straight into persistently mapped
+// buffers split in frameLatency regions, each guarded by a fence. Every
+// command uses its draw index as baseInstance, which the instanced drawId
+// attribute turns into an index in the shader storage buffer of matrices:
+//
+//     #version 430 core
+//     layout(location = 15) in uint drawId;   // drawIdLocation
+//     layout(std430, binding = 0) readonly buffer Transforms { mat4 models[]; };
+//     ... models[drawId] ...
+//
+// Other contexts (3.3, macOS stops at 4.1) fall back to one
+// glDrawElementsBaseVertex per mesh, uploading the matrix to a mat4 uniform.
+// indirect() tells which path is used, so the matching program can be picked.
+//
+// Header only, include it after glad and gl_state_cache.h.
+//
+//     gl::MultiDrawRenderer renderer(maxDraws);
+//     renderer.init(glState, vao);
+//     while(...) {
+//         renderer.begin();
+//         renderer.draw(mesh, glm::value_ptr(model));
+//         ...
+//         renderer.submit(glState, modelLocation);
+//     }
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace gl {
+
+class MultiDrawRenderer
+{
+public:
+    static constexpr unsigned int frameLatency = 3;
+    static constexpr GLuint transformBinding = 0;
+
+    struct Mesh
+    {
+        GLuint indexCount;
+        GLuint firstIndex;
+        GLint baseVertex;
+    };
+
+    // Layout of the records read by glMultiDrawElementsIndirect.
+    struct Command
+    {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint firstIndex;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+
+    explicit MultiDrawRenderer(unsigned int maxDraws, GLuint drawIdLocation = 15)
+        : maxDraws(maxDraws), drawIdLocation(drawIdLocation)
+    {
+    }
+
+    MultiDrawRenderer(const MultiDrawRenderer&) = delete;
+    MultiDrawRenderer& operator=(const MultiDrawRenderer&) = delete;
+
+    // Whether the context can run the indirect path.
+    static bool supported()
+    {
+        return GLAD_GL_VERSION_4_3 && GLAD_GL_ARB_buffer_storage;
+    }
+
+    // Creates the buffers and adds the drawId attribute to vertexArray.
+    // useIndirect = false forces the fallback, e.g. to compare both paths.
+    void init(StateCache& state, VertexArray vertexArray, bool useIndirect = true)
+    {
+        vao = vertexArray;
+        indirectPath = useIndirect && supported();
+        if(!indirectPath) {
+            fallbackDraws.reserve(maxDraws);
+            return;
+        }
+
+        // regions of the transform buffer are bound with glBindBufferRange,
+        // their offsets have to be aligned
+        GLint alignment = 1;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        commandRegion = GLsizeiptr(maxDraws * sizeof(Command));
+        transformRegion = roundUp(GLsizeiptr(maxDraws * 16 * sizeof(GLfloat)), alignment);
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        commandBuffer = state.createBuffer();
+        state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+        glBufferStorage(GL_DRAW_INDIRECT_BUFFER, frameLatency * commandRegion, nullptr, flags);
+        commands = static_cast<unsigned char*>(glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, 0, frameLatency * commandRegion, flags));
+
+        transformBuffer = state.createBuffer();
+        state.bindBuffer(GL_SHADER_STORAGE_BUFFER, transformBuffer);
+        glBufferStorage(GL_SHADER_STORAGE_BUFFER, frameLatency * transformRegion, nullptr, flags);
+        transforms = static_cast<unsigned char*>(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, frameLatency * transformRegion, flags));
+
+        // drawId = baseInstance + gl_InstanceID / 1, read from 0, 1, 2...
+        std::vector<GLuint> ids(maxDraws);
+        for(unsigned int i = 0; i < maxDraws; i++) {
+            ids[i] = i;
+        }
+        drawIdBuffer = state.createBuffer();
+        state.bindVertexArray(vao);
+        state.bindBuffer(GL_ARRAY_BUFFER, drawIdBuffer);
+        glBufferStorage(GL_ARRAY_BUFFER, GLsizeiptr(ids.size() * sizeof(GLuint)), ids.data(), 0);
+        glVertexAttribIPointer(drawIdLocation, 1, GL_UNSIGNED_INT, sizeof(GLuint), nullptr);
+        glVertexAttribDivisor(drawIdLocation, 1);
+        glEnableVertexAttribArray(drawIdLocation);
+
+        if(commands == nullptr || transforms == nullptr) {
+            indirectPath = false;
+            fallbackDraws.reserve(maxDraws);
+        }
+    }
+
+    bool indirect() const { return indirectPath; }
+
+    // Starts a frame, waiting if the GPU still reads the region it reuses.
+    void begin()
+    {
+        drawCount = 0;
+        if(!indirectPath) {
+            fallbackDraws.clear();
+            return;
+        }
+
+        region = (region + 1) % frameLatency;
+        GLsync& fence = fences[region];
+        if(fence != nullptr) {
+            if(glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                stalls++;
+                while(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {
+                }
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    // Queues a mesh with its column major model matrix. Returns false when
+    // maxDraws meshes are already queued this frame.
+    bool draw(const Mesh& mesh, const GLfloat* model)
+    {
+        if(drawCount == maxDraws) {
+            overflow++;
+            return false;
+        }
+
+        if(indirectPath) {
+            const Command command = { mesh.indexCount, 1, mesh.firstIndex, mesh.baseVertex, drawCount };
+            std::memcpy(commands + region * commandRegion + drawCount * sizeof(Command), &command, sizeof(Command));
+            std::memcpy(transforms + region * transformRegion + drawCount * 16 * sizeof(GLfloat), model, 16 * sizeof(GLfloat));
+        }
+        else {
+            FallbackDraw draw;
+            draw.mesh = mesh;
+            std::memcpy(draw.model, model, sizeof(draw.model));
+            fallbackDraws.push_back(draw);
+        }
+        drawCount++;
+        return true;
+    }
+
+    // Issues the queued meshes with the program currently in use.
+    // modelLocation is only used by the fallback.
+    void submit(StateCache& state, GLint modelLocation, GLenum mode = GL_TRIANGLES)
+    {
+        if(drawCount == 0) {
+            return;
+        }
+        state.bindVertexArray(vao);
+
+        if(indirectPath) {
+            state.bindBufferRange(GL_SHADER_STORAGE_BUFFER, transformBinding, transformBuffer, region * transformRegion,
+                                  transformRegion);
+            state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+            glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT,
+                                        reinterpret_cast<const void*>(region * commandRegion), GLsizei(drawCount), 0);
+            fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            return;
+        }
+
+        for(const FallbackDraw& draw : fallbackDraws) {
+            glUniformMatrix4fv(modelLocation, 1, GL_FALSE, draw.model);
+            glDrawElementsBaseVertex(mode, GLsizei(draw.mesh.indexCount), GL_UNSIGNED_INT,
+                                     reinterpret_cast<const void*>(draw.mesh.firstIndex * sizeof(GLuint)),
+                                     draw.mesh.baseVertex);
+        }
+    }
+
+    // Frames that had to wait for the GPU in begin().
+    unsigned long stalledFrames() const { return stalls; }
+
+    // Draws refused because maxDraws was reached.
+    unsigned long overflowDraws() const { return overflow; }
+
+private:
+    struct FallbackDraw
+    {
+        Mesh mesh;
+        GLfloat model[16];
+    };
+
+    static GLsizeiptr roundUp(GLsizeiptr size, GLint alignment)
+    {
+        return alignment > 1 ? (size + alignment - 1) / alignment * alignment : size;
+    }
+
+    const unsigned int maxDraws;
+    const GLuint drawIdLocation;
+    bool indirectPath = false;
+    VertexArray vao;
+
+    Buffer commandBuffer;
+    Buffer transformBuffer;
+    Buffer drawIdBuffer;
+    unsigned char* commands = nullptr;
+    unsigned char* transforms = nullptr;
+    GLsizeiptr commandRegion = 0;
+    GLsizeiptr transformRegion = 0;
+    GLsync fences[frameLatency] = {};
+    unsigned int region = 0;
+
+    std::vector<FallbackDraw> fallbackDraws;
+    unsigned int drawCount = 0;
+
+    unsigned long stalls = 0;
+    unsigned long overflow = 0;
+};
+
+} // namespace gl
@@ -0,0 +1,793 @@
+// Wavefront OBJ loader
+//
+// Loads positions, texture coordinates, normals, faces (triangulated as
+// fans), o/g groups and usemtl/mtllib materials into an indexed triangle
+// list ready for glBufferData, in the layout the examples set up in
+// createArrays:
+//
+//     vec3 position, vec2 texCoord, vec3 normal      32 bytes per vertex
+//
+// The file is mapped and cut at line boundaries into one chunk per thread.
+// Each thread parses its chunk, then resolves its face corners to vertices
+// and welds equal ones with a hash map keyed on the glm vectors
+// (GLM_GTX_hash). The per thread vertices are then welded once more into
+// the final vertex buffer and the indices remapped, again in parallel.
+//
+// Numbers are read without strtof: digits are converted 8 at a time within
+// a 64 bit register and scaled by an exact power of ten in double, which
+// gives the float nearest to the text except for double rounding, at most
+// one unit in the last place. Numbers with more than 19 digits or large
+// exponents fall back to strtod.
+//
+// Header only, include it after glad, with GLM_ENABLE_EXPERIMENTAL defined.
+// mmap makes it POSIX only.
+//
+//     gl::ObjModel model;
+//     std::string error;
+//     if(!gl::loadObj("../res/teapot.obj", model, &error)) {
+//         std::cout << error << std::endl;
+//     }
+//     glBufferData(GL_ARRAY_BUFFER, model.vertices.size() * sizeof(gl::ObjVertex), model.vertices.data(), GL_STATIC_DRAW);
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+namespace gl {
+
+struct ObjVertex
+{
+    glm::vec3 position;
+    glm::vec2 texCoord;
+    glm::vec3 normal;
+
+    bool operator==(const ObjVertex& other) const
+    {
+        return position == other.position && texCoord == other.texCoord && normal == other.normal;
+    }
+};
+
+static_assert(sizeof(ObjVertex) == 8 * sizeof(float), "ObjVertex is 8 packed floats");
+
+struct ObjVertexHash
+{
+    std::size_t operator()(const ObjVertex& vertex) const
+    {
+        std::size_t seed = std::hash<glm::vec3>()(vertex.position);
+        glm::detail::hash_combine(seed, std::hash<glm::vec2>()(vertex.texCoord));
+        glm::detail::hash_combine(seed, std::hash<glm::vec3>()(vertex.normal));
+        return seed;
+    }
+};
+
+struct ObjMaterial
+{
+    std::string name;
+    std::string texture;          // map_Kd, relative to the MTL file
+};
+
+// A range of the index buffer with one material.
+struct ObjMesh
+{
+    std::string name;
+    GLuint firstIndex;
+    GLuint indexCount;
+    GLuint material;              // ObjModel::noMaterial if none
+};
+
+struct ObjModel
+{
+    static constexpr GLuint noMaterial = 0xffffffffu;
+
+    std::vector<ObjVertex> vertices;
+    std::vector<GLuint> indices;
+    std::vector<ObjMesh> meshes;
+    std::vector<ObjMaterial> materials;
+    // whether any face corner had one, missing ones are zero
+    bool hasTexCoords = false;
+    bool hasNormals = false;
+};
+
+namespace detail {
+
+// Number of leading decimal digits in the 8 bytes at text, and their value.
+inline unsigned int objDigits8(const char* text, std::uint64_t& value)
+{
+    std::uint64_t chunk;
+    std::memcpy(&chunk, text, sizeof(chunk));
+
+    // a byte is a digit when its high nibble is 3, before and after adding 6
+    std::uint64_t nonDigits = (chunk & 0xf0f0f0f0f0f0f0f0ull)
+                            | (((chunk + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4);
+    nonDigits ^= 0x3333333333333333ull;
+    const unsigned int count = nonDigits == 0 ? 8 : unsigned(__builtin_ctzll(nonDigits)) / 8;
+    if(count == 0) {
+        return 0;
+    }
+
+    // keep the digits as the low order ones, the first char being the most
+    // significant, then combine pairs, quads and the two halves
+    std::uint64_t digits = (chunk - 0x3030303030303030ull) << (8 * (8 - count));
+    digits = digits * 10 + (digits >> 8);
+    digits = (((digits & 0x000000ff000000ffull) * (100 + (1000000ull << 32)))
+            + (((digits >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >> 32;
+    value = digits;
+    return count;
+}
+
+// Reads a run of digits into mantissa, returns the number of digits.
+inline unsigned int objDigits(const char*& text, const char* end, std::uint64_t& mantissa, unsigned int& significant)
+{
+    static const std::uint64_t scales[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    unsigned int total = 0;
+    for(;;) {
+        unsigned int count;
+        std::uint64_t value;
+        if(end - text >= 8) {
+            count = objDigits8(text, value);
+        }
+        else {
+            count = 0;
+            value = 0;
+            while(text + count < end && unsigned(text[count] - '0') < 10) {
+                value = value * 10 + unsigned(text[count] - '0');
+                count++;
+            }
+        }
+        if(count == 0) {
+            return total;
+        }
+        // digits past 19 would overflow, mark the number for strtod
+        if(significant + count <= 19) {
+            mantissa = mantissa * scales[count] + value;
+            if(mantissa != 0) {
+                significant += count;
+            }
+        }
+        else {
+            significant = 20;
+        }
+        text += count;
+        total += count;
+        if(count < 8) {
+            return total;
+        }
+    }
+}
+
+inline bool objSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Parses a float at text, skipping spaces first. Returns false if there is
+// no number.
+inline bool objFloat(const char*& text, const char* end, float& result)
+{
+    static const double powers[23] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    while(text < end && objSpace(*text)) {
+        text++;
+    }
+    const char* start = text;
+    const bool negative = text < end && *text == '-';
+    if(text < end && (*text == '-' || *text == '+')) {
+        text++;
+    }
+
+    std::uint64_t mantissa = 0;
+    unsigned int significant = 0;
+    unsigned int digits = objDigits(text, end, mantissa, significant);
+    int exponent = 0;
+    if(text < end && *text == '.') {
+        text++;
+        const unsigned int fraction = objDigits(text, end, mantissa, significant);
+        digits += fraction;
+        exponent = -int(fraction);
+    }
+    if(digits == 0) {
+        text = start;
+        return false;
+    }
+    if(text < end && (*text == 'e' || *text == 'E')) {
+        const char* mark = text;
+        text++;
+        const bool negativeExponent = text < end && *text == '-';
+        if(text < end && (*text == '-' || *text == '+')) {
+            text++;
+        }
+        int value = 0;
+        const char* first = text;
+        while(text < end && unsigned(*text - '0') < 10) {
+            value = value < 10000 ? value * 10 + (*text - '0') : value;
+            text++;
+        }
+        if(text == first) {
+            text = mark;
+        }
+        else {
+            exponent += negativeExponent ? -value : value;
+        }
+    }
+
+    if(significant <= 19 && mantissa < (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double value = double(mantissa);
+        value = exponent < 0 ? value / powers[-exponent] : value * powers[exponent];
+        result = float(negative ? -value : value);
+        return true;
+    }
+
+    // rare: long mantissas and large exponents
+    char buffer[128];
+    const std::size_t length = std::size_t(text - start) < sizeof(buffer) - 1 ? std::size_t(text - start) : sizeof(buffer) - 1;
+    std::memcpy(buffer, start, length);
+    buffer[length] = 0;
+    result = float(std::strtod(buffer, nullptr));
+    return true;
+}
+
+inline bool objInteger(const char*& text, const char* end, long& result)
+{
+    const bool negative = text < end && *text == '-';
+    if(text < end && (*text == '-' || *text == '+')) {
+        text++;
+    }
+    std::uint64_t value = 0;
+    unsigned int significant = 0;
+    if(objDigits(text, end, value, significant) == 0 || significant > 18) {
+        return false;
+    }
+    result = negative ? -long(value) : long(value);
+    return true;
+}
+
+// Face corner, indices of position, texture coords and normal, with a bit
+// per attribute whose index was negative.
+struct ObjCorner
+{
+    std::int32_t index[3];
+    std::uint32_t relative;
+};
+
+static constexpr std::int32_t objAbsent = INT32_MIN;
+
+// A change of group or material starting at corner firstCorner.
+struct ObjRun
+{
+    std::size_t firstCorner;
+    bool material;                // usemtl, otherwise o or g
+    std::string name;
+};
+
+struct ObjChunk
+{
+    const char* begin;
+    const char* end;
+
+    std::vector<float> attributes[3];          // positions, texture coords, normals
+    std::vector<ObjCorner> corners;            // 3 per triangle
+    std::vector<ObjRun> runs;
+    std::vector<std::string> libraries;
+    std::size_t lines = 0;
+
+    std::vector<ObjVertex> vertices;           // welded within the chunk
+    std::vector<GLuint> indices;               // into vertices
+    std::vector<GLuint> remap;                 // vertices to model vertices
+    bool texCoords = false;
+    bool normals = false;
+
+    std::size_t errorLine = 0;                 // 1 based within the chunk, 0 if none
+    std::string error;
+};
+
+static constexpr unsigned int objComponents[3] = { 3, 2, 3 };
+
+inline bool objKeyword(const char* text, const char* end, const char* keyword, std::size_t length)
+{
+    return std::size_t(end - text) > length && std::memcmp(text, keyword, length) == 0 && objSpace(text[length]);
+}
+
+inline std::string objName(const char* text, const char* end)
+{
+    while(text < end && objSpace(*text)) {
+        text++;
+    }
+    while(end > text && objSpace(end[-1])) {
+        end--;
+    }
+    return std::string(text, end);
+}
+
+// Reads the attributes and faces of a chunk. Indices are made 0 based;
+// negative ones are made relative to the start of the chunk and flagged,
+// since the attributes of previous chunks are not counted yet.
+inline void parseObjChunk(ObjChunk& chunk)
+{
+    const char* line = chunk.begin;
+    while(line < chunk.end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', std::size_t(chunk.end - line)));
+        if(lineEnd == nullptr) {
+            lineEnd = chunk.end;
+        }
+        chunk.lines++;
+
+        const char* text = line;
+        while(text < lineEnd && objSpace(*text)) {
+            text++;
+        }
+
+        int attribute = -1;
+        if(objKeyword(text, lineEnd, "v", 1)) {
+            attribute = 0;
+            text += 1;
+        }
+        else if(objKeyword(text, lineEnd, "vt", 2)) {
+            attribute = 1;
+            text += 2;
+        }
+        else if(objKeyword(text, lineEnd, "vn", 2)) {
+            attribute = 2;
+            text += 2;
+        }
+
+        if(attribute >= 0) {
+            // extra components, w or vertex colors, are ignored
+            std::vector<float>& values = chunk.attributes[attribute];
+            for(unsigned int i = 0; i < objComponents[attribute]; i++) {
+                float value = 0.0f;
+                if(!objFloat(text, lineEnd, value) && !(attribute == 1 && i == 1)) {
+                    chunk.errorLine = chunk.lines;
+                    chunk.error = "bad number";
+                    return;
+                }
+                values.push_back(value);
+            }
+        }
+        else if(objKeyword(text, lineEnd, "f", 1)) {
+            text += 1;
+            ObjCorner first = {}, previous = {};
+            unsigned int count = 0;
+            for(;;) {
+                while(text < lineEnd && objSpace(*text)) {
+                    text++;
+                }
+                if(text == lineEnd) {
+                    break;
+                }
+
+                ObjCorner corner = { { objAbsent, objAbsent, objAbsent }, 0 };
+                for(unsigned int a = 0; a < 3; a++) {
+                    if(a > 0) {
+                        if(text == lineEnd || *text != '/') {
+                            break;
+                        }
+                        text++;
+                        if(a == 1 && text < lineEnd && *text == '/') {
+                            continue;
+                        }
+                    }
+                    long index = 0;
+                    if(!objInteger(text, lineEnd, index) || index == 0 || index > INT32_MAX || index < -INT32_MAX) {
+                        chunk.errorLine = chunk.lines;
+                        chunk.error = "bad face";
+                        return;
+                    }
+                    const long known = long(chunk.attributes[a].size() / objComponents[a]);
+                    if(index < 0) {
+                        corner.relative |= 1u << a;
+                    }
+                    corner.index[a] = std::int32_t(index < 0 ? known + index : index - 1);
+                }
+
+                if(count == 0) {
+                    first = corner;
+                }
+                else if(count >= 2) {
+                    chunk.corners.push_back(first);
+                    chunk.corners.push_back(previous);
+                    chunk.corners.push_back(corner);
+                }
+                previous = corner;
+                count++;
+            }
+            if(count < 3) {
+                chunk.errorLine = chunk.lines;
+                chunk.error = "face with less than 3 corners";
+                return;
+            }
+        }
+        else if(objKeyword(text, lineEnd, "o", 1) || objKeyword(text, lineEnd, "g", 1)) {
+            chunk.runs.push_back({ chunk.corners.size(), false, objName(text + 1, lineEnd) });
+        }
+        else if(objKeyword(text, lineEnd, "usemtl", 6)) {
+            chunk.runs.push_back({ chunk.corners.size(), true, objName(text + 6, lineEnd) });
+        }
+        else if(objKeyword(text, lineEnd, "mtllib", 6)) {
+            chunk.libraries.push_back(objName(text + 6, lineEnd));
+        }
+        line = lineEnd + 1;
+    }
+}
+
+// Open addressing set of vertices, storing ids into a vertex array. Much
+// faster than std::unordered_map, which allocates a node per vertex.
+class ObjWeldTable
+{
+public:
+    explicit ObjWeldTable(std::size_t expected)
+    {
+        std::size_t capacity = 64;
+        while(capacity < expected * 2) {
+            capacity *= 2;
+        }
+        slots.assign(capacity, empty);
+    }
+
+    // Id of vertex in vertices, appended if it isn't there yet.
+    GLuint insert(const ObjVertex& vertex, std::vector<ObjVertex>& vertices)
+    {
+        if((vertices.size() + 1) * 2 > slots.size()) {
+            grow(vertices);
+        }
+        const std::size_t mask = slots.size() - 1;
+        for(std::size_t slot = ObjVertexHash()(vertex) & mask;; slot = (slot + 1) & mask) {
+            const GLuint id = slots[slot];
+            if(id == empty) {
+                slots[slot] = GLuint(vertices.size());
+                vertices.push_back(vertex);
+                return slots[slot];
+            }
+            if(vertices[id] == vertex) {
+                return id;
+            }
+        }
+    }
+
+private:
+    static constexpr GLuint empty = 0xffffffffu;
+
+    void grow(const std::vector<ObjVertex>& vertices)
+    {
+        slots.assign(slots.size() * 2, empty);
+        const std::size_t mask = slots.size() - 1;
+        for(GLuint id = 0; id < GLuint(vertices.size()); id++) {
+            std::size_t slot = ObjVertexHash()(vertices[id]) & mask;
+            while(slots[slot] != empty) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = id;
+        }
+    }
+
+    std::vector<GLuint> slots;
+};
+
+// Vertex ids of the corners already seen, listed per position index, so
+// that a corner repeated by the faces around it is found without hashing
+// and comparing the whole vertex. Faces refer to nearby positions, which
+// keeps the lookups in cache where a hash of the indices would not.
+class ObjCornerTable
+{
+public:
+    static constexpr GLuint empty = 0xffffffffu;
+
+    explicit ObjCornerTable(std::size_t positionCount)
+        : heads(positionCount, empty)
+    {
+    }
+
+    // Id stored for index, or empty.
+    GLuint find(const std::int32_t* index) const
+    {
+        for(GLuint entry = heads[std::size_t(index[0])]; entry != empty; entry = entries[entry].next) {
+            if(entries[entry].texCoord == index[1] && entries[entry].normal == index[2]) {
+                return entries[entry].id;
+            }
+        }
+        return empty;
+    }
+
+    void add(const std::int32_t* index, GLuint id)
+    {
+        GLuint& head = heads[std::size_t(index[0])];
+        entries.push_back({ index[1], index[2], id, head });
+        head = GLuint(entries.size() - 1);
+    }
+
+private:
+    struct Entry
+    {
+        std::int32_t texCoord;
+        std::int32_t normal;
+        GLuint id;
+        GLuint next;
+    };
+
+    std::vector<GLuint> heads;
+    std::vector<Entry> entries;
+};
+
+// Resolves the corners of a chunk to vertices, welding equal ones. base
+// holds the attribute counts of the previous chunks, total those of the file.
+inline void weldObjChunk(ObjChunk& chunk, const std::vector<float>* attributes, const std::size_t* base, const std::size_t* total)
+{
+    ObjWeldTable table(chunk.corners.size() / 4);
+    ObjCornerTable seen(total[0]);
+    chunk.indices.reserve(chunk.corners.size());
+
+    for(const ObjCorner& corner : chunk.corners) {
+        std::int32_t index[3];
+        for(unsigned int a = 0; a < 3; a++) {
+            index[a] = corner.index[a];
+            if(index[a] == objAbsent) {
+                continue;
+            }
+            const std::int64_t resolved = std::int64_t(index[a]) + ((corner.relative >> a) & 1 ? std::int64_t(base[a]) : 0);
+            if(resolved < 0 || std::uint64_t(resolved) >= total[a]) {
+                chunk.error = "face index out of range";
+                return;
+            }
+            index[a] = std::int32_t(resolved);
+        }
+
+        GLuint id = seen.find(index);
+        if(id == ObjCornerTable::empty) {
+            ObjVertex vertex = {};
+            float* destinations[3] = { &vertex.position.x, &vertex.texCoord.x, &vertex.normal.x };
+            for(unsigned int a = 0; a < 3; a++) {
+                if(index[a] != objAbsent) {
+                    std::memcpy(destinations[a], &attributes[a][std::size_t(index[a]) * objComponents[a]], objComponents[a] * sizeof(float));
+                }
+            }
+            chunk.texCoords |= index[1] != objAbsent;
+            chunk.normals |= index[2] != objAbsent;
+            id = table.insert(vertex, chunk.vertices);
+            seen.add(index, id);
+        }
+        chunk.indices.push_back(id);
+    }
+    chunk.corners = std::vector<ObjCorner>();
+}
+
+// Runs work(i) for i in [0, count), one thread each, the last on the caller.
+template<typename Work>
+void objParallel(unsigned int count, Work work)
+{
+    std::vector<std::thread> threads;
+    for(unsigned int i = 0; i + 1 < count; i++) {
+        threads.emplace_back(work, i);
+    }
+    work(count - 1);
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+inline void loadObjMaterials(const std::string& path, ObjModel& model, std::unordered_map<std::string, GLuint>& names)
+{
+    std::ifstream file(path);
+    std::string line;
+    while(std::getline(file, line)) {
+        const char* text = line.c_str();
+        const char* end = text + line.size();
+        while(text < end && objSpace(*text)) {
+            text++;
+        }
+        if(objKeyword(text, end, "newmtl", 6)) {
+            ObjMaterial material;
+            material.name = objName(text + 6, end);
+            names[material.name] = GLuint(model.materials.size());
+            model.materials.push_back(material);
+        }
+        else if(objKeyword(text, end, "map_Kd", 6) && !model.materials.empty()) {
+            model.materials.back().texture = objName(text + 6, end);
+        }
+    }
+}
+
+} // namespace detail
+
+// Loads an OBJ file and the MTL files it refers to into model, replacing
+// its content. threadCount 0 uses every core. On failure error, if given,
+// tells why and where.
+inline bool loadObj(const char* path, ObjModel& model, std::string* error = nullptr, unsigned int threadCount = 0)
+{
+    using namespace detail;
+    model = ObjModel();
+    auto fail = [&](const std::string& message) {
+        if(error != nullptr) {
+            *error = std::string(path) + ": " + message;
+        }
+        return false;
+    };
+
+    const int fd = ::open(path, O_RDONLY);
+    if(fd < 0) {
+        return fail("can't open");
+    }
+    struct stat info;
+    if(fstat(fd, &info) != 0) {
+        ::close(fd);
+        return fail("can't read");
+    }
+    const std::size_t size = std::size_t(info.st_size);
+    void* mapping = size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    ::close(fd);
+    if(mapping == MAP_FAILED) {
+        return fail("can't map");
+    }
+    const char* text = static_cast<const char*>(mapping);
+
+    // chunks cut after a newline, small files in one piece
+    // hardware_concurrency() is 0 when it can't tell
+    if(threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t minimumChunk = 1 << 20;
+    std::size_t chunkCount = size / minimumChunk;
+    chunkCount = chunkCount < 1 ? 1 : (chunkCount > threadCount ? threadCount : chunkCount);
+    std::vector<ObjChunk> chunks(chunkCount);
+    const char* cut = text;
+    for(std::size_t i = 0; i < chunkCount; i++) {
+        const char* end = text + size * (i + 1) / chunkCount;
+        if(i + 1 == chunkCount) {
+            end = text + size;
+        }
+        else if(end > cut) {
+            const char* newline = static_cast<const char*>(std::memchr(end - 1, '\n', std::size_t(text + size - (end - 1))));
+            end = newline != nullptr ? newline + 1 : text + size;
+        }
+        end = end < cut ? cut : end;
+        chunks[i].begin = cut;
+        chunks[i].end = end;
+        cut = end;
+    }
+
+    objParallel(unsigned(chunkCount), [&](unsigned int i) { parseObjChunk(chunks[i]); });
+
+    std::size_t lines = 0;
+    for(const ObjChunk& chunk : chunks) {
+        if(!chunk.error.empty()) {
+            if(mapping != nullptr) {
+                munmap(mapping, size);
+            }
+            return fail("line " + std::to_string(lines + chunk.errorLine) + ": " + chunk.error);
+        }
+        lines += chunk.lines;
+    }
+
+    // attributes of the whole file, and where each chunk's start in them
+    std::vector<float> attributes[3];
+    std::vector<std::size_t> bases(chunkCount * 3);
+    std::size_t totals[3] = { 0, 0, 0 };
+    for(unsigned int a = 0; a < 3; a++) {
+        std::size_t floats = 0;
+        for(const ObjChunk& chunk : chunks) {
+            floats += chunk.attributes[a].size();
+        }
+        attributes[a].reserve(floats);
+        for(std::size_t i = 0; i < chunkCount; i++) {
+            bases[i * 3 + a] = attributes[a].size() / objComponents[a];
+            attributes[a].insert(attributes[a].end(), chunks[i].attributes[a].begin(), chunks[i].attributes[a].end());
+            chunks[i].attributes[a] = std::vector<float>();
+        }
+        totals[a] = attributes[a].size() / objComponents[a];
+    }
+    if(totals[0] > INT32_MAX || totals[1] > INT32_MAX || totals[2] > INT32_MAX) {
+        if(mapping != nullptr) {
+            munmap(mapping, size);
+        }
+        return fail("more than 2^31 attributes");
+    }
+    if(mapping != nullptr) {
+        munmap(mapping, size);
+    }
+
+    objParallel(unsigned(chunkCount), [&](unsigned int i) { weldObjChunk(chunks[i], attributes, &bases[i * 3], totals); });
+    for(const ObjChunk& chunk : chunks) {
+        if(!chunk.error.empty()) {
+            return fail(chunk.error);
+        }
+    }
+
+    // weld the vertices of all chunks, in file order so a single thread
+    // gives the same buffers
+    std::size_t vertexCount = 0, indexCount = 0;
+    for(const ObjChunk& chunk : chunks) {
+        vertexCount += chunk.vertices.size();
+        indexCount += chunk.indices.size();
+        model.hasTexCoords |= chunk.texCoords;
+        model.hasNormals |= chunk.normals;
+    }
+    if(chunkCount == 1) {
+        model.vertices.swap(chunks[0].vertices);
+        model.indices.swap(chunks[0].indices);
+    }
+    else {
+        ObjWeldTable table(vertexCount);
+        model.vertices.reserve(vertexCount);
+        for(ObjChunk& chunk : chunks) {
+            chunk.remap.resize(chunk.vertices.size());
+            for(std::size_t v = 0; v < chunk.vertices.size(); v++) {
+                chunk.remap[v] = table.insert(chunk.vertices[v], model.vertices);
+            }
+            chunk.vertices = std::vector<ObjVertex>();
+        }
+
+        model.indices.resize(indexCount);
+        std::vector<std::size_t> firstIndices(chunkCount, 0);
+        for(std::size_t i = 1; i < chunkCount; i++) {
+            firstIndices[i] = firstIndices[i - 1] + chunks[i - 1].indices.size();
+        }
+        objParallel(unsigned(chunkCount), [&](unsigned int i) {
+            const ObjChunk& chunk = chunks[i];
+            GLuint* out = model.indices.data() + firstIndices[i];
+            for(std::size_t j = 0; j < chunk.indices.size(); j++) {
+                out[j] = chunk.remap[chunk.indices[j]];
+            }
+        });
+    }
+
+    // materials, then meshes split at every group or material change
+    std::unordered_map<std::string, GLuint> materialNames;
+    std::string directory = path;
+    directory = directory.substr(0, directory.find_last_of('/') + 1);
+    for(const ObjChunk& chunk : chunks) {
+        for(const std::string& library : chunk.libraries) {
+            loadObjMaterials(directory + library, model, materialNames);
+        }
+    }
+
+    GLuint material = ObjModel::noMaterial;
+    std::string name;
+    auto startMesh = [&](std::size_t firstIndex) {
+        if(!model.meshes.empty()) {
+            model.meshes.back().indexCount = GLuint(firstIndex - model.meshes.back().firstIndex);
+            if(model.meshes.back().indexCount == 0) {
+                model.meshes.pop_back();
+            }
+        }
+        model.meshes.push_back({ name, GLuint(firstIndex), 0, material });
+    };
+    startMesh(0);
+    std::size_t chunkFirst = 0;
+    for(const ObjChunk& chunk : chunks) {
+        for(const ObjRun& run : chunk.runs) {
+            if(run.material) {
+                auto found = materialNames.find(run.name);
+                material = found != materialNames.end() ? found->second : ObjModel::noMaterial;
+            }
+            else {
+                name = run.name;
+            }
+            startMesh(chunkFirst + run.firstCorner);
+        }
+        chunkFirst += chunk.indices.size();
+    }
+    startMesh(indexCount);
+    model.meshes.pop_back();
+    return true;
+}
+
+} // namespace gl
@@ -0,0 +1,534 @@
+// Masked software occlusion culling
+//
+// Skips objects hidden behind others before they are drawn. A few large
+// occluders, e.g. the buildings close to the camera, are rasterized on the
+// CPU into a small depth buffer, then the bounding box of every object is
+// tested against it and only the visible ones are submitted.
+//
+// The depth buffer is hierarchical and masked: rather than a depth per
+// pixel it keeps two layers per subtile of 8x4 pixels. The reference layer
+// is the farthest depth of the whole subtile. The working layer collects
+// the triangles covering only part of it, as a 32 bit coverage mask and the
+// farthest depth of the pixels covered; once the mask is full, the working
+// layer replaces the reference layer if nearer. Rasterizing an occluder only
+// computes coverage masks and one conservative depth per subtile, 4 subtiles
+// at a time with the compiler's vector extensions (SSE on x86, NEON on ARM),
+// and the buffer is about 20 times smaller than a float depth buffer.
+//
+// A box is hidden when it's entirely behind the reference layer of every
+// subtile its screen rectangle touches. Coverage is sampled at pixel
+// centers, so objects seen through gaps thinner than a pixel of the culling
+// buffer can be hidden: keep the occluders a bit smaller than the geometry
+// they stand for, or the buffer large enough.
+//
+// Rows of tiles and boxes are split between worker threads.
+//
+// Header only, needs glm and no GL.
+//
+//     gl::OcclusionCuller culler(320, 180);
+//     culler.clear();
+//     culler.addOccluder(viewProjection * model, positions, indices, indexCount);
+//     culler.render();
+//     culler.testBoxes(viewProjection, boxes, boxCount, results);
+//     // draw the objects whose result is gl::CullResult::Visible
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace gl {
+
+enum class CullResult : std::uint8_t { Visible, Occluded, Outside };
+
+// World space bounding box.
+struct OcclusionBox
+{
+    glm::vec3 low;
+    glm::vec3 high;
+};
+
+class OcclusionCuller
+{
+public:
+    // The size is rounded up to whole tiles of 32x4 pixels. threadCount 0
+    // uses every core, the calling thread being one of them.
+    OcclusionCuller(int width = 320, int height = 180, unsigned int threadCount = 0)
+    {
+        tilesX = std::max(1, (width + 31) / 32);
+        tilesY = std::max(1, (height + 3) / 4);
+        bufferWidth = tilesX * 32;
+        bufferHeight = tilesY * 4;
+        tiles.resize(std::size_t(tilesX) * std::size_t(tilesY));
+        clear();
+
+        if(threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        for(unsigned int i = 1; i < threadCount; i++) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    OcclusionCuller(const OcclusionCuller&) = delete;
+    OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+    ~OcclusionCuller()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int width() const { return bufferWidth; }
+    int height() const { return bufferHeight; }
+
+    // Empties the depth buffer and the queued occluders.
+    void clear()
+    {
+        const Tile empty = { splat(1.0f), splat(0.0f), splat(std::int32_t(0)) };
+        std::fill(tiles.begin(), tiles.end(), empty);
+        triangles.clear();
+    }
+
+    // Queues the triangles of an occluder, positions transformed by clip,
+    // usually projection * view * model. Back faces, clockwise in normalized
+    // device coordinates, are skipped unless backFaces is set.
+    void addOccluder(const glm::mat4& clip, const glm::vec3* positions, const std::uint32_t* indices,
+                     std::size_t indexCount, bool backFaces = false)
+    {
+        for(std::size_t i = 0; i + 2 < indexCount; i += 3) {
+            const glm::vec4 corners[3] = {
+                clip * glm::vec4(positions[indices[i]], 1.0f),
+                clip * glm::vec4(positions[indices[i + 1]], 1.0f),
+                clip * glm::vec4(positions[indices[i + 2]], 1.0f)
+            };
+            submit(corners, backFaces);
+        }
+    }
+
+    // Same for an axis aligned box, its 12 triangles.
+    void addOccluder(const glm::mat4& viewProjection, const OcclusionBox& box)
+    {
+        static const std::uint32_t boxIndices[36] = {
+            0, 2, 1, 1, 2, 3,   // -z
+            4, 5, 6, 5, 7, 6,   // +z
+            0, 4, 2, 2, 4, 6,   // -x
+            1, 3, 5, 3, 7, 5,   // +x
+            0, 1, 4, 1, 5, 4,   // -y
+            2, 6, 3, 3, 6, 7    // +y
+        };
+        glm::vec3 corners[8];
+        for(int i = 0; i < 8; i++) {
+            corners[i] = glm::vec3(i & 1 ? box.high.x : box.low.x, i & 2 ? box.high.y : box.low.y, i & 4 ? box.high.z : box.low.z);
+        }
+        addOccluder(viewProjection, corners, boxIndices, 36);
+    }
+
+    // Rasterizes the queued occluders.
+    void render()
+    {
+        if(triangles.empty()) {
+            return;
+        }
+        run(&OcclusionCuller::renderRows);
+        triangles.clear();
+    }
+
+    CullResult testBox(const glm::mat4& viewProjection, const OcclusionBox& box) const
+    {
+        // the 8 corners as two groups of 4, z low and z high, each lane a
+        // corner: the first one plus the transformed edges
+        const glm::vec4 first = viewProjection * glm::vec4(box.low, 1.0f);
+        const glm::vec4 edgeX = viewProjection[0] * (box.high.x - box.low.x);
+        const glm::vec4 edgeY = viewProjection[1] * (box.high.y - box.low.y);
+        const glm::vec4 edgeZ = viewProjection[2] * (box.high.z - box.low.z);
+        const Float4 selectX = { 0.0f, 1.0f, 0.0f, 1.0f };
+        const Float4 selectY = { 0.0f, 0.0f, 1.0f, 1.0f };
+        Float4 low[4], high[4];
+        for(int c = 0; c < 4; c++) {
+            low[c] = splat(first[c]) + selectX * edgeX[c] + selectY * edgeY[c];
+            high[c] = low[c] + edgeZ[c];
+        }
+        const Float4 &xl = low[0], &yl = low[1], &zl = low[2], &wl = low[3];
+        const Float4 &xh = high[0], &yh = high[1], &zh = high[2], &wh = high[3];
+
+        // outside when every corner is outside the same plane
+        if(all((xl < -wl) & (xh < -wh)) || all((xl > wl) & (xh > wh)) || all((yl < -wl) & (yh < -wh))
+           || all((yl > wl) & (yh > wh)) || all((zl < -wl) & (zh < -wh)) || all((zl > wl) & (zh > wh))) {
+            return CullResult::Outside;
+        }
+        const Float4 zero = splat(0.0f);
+        if(any((zl < -wl) | (zh < -wh) | ~(wl > zero) | ~(wh > zero))) {
+            return CullResult::Visible;
+        }
+
+        // screen rectangle and nearest depth
+        const Float4 invWl = splat(1.0f) / wl;
+        const Float4 invWh = splat(1.0f) / wh;
+        const Float4 x0s = xl * invWl, x1s = xh * invWh;
+        const Float4 y0s = yl * invWl, y1s = yh * invWh;
+        const Float4 z0s = zl * invWl, z1s = zh * invWh;
+        float minX = horizontalMin(select(x0s < x1s, x0s, x1s));
+        float maxX = horizontalMax(select(x0s > x1s, x0s, x1s));
+        float minY = horizontalMin(select(y0s < y1s, y0s, y1s));
+        float maxY = horizontalMax(select(y0s > y1s, y0s, y1s));
+        const float nearest = horizontalMin(select(z0s < z1s, z0s, z1s)) * 0.5f + 0.5f;
+        minX = std::max(minX, -1.0f);
+        maxX = std::min(maxX, 1.0f);
+        minY = std::max(minY, -1.0f);
+        maxY = std::min(maxY, 1.0f);
+
+        // in subtiles
+        const int x0 = std::max(0, int((minX * 0.5f + 0.5f) * float(bufferWidth)) / 8);
+        const int x1 = std::min(bufferWidth / 8 - 1, int((maxX * 0.5f + 0.5f) * float(bufferWidth)) / 8);
+        const int y0 = std::max(0, int((0.5f - maxY * 0.5f) * float(bufferHeight)) / 4);
+        const int y1 = std::min(bufferHeight / 4 - 1, int((0.5f - minY * 0.5f) * float(bufferHeight)) / 4);
+        if(x0 > x1 || y0 > y1) {
+            return CullResult::Outside;
+        }
+
+        // a tile at a time, lanes outside the rectangle masked
+        const Float4 depth = splat(nearest);
+        const Int4 lanes = { 0, 1, 2, 3 };
+        for(int y = y0; y <= y1; y++) {
+            const Tile* row = tiles.data() + std::size_t(y) * std::size_t(tilesX);
+            for(int x = x0 / 4; x <= x1 / 4; x++) {
+                const Int4 subtile = splat(std::int32_t(x * 4)) + lanes;
+                if(any((depth <= row[x].z0) & (subtile >= x0) & (subtile <= x1))) {
+                    return CullResult::Visible;
+                }
+            }
+        }
+        return CullResult::Occluded;
+    }
+
+    // Tests count boxes on the worker threads, results has count entries.
+    void testBoxes(const glm::mat4& viewProjection, const OcclusionBox* boxes, std::size_t count, CullResult* results)
+    {
+        testTransform = viewProjection;
+        testInput = boxes;
+        testOutput = results;
+        testCount = count;
+        run(&OcclusionCuller::testRange);
+    }
+
+    // Reference layer depth at pixel x, y, row 0 at the top, for debugging.
+    float depth(int x, int y) const
+    {
+        return tiles[std::size_t(y / 4) * std::size_t(tilesX) + std::size_t(x / 32)].z0[(x % 32) / 8];
+    }
+
+private:
+    typedef float Float4 __attribute__((vector_size(16)));
+    typedef std::int32_t Int4 __attribute__((vector_size(16)));
+
+    // 4 subtiles of 8x4 pixels side by side; mask bit r * 8 + c is row r,
+    // column c
+    struct Tile
+    {
+        Float4 z0;      // reference layer
+        Float4 z1;      // working layer
+        Int4 mask;      // pixels covered by the working layer
+    };
+
+    struct Triangle
+    {
+        float a[3], b[3], c[3];   // edge functions, positive inside
+        float z, zx, zy;          // depth plane z + zx * x + zy * y
+        float zMax;
+        int minX, minY, maxX, maxY;
+    };
+
+    static Float4 splat(float value) { return Float4{ value, value, value, value }; }
+    static Int4 splat(std::int32_t value) { return Int4{ value, value, value, value }; }
+
+    static Float4 select(Int4 mask, Float4 a, Float4 b)
+    {
+        return (Float4)(((Int4)a & mask) | ((Int4)b & ~mask));
+    }
+
+    static Int4 select(Int4 mask, Int4 a, Int4 b) { return (a & mask) | (b & ~mask); }
+
+    static bool all(Int4 mask) { return (mask[0] & mask[1] & mask[2] & mask[3]) != 0; }
+    static bool any(Int4 mask) { return (mask[0] | mask[1] | mask[2] | mask[3]) != 0; }
+    static float horizontalMin(Float4 v) { return std::min(std::min(v[0], v[1]), std::min(v[2], v[3])); }
+    static float horizontalMax(Float4 v) { return std::max(std::max(v[0], v[1]), std::max(v[2], v[3])); }
+
+    void submit(const glm::vec4* corners, bool backFaces)
+    {
+        unsigned int outside[3] = { 0, 0, 0 };
+        for(int i = 0; i < 3; i++) {
+            const glm::vec4& p = corners[i];
+            outside[i] = (p.x < -p.w ? 1u : 0u) | (p.x > p.w ? 2u : 0u) | (p.y < -p.w ? 4u : 0u)
+                       | (p.y > p.w ? 8u : 0u) | (p.z < -p.w ? 16u : 0u) | (p.z > p.w ? 32u : 0u);
+        }
+        if((outside[0] & outside[1] & outside[2]) != 0) {
+            return;
+        }
+        if((outside[0] | outside[1] | outside[2]) == 0) {
+            setup(corners[0], corners[1], corners[2], backFaces);
+            return;
+        }
+
+        // Sutherland Hodgman against the planes crossed, large coordinates
+        // would cost the edge functions their precision
+        glm::vec4 polygons[2][9];
+        int count = 3;
+        std::copy(corners, corners + 3, polygons[0]);
+        int current = 0;
+        const unsigned int crossed = outside[0] | outside[1] | outside[2];
+        for(int plane = 0; plane < 6 && count > 0; plane++) {
+            if((crossed & (1u << plane)) == 0) {
+                continue;
+            }
+            const glm::vec4* in = polygons[current];
+            glm::vec4* out = polygons[current ^ 1];
+            int outCount = 0;
+            for(int i = 0; i < count; i++) {
+                const glm::vec4& from = in[i];
+                const glm::vec4& to = in[(i + 1) % count];
+                const float dFrom = planeDistance(from, plane);
+                const float dTo = planeDistance(to, plane);
+                if(dFrom >= 0.0f) {
+                    out[outCount++] = from;
+                }
+                if((dFrom >= 0.0f) != (dTo >= 0.0f)) {
+                    out[outCount++] = from + (to - from) * (dFrom / (dFrom - dTo));
+                }
+            }
+            count = outCount;
+            current ^= 1;
+        }
+        for(int i = 2; i < count; i++) {
+            setup(polygons[current][0], polygons[current][i - 1], polygons[current][i], backFaces);
+        }
+    }
+
+    static float planeDistance(const glm::vec4& p, int plane)
+    {
+        switch(plane) {
+        case 0: return p.w + p.x;
+        case 1: return p.w - p.x;
+        case 2: return p.w + p.y;
+        case 3: return p.w - p.y;
+        case 4: return p.w + p.z;
+        default: return p.w - p.z;
+        }
+    }
+
+    void setup(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2, bool backFaces)
+    {
+        const glm::vec4* corners[3] = { &v0, &v1, &v2 };
+        float x[3], y[3], z[3];
+        for(int i = 0; i < 3; i++) {
+            if(!(corners[i]->w > 0.0f)) {
+                return;
+            }
+            const float invW = 1.0f / corners[i]->w;
+            x[i] = (corners[i]->x * invW * 0.5f + 0.5f) * float(bufferWidth);
+            y[i] = (0.5f - corners[i]->y * invW * 0.5f) * float(bufferHeight);
+            z[i] = corners[i]->z * invW * 0.5f + 0.5f;
+        }
+
+        // y points down, counter clockwise triangles have a negative area
+        float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if(area == 0.0f || !(std::abs(area) < 1e30f) || (area > 0.0f && !backFaces)) {
+            return;
+        }
+        int order[3] = { 0, 1, 2 };
+        if(area < 0.0f) {
+            std::swap(order[1], order[2]);
+            area = -area;
+        }
+
+        Triangle triangle;
+        for(int e = 0; e < 3; e++) {
+            const int i = order[(e + 1) % 3];
+            const int j = order[(e + 2) % 3];
+            triangle.a[e] = y[i] - y[j];
+            triangle.b[e] = x[j] - x[i];
+            triangle.c[e] = -(triangle.a[e] * x[i] + triangle.b[e] * y[i]);
+        }
+        // depth plane through the three vertices
+        const float invArea = 1.0f / area;
+        const int i0 = order[0], i1 = order[1], i2 = order[2];
+        triangle.zx = ((z[i1] - z[i0]) * (y[i2] - y[i0]) - (z[i2] - z[i0]) * (y[i1] - y[i0])) * invArea;
+        triangle.zy = ((z[i2] - z[i0]) * (x[i1] - x[i0]) - (z[i1] - z[i0]) * (x[i2] - x[i0])) * invArea;
+        triangle.z = z[i0] - triangle.zx * x[i0] - triangle.zy * y[i0];
+        triangle.zMax = std::max({ z[0], z[1], z[2] });
+
+        triangle.minX = std::max(0, int(std::min({ x[0], x[1], x[2] })));
+        triangle.minY = std::max(0, int(std::min({ y[0], y[1], y[2] })));
+        triangle.maxX = std::min(bufferWidth, int(std::max({ x[0], x[1], x[2] })) + 1);
+        triangle.maxY = std::min(bufferHeight, int(std::max({ y[0], y[1], y[2] })) + 1);
+        if(triangle.minX < triangle.maxX && triangle.minY < triangle.maxY) {
+            triangles.push_back(triangle);
+        }
+    }
+
+    void rasterizeTile(const Triangle& t, Tile& tile, int tileX, int tileY) const
+    {
+        const Float4 subtileX = splat(float(tileX)) + Float4{ 0.0f, 8.0f, 16.0f, 24.0f };
+        const float top = float(tileY);
+
+        // farthest depth over each subtile: the plane at the far corner, no
+        // farther than the farthest vertex
+        const Float4 farX = t.zx > 0.0f ? subtileX + 8.0f : subtileX;
+        const float farY = t.zy > 0.0f ? top + 4.0f : top;
+        Float4 depth = splat(t.z + t.zy * farY) + splat(t.zx) * farX;
+        depth = select(depth < splat(t.zMax), depth, splat(t.zMax));
+
+        // coverage of the 32 pixel centers of each subtile
+        Int4 coverage = splat(std::int32_t(0));
+        const Float4 zero = splat(0.0f);
+        const Float4 centerX = subtileX + 0.5f;
+        for(int row = 0; row < 4; row++) {
+            const float py = top + float(row) + 0.5f;
+            Float4 e0 = splat(t.a[0]) * centerX + splat(t.b[0] * py + t.c[0]);
+            Float4 e1 = splat(t.a[1]) * centerX + splat(t.b[1] * py + t.c[1]);
+            Float4 e2 = splat(t.a[2]) * centerX + splat(t.b[2] * py + t.c[2]);
+            for(int column = 0; column < 8; column++) {
+                const Int4 inside = (e0 >= zero) & (e1 >= zero) & (e2 >= zero);
+                coverage |= inside & splat(std::int32_t(1u << (row * 8 + column)));
+                e0 += t.a[0];
+                e1 += t.a[1];
+                e2 += t.a[2];
+            }
+        }
+
+        // only where the triangle is in front of the reference layer
+        const Int4 useful = (coverage != 0) & (depth < tile.z0);
+        if((useful[0] | useful[1] | useful[2] | useful[3]) == 0) {
+            return;
+        }
+        const Int4 full = splat(std::int32_t(-1));
+
+        // covering the whole subtile the triangle alone is a reference layer,
+        // otherwise it's merged into the working layer
+        const Int4 covers = useful & (coverage == full);
+        Float4 z0 = select(covers, select(depth < tile.z0, depth, tile.z0), tile.z0);
+
+        const Int4 merges = useful & ~covers;
+        Int4 mask = select(merges, tile.mask | coverage, tile.mask);
+        Float4 z1 = select(merges, select(depth > tile.z1, depth, tile.z1), tile.z1);
+        const Int4 complete = merges & (mask == full);
+        z0 = select(complete, select(z1 < z0, z1, z0), z0);
+
+        // a working layer behind the reference layer is of no use
+        const Int4 reset = complete | (z1 >= z0);
+        tile.z0 = z0;
+        tile.z1 = select(reset, splat(0.0f), z1);
+        tile.mask = select(reset, splat(std::int32_t(0)), mask);
+    }
+
+    void renderRows()
+    {
+        for(;;) {
+            const std::size_t row = nextItem.fetch_add(1, std::memory_order_relaxed);
+            if(row >= std::size_t(tilesY)) {
+                break;
+            }
+            const int top = int(row) * 4;
+            Tile* tileRow = tiles.data() + row * std::size_t(tilesX);
+            for(const Triangle& triangle : triangles) {
+                if(triangle.minY >= top + 4 || triangle.maxY <= top) {
+                    continue;
+                }
+                for(int x = triangle.minX / 32; x <= (triangle.maxX - 1) / 32; x++) {
+                    rasterizeTile(triangle, tileRow[x], x * 32, top);
+                }
+            }
+        }
+    }
+
+    void testRange()
+    {
+        const std::size_t batch = 1024;
+        for(;;) {
+            const std::size_t first = nextItem.fetch_add(batch, std::memory_order_relaxed);
+            if(first >= testCount) {
+                break;
+            }
+            const std::size_t last = std::min(testCount, first + batch);
+            for(std::size_t i = first; i < last; i++) {
+                testOutput[i] = testBox(testTransform, testInput[i]);
+            }
+        }
+    }
+
+    // Runs task on every thread, returns when they're all done.
+    void run(void (OcclusionCuller::*job)())
+    {
+        task = job;
+        nextItem.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busy = unsigned(workers.size());
+            generation++;
+        }
+        wake.notify_all();
+        (this->*task)();
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]() { return busy == 0; });
+    }
+
+    void workerLoop()
+    {
+        unsigned int seen = 0;
+        for(;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]() { return quit || generation != seen; });
+                if(quit) {
+                    return;
+                }
+                seen = generation;
+            }
+            (this->*task)();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                busy--;
+            }
+            done.notify_one();
+        }
+    }
+
+    int tilesX = 0;
+    int tilesY = 0;
+    int bufferWidth = 0;
+    int bufferHeight = 0;
+    std::vector<Tile> tiles;
+    std::vector<Triangle> triangles;
+
+    glm::mat4 testTransform = glm::mat4(1.0f);
+    const OcclusionBox* testInput = nullptr;
+    CullResult* testOutput = nullptr;
+    std::size_t testCount = 0;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    void (OcclusionCuller::*task)() = nullptr;
+    unsigned int generation = 0;
+    unsigned int busy = 0;
+    bool quit = false;
+    std::atomic<std::size_t> nextItem{ 0 };
+};
+
+} // namespace gl
@@ -0,0 +1,332 @@
+// CPU/GPU profiler
+//
+// Nested named scopes timed on the CPU with steady_clock and on the GPU with
+// GL_TIMESTAMP queries (GL 3.3 core). GL_TIME_ELAPSED queries can't be
+// nested, so each scope records a timestamp when it begins and one when it
+// ends.
+//
+// Queries are kept in a ring of frameLatency frames. The results of a frame
+// are read back when its slot comes around again, frameLatency - 1 frames
+// later. If the GPU hasn't finished it by then, the frame is dropped rather
+// than waiting, see droppedFrames().
+//
+// Results go to a Chrome trace-event JSON file (chrome://tracing or
+// https://ui.perfetto.dev) with one track for the CPU and one for the GPU,
+// or are averaged per scope name by summary(). Only the last keptFrames
+// frames are kept, older ones are forgotten as new ones come in, so a long
+// session holds at most 2 * maxScopesPerFrame events per kept frame.
+//
+// Scope names are copied the first time they are seen, they don't have to
+// outlive the scope.
+//
+// Header only, include it after glad. The queries belong to the context and
+// are released with it, the profiler doesn't call GL when it is destroyed.
+//
+//     gl::Profiler profiler;
+//     while(...) {
+//         profiler.beginFrame();
+//         {
+//             gl::Profiler::Scope scope(profiler, "draw cubes");
+//             ...
+//         }
+//         profiler.endFrame();
+//     }
+//     profiler.writeChromeTrace("trace.json");
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gl {
+
+class Profiler
+{
+public:
+    static constexpr unsigned int frameLatency = 3;
+    static constexpr unsigned int maxScopesPerFrame = 64;
+
+    class Scope
+    {
+    public:
+        Scope(Profiler& profiler, const char* name) : profiler(profiler) { profiler.begin(name); }
+        ~Scope() { profiler.end(); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Profiler& profiler;
+    };
+
+    // Averages of the kept events of one scope name, in milliseconds.
+    struct Summary
+    {
+        std::string name;
+        unsigned long count;
+        double cpu;
+        double gpu;
+    };
+
+    explicit Profiler(std::uint64_t keptFrames = 600) : keptFrames(keptFrames)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void beginFrame()
+    {
+        Frame& frame = frames[frameIndex % frameLatency];
+        if(!frame.queriesCreated) {
+            glGenQueries(2 * maxScopesPerFrame, frame.queries);
+            frame.queriesCreated = true;
+        }
+        collect(frame);
+
+        frame.scopes.clear();
+        frame.number = frameIndex;
+        depth = 0;
+
+        // GPU and CPU clocks are unrelated, the offset between them is
+        // measured again every frame so GPU scopes land next to the CPU
+        // scopes that issued them
+        GLint64 gpuNow = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        frame.gpuOffset = cpuNow() - gpuNow;
+    }
+
+    void endFrame()
+    {
+        frameIndex++;
+    }
+
+    void begin(const char* name)
+    {
+        Frame& frame = frames[frameIndex % frameLatency];
+        if(frame.scopes.size() == maxScopesPerFrame || depth == maxScopesPerFrame) {
+            if(depth < maxScopesPerFrame) {
+                open[depth] = -1;
+            }
+            overflow++;
+            depth++;
+            return;
+        }
+        unsigned int index = unsigned(frame.scopes.size());
+        glQueryCounter(frame.queries[2 * index], GL_TIMESTAMP);
+        frame.lastQuery = frame.queries[2 * index];
+        frame.scopes.push_back({ intern(name), cpuNow(), 0, false });
+        open[depth] = int(index);
+        depth++;
+    }
+
+    void end()
+    {
+        depth--;
+        int index = depth < maxScopesPerFrame ? open[depth] : -1;
+        if(index < 0) {
+            return;
+        }
+        Frame& frame = frames[frameIndex % frameLatency];
+        glQueryCounter(frame.queries[2 * index + 1], GL_TIMESTAMP);
+        frame.lastQuery = frame.queries[2 * index + 1];
+        frame.scopes[index].cpuEnd = cpuNow();
+        frame.scopes[index].ended = true;
+    }
+
+    // Reads back every frame still in flight, waiting for the GPU. Meant to be
+    // called once before writing the trace.
+    void flush()
+    {
+        glFinish();
+        for(unsigned int i = 0; i < frameLatency; i++) {
+            collect(frames[(frameIndex + i) % frameLatency]);
+        }
+    }
+
+    bool writeChromeTrace(const char* path)
+    {
+        flush();
+
+        FILE* file = std::fopen(path, "w");
+        if(file == nullptr) {
+            return false;
+        }
+
+        std::fprintf(file, "{\"traceEvents\":[\n");
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n");
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}");
+        for(const Event& event : events) {
+            std::fprintf(file, ",\n{\"name\":");
+            writeJsonString(file, names[event.name].c_str());
+            std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%llu}}",
+                         event.gpu ? 2 : 1, double(event.begin) / 1000.0,
+                         double(event.end - event.begin) / 1000.0, (unsigned long long)event.frame);
+        }
+        std::fprintf(file, "\n]}\n");
+
+        return std::fclose(file) == 0;
+    }
+
+    // Frames whose GPU results were not ready when their queries had to be reused.
+    unsigned long droppedFrames() const { return dropped; }
+
+    // Scopes beyond maxScopesPerFrame, not recorded.
+    unsigned long overflowScopes() const { return overflow; }
+
+    // Forgets the recorded events, e.g. to skip warm up frames.
+    void clear() { events.clear(); }
+
+    // One entry per scope name of the kept events, in the order the names
+    // were first seen. Reads back the frames in flight first.
+    std::vector<Summary> summary()
+    {
+        flush();
+
+        std::vector<Summary> result(names.size());
+        for(std::size_t i = 0; i < names.size(); i++) {
+            result[i] = { names[i], 0, 0.0, 0.0 };
+        }
+        for(const Event& event : events) {
+            Summary& entry = result[event.name];
+            const double duration = double(event.end - event.begin) / 1e6;
+            if(event.gpu) {
+                entry.gpu += duration;
+            }
+            else {
+                entry.count++;
+                entry.cpu += duration;
+            }
+        }
+        for(Summary& entry : result) {
+            if(entry.count != 0) {
+                entry.cpu /= double(entry.count);
+                entry.gpu /= double(entry.count);
+            }
+        }
+        return result;
+    }
+
+private:
+    // Scope names are any string, quotes, backslashes and control characters
+    // are escaped.
+    static void writeJsonString(FILE* file, const char* text)
+    {
+        std::fputc('"', file);
+        for(const char* c = text; *c != '\0'; c++) {
+            if(*c == '"' || *c == '\\') {
+                std::fputc('\\', file);
+                std::fputc(*c, file);
+            }
+            else if((unsigned char)*c < 0x20) {
+                std::fprintf(file, "\\u%04x", (unsigned int)(unsigned char)*c);
+            }
+            else {
+                std::fputc(*c, file);
+            }
+        }
+        std::fputc('"', file);
+    }
+
+    struct Record
+    {
+        unsigned int name;
+        std::int64_t cpuBegin;
+        std::int64_t cpuEnd;
+        bool ended;
+    };
+
+    struct Frame
+    {
+        GLuint queries[2 * maxScopesPerFrame];
+        bool queriesCreated = false;
+        std::vector<Record> scopes;
+        GLuint lastQuery = 0;
+        std::uint64_t number = 0;
+        std::int64_t gpuOffset = 0;
+    };
+
+    struct Event
+    {
+        unsigned int name;
+        bool gpu;
+        std::int64_t begin;
+        std::int64_t end;
+        std::uint64_t frame;
+    };
+
+    // Nanoseconds since the profiler was created.
+    std::int64_t cpuNow() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // The index of name in names, copying it the first time.
+    unsigned int intern(const char* name)
+    {
+        const auto found = nameIds.find(name);
+        if(found != nameIds.end()) {
+            return found->second;
+        }
+        names.push_back(name);
+        nameIds.emplace(names.back(), unsigned(names.size() - 1));
+        return unsigned(names.size() - 1);
+    }
+
+    // Moves the scopes of a finished frame to the event list, dropping the
+    // events of the frames older than keptFrames.
+    void collect(Frame& frame)
+    {
+        if(frame.scopes.empty()) {
+            return;
+        }
+
+        // queries complete in order, the last one issued tells for the whole frame
+        GLuint available = 0;
+        glGetQueryObjectuiv(frame.lastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if(!available) {
+            dropped++;
+            frame.scopes.clear();
+            return;
+        }
+
+        for(unsigned int i = 0; i < frame.scopes.size(); i++) {
+            const Record& scope = frame.scopes[i];
+            if(!scope.ended) {
+                continue;
+            }
+            GLuint64 gpuBegin = 0, gpuEnd = 0;
+            glGetQueryObjectui64v(frame.queries[2 * i], GL_QUERY_RESULT, &gpuBegin);
+            glGetQueryObjectui64v(frame.queries[2 * i + 1], GL_QUERY_RESULT, &gpuEnd);
+
+            events.push_back({ scope.name, false, scope.cpuBegin, scope.cpuEnd, frame.number });
+            events.push_back({ scope.name, true, std::int64_t(gpuBegin) + frame.gpuOffset,
+                               std::int64_t(gpuEnd) + frame.gpuOffset, frame.number });
+        }
+        frame.scopes.clear();
+
+        while(!events.empty() && events.front().frame + keptFrames <= frame.number) {
+            events.pop_front();
+        }
+    }
+
+    Frame frames[frameLatency];
+    std::uint64_t frameIndex = 0;
+    unsigned int depth = 0;
+    int open[maxScopesPerFrame] = {};
+    std::chrono::steady_clock::time_point start;
+    std::uint64_t keptFrames;
+    std::deque<Event> events;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, unsigned int> nameIds;
+    unsigned long dropped = 0;
+    unsigned long overflow = 0;
+};
+
+} // namespace gl
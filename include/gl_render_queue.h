@@ -0,0 +1,282 @@
+// Render queue
+//
+// Draws are submitted as a 64 bit sort key plus a payload, radix sorted once
+// per frame, then executed in key order applying only the state that differs
+// from the previous draw. The key, from the most significant bits:
+//
+//     layer 4 | program 10 | material 14 | vertex array 12 | depth 24
+//
+// so draws are grouped by layer, then by program, material (a set of
+// textures) and vertex array, and sorted by depth inside a group. Programs,
+// materials and vertex arrays are registered once and referred to by the
+// small ids returned by the register functions, at most 2^10 programs,
+// 2^14 materials and 2^12 vertex arrays.
+//
+// Header only, include it after glad and gl_state_cache.h.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gl {
+
+namespace detail {
+
+// LSD radix sort of items on their 64 bit key member, 11 bit digits,
+// stable. All six histograms are built in one pass over the keys, then
+// passes where every key has the same digit are skipped, which is most of
+// them when few states are in use.
+template<typename Item>
+void radixSortByKey(std::vector<Item>& items, std::vector<Item>& scratch)
+{
+    constexpr unsigned int radixBits = 11;
+    constexpr unsigned int radixSize = 1u << radixBits;
+    constexpr unsigned int radixPasses = (64 + radixBits - 1) / radixBits;
+
+    const std::size_t count = items.size();
+    scratch.resize(count);
+
+    std::uint32_t histograms[radixPasses][radixSize];
+    std::memset(histograms, 0, sizeof(histograms));
+    for(const Item& item : items) {
+        for(unsigned int pass = 0; pass < radixPasses; pass++) {
+            histograms[pass][(item.key >> (radixBits * pass)) & (radixSize - 1)]++;
+        }
+    }
+
+    Item* source = items.data();
+    Item* destination = scratch.data();
+    for(unsigned int pass = 0; pass < radixPasses; pass++) {
+        std::uint32_t* histogram = histograms[pass];
+        if(count == 0 || histogram[(source[0].key >> (radixBits * pass)) & (radixSize - 1)] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for(unsigned int digit = 0; digit < radixSize; digit++) {
+            std::uint32_t n = histogram[digit];
+            histogram[digit] = offset;
+            offset += n;
+        }
+        for(std::size_t i = 0; i < count; i++) {
+            destination[histogram[(source[i].key >> (radixBits * pass)) & (radixSize - 1)]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+    if(source != items.data()) {
+        items.swap(scratch);
+    }
+}
+
+} // namespace detail
+
+class RenderQueue
+{
+public:
+    static constexpr unsigned int layerBits = 4;
+    static constexpr unsigned int programBits = 10;
+    static constexpr unsigned int materialBits = 14;
+    static constexpr unsigned int vertexArrayBits = 12;
+    static constexpr unsigned int depthBits = 24;
+    static constexpr unsigned int maxTextures = 4;
+
+    // Returned by the register functions once their ids no longer fit the key.
+    static constexpr unsigned int none = ~0u;
+
+    struct Draw
+    {
+        GLenum mode;
+        GLint first;
+        GLsizei count;
+        // column major 4x4 matrix uploaded to the model uniform of the
+        // program, must stay valid until execute()
+        const GLfloat* model;
+    };
+
+    // modelLocation is the location of the mat4 model uniform, -1 if none.
+    unsigned int registerProgram(Program program, GLint modelLocation)
+    {
+        assert(programs.size() <= mask(programBits));
+        if(programs.size() > mask(programBits)) {
+            return none;
+        }
+        programs.push_back({ program, modelLocation });
+        return unsigned(programs.size() - 1);
+    }
+
+    // Points a registered id at a rebuilt program, keys already made with
+    // it stay valid.
+    void replaceProgram(unsigned int id, Program program, GLint modelLocation)
+    {
+        assert(id < programs.size());
+        programs[id] = { program, modelLocation };
+    }
+
+    // Textures bound to units 0 to count - 1.
+    unsigned int registerMaterial(const Texture* textures, unsigned int count, GLenum target = GL_TEXTURE_2D)
+    {
+        assert(materials.size() <= mask(materialBits));
+        if(materials.size() > mask(materialBits)) {
+            return none;
+        }
+        Material material = {};
+        material.count = count < maxTextures ? count : maxTextures;
+        material.target = target;
+        for(unsigned int i = 0; i < material.count; i++) {
+            material.textures[i] = textures[i];
+        }
+        materials.push_back(material);
+        return unsigned(materials.size() - 1);
+    }
+
+    unsigned int registerVertexArray(VertexArray vertexArray)
+    {
+        assert(vertexArrays.size() <= mask(vertexArrayBits));
+        if(vertexArrays.size() > mask(vertexArrayBits)) {
+            return none;
+        }
+        vertexArrays.push_back(vertexArray);
+        return unsigned(vertexArrays.size() - 1);
+    }
+
+    // Maps a view space distance in [0, farPlane] to the depth field of the
+    // key, front to back, or back to front for blended layers.
+    static std::uint32_t depthKey(float distance, float farPlane, bool backToFront = false)
+    {
+        const std::uint32_t maxDepth = (1u << depthBits) - 1;
+        float normalized = distance / farPlane;
+        normalized = normalized < 0.0f ? 0.0f : (normalized > 1.0f ? 1.0f : normalized);
+        std::uint32_t depth = std::uint32_t(normalized * float(maxDepth));
+        return backToFront ? maxDepth - depth : depth;
+    }
+
+    static std::uint64_t makeKey(unsigned int layer, unsigned int program, unsigned int material,
+                                 unsigned int vertexArray, std::uint32_t depth)
+    {
+        assert(layer <= mask(layerBits) && program <= mask(programBits) && material <= mask(materialBits)
+               && vertexArray <= mask(vertexArrayBits));
+        return (std::uint64_t(layer & mask(layerBits)) << (programBits + materialBits + vertexArrayBits + depthBits))
+             | (std::uint64_t(program & mask(programBits)) << (materialBits + vertexArrayBits + depthBits))
+             | (std::uint64_t(material & mask(materialBits)) << (vertexArrayBits + depthBits))
+             | (std::uint64_t(vertexArray & mask(vertexArrayBits)) << depthBits)
+             | std::uint64_t(depth & mask(depthBits));
+    }
+
+    void submit(std::uint64_t key, const Draw& draw)
+    {
+        items.push_back({ key, std::uint32_t(draws.size()) });
+        draws.push_back(draw);
+    }
+
+    void submit(unsigned int layer, unsigned int program, unsigned int material,
+                unsigned int vertexArray, std::uint32_t depth, const Draw& draw)
+    {
+        submit(makeKey(layer, program, material, vertexArray, depth), draw);
+    }
+
+    // Sorts the draws by key, stable.
+    void sort()
+    {
+        detail::radixSortByKey(items, scratch);
+    }
+
+    // Issues the sorted draws. Returns the number of state changes applied.
+    unsigned int execute(StateCache& state)
+    {
+        const unsigned int programShift = materialBits + vertexArrayBits + depthBits;
+        const unsigned int materialShift = vertexArrayBits + depthBits;
+        const unsigned int vertexArrayShift = depthBits;
+
+        unsigned int changes = 0;
+        bool first = true;
+        std::uint64_t previous = 0;
+        const ProgramEntry* program = nullptr;
+
+        for(const Item& item : items) {
+            const unsigned int programId = field(item.key, programShift, programBits);
+            if(first || programId != field(previous, programShift, programBits)) {
+                program = &programs[programId];
+                state.useProgram(program->program);
+                changes++;
+            }
+            const unsigned int materialId = field(item.key, materialShift, materialBits);
+            if(first || materialId != field(previous, materialShift, materialBits)) {
+                const Material& material = materials[materialId];
+                for(unsigned int unit = 0; unit < material.count; unit++) {
+                    state.bindTexture(unit, material.target, material.textures[unit]);
+                }
+                changes++;
+            }
+            const unsigned int vertexArrayId = field(item.key, vertexArrayShift, vertexArrayBits);
+            if(first || vertexArrayId != field(previous, vertexArrayShift, vertexArrayBits)) {
+                state.bindVertexArray(vertexArrays[vertexArrayId]);
+                changes++;
+            }
+            first = false;
+            previous = item.key;
+
+            const Draw& draw = draws[item.draw];
+            if(program->modelLocation >= 0 && draw.model != nullptr) {
+                glUniformMatrix4fv(program->modelLocation, 1, GL_FALSE, draw.model);
+            }
+            glDrawArrays(draw.mode, draw.first, draw.count);
+        }
+        return changes;
+    }
+
+    // Empties the queue for the next frame, registrations are kept.
+    void clear()
+    {
+        items.clear();
+        draws.clear();
+    }
+
+    std::size_t size() const { return items.size(); }
+
+    // Sorted keys, for tests and tools.
+    std::uint64_t key(std::size_t i) const { return items[i].key; }
+
+private:
+    struct Item
+    {
+        std::uint64_t key;
+        std::uint32_t draw;
+    };
+
+    struct ProgramEntry
+    {
+        Program program;
+        GLint modelLocation;
+    };
+
+    struct Material
+    {
+        Texture textures[maxTextures];
+        unsigned int count;
+        GLenum target;
+    };
+
+    static constexpr std::uint64_t mask(unsigned int bits)
+    {
+        return (std::uint64_t(1) << bits) - 1;
+    }
+
+    static unsigned int field(std::uint64_t key, unsigned int shift, unsigned int bits)
+    {
+        return unsigned((key >> shift) & mask(bits));
+    }
+
+    std::vector<ProgramEntry> programs;
+    std::vector<Material> materials;
+    std::vector<VertexArray> vertexArrays;
+
+    std::vector<Item> items;
+    std::vector<Item> scratch;
+    std::vector<Draw> draws;
+};
+
+} // namespace gl
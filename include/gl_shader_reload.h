@@ -0,0 +1,699 @@
+// Shader hot reload
+//
+// Programs built from .glsl files and rebuilt while the program runs when
+// one of their files changes. A FileWatcher notices the changes: inotify on
+// Linux and kqueue on macOS, or a stat() of the files every quarter second
+// elsewhere and in the directories the system refuses to watch (out of
+// inotify watches, no permission), which error() reports. Files are compared
+// by inode, size and modification time, so editors saving to a temporary
+// file then renaming it are seen too.
+//
+// A rebuild is spread over frames by update(): the files are read on
+// another thread, then the shaders are compiled and the program linked, one
+// GL call per step. update() takes a time budget in milliseconds and starts
+// no step once it is spent, so a frame pays at most the budget plus one
+// step. With GL_KHR_parallel_shader_compile the driver compiles on its own
+// threads and the steps only ask whether it is done.
+//
+// The new program replaces the old one only once it links. It takes the old
+// one's uniform values and uniform block bindings, then the swap callback
+// gets both programs to look up the uniform locations it keeps. A failed
+// rebuild keeps the old program and its log. Programs are left to the
+// context at exit, like the other GL objects: the destructor calls no GL.
+//
+// Header only, include it after glad and gl_state_cache.h.
+//
+//     gl::ShaderReloader shaders(glState);
+//     const unsigned int cube = shaders.add("shader_vertex.glsl", "shader_fragment.glsl");
+//     shaders.onSwap([&](unsigned int id, gl::Program, gl::Program program) {
+//         renderQueue.replaceProgram(cubeProgram, program, glGetUniformLocation(program.id, "model"));
+//     });
+//     while(...) {
+//         shaders.update(1.0);
+//         ...
+//     }
+
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/event.h>
+#include <unistd.h>
+#endif
+
+// from GL_KHR_parallel_shader_compile, which glad was generated without
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace gl {
+
+class FileWatcher
+{
+public:
+    FileWatcher()
+    {
+#if defined(__linux__)
+        queue = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if(queue < 0) {
+            failure = std::string("inotify_init1: ") + std::strerror(errno);
+        }
+#elif defined(__APPLE__)
+        queue = kqueue();
+        if(queue < 0) {
+            failure = std::string("kqueue: ") + std::strerror(errno);
+        }
+#endif
+    }
+
+    ~FileWatcher()
+    {
+#if defined(__APPLE__)
+        for(const File& file : files) {
+            if(file.handle >= 0) {
+                close(file.handle);
+            }
+        }
+        for(const Directory& directory : directories) {
+            if(directory.handle >= 0) {
+                close(directory.handle);
+            }
+        }
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+        if(queue >= 0) {
+            close(queue);
+        }
+#endif
+    }
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Watches a file, which may not exist yet, in a directory that must.
+    // Returns its id, files being numbered from 0 in the order watched.
+    unsigned int watch(const std::string& path)
+    {
+        const std::size_t slash = path.find_last_of('/');
+        File file;
+        file.path = path;
+        file.directory = findOrAddDirectory(slash == std::string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash));
+        file.stamp = stampOf(path);
+        files.push_back(file);
+#if defined(__APPLE__)
+        watchFile(files.back());
+#endif
+        return unsigned(files.size() - 1);
+    }
+
+    // Appends the ids of the files changed since the last call, without
+    // blocking.
+    void poll(std::vector<unsigned int>& changed)
+    {
+        // directories without a watch, all of them without a queue, are
+        // scanned every quarter second
+        const auto now = std::chrono::steady_clock::now();
+        const bool scan = now - lastScan >= std::chrono::milliseconds(250);
+        if(scan) {
+            lastScan = now;
+        }
+        std::vector<bool> touched(directories.size());
+        for(std::size_t i = 0; i < directories.size(); i++) {
+            touched[i] = scan && directories[i].handle < 0;
+        }
+#if defined(__linux__)
+        // a read returns whole events, aligned as the struct
+        alignas(inotify_event) char buffer[4096];
+        ssize_t size;
+        while(queue >= 0 && (size = read(queue, buffer, sizeof(buffer))) > 0) {
+            for(ssize_t offset = 0; offset < size;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                for(std::size_t i = 0; i < directories.size(); i++) {
+                    if(directories[i].handle == event->wd) {
+                        touched[i] = true;
+                    }
+                }
+                offset += ssize_t(sizeof(inotify_event) + event->len);
+            }
+        }
+#elif defined(__APPLE__)
+        // a file written in place changes and its directory doesn't, both
+        // are watched, the events carrying the directory's index
+        struct kevent events[16];
+        const timespec immediately = { 0, 0 };
+        int count;
+        while(queue >= 0 && (count = kevent(queue, nullptr, 0, events, 16, &immediately)) > 0) {
+            for(int i = 0; i < count; i++) {
+                touched[std::size_t(events[i].udata)] = true;
+            }
+        }
+#endif
+        for(std::size_t i = 0; i < files.size(); i++) {
+            File& file = files[i];
+            if(!touched[file.directory]) {
+                continue;
+            }
+            const Stamp stamp = stampOf(file.path);
+            if(stamp != file.stamp) {
+                file.stamp = stamp;
+                changed.push_back(unsigned(i));
+#if defined(__APPLE__)
+                watchFile(file);
+#endif
+            }
+        }
+    }
+
+    const std::string& path(unsigned int id) const { return files[id].path; }
+
+    // Whether the changes of every directory are reported by the system
+    // rather than found by polling.
+    bool notified() const
+    {
+        for(const Directory& directory : directories) {
+            if(directory.handle < 0) {
+                return false;
+            }
+        }
+        return queue >= 0;
+    }
+
+    // Why the last directory that couldn't be watched is polled instead,
+    // empty if the system watches them all.
+    const std::string& error() const { return failure; }
+
+private:
+    struct Stamp
+    {
+        std::uint64_t inode = 0;
+        std::int64_t size = -1;
+        std::int64_t seconds = 0;
+        std::int64_t nanoseconds = 0;
+
+        bool operator!=(const Stamp& other) const
+        {
+            return inode != other.inode || size != other.size || seconds != other.seconds
+                || nanoseconds != other.nanoseconds;
+        }
+    };
+
+    struct File
+    {
+        std::string path;
+        std::size_t directory = 0;
+        Stamp stamp;
+        int handle = -1;
+    };
+
+    struct Directory
+    {
+        std::string path;
+        int handle = -1;
+    };
+
+    static Stamp stampOf(const std::string& path)
+    {
+        Stamp stamp;
+        struct stat status;
+        if(stat(path.c_str(), &status) != 0) {
+            return stamp;
+        }
+        stamp.inode = std::uint64_t(status.st_ino);
+        stamp.size = std::int64_t(status.st_size);
+#if defined(__APPLE__)
+        stamp.seconds = std::int64_t(status.st_mtimespec.tv_sec);
+        stamp.nanoseconds = std::int64_t(status.st_mtimespec.tv_nsec);
+#elif defined(__linux__)
+        stamp.seconds = std::int64_t(status.st_mtim.tv_sec);
+        stamp.nanoseconds = std::int64_t(status.st_mtim.tv_nsec);
+#else
+        stamp.seconds = std::int64_t(status.st_mtime);
+#endif
+        return stamp;
+    }
+
+    std::size_t findOrAddDirectory(const std::string& path)
+    {
+        for(std::size_t i = 0; i < directories.size(); i++) {
+            if(directories[i].path == path) {
+                return i;
+            }
+        }
+        Directory directory;
+        directory.path = path;
+#if defined(__linux__)
+        if(queue >= 0) {
+            directory.handle = inotify_add_watch(queue, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+            if(directory.handle < 0) {
+                failure = "inotify_add_watch " + path + ": " + std::strerror(errno) + ", polled instead";
+            }
+        }
+#elif defined(__APPLE__)
+        directory.handle = watchPath(path, NOTE_WRITE, directories.size());
+        if(queue >= 0 && directory.handle < 0) {
+            failure = "open " + path + ": " + std::strerror(errno) + ", polled instead";
+        }
+#endif
+        directories.push_back(directory);
+        return directories.size() - 1;
+    }
+
+#if defined(__APPLE__)
+    int watchPath(const std::string& path, unsigned int flags, std::size_t directory)
+    {
+        if(queue < 0) {
+            return -1;
+        }
+        const int handle = open(path.c_str(), O_EVTONLY);
+        if(handle >= 0) {
+            struct kevent event;
+            EV_SET(&event, handle, EVFILT_VNODE, EV_ADD | EV_CLEAR, flags, 0, reinterpret_cast<void*>(directory));
+            kevent(queue, &event, 1, nullptr, 0, nullptr);
+        }
+        return handle;
+    }
+
+    // kqueue follows the open file, not the path: a file replaced by a
+    // rename is opened again. Closing a descriptor removes its events.
+    void watchFile(File& file)
+    {
+        if(file.handle >= 0) {
+            close(file.handle);
+        }
+        file.handle = watchPath(file.path, NOTE_WRITE | NOTE_EXTEND | NOTE_ATTRIB | NOTE_DELETE | NOTE_RENAME,
+                                file.directory);
+    }
+#endif
+
+    int queue = -1;
+    std::vector<File> files;
+    std::vector<Directory> directories;
+    std::chrono::steady_clock::time_point lastScan;
+    std::string failure;
+};
+
+class ShaderReloader
+{
+public:
+    // Gets the id, the old program, deleted right after, and the new one.
+    // The old program is 0 if the files never built before.
+    using SwapCallback = std::function<void(unsigned int, Program, Program)>;
+
+    explicit ShaderReloader(StateCache& state) : state(state)
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for(GLint i = 0; i < count; i++) {
+            const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, GLuint(i)));
+            if(std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0
+               || std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0) {
+                parallel = true;
+            }
+        }
+    }
+
+    ShaderReloader(const ShaderReloader&) = delete;
+    ShaderReloader& operator=(const ShaderReloader&) = delete;
+
+    // Builds a program from the two files, waiting for it, and rebuilds it
+    // when they change. Returns its id, program() is 0 if the build failed.
+    unsigned int add(const std::string& vertexPath, const std::string& fragmentPath)
+    {
+        const unsigned int id = unsigned(entries.size());
+        entries.emplace_back(new Entry);
+        Entry& entry = *entries.back();
+        entry.paths[0] = vertexPath;
+        entry.paths[1] = fragmentPath;
+        entry.files[0] = watcher.watch(vertexPath);
+        entry.files[1] = watcher.watch(fragmentPath);
+        start(entry);
+        while(step(entry, true)) {
+        }
+        if(entry.stage == Stage::Swap) {
+            swap(id, entry);
+        }
+        return id;
+    }
+
+    void onSwap(SwapCallback callback) { swapCallback = std::move(callback); }
+
+    // Looks for changed files and advances the rebuilds until budget
+    // milliseconds have passed. Returns the number of programs swapped.
+    unsigned int update(double budget = 1.0)
+    {
+        const auto frameStart = std::chrono::steady_clock::now();
+        changedFiles.clear();
+        watcher.poll(changedFiles);
+        for(unsigned int file : changedFiles) {
+            for(std::unique_ptr<Entry>& entry : entries) {
+                if(entry->files[0] == file || entry->files[1] == file) {
+                    entry->dirty = true;
+                    entry->changed = frameStart;
+                }
+            }
+        }
+
+        unsigned int swaps = 0;
+        for(std::size_t i = 0; i < entries.size(); i++) {
+            Entry& entry = *entries[i];
+            // an editor may write a file in several goes, the rebuild waits
+            // for them to settle
+            if(entry.stage == Stage::Idle && entry.dirty && frameStart - entry.changed >= settleTime) {
+                entry.dirty = false;
+                start(entry);
+            }
+            while(elapsed(frameStart) < budget && step(entry, false)) {
+            }
+            if(entry.stage == Stage::Swap) {
+                swap(unsigned(i), entry);
+                swaps++;
+            }
+        }
+        return swaps;
+    }
+
+    Program program(unsigned int id) const { return entries[id]->program; }
+
+    // Info log of the last failed build, empty once one succeeds.
+    const std::string& log(unsigned int id) const { return entries[id]->log; }
+
+    unsigned long swapCount(unsigned int id) const { return entries[id]->swaps; }
+    unsigned long failureCount(unsigned int id) const { return entries[id]->failures; }
+
+    // Whether a rebuild is under way or waiting for the files to settle.
+    bool pending(unsigned int id) const { return entries[id]->stage != Stage::Idle || entries[id]->dirty; }
+
+    // Whether the driver compiles in the background.
+    bool parallelCompile() const { return parallel; }
+
+    // Why some of the files are polled rather than watched, empty if none
+    // are, see FileWatcher::error().
+    const std::string& watchError() const { return watcher.error(); }
+
+private:
+    enum class Stage { Idle, Reading, CompileVertex, CompileFragment, Link, Linking, Swap };
+
+    struct Entry
+    {
+        std::string paths[2];
+        unsigned int files[2] = { 0, 0 };
+        Program program;
+
+        Stage stage = Stage::Idle;
+        std::string sources[2];
+        GLuint shaders[2] = { 0, 0 };
+        Program pending;
+
+        bool dirty = false;
+        std::chrono::steady_clock::time_point changed;
+        std::string log;
+        unsigned long swaps = 0;
+        unsigned long failures = 0;
+
+        // last, its destructor waits for the reader thread still writing
+        // sources
+        std::future<bool> reading;
+    };
+
+    static constexpr std::chrono::milliseconds settleTime{ 50 };
+
+    static double elapsed(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static bool readFile(const std::string& path, std::string& content)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        if(!stream.is_open()) {
+            return false;
+        }
+        std::ostringstream text;
+        text << stream.rdbuf();
+        content = text.str();
+        return true;
+    }
+
+    static void start(Entry& entry)
+    {
+        Entry* reading = &entry;
+        entry.reading = std::async(std::launch::async, [reading]() {
+            return readFile(reading->paths[0], reading->sources[0]) && readFile(reading->paths[1], reading->sources[1]);
+        });
+        entry.stage = Stage::Reading;
+    }
+
+    // Whether the driver is done with a shader or program. Always true
+    // without the extension, the status queries then wait for it.
+    bool completed(GLuint object, bool program) const
+    {
+        GLint done = GL_TRUE;
+        if(parallel && program) {
+            glGetProgramiv(object, GL_COMPLETION_STATUS_KHR, &done);
+        }
+        else if(parallel) {
+            glGetShaderiv(object, GL_COMPLETION_STATUS_KHR, &done);
+        }
+        return done != GL_FALSE;
+    }
+
+    // Runs one step of a rebuild. Returns false once it is over, ready to
+    // swap, or has to wait for the reader thread or the driver; blocking
+    // steps wait instead.
+    bool step(Entry& entry, bool blocking)
+    {
+        switch(entry.stage) {
+            case Stage::Idle:
+            case Stage::Swap:
+                return false;
+            case Stage::Reading:
+                if(!blocking && entry.reading.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    return false;
+                }
+                if(!entry.reading.get()) {
+                    fail(entry, "can't read " + entry.paths[0] + " or " + entry.paths[1]);
+                    return false;
+                }
+                entry.stage = Stage::CompileVertex;
+                return true;
+            case Stage::CompileVertex:
+            case Stage::CompileFragment: {
+                const int index = entry.stage == Stage::CompileVertex ? 0 : 1;
+                entry.shaders[index] = glCreateShader(index == 0 ? GL_VERTEX_SHADER : GL_FRAGMENT_SHADER);
+                const char* source = entry.sources[index].c_str();
+                glShaderSource(entry.shaders[index], 1, &source, nullptr);
+                glCompileShader(entry.shaders[index]);
+                entry.stage = index == 0 ? Stage::CompileFragment : Stage::Link;
+                return true;
+            }
+            case Stage::Link:
+                if(!blocking && !(completed(entry.shaders[0], false) && completed(entry.shaders[1], false))) {
+                    return false;
+                }
+                for(int index = 0; index < 2; index++) {
+                    GLint success = 0;
+                    glGetShaderiv(entry.shaders[index], GL_COMPILE_STATUS, &success);
+                    if(!success) {
+                        GLchar infoLog[1024];
+                        glGetShaderInfoLog(entry.shaders[index], sizeof(infoLog), nullptr, infoLog);
+                        fail(entry, entry.paths[index] + ": " + infoLog);
+                        return false;
+                    }
+                }
+                entry.pending = state.createProgram();
+                glAttachShader(entry.pending.id, entry.shaders[0]);
+                glAttachShader(entry.pending.id, entry.shaders[1]);
+                glLinkProgram(entry.pending.id);
+                entry.stage = Stage::Linking;
+                return true;
+            case Stage::Linking: {
+                if(!blocking && !completed(entry.pending.id, true)) {
+                    return false;
+                }
+                GLint success = 0;
+                glGetProgramiv(entry.pending.id, GL_LINK_STATUS, &success);
+                if(!success) {
+                    GLchar infoLog[1024];
+                    glGetProgramInfoLog(entry.pending.id, sizeof(infoLog), nullptr, infoLog);
+                    fail(entry, infoLog);
+                    return false;
+                }
+                deleteShaders(entry);
+                entry.stage = Stage::Swap;
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void swap(unsigned int id, Entry& entry)
+    {
+        const Program old = entry.program;
+        if(old.id != 0) {
+            copyUniforms(old, entry.pending);
+            entry.swaps++;
+        }
+        entry.program = entry.pending;
+        entry.pending = Program();
+        entry.log.clear();
+        entry.stage = Stage::Idle;
+        if(swapCallback) {
+            swapCallback(id, old, entry.program);
+        }
+        if(old.id != 0) {
+            state.deleteProgram(old);
+        }
+    }
+
+    void fail(Entry& entry, const std::string& log)
+    {
+        entry.log = log;
+        entry.failures++;
+        discard(entry);
+    }
+
+    // Drops a rebuild under way, the program in use stays.
+    void discard(Entry& entry)
+    {
+        if(entry.reading.valid()) {
+            entry.reading.wait();
+        }
+        deleteShaders(entry);
+        if(entry.pending.id != 0) {
+            state.deleteProgram(entry.pending);
+            entry.pending = Program();
+        }
+        entry.stage = Stage::Idle;
+    }
+
+    static void deleteShaders(Entry& entry)
+    {
+        for(GLuint& shader : entry.shaders) {
+            if(shader != 0) {
+                glDeleteShader(shader);
+                shader = 0;
+            }
+        }
+    }
+
+    struct Uniform
+    {
+        std::string name;
+        GLenum type;
+        GLint size;
+    };
+
+    // Active uniforms, arrays under their name without the [0].
+    static std::vector<Uniform> activeUniforms(Program program)
+    {
+        std::vector<Uniform> uniforms;
+        GLint count = 0;
+        glGetProgramiv(program.id, GL_ACTIVE_UNIFORMS, &count);
+        for(GLint i = 0; i < count; i++) {
+            GLchar name[256];
+            Uniform uniform;
+            glGetActiveUniform(program.id, GLuint(i), sizeof(name), nullptr, &uniform.size, &uniform.type, name);
+            uniform.name = name;
+            uniform.name = uniform.name.substr(0, uniform.name.find('['));
+            uniforms.push_back(uniform);
+        }
+        return uniforms;
+    }
+
+    // Gives the new program the values of the uniforms it shares with the
+    // old one, same name and type, and the old one's uniform block bindings.
+    void copyUniforms(Program from, Program to)
+    {
+        state.useProgram(to);
+        const std::vector<Uniform> targets = activeUniforms(to);
+        for(const Uniform& uniform : activeUniforms(from)) {
+            for(const Uniform& target : targets) {
+                if(target.name != uniform.name || target.type != uniform.type) {
+                    continue;
+                }
+                const GLint size = uniform.size < target.size ? uniform.size : target.size;
+                for(GLint element = 0; element < size; element++) {
+                    const std::string name = uniform.size > 1 ? uniform.name + "[" + std::to_string(element) + "]" : uniform.name;
+                    const GLint source = glGetUniformLocation(from.id, name.c_str());
+                    const GLint destination = glGetUniformLocation(to.id, name.c_str());
+                    if(source >= 0 && destination >= 0) {
+                        copyUniform(from, source, destination, uniform.type);
+                    }
+                }
+            }
+        }
+
+        GLint blocks = 0;
+        glGetProgramiv(from.id, GL_ACTIVE_UNIFORM_BLOCKS, &blocks);
+        for(GLint i = 0; i < blocks; i++) {
+            GLchar name[256];
+            GLint binding = 0;
+            glGetActiveUniformBlockName(from.id, GLuint(i), sizeof(name), nullptr, name);
+            glGetActiveUniformBlockiv(from.id, GLuint(i), GL_UNIFORM_BLOCK_BINDING, &binding);
+            const GLuint index = glGetUniformBlockIndex(to.id, name);
+            if(index != GL_INVALID_INDEX) {
+                glUniformBlockBinding(to.id, index, GLuint(binding));
+            }
+        }
+    }
+
+    // Copies one value to the program in use.
+    static void copyUniform(Program from, GLint source, GLint destination, GLenum type)
+    {
+        GLfloat f[16];
+        GLint i[4];
+        GLuint u[4];
+        switch(type) {
+            case GL_FLOAT: glGetUniformfv(from.id, source, f); glUniform1fv(destination, 1, f); break;
+            case GL_FLOAT_VEC2: glGetUniformfv(from.id, source, f); glUniform2fv(destination, 1, f); break;
+            case GL_FLOAT_VEC3: glGetUniformfv(from.id, source, f); glUniform3fv(destination, 1, f); break;
+            case GL_FLOAT_VEC4: glGetUniformfv(from.id, source, f); glUniform4fv(destination, 1, f); break;
+            case GL_FLOAT_MAT2: glGetUniformfv(from.id, source, f); glUniformMatrix2fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT3: glGetUniformfv(from.id, source, f); glUniformMatrix3fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT4: glGetUniformfv(from.id, source, f); glUniformMatrix4fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT2x3: glGetUniformfv(from.id, source, f); glUniformMatrix2x3fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT2x4: glGetUniformfv(from.id, source, f); glUniformMatrix2x4fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT3x2: glGetUniformfv(from.id, source, f); glUniformMatrix3x2fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT3x4: glGetUniformfv(from.id, source, f); glUniformMatrix3x4fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT4x2: glGetUniformfv(from.id, source, f); glUniformMatrix4x2fv(destination, 1, GL_FALSE, f); break;
+            case GL_FLOAT_MAT4x3: glGetUniformfv(from.id, source, f); glUniformMatrix4x3fv(destination, 1, GL_FALSE, f); break;
+            case GL_INT_VEC2: case GL_BOOL_VEC2: glGetUniformiv(from.id, source, i); glUniform2iv(destination, 1, i); break;
+            case GL_INT_VEC3: case GL_BOOL_VEC3: glGetUniformiv(from.id, source, i); glUniform3iv(destination, 1, i); break;
+            case GL_INT_VEC4: case GL_BOOL_VEC4: glGetUniformiv(from.id, source, i); glUniform4iv(destination, 1, i); break;
+            case GL_UNSIGNED_INT: glGetUniformuiv(from.id, source, u); glUniform1uiv(destination, 1, u); break;
+            case GL_UNSIGNED_INT_VEC2: glGetUniformuiv(from.id, source, u); glUniform2uiv(destination, 1, u); break;
+            case GL_UNSIGNED_INT_VEC3: glGetUniformuiv(from.id, source, u); glUniform3uiv(destination, 1, u); break;
+            case GL_UNSIGNED_INT_VEC4: glGetUniformuiv(from.id, source, u); glUniform4uiv(destination, 1, u); break;
+            default:
+                // int, bool and the samplers
+                glGetUniformiv(from.id, source, i);
+                glUniform1iv(destination, 1, i);
+                break;
+        }
+    }
+
+    StateCache& state;
+    FileWatcher watcher;
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::vector<unsigned int> changedFiles;
+    SwapCallback swapCallback;
+    bool parallel = false;
+};
+
+} // namespace gl
@@ -0,0 +1,604 @@
+// Software rasterizer
+//
+// Renders the kind of scenes the examples draw, textured and depth tested
+// triangles, on the CPU with no GL context, e.g. to produce reference
+// images on machines without a GPU.
+//
+// The vertex stage is done by the caller: vertices arrive in clip space,
+// what the vertex shader writes to gl_Position, with up to maxVaryings
+// floats to interpolate. The fragment stage is a function returning the
+// color from the interpolated varyings and a uniforms pointer.
+//
+// Triangles are clipped against the view volume, set up and binned into
+// tiles of tileSize pixels as they are drawn. flush() rasterizes the tiles
+// in parallel, each tile by one thread, which also owns its part of the
+// color and depth buffers: no locking past taking the next tile. Coverage
+// and depth are evaluated 4 pixels at a time with edge functions, using the
+// compiler's vector extensions (SSE on x86, NEON on ARM). Varyings are
+// interpolated perspective correct, depth uses GL_LESS, and shared edges
+// follow the top left rule so no pixel is drawn twice.
+//
+// Header only, needs glm and no GL.
+//
+//     gl::SoftRasterizer rasterizer(640, 480);
+//     rasterizer.clear(glm::vec4(0.2f, 0.3f, 0.3f, 1.0f));
+//     rasterizer.draw(vertices, 36, 2, shadeFragment, &uniforms);
+//     rasterizer.flush();
+//     rasterizer.writePpm("frame.ppm");
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace gl {
+
+namespace detail {
+
+typedef float SoftFloat4 __attribute__((vector_size(16)));
+typedef std::int32_t SoftInt4 __attribute__((vector_size(16)));
+
+// std::floor is a library call on x86 without SSE4.1
+inline float softFloor(float value)
+{
+    if(!(std::fabs(value) < 8388608.0f)) {
+        return std::floor(value);
+    }
+    const float truncated = float(int(value));
+    return truncated > value ? truncated - 1.0f : truncated;
+}
+
+} // namespace detail
+
+// RGBA texture sampled like GL_LINEAR with GL_REPEAT, without mipmaps.
+class SoftTexture
+{
+public:
+    // Copies width * height texels of channels bytes, first row at t = 0
+    // as with glTexImage2D. Missing channels read as in GL: 0 for green
+    // and blue, 1 for alpha.
+    void assign(int width, int height, int channels, const unsigned char* data)
+    {
+        textureWidth = width;
+        textureHeight = height;
+        texels.resize(std::size_t(width) * std::size_t(height));
+        for(std::size_t i = 0; i < texels.size(); i++) {
+            const unsigned char* texel = data + i * std::size_t(channels);
+            detail::SoftFloat4 color = { 0.0f, 0.0f, 0.0f, 1.0f };
+            for(int c = 0; c < channels && c < 4; c++) {
+                color[c] = float(texel[c]) / 255.0f;
+            }
+            texels[i] = color;
+        }
+    }
+
+    int width() const { return textureWidth; }
+    int height() const { return textureHeight; }
+
+    glm::vec4 sample(const glm::vec2& uv) const
+    {
+        if(texels.empty()) {
+            return glm::vec4(1.0f);
+        }
+        float u = uv.x - detail::softFloor(uv.x);
+        float v = uv.y - detail::softFloor(uv.y);
+        u = u >= 0.0f && u < 1.0f ? u : 0.0f;
+        v = v >= 0.0f && v < 1.0f ? v : 0.0f;
+
+        // x and y are at least -0.5, truncating after adding 1 floors them
+        const float x = u * float(textureWidth) + 0.5f;
+        const float y = v * float(textureHeight) + 0.5f;
+        int x0 = int(x) - 1, y0 = int(y) - 1;
+        const float ax = x - float(x0 + 1);
+        const float ay = y - float(y0 + 1);
+        x0 = x0 < 0 ? textureWidth - 1 : x0;
+        y0 = y0 < 0 ? textureHeight - 1 : y0;
+        const int x1 = x0 + 1 == textureWidth ? 0 : x0 + 1;
+        const int y1 = y0 + 1 == textureHeight ? 0 : y0 + 1;
+
+        const detail::SoftFloat4 bottom = texel(x0, y0) + (texel(x1, y0) - texel(x0, y0)) * ax;
+        const detail::SoftFloat4 top = texel(x0, y1) + (texel(x1, y1) - texel(x0, y1)) * ax;
+        const detail::SoftFloat4 color = bottom + (top - bottom) * ay;
+        return glm::vec4(color[0], color[1], color[2], color[3]);
+    }
+
+private:
+    const detail::SoftFloat4& texel(int x, int y) const
+    {
+        return texels[std::size_t(y) * std::size_t(textureWidth) + std::size_t(x)];
+    }
+
+    int textureWidth = 0;
+    int textureHeight = 0;
+    std::vector<detail::SoftFloat4> texels;
+};
+
+struct SoftVertex
+{
+    glm::vec4 position;           // clip space
+    float varyings[8];
+};
+
+// Returns the fragment color, components in [0, 1].
+using SoftFragmentShader = glm::vec4 (*)(const float* varyings, const void* uniforms);
+
+class SoftRasterizer
+{
+public:
+    static constexpr int tileSize = 64;
+    static constexpr unsigned int maxVaryings = 8;
+
+    // threadCount 0 uses every core, the calling thread being one of them.
+    SoftRasterizer(int width, int height, unsigned int threadCount = 0)
+        : frameWidth(width), frameHeight(height)
+    {
+        tilesX = (width + tileSize - 1) / tileSize;
+        tilesY = (height + tileSize - 1) / tileSize;
+        stride = tilesX * tileSize;
+        colors.assign(std::size_t(stride) * std::size_t(tilesY * tileSize), 0);
+        depths.assign(colors.size(), 1.0f);
+        bins.resize(std::size_t(tilesX) * std::size_t(tilesY));
+
+        if(threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        for(unsigned int i = 1; i < threadCount; i++) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    SoftRasterizer(const SoftRasterizer&) = delete;
+    SoftRasterizer& operator=(const SoftRasterizer&) = delete;
+
+    ~SoftRasterizer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int width() const { return frameWidth; }
+    int height() const { return frameHeight; }
+    unsigned int threadCount() const { return unsigned(workers.size()) + 1; }
+
+    // Fills the color and depth buffers, after the queued triangles.
+    void clear(const glm::vec4& color, float depth = 1.0f)
+    {
+        flush();
+        std::fill(colors.begin(), colors.end(), packColor(color));
+        std::fill(depths.begin(), depths.end(), depth);
+    }
+
+    // GL_DEPTH_TEST with GL_LESS, applies to the triangles drawn next.
+    void depthTest(bool enabled) { depthTesting = enabled; }
+
+    // Queues count / 3 triangles.
+    void draw(const SoftVertex* vertices, std::size_t count, unsigned int varyingCount,
+              SoftFragmentShader shader, const void* uniforms)
+    {
+        for(std::size_t i = 0; i + 2 < count; i += 3) {
+            submit(vertices[i], vertices[i + 1], vertices[i + 2], varyingCount, shader, uniforms);
+        }
+    }
+
+    // Queues indexCount / 3 triangles, like glDrawElements.
+    void drawIndexed(const SoftVertex* vertices, const std::uint32_t* indices, std::size_t indexCount,
+                     unsigned int varyingCount, SoftFragmentShader shader, const void* uniforms)
+    {
+        for(std::size_t i = 0; i + 2 < indexCount; i += 3) {
+            submit(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], varyingCount, shader, uniforms);
+        }
+    }
+
+    // Rasterizes the queued triangles.
+    void flush()
+    {
+        if(triangles.empty()) {
+            return;
+        }
+        nextTile.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busy = unsigned(workers.size());
+            generation++;
+        }
+        wake.notify_all();
+        runTiles();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this]() { return busy == 0; });
+        }
+
+        triangles.clear();
+        for(std::vector<std::uint32_t>& bin : bins) {
+            bin.clear();
+        }
+    }
+
+    // Color as 0xAABBGGRR, row 0 at the top.
+    std::uint32_t pixel(int x, int y) const { return colors[std::size_t(y) * std::size_t(stride) + std::size_t(x)]; }
+    float depth(int x, int y) const { return depths[std::size_t(y) * std::size_t(stride) + std::size_t(x)]; }
+
+    bool writePpm(const char* path) const
+    {
+        std::FILE* file = std::fopen(path, "wb");
+        if(file == nullptr) {
+            return false;
+        }
+        std::fprintf(file, "P6\n%d %d\n255\n", frameWidth, frameHeight);
+        std::vector<unsigned char> row(std::size_t(frameWidth) * 3);
+        for(int y = 0; y < frameHeight; y++) {
+            for(int x = 0; x < frameWidth; x++) {
+                const std::uint32_t color = pixel(x, y);
+                row[std::size_t(x) * 3] = (unsigned char)(color & 0xff);
+                row[std::size_t(x) * 3 + 1] = (unsigned char)((color >> 8) & 0xff);
+                row[std::size_t(x) * 3 + 2] = (unsigned char)((color >> 16) & 0xff);
+            }
+            std::fwrite(row.data(), 1, row.size(), file);
+        }
+        return std::fclose(file) == 0;
+    }
+
+    // Triangles set up after clipping, and fragments shaded, since the
+    // last resetCounters().
+    std::uint64_t triangleCount() const { return setupTriangles; }
+    std::uint64_t fragmentCount() const { return shadedFragments.load(std::memory_order_relaxed); }
+    void resetCounters()
+    {
+        setupTriangles = 0;
+        shadedFragments.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    typedef detail::SoftFloat4 Float4;
+    typedef detail::SoftInt4 Int4;
+
+    struct Triangle
+    {
+        float a[3], b[3], c[3];   // edge functions a * x + b * y + c, positive inside
+        std::int32_t inclusive[3]; // -1 if pixels exactly on the edge are drawn
+        float z[3];               // depth divided by the doubled area
+        float w[3];               // 1 / w divided by the doubled area
+        float varyings[3][maxVaryings];
+        int minX, minY, maxX, maxY;
+        unsigned int varyingCount;
+        bool depthTest;
+        SoftFragmentShader shader;
+        const void* uniforms;
+    };
+
+    static Float4 splat(float value) { return Float4{ value, value, value, value }; }
+    static Int4 splat(std::int32_t value) { return Int4{ value, value, value, value }; }
+
+    static std::uint32_t packChannel(float value)
+    {
+        value = value * 255.0f + 0.5f;
+        value = value > 0.0f ? value : 0.0f;
+        value = value < 255.0f ? value : 255.0f;
+        return std::uint32_t(value);
+    }
+
+    static std::uint32_t packColor(const glm::vec4& color)
+    {
+        return packChannel(color.r) | (packChannel(color.g) << 8) | (packChannel(color.b) << 16) | (packChannel(color.a) << 24);
+    }
+
+    static SoftVertex lerp(const SoftVertex& from, const SoftVertex& to, float t, unsigned int varyingCount)
+    {
+        SoftVertex result;
+        result.position = from.position + (to.position - from.position) * t;
+        for(unsigned int i = 0; i < varyingCount; i++) {
+            result.varyings[i] = from.varyings[i] + (to.varyings[i] - from.varyings[i]) * t;
+        }
+        return result;
+    }
+
+    // Distance to the six planes of the view volume, inside when positive.
+    static float planeDistance(const glm::vec4& p, int plane)
+    {
+        switch(plane) {
+        case 0: return p.w + p.x;
+        case 1: return p.w - p.x;
+        case 2: return p.w + p.y;
+        case 3: return p.w - p.y;
+        case 4: return p.w + p.z;
+        default: return p.w - p.z;
+        }
+    }
+
+    void submit(const SoftVertex& v0, const SoftVertex& v1, const SoftVertex& v2,
+                unsigned int varyingCount, SoftFragmentShader shader, const void* uniforms)
+    {
+        varyingCount = varyingCount < maxVaryings ? varyingCount : maxVaryings;
+
+        // trivial accept or reject, most triangles
+        unsigned int outside[3] = { 0, 0, 0 };
+        const SoftVertex* corners[3] = { &v0, &v1, &v2 };
+        for(int plane = 0; plane < 6; plane++) {
+            for(int i = 0; i < 3; i++) {
+                outside[i] |= (planeDistance(corners[i]->position, plane) < 0.0f ? 1u : 0u) << plane;
+            }
+        }
+        if((outside[0] & outside[1] & outside[2]) != 0) {
+            return;
+        }
+        if((outside[0] | outside[1] | outside[2]) == 0) {
+            setup(v0, v1, v2, varyingCount, shader, uniforms);
+            return;
+        }
+
+        // Sutherland Hodgman against the planes crossed
+        SoftVertex polygons[2][9];
+        int count = 3;
+        polygons[0][0] = v0;
+        polygons[0][1] = v1;
+        polygons[0][2] = v2;
+        int current = 0;
+        const unsigned int crossed = outside[0] | outside[1] | outside[2];
+        for(int plane = 0; plane < 6 && count > 0; plane++) {
+            if((crossed & (1u << plane)) == 0) {
+                continue;
+            }
+            const SoftVertex* in = polygons[current];
+            SoftVertex* out = polygons[current ^ 1];
+            int outCount = 0;
+            for(int i = 0; i < count; i++) {
+                const SoftVertex& from = in[i];
+                const SoftVertex& to = in[(i + 1) % count];
+                const float dFrom = planeDistance(from.position, plane);
+                const float dTo = planeDistance(to.position, plane);
+                if(dFrom >= 0.0f) {
+                    out[outCount++] = from;
+                }
+                if((dFrom >= 0.0f) != (dTo >= 0.0f)) {
+                    out[outCount++] = lerp(from, to, dFrom / (dFrom - dTo), varyingCount);
+                }
+            }
+            count = outCount;
+            current ^= 1;
+        }
+        for(int i = 2; i < count; i++) {
+            setup(polygons[current][0], polygons[current][i - 1], polygons[current][i], varyingCount, shader, uniforms);
+        }
+    }
+
+    void setup(const SoftVertex& v0, const SoftVertex& v1, const SoftVertex& v2,
+               unsigned int varyingCount, SoftFragmentShader shader, const void* uniforms)
+    {
+        const SoftVertex* vertices[3] = { &v0, &v1, &v2 };
+        float x[3], y[3], z[3], invW[3];
+        for(int i = 0; i < 3; i++) {
+            const glm::vec4& p = vertices[i]->position;
+            if(!(p.w > 0.0f)) {
+                return;
+            }
+            invW[i] = 1.0f / p.w;
+            // snapped to 1/256 pixel, so edges shared by two triangles
+            // are the same edge
+            x[i] = detail::softFloor(((p.x * invW[i]) * 0.5f + 0.5f) * float(frameWidth) * 256.0f + 0.5f) / 256.0f;
+            y[i] = detail::softFloor((0.5f - (p.y * invW[i]) * 0.5f) * float(frameHeight) * 256.0f + 0.5f) / 256.0f;
+            z[i] = (p.z * invW[i]) * 0.5f + 0.5f;
+        }
+
+        float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if(area == 0.0f || !std::isfinite(area)) {
+            return;
+        }
+        int order[3] = { 0, 1, 2 };
+        if(area < 0.0f) {
+            std::swap(order[1], order[2]);
+            area = -area;
+        }
+
+        Triangle triangle;
+        const float invArea = 1.0f / area;
+        for(int e = 0; e < 3; e++) {
+            // edge opposite to vertex e, its function is e's weight
+            const int i = order[(e + 1) % 3];
+            const int j = order[(e + 2) % 3];
+            const float a = y[i] - y[j];
+            const float b = x[j] - x[i];
+            // c from the endpoint that comes first, so that the
+            // neighbor sharing the edge gets exactly the opposite values
+            const bool iFirst = x[i] < x[j] || (x[i] == x[j] && y[i] < y[j]);
+            const float c = iFirst ? -(a * x[i] + b * y[i]) : -(a * x[j] + b * y[j]);
+            triangle.a[e] = a;
+            triangle.b[e] = b;
+            triangle.c[e] = c;
+            // top left rule, with y down: left edges go down, top edges
+            // are horizontal and go right to left here
+            triangle.inclusive[e] = (a > 0.0f || (a == 0.0f && b < 0.0f)) ? -1 : 0;
+
+            const int v = order[e];
+            triangle.z[e] = z[v] * invArea;
+            triangle.w[e] = invW[v] * invArea;
+            for(unsigned int k = 0; k < varyingCount; k++) {
+                triangle.varyings[e][k] = vertices[v]->varyings[k];
+            }
+        }
+
+        triangle.minX = std::max(0, int(detail::softFloor(std::min({ x[0], x[1], x[2] }))));
+        triangle.minY = std::max(0, int(detail::softFloor(std::min({ y[0], y[1], y[2] }))));
+        triangle.maxX = std::min(frameWidth, int(std::ceil(std::max({ x[0], x[1], x[2] }))) + 1);
+        triangle.maxY = std::min(frameHeight, int(std::ceil(std::max({ y[0], y[1], y[2] }))) + 1);
+        if(triangle.minX >= triangle.maxX || triangle.minY >= triangle.maxY) {
+            return;
+        }
+        triangle.varyingCount = varyingCount;
+        triangle.depthTest = depthTesting;
+        triangle.shader = shader;
+        triangle.uniforms = uniforms;
+
+        const std::uint32_t id = std::uint32_t(triangles.size());
+        triangles.push_back(triangle);
+        setupTriangles++;
+        for(int ty = triangle.minY / tileSize; ty <= (triangle.maxY - 1) / tileSize; ty++) {
+            for(int tx = triangle.minX / tileSize; tx <= (triangle.maxX - 1) / tileSize; tx++) {
+                bins[std::size_t(ty) * std::size_t(tilesX) + std::size_t(tx)].push_back(id);
+            }
+        }
+    }
+
+    void workerLoop()
+    {
+        unsigned int seen = 0;
+        for(;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]() { return quit || generation != seen; });
+                if(quit) {
+                    return;
+                }
+                seen = generation;
+            }
+            runTiles();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                busy--;
+            }
+            done.notify_one();
+        }
+    }
+
+    void runTiles()
+    {
+        std::uint64_t fragments = 0;
+        for(;;) {
+            const unsigned int tile = nextTile.fetch_add(1, std::memory_order_relaxed);
+            if(tile >= bins.size()) {
+                break;
+            }
+            fragments += rasterizeTile(tile);
+        }
+        shadedFragments.fetch_add(fragments, std::memory_order_relaxed);
+    }
+
+    std::uint64_t rasterizeTile(unsigned int tile)
+    {
+        const int tileX = int(tile % unsigned(tilesX)) * tileSize;
+        const int tileY = int(tile / unsigned(tilesX)) * tileSize;
+        const Float4 laneOffsets = { 0.5f, 1.5f, 2.5f, 3.5f };
+        std::uint64_t fragments = 0;
+        Float4 varyings[maxVaryings];
+
+        for(std::uint32_t id : bins[tile]) {
+            const Triangle& t = triangles[id];
+            const int minX = std::max(t.minX, tileX) & ~3;
+            const int maxX = std::min(t.maxX, tileX + tileSize);
+            const int minY = std::max(t.minY, tileY);
+            const int maxY = std::min(t.maxY, tileY + tileSize);
+
+            const Float4 a0 = splat(t.a[0]), a1 = splat(t.a[1]), a2 = splat(t.a[2]);
+            const Int4 inclusive0 = splat(t.inclusive[0]), inclusive1 = splat(t.inclusive[1]), inclusive2 = splat(t.inclusive[2]);
+            const Float4 z0 = splat(t.z[0]), z1 = splat(t.z[1]), z2 = splat(t.z[2]);
+            const Float4 perspective0 = splat(t.w[0]), perspective1 = splat(t.w[1]), perspective2 = splat(t.w[2]);
+            const Float4 zero = splat(0.0f);
+            const unsigned int varyingCount = t.varyingCount;
+            const bool depthTest = t.depthTest;
+            const SoftFragmentShader shader = t.shader;
+            const void* uniforms = t.uniforms;
+
+            for(int y = minY; y < maxY; y++) {
+                const float py = float(y) + 0.5f;
+                const Float4 row0 = splat(t.b[0] * py + t.c[0]);
+                const Float4 row1 = splat(t.b[1] * py + t.c[1]);
+                const Float4 row2 = splat(t.b[2] * py + t.c[2]);
+                std::uint32_t* colorRow = colors.data() + std::size_t(y) * std::size_t(stride);
+                float* depthRow = depths.data() + std::size_t(y) * std::size_t(stride);
+
+                for(int x = minX; x < maxX; x += 4) {
+                    const Float4 px = splat(float(x)) + laneOffsets;
+                    const Float4 e0 = a0 * px + row0;
+                    const Float4 e1 = a1 * px + row1;
+                    const Float4 e2 = a2 * px + row2;
+                    Int4 inside = ((e0 > zero) | ((e0 == zero) & inclusive0))
+                                & ((e1 > zero) | ((e1 == zero) & inclusive1))
+                                & ((e2 > zero) | ((e2 == zero) & inclusive2));
+                    if((inside[0] | inside[1] | inside[2] | inside[3]) == 0) {
+                        continue;
+                    }
+
+                    const Float4 z = e0 * z0 + e1 * z1 + e2 * z2;
+                    if(depthTest) {
+                        Float4 stored;
+                        std::memcpy(&stored, depthRow + x, sizeof(stored));
+                        inside &= z < stored;
+                    }
+
+                    if((inside[0] | inside[1] | inside[2] | inside[3]) == 0) {
+                        continue;
+                    }
+
+                    // perspective correct weights, then the varyings of the 4 pixels
+                    Float4 w0 = e0 * perspective0;
+                    Float4 w1 = e1 * perspective1;
+                    Float4 w2 = e2 * perspective2;
+                    const Float4 invSum = splat(1.0f) / (w0 + w1 + w2);
+                    w0 *= invSum;
+                    w1 *= invSum;
+                    w2 *= invSum;
+                    for(unsigned int k = 0; k < varyingCount; k++) {
+                        varyings[k] = w0 * splat(t.varyings[0][k]) + w1 * splat(t.varyings[1][k]) + w2 * splat(t.varyings[2][k]);
+                    }
+
+                    for(int lane = 0; lane < 4; lane++) {
+                        if(inside[lane] == 0) {
+                            continue;
+                        }
+                        float fragment[maxVaryings];
+                        for(unsigned int k = 0; k < varyingCount; k++) {
+                            fragment[k] = varyings[k][lane];
+                        }
+                        colorRow[x + lane] = packColor(shader(fragment, uniforms));
+                        if(depthTest) {
+                            depthRow[x + lane] = z[lane];
+                        }
+                        fragments++;
+                    }
+                }
+            }
+        }
+        return fragments;
+    }
+
+    int frameWidth;
+    int frameHeight;
+    int tilesX = 0;
+    int tilesY = 0;
+    int stride = 0;                       // pixels per row, whole tiles
+    std::vector<std::uint32_t> colors;
+    std::vector<float> depths;
+    bool depthTesting = false;
+
+    std::vector<Triangle> triangles;
+    std::vector<std::vector<std::uint32_t>> bins;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    unsigned int generation = 0;
+    unsigned int busy = 0;
+    bool quit = false;
+    std::atomic<unsigned int> nextTile{ 0 };
+
+    std::uint64_t setupTriangles = 0;
+    std::atomic<std::uint64_t> shadedFragments{ 0 };
+};
+
+} // namespace gl
@@ -0,0 +1,458 @@
+// Loose hashed grid
+//
+// Spatial index for objects that move every frame, where even refitting a
+// Bvh over all of them costs too much. Space is cut in cubic cells, only
+// the cells holding objects exist, in a hash table. An object belongs to
+// the cell of its center: the grid is loose, a cell's objects reach out of
+// it by at most the largest half extent seen, and queries widen by as much.
+//
+// Objects are identified by the caller's indices, e.g. into cubePositions,
+// below the capacity given at construction. insert(), move() and remove()
+// are constant time and lock free: any number of update threads may call
+// them at once, as long as no two touch the same object. An object staying
+// in its cell only gets its box updated. One that changes cells is queued,
+// and commit() moves the queued objects between cells on every thread,
+// work proportional to those that changed cells only. Cells left empty
+// stay allocated, for the next objects passing by.
+//
+// Each cell keeps its objects' indices contiguous. Queries give them as
+// spans, one per cell, that stay valid until the next commit(), or test
+// each object and append the indices. The spans are much cheaper: testing
+// reads the objects' boxes in index order, scattered in memory.
+//
+// Header only, needs glm and no GL.
+//
+//     gl::SpatialGrid grid(4.0f, cubeCount);
+//     for(std::uint32_t i = 0; i < cubeCount; i++) {
+//         grid.insert(i, { cubePositions[i] - 0.5f, cubePositions[i] + 0.5f });
+//     }
+//     grid.commit();
+//     grid.cullFrustum(projection * view, visible);
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "gl_bvh.h"
+
+namespace gl {
+
+struct SpatialSpan
+{
+    const std::uint32_t* objects;
+    std::uint32_t count;
+};
+
+class SpatialGrid
+{
+public:
+    // cellSize around the size of the objects, capacity the bound of the
+    // object indices. threads 0 uses every core in commit().
+    SpatialGrid(float cellSize, std::size_t capacity, unsigned int threads = 0)
+        : cellSize(cellSize),
+          inverseCellSize(1.0f / cellSize),
+          threads(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+          records(capacity),
+          links(capacity),
+          queue(capacity)
+    {
+        table.assign(64, emptyKey);
+        tableCells.assign(64, 0);
+    }
+
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    void insert(std::uint32_t object, const Bounds& bounds)
+    {
+        records[object].bounds = bounds;
+        growExtent(bounds);
+        enqueue(object, keyOf(bounds));
+    }
+
+    void move(std::uint32_t object, const Bounds& bounds)
+    {
+        Record& record = records[object];
+        record.bounds = bounds;
+        growExtent(bounds);
+        const std::uint64_t key = keyOf(bounds);
+        if(key != record.key) {
+            enqueue(object, key);
+        }
+    }
+
+    void remove(std::uint32_t object)
+    {
+        enqueue(object, removedKey);
+    }
+
+    // Moves the objects queued since the last commit between cells. Not
+    // concurrent with updates or queries.
+    void commit()
+    {
+        const std::uint32_t count = std::min<std::uint32_t>(queued.exchange(0), std::uint32_t(records.size()));
+        if(count == 0) {
+            return;
+        }
+
+        // out of their cells, each thread owning the cells with its index
+        // modulo the thread count: no two threads write the same cell or
+        // the slot of an object in it
+        const unsigned int workers = std::min<unsigned int>(threads, (count + 4095) / 4096);
+        detail::bvhParallel(workers, [&](unsigned int worker) {
+            for(std::uint32_t i = 0; i < count; i++) {
+                const Link& link = links[queue[i]];
+                if(link.cell != noCell && link.cell % workers == worker && link.newKey != link.key) {
+                    removeFromCell(link);
+                }
+            }
+        });
+
+        // new cells on this thread, the table is not shared
+        for(std::uint32_t i = 0; i < count; i++) {
+            Link& link = links[queue[i]];
+            records[queue[i]].key = link.newKey;
+            if(link.newKey == link.key) {
+                link.newCell = noCell;
+                continue;
+            }
+            link.key = link.newKey;
+            link.cell = noCell;
+            link.newCell = link.key != removedKey ? findOrAddCell(link.key) : noCell;
+        }
+
+        detail::bvhParallel(workers, [&](unsigned int worker) {
+            for(std::uint32_t i = 0; i < count; i++) {
+                const std::uint32_t object = queue[i];
+                Link& link = links[object];
+                if(link.newCell != noCell && link.newCell % workers == worker) {
+                    Cell& cell = cells[link.newCell];
+                    link.cell = link.newCell;
+                    link.slot = std::uint32_t(cell.objects.size());
+                    cell.objects.push_back(object);
+                }
+            }
+        });
+    }
+
+    float cellExtent() const { return cellSize; }
+    std::size_t capacity() const { return records.size(); }
+    std::size_t cellCount() const { return cells.size(); }
+    const Bounds& bounds(std::uint32_t object) const { return records[object].bounds; }
+
+    // Spans of the cells whose objects may overlap query.
+    void queryBounds(const Bounds& query, std::vector<SpatialSpan>& spans) const
+    {
+        visitCells(query, [&](const Cell& cell, const Bounds&) {
+            spans.push_back({ cell.objects.data(), std::uint32_t(cell.objects.size()) });
+        });
+    }
+
+    // Objects whose box overlaps query.
+    void queryBounds(const Bounds& query, std::vector<std::uint32_t>& found) const
+    {
+        visitCells(query, [&](const Cell& cell, const Bounds& loose) {
+            if(contains(query, loose)) {
+                found.insert(found.end(), cell.objects.begin(), cell.objects.end());
+                return;
+            }
+            for(std::uint32_t object : cell.objects) {
+                const Bounds& b = records[object].bounds;
+                if(glm::all(glm::lessThanEqual(b.low, query.high)) && glm::all(glm::greaterThanEqual(b.high, query.low))) {
+                    found.push_back(object);
+                }
+            }
+        });
+    }
+
+    // Spans of the cells that may be in the frustum of viewProjection.
+    void cullFrustum(const glm::mat4& viewProjection, std::vector<SpatialSpan>& spans) const
+    {
+        visitFrustum(viewProjection, [&](const Cell& cell, const glm::vec4*, std::uint32_t, const Bounds&) {
+            spans.push_back({ cell.objects.data(), std::uint32_t(cell.objects.size()) });
+        });
+    }
+
+    // Objects whose box intersects the frustum, tested against its planes
+    // like Bvh::cullFrustum and, tighter near its corners, its box.
+    void cullFrustum(const glm::mat4& viewProjection, std::vector<std::uint32_t>& visible) const
+    {
+        visitFrustum(viewProjection, [&](const Cell& cell, const glm::vec4* planes, std::uint32_t planeMask, const Bounds& frustum) {
+            if(planeMask == 0) {
+                visible.insert(visible.end(), cell.objects.begin(), cell.objects.end());
+                return;
+            }
+            for(std::uint32_t object : cell.objects) {
+                const Bounds& b = records[object].bounds;
+                if(glm::all(glm::lessThanEqual(b.low, frustum.high)) && glm::all(glm::greaterThanEqual(b.high, frustum.low))
+                   && !outsidePlanes(b, planes, planeMask)) {
+                    visible.push_back(object);
+                }
+            }
+        });
+    }
+
+private:
+    static constexpr std::uint64_t emptyKey = 0xffffffffffffffffull;
+    static constexpr std::uint64_t removedKey = 0xfffffffffffffffeull;
+    static constexpr std::uint64_t queuedKey = 0xfffffffffffffffdull;
+    static constexpr std::uint32_t noCell = 0xffffffffu;
+    static constexpr int coordinateBits = 21;
+
+    // What every update reads, kept small, the rest is for commit().
+    struct Record
+    {
+        Bounds bounds;
+        std::uint64_t key = removedKey;     // cell, queuedKey while queued
+    };
+
+    struct Link
+    {
+        std::uint64_t key = removedKey;     // cell as of the last commit
+        std::uint64_t newKey = removedKey;
+        std::uint32_t cell = noCell;
+        std::uint32_t newCell = noCell;
+        std::uint32_t slot = 0;             // in the cell's objects
+    };
+
+    struct Cell
+    {
+        glm::ivec3 coordinates;
+        std::vector<std::uint32_t> objects;
+    };
+
+    void enqueue(std::uint32_t object, std::uint64_t key)
+    {
+        links[object].newKey = key;
+        if(records[object].key != queuedKey) {
+            records[object].key = queuedKey;
+            queue[queued.fetch_add(1, std::memory_order_relaxed)] = object;
+        }
+    }
+
+    // Positive floats order as their bits: a lock free maximum.
+    void growExtent(const Bounds& bounds)
+    {
+        const glm::vec3 half = (bounds.high - bounds.low) * 0.5f;
+        const float extent = std::max(std::max(half.x, half.y), half.z);
+        std::uint32_t bits;
+        std::memcpy(&bits, &extent, sizeof(bits));
+        std::uint32_t current = maxExtentBits.load(std::memory_order_relaxed);
+        while(bits > current && !maxExtentBits.compare_exchange_weak(current, bits, std::memory_order_relaxed)) {
+        }
+    }
+
+    float maxExtent() const
+    {
+        const std::uint32_t bits = maxExtentBits.load(std::memory_order_relaxed);
+        float extent;
+        std::memcpy(&extent, &bits, sizeof(extent));
+        return extent;
+    }
+
+    // Floor by truncation, std::floor is a call without SSE 4.1.
+    glm::ivec3 cellOf(const glm::vec3& position) const
+    {
+        const float limit = float((1 << (coordinateBits - 1)) - 1);
+        const glm::vec3 scaled = glm::clamp(position * inverseCellSize, glm::vec3(-limit), glm::vec3(limit));
+        const glm::ivec3 truncated(scaled);
+        return truncated - glm::ivec3(glm::lessThan(scaled, glm::vec3(truncated)));
+    }
+
+    static std::uint64_t keyOf(const glm::ivec3& cell)
+    {
+        const std::uint64_t mask = (1ull << coordinateBits) - 1;
+        const std::uint64_t bias = 1ull << (coordinateBits - 1);
+        return ((std::uint64_t(cell.x) + bias) & mask) | (((std::uint64_t(cell.y) + bias) & mask) << coordinateBits)
+               | (((std::uint64_t(cell.z) + bias) & mask) << (2 * coordinateBits));
+    }
+
+    std::uint64_t keyOf(const Bounds& bounds) const { return keyOf(cellOf((bounds.low + bounds.high) * 0.5f)); }
+
+    std::size_t slotOf(std::uint64_t key) const
+    {
+        return std::size_t((key * 0x9e3779b97f4a7c15ull) >> 32) & (table.size() - 1);
+    }
+
+    std::uint32_t findCell(std::uint64_t key) const
+    {
+        for(std::size_t slot = slotOf(key);; slot = (slot + 1) & (table.size() - 1)) {
+            if(table[slot] == key) {
+                return tableCells[slot];
+            }
+            if(table[slot] == emptyKey) {
+                return noCell;
+            }
+        }
+    }
+
+    std::uint32_t findOrAddCell(std::uint64_t key)
+    {
+        std::size_t slot = slotOf(key);
+        for(; table[slot] != emptyKey; slot = (slot + 1) & (table.size() - 1)) {
+            if(table[slot] == key) {
+                return tableCells[slot];
+            }
+        }
+        const std::uint32_t index = std::uint32_t(cells.size());
+        const std::uint64_t mask = (1ull << coordinateBits) - 1;
+        const std::int64_t bias = 1ll << (coordinateBits - 1);
+        cells.push_back({ glm::ivec3(int(std::int64_t(key & mask) - bias), int(std::int64_t((key >> coordinateBits) & mask) - bias),
+                                     int(std::int64_t((key >> (2 * coordinateBits)) & mask) - bias)),
+                          {} });
+        table[slot] = key;
+        tableCells[slot] = index;
+        if(cells.size() * 2 > table.size()) {
+            // at most half full, probes stay short
+            std::vector<std::uint64_t> keys(table.size() * 2, emptyKey);
+            std::vector<std::uint32_t> values(keys.size(), 0);
+            table.swap(keys);
+            tableCells.swap(values);
+            for(std::size_t i = 0; i < keys.size(); i++) {
+                if(keys[i] != emptyKey) {
+                    std::size_t s = slotOf(keys[i]);
+                    while(table[s] != emptyKey) {
+                        s = (s + 1) & (table.size() - 1);
+                    }
+                    table[s] = keys[i];
+                    tableCells[s] = values[i];
+                }
+            }
+        }
+        return index;
+    }
+
+    void removeFromCell(const Link& link)
+    {
+        std::vector<std::uint32_t>& objects = cells[link.cell].objects;
+        const std::uint32_t last = objects.back();
+        objects[link.slot] = last;
+        links[last].slot = link.slot;
+        objects.pop_back();
+    }
+
+    // A cell's objects have their centers in it, their boxes in this.
+    Bounds looseBounds(const Cell& cell) const
+    {
+        const glm::vec3 low = glm::vec3(cell.coordinates) * cellSize;
+        const float extent = maxExtent();
+        return { low - extent, low + cellSize + extent };
+    }
+
+    static bool contains(const Bounds& outer, const Bounds& inner)
+    {
+        return glm::all(glm::lessThanEqual(outer.low, inner.low)) && glm::all(glm::greaterThanEqual(outer.high, inner.high));
+    }
+
+    // Calls visit(cell, loose bounds) for the non empty cells whose loose
+    // bounds overlap query: the cells in its range or, when there are
+    // fewer, every cell.
+    template<typename Visit>
+    void visitCells(const Bounds& query, const Visit& visit) const
+    {
+        const float extent = maxExtent();
+        const glm::ivec3 first = cellOf(query.low - extent - cellSize);
+        const glm::ivec3 last = cellOf(query.high + extent);
+        const glm::dvec3 range = glm::dvec3(last - first) + 1.0;
+        if(range.x * range.y * range.z > double(cells.size())) {
+            for(const Cell& cell : cells) {
+                if(!cell.objects.empty()) {
+                    const Bounds loose = looseBounds(cell);
+                    if(glm::all(glm::lessThanEqual(loose.low, query.high)) && glm::all(glm::greaterThanEqual(loose.high, query.low))) {
+                        visit(cell, loose);
+                    }
+                }
+            }
+            return;
+        }
+        for(int z = first.z; z <= last.z; z++) {
+            for(int y = first.y; y <= last.y; y++) {
+                for(int x = first.x; x <= last.x; x++) {
+                    const std::uint32_t index = findCell(keyOf(glm::ivec3(x, y, z)));
+                    if(index == noCell || cells[index].objects.empty()) {
+                        continue;
+                    }
+                    const Bounds loose = looseBounds(cells[index]);
+                    if(glm::all(glm::lessThanEqual(loose.low, query.high)) && glm::all(glm::greaterThanEqual(loose.high, query.low))) {
+                        visit(cells[index], loose);
+                    }
+                }
+            }
+        }
+    }
+
+    static bool outsidePlanes(const Bounds& b, const glm::vec4* planes, std::uint32_t planeMask)
+    {
+        for(int p = 0; p < 6; p++) {
+            if((planeMask & (1u << p)) == 0) {
+                continue;
+            }
+            const glm::vec4& plane = planes[p];
+            const glm::vec3 far(plane.x > 0.0f ? b.high.x : b.low.x, plane.y > 0.0f ? b.high.y : b.low.y,
+                                plane.z > 0.0f ? b.high.z : b.low.z);
+            if(glm::dot(glm::vec3(plane), far) + plane.w < 0.0f) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Calls visit(cell, planes, planes still to test, frustum box) for the
+    // cells whose loose bounds are not outside the frustum, among those
+    // overlapping its box.
+    template<typename Visit>
+    void visitFrustum(const glm::mat4& viewProjection, const Visit& visit) const
+    {
+        const glm::mat4 m = glm::transpose(viewProjection);
+        const glm::vec4 planes[6] = { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] };
+
+        const glm::mat4 inverse = glm::inverse(viewProjection);
+        Bounds frustum = { glm::vec3(std::numeric_limits<float>::infinity()), glm::vec3(-std::numeric_limits<float>::infinity()) };
+        for(int corner = 0; corner < 8; corner++) {
+            const glm::vec4 point = inverse * glm::vec4(corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f, corner & 4 ? 1.0f : -1.0f, 1.0f);
+            frustum.low = glm::min(frustum.low, glm::vec3(point) / point.w);
+            frustum.high = glm::max(frustum.high, glm::vec3(point) / point.w);
+        }
+
+        visitCells(frustum, [&](const Cell& cell, const Bounds& loose) {
+            std::uint32_t planeMask = 0;
+            for(int p = 0; p < 6; p++) {
+                const glm::vec4& plane = planes[p];
+                const glm::vec3 normal(plane);
+                const glm::vec3 far(plane.x > 0.0f ? loose.high.x : loose.low.x, plane.y > 0.0f ? loose.high.y : loose.low.y,
+                                    plane.z > 0.0f ? loose.high.z : loose.low.z);
+                const glm::vec3 near(plane.x > 0.0f ? loose.low.x : loose.high.x, plane.y > 0.0f ? loose.low.y : loose.high.y,
+                                     plane.z > 0.0f ? loose.low.z : loose.high.z);
+                if(glm::dot(normal, far) + plane.w < 0.0f) {
+                    return;
+                }
+                planeMask |= glm::dot(normal, near) + plane.w >= 0.0f ? 0u : 1u << p;
+            }
+            visit(cell, planes, planeMask, frustum);
+        });
+    }
+
+    float cellSize;
+    float inverseCellSize;
+    unsigned int threads;
+    std::vector<Record> records;
+    std::vector<Link> links;
+    std::vector<std::uint32_t> queue;     // objects to move at commit, slots taken atomically
+    std::atomic<std::uint32_t> queued{ 0 };
+    std::atomic<std::uint32_t> maxExtentBits{ 0 };
+    std::vector<std::uint64_t> table;       // open addressing, cell keys
+    std::vector<std::uint32_t> tableCells;
+    std::vector<Cell> cells;
+};
+
+} // namespace gl
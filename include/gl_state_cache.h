@@ -0,0 +1,493 @@
+// GL state cache
+//
+// Shadows the state set through it (program, vertex array, buffers, uniform
+// buffer ranges, texture units, enable flags, polygon mode and viewport) and
+// drops the calls that would not change anything. State changed behind its
+// back must be reported with invalidate().
+//
+// Objects are passed as typed handles, so binding a buffer where a vertex
+// array is expected doesn't compile. Define GL_STATE_CACHE_DEBUG before
+// including this file to also assert that:
+// - handles were created by the cache for that object type,
+// - the shadowed state matches the driver before a call is dropped.
+//
+// Header only, include it after glad.
+
+#pragma once
+
+#include <cstdint>
+
+#ifdef GL_STATE_CACHE_DEBUG
+#include <cassert>
+#include <unordered_set>
+
+// The buffer bound to GL_TEXTURE_BUFFER, the GL 3.3 headers only have it as
+// GL_TEXTURE_BUFFER. GL_TEXTURE_BINDING_BUFFER is the texture bound there.
+#ifndef GL_TEXTURE_BUFFER_BINDING
+#define GL_TEXTURE_BUFFER_BINDING 0x8C2A
+#endif
+#endif
+
+namespace gl {
+
+template<typename Tag>
+struct Handle
+{
+    GLuint id = 0;
+
+    Handle() = default;
+    explicit Handle(GLuint name) : id(name) {}
+
+    bool operator==(Handle other) const { return id == other.id; }
+    bool operator!=(Handle other) const { return id != other.id; }
+};
+
+struct ProgramTag;
+struct VertexArrayTag;
+struct BufferTag;
+struct TextureTag;
+
+using Program = Handle<ProgramTag>;
+using VertexArray = Handle<VertexArrayTag>;
+using Buffer = Handle<BufferTag>;
+using Texture = Handle<TextureTag>;
+
+class StateCache
+{
+public:
+    static constexpr unsigned int maxTextureUnits = 16;
+    static constexpr unsigned int maxUniformBindings = 16;
+
+    StateCache() { invalidate(); }
+
+    // Forgets the shadowed state, the next change of each state is always issued.
+    void invalidate()
+    {
+        program = unknown;
+        vertexArray = unknown;
+        for(GLuint& binding : buffers) {
+            binding = unknown;
+        }
+        for(UniformRange& range : uniformRanges) {
+            range.buffer = unknown;
+        }
+        activeUnit = unknown;
+        for(auto& unit : textures) {
+            for(GLuint& binding : unit) {
+                binding = unknown;
+            }
+        }
+        for(std::uint8_t& flag : enables) {
+            flag = unknownFlag;
+        }
+        polygon = unknown;
+        viewportRect[0] = viewportRect[1] = viewportRect[2] = viewportRect[3] = -1;
+    }
+
+    // Object creation, in debug mode the cache remembers the type of each name.
+    Program createProgram()
+    {
+        Program p(glCreateProgram());
+#ifdef GL_STATE_CACHE_DEBUG
+        programs.insert(p.id);
+#endif
+        return p;
+    }
+
+    VertexArray createVertexArray()
+    {
+        VertexArray v;
+        glGenVertexArrays(1, &v.id);
+#ifdef GL_STATE_CACHE_DEBUG
+        vertexArrays.insert(v.id);
+#endif
+        return v;
+    }
+
+    Buffer createBuffer()
+    {
+        Buffer b;
+        glGenBuffers(1, &b.id);
+#ifdef GL_STATE_CACHE_DEBUG
+        bufferNames.insert(b.id);
+#endif
+        return b;
+    }
+
+    Texture createTexture()
+    {
+        Texture t;
+        glGenTextures(1, &t.id);
+#ifdef GL_STATE_CACHE_DEBUG
+        textureNames.insert(t.id);
+#endif
+        return t;
+    }
+
+    // GL only flags the program in use for deletion, it stays in use until
+    // another program replaces it. The shadowed program is forgotten all
+    // the same, so the next useProgram() is issued even if GL has by then
+    // given the name to a new program.
+    void deleteProgram(Program p)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(p.id == 0 || programs.count(p.id));
+        programs.erase(p.id);
+#endif
+        if(program == p.id) {
+            program = unknown;
+        }
+        glDeleteProgram(p.id);
+    }
+
+    // GL unbinds a deleted vertex array, buffer or texture from the binding
+    // points of the context. The shadowed bindings holding its name are
+    // forgotten, so the next bind is issued even if GL has by then given
+    // the name to a new object.
+    void deleteVertexArray(VertexArray v)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(v.id == 0 || vertexArrays.count(v.id));
+        vertexArrays.erase(v.id);
+#endif
+        if(v.id != 0 && vertexArray == v.id) {
+            vertexArray = unknown;
+            buffers[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = unknown;
+        }
+        glDeleteVertexArrays(1, &v.id);
+    }
+
+    void deleteBuffer(Buffer b)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(b.id == 0 || bufferNames.count(b.id));
+        bufferNames.erase(b.id);
+#endif
+        if(b.id != 0) {
+            for(GLuint& binding : buffers) {
+                if(binding == b.id) {
+                    binding = unknown;
+                }
+            }
+            for(UniformRange& range : uniformRanges) {
+                if(range.buffer == b.id) {
+                    range.buffer = unknown;
+                }
+            }
+        }
+        glDeleteBuffers(1, &b.id);
+    }
+
+    void deleteTexture(Texture t)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(t.id == 0 || textureNames.count(t.id));
+        textureNames.erase(t.id);
+#endif
+        if(t.id != 0) {
+            for(auto& unit : textures) {
+                for(GLuint& binding : unit) {
+                    if(binding == t.id) {
+                        binding = unknown;
+                    }
+                }
+            }
+        }
+        glDeleteTextures(1, &t.id);
+    }
+
+    void useProgram(Program p)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(p.id == 0 || programs.count(p.id));
+        checkInteger(GL_CURRENT_PROGRAM, program);
+#endif
+        if(count(program != p.id)) {
+            glUseProgram(p.id);
+            program = p.id;
+        }
+    }
+
+    void bindVertexArray(VertexArray v)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(v.id == 0 || vertexArrays.count(v.id));
+        checkInteger(GL_VERTEX_ARRAY_BINDING, vertexArray);
+#endif
+        if(count(vertexArray != v.id)) {
+            glBindVertexArray(v.id);
+            vertexArray = v.id;
+            // the element array buffer binding belongs to the vertex array
+            buffers[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = unknown;
+        }
+    }
+
+    void bindBuffer(GLenum target, Buffer b)
+    {
+        int index = bufferIndex(target);
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(b.id == 0 || bufferNames.count(b.id));
+        if(index >= 0) {
+            checkInteger(bufferQueries[index], buffers[index]);
+        }
+#endif
+        if(index < 0) {
+            glBindBuffer(target, b.id);
+            issued++;
+        }
+        else if(count(buffers[index] != b.id)) {
+            glBindBuffer(target, b.id);
+            buffers[index] = b.id;
+        }
+    }
+
+    // Binds a range of b to an indexed binding point, which binds b to the
+    // target too. Uniform buffer binding points are shadowed.
+    void bindBufferRange(GLenum target, GLuint binding, Buffer b, GLintptr offset, GLsizeiptr size)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(b.id == 0 || bufferNames.count(b.id));
+#endif
+        if(target == GL_UNIFORM_BUFFER && binding < maxUniformBindings) {
+            UniformRange& range = uniformRanges[binding];
+            if(!count(range.buffer != b.id || range.offset != offset || range.size != size)) {
+                return;
+            }
+            range = { b.id, offset, size };
+        }
+        else {
+            issued++;
+        }
+        glBindBufferRange(target, binding, b.id, offset, size);
+        const int index = bufferIndex(target);
+        if(index >= 0) {
+            buffers[index] = b.id;
+        }
+    }
+
+    // Binds t to the given texture unit, selecting the unit only when needed.
+    // Bindings of the first maxTextureUnits units are shadowed, the others
+    // are always issued.
+    void bindTexture(unsigned int unit, GLenum target, Texture t)
+    {
+        int index = unit < maxTextureUnits ? textureIndex(target) : -1;
+#ifdef GL_STATE_CACHE_DEBUG
+        assert(t.id == 0 || textureNames.count(t.id));
+#endif
+        if(index >= 0 && textures[unit][index] == t.id) {
+            skipped++;
+            return;
+        }
+        activeTexture(unit);
+#ifdef GL_STATE_CACHE_DEBUG
+        if(index >= 0) {
+            checkInteger(textureQueries[index], textures[unit][index]);
+        }
+#endif
+        glBindTexture(target, t.id);
+        issued++;
+        if(index >= 0) {
+            textures[unit][index] = t.id;
+        }
+    }
+
+    void activeTexture(unsigned int unit)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        checkInteger(GL_ACTIVE_TEXTURE, activeUnit == unknown ? unknown : GL_TEXTURE0 + activeUnit);
+#endif
+        if(count(activeUnit != unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+            activeUnit = unit;
+        }
+    }
+
+    void enable(GLenum cap) { setEnabled(cap, true); }
+    void disable(GLenum cap) { setEnabled(cap, false); }
+
+    void setEnabled(GLenum cap, bool enabled)
+    {
+        int index = capIndex(cap);
+#ifdef GL_STATE_CACHE_DEBUG
+        if(index >= 0 && enables[index] != unknownFlag) {
+            assert(glIsEnabled(cap) == (enables[index] != 0));
+        }
+#endif
+        if(index >= 0 && enables[index] == std::uint8_t(enabled)) {
+            skipped++;
+            return;
+        }
+        if(enabled) {
+            glEnable(cap);
+        }
+        else {
+            glDisable(cap);
+        }
+        issued++;
+        if(index >= 0) {
+            enables[index] = std::uint8_t(enabled);
+        }
+    }
+
+    // Core profile only accepts GL_FRONT_AND_BACK.
+    void polygonMode(GLenum mode)
+    {
+#ifdef GL_STATE_CACHE_DEBUG
+        if(polygon != unknown) {
+            GLint modes[2];
+            glGetIntegerv(GL_POLYGON_MODE, modes);
+            assert(GLuint(modes[0]) == polygon);
+        }
+#endif
+        if(count(polygon != mode)) {
+            glPolygonMode(GL_FRONT_AND_BACK, mode);
+            polygon = mode;
+        }
+    }
+
+    void viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        const GLint rect[4] = { x, y, width, height };
+        bool same = true;
+        for(int i = 0; i < 4; i++) {
+            same = same && viewportRect[i] == rect[i];
+        }
+#ifdef GL_STATE_CACHE_DEBUG
+        if(viewportRect[2] >= 0) {
+            GLint current[4];
+            glGetIntegerv(GL_VIEWPORT, current);
+            for(int i = 0; i < 4; i++) {
+                assert(current[i] == viewportRect[i]);
+            }
+        }
+#endif
+        if(count(!same)) {
+            glViewport(x, y, width, height);
+            for(int i = 0; i < 4; i++) {
+                viewportRect[i] = rect[i];
+            }
+        }
+    }
+
+    // Calls issued to GL and calls dropped since the last resetCounters().
+    unsigned long issuedCalls() const { return issued; }
+    unsigned long skippedCalls() const { return skipped; }
+    void resetCounters() { issued = skipped = 0; }
+
+private:
+    static constexpr GLuint unknown = 0xffffffffu;
+    static constexpr std::uint8_t unknownFlag = 0xff;
+    static constexpr int bufferTargets = 8;
+    static constexpr int textureTargets = 7;
+    static constexpr int caps = 12;
+
+    struct UniformRange
+    {
+        GLuint buffer;
+        GLintptr offset;
+        GLsizeiptr size;
+    };
+
+    static int bufferIndex(GLenum target)
+    {
+        switch(target) {
+            case GL_ARRAY_BUFFER: return 0;
+            case GL_ELEMENT_ARRAY_BUFFER: return 1;
+            case GL_UNIFORM_BUFFER: return 2;
+            case GL_COPY_READ_BUFFER: return 3;
+            case GL_COPY_WRITE_BUFFER: return 4;
+            case GL_PIXEL_PACK_BUFFER: return 5;
+            case GL_PIXEL_UNPACK_BUFFER: return 6;
+            case GL_TEXTURE_BUFFER: return 7;
+            default: return -1;
+        }
+    }
+
+    static int textureIndex(GLenum target)
+    {
+        switch(target) {
+            case GL_TEXTURE_1D: return 0;
+            case GL_TEXTURE_2D: return 1;
+            case GL_TEXTURE_3D: return 2;
+            case GL_TEXTURE_1D_ARRAY: return 3;
+            case GL_TEXTURE_2D_ARRAY: return 4;
+            case GL_TEXTURE_CUBE_MAP: return 5;
+            case GL_TEXTURE_RECTANGLE: return 6;
+            default: return -1;
+        }
+    }
+
+    static int capIndex(GLenum cap)
+    {
+        switch(cap) {
+            case GL_DEPTH_TEST: return 0;
+            case GL_BLEND: return 1;
+            case GL_CULL_FACE: return 2;
+            case GL_SCISSOR_TEST: return 3;
+            case GL_STENCIL_TEST: return 4;
+            case GL_POLYGON_OFFSET_FILL: return 5;
+            case GL_POLYGON_OFFSET_LINE: return 6;
+            case GL_MULTISAMPLE: return 7;
+            case GL_SAMPLE_ALPHA_TO_COVERAGE: return 8;
+            case GL_FRAMEBUFFER_SRGB: return 9;
+            case GL_PROGRAM_POINT_SIZE: return 10;
+            case GL_DEPTH_CLAMP: return 11;
+            default: return -1;
+        }
+    }
+
+    // Counts a state change, returns whether the call has to be issued.
+    bool count(bool changed)
+    {
+        if(changed) {
+            issued++;
+        }
+        else {
+            skipped++;
+        }
+        return changed;
+    }
+
+#ifdef GL_STATE_CACHE_DEBUG
+    static constexpr GLenum bufferQueries[bufferTargets] = {
+        GL_ARRAY_BUFFER_BINDING, GL_ELEMENT_ARRAY_BUFFER_BINDING, GL_UNIFORM_BUFFER_BINDING,
+        GL_COPY_READ_BUFFER_BINDING, GL_COPY_WRITE_BUFFER_BINDING, GL_PIXEL_PACK_BUFFER_BINDING,
+        GL_PIXEL_UNPACK_BUFFER_BINDING, GL_TEXTURE_BUFFER_BINDING
+    };
+    static constexpr GLenum textureQueries[textureTargets] = {
+        GL_TEXTURE_BINDING_1D, GL_TEXTURE_BINDING_2D, GL_TEXTURE_BINDING_3D,
+        GL_TEXTURE_BINDING_1D_ARRAY, GL_TEXTURE_BINDING_2D_ARRAY,
+        GL_TEXTURE_BINDING_CUBE_MAP, GL_TEXTURE_BINDING_RECTANGLE
+    };
+
+    // Asserts that the driver agrees with a known shadowed value.
+    static void checkInteger(GLenum query, GLuint shadow)
+    {
+        if(shadow != unknown) {
+            GLint value = 0;
+            glGetIntegerv(query, &value);
+            assert(GLuint(value) == shadow);
+        }
+    }
+
+    std::unordered_set<GLuint> programs;
+    std::unordered_set<GLuint> vertexArrays;
+    std::unordered_set<GLuint> bufferNames;
+    std::unordered_set<GLuint> textureNames;
+#endif
+
+    GLuint program;
+    GLuint vertexArray;
+    GLuint buffers[bufferTargets];
+    UniformRange uniformRanges[maxUniformBindings];
+    GLuint activeUnit;
+    GLuint textures[maxTextureUnits][textureTargets];
+    std::uint8_t enables[caps];
+    GLuint polygon;
+    GLint viewportRect[4];
+
+    unsigned long issued = 0;
+    unsigned long skipped = 0;
+};
+
+} // namespace gl
@@ -0,0 +1,205 @@
+// Streaming buffer
+//
+// One buffer split into frameLatency regions for data rewritten every frame
+// (particles, debug lines, UI). Each frame writes to the next region, which
+// the GPU finished reading when its fence, placed frameLatency - 1 frames
+// earlier, is signaled. Only the wait for that fence can stall, never the
+// upload itself.
+//
+// With GL_ARB_buffer_storage (core in 4.4) the buffer is mapped once,
+// persistently and coherently. On 3.3 each region is mapped in begin() with
+// GL_MAP_UNSYNCHRONIZED_BIT, the fences doing the synchronization instead of
+// the driver, and unmapped in commit() since 3.3 can't draw from a mapped
+// buffer.
+//
+// allocate() may be called from any thread between begin() and commit(), it
+// is a compare and swap on the region head. Everything else is GL and
+// belongs to the thread owning the context.
+//
+// Header only, include it after glad and gl_state_cache.h.
+//
+//     gl::StreamBuffer stream;
+//     stream.init(glState, GL_ARRAY_BUFFER, 4 << 20);
+//     while(...) {
+//         stream.begin(glState);
+//         gl::StreamBuffer::Allocation lines = stream.allocate(size);  // any thread
+//         memcpy(lines.data, ...);
+//         stream.commit(glState);
+//         glDrawArrays(...) with attributes at lines.offset
+//         stream.end();
+//     }
+//     stream.release(glState);
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace gl {
+
+class StreamBuffer
+{
+public:
+    static constexpr unsigned int frameLatency = 3;
+    // region starts are aligned for any use, uniform buffer ranges included
+    static constexpr std::size_t regionAlignment = 256;
+
+    struct Allocation
+    {
+        void* data = nullptr;     // where to write, nullptr if the region is full
+        GLintptr offset = 0;      // offset of data in buffer()
+    };
+
+    StreamBuffer() = default;
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    // Creates the buffer, frameLatency regions of bytesPerFrame bytes.
+    // usePersistent = false forces the 3.3 path, e.g. to compare both. If
+    // the persistent mapping fails, the buffer is created again for the 3.3
+    // path, persistentlyMapped() tells which one is used. Returns false if
+    // the buffer couldn't be allocated.
+    bool init(StateCache& state, GLenum target, std::size_t bytesPerFrame, bool usePersistent = true)
+    {
+        bufferTarget = target;
+        regionSize = (bytesPerFrame + regionAlignment - 1) / regionAlignment * regionAlignment;
+        persistent = usePersistent && GLAD_GL_ARB_buffer_storage;
+
+        handle = state.createBuffer();
+        state.bindBuffer(target, handle);
+        const GLsizeiptr size = GLsizeiptr(frameLatency * regionSize);
+        if(persistent) {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(target, size, nullptr, flags);
+            mapped = static_cast<unsigned char*>(glMapBufferRange(target, 0, size, flags));
+            if(mapped != nullptr) {
+                return true;
+            }
+            // buffer storage is immutable, glBufferData needs a new buffer
+            persistent = false;
+            state.deleteBuffer(handle);
+            handle = state.createBuffer();
+            state.bindBuffer(target, handle);
+        }
+        glBufferData(target, size, nullptr, GL_STREAM_DRAW);
+        GLint64 allocated = 0;
+        glGetBufferParameteri64v(target, GL_BUFFER_SIZE, &allocated);
+        return allocated == size;
+    }
+
+    // Deletes the buffer and the fences, the buffer can be initialized again.
+    void release(StateCache& state)
+    {
+        for(GLsync& fence : fences) {
+            if(fence != nullptr) {
+                glDeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+        state.deleteBuffer(handle);
+        handle = Buffer();
+        mapped = nullptr;
+        regionData = nullptr;
+    }
+
+    Buffer buffer() const { return handle; }
+    bool persistentlyMapped() const { return persistent; }
+    std::size_t bytesPerFrame() const { return regionSize; }
+
+    // Moves to the next region, waiting for the GPU if it still reads it.
+    void begin(StateCache& state)
+    {
+        region = (region + 1) % frameLatency;
+        head.store(0, std::memory_order_relaxed);
+
+        GLsync& fence = fences[region];
+        if(fence != nullptr) {
+            if(glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                const auto start = std::chrono::steady_clock::now();
+                while(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {
+                }
+                stallNs += std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+                stalls++;
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        if(persistent) {
+            regionData = mapped + region * regionSize;
+        }
+        else {
+            state.bindBuffer(bufferTarget, handle);
+            regionData = static_cast<unsigned char*>(glMapBufferRange(bufferTarget, GLintptr(region * regionSize), GLsizeiptr(regionSize),
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+        }
+    }
+
+    // Reserves size bytes in the current region, alignment must be a power
+    // of two no larger than regionAlignment. Lock free, callable from any
+    // thread.
+    Allocation allocate(std::size_t size, std::size_t alignment = 16)
+    {
+        Allocation allocation;
+        std::size_t start = head.load(std::memory_order_relaxed);
+        std::size_t aligned;
+        do {
+            aligned = (start + alignment - 1) & ~(alignment - 1);
+            if(regionData == nullptr || aligned + size > regionSize) {
+                failed.fetch_add(1, std::memory_order_relaxed);
+                return allocation;
+            }
+        } while(!head.compare_exchange_weak(start, aligned + size, std::memory_order_relaxed));
+
+        allocation.data = regionData + aligned;
+        allocation.offset = GLintptr(region * regionSize + aligned);
+        return allocation;
+    }
+
+    // Ends the writes of the frame, before the draws that read them.
+    void commit(StateCache& state)
+    {
+        streamed += head.load(std::memory_order_relaxed);
+        if(!persistent && regionData != nullptr) {
+            state.bindBuffer(bufferTarget, handle);
+            glUnmapBuffer(bufferTarget);
+        }
+        regionData = nullptr;
+    }
+
+    // Fences the region after the last draw reading it.
+    void end()
+    {
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    // Frames that waited for the GPU in begin(), and the time spent waiting.
+    unsigned long stalledFrames() const { return stalls; }
+    std::uint64_t stallNanoseconds() const { return stallNs; }
+
+    // Bytes reserved over all frames, and allocations refused for lack of room.
+    std::uint64_t streamedBytes() const { return streamed; }
+    unsigned long failedAllocations() const { return failed.load(std::memory_order_relaxed); }
+
+private:
+    GLenum bufferTarget = GL_ARRAY_BUFFER;
+    Buffer handle;
+    bool persistent = false;
+    unsigned char* mapped = nullptr;
+    std::size_t regionSize = 0;
+
+    unsigned int region = 0;
+    unsigned char* regionData = nullptr;
+    std::atomic<std::size_t> head{ 0 };
+    GLsync fences[frameLatency] = {};
+
+    unsigned long stalls = 0;
+    std::uint64_t stallNs = 0;
+    std::uint64_t streamed = 0;
+    std::atomic<unsigned long> failed{ 0 };
+};
+
+} // namespace gl
@@ -0,0 +1,325 @@
+// Vertex format compiler
+//
+// Quantizes float vertex attributes into a compact interleaved layout and
+// describes it as the matching glVertexAttribPointer calls. Encodings, with
+// their size and the largest error they add:
+//
+//     position   Float    12 bytes
+//                Half      8 bytes  2^-11 relative
+//                Unorm16   8 bytes  extent / 131070 per axis, relative to the bounding box
+//     texCoord   Float     8 bytes
+//                Half      4 bytes  2^-11 relative
+//                Unorm16   4 bytes  1 / 131070, coordinates in [0, 1]
+//     normal     Float    12 bytes
+//                Snorm10   4 bytes  1 / 1022 per component, GL_INT_2_10_10_10_REV
+//                Octahedral 4 bytes 0.004 degree, two normalized shorts
+//
+// The normal bounds assume the GL 4.2 rule for normalized signed integers,
+// c / (2^(b-1) - 1). GL 3.3 to 4.1, macOS included, decode (2c + 1) / (2^b - 1)
+// instead, which has no exact zero and puts those normals off by up to
+// 3 / 1023 per component and 0.01 degree. VertexFormat::legacySnorm encodes
+// them for that rule, back to 1 / 1023 and 0.004 degree, with scalar code
+// rather than the batch kernels.
+//
+// Half, Unorm16 and Snorm10 are decoded by the vertex fetch, the shader is
+// unchanged, except that Unorm16 positions are in [0, 1] over the bounding
+// box and have to be mapped back:
+//
+//     uniform vec3 positionOffset;   // CompiledVertices::positionOffset
+//     uniform vec3 positionScale;    // CompiledVertices::positionScale
+//     vec3 position = positionOffset + positionScale * aPos;
+//
+// and Octahedral normals arrive as a vec2 to unfold:
+//
+//     vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+//     if(n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+//     n = normalize(n);
+//
+// Every attribute is gathered into a contiguous array, packed by the SIMD
+// loops of GLM_GTX_packing_batch, then scattered into the interleaved
+// vertices, each attribute starting on 4 bytes.
+//
+// Header only, include it after glad and gl_state_cache.h, with
+// GLM_ENABLE_EXPERIMENTAL defined.
+//
+//     gl::VertexFormat format;
+//     format.position = gl::PositionEncoding::Half;
+//     format.texCoord = gl::TexCoordEncoding::Unorm16;
+//     gl::CompiledVertices compiled = gl::compileVertices(source, format);
+//     glBufferData(GL_ARRAY_BUFFER, compiled.data.size(), compiled.data.data(), GL_STATIC_DRAW);
+//     compiled.setAttributes(glState, vbo);
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/packing_batch.hpp>
+
+namespace gl {
+
+enum class PositionEncoding { Float, Half, Unorm16 };
+enum class TexCoordEncoding { None, Float, Half, Unorm16 };
+enum class NormalEncoding { None, Float, Snorm10, Octahedral };
+
+struct VertexFormat
+{
+    PositionEncoding position = PositionEncoding::Float;
+    TexCoordEncoding texCoord = TexCoordEncoding::Float;
+    NormalEncoding normal = NormalEncoding::None;
+
+    GLuint positionLocation = 0;
+    GLuint texCoordLocation = 1;
+    GLuint normalLocation = 2;
+
+    // Encode Snorm10 and Octahedral normals for contexts before GL 4.2.
+    bool legacySnorm = false;
+};
+
+// Float attributes of count vertices. Each pointer is read every stride
+// floats, texCoords and normals may be null when the format doesn't use them.
+struct VertexSource
+{
+    const GLfloat* positions = nullptr;
+    const GLfloat* texCoords = nullptr;
+    const GLfloat* normals = nullptr;
+    std::size_t count = 0;
+    std::size_t stride = 0;
+};
+
+struct VertexAttribute
+{
+    GLuint location;
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    GLuint offset;
+};
+
+struct CompiledVertices
+{
+    std::vector<unsigned char> data;
+    GLsizei stride = 0;
+    std::vector<VertexAttribute> attributes;
+
+    // position = positionOffset + positionScale * attribute, identity unless
+    // the position is Unorm16
+    glm::vec3 positionOffset = glm::vec3(0.0f);
+    glm::vec3 positionScale = glm::vec3(1.0f);
+
+    std::size_t vertexCount() const { return stride > 0 ? data.size() / std::size_t(stride) : 0; }
+
+    // Points the attributes of the bound vertex array at buffer, which holds data.
+    void setAttributes(StateCache& state, Buffer buffer) const
+    {
+        state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+        for(const VertexAttribute& attribute : attributes) {
+            glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized,
+                                  stride, reinterpret_cast<const void*>(std::uintptr_t(attribute.offset)));
+            glEnableVertexAttribArray(attribute.location);
+        }
+    }
+};
+
+namespace detail {
+
+// Copies components floats of every vertex into a contiguous array of
+// padded floats per vertex, padding with zeros.
+inline void gatherVertexAttribute(const VertexSource& source, const GLfloat* attribute, unsigned int components,
+                                  unsigned int padded, std::vector<float>& out)
+{
+    out.assign(source.count * padded, 0.0f);
+    for(std::size_t i = 0; i < source.count; i++) {
+        for(unsigned int c = 0; c < components; c++) {
+            out[i * padded + c] = attribute[i * source.stride + c];
+        }
+    }
+}
+
+// The signed normalized integer of bits bits that GL before 4.2 decodes
+// closest to x, as (2c + 1) / (2^bits - 1), in the low bits.
+inline std::uint32_t packLegacySnorm(float x, unsigned int bits)
+{
+    const float max = float((1u << bits) - 1u);
+    const float c = std::nearbyint((glm::clamp(x, -1.0f, 1.0f) * max - 1.0f) * 0.5f);
+    return std::uint32_t(std::int32_t(c)) & ((1u << bits) - 1u);
+}
+
+inline std::uint32_t packLegacySnorm3x10(const glm::vec3& n)
+{
+    return packLegacySnorm(n.x, 10) | packLegacySnorm(n.y, 10) << 10 | packLegacySnorm(n.z, 10) << 20;
+}
+
+inline std::uint32_t packLegacyOctahedral(const glm::vec3& n)
+{
+    const glm::vec2 p = glm::packOctahedral(n);
+    return packLegacySnorm(p.x, 16) | packLegacySnorm(p.y, 16) << 16;
+}
+
+// Copies size bytes per vertex from the contiguous packed array into the
+// interleaved vertices at offset.
+inline void scatterVertexAttribute(const void* packed, std::size_t size, std::size_t count,
+                                   CompiledVertices& compiled, GLuint offset)
+{
+    const unsigned char* from = static_cast<const unsigned char*>(packed);
+    unsigned char* to = compiled.data.data() + offset;
+    for(std::size_t i = 0; i < count; i++) {
+        std::memcpy(to + i * std::size_t(compiled.stride), from + i * size, size);
+    }
+}
+
+} // namespace detail
+
+inline CompiledVertices compileVertices(const VertexSource& source, const VertexFormat& format)
+{
+    CompiledVertices compiled;
+    const std::size_t count = source.count;
+
+    // layout first: every attribute is a multiple of 4 bytes, so each one
+    // and the stride stay aligned
+    GLuint offset = 0;
+    const GLuint positionOffset = offset;
+    switch(format.position) {
+    case PositionEncoding::Float:
+        compiled.attributes.push_back({ format.positionLocation, 3, GL_FLOAT, GL_FALSE, offset });
+        offset += 12;
+        break;
+    case PositionEncoding::Half:
+        compiled.attributes.push_back({ format.positionLocation, 3, GL_HALF_FLOAT, GL_FALSE, offset });
+        offset += 8;
+        break;
+    case PositionEncoding::Unorm16:
+        compiled.attributes.push_back({ format.positionLocation, 3, GL_UNSIGNED_SHORT, GL_TRUE, offset });
+        offset += 8;
+        break;
+    }
+
+    const GLuint texCoordOffset = offset;
+    switch(format.texCoord) {
+    case TexCoordEncoding::None:
+        break;
+    case TexCoordEncoding::Float:
+        compiled.attributes.push_back({ format.texCoordLocation, 2, GL_FLOAT, GL_FALSE, offset });
+        offset += 8;
+        break;
+    case TexCoordEncoding::Half:
+        compiled.attributes.push_back({ format.texCoordLocation, 2, GL_HALF_FLOAT, GL_FALSE, offset });
+        offset += 4;
+        break;
+    case TexCoordEncoding::Unorm16:
+        compiled.attributes.push_back({ format.texCoordLocation, 2, GL_UNSIGNED_SHORT, GL_TRUE, offset });
+        offset += 4;
+        break;
+    }
+
+    const GLuint normalOffset = offset;
+    switch(format.normal) {
+    case NormalEncoding::None:
+        break;
+    case NormalEncoding::Float:
+        compiled.attributes.push_back({ format.normalLocation, 3, GL_FLOAT, GL_FALSE, offset });
+        offset += 12;
+        break;
+    case NormalEncoding::Snorm10:
+        // 2_10_10_10 formats only exist with 4 components, w is 0
+        compiled.attributes.push_back({ format.normalLocation, 4, GL_INT_2_10_10_10_REV, GL_TRUE, offset });
+        offset += 4;
+        break;
+    case NormalEncoding::Octahedral:
+        compiled.attributes.push_back({ format.normalLocation, 2, GL_SHORT, GL_TRUE, offset });
+        offset += 4;
+        break;
+    }
+
+    compiled.stride = GLsizei(offset);
+    compiled.data.assign(count * offset, 0);
+
+    std::vector<float> staging;
+    std::vector<glm::uint16> packed16;
+
+    // positions, padded to 4 floats for the 16 bit encodings
+    if(format.position == PositionEncoding::Float) {
+        detail::gatherVertexAttribute(source, source.positions, 3, 3, staging);
+        detail::scatterVertexAttribute(staging.data(), 12, count, compiled, positionOffset);
+    }
+    else {
+        detail::gatherVertexAttribute(source, source.positions, 3, 4, staging);
+        packed16.resize(staging.size());
+        if(format.position == PositionEncoding::Half) {
+            glm::batchPackHalf(staging.data(), packed16.data(), 0, staging.size());
+        }
+        else {
+            glm::vec3 low(0.0f), high(0.0f);
+            for(std::size_t i = 0; i < count; i++) {
+                const glm::vec3 p(staging[i * 4], staging[i * 4 + 1], staging[i * 4 + 2]);
+                low = i == 0 ? p : glm::min(low, p);
+                high = i == 0 ? p : glm::max(high, p);
+            }
+            glm::vec3 extent = high - low;
+            for(int c = 0; c < 3; c++) {
+                extent[c] = extent[c] > 0.0f ? extent[c] : 1.0f;
+            }
+            compiled.positionOffset = low;
+            compiled.positionScale = extent;
+
+            const glm::vec4 scale(1.0f / extent, 0.0f);
+            const glm::vec4 bias(-low / extent, 0.0f);
+            glm::batchPackUnorm16(staging.data(), scale, bias, packed16.data(), 0, staging.size());
+        }
+        detail::scatterVertexAttribute(packed16.data(), 8, count, compiled, positionOffset);
+    }
+
+    // texture coordinates, two per vertex so Scale and Bias repeat
+    if(format.texCoord == TexCoordEncoding::Float) {
+        detail::gatherVertexAttribute(source, source.texCoords, 2, 2, staging);
+        detail::scatterVertexAttribute(staging.data(), 8, count, compiled, texCoordOffset);
+    }
+    else if(format.texCoord != TexCoordEncoding::None) {
+        detail::gatherVertexAttribute(source, source.texCoords, 2, 2, staging);
+        packed16.resize(staging.size());
+        if(format.texCoord == TexCoordEncoding::Half) {
+            glm::batchPackHalf(staging.data(), packed16.data(), 0, staging.size());
+        }
+        else {
+            glm::batchPackUnorm16(staging.data(), glm::vec4(1.0f), glm::vec4(0.0f), packed16.data(), 0, staging.size());
+        }
+        detail::scatterVertexAttribute(packed16.data(), 4, count, compiled, texCoordOffset);
+    }
+
+    // normals, renormalized since the encodings assume unit vectors
+    if(format.normal == NormalEncoding::Float) {
+        detail::gatherVertexAttribute(source, source.normals, 3, 3, staging);
+        detail::scatterVertexAttribute(staging.data(), 12, count, compiled, normalOffset);
+    }
+    else if(format.normal != NormalEncoding::None) {
+        std::vector<glm::vec3> normals(count);
+        for(std::size_t i = 0; i < count; i++) {
+            const GLfloat* n = source.normals + i * source.stride;
+            const glm::vec3 normal(n[0], n[1], n[2]);
+            const float length = glm::length(normal);
+            normals[i] = length > 0.0f ? normal / length : glm::vec3(0.0f, 0.0f, 1.0f);
+        }
+        std::vector<glm::uint32> packed32(count);
+        if(format.legacySnorm) {
+            const bool snorm10 = format.normal == NormalEncoding::Snorm10;
+            for(std::size_t i = 0; i < count; i++) {
+                packed32[i] = snorm10 ? detail::packLegacySnorm3x10(normals[i]) : detail::packLegacyOctahedral(normals[i]);
+            }
+        }
+        else if(format.normal == NormalEncoding::Snorm10) {
+            glm::batchPackSnorm3x10_1x2(normals.data(), packed32.data(), 0, count);
+        }
+        else {
+            glm::batchPackOctahedral(normals.data(), packed32.data(), 0, count);
+        }
+        detail::scatterVertexAttribute(packed32.data(), 4, count, compiled, normalOffset);
+    }
+
+    return compiled;
+}
+
+} // namespace gl
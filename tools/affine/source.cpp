@@ -0,0 +1,188 @@
+// Measures the affine inverses of GLM_GTX_matrix_affine and their batched
+// forms from GLM_GTX_matrix_batch against glm::inverse, on random
+// transforms of three kinds:
+// - rigid: a rotation and a translation,
+// - scaled: a rotation, a non-uniform scale of 0.1 to 10 and a translation,
+// - sheared: any affine transform, only affineInverse applies.
+//
+// The error of a result is the largest difference from the inverse computed
+// in double, relative to the largest element of that inverse; the worst over
+// all transforms is printed with the time per matrix, best of a few runs.
+// Normal matrices are compared with inverseTranspose of the upper 3x3.
+//
+//     affine [--count n] [--runs n]
+
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtx/matrix_affine.hpp>
+#include <glm/gtx/matrix_batch.hpp>
+
+#include "../common/bench.h"
+
+enum Kind { rigid, scaled, sheared };
+
+glm::mat4 randomTransform(Random& random, Kind kind)
+{
+    glm::vec3 axis = random.vector(-1.0f, 1.0f);
+    if(glm::dot(axis, axis) < 1e-4f) {
+        axis = glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+    glm::mat4 m = glm::translate(glm::mat4(1.0f), random.vector(-100.0f, 100.0f));
+    m = glm::rotate(m, random.range(-3.14159f, 3.14159f), glm::normalize(axis));
+    if(kind == scaled) {
+        m = glm::scale(m, glm::exp(random.vector(std::log(0.1f), std::log(10.0f))));
+    }
+    else if(kind == sheared) {
+        // columns well away from degenerate
+        for(int c = 0; c < 3; c++) {
+            m[c] = glm::vec4(glm::vec3(m[c]) + random.vector(-0.5f, 0.5f), 0.0f);
+        }
+    }
+    return m;
+}
+
+template<glm::length_t N>
+double relativeError(const glm::mat<N, N, float>& m, const glm::mat<N, N, double>& reference)
+{
+    double largest = 0.0, difference = 0.0;
+    for(glm::length_t c = 0; c < N; c++) {
+        for(glm::length_t r = 0; r < N; r++) {
+            largest = std::max(largest, std::abs(reference[c][r]));
+            difference = std::max(difference, std::abs(double(m[c][r]) - reference[c][r]));
+        }
+    }
+    return difference / largest;
+}
+
+// Runs function on every matrix, best of runs, in ns per matrix.
+template<typename Function>
+double measure(std::size_t count, int runs, Function function)
+{
+    double best = 1e30;
+    for(int run = 0; run < runs; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ns / double(count));
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 100000;
+    int runs = 5;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: affine [--count n] [--runs n]\n");
+            return 1;
+        }
+    }
+
+    const char* isa[] = { "scalar", "SSE2", "AVX2/FMA" };
+    std::printf("%zu transforms of each kind, batch kernels: %s, best of %d\n", count, isa[glm::batchIsa()], runs);
+    std::printf("%-8s %-26s %12s %12s\n", "", "", "max error", "time");
+
+    const char* kindNames[] = { "rigid", "scaled", "sheared" };
+    Random random;
+    std::vector<glm::mat4> in(count), out(count);
+    std::vector<glm::mat3> normals(count);
+    std::vector<glm::dmat4> references(count);
+    std::vector<glm::dmat3> normalReferences(count);
+    for(int kind = rigid; kind <= sheared; kind++) {
+        for(std::size_t i = 0; i < count; i++) {
+            in[i] = randomTransform(random, Kind(kind));
+            references[i] = glm::inverse(glm::dmat4(in[i]));
+            normalReferences[i] = glm::inverseTranspose(glm::dmat3(glm::dmat4(in[i])));
+        }
+
+        // a function and its batched form, on the matrices it applies to
+        struct Inverse
+        {
+            const char* name;
+            const char* batchName;
+            Kind most;
+            glm::mat4 (*single)(const glm::mat4&);
+            void (*batch)(const glm::mat4*, glm::mat4*, std::size_t);
+        };
+        const Inverse inverses[] = {
+            { "inverse", nullptr, sheared, [](const glm::mat4& m) { return glm::inverse(m); }, nullptr },
+            { "affineInverse", "batchAffineInverse", sheared, [](const glm::mat4& m) { return glm::affineInverse(m); },
+              [](const glm::mat4* a, glm::mat4* b, std::size_t n) { glm::batchAffineInverse(a, b, n); } },
+            { "scaledRigidInverse", "batchScaledRigidInverse", scaled,
+              [](const glm::mat4& m) { return glm::scaledRigidInverse(m); },
+              [](const glm::mat4* a, glm::mat4* b, std::size_t n) { glm::batchScaledRigidInverse(a, b, n); } },
+            { "rigidInverse", "batchRigidInverse", rigid, [](const glm::mat4& m) { return glm::rigidInverse(m); },
+              [](const glm::mat4* a, glm::mat4* b, std::size_t n) { glm::batchRigidInverse(a, b, n); } },
+        };
+        for(const Inverse& inverse : inverses) {
+            if(kind > inverse.most) {
+                continue;
+            }
+            for(int batched = 0; batched < 2; batched++) {
+                if(batched == 1 && inverse.batch == nullptr) {
+                    continue;
+                }
+                const double time = measure(count, runs, [&]() {
+                    if(batched == 1) {
+                        inverse.batch(in.data(), out.data(), count);
+                    }
+                    else {
+                        for(std::size_t i = 0; i < count; i++) {
+                            out[i] = inverse.single(in[i]);
+                        }
+                    }
+                });
+                double error = 0.0;
+                for(std::size_t i = 0; i < count; i++) {
+                    error = std::max(error, relativeError(out[i], references[i]));
+                }
+                std::printf("%-8s %-26s %12.1e %9.1f ns\n", kindNames[kind], batched == 1 ? inverse.batchName : inverse.name,
+                            error, time);
+            }
+        }
+
+        for(int batched = 0; batched < 3; batched++) {
+            const double time = measure(count, runs, [&]() {
+                if(batched == 2) {
+                    glm::batchNormalMatrix(in.data(), normals.data(), count);
+                }
+                else if(batched == 1) {
+                    for(std::size_t i = 0; i < count; i++) {
+                        normals[i] = glm::normalMatrix(in[i]);
+                    }
+                }
+                else {
+                    for(std::size_t i = 0; i < count; i++) {
+                        normals[i] = glm::inverseTranspose(glm::mat3(in[i]));
+                    }
+                }
+            });
+            double error = 0.0;
+            for(std::size_t i = 0; i < count; i++) {
+                error = std::max(error, relativeError(normals[i], normalReferences[i]));
+            }
+            const char* names[] = { "inverseTranspose", "normalMatrix", "batchNormalMatrix" };
+            std::printf("%-8s %-26s %12.1e %9.1f ns\n", kindNames[kind], names[batched], error, time);
+        }
+    }
+    return EXIT_SUCCESS;
+}
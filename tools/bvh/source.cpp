@@ -0,0 +1,231 @@
+// Measures the bounding volume hierarchy on random scenes of 10k, 1M and
+// 10M boxes: the time to build it and to refit it after every object
+// moved, frustum culls from random cameras and nearest hit ray casts.
+//
+// Objects are boxes of 0.5 to 3 units scattered in a cube whose side grows
+// with the count, so that the density stays that of a game level. Rays
+// start inside the scene in random directions, against the boxes and
+// against the spheres inscribed in them with glm::intersectRaySphere.
+//
+//     bvh [--count n] [--threads n] [--verify]
+//         --count measures a single scene of n objects
+//         --verify compares every query with a brute force loop over the
+//         objects, slow for more than 100k objects
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/intersect.hpp>
+
+#include <gl_bvh.h>
+
+#include "../common/bench.h"
+
+std::vector<gl::Bounds> generateScene(std::size_t count, float side, Random& random)
+{
+    std::vector<gl::Bounds> bounds(count);
+    for(gl::Bounds& b : bounds) {
+        b.low = random.vector(0.0f, side);
+        b.high = b.low + random.vector(0.5f, 3.0f);
+    }
+    return bounds;
+}
+
+bool intersectSphere(const gl::Bounds& b, const glm::vec3& origin, const glm::vec3& direction, float& distance)
+{
+    const glm::vec3 extent = b.high - b.low;
+    const float radius = std::min(std::min(extent.x, extent.y), extent.z) * 0.5f;
+    return glm::intersectRaySphere(origin, direction, (b.low + b.high) * 0.5f, radius * radius, distance);
+}
+
+// Same plane test as the hierarchy, on every object.
+void cullBruteForce(const std::vector<gl::Bounds>& bounds, const glm::mat4& viewProjection, std::vector<std::uint32_t>& visible)
+{
+    const glm::mat4 m = glm::transpose(viewProjection);
+    const glm::vec4 planes[6] = { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] };
+    for(std::size_t i = 0; i < bounds.size(); i++) {
+        bool outside = false;
+        for(const glm::vec4& plane : planes) {
+            const glm::vec3 far(plane.x > 0.0f ? bounds[i].high.x : bounds[i].low.x, plane.y > 0.0f ? bounds[i].high.y : bounds[i].low.y,
+                                plane.z > 0.0f ? bounds[i].high.z : bounds[i].low.z);
+            outside = outside || glm::dot(glm::vec3(plane), far) + plane.w < 0.0f;
+        }
+        if(!outside) {
+            visible.push_back(std::uint32_t(i));
+        }
+    }
+}
+
+gl::RayHit castBruteForce(const std::vector<gl::Bounds>& bounds, const gl::Ray& ray, bool spheres)
+{
+    gl::RayHit hit;
+    for(std::size_t i = 0; i < bounds.size(); i++) {
+        float distance;
+        const bool crossed = spheres ? intersectSphere(bounds[i], ray.origin, ray.direction, distance)
+                                     : gl::intersectRayBox(ray.origin, ray.direction, bounds[i].low, bounds[i].high, distance);
+        if(crossed && distance < hit.distance) {
+            hit.object = std::uint32_t(i);
+            hit.distance = distance;
+        }
+    }
+    return hit;
+}
+
+void measure(std::size_t count, unsigned int threads, bool check)
+{
+    Random random;
+    const float side = 4.0f * std::cbrt(float(count));
+    std::vector<gl::Bounds> bounds = generateScene(count, side, random);
+
+    gl::Bvh bvh;
+    auto start = std::chrono::steady_clock::now();
+    bvh.build(bounds.data(), bounds.size(), threads);
+    const double buildTime = milliseconds(start);
+
+    // cameras inside the scene, 60 degrees, seeing up to a fifth of it
+    const int cameraCount = 64;
+    std::vector<glm::mat4> cameras;
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.5f, side * 0.25f);
+    for(int i = 0; i < cameraCount; i++) {
+        const glm::vec3 eye = random.vector(0.0f, side);
+        cameras.push_back(projection * glm::lookAt(eye, eye + random.vector(-1.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+    std::vector<std::uint32_t> visible;
+    std::size_t visibleCount = 0;
+    start = std::chrono::steady_clock::now();
+    for(const glm::mat4& camera : cameras) {
+        visible.clear();
+        bvh.cullFrustum(camera, visible);
+        visibleCount += visible.size();
+    }
+    const double cullTime = milliseconds(start) / cameraCount;
+
+    const std::size_t rayCount = 1 << 20;
+    std::vector<gl::Ray> rays(rayCount);
+    for(gl::Ray& ray : rays) {
+        ray.origin = random.vector(0.0f, side);
+        ray.direction = glm::normalize(random.vector(-1.0f, 1.0f));
+    }
+    std::vector<gl::RayHit> hits(rayCount), sphereHits(rayCount);
+    start = std::chrono::steady_clock::now();
+    bvh.castRays(rays.data(), rays.size(), hits.data());
+    const double rayTime = milliseconds(start);
+    start = std::chrono::steady_clock::now();
+    bvh.castRays(rays.data(), rays.size(), sphereHits.data(),
+                 [&](std::uint32_t object, const glm::vec3& origin, const glm::vec3& direction, float& distance) {
+                     return intersectSphere(bounds[object], origin, direction, distance);
+                 });
+    const double sphereTime = milliseconds(start);
+
+    // every object moves by up to a unit
+    std::vector<gl::Bounds> moved = bounds;
+    for(gl::Bounds& b : moved) {
+        const glm::vec3 offset = random.vector(-1.0f, 1.0f);
+        b.low += offset;
+        b.high += offset;
+    }
+    start = std::chrono::steady_clock::now();
+    bvh.refit(moved.data());
+    const double refitTime = milliseconds(start);
+    start = std::chrono::steady_clock::now();
+    bvh.castRays(rays.data(), rays.size(), hits.data());
+    const double refitRayTime = milliseconds(start);
+
+    std::printf("%9zu %10.1f %9.2f %8.3f %10zu %8.2f %8.2f %8.2f %8zu\n", count, buildTime, refitTime, cullTime,
+                visibleCount / cameraCount, rayCount / rayTime / 1000.0, rayCount / sphereTime / 1000.0,
+                rayCount / refitRayTime / 1000.0, bvh.nodeCount());
+
+    if(!check) {
+        return;
+    }
+    std::size_t wrong = 0;
+    std::vector<std::uint32_t> expected;
+    for(const glm::mat4& camera : cameras) {
+        visible.clear();
+        expected.clear();
+        bvh.cullFrustum(camera, visible);
+        cullBruteForce(moved, camera, expected);
+        std::sort(visible.begin(), visible.end());
+        wrong += visible != expected ? 1 : 0;
+    }
+    std::printf("  %zu of %d frusta differ\n", wrong, cameraCount);
+
+    wrong = 0;
+    std::size_t wrongSpheres = 0, hitCount = 0;
+    bvh.castRays(rays.data(), rays.size(), hits.data());
+    bvh.castRays(rays.data(), rays.size(), sphereHits.data(),
+                 [&](std::uint32_t object, const glm::vec3& origin, const glm::vec3& direction, float& distance) {
+                     return intersectSphere(moved[object], origin, direction, distance);
+                 });
+    const std::size_t checked = std::min<std::size_t>(rayCount, 100000000 / count);
+    for(std::size_t i = 0; i < checked; i++) {
+        const gl::RayHit hit = castBruteForce(moved, rays[i], false);
+        const gl::RayHit sphereHit = castBruteForce(moved, rays[i], true);
+        wrong += hit.distance != hits[i].distance ? 1 : 0;
+        wrongSpheres += sphereHit.distance != sphereHits[i].distance ? 1 : 0;
+        hitCount += hit.object != gl::RayHit::none ? 1 : 0;
+    }
+    std::printf("  %zu box and %zu sphere hits of %zu rays differ, %zu hit a box\n", wrong, wrongSpheres, checked, hitCount);
+
+    wrong = 0;
+    std::vector<std::uint32_t> found;
+    for(int i = 0; i < 64; i++) {
+        const glm::vec3 low = random.vector(0.0f, side);
+        const gl::Bounds query = { low, low + random.vector(1.0f, 20.0f) };
+        found.clear();
+        expected.clear();
+        bvh.queryBounds(query, found);
+        for(std::size_t k = 0; k < moved.size(); k++) {
+            const gl::Bounds& b = moved[k];
+            if(glm::all(glm::lessThanEqual(b.low, query.high)) && glm::all(glm::greaterThanEqual(b.high, query.low))) {
+                expected.push_back(std::uint32_t(k));
+            }
+        }
+        std::sort(found.begin(), found.end());
+        wrong += found != expected ? 1 : 0;
+    }
+    std::printf("  %zu of 64 box queries differ\n", wrong);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 0;
+    unsigned int threads = 0;
+    bool check = false;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::atoll(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else if(arg == "--verify") {
+            check = true;
+        }
+        else {
+            std::fprintf(stderr, "usage: bvh [--count n] [--threads n] [--verify]\n");
+            return 1;
+        }
+    }
+
+    std::printf("%9s %10s %9s %8s %10s %8s %8s %8s %8s\n", "objects", "build ms", "refit ms", "cull ms", "visible",
+                "Mray/s", "spheres", "refit", "nodes");
+    if(count != 0) {
+        measure(count, threads, check);
+    }
+    else {
+        for(std::size_t n : { 10000, 1000000, 10000000 }) {
+            measure(n, threads, check);
+        }
+    }
+    return 0;
+}
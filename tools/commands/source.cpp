@@ -0,0 +1,346 @@
+// Compares recording draws on the job threads, replayed on the GL thread,
+// with issuing them straight from the GL thread as the examples do: 50k
+// small meshes, each with its own model matrix, using 8 programs and 32
+// vertex arrays.
+//
+// Four ways each frame:
+// - direct: the GL thread computes each model matrix and makes the calls,
+//   in scene order, like the draw loop of ex11,
+// - direct sorted: the same in key order, the GL thread sorting the keys,
+//   which is the replay's order and state changes without recording,
+// - recorded uniforms: the job threads compute the matrices and record
+//   packets setting them with glUniformMatrix4fv, the GL thread sorts and
+//   replays them,
+// - recorded ranges: the job threads write the matrices to a streaming
+//   uniform buffer and record the range each draw binds.
+//
+// The draws go to a small hidden window, the time is the CPU's. The images
+// of the four ways are compared at the end.
+//
+//     commands [--draws n] [--frames n] [--threads n]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+#include <gl_render_queue.h>
+#include <gl_stream_buffer.h>
+#include <gl_command_buffer.h>
+#include <gl_job_system.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "../common/bench.h"
+
+#define SCREEN_SIZE 128
+
+constexpr unsigned int programCount = 8;
+constexpr unsigned int meshCount = 32;
+
+const char* vertexUniform =
+    "#version 330 core\n"
+    "layout(location = 0) in vec3 position;\n"
+    "uniform mat4 model;\n"
+    "void main() { gl_Position = model * vec4(position, 1.0); }\n";
+
+const char* vertexBlock =
+    "#version 330 core\n"
+    "layout(location = 0) in vec3 position;\n"
+    "layout(std140) uniform Object { mat4 model; };\n"
+    "void main() { gl_Position = model * vec4(position, 1.0); }\n";
+
+const char* fragment =
+    "#version 330 core\n"
+    "uniform vec4 color;\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = color; }\n";
+
+struct Object
+{
+    glm::vec3 position;
+    float angle;
+    std::uint32_t program;
+    std::uint32_t mesh;
+};
+
+struct Scene
+{
+    std::vector<Object> objects;
+    glm::mat4 viewProjection;
+};
+
+// what each way computes for a draw before issuing it
+glm::mat4 modelOf(const Scene& scene, const Object& object)
+{
+    const glm::mat4 model = glm::rotate(glm::translate(glm::mat4(1.0f), object.position), object.angle, glm::vec3(0.0f, 0.0f, 1.0f));
+    return scene.viewProjection * model;
+}
+
+std::uint64_t keyOf(const Object& object)
+{
+    // the camera looks down -z from z = 0, up to 100 away
+    return gl::RenderQueue::makeKey(0, object.program, 0, object.mesh, gl::RenderQueue::depthKey(-object.position.z, 100.0f));
+}
+
+gl::Program createProgram(gl::StateCache& state, const char* vertexSource, const glm::vec4& color)
+{
+    gl::Program program = state.createProgram();
+    const char* sources[2] = { vertexSource, fragment };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], nullptr);
+        glCompileShader(shader);
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if(!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+            std::fprintf(stderr, "shader compilation error: %s\n", infoLog);
+            std::exit(EXIT_FAILURE);
+        }
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+    state.useProgram(program);
+    glUniform4fv(glGetUniformLocation(program.id, "color"), 1, glm::value_ptr(color));
+    const GLuint block = glGetUniformBlockIndex(program.id, "Object");
+    if(block != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program.id, block, 0);
+    }
+    return program;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t drawCount = 50000;
+    int frames = 20;
+    unsigned int threads = 0;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--draws" && i + 1 < argc) {
+            drawCount = std::size_t(std::atoll(argv[++i]));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: commands [--draws n] [--frames n] [--threads n]\n");
+            return 1;
+        }
+    }
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(SCREEN_SIZE, SCREEN_SIZE, "commands", nullptr, nullptr);
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    gl::StateCache glState;
+    glState.viewport(0, 0, SCREEN_SIZE, SCREEN_SIZE);
+    glState.enable(GL_DEPTH_TEST);
+
+    // both kinds of programs give program i the same color
+    gl::Program uniformPrograms[programCount], blockPrograms[programCount];
+    GLint modelLocations[programCount];
+    for(unsigned int i = 0; i < programCount; i++) {
+        const glm::vec4 color(float(i & 1), float((i >> 1) & 1), float((i >> 2) & 1), 1.0f);
+        uniformPrograms[i] = createProgram(glState, vertexUniform, color * 0.75f + 0.25f);
+        blockPrograms[i] = createProgram(glState, vertexBlock, color * 0.75f + 0.25f);
+        modelLocations[i] = glGetUniformLocation(uniformPrograms[i].id, "model");
+    }
+
+    // each mesh a small triangle fan, its own buffers
+    gl::VertexArray meshes[meshCount];
+    std::vector<GLuint> indices;
+    for(unsigned int mesh = 0; mesh < meshCount; mesh++) {
+        const unsigned int sides = 3 + mesh % 6;
+        std::vector<glm::vec3> vertices(1, glm::vec3(0.0f));
+        indices.clear();
+        for(unsigned int side = 0; side < sides; side++) {
+            const float angle = 6.2831853f * float(side) / float(sides);
+            vertices.push_back(glm::vec3(std::cos(angle), std::sin(angle), 0.0f) * 0.5f);
+            indices.insert(indices.end(), { 0u, 1 + side, 1 + (side + 1) % sides });
+        }
+        meshes[mesh] = glState.createVertexArray();
+        glState.bindVertexArray(meshes[mesh]);
+        gl::Buffer vertexBuffer = glState.createBuffer(), indexBuffer = glState.createBuffer();
+        glState.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(vertices.size() * sizeof(glm::vec3)), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+        glEnableVertexAttribArray(0);
+        glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, GLsizeiptr(indices.size() * sizeof(GLuint)), indices.data(), GL_STATIC_DRAW);
+    }
+    const auto meshIndexCount = [](std::uint32_t mesh) { return GLsizei(3 * (3 + mesh % 6)); };
+
+    Random random;
+    Scene scene;
+    scene.viewProjection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+    scene.objects.resize(drawCount);
+    for(Object& object : scene.objects) {
+        object.position = glm::vec3(random.range(-40.0f, 40.0f), random.range(-40.0f, 40.0f), random.range(-99.0f, -1.0f));
+        object.angle = random.range(0.0f, 6.2831853f);
+        object.program = std::uint32_t(random.next() * programCount) % programCount;
+        object.mesh = std::uint32_t(random.next() * meshCount) % meshCount;
+    }
+
+    gl::JobSystem jobs(threads);
+    std::vector<gl::CommandRecorder> recorders(jobs.threadCount());
+    gl::CommandQueue queue;
+    const std::size_t grain = 1024;
+
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    const std::size_t stride = (sizeof(glm::mat4) + std::size_t(alignment) - 1) / std::size_t(alignment) * std::size_t(alignment);
+    gl::StreamBuffer uniforms;
+    uniforms.init(glState, GL_UNIFORM_BUFFER, drawCount * stride + 64 * stride);
+
+    enum Way { Direct, DirectSorted, RecordedUniforms, RecordedRanges, wayCount };
+    const char* names[wayCount] = { "direct", "direct sorted", "recorded uniforms", "recorded ranges" };
+    struct Item
+    {
+        std::uint64_t key;
+        std::uint32_t object;
+    };
+    std::vector<Item> items, scratch;
+    double recordTime[wayCount] = {}, glTime[wayCount] = {};
+    unsigned long changes[wayCount] = {};
+    std::vector<unsigned char> images[wayCount];
+
+    for(int way = 0; way < wayCount; way++) {
+        for(int frame = -2; frame < frames; frame++) {
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glState.resetCounters();
+            double record = 0.0, submit = 0.0;
+
+            if(way == Direct) {
+                const auto start = std::chrono::steady_clock::now();
+                for(const Object& object : scene.objects) {
+                    const glm::mat4 model = modelOf(scene, object);
+                    glState.useProgram(uniformPrograms[object.program]);
+                    glState.bindVertexArray(meshes[object.mesh]);
+                    glUniformMatrix4fv(modelLocations[object.program], 1, GL_FALSE, glm::value_ptr(model));
+                    glDrawElements(GL_TRIANGLES, meshIndexCount(object.mesh), GL_UNSIGNED_INT, nullptr);
+                }
+                submit = milliseconds(start);
+            }
+            else if(way == DirectSorted) {
+                const auto start = std::chrono::steady_clock::now();
+                items.clear();
+                for(std::uint32_t i = 0; i < drawCount; i++) {
+                    items.push_back({ keyOf(scene.objects[i]), i });
+                }
+                gl::detail::radixSortByKey(items, scratch);
+                for(const Item& item : items) {
+                    const Object& object = scene.objects[item.object];
+                    const glm::mat4 model = modelOf(scene, object);
+                    glState.useProgram(uniformPrograms[object.program]);
+                    glState.bindVertexArray(meshes[object.mesh]);
+                    glUniformMatrix4fv(modelLocations[object.program], 1, GL_FALSE, glm::value_ptr(model));
+                    glDrawElements(GL_TRIANGLES, meshIndexCount(object.mesh), GL_UNSIGNED_INT, nullptr);
+                }
+                submit = milliseconds(start);
+            }
+            else {
+                if(way == RecordedRanges) {
+                    uniforms.begin(glState);
+                }
+                auto start = std::chrono::steady_clock::now();
+                jobs.parallelFor(drawCount, grain, [&](std::size_t first, std::size_t last) {
+                    gl::CommandRecorder& commands = recorders[jobs.threadIndex()];
+                    gl::StreamBuffer::Allocation block;
+                    if(way == RecordedRanges) {
+                        block = uniforms.allocate((last - first) * stride, std::size_t(alignment));
+                    }
+                    for(std::size_t i = first; i < last; i++) {
+                        const Object& object = scene.objects[i];
+                        const glm::mat4 model = modelOf(scene, object);
+                        commands.begin(keyOf(object));
+                        commands.bindVertexArray(meshes[object.mesh]);
+                        if(way == RecordedRanges) {
+                            const std::size_t offset = (i - first) * stride;
+                            std::memcpy(static_cast<unsigned char*>(block.data) + offset, glm::value_ptr(model), sizeof(model));
+                            commands.useProgram(blockPrograms[object.program]);
+                            commands.bindUniformRange(0, uniforms.buffer(), block.offset + GLintptr(offset), sizeof(glm::mat4));
+                        }
+                        else {
+                            commands.useProgram(uniformPrograms[object.program]);
+                            commands.uniformMatrix4(modelLocations[object.program], glm::value_ptr(model));
+                        }
+                        commands.drawElements(GL_TRIANGLES, meshIndexCount(object.mesh), GL_UNSIGNED_INT, 0);
+                    }
+                });
+                record = milliseconds(start);
+
+                start = std::chrono::steady_clock::now();
+                if(way == RecordedRanges) {
+                    uniforms.commit(glState);
+                }
+                queue.sort(recorders.data(), recorders.size());
+                queue.execute(glState);
+                if(way == RecordedRanges) {
+                    uniforms.end();
+                }
+                submit = milliseconds(start);
+                for(gl::CommandRecorder& commands : recorders) {
+                    commands.clear();
+                }
+            }
+            glFinish();
+            if(frame >= 0) {
+                recordTime[way] += record;
+                glTime[way] += submit;
+                changes[way] = glState.issuedCalls();
+            }
+        }
+        images[way].resize(SCREEN_SIZE * SCREEN_SIZE * 4);
+        glReadPixels(0, 0, SCREEN_SIZE, SCREEN_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, images[way].data());
+    }
+
+    std::printf("%zu draws, %u programs, %u vertex arrays, %u threads, %s\n", drawCount, programCount, meshCount,
+                jobs.threadCount(), reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-20s %12s %12s %14s %10s\n", "ms per frame", "recording", "GL thread", "state changes", "ns/draw");
+    for(int way = 0; way < wayCount; way++) {
+        std::printf("%-20s %9.2f ms %9.2f ms %14lu %10.1f\n", names[way], recordTime[way] / frames, glTime[way] / frames,
+                    changes[way], glTime[way] / frames * 1e6 / double(drawCount));
+    }
+    std::printf("recording %.1f M draws/s\n", double(drawCount) * frames / (recordTime[RecordedUniforms] * 1e3));
+    for(int way = DirectSorted; way < wayCount; way++) {
+        std::size_t differ = 0;
+        for(std::size_t i = 0; i < images[way].size(); i += 4) {
+            differ += std::equal(&images[way][i], &images[way][i] + 4, &images[Direct][i]) ? 0 : 1;
+        }
+        std::printf("%s: %zu of %d pixels differ from direct\n", names[way], differ, SCREEN_SIZE * SCREEN_SIZE);
+    }
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+// Helpers shared by the benchmark tools
+//
+// Random is a linear congruential generator with a fixed seed, so every run
+// of a tool measures the same data and runs can be compared with each other.
+// It isn't meant to be statistically good, only cheap and repeatable.
+//
+//     #include "../common/bench.h"
+//
+//     Random random;
+//     const glm::vec3 p = random.vector(-100.0f, 100.0f);
+//     const auto start = std::chrono::steady_clock::now();
+//     ...
+//     std::printf("%.2f ms\n", milliseconds(start));
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+struct Random
+{
+    std::uint32_t state = 12345;
+
+    // The high 24 bits of the next state.
+    std::uint32_t bits()
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+    // Uniform in [0, 1).
+    float next() { return float(bits()) / 16777216.0f; }
+    float range(float low, float high) { return low + (high - low) * next(); }
+    // The components are drawn x, y then z, which the order arguments are
+    // evaluated in wouldn't guarantee.
+    glm::vec3 vector(float low, float high)
+    {
+        const float x = range(low, high);
+        const float y = range(low, high);
+        const float z = range(low, high);
+        return glm::vec3(x, y, z);
+    }
+    // Uniform on the unit sphere, by rejection from the cube.
+    glm::vec3 unitVector()
+    {
+        for(;;) {
+            const glm::vec3 v = vector(-1.0f, 1.0f);
+            const float length = glm::length(v);
+            if(length > 0.01f && length <= 1.0f) {
+                return v / length;
+            }
+        }
+    }
+};
+
+inline double milliseconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline double microseconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,202 @@
+// Checks GLM_GTX_matrix_transform_constexpr at compile time and measures
+// what it saves at start up.
+//
+// The static_asserts compare constexprTranslate, Scale, Rotate, Perspective,
+// Ortho and LookAt with values worked out by hand, so the file doesn't
+// build if one of them regresses.
+//
+// At run time, a static scene of sceneSize cubes, generated from a seed
+// like the cubePositions of the examples with many more of them, is built
+// by the compiler into read only data, and again at start up with
+// translate, rotate and scale. The tool prints the time the run time build
+// takes, the time to read the compiled table, which counts its page faults,
+// and how far apart the two tables are.
+//
+//     constexpr [--runs n]
+
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/matrix_transform_constexpr.hpp>
+
+#include "../common/bench.h"
+
+constexpr bool near(float a, float b, float tolerance = 1e-6f)
+{
+    return (a > b ? a - b : b - a) <= tolerance;
+}
+
+constexpr bool near(const glm::mat4& m, const float (&expected)[16], float tolerance = 1e-6f)
+{
+    for(int c = 0; c < 4; c++) {
+        for(int r = 0; r < 4; r++) {
+            if(!near(m[c][r], expected[c * 4 + r], tolerance)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// matrices below are written column by column
+constexpr float pi = 3.14159265358979f;
+
+static_assert(near(glm::constexprTranslate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)),
+                   { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1 }, 0.0f),
+              "constexprTranslate");
+static_assert(near(glm::constexprScale(glm::constexprTranslate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)),
+                                       glm::vec3(2.0f, 3.0f, 4.0f)),
+                   { 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 0, 1, 2, 3, 1 }, 0.0f),
+              "constexprScale after constexprTranslate");
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), 0.0f, glm::vec3(1.0f, 0.3f, 0.5f)),
+                   { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }),
+              "constexprRotate by 0 is the identity");
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), pi / 2.0f, glm::vec3(0.0f, 0.0f, 2.0f)),
+                   { 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }),
+              "constexprRotate a quarter turn around z, axis not normalized");
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), pi, glm::vec3(1.0f, 0.0f, 0.0f)),
+                   { 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1 }),
+              "constexprRotate a half turn around x");
+// a third of a turn around (1, 1, 1) cycles the axes
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), 2.0f * pi / 3.0f, glm::vec3(1.0f, 1.0f, 1.0f)),
+                   { 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1 }),
+              "constexprRotate a third of a turn around the diagonal");
+// 0.5 rad, sin and cos from their series to 1e-7
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), 0.5f, glm::vec3(0.0f, 1.0f, 0.0f)),
+                   { 0.8775826f, 0, -0.4794255f, 0, 0, 1, 0, 0, 0.4794255f, 0, 0.8775826f, 0, 0, 0, 0, 1 }),
+              "constexprRotate 0.5 rad around y");
+// large angles are reduced before the series
+static_assert(near(glm::constexprRotate(glm::mat4(1.0f), 40.0f * pi, glm::vec3(0.0f, 0.0f, 1.0f)),
+                   { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }, 1e-5f),
+              "constexprRotate 20 turns");
+#if !defined(GLM_FORCE_DEPTH_ZERO_TO_ONE) && !defined(GLM_FORCE_LEFT_HANDED)
+// fovy 90 degrees: 1 / tan(fovy / 2) = 1, near 1 and far 3
+static_assert(near(glm::constexprPerspective(pi / 2.0f, 2.0f, 1.0f, 3.0f),
+                   { 0.5f, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, -1, 0, 0, -3, 0 }),
+              "constexprPerspective");
+// fovy 60 degrees: 1 / tan(30 degrees) = sqrt(3)
+constexpr glm::mat4 perspective60 = glm::constexprPerspective(pi / 3.0f, 1.0f, 0.1f, 100.0f);
+static_assert(near(perspective60[1][1], 1.7320508f), "constexprPerspective fovy 60");
+static_assert(near(glm::constexprOrtho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 5.0f),
+                   { 0.5f, 0, 0, 0, 0, 1, 0, 0, 0, 0, -0.5f, 0, 0, 0, -1.5f, 1 }),
+              "constexprOrtho");
+// the eye on +z looking at the origin is a translation
+static_assert(near(glm::constexprLookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 2.0f, 0.0f)),
+                   { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -5, 1 }),
+              "constexprLookAt");
+#endif
+
+constexpr unsigned int sceneSize = 4096;
+
+struct Cube
+{
+    glm::vec3 position;
+    glm::vec3 axis;
+    float angle;
+    float scale;
+};
+
+// the same generator at compile time and at run time
+constexpr Cube generateCube(unsigned int i)
+{
+    std::uint32_t state = 12345u + i * 2654435761u;
+    float values[8] = {};
+    for(float& value : values) {
+        state = state * 1664525u + 1013904223u;
+        value = float(state >> 8) / 16777216.0f;
+    }
+    return { glm::vec3(values[0] * 200.0f - 100.0f, values[1] * 200.0f - 100.0f, values[2] * 200.0f - 100.0f),
+             glm::vec3(values[3] - 0.5f, values[4] - 0.5f, values[5] + 0.1f), values[6] * 6.2831853f, 0.5f + values[7] };
+}
+
+struct Scene
+{
+    glm::mat4 models[sceneSize];
+};
+
+constexpr Scene createScene()
+{
+    Scene scene{};
+    for(unsigned int i = 0; i < sceneSize; i++) {
+        const Cube cube = generateCube(i);
+        glm::mat4 m = glm::constexprTranslate(glm::mat4(1.0f), cube.position);
+        m = glm::constexprRotate(m, cube.angle, cube.axis);
+        scene.models[i] = glm::constexprScale(m, glm::vec3(cube.scale));
+    }
+    return scene;
+}
+
+constexpr Scene compiledScene = createScene();
+
+// built at start up, the way the examples build their models
+Scene runtimeScene;
+
+int main(int argc, char** argv)
+{
+    int runs = 5;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: constexpr [--runs n]\n");
+            return 1;
+        }
+    }
+
+    // the first read of the compiled table, before any run time build
+    // warms the caches, takes its page faults
+    auto start = std::chrono::steady_clock::now();
+    float sum = 0.0f;
+    for(const glm::mat4& m : compiledScene.models) {
+        sum += m[3][0] + m[0][0];
+    }
+    const double firstRead = microseconds(start);
+
+    double firstBuild = 0.0, bestBuild = 1e30;
+    for(int run = 0; run < runs; run++) {
+        start = std::chrono::steady_clock::now();
+        for(unsigned int i = 0; i < sceneSize; i++) {
+            const Cube cube = generateCube(i);
+            glm::mat4 m = glm::translate(glm::mat4(1.0f), cube.position);
+            m = glm::rotate(m, cube.angle, cube.axis);
+            runtimeScene.models[i] = glm::scale(m, glm::vec3(cube.scale));
+        }
+        const double build = microseconds(start);
+        firstBuild = run == 0 ? build : firstBuild;
+        bestBuild = std::min(bestBuild, build);
+        sum += runtimeScene.models[run % sceneSize][3][0];
+    }
+
+    unsigned int identical = 0;
+    float difference = 0.0f;
+    for(unsigned int i = 0; i < sceneSize; i++) {
+        bool same = true;
+        for(int c = 0; c < 4; c++) {
+            for(int r = 0; r < 4; r++) {
+                const float a = compiledScene.models[i][c][r];
+                const float b = runtimeScene.models[i][c][r];
+                same = same && a == b;
+                difference = std::max(difference, std::abs(a - b) / std::max(1.0f, std::abs(b)));
+            }
+        }
+        identical += same ? 1 : 0;
+    }
+
+    std::printf("static scene of %u cubes, %zu KB of matrices\n", sceneSize, sizeof(Scene) / 1024);
+    std::printf("  %-32s %9.1f us\n", "compiled, first read", firstRead);
+    std::printf("  %-32s %9.1f us (best of %d: %.1f us)\n", "translate, rotate, scale at start", firstBuild, runs, bestBuild);
+    std::printf("  %u of %u matrices bit identical, largest difference %.1e relative\n", identical, sceneSize,
+                double(difference));
+    // keeps the reads
+    return sum == 12345.0f ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,343 @@
+// Compares iterating scene objects as entities with an array of structs:
+// 1M objects with a transform, world bounds and render state, three in
+// four also moving, like the cubePositions of the examples each with a
+// velocity and a spin.
+//
+// Each frame runs three systems: moving objects integrate their motion,
+// every object recomputes its world box, then the boxes are tested against
+// the camera frustum and the visible count kept. The array of structs is
+// run twice, with the structs holding just these components and with the
+// colder state a real scene object carries next to them.
+//
+// After the frames the entities are checked against the structs, then a
+// tenth of them are destroyed and created again each frame, and the old
+// handles checked dead.
+//
+//     entity [--count n] [--frames n] [--threads n]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_entity.h>
+
+#include "../common/bench.h"
+
+struct Transform
+{
+    glm::vec3 position;
+    float angle;
+    float scale;
+};
+
+struct Motion
+{
+    glm::vec3 velocity;
+    float spin;
+};
+
+struct WorldBounds
+{
+    glm::vec3 low;
+    glm::vec3 high;
+};
+
+struct Render
+{
+    std::uint32_t object;
+    std::uint32_t material;
+    std::uint32_t visible;
+};
+
+// what the structs carry besides, read by other systems than these
+struct Cold
+{
+    glm::mat4 model;
+    char name[32];
+    std::uint32_t parent;
+    std::uint32_t flags;
+};
+
+struct Object
+{
+    Transform transform;
+    Motion motion;
+    WorldBounds bounds;
+    Render render;
+    bool moving;
+};
+
+struct FatObject : Object
+{
+    Cold cold;
+};
+
+struct Frustum
+{
+    glm::vec4 planes[6];
+};
+
+Frustum frustumOf(const glm::mat4& viewProjection)
+{
+    const glm::mat4 m = glm::transpose(viewProjection);
+    return { { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] } };
+}
+
+// The systems, on one object's components.
+void integrate(Transform& transform, const Motion& motion, float step)
+{
+    transform.position += motion.velocity * step;
+    transform.angle += motion.spin * step;
+}
+
+void updateBounds(const Transform& transform, WorldBounds& bounds)
+{
+    // a unit cube turned any way stays within sqrt(3) / 2 of its center
+    const float radius = 0.8660254f * transform.scale;
+    bounds.low = transform.position - radius;
+    bounds.high = transform.position + radius;
+}
+
+bool visible(const Frustum& frustum, const WorldBounds& bounds)
+{
+    bool inside = true;
+    for(const glm::vec4& plane : frustum.planes) {
+        const glm::vec3 far(plane.x > 0.0f ? bounds.high.x : bounds.low.x, plane.y > 0.0f ? bounds.high.y : bounds.low.y,
+                            plane.z > 0.0f ? bounds.high.z : bounds.low.z);
+        inside = inside && glm::dot(glm::vec3(plane), far) + plane.w >= 0.0f;
+    }
+    return inside;
+}
+
+// Runs task(first, last) over [0, count) split between the threads.
+template<typename Task>
+void parallelFor(std::size_t count, unsigned int threads, const Task& task)
+{
+    gl::detail::entityParallel(threads, [&](unsigned int thread) {
+        task(count * thread / threads, count * (thread + 1) / threads);
+    });
+}
+
+struct Times
+{
+    double integrate = 0.0, bounds = 0.0, cull = 0.0;
+    std::size_t visible = 0;
+};
+
+template<typename Objects>
+Times runStructs(Objects& objects, const Frustum& frustum, int frames, float step, unsigned int threads)
+{
+    Times times;
+    for(int frame = 0; frame < frames; frame++) {
+        auto start = std::chrono::steady_clock::now();
+        parallelFor(objects.size(), threads, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++) {
+                if(objects[i].moving) {
+                    integrate(objects[i].transform, objects[i].motion, step);
+                }
+            }
+        });
+        times.integrate += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        parallelFor(objects.size(), threads, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++) {
+                updateBounds(objects[i].transform, objects[i].bounds);
+            }
+        });
+        times.bounds += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        std::atomic<std::size_t> count{0};
+        parallelFor(objects.size(), threads, [&](std::size_t first, std::size_t last) {
+            std::size_t seen = 0;
+            for(std::size_t i = first; i < last; i++) {
+                objects[i].render.visible = visible(frustum, objects[i].bounds);
+                seen += objects[i].render.visible;
+            }
+            count += seen;
+        });
+        times.cull += milliseconds(start);
+        times.visible = count;
+    }
+    return times;
+}
+
+Times runEntities(gl::EntityWorld& world, const Frustum& frustum, int frames, float step, unsigned int threads)
+{
+    Times times;
+    for(int frame = 0; frame < frames; frame++) {
+        auto start = std::chrono::steady_clock::now();
+        world.forEach<Transform, Motion>([&](Transform& transform, Motion& motion) {
+            integrate(transform, motion, step);
+        }, threads);
+        times.integrate += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        world.forEach<Transform, WorldBounds>([&](Transform& transform, WorldBounds& bounds) {
+            updateBounds(transform, bounds);
+        }, threads);
+        times.bounds += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        std::atomic<std::size_t> count{0};
+        world.forEachChunk<WorldBounds, Render>([&](std::size_t n, const gl::Entity*, WorldBounds* bounds, Render* render) {
+            std::size_t seen = 0;
+            for(std::size_t i = 0; i < n; i++) {
+                render[i].visible = visible(frustum, bounds[i]);
+                seen += render[i].visible;
+            }
+            count += seen;
+        }, threads);
+        times.cull += milliseconds(start);
+        times.visible = count;
+    }
+    return times;
+}
+
+void printTimes(const char* name, const Times& times, int frames)
+{
+    std::printf("%-18s %8.2f %8.2f %8.2f %8.2f   %zu\n", name, times.integrate / frames, times.bounds / frames,
+                times.cull / frames, (times.integrate + times.bounds + times.cull) / frames, times.visible);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000;
+    int frames = 20;
+    unsigned int threads = 0;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::atoll(argv[++i]));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::atoi(argv[++i]);
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: entity [--count n] [--frames n] [--threads n]\n");
+            return 1;
+        }
+    }
+    if(threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    Random random;
+    const float side = 4.0f * std::cbrt(float(count));
+    std::vector<Object> objects(count);
+    std::vector<FatObject> fatObjects(count);
+    gl::EntityWorld world;
+    std::vector<gl::Entity> entities(count);
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < count; i++) {
+        Object& object = objects[i];
+        object.transform = { random.vector(0.0f, side), random.range(0.0f, 6.28f), random.range(0.5f, 2.0f) };
+        object.motion = { random.vector(-3.0f, 3.0f), random.range(-1.0f, 1.0f) };
+        object.render = { std::uint32_t(i), std::uint32_t(i % 16), 0 };
+        object.moving = random.next() < 0.75f;
+        updateBounds(object.transform, object.bounds);
+        static_cast<Object&>(fatObjects[i]) = object;
+        fatObjects[i].cold = { glm::mat4(1.0f), "cube", ~0u, 0 };
+    }
+    const double structTime = milliseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < count; i++) {
+        const Object& object = objects[i];
+        if(object.moving) {
+            entities[i] = world.create(object.transform, object.motion, object.bounds, object.render);
+        }
+        else {
+            entities[i] = world.create(object.transform, object.bounds, object.render);
+        }
+    }
+    const double createTime = milliseconds(start);
+
+    const glm::vec3 eye(side * 0.5f, side * 0.5f, -side * 0.1f);
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.5f, side);
+    const Frustum frustum = frustumOf(projection * glm::lookAt(eye, eye + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    const float step = 1.0f / 60.0f;
+
+    std::printf("%zu objects, 3 in 4 moving, %u threads\n", count, threads);
+    std::printf("filling the structs %.1f ms, creating the entities %.1f ms, %zu archetypes\n", structTime, createTime,
+                world.archetypeCount());
+    std::printf("struct %zu bytes, with the cold state %zu bytes\n\n", sizeof(Object), sizeof(FatObject));
+
+    std::printf("%-18s %8s %8s %8s %8s   %s\n", "ms per frame", "motion", "bounds", "cull", "total", "visible");
+    std::vector<unsigned int> runs = { 1 };
+    if(threads > 1) {
+        runs.push_back(threads);
+    }
+    for(unsigned int run : runs) {
+        // both kinds of structs start where the entities are
+        std::vector<FatObject> fat = fatObjects;
+        for(std::size_t i = 0; i < count; i++) {
+            static_cast<Object&>(fat[i]) = objects[i];
+        }
+        std::printf("%u thread%s\n", run, run > 1 ? "s" : "");
+        printTimes("  structs", runStructs(objects, frustum, frames, step, run), frames);
+        printTimes("  structs + cold", runStructs(fat, frustum, frames, step, run), frames);
+        printTimes("  entities", runEntities(world, frustum, frames, step, run), frames);
+    }
+
+    // the same systems on the same objects give the same components
+    std::size_t wrong = 0;
+    world.forEachChunk<Transform, WorldBounds, Render>([&](std::size_t n, const gl::Entity* handles, Transform* transform,
+                                                           WorldBounds* bounds, Render* render) {
+        for(std::size_t i = 0; i < n; i++) {
+            const Object& object = objects[render[i].object];
+            const bool same = glm::all(glm::lessThan(glm::abs(transform[i].position - object.transform.position), glm::vec3(1e-3f)))
+                              && glm::all(glm::lessThan(glm::abs(bounds[i].low - object.bounds.low), glm::vec3(1e-3f)))
+                              && render[i].visible == object.render.visible && entities[render[i].object] == handles[i]
+                              && world.has<Motion>(handles[i]) == object.moving;
+            wrong += same ? 0 : 1;
+        }
+    });
+    std::printf("\n%zu of %zu entities differ from the structs\n", wrong, world.size());
+
+    // a tenth of the objects replaced each frame, the replacements reuse
+    // the indices with a new generation
+    const std::size_t churn = count / 10;
+    std::vector<gl::Entity> destroyed;
+    double churnTime = 0.0;
+    for(int frame = 0; frame < frames; frame++) {
+        start = std::chrono::steady_clock::now();
+        for(std::size_t k = 0; k < churn; k++) {
+            const std::size_t i = std::size_t(random.next() * float(count)) % count;
+            destroyed.push_back(entities[i]);
+            world.destroy(entities[i]);
+            const Object& object = objects[i];
+            if(object.moving) {
+                entities[i] = world.create(object.transform, object.motion, object.bounds, object.render);
+            }
+            else {
+                entities[i] = world.create(object.transform, object.bounds, object.render);
+            }
+        }
+        churnTime += milliseconds(start);
+    }
+    std::size_t stale = 0;
+    for(const gl::Entity& entity : destroyed) {
+        stale += world.alive(entity) ? 1 : 0;
+    }
+    std::size_t lost = 0;
+    for(std::size_t i = 0; i < count; i++) {
+        const Render* render = world.get<Render>(entities[i]);
+        lost += render == nullptr || render->object != i ? 1 : 0;
+    }
+    std::printf("destroying and creating %zu entities %.2f ms per frame\n", churn, churnTime / frames);
+    std::printf("%zu of %zu old handles alive, %zu of %zu current handles wrong\n", stale, destroyed.size(), lost, count);
+    return 0;
+}
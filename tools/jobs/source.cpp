@@ -0,0 +1,232 @@
+// Measures how the job system scales on the transform and culling stages
+// of a frame, for 1M cubes like those of cubePositions, each with its own
+// spin, at 1 to 32 threads.
+//
+// Then runs whole frames as a task graph: input, simulate, transform, cull
+// and build the draw list, then submit it on the main thread standing in
+// for GL, one model matrix upload per draw. Run one after the other, and
+// pipelined: the graph of the next frame runs on the jobs threads while the
+// main thread submits the current one.
+//
+//     jobs [--count n] [--frames n] [--threads n] [--grain n]
+//         --threads the largest thread count measured, 32 by default
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_job_system.h>
+
+#include "../common/bench.h"
+
+struct Scene
+{
+    std::vector<glm::vec3> positions, velocities;
+    std::vector<float> angles, spins;
+    std::vector<glm::mat4> models;
+    std::vector<std::uint8_t> visible;
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+    float side = 0.0f;
+};
+
+struct DrawList
+{
+    std::vector<glm::mat4> models;
+};
+
+void simulate(Scene& scene, std::size_t first, std::size_t last, float step)
+{
+    for(std::size_t i = first; i < last; i++) {
+        scene.positions[i] += scene.velocities[i] * step;
+        scene.angles[i] += scene.spins[i] * step;
+    }
+}
+
+void transform(Scene& scene, std::size_t first, std::size_t last)
+{
+    const glm::vec3 axis = glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f));
+    for(std::size_t i = first; i < last; i++) {
+        scene.models[i] = glm::rotate(glm::translate(glm::mat4(1.0f), scene.positions[i]), scene.angles[i], axis);
+    }
+}
+
+void cull(Scene& scene, std::size_t first, std::size_t last)
+{
+    const glm::mat4 m = glm::transpose(scene.viewProjection);
+    glm::vec4 planes[6] = { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] };
+    for(glm::vec4& plane : planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+    // a unit cube turned any way stays within sqrt(3) / 2 of its center
+    const float radius = 0.8660254f;
+    for(std::size_t i = first; i < last; i++) {
+        const glm::vec4 center = scene.models[i][3];
+        bool inside = true;
+        for(const glm::vec4& plane : planes) {
+            inside = inside && glm::dot(plane, center) >= -radius;
+        }
+        scene.visible[i] = inside;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000;
+    int frames = 10;
+    unsigned int maxThreads = 32;
+    std::size_t grain = 4096;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::atoll(argv[++i]));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::atoi(argv[++i]);
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            maxThreads = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--grain" && i + 1 < argc) {
+            grain = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else {
+            std::fprintf(stderr, "usage: jobs [--count n] [--frames n] [--threads n] [--grain n]\n");
+            return 1;
+        }
+    }
+
+    Random random;
+    Scene scene;
+    scene.side = 4.0f * std::cbrt(float(count));
+    scene.positions.resize(count);
+    scene.velocities.resize(count);
+    scene.angles.resize(count);
+    scene.spins.resize(count);
+    scene.models.resize(count);
+    scene.visible.resize(count);
+    for(std::size_t i = 0; i < count; i++) {
+        scene.positions[i] = random.vector(0.0f, scene.side);
+        scene.velocities[i] = random.vector(-3.0f, 3.0f);
+        scene.angles[i] = glm::radians(20.0f * float(i % 18));
+        scene.spins[i] = random.range(-1.0f, 1.0f);
+    }
+    const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, scene.side);
+    const glm::vec3 center(scene.side * 0.5f);
+    scene.viewProjection = projection * glm::lookAt(center - glm::vec3(0.0f, 0.0f, scene.side * 0.6f), center, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    std::printf("%zu cubes, grain %zu, %u cores\n\n", count, grain, std::thread::hardware_concurrency());
+
+    // the plain loops, no job system
+    auto start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; frame++) {
+        transform(scene, 0, count);
+    }
+    const double serialTransform = milliseconds(start) / frames;
+    start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; frame++) {
+        cull(scene, 0, count);
+    }
+    const double serialCull = milliseconds(start) / frames;
+
+    std::printf("%-10s %12s %8s %12s %8s\n", "threads", "transform", "speedup", "cull", "speedup");
+    std::printf("%-10s %9.2f ms %8s %9.2f ms %8s\n", "loop", serialTransform, "", serialCull, "");
+    for(unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+        gl::JobSystem jobs(threads);
+        start = std::chrono::steady_clock::now();
+        for(int frame = 0; frame < frames; frame++) {
+            jobs.parallelFor(count, grain, [&](std::size_t first, std::size_t last) { transform(scene, first, last); });
+        }
+        const double transformTime = milliseconds(start) / frames;
+        start = std::chrono::steady_clock::now();
+        for(int frame = 0; frame < frames; frame++) {
+            jobs.parallelFor(count, grain, [&](std::size_t first, std::size_t last) { cull(scene, first, last); });
+        }
+        const double cullTime = milliseconds(start) / frames;
+        std::printf("%-10u %9.2f ms %7.2fx %9.2f ms %7.2fx\n", threads, transformTime, serialTransform / transformTime,
+                    cullTime, serialCull / cullTime);
+    }
+
+    // whole frames as a graph, the draw lists double buffered so the main
+    // thread submits one while the graph fills the other
+    gl::JobSystem jobs(std::min(maxThreads, std::max(1u, std::thread::hardware_concurrency())));
+    DrawList drawLists[2];
+    int building = 0;
+    float time = 0.0f;
+    const float step = 1.0f / 60.0f;
+    gl::TaskGraph graph;
+    const gl::TaskGraph::Task input = graph.add("input", [&]() {
+        // the camera orbits the box's center
+        time += step;
+        const glm::vec3 eye = center + scene.side * 0.6f * glm::vec3(std::sin(time), 0.0f, -std::cos(time));
+        scene.viewProjection = projection * glm::lookAt(eye, center, glm::vec3(0.0f, 1.0f, 0.0f));
+    });
+    const gl::TaskGraph::Task simulation = graph.add("simulate", [&]() {
+        jobs.parallelFor(count, grain, [&](std::size_t first, std::size_t last) { simulate(scene, first, last, step); });
+    });
+    const gl::TaskGraph::Task transforms = graph.add("transform", [&]() {
+        jobs.parallelFor(count, grain, [&](std::size_t first, std::size_t last) { transform(scene, first, last); });
+    }, { simulation });
+    const gl::TaskGraph::Task culling = graph.add("cull", [&]() {
+        jobs.parallelFor(count, grain, [&](std::size_t first, std::size_t last) { cull(scene, first, last); });
+    }, { input, transforms });
+    graph.add("build draw list", [&]() {
+        std::vector<glm::mat4>& models = drawLists[building].models;
+        models.clear();
+        for(std::size_t i = 0; i < count; i++) {
+            if(scene.visible[i]) {
+                models.push_back(scene.models[i]);
+            }
+        }
+    }, { culling });
+
+    // what glUniformMatrix4fv and the draw call cost the GL thread, here a
+    // copy to a uniform buffer standing in for the driver's
+    std::vector<glm::mat4> uniforms(1024);
+    float checksum = 0.0f;
+    const auto submit = [&](const DrawList& list) {
+        for(std::size_t i = 0; i < list.models.size(); i++) {
+            std::memcpy(&uniforms[i % uniforms.size()], &list.models[i], sizeof(glm::mat4));
+            checksum += uniforms[i % uniforms.size()][3].x;
+        }
+    };
+
+    double submitTime = 0.0;
+    start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; frame++) {
+        graph.run(jobs);
+        const auto submitStart = std::chrono::steady_clock::now();
+        submit(drawLists[building]);
+        submitTime += milliseconds(submitStart);
+    }
+    const double sequential = milliseconds(start) / frames;
+
+    start = std::chrono::steady_clock::now();
+    graph.run(jobs);
+    for(int frame = 0; frame < frames; frame++) {
+        const int ready = building;
+        building = 1 - building;
+        gl::JobCounter done;
+        graph.launch(jobs, done);
+        submit(drawLists[ready]);
+        jobs.wait(done);
+    }
+    submit(drawLists[building]);
+    const double pipelined = milliseconds(start) / (frames + 1);
+
+    std::printf("\nframe graph of %zu stages on %u threads, %zu draws\n", graph.size(), jobs.threadCount(),
+                drawLists[building].models.size());
+    std::printf("  submit alone      %8.2f ms\n", submitTime / frames);
+    std::printf("  one after other   %8.2f ms per frame\n", sequential);
+    std::printf("  pipelined         %8.2f ms per frame\n", pipelined);
+    std::printf("  (checksum %g)\n", double(checksum));
+    return 0;
+}
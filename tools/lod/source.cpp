@@ -0,0 +1,359 @@
+// Measures the level of detail generation on generated high poly meshes: a
+// displaced sphere, a terrain with open borders and a torus with texture
+// coordinate seams. For each it prints the triangles and error of every
+// level, and the time taken to build them.
+//
+// Then it renders a field of rocks with the software rasterizer, once at
+// full detail and once picking each rock's level from its distance, and
+// compares the frame times and the images.
+//
+//     lod [--subdivisions n] [--rocks n] [--pixels error] [--threads n] [--ppm prefix]
+//         --subdivisions of the rendered rock, 6 by default: 81920 triangles
+//         --pixels is the screen space error allowed, 1 by default
+//         --ppm writes prefix_full.ppm and prefix_lod.ppm
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_mesh_lod.h>
+#include <gl_soft_rasterizer.h>
+
+#include "../common/bench.h"
+
+// The layout of gl::ObjVertex.
+struct Vertex
+{
+    glm::vec3 position;
+    glm::vec2 texCoord;
+    glm::vec3 normal;
+};
+
+struct Mesh
+{
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+};
+
+float bumps(const glm::vec3& p)
+{
+    return 0.08f * std::sin(7.0f * p.x + 1.3f) * std::sin(5.0f * p.y + 0.7f) * std::sin(6.0f * p.z)
+           + 0.03f * std::sin(23.0f * p.x + 11.0f * p.z) + 0.01f * std::sin(61.0f * p.y + 37.0f * p.x);
+}
+
+void computeNormals(Mesh& mesh)
+{
+    for(Vertex& v : mesh.vertices) {
+        v.normal = glm::vec3(0.0f);
+    }
+    for(std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+        Vertex& a = mesh.vertices[mesh.indices[i]];
+        Vertex& b = mesh.vertices[mesh.indices[i + 1]];
+        Vertex& c = mesh.vertices[mesh.indices[i + 2]];
+        const glm::vec3 normal = glm::cross(b.position - a.position, c.position - a.position);
+        a.normal += normal;
+        b.normal += normal;
+        c.normal += normal;
+    }
+    for(Vertex& v : mesh.vertices) {
+        v.normal = glm::normalize(v.normal);
+    }
+}
+
+// Icosahedron subdivided, projected on the unit sphere and displaced.
+Mesh makeRock(int subdivisions)
+{
+    const float t = (1.0f + std::sqrt(5.0f)) * 0.5f;
+    std::vector<glm::vec3> points = {
+        { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 }, { 0, -1, t }, { 0, 1, t },
+        { 0, -1, -t }, { 0, 1, -t }, { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 },
+    };
+    std::vector<std::uint32_t> indices = {
+        0, 11, 5, 0, 5, 1, 0, 1, 7, 0, 7, 10, 0, 10, 11, 1, 5, 9, 5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1, 8,
+        3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9, 4, 9, 5, 2, 4, 11, 6, 2, 10, 8, 6, 7, 9, 8, 1,
+    };
+    for(glm::vec3& p : points) {
+        p = glm::normalize(p);
+    }
+    for(int level = 0; level < subdivisions; level++) {
+        std::map<std::uint64_t, std::uint32_t> middles;
+        auto middle = [&](std::uint32_t a, std::uint32_t b) {
+            const std::uint64_t key = std::uint64_t(std::min(a, b)) << 32 | std::max(a, b);
+            auto found = middles.find(key);
+            if(found != middles.end()) {
+                return found->second;
+            }
+            points.push_back(glm::normalize(points[a] + points[b]));
+            return middles[key] = std::uint32_t(points.size() - 1);
+        };
+        std::vector<std::uint32_t> finer;
+        for(std::size_t i = 0; i < indices.size(); i += 3) {
+            const std::uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            const std::uint32_t ab = middle(a, b), bc = middle(b, c), ca = middle(c, a);
+            finer.insert(finer.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+        }
+        indices.swap(finer);
+    }
+
+    Mesh mesh;
+    for(const glm::vec3& p : points) {
+        mesh.vertices.push_back({ p * (1.0f + bumps(p)), glm::vec2(0.0f), glm::vec3(0.0f) });
+    }
+    mesh.indices = indices;
+    computeNormals(mesh);
+    return mesh;
+}
+
+// Heightfield of size x size vertices, its border left open.
+Mesh makeTerrain(int size)
+{
+    Mesh mesh;
+    for(int z = 0; z < size; z++) {
+        for(int x = 0; x < size; x++) {
+            const glm::vec2 p = glm::vec2(float(x), float(z)) / float(size - 1);
+            const float height = 0.1f * std::sin(9.0f * p.x) * std::cos(7.0f * p.y) + 0.02f * std::sin(41.0f * p.x + 29.0f * p.y)
+                                 + 0.004f * std::sin(173.0f * p.y);
+            mesh.vertices.push_back({ glm::vec3(p.x, height, p.y), p, glm::vec3(0.0f) });
+        }
+    }
+    for(int z = 0; z + 1 < size; z++) {
+        for(int x = 0; x + 1 < size; x++) {
+            const std::uint32_t a = std::uint32_t(z * size + x);
+            mesh.indices.insert(mesh.indices.end(), { a, a + std::uint32_t(size), a + 1, a + 1, a + std::uint32_t(size), a + std::uint32_t(size) + 1 });
+        }
+    }
+    computeNormals(mesh);
+    return mesh;
+}
+
+// Torus whose first and last rows and columns are separate vertices with
+// their own texture coordinates: two seams.
+Mesh makeTorus(int around, int across)
+{
+    Mesh mesh;
+    for(int j = 0; j <= across; j++) {
+        for(int i = 0; i <= around; i++) {
+            const glm::vec2 uv(float(i) / float(around), float(j) / float(across));
+            const float u = uv.x * 6.2831853f, v = uv.y * 6.2831853f;
+            const float radius = 0.3f + 0.02f * std::sin(12.0f * u) * std::sin(5.0f * v);
+            const glm::vec3 position((1.0f + radius * std::cos(v)) * std::cos(u), radius * std::sin(v), (1.0f + radius * std::cos(v)) * std::sin(u));
+            mesh.vertices.push_back({ position, uv, glm::vec3(0.0f) });
+        }
+    }
+    const std::uint32_t row = std::uint32_t(around + 1);
+    for(int j = 0; j < across; j++) {
+        for(int i = 0; i < around; i++) {
+            const std::uint32_t a = std::uint32_t(j) * row + std::uint32_t(i);
+            mesh.indices.insert(mesh.indices.end(), { a, a + row, a + 1, a + 1, a + row, a + row + 1 });
+        }
+    }
+    computeNormals(mesh);
+    return mesh;
+}
+
+void buildLods(const Mesh& mesh, std::vector<std::uint32_t>& lodIndices, std::vector<gl::MeshLod>& lods)
+{
+    gl::buildMeshLods(&mesh.vertices[0].position.x, mesh.vertices.size(), sizeof(Vertex), mesh.indices.data(),
+                      mesh.indices.size(), lodIndices, lods);
+}
+
+void reportLods(const char* name, const Mesh& mesh)
+{
+    std::vector<std::uint32_t> lodIndices;
+    std::vector<gl::MeshLod> lods;
+    const auto start = std::chrono::steady_clock::now();
+    buildLods(mesh, lodIndices, lods);
+    const double time = milliseconds(start);
+
+    const std::size_t triangles = mesh.indices.size() / 3;
+    std::printf("%s: %zu vertices, %zu triangles, %zu levels in %.0f ms, %.2f Mtri/s\n", name, mesh.vertices.size(), triangles,
+                lods.size(), time, double(triangles) / time / 1000.0);
+    for(std::size_t level = 0; level < lods.size(); level++) {
+        std::printf("  %zu  %9u triangles  %6.2f%%  error %.5f\n", level, lods[level].indexCount / 3,
+                    100.0 * double(lods[level].indexCount / 3) / double(triangles), lods[level].error);
+    }
+}
+
+glm::vec4 shadeRock(const float* varyings, const void*)
+{
+    const glm::vec3 normal = glm::normalize(glm::vec3(varyings[0], varyings[1], varyings[2]));
+    const float light = 0.15f + 0.85f * std::max(0.0f, glm::dot(normal, glm::normalize(glm::vec3(0.4f, 0.8f, 0.3f))));
+    return glm::vec4(glm::vec3(0.8f, 0.7f, 0.6f) * light, 1.0f);
+}
+
+struct Rock
+{
+    glm::mat4 model;
+    glm::vec3 center;
+    float scale;
+};
+
+struct FrameStats
+{
+    double time = 0.0;
+    std::size_t triangles = 0;
+};
+
+// Draws every rock at the level chosen by select(distance, scale).
+template<typename Select>
+FrameStats renderRocks(gl::SoftRasterizer& rasterizer, const Mesh& mesh, const std::vector<std::uint32_t>& lodIndices,
+                       const std::vector<gl::MeshLod>& lods, const std::vector<std::vector<std::uint32_t>>& lodVertices,
+                       const std::vector<Rock>& rocks, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& eye,
+                       const Select& select)
+{
+    FrameStats stats;
+    std::vector<gl::SoftVertex> vertices(mesh.vertices.size());
+    const auto start = std::chrono::steady_clock::now();
+    rasterizer.clear(glm::vec4(0.4f, 0.5f, 0.6f, 1.0f));
+    for(const Rock& rock : rocks) {
+        const std::size_t level = select(glm::length(rock.center - eye), rock.scale);
+        const glm::mat4 transform = projection * view * rock.model;
+        const glm::mat3 normalMatrix(rock.model);
+        // only the vertices the level uses, like the vertex shader would
+        for(std::uint32_t i : lodVertices[level]) {
+            vertices[i].position = transform * glm::vec4(mesh.vertices[i].position, 1.0f);
+            const glm::vec3 normal = normalMatrix * mesh.vertices[i].normal;
+            vertices[i].varyings[0] = normal.x;
+            vertices[i].varyings[1] = normal.y;
+            vertices[i].varyings[2] = normal.z;
+        }
+        const gl::MeshLod& lod = lods[level];
+        rasterizer.drawIndexed(vertices.data(), lodIndices.data() + lod.firstIndex, lod.indexCount, 3, shadeRock, nullptr);
+        stats.triangles += lod.indexCount / 3;
+    }
+    rasterizer.flush();
+    stats.time = milliseconds(start);
+    return stats;
+}
+
+std::vector<std::uint32_t> copyFrame(const gl::SoftRasterizer& rasterizer)
+{
+    std::vector<std::uint32_t> pixels;
+    for(int y = 0; y < rasterizer.height(); y++) {
+        for(int x = 0; x < rasterizer.width(); x++) {
+            pixels.push_back(rasterizer.pixel(x, y));
+        }
+    }
+    return pixels;
+}
+
+int main(int argc, char** argv)
+{
+    int subdivisions = 6;
+    int rockCount = 64;
+    float maxPixels = 1.0f;
+    unsigned int threads = 0;
+    std::string ppm;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--subdivisions" && i + 1 < argc) {
+            subdivisions = std::atoi(argv[++i]);
+        }
+        else if(arg == "--rocks" && i + 1 < argc) {
+            rockCount = std::atoi(argv[++i]);
+        }
+        else if(arg == "--pixels" && i + 1 < argc) {
+            maxPixels = float(std::atof(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else if(arg == "--ppm" && i + 1 < argc) {
+            ppm = argv[++i];
+        }
+        else {
+            std::fprintf(stderr, "usage: lod [--subdivisions n] [--rocks n] [--pixels error] [--threads n] [--ppm prefix]\n");
+            return 1;
+        }
+    }
+
+    reportLods("rock", makeRock(7));
+    reportLods("terrain", makeTerrain(725));
+    reportLods("torus", makeTorus(1024, 512));
+
+    // the rendered rock and the vertices each level uses
+    const Mesh rock = makeRock(subdivisions);
+    std::vector<std::uint32_t> lodIndices;
+    std::vector<gl::MeshLod> lods;
+    buildLods(rock, lodIndices, lods);
+    std::vector<std::vector<std::uint32_t>> lodVertices;
+    for(const gl::MeshLod& lod : lods) {
+        std::vector<std::uint32_t> used(lodIndices.begin() + lod.firstIndex, lodIndices.begin() + lod.firstIndex + lod.indexCount);
+        std::sort(used.begin(), used.end());
+        used.erase(std::unique(used.begin(), used.end()), used.end());
+        lodVertices.push_back(used);
+    }
+
+    // rocks of 0.5 to 2 units along a valley, from 3 to 200 units away
+    const int width = 1280, height = 720;
+    const float fovy = glm::radians(60.0f);
+    const glm::vec3 eye(0.0f, 1.5f, 0.0f);
+    const glm::mat4 projection = glm::perspective(fovy, float(width) / float(height), 0.1f, 500.0f);
+    const glm::mat4 view = glm::lookAt(eye, glm::vec3(0.0f, 0.0f, -100.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    std::vector<Rock> rocks;
+    Random random;
+    for(int i = 0; i < rockCount; i++) {
+        const float distance = 3.0f * std::pow(200.0f / 3.0f, float(i) / float(std::max(rockCount - 1, 1)));
+        const float scale = 0.5f + 1.5f * random.next();
+        const glm::vec3 center((random.next() - 0.5f) * distance * 0.8f, 0.0f, -distance);
+        const glm::mat4 model = glm::rotate(glm::scale(glm::translate(glm::mat4(1.0f), center), glm::vec3(scale)),
+                                            random.next() * 6.2831853f, glm::normalize(glm::vec3(random.next(), 1.0f, random.next())));
+        rocks.push_back({ model, center, scale });
+    }
+
+    gl::SoftRasterizer rasterizer(width, height, threads);
+    rasterizer.depthTest(true);
+    const float projectionScale = gl::lodProjectionScale(fovy, float(height));
+
+    const FrameStats full = renderRocks(rasterizer, rock, lodIndices, lods, lodVertices, rocks, view, projection, eye,
+                                        [](float, float) { return std::size_t(0); });
+    const std::vector<std::uint32_t> fullFrame = copyFrame(rasterizer);
+    if(!ppm.empty()) {
+        rasterizer.writePpm((ppm + "_full.ppm").c_str());
+    }
+    std::vector<std::size_t> levelCounts(lods.size(), 0);
+    const FrameStats lod = renderRocks(rasterizer, rock, lodIndices, lods, lodVertices, rocks, view, projection, eye,
+                                       [&](float distance, float scale) {
+                                           const std::size_t level = gl::selectLod(lods.data(), lods.size(), distance, projectionScale,
+                                                                                   maxPixels, scale);
+                                           levelCounts[level]++;
+                                           return level;
+                                       });
+    const std::vector<std::uint32_t> lodFrame = copyFrame(rasterizer);
+    if(!ppm.empty()) {
+        rasterizer.writePpm((ppm + "_lod.ppm").c_str());
+    }
+
+    // pixels whose color moved by more than 16 in a channel
+    std::size_t changed = 0;
+    double difference = 0.0;
+    for(std::size_t i = 0; i < fullFrame.size(); i++) {
+        int largest = 0;
+        for(int shift = 0; shift < 24; shift += 8) {
+            const int delta = std::abs(int((fullFrame[i] >> shift) & 0xff) - int((lodFrame[i] >> shift) & 0xff));
+            largest = std::max(largest, delta);
+            difference += delta;
+        }
+        changed += largest > 16 ? 1 : 0;
+    }
+
+    std::printf("\n%d rocks of %zu triangles at %dx%d, %u threads, error under %.2f pixels\n", rockCount, rock.indices.size() / 3,
+                width, height, rasterizer.threadCount(), maxPixels);
+    std::printf("  full detail  %9zu triangles  %8.1f ms\n", full.triangles, full.time);
+    std::printf("  levels       %9zu triangles  %8.1f ms  %.1fx faster\n", lod.triangles, lod.time, full.time / lod.time);
+    std::printf("  rocks per level:");
+    for(std::size_t count : levelCounts) {
+        std::printf(" %zu", count);
+    }
+    std::printf("\n  %.3f%% of the pixels differ by more than 16, mean difference %.3f\n", 100.0 * double(changed) / double(fullFrame.size()),
+                difference / double(fullFrame.size() * 3));
+    return 0;
+}
@@ -0,0 +1,204 @@
+// Compares batchMul of GLM_GTX_matrix_batch with a loop over operator*, for
+// batches of 16 to 256k matrices, so from a few draws' worth in cache to
+// streams from memory:
+// - pairs: Out[i] = A[i] * B[i],
+// - parent: Out[i] = A * B[i], one transform applied to its children,
+// - soa: pairs on 16 component streams.
+// The array of matrices forms are run on aligned_mat4, 16 byte aligned,
+// which the intrinsics path of operator* is written for, on packed_mat4,
+// and on packed_mat4 arrays shifted by one float so no matrix is aligned.
+//
+// Each measure repeats the batch until about 4M matrices are multiplied and
+// keeps the best of a few runs, in ns per matrix. The largest difference
+// from operator* over the results is printed as a check.
+//
+//     matbatch [--total n] [--runs n]
+
+#define GLM_FORCE_INTRINSICS
+#define GLM_FORCE_ALIGNED_GENTYPES
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtx/matrix_batch.hpp>
+
+#include "../common/bench.h"
+
+template<typename Matrix>
+Matrix randomMatrix(Random& random)
+{
+    Matrix m;
+    for(int c = 0; c < 4; c++) {
+        for(int r = 0; r < 4; r++) {
+            m[c][r] = random.range(-1.0f, 1.0f);
+        }
+    }
+    return m;
+}
+
+// Runs function, which multiplies count matrices, until total matrices are
+// done, best of runs, in ns per matrix.
+template<typename Function>
+double measure(std::size_t count, std::size_t total, int runs, Function function)
+{
+    const std::size_t repeats = std::max<std::size_t>(1, total / count);
+    double best = 1e30;
+    for(int run = 0; run < runs; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < repeats; i++) {
+            function();
+        }
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ns / double(repeats * count));
+    }
+    return best;
+}
+
+template<typename Matrix>
+float maxDifference(const Matrix* a, const Matrix* b, std::size_t count)
+{
+    float difference = 0.0f;
+    for(std::size_t i = 0; i < count; i++) {
+        for(int c = 0; c < 4; c++) {
+            for(int r = 0; r < 4; r++) {
+                difference = std::max(difference, std::abs(a[i][c][r] - b[i][c][r]));
+            }
+        }
+    }
+    return difference;
+}
+
+struct Row
+{
+    double loop;
+    double batch;
+    float difference;
+};
+
+// Pairs and parent on count matrices of A, B and Out, which may point
+// anywhere suitably sized.
+template<typename Matrix>
+void measureAos(Matrix* a, Matrix* b, Matrix* out, std::size_t count, std::size_t total, int runs,
+                Row& pairs, Row& parent)
+{
+    std::vector<Matrix> expected(count);
+    pairs.loop = measure(count, total, runs, [&]() {
+        for(std::size_t i = 0; i < count; i++) {
+            out[i] = a[i] * b[i];
+        }
+    });
+    std::copy(out, out + count, expected.begin());
+    pairs.batch = measure(count, total, runs, [&]() { glm::batchMul(a, b, out, count); });
+    pairs.difference = maxDifference(out, expected.data(), count);
+
+    const Matrix root = a[0];
+    parent.loop = measure(count, total, runs, [&]() {
+        for(std::size_t i = 0; i < count; i++) {
+            out[i] = root * b[i];
+        }
+    });
+    std::copy(out, out + count, expected.begin());
+    parent.batch = measure(count, total, runs, [&]() { glm::batchMul(root, b, out, count); });
+    parent.difference = maxDifference(out, expected.data(), count);
+}
+
+void printRow(const char* name, const Row& row)
+{
+    std::printf("  %-22s %9.2f ns %9.2f ns %7.2fx %10.1e\n", name, row.loop, row.batch, row.loop / row.batch,
+                double(row.difference));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t total = 4 << 20;
+    int runs = 3;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--total" && i + 1 < argc) {
+            total = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: matbatch [--total n] [--runs n]\n");
+            return 1;
+        }
+    }
+
+    const char* isa[] = { "scalar", "SSE2", "AVX2/FMA" };
+    std::printf("batch kernels: %s, %zu matrices a measure, best of %d\n", isa[glm::batchIsa()], total, runs);
+    std::printf("  %-22s %12s %12s %8s %10s\n", "", "operator*", "batchMul", "speedup", "max diff");
+
+    const std::size_t sizes[] = { 16, 256, 4096, 65536, 262144 };
+    for(std::size_t count : sizes) {
+        std::printf("%zu matrices\n", count);
+        Random random;
+
+        std::vector<glm::aligned_mat4> alignedA(count), alignedB(count), alignedOut(count);
+        for(std::size_t i = 0; i < count; i++) {
+            alignedA[i] = randomMatrix<glm::aligned_mat4>(random);
+            alignedB[i] = randomMatrix<glm::aligned_mat4>(random);
+        }
+        Row pairs, parent;
+        measureAos(alignedA.data(), alignedB.data(), alignedOut.data(), count, total, runs, pairs, parent);
+        printRow("pairs aligned_mat4", pairs);
+        printRow("parent aligned_mat4", parent);
+
+        // packed, then the same floats one float off
+        std::vector<float> packedA(count * 16 + 1), packedB(count * 16 + 1), packedOut(count * 16 + 1);
+        for(int shift = 0; shift < 2; shift++) {
+            std::copy(&alignedA[0][0][0], &alignedA[0][0][0] + count * 16, packedA.begin() + shift);
+            std::copy(&alignedB[0][0][0], &alignedB[0][0][0] + count * 16, packedB.begin() + shift);
+            glm::packed_mat4* a = reinterpret_cast<glm::packed_mat4*>(packedA.data() + shift);
+            glm::packed_mat4* b = reinterpret_cast<glm::packed_mat4*>(packedB.data() + shift);
+            glm::packed_mat4* out = reinterpret_cast<glm::packed_mat4*>(packedOut.data() + shift);
+            measureAos(a, b, out, count, total, runs, pairs, parent);
+            printRow(shift == 0 ? "pairs packed_mat4" : "pairs packed_mat4 + 4", pairs);
+            printRow(shift == 0 ? "parent packed_mat4" : "parent packed_mat4 + 4", parent);
+        }
+
+        // streams of the same matrices, operator* reading them back as a mat4
+        std::vector<float> streams(count * 16 * 3);
+        glm::soa_mat4 a, b, out;
+        for(int k = 0; k < 16; k++) {
+            a.c[k] = streams.data() + count * k;
+            b.c[k] = streams.data() + count * (16 + k);
+            out.c[k] = streams.data() + count * (32 + k);
+            for(std::size_t i = 0; i < count; i++) {
+                a.c[k][i] = alignedA[i][k / 4][k % 4];
+                b.c[k][i] = alignedB[i][k / 4][k % 4];
+            }
+        }
+        Row soa;
+        soa.loop = measure(count, total, runs, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                glm::mat4 ma, mb;
+                for(int k = 0; k < 16; k++) {
+                    ma[k / 4][k % 4] = a.c[k][i];
+                    mb[k / 4][k % 4] = b.c[k][i];
+                }
+                const glm::mat4 m = ma * mb;
+                for(int k = 0; k < 16; k++) {
+                    out.c[k][i] = m[k / 4][k % 4];
+                }
+            }
+        });
+        std::vector<float> expected(out.c[0], out.c[0] + count * 16);
+        soa.batch = measure(count, total, runs, [&]() { glm::batchMul(a, b, out, count); });
+        soa.difference = 0.0f;
+        for(std::size_t i = 0; i < count * 16; i++) {
+            soa.difference = std::max(soa.difference, std::abs(out.c[0][i] - expected[i]));
+        }
+        printRow("soa", soa);
+    }
+    return EXIT_SUCCESS;
+}
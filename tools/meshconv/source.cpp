@@ -0,0 +1,385 @@
+// meshconv: converts Wavefront OBJ files to the binary mesh file of
+// include/gl_mesh_file.h, checks such files and compares their load time
+// with the OBJ they come from.
+//
+//     meshconv [options] input.obj output.glmf
+//         --position float|half|unorm16
+//         --texcoord none|float|half|unorm16
+//         --normal none|float|snorm10|octahedral
+//     meshconv --check file.glmf
+//     meshconv --bench input.obj file.glmf [runs]
+//     meshconv --bench-obj input.obj [threads]
+//
+// The OBJ is read by include/gl_obj_loader.h. Every object or group, split
+// by material, becomes a mesh with one identity instance. Indices are 16
+// bits when they fit.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+
+#include <gl_vertex_format.h>
+#include <gl_mesh_file.h>
+#include <gl_obj_loader.h>
+
+#include "../common/bench.h"
+
+void copyName(char* destination, std::size_t size, const std::string& name)
+{
+    std::strncpy(destination, name.c_str(), size - 1);
+    destination[size - 1] = 0;
+}
+
+// The usual single threaded iostream loader, for --bench-obj: v, vt, vn
+// and f with positive indices only, welded with the same hash.
+bool loadObjIostream(const std::string& path, gl::ObjModel& model)
+{
+    std::ifstream file(path);
+    if(!file) {
+        return false;
+    }
+    model = gl::ObjModel();
+    std::vector<glm::vec3> positions, normals;
+    std::vector<glm::vec2> texCoords;
+    std::unordered_map<gl::ObjVertex, GLuint, gl::ObjVertexHash> ids;
+
+    std::string line, keyword;
+    while(std::getline(file, line)) {
+        std::istringstream stream(line);
+        stream >> keyword;
+        if(keyword == "v") {
+            glm::vec3 v;
+            stream >> v.x >> v.y >> v.z;
+            positions.push_back(v);
+        }
+        else if(keyword == "vt") {
+            glm::vec2 t;
+            stream >> t.x >> t.y;
+            texCoords.push_back(t);
+        }
+        else if(keyword == "vn") {
+            glm::vec3 n;
+            stream >> n.x >> n.y >> n.z;
+            normals.push_back(n);
+        }
+        else if(keyword == "f") {
+            std::vector<GLuint> polygon;
+            std::string corner;
+            while(stream >> corner) {
+                gl::ObjVertex vertex = {};
+                unsigned int p = 0, t = 0, n = 0;
+                char slash;
+                std::istringstream parts(corner);
+                parts >> p;
+                if(parts >> slash && parts.peek() != '/') {
+                    parts >> t;
+                }
+                if(parts >> slash) {
+                    parts >> n;
+                }
+                vertex.position = positions.at(p - 1);
+                vertex.texCoord = t > 0 ? texCoords.at(t - 1) : glm::vec2(0.0f);
+                vertex.normal = n > 0 ? normals.at(n - 1) : glm::vec3(0.0f);
+
+                auto found = ids.emplace(vertex, GLuint(model.vertices.size()));
+                if(found.second) {
+                    model.vertices.push_back(vertex);
+                }
+                polygon.push_back(found.first->second);
+            }
+            for(std::size_t i = 2; i < polygon.size(); i++) {
+                model.indices.push_back(polygon[0]);
+                model.indices.push_back(polygon[i - 1]);
+                model.indices.push_back(polygon[i]);
+            }
+        }
+    }
+    return true;
+}
+
+std::size_t alignSection(std::size_t offset)
+{
+    return (offset + gl::meshFileAlignment - 1) / gl::meshFileAlignment * gl::meshFileAlignment;
+}
+
+bool writeMeshFile(const std::string& path, const gl::ObjModel& model, const gl::CompiledVertices& compiled)
+{
+    std::vector<gl::MeshFileAttribute> attributes;
+    for(const gl::VertexAttribute& attribute : compiled.attributes) {
+        attributes.push_back({ attribute.location, attribute.size, attribute.type, attribute.normalized, attribute.offset });
+    }
+
+    const std::size_t vertexCount = compiled.vertexCount();
+    const bool shortIndices = vertexCount <= 65536;
+    std::vector<unsigned short> indices16;
+    if(shortIndices) {
+        indices16.assign(model.indices.begin(), model.indices.end());
+    }
+
+    std::vector<gl::MeshFileMesh> meshes;
+    for(const gl::ObjMesh& mesh : model.meshes) {
+        meshes.push_back({ mesh.firstIndex, mesh.indexCount, 0, mesh.material });
+    }
+    std::vector<gl::MeshFileMaterial> materials;
+    for(const gl::ObjMaterial& material : model.materials) {
+        gl::MeshFileMaterial entry = {};
+        copyName(entry.name, sizeof(entry.name), material.name);
+        copyName(entry.texture, sizeof(entry.texture), material.texture);
+        materials.push_back(entry);
+    }
+
+    std::vector<gl::MeshFileInstance> instances;
+    for(std::size_t i = 0; i < meshes.size(); i++) {
+        gl::MeshFileInstance instance = {};
+        instance.model[0] = instance.model[5] = instance.model[10] = instance.model[15] = 1.0f;
+        instance.mesh = unsigned(i);
+        instances.push_back(instance);
+    }
+
+    struct Payload
+    {
+        gl::MeshFileSectionType type;
+        std::uint32_t elementSize;
+        std::size_t count;
+        const void* data;
+    };
+    std::vector<Payload> payloads = {
+        { gl::MeshFileSectionType::Attributes, sizeof(gl::MeshFileAttribute), attributes.size(), attributes.data() },
+        { gl::MeshFileSectionType::Vertices, std::uint32_t(compiled.stride), vertexCount, compiled.data.data() },
+        shortIndices
+            ? Payload{ gl::MeshFileSectionType::Indices, 2, indices16.size(), indices16.data() }
+            : Payload{ gl::MeshFileSectionType::Indices, 4, model.indices.size(), model.indices.data() },
+        { gl::MeshFileSectionType::Meshes, sizeof(gl::MeshFileMesh), meshes.size(), meshes.data() },
+        { gl::MeshFileSectionType::Materials, sizeof(gl::MeshFileMaterial), materials.size(), materials.data() },
+        { gl::MeshFileSectionType::Instances, sizeof(gl::MeshFileInstance), instances.size(), instances.data() },
+    };
+
+    gl::MeshFileHeader header = {};
+    std::memcpy(header.magic, gl::meshFileMagic, sizeof(header.magic));
+    header.version = gl::meshFileVersion;
+    header.sectionCount = std::uint32_t(payloads.size());
+    header.vertexStride = std::uint32_t(compiled.stride);
+    header.indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    for(int i = 0; i < 3; i++) {
+        header.positionOffset[i] = compiled.positionOffset[i];
+        header.positionScale[i] = compiled.positionScale[i];
+    }
+
+    std::vector<gl::MeshFileSection> sections;
+    std::size_t offset = sizeof(header) + payloads.size() * sizeof(gl::MeshFileSection);
+    for(const Payload& payload : payloads) {
+        offset = alignSection(offset);
+        sections.push_back({ payload.type, payload.elementSize, payload.count, offset, payload.count * payload.elementSize });
+        offset += payload.count * payload.elementSize;
+    }
+    header.fileSize = offset;
+
+    std::vector<unsigned char> file(offset, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+    std::memcpy(file.data() + sizeof(header), sections.data(), sections.size() * sizeof(gl::MeshFileSection));
+    for(std::size_t i = 0; i < payloads.size(); i++) {
+        if(sections[i].size > 0) {
+            std::memcpy(file.data() + sections[i].offset, payloads[i].data, sections[i].size);
+        }
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(file.data()), std::streamsize(file.size()));
+    if(!out) {
+        std::cout << "can't write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool check(const std::string& path)
+{
+    gl::MeshFile file;
+    if(!file.open(path.c_str())) {
+        std::cout << path << ": " << file.error() << std::endl;
+        return false;
+    }
+    std::cout << path << ": " << file.vertexCount() << " vertices of " << file.header().vertexStride << " bytes, "
+              << file.indexCount() << (file.indexType() == GL_UNSIGNED_SHORT ? " 16" : " 32") << " bit indices, "
+              << file.meshes().size() << " meshes, " << file.materials().size() << " materials, "
+              << file.instances().size() << " instances" << std::endl;
+    return true;
+}
+
+// Both loads end with the vertices and indices in memory, ready for
+// glBufferData; the copies stand in for the upload.
+bool bench(const std::string& objPath, const std::string& meshPath, int runs)
+{
+    double objMs = 0.0, meshMs = 0.0;
+    std::vector<unsigned char> upload;
+    for(int run = 0; run < runs; run++) {
+        auto start = std::chrono::steady_clock::now();
+        gl::ObjModel model;
+        std::string error;
+        if(!gl::loadObj(objPath.c_str(), model, &error)) {
+            std::cout << error << std::endl;
+            return false;
+        }
+        const std::size_t vertexBytes = model.vertices.size() * sizeof(gl::ObjVertex);
+        upload.resize(vertexBytes + model.indices.size() * sizeof(GLuint));
+        std::memcpy(upload.data(), model.vertices.data(), vertexBytes);
+        std::memcpy(upload.data() + vertexBytes, model.indices.data(), model.indices.size() * sizeof(GLuint));
+        objMs += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        gl::MeshFile file;
+        if(!file.open(meshPath.c_str())) {
+            std::cout << meshPath << ": " << file.error() << std::endl;
+            return false;
+        }
+        upload.resize(file.vertexBytes() + file.indexBytes());
+        std::memcpy(upload.data(), file.vertexData(), file.vertexBytes());
+        std::memcpy(upload.data() + file.vertexBytes(), file.indexData(), file.indexBytes());
+        file.close();
+        meshMs += milliseconds(start);
+    }
+    std::cout << "obj  " << objMs / runs << " ms per load" << std::endl;
+    std::cout << "glmf " << meshMs / runs << " ms per load, " << objMs / meshMs << " times faster" << std::endl;
+    return true;
+}
+
+// Parsing speed of gl::loadObj against the iostream loader.
+bool benchObj(const std::string& objPath, unsigned int threads)
+{
+    struct stat info;
+    if(stat(objPath.c_str(), &info) != 0) {
+        std::cout << "can't read " << objPath << std::endl;
+        return false;
+    }
+    const double megabytes = double(info.st_size) / (1024.0 * 1024.0);
+
+    // the loader first, the iostream one leaves the heap fragmented
+    gl::ObjModel model;
+    std::string error;
+    auto start = std::chrono::steady_clock::now();
+    if(!gl::loadObj(objPath.c_str(), model, &error, threads)) {
+        std::cout << error << std::endl;
+        return false;
+    }
+    const double loaderMs = milliseconds(start);
+    const std::size_t vertices = model.vertices.size();
+    const std::size_t triangles = model.indices.size() / 3;
+    model = gl::ObjModel();
+
+    start = std::chrono::steady_clock::now();
+    if(!loadObjIostream(objPath, model)) {
+        return false;
+    }
+    const double iostreamMs = milliseconds(start);
+
+    std::cout << megabytes << " MB, " << vertices << " vertices (iostream " << model.vertices.size() << "), "
+              << triangles << " triangles" << std::endl;
+    std::cout << "iostream   " << iostreamMs << " ms, " << megabytes / iostreamMs * 1000.0 << " MB/s" << std::endl;
+    std::cout << "gl::loadObj " << loaderMs << " ms, " << megabytes / loaderMs * 1000.0 << " MB/s" << std::endl;
+    return true;
+}
+
+void usage()
+{
+    std::cout << "usage: meshconv [--position float|half|unorm16] [--texcoord none|float|half|unorm16]" << std::endl
+              << "                [--normal none|float|snorm10|octahedral] input.obj output.glmf" << std::endl
+              << "       meshconv --check file.glmf" << std::endl
+              << "       meshconv --bench input.obj file.glmf [runs]" << std::endl
+              << "       meshconv --bench-obj input.obj [threads]" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc >= 3 && std::strcmp(argv[1], "--check") == 0) {
+        return check(argv[2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if(argc >= 4 && std::strcmp(argv[1], "--bench") == 0) {
+        return bench(argv[2], argv[3], argc >= 5 ? std::atoi(argv[4]) : 10) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if(argc >= 3 && std::strcmp(argv[1], "--bench-obj") == 0) {
+        return benchObj(argv[2], argc >= 4 ? unsigned(std::atoi(argv[3])) : 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    gl::VertexFormat format;
+    bool normalGiven = false;
+    bool texCoordGiven = false;
+    std::vector<std::string> paths;
+    for(int i = 1; i < argc; i++) {
+        const std::string argument = argv[i];
+        const std::string value = i + 1 < argc ? argv[i + 1] : "";
+        if(argument == "--position") {
+            if(value == "half") format.position = gl::PositionEncoding::Half;
+            else if(value == "unorm16") format.position = gl::PositionEncoding::Unorm16;
+            else if(value != "float") { usage(); return EXIT_FAILURE; }
+            i++;
+        }
+        else if(argument == "--texcoord") {
+            if(value == "none") format.texCoord = gl::TexCoordEncoding::None;
+            else if(value == "half") format.texCoord = gl::TexCoordEncoding::Half;
+            else if(value == "unorm16") format.texCoord = gl::TexCoordEncoding::Unorm16;
+            else if(value != "float") { usage(); return EXIT_FAILURE; }
+            texCoordGiven = true;
+            i++;
+        }
+        else if(argument == "--normal") {
+            if(value == "none") format.normal = gl::NormalEncoding::None;
+            else if(value == "float") format.normal = gl::NormalEncoding::Float;
+            else if(value == "snorm10") format.normal = gl::NormalEncoding::Snorm10;
+            else if(value == "octahedral") format.normal = gl::NormalEncoding::Octahedral;
+            else { usage(); return EXIT_FAILURE; }
+            normalGiven = true;
+            i++;
+        }
+        else {
+            paths.push_back(argument);
+        }
+    }
+    if(paths.size() != 2) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    gl::ObjModel model;
+    std::string error;
+    if(!gl::loadObj(paths[0].c_str(), model, &error)) {
+        std::cout << error << std::endl;
+        return EXIT_FAILURE;
+    }
+    if(model.indices.empty()) {
+        std::cout << paths[0] << ": no faces" << std::endl;
+        return EXIT_FAILURE;
+    }
+    // attributes the OBJ doesn't have are left out unless asked for
+    if(!texCoordGiven && !model.hasTexCoords) {
+        format.texCoord = gl::TexCoordEncoding::None;
+    }
+    if(!normalGiven && model.hasNormals) {
+        format.normal = gl::NormalEncoding::Float;
+    }
+
+    gl::VertexSource source;
+    source.positions = &model.vertices[0].position.x;
+    source.texCoords = &model.vertices[0].texCoord.x;
+    source.normals = &model.vertices[0].normal.x;
+    source.count = model.vertices.size();
+    source.stride = sizeof(gl::ObjVertex) / sizeof(float);
+    const gl::CompiledVertices compiled = gl::compileVertices(source, format);
+
+    if(!writeMeshFile(paths[1], model, compiled)) {
+        return EXIT_FAILURE;
+    }
+    return check(paths[1]) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
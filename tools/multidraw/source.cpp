@@ -0,0 +1,238 @@
+// Compares MultiDrawRenderer's single glMultiDrawElementsIndirect with its
+// fallback, one glDrawElementsBaseVertex and one glUniformMatrix4fv per
+// mesh, which is the per draw loop of the examples: n meshes of three
+// shapes sharing one vertex array, each turning with its own model matrix.
+//
+// Each frame computes the matrices, queues the meshes, submits them and
+// waits for the GPU. The CPU column is the time from begin() to the end of
+// submit(), the frame column includes the wait. The indirect path needs GL
+// 4.3 and GL_ARB_buffer_storage, on other contexts only the fallback runs.
+// Both paths draw the same last frame, the images are compared.
+//
+//     multidraw [--meshes n] [--frames n]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <gl_state_cache.h>
+#include <gl_multi_draw.h>
+#include <GLFW/glfw3.h>
+
+#include "../common/bench.h"
+
+#define SCREEN_SIZE 256
+
+const char* indirectVertexSource =
+    "#version 430 core\n"
+    "layout(location = 0) in vec3 position;\n"
+    "layout(location = 15) in uint drawId;\n"
+    "layout(std430, binding = 0) readonly buffer Transforms { mat4 models[]; };\n"
+    "out vec3 local;\n"
+    "void main() { local = position; gl_Position = models[drawId] * vec4(position, 1.0); }\n";
+
+const char* fallbackVertexSource =
+    "#version 330 core\n"
+    "layout(location = 0) in vec3 position;\n"
+    "uniform mat4 model;\n"
+    "out vec3 local;\n"
+    "void main() { local = position; gl_Position = model * vec4(position, 1.0); }\n";
+
+const char* fragmentSource =
+    "#version 330 core\n"
+    "in vec3 local;\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = vec4(local * 0.5 + 0.5, 1.0); }\n";
+
+gl::Program createProgram(gl::StateCache& state, const char* vertexSource)
+{
+    gl::Program program = state.createProgram();
+    const char* sources[2] = { vertexSource, fragmentSource };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], nullptr);
+        glCompileShader(shader);
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if(!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+            std::fprintf(stderr, "shader compilation error: %s\n", infoLog);
+            std::exit(EXIT_FAILURE);
+        }
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+    return program;
+}
+
+// A cube, a tetrahedron and an octahedron in one vertex and index buffer.
+std::vector<gl::MultiDrawRenderer::Mesh> createShapes(gl::StateCache& state, gl::VertexArray vao)
+{
+    const float vertices[] = {
+        -1, -1, -1, 1, -1, -1, 1, 1, -1, -1, 1, -1, -1, -1, 1, 1, -1, 1, 1, 1, 1, -1, 1, 1,
+        1, 1, 1, -1, -1, 1, -1, 1, -1, 1, -1, -1,
+        1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1,
+    };
+    const GLuint indices[] = {
+        0, 1, 2, 2, 3, 0, 4, 6, 5, 6, 4, 7, 0, 4, 5, 5, 1, 0, 3, 2, 6, 6, 7, 3, 0, 3, 7, 7, 4, 0, 1, 5, 6, 6, 2, 1,
+        0, 1, 2, 0, 3, 1, 0, 2, 3, 1, 3, 2,
+        0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5,
+    };
+    state.bindVertexArray(vao);
+    gl::Buffer vbo = state.createBuffer();
+    state.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    gl::Buffer ebo = state.createBuffer();
+    state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+    return { { 36, 0, 0 }, { 12, 36, 8 }, { 24, 48, 12 } };
+}
+
+struct Result
+{
+    double cpu = 0.0;
+    double frame = 0.0;
+    std::vector<unsigned char> image;
+};
+
+Result run(GLFWwindow* window, gl::StateCache& state, bool indirect, unsigned int meshes, int frames)
+{
+    gl::VertexArray vao = state.createVertexArray();
+    const std::vector<gl::MultiDrawRenderer::Mesh> shapes = createShapes(state, vao);
+    gl::MultiDrawRenderer renderer(meshes);
+    renderer.init(state, vao, indirect);
+    const gl::Program program = createProgram(state, renderer.indirect() ? indirectVertexSource : fallbackVertexSource);
+    const GLint modelLocation = glGetUniformLocation(program.id, "model");
+
+    // meshes on a grid filling the window
+    const unsigned int side = unsigned(std::ceil(std::sqrt(float(meshes))));
+    const float cell = 2.0f / float(side);
+    std::vector<glm::mat4> models(meshes);
+
+    Result result;
+    for(int frame = 0; frame < frames; frame++) {
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        state.useProgram(program);
+
+        const auto start = std::chrono::steady_clock::now();
+        renderer.begin();
+        const float time = float(frame) * 0.02f;
+        for(unsigned int i = 0; i < meshes; i++) {
+            const glm::vec3 center(-1.0f + cell * (float(i % side) + 0.5f), -1.0f + cell * (float(i / side) + 0.5f), 0.0f);
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), center);
+            model = glm::rotate(model, time + float(i), glm::vec3(1.0f, 0.3f, 0.5f));
+            models[i] = glm::scale(model, glm::vec3(cell * 0.3f));
+            renderer.draw(shapes[i % shapes.size()], glm::value_ptr(models[i]));
+        }
+        renderer.submit(state, modelLocation);
+        const double cpu = milliseconds(start);
+        glfwSwapBuffers(window);
+        glFinish();
+        // the first frame compiles the program and uploads the buffers
+        if(frame > 0) {
+            result.cpu += cpu;
+            result.frame += milliseconds(start);
+        }
+    }
+    result.cpu /= std::max(1, frames - 1);
+    result.frame /= std::max(1, frames - 1);
+
+    // the last frame again, to the back buffer read below
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    renderer.begin();
+    for(unsigned int i = 0; i < meshes; i++) {
+        renderer.draw(shapes[i % shapes.size()], glm::value_ptr(models[i]));
+    }
+    renderer.submit(state, modelLocation);
+    result.image.resize(SCREEN_SIZE * SCREEN_SIZE * 4);
+    glReadPixels(0, 0, SCREEN_SIZE, SCREEN_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, result.image.data());
+    if(renderer.overflowDraws() != 0) {
+        std::fprintf(stderr, "Error: %lu draws refused\n", renderer.overflowDraws());
+    }
+    std::printf("%-10s %9.2f ms %9.2f ms %12lu\n", renderer.indirect() ? "indirect" : "per draw", result.cpu,
+                result.frame, renderer.stalledFrames());
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int meshes = 10000;
+    int frames = 100;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--meshes" && i + 1 < argc) {
+            meshes = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::max(2, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: multidraw [--meshes n] [--frames n]\n");
+            return 1;
+        }
+    }
+
+    // the indirect path needs 4.3, macOS stops at 4.1 and gets the fallback
+    glfwInit();
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    const int versions[3][2] = { { 4, 6 }, { 4, 3 }, { 3, 3 } };
+    GLFWwindow* window = nullptr;
+    for(const int* version : versions) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, version[0]);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, version[1]);
+        window = glfwCreateWindow(SCREEN_SIZE, SCREEN_SIZE, "multidraw", nullptr, nullptr);
+        if(window != nullptr) {
+            break;
+        }
+    }
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    gl::StateCache glState;
+    glState.viewport(0, 0, SCREEN_SIZE, SCREEN_SIZE);
+    glState.enable(GL_DEPTH_TEST);
+
+    std::printf("%u meshes, %d frames, %s, %s\n", meshes, frames, reinterpret_cast<const char*>(glGetString(GL_VERSION)),
+                reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-10s %12s %12s %12s\n", "", "CPU", "frame", "stalls");
+    const Result perDraw = run(window, glState, false, meshes, frames);
+    if(!gl::MultiDrawRenderer::supported()) {
+        std::printf("indirect path not supported, needs GL 4.3 and GL_ARB_buffer_storage\n");
+    }
+    else {
+        const Result indirect = run(window, glState, true, meshes, frames);
+        std::size_t differ = 0;
+        for(std::size_t i = 0; i < perDraw.image.size(); i += 4) {
+            differ += std::equal(&perDraw.image[i], &perDraw.image[i] + 4, &indirect.image[i]) ? 0 : 1;
+        }
+        std::printf("indirect: %zu of %d pixels differ from per draw\n", differ, SCREEN_SIZE * SCREEN_SIZE);
+    }
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
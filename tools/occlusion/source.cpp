@@ -0,0 +1,256 @@
+// Measures the occlusion culler on a generated city: blocks of buildings
+// with about 100k boxes in total, cars, lamps and rooftop units, seen from
+// the street and from above.
+//
+// The buildings near the camera are the occluders, every object's bounding
+// box is then tested. For each view the tool prints the share of objects
+// outside the frustum, occluded and visible, and the time spent rendering
+// the occluders and testing the boxes.
+//
+//     occlusion [--size WxH] [--threads n] [--verify]
+//         --size is the culling buffer, 320x180 by default
+//         --verify renders every object with the software rasterizer at
+//         640x360 and counts those culled although a pixel of them shows
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_occlusion_culler.h>
+#include <gl_soft_rasterizer.h>
+
+#include "../common/bench.h"
+
+constexpr int blocks = 24;              // per side
+constexpr float blockSize = 60.0f;
+constexpr float streetWidth = 16.0f;
+constexpr float pitch = blockSize + streetWidth;
+
+struct City
+{
+    std::vector<gl::OcclusionBox> objects;
+    std::size_t buildingCount = 0;      // the first objects
+};
+
+gl::OcclusionBox makeBox(float x, float y, float z, float sx, float sy, float sz)
+{
+    return { glm::vec3(x, y, z), glm::vec3(x + sx, y + sy, z + sz) };
+}
+
+City generateCity()
+{
+    City city;
+    Random random;
+    const float lot = blockSize / 3.0f;
+    const float center = blocks * pitch * 0.5f;
+
+    // 3x3 buildings per block, taller downtown
+    for(int bz = 0; bz < blocks; bz++) {
+        for(int bx = 0; bx < blocks; bx++) {
+            const float x = bx * pitch;
+            const float z = bz * pitch;
+            const float distance = glm::length(glm::vec2(x - center, z - center)) / center;
+            const float tallest = glm::mix(90.0f, 15.0f, std::min(distance, 1.0f));
+            for(int lz = 0; lz < 3; lz++) {
+                for(int lx = 0; lx < 3; lx++) {
+                    const float inset = random.range(0.5f, 2.0f);
+                    city.objects.push_back(makeBox(x + lx * lot + inset, 0.0f, z + lz * lot + inset,
+                                                   lot - 2.0f * inset, random.range(6.0f, tallest), lot - 2.0f * inset));
+                }
+            }
+        }
+    }
+    city.buildingCount = city.objects.size();
+
+    // rooftop units on every building
+    for(std::size_t i = 0; i < city.buildingCount; i++) {
+        const gl::OcclusionBox roof = city.objects[i];
+        for(int k = 0; k < 10; k++) {
+            const float x = random.range(roof.low.x + 1.0f, roof.high.x - 3.0f);
+            const float z = random.range(roof.low.z + 1.0f, roof.high.z - 3.0f);
+            city.objects.push_back(makeBox(x, roof.high.y, z, 2.0f, random.range(1.0f, 3.0f), 2.0f));
+        }
+    }
+
+    // along both sides of the streets: cars and lamps
+    for(int bz = 0; bz < blocks; bz++) {
+        for(int bx = 0; bx < blocks; bx++) {
+            const float x = bx * pitch;
+            const float z = bz * pitch;
+            for(int k = 0; k < 56; k++) {
+                const float along = random.range(0.0f, blockSize + streetWidth);
+                const float side = random.next() < 0.5f ? 1.5f : streetWidth - 4.5f;
+                if(k % 2 == 0) {
+                    city.objects.push_back(makeBox(x + along, 0.0f, z + blockSize + side, 4.0f, 1.5f, 2.0f));
+                }
+                else {
+                    city.objects.push_back(makeBox(x + blockSize + side + 1.0f, 0.0f, z + along, 2.0f, 1.5f, 4.0f));
+                }
+            }
+            for(int k = 0; k < 8; k++) {
+                const float along = k * blockSize / 8.0f;
+                city.objects.push_back(makeBox(x + along, 0.0f, z + blockSize + 0.5f, 0.3f, 5.0f, 0.3f));
+                city.objects.push_back(makeBox(x + blockSize + 0.5f, 0.0f, z + along, 0.3f, 5.0f, 0.3f));
+            }
+        }
+    }
+    return city;
+}
+
+struct View
+{
+    const char* name;
+    glm::vec3 eye;
+    glm::vec3 target;
+};
+
+glm::vec4 shadeId(const float*, const void* uniforms)
+{
+    const std::uint32_t id = *static_cast<const std::uint32_t*>(uniforms);
+    return glm::vec4(float(id & 0xff), float((id >> 8) & 0xff), float((id >> 16) & 0xff), 255.0f) / 255.0f;
+}
+
+// Renders the objects not outside the frustum with their index as color,
+// returns how many were culled as occluded although visible.
+std::size_t verify(const City& city, const glm::mat4& viewProjection, const std::vector<gl::CullResult>& results)
+{
+    static const std::uint32_t boxIndices[36] = {
+        0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 4, 2, 2, 4, 6,
+        1, 3, 5, 3, 7, 5, 0, 1, 4, 1, 5, 4, 2, 6, 3, 3, 6, 7
+    };
+    gl::SoftRasterizer rasterizer(640, 360);
+    rasterizer.depthTest(true);
+    rasterizer.clear(glm::vec4(1.0f));
+
+    std::vector<std::uint32_t> ids(city.objects.size());
+    std::vector<gl::SoftVertex> vertices(8);
+    for(std::size_t i = 0; i < city.objects.size(); i++) {
+        if(results[i] == gl::CullResult::Outside) {
+            continue;
+        }
+        const gl::OcclusionBox& box = city.objects[i];
+        for(int c = 0; c < 8; c++) {
+            vertices[c].position = viewProjection * glm::vec4(c & 1 ? box.high.x : box.low.x,
+                                                              c & 2 ? box.high.y : box.low.y,
+                                                              c & 4 ? box.high.z : box.low.z, 1.0f);
+        }
+        ids[i] = std::uint32_t(i);
+        rasterizer.drawIndexed(vertices.data(), boxIndices, 36, 0, shadeId, &ids[i]);
+    }
+    rasterizer.flush();
+
+    std::vector<bool> seen(city.objects.size(), false);
+    for(int y = 0; y < rasterizer.height(); y++) {
+        for(int x = 0; x < rasterizer.width(); x++) {
+            const std::uint32_t id = rasterizer.pixel(x, y) & 0xffffff;
+            if(id < seen.size()) {
+                seen[id] = true;
+            }
+        }
+    }
+    std::size_t wrong = 0;
+    for(std::size_t i = 0; i < seen.size(); i++) {
+        wrong += seen[i] && results[i] == gl::CullResult::Occluded ? 1 : 0;
+    }
+    return wrong;
+}
+
+int main(int argc, char** argv)
+{
+    int width = 320;
+    int height = 180;
+    unsigned int threads = 0;
+    bool check = false;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--size" && i + 1 < argc && std::sscanf(argv[i + 1], "%dx%d", &width, &height) == 2) {
+            i++;
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else if(arg == "--verify") {
+            check = true;
+        }
+        else {
+            std::fprintf(stderr, "usage: occlusion [--size WxH] [--threads n] [--verify]\n");
+            return 1;
+        }
+    }
+
+    const City city = generateCity();
+    std::printf("%zu objects, %zu buildings\n", city.objects.size(), city.buildingCount);
+
+    const float middle = blocks * pitch * 0.5f;
+    const float street = 10 * pitch + blockSize + streetWidth * 0.5f;
+    const View views[] = {
+        { "street", glm::vec3(street, 1.8f, 40.0f), glm::vec3(street, 1.8f, 400.0f) },
+        { "street diagonal", glm::vec3(street, 1.8f, middle), glm::vec3(street + 300.0f, 10.0f, middle + 200.0f) },
+        { "crossing", glm::vec3(street, 1.8f, street), glm::vec3(street - 300.0f, 1.8f, street - 150.0f) },
+        { "downtown", glm::vec3(street + 2.0f * pitch, 1.8f, street), glm::vec3(middle - 200.0f, 40.0f, street - 400.0f) },
+        { "rooftop", glm::vec3(street, 60.0f, street), glm::vec3(middle + 400.0f, 0.0f, middle + 500.0f) },
+        { "aerial", glm::vec3(-100.0f, 250.0f, -100.0f), glm::vec3(middle, 0.0f, middle) },
+    };
+
+    gl::OcclusionCuller culler(width, height, threads);
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), float(width) / float(height), 0.5f, 3000.0f);
+    std::vector<gl::CullResult> results(city.objects.size());
+    std::vector<std::pair<float, std::size_t>> nearby;
+    const int runs = 10;
+
+    std::printf("culling buffer %dx%d\n", culler.width(), culler.height());
+    std::printf("%-16s %9s %9s %9s %11s %9s %9s\n", "view", "outside", "occluded", "visible", "occluders", "render", "test");
+    for(const View& view : views) {
+        const glm::mat4 viewProjection = projection * glm::lookAt(view.eye, view.target, glm::vec3(0.0f, 1.0f, 0.0f));
+
+        double renderTime = 0.0, testTime = 0.0;
+        std::size_t occluders = 0;
+        for(int run = 0; run < runs; run++) {
+            auto start = std::chrono::steady_clock::now();
+
+            // the nearest buildings in front of the camera are the occluders
+            nearby.clear();
+            const glm::vec3 forward = glm::normalize(view.target - view.eye);
+            for(std::size_t i = 0; i < city.buildingCount; i++) {
+                const gl::OcclusionBox& box = city.objects[i];
+                const glm::vec3 center = (box.low + box.high) * 0.5f;
+                const float distance = glm::length(center - view.eye);
+                if(distance < 400.0f && glm::dot(center - view.eye, forward) > -40.0f) {
+                    nearby.push_back({ distance, i });
+                }
+            }
+            occluders = std::min<std::size_t>(nearby.size(), 256);
+            std::partial_sort(nearby.begin(), nearby.begin() + occluders, nearby.end());
+
+            culler.clear();
+            for(std::size_t i = 0; i < occluders; i++) {
+                culler.addOccluder(viewProjection, city.objects[nearby[i].second]);
+            }
+            culler.render();
+            renderTime += milliseconds(start);
+
+            start = std::chrono::steady_clock::now();
+            culler.testBoxes(viewProjection, city.objects.data(), city.objects.size(), results.data());
+            testTime += milliseconds(start);
+        }
+
+        std::size_t counts[3] = { 0, 0, 0 };
+        for(gl::CullResult result : results) {
+            counts[int(result)]++;
+        }
+        const double total = double(city.objects.size()) / 100.0;
+        std::printf("%-16s %8.1f%% %8.1f%% %8.1f%% %11zu %6.2f ms %6.2f ms\n", view.name, counts[2] / total, counts[1] / total,
+                    counts[0] / total, occluders, renderTime / runs, testTime / runs);
+
+        if(check) {
+            std::printf("  %zu objects occluded although visible\n", verify(city, viewProjection, results));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,287 @@
+// Measures GLM_GTX_packing_batch against the scalar functions of
+// GLM_GTC_packing, and checks the error bounds the extension documents:
+// - half: batchPackHalf vs packHalf1x16, floats in [-1000, 1000],
+// - unorm16: batchPackUnorm16 vs packUnorm1x16, positions mapped to [0, 1]
+//   over their bounding box,
+// - 10_10_10_2: batchPackSnorm3x10_1x2 vs packSnorm3x10_1x2, unit normals,
+// - octahedral: batchPackOctahedral vs packSnorm2x16(packOctahedral()).
+// Throughputs are the best of a few runs, in millions of floats or normals
+// per second. Errors are measured on the batch results decoded with the
+// unpack functions of GLM_GTC_packing, the tool fails if one is over its
+// bound. The count of results differing from the scalar ones, ties rounded
+// the other way, is printed too.
+//
+// Last, gl::compileVertices quantizes a mesh of n vertices with a position,
+// texture coordinate and normal into a few formats, which prints their
+// bytes per vertex and the time compiling takes. The normals it encodes
+// with legacySnorm are decoded the way GL before 4.2 does and checked
+// against the bounds of gl_vertex_format.h.
+//
+//     packing [--count n] [--runs n]
+
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/packing_batch.hpp>
+#include <gl_state_cache.h>
+#include <gl_vertex_format.h>
+
+#include "../common/bench.h"
+
+// Best time of runs calls to function, in ms.
+template<typename Function>
+double measure(int runs, Function function)
+{
+    double best = 1e30;
+    for(int run = 0; run < runs; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        best = std::min(best, milliseconds(start));
+    }
+    return best;
+}
+
+double degrees(const glm::vec3& a, const glm::vec3& b)
+{
+    const double cosine = glm::dot(glm::dvec3(a), glm::dvec3(b)) / (glm::length(glm::dvec3(a)) * glm::length(glm::dvec3(b)));
+    return std::acos(std::min(1.0, cosine)) * 180.0 / 3.14159265358979323846;
+}
+
+// The signed integer of bits bits at shift in packed, decoded the way GL
+// before 4.2 does, (2c + 1) / (2^bits - 1).
+float unpackLegacySnorm(glm::uint32 packed, unsigned int shift, unsigned int bits)
+{
+    const std::int32_t c = std::int32_t(packed << (32 - bits - shift)) >> (32 - bits);
+    return float(2 * c + 1) / float((1u << bits) - 1u);
+}
+
+bool failed = false;
+
+void print(const char* name, std::size_t count, double scalar, double batch, std::size_t differ, const char* error,
+           double value, double bound)
+{
+    const bool over = value > bound;
+    failed = failed || over;
+    std::printf("%-12s %9.0f %9.0f %8.1fx %9zu   %-22s %10.3g %10.3g%s\n", name, count / scalar / 1000.0,
+                count / batch / 1000.0, scalar / batch, differ, error, value, bound, over ? "  OVER" : "");
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1 << 20;
+    int runs = 5;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::max(4, std::atoi(argv[++i]))) / 4 * 4;
+        }
+        else if(arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: packing [--count n] [--runs n]\n");
+            return 1;
+        }
+    }
+
+    Random random;
+    std::vector<float> floats(count);
+    for(float& f : floats) {
+        f = random.range(-1000.0f, 1000.0f);
+    }
+    const glm::vec3 boxMin(-50.0f, -10.0f, 0.0f), boxMax(50.0f, 10.0f, 2.0f);
+    std::vector<glm::vec4> positions(count / 4);
+    for(glm::vec4& p : positions) {
+        p = glm::vec4(random.range(boxMin.x, boxMax.x), random.range(boxMin.y, boxMax.y), random.range(boxMin.z, boxMax.z), 0.0f);
+    }
+    std::vector<glm::vec3> normals(count);
+    for(glm::vec3& n : normals) {
+        n = random.unitVector();
+    }
+
+    std::printf("%zu values, best of %d runs, M/s of floats or normals\n", count, runs);
+    std::printf("%-12s %9s %9s %9s %9s   %-22s %10s %10s\n", "", "scalar", "batch", "speedup", "differ", "largest error",
+                "measured", "bound");
+
+    // half
+    {
+        std::vector<glm::uint16> scalar(count), batch(count);
+        const double scalarTime = measure(runs, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                scalar[i] = glm::packHalf1x16(floats[i]);
+            }
+        });
+        const double batchTime = measure(runs, [&]() { glm::batchPackHalf(floats.data(), batch.data(), 0, count); });
+        std::size_t differ = 0;
+        double error = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            differ += scalar[i] != batch[i] ? 1 : 0;
+            const double x = floats[i];
+            if(std::abs(x) >= 1.0 / 16384.0) {
+                error = std::max(error, std::abs(double(glm::unpackHalf1x16(batch[i])) - x) / std::abs(x));
+            }
+        }
+        print("half", count, scalarTime, batchTime, differ, "relative", error, 1.0 / 2048.0);
+    }
+
+    // unorm16 over the bounding box
+    {
+        const glm::vec3 extent = boxMax - boxMin;
+        const glm::vec4 scale(1.0f / extent, 0.0f), bias(-boxMin / extent, 0.0f);
+        const float* in = &positions[0].x;
+        std::vector<glm::uint16> scalar(count), batch(count);
+        const double scalarTime = measure(runs, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                scalar[i] = glm::packUnorm1x16(in[i] * scale[i % 4] + bias[i % 4]);
+            }
+        });
+        const double batchTime = measure(runs, [&]() { glm::batchPackUnorm16(in, scale, bias, batch.data(), 0, count); });
+        std::size_t differ = 0;
+        double error = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            differ += scalar[i] != batch[i] ? 1 : 0;
+            if(i % 4 < 3) {
+                const double decoded = double(boxMin[i % 4]) + double(glm::unpackUnorm1x16(batch[i])) * double(extent[i % 4]);
+                error = std::max(error, std::abs(decoded - double(in[i])) / double(extent[i % 4]));
+            }
+        }
+        // half a unit, plus the float rounding of the scale and bias
+        print("unorm16", count, scalarTime, batchTime, differ, "of the extent", error, 1.0 / 131070.0 + 1e-6);
+    }
+
+    // 10_10_10_2 normals
+    {
+        std::vector<glm::uint32> scalar(count), batch(count);
+        const double scalarTime = measure(runs, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                scalar[i] = glm::packSnorm3x10_1x2(glm::vec4(normals[i], 0.0f));
+            }
+        });
+        const double batchTime = measure(runs, [&]() { glm::batchPackSnorm3x10_1x2(normals.data(), batch.data(), 0, count); });
+        std::size_t differ = 0;
+        double component = 0.0, angle = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            differ += scalar[i] != batch[i] ? 1 : 0;
+            const glm::vec3 decoded(glm::unpackSnorm3x10_1x2(batch[i]));
+            for(int c = 0; c < 3; c++) {
+                component = std::max(component, std::abs(double(decoded[c]) - double(normals[i][c])));
+            }
+            angle = std::max(angle, degrees(decoded, normals[i]));
+        }
+        print("10_10_10_2", count, scalarTime, batchTime, differ, "per component", component, 1.0 / 1022.0 + 1e-6);
+        std::printf("%-12s %9s %9s %9s %9s   %-22s %10.3g\n", "", "", "", "", "", "degrees", angle);
+    }
+
+    // octahedral normals
+    {
+        std::vector<glm::uint32> scalar(count), batch(count);
+        const double scalarTime = measure(runs, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                scalar[i] = glm::packSnorm2x16(glm::packOctahedral(normals[i]));
+            }
+        });
+        const double batchTime = measure(runs, [&]() { glm::batchPackOctahedral(normals.data(), batch.data(), 0, count); });
+        std::size_t differ = 0;
+        double angle = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            differ += scalar[i] != batch[i] ? 1 : 0;
+            angle = std::max(angle, degrees(glm::unpackOctahedral(glm::unpackSnorm2x16(batch[i])), normals[i]));
+        }
+        print("octahedral", count, scalarTime, batchTime, differ, "degrees", angle, 0.004);
+    }
+
+    // the vertex format compiler on a whole mesh
+    std::vector<float> vertices(count * 8);
+    for(std::size_t i = 0; i < count; i++) {
+        float* v = &vertices[i * 8];
+        v[0] = random.range(boxMin.x, boxMax.x);
+        v[1] = random.range(boxMin.y, boxMax.y);
+        v[2] = random.range(boxMin.z, boxMax.z);
+        v[3] = random.next();
+        v[4] = random.next();
+        v[5] = normals[i].x;
+        v[6] = normals[i].y;
+        v[7] = normals[i].z;
+    }
+    gl::VertexSource source;
+    source.positions = &vertices[0];
+    source.texCoords = &vertices[3];
+    source.normals = &vertices[5];
+    source.count = count;
+    source.stride = 8;
+
+    struct Format
+    {
+        const char* name;
+        gl::PositionEncoding position;
+        gl::TexCoordEncoding texCoord;
+        gl::NormalEncoding normal;
+    };
+    const Format formats[] = {
+        { "float, float, float", gl::PositionEncoding::Float, gl::TexCoordEncoding::Float, gl::NormalEncoding::Float },
+        { "half, half, 10_10_10_2", gl::PositionEncoding::Half, gl::TexCoordEncoding::Half, gl::NormalEncoding::Snorm10 },
+        { "unorm16, unorm16, octahedral", gl::PositionEncoding::Unorm16, gl::TexCoordEncoding::Unorm16,
+          gl::NormalEncoding::Octahedral },
+    };
+    std::printf("\ncompileVertices, %zu vertices of position, texture coordinate and normal\n", count);
+    for(const Format& f : formats) {
+        gl::VertexFormat format;
+        format.position = f.position;
+        format.texCoord = f.texCoord;
+        format.normal = f.normal;
+        gl::CompiledVertices compiled;
+        const double time = measure(runs, [&]() { compiled = gl::compileVertices(source, format); });
+        std::printf("  %-30s %3d bytes per vertex %9.2f ms\n", f.name, compiled.stride, time);
+    }
+
+    std::printf("\ncompileVertices with legacySnorm, normals decoded as (2c + 1) / (2^b - 1)\n");
+    for(gl::NormalEncoding normal : { gl::NormalEncoding::Snorm10, gl::NormalEncoding::Octahedral }) {
+        gl::VertexFormat format;
+        format.texCoord = gl::TexCoordEncoding::None;
+        format.normal = normal;
+        format.legacySnorm = true;
+        const gl::CompiledVertices compiled = gl::compileVertices(source, format);
+        const GLuint offset = compiled.attributes.back().offset;
+        double component = 0.0, angle = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            glm::uint32 packed;
+            std::memcpy(&packed, &compiled.data[i * std::size_t(compiled.stride) + offset], sizeof(packed));
+            glm::vec3 decoded;
+            if(normal == gl::NormalEncoding::Snorm10) {
+                decoded = glm::vec3(unpackLegacySnorm(packed, 0, 10), unpackLegacySnorm(packed, 10, 10),
+                                    unpackLegacySnorm(packed, 20, 10));
+                for(int c = 0; c < 3; c++) {
+                    component = std::max(component, std::abs(double(decoded[c]) - double(normals[i][c])));
+                }
+            }
+            else {
+                decoded = glm::unpackOctahedral(glm::vec2(unpackLegacySnorm(packed, 0, 16), unpackLegacySnorm(packed, 16, 16)));
+            }
+            angle = std::max(angle, degrees(decoded, normals[i]));
+        }
+        if(normal == gl::NormalEncoding::Snorm10) {
+            const double bound = 1.0 / 1023.0 + 1e-6;
+            failed = failed || component > bound;
+            std::printf("  %-30s %10.3g per component, bound %.3g%s\n", "10_10_10_2", component, bound,
+                        component > bound ? "  OVER" : "");
+        }
+        else {
+            failed = failed || angle > 0.004;
+            std::printf("  %-30s %10.3g degrees, bound 0.004%s\n", "octahedral", angle, angle > 0.004 ? "  OVER" : "");
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+// Measures GLM_GTX_quaternion_batch on random pairs of unit quaternions
+// and interpolation factors in [0, 1]:
+// - batchFastSlerp against slerp computed in double, and glm::slerp,
+// - batchNlerp against nlerp computed in double, and a loop over
+//   normalize(lerp()),
+// - batchMat4Cast against a loop over mat4_cast.
+//
+// The error of an interpolation is the rotation angle between its result and
+// the reference, the worst over all pairs is printed, with the time per
+// quaternion, best of a few runs. The fast slerp bound quoted in
+// quaternion_batch.hpp comes from this tool with the default count.
+//
+//     quatbatch [--count n] [--runs n]
+
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+
+#include "../common/bench.h"
+
+glm::quat randomQuat(Random& random)
+{
+    for(;;) {
+        const glm::vec4 v(random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f),
+                          random.range(-1.0f, 1.0f));
+        const float length = glm::length(v);
+        if(length > 0.1f && length <= 1.0f) {
+            return glm::quat(v.w / length, v.x / length, v.y / length, v.z / length);
+        }
+    }
+}
+
+// Rotation angle between two unit quaternions, in radians.
+double angle(const glm::dvec4& a, const glm::dvec4& b)
+{
+    const glm::dvec4 c = glm::dot(a, b) < 0.0 ? -b : b;
+    return 2.0 * std::atan2(glm::length(a - c), glm::length(a + c));
+}
+
+glm::dvec4 referenceSlerp(glm::dvec4 a, glm::dvec4 b, double t)
+{
+    if(glm::dot(a, b) < 0.0) {
+        b = -b;
+    }
+    const double theta = std::atan2(glm::length(a - b), glm::length(a + b)) * 2.0;
+    if(theta < 1e-9) {
+        return a;
+    }
+    return (a * std::sin((1.0 - t) * theta) + b * std::sin(t * theta)) / std::sin(theta);
+}
+
+glm::dvec4 referenceNlerp(glm::dvec4 a, glm::dvec4 b, double t)
+{
+    if(glm::dot(a, b) < 0.0) {
+        b = -b;
+    }
+    return glm::normalize(a + (b - a) * t);
+}
+
+// Runs function on every quaternion, best of runs, in ns per quaternion.
+template<typename Function>
+double measure(std::size_t count, int runs, Function function)
+{
+    double best = 1e30;
+    for(int run = 0; run < runs; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ns / double(count));
+    }
+    return best;
+}
+
+struct Streams
+{
+    std::vector<float> x, y, z, w;
+    explicit Streams(std::size_t count) : x(count), y(count), z(count), w(count) {}
+    glm::soa_quat soa() { return { x.data(), y.data(), z.data(), w.data() }; }
+    glm::dvec4 at(std::size_t i) const { return glm::dvec4(x[i], y[i], z[i], w[i]); }
+};
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 200000;
+    int runs = 5;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: quatbatch [--count n] [--runs n]\n");
+            return 1;
+        }
+    }
+
+    Random random;
+    std::vector<glm::quat> a(count), b(count), out(count);
+    std::vector<float> t(count);
+    Streams soaA(count), soaB(count), soaOut(count);
+    for(std::size_t i = 0; i < count; i++) {
+        a[i] = randomQuat(random);
+        b[i] = randomQuat(random);
+        t[i] = random.next();
+        soaA.x[i] = a[i].x, soaA.y[i] = a[i].y, soaA.z[i] = a[i].z, soaA.w[i] = a[i].w;
+        soaB.x[i] = b[i].x, soaB.y[i] = b[i].y, soaB.z[i] = b[i].z, soaB.w[i] = b[i].w;
+    }
+    auto dvec = [](const glm::quat& q) { return glm::dvec4(q.x, q.y, q.z, q.w); };
+
+    const char* isa[] = { "scalar", "SSE2", "AVX2/FMA" };
+    std::printf("%zu random pairs, batch kernels: %s, best of %d\n", count, isa[glm::batchIsa()], runs);
+    std::printf("%-22s %16s %12s\n", "", "max error", "time");
+
+    auto report = [&](const char* name, double time, double error) {
+        if(error >= 0.0) {
+            std::printf("%-22s %12.2e rad %9.2f ns\n", name, error, time);
+        }
+        else {
+            std::printf("%-22s %16s %9.2f ns\n", name, "", time);
+        }
+    };
+
+    double time = measure(count, runs, [&]() {
+        for(std::size_t i = 0; i < count; i++) {
+            out[i] = glm::slerp(a[i], b[i], t[i]);
+        }
+    });
+    double error = 0.0;
+    for(std::size_t i = 0; i < count; i++) {
+        error = std::max(error, angle(dvec(out[i]), referenceSlerp(dvec(a[i]), dvec(b[i]), t[i])));
+    }
+    report("glm::slerp", time, error);
+
+    time = measure(count, runs, [&]() { glm::batchFastSlerp(soaA.soa(), soaB.soa(), t.data(), soaOut.soa(), 0, count); });
+    error = 0.0;
+    for(std::size_t i = 0; i < count; i++) {
+        error = std::max(error, angle(soaOut.at(i), referenceSlerp(soaA.at(i), soaB.at(i), t[i])));
+    }
+    report("batchFastSlerp", time, error);
+
+    time = measure(count, runs, [&]() {
+        for(std::size_t i = 0; i < count; i++) {
+            const glm::quat c = glm::dot(a[i], b[i]) < 0.0f ? -b[i] : b[i];
+            out[i] = glm::normalize(glm::lerp(a[i], c, t[i]));
+        }
+    });
+    error = 0.0;
+    for(std::size_t i = 0; i < count; i++) {
+        error = std::max(error, angle(dvec(out[i]), referenceNlerp(dvec(a[i]), dvec(b[i]), t[i])));
+    }
+    report("normalize(lerp())", time, error);
+
+    time = measure(count, runs, [&]() { glm::batchNlerp(soaA.soa(), soaB.soa(), t.data(), soaOut.soa(), 0, count); });
+    error = 0.0;
+    for(std::size_t i = 0; i < count; i++) {
+        error = std::max(error, angle(soaOut.at(i), referenceNlerp(soaA.at(i), soaB.at(i), t[i])));
+    }
+    report("batchNlerp", time, error);
+
+    std::vector<glm::mat4> matrices(count);
+    time = measure(count, runs, [&]() {
+        for(std::size_t i = 0; i < count; i++) {
+            matrices[i] = glm::mat4_cast(a[i]);
+        }
+    });
+    report("mat4_cast", time, -1.0);
+    std::vector<glm::mat4> batched(count);
+    time = measure(count, runs, [&]() { glm::batchMat4Cast(soaA.soa(), batched.data(), 0, count); });
+    float difference = 0.0f;
+    for(std::size_t i = 0; i < count; i++) {
+        for(int c = 0; c < 4; c++) {
+            difference = std::max(difference, glm::length(matrices[i][c] - batched[i][c]));
+        }
+    }
+    report("batchMat4Cast", time, -1.0);
+    std::printf("batchMat4Cast largest column difference from mat4_cast: %.1e\n", double(difference));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+// Measures the render queue's per frame cost on the CPU: submitting n draws
+// then sorting them with the radix sort, against std::sort and
+// std::stable_sort of the same keys, for
+// - random: every key field random, the worst case for the radix sort,
+// - states: 16 program, material and vertex array combinations with random
+//   depths, closer to a scene, where most digits are the same and their
+//   passes are skipped.
+//
+// The sorted keys are checked against std::stable_sort, and the state
+// changes execute() would apply are counted in submission and sorted order.
+// The times are the best of a few frames. No GL context is created, the
+// queue's execute() isn't run.
+//
+//     queue [--draws n] [--frames n]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+#include <gl_render_queue.h>
+
+#include "../common/bench.h"
+
+struct Submission
+{
+    unsigned int layer;
+    unsigned int program;
+    unsigned int material;
+    unsigned int vertexArray;
+    std::uint32_t depth;
+};
+
+// Program, material and vertex array changes between consecutive keys.
+unsigned int stateChanges(const std::vector<std::uint64_t>& keys)
+{
+    const unsigned int stateShift = gl::RenderQueue::depthBits;
+    unsigned int changes = 0;
+    for(std::size_t i = 0; i < keys.size(); i++) {
+        if(i == 0) {
+            changes += 3;
+            continue;
+        }
+        const std::uint64_t differ = (keys[i] ^ keys[i - 1]) >> stateShift;
+        const unsigned int vertexArrayMask = (1u << gl::RenderQueue::vertexArrayBits) - 1;
+        const unsigned int materialMask = (1u << gl::RenderQueue::materialBits) - 1;
+        const unsigned int programMask = (1u << gl::RenderQueue::programBits) - 1;
+        changes += (differ & vertexArrayMask) != 0 ? 1 : 0;
+        changes += ((differ >> gl::RenderQueue::vertexArrayBits) & materialMask) != 0 ? 1 : 0;
+        changes += ((differ >> (gl::RenderQueue::vertexArrayBits + gl::RenderQueue::materialBits)) & programMask) != 0 ? 1 : 0;
+    }
+    return changes;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t draws = 100000;
+    int frames = 10;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--draws" && i + 1 < argc) {
+            draws = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: queue [--draws n] [--frames n]\n");
+            return 1;
+        }
+    }
+
+    gl::RenderQueue queue;
+    for(unsigned int i = 0; i < (1u << gl::RenderQueue::programBits); i++) {
+        queue.registerProgram(gl::Program(i + 1), -1);
+    }
+    for(unsigned int i = 0; i < (1u << gl::RenderQueue::materialBits); i++) {
+        queue.registerMaterial(nullptr, 0);
+    }
+    for(unsigned int i = 0; i < (1u << gl::RenderQueue::vertexArrayBits); i++) {
+        queue.registerVertexArray(gl::VertexArray(i + 1));
+    }
+
+    std::printf("%zu draws, best of %d frames\n", draws, frames);
+    std::printf("%-8s %10s %10s %12s %12s %16s %16s\n", "", "submit", "sort", "std::sort", "stable_sort",
+                "changes before", "changes after");
+
+    const float matrix[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    const gl::RenderQueue::Draw draw = { GL_TRIANGLES, 0, 36, matrix };
+    const char* names[2] = { "random", "states" };
+    for(int kind = 0; kind < 2; kind++) {
+        Random random;
+        std::vector<Submission> submissions(draws);
+        for(Submission& s : submissions) {
+            if(kind == 0) {
+                s = { random.bits() % 16, random.bits() % 1024, random.bits() % 16384, random.bits() % 4096,
+                      random.bits() };
+            }
+            else {
+                const unsigned int state = random.bits() % 16;
+                s = { 0, state % 4, state, state / 2, random.bits() };
+            }
+        }
+
+        std::vector<std::uint64_t> submitted(draws);
+        for(std::size_t i = 0; i < draws; i++) {
+            const Submission& s = submissions[i];
+            submitted[i] = gl::RenderQueue::makeKey(s.layer, s.program, s.material, s.vertexArray, s.depth);
+        }
+
+        double submit = 1e30, sort = 1e30, stdSort = 1e30, stableSort = 1e30;
+        for(int frame = 0; frame < frames; frame++) {
+            queue.clear();
+            auto start = std::chrono::steady_clock::now();
+            for(const Submission& s : submissions) {
+                queue.submit(s.layer, s.program, s.material, s.vertexArray, s.depth, draw);
+            }
+            submit = std::min(submit, milliseconds(start));
+            start = std::chrono::steady_clock::now();
+            queue.sort();
+            sort = std::min(sort, milliseconds(start));
+
+            // the same items as the queue sorts, key and draw index
+            std::vector<std::pair<std::uint64_t, std::uint32_t>> items(draws);
+            for(std::size_t i = 0; i < draws; i++) {
+                items[i] = { submitted[i], std::uint32_t(i) };
+            }
+            std::vector<std::pair<std::uint64_t, std::uint32_t>> stableItems = items;
+            auto byKey = [](const std::pair<std::uint64_t, std::uint32_t>& a,
+                            const std::pair<std::uint64_t, std::uint32_t>& b) { return a.first < b.first; };
+            start = std::chrono::steady_clock::now();
+            std::sort(items.begin(), items.end(), byKey);
+            stdSort = std::min(stdSort, milliseconds(start));
+            start = std::chrono::steady_clock::now();
+            std::stable_sort(stableItems.begin(), stableItems.end(), byKey);
+            stableSort = std::min(stableSort, milliseconds(start));
+
+            if(frame == 0) {
+                for(std::size_t i = 0; i < draws; i++) {
+                    if(queue.key(i) != stableItems[i].first) {
+                        std::fprintf(stderr, "Error: key %zu differs from std::stable_sort\n", i);
+                        return EXIT_FAILURE;
+                    }
+                }
+            }
+        }
+
+        std::vector<std::uint64_t> sorted(draws);
+        for(std::size_t i = 0; i < draws; i++) {
+            sorted[i] = queue.key(i);
+        }
+        std::printf("%-8s %7.2f ms %7.2f ms %9.2f ms %9.2f ms %16u %16u\n", names[kind], submit, sort, stdSort,
+                    stableSort, stateChanges(submitted), stateChanges(sorted));
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,275 @@
+// Compares drawing every iteration, as the examples do, with drawing on
+// demand through FrameScheduler, on a static scene of n small quads:
+// - idle: the loop runs for some seconds without input, the CPU time of the
+//   process over that time is its usage,
+// - input: a thread stands in for the keyboard, posting an event every 20
+//   to 80 ms that changes the scene, as a key callback would. The latency
+//   runs from the post to the end of the frame showing the change, taken
+//   as glFinish() after the swap: the display's scanout isn't counted.
+//
+// The window is small and hidden, the swap interval left as the examples
+// leave it.
+//
+//     redraw [--draws n] [--seconds s] [--inputs n]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+#include <gl_frame_scheduler.h>
+#include <GLFW/glfw3.h>
+
+#include "../common/bench.h"
+
+#define SCREEN_SIZE 128
+
+const char* vertexSource =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 position;\n"
+    "uniform vec2 offset;\n"
+    "void main() { gl_Position = vec4(position + offset, 0.0, 1.0); }\n";
+
+const char* fragmentSource =
+    "#version 330 core\n"
+    "uniform vec4 color;\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = color; }\n";
+
+struct Scene
+{
+    gl::Program program;
+    gl::VertexArray vertexArray;
+    GLint offsetLocation;
+    GLint colorLocation;
+    unsigned int draws;
+    // the quad drawn highlighted, changed by each input
+    unsigned int selected = 0;
+};
+
+// what the keyboard thread posts, one input at a time
+struct Keyboard
+{
+    std::atomic<bool> pending{ false };
+    std::atomic<bool> done{ false };
+    std::chrono::steady_clock::time_point time;
+};
+
+struct Result
+{
+    double cpu = 0.0;
+    double seconds = 0.0;
+    unsigned long iterations = 0;
+    unsigned long frames = 0;
+    std::vector<double> latencies;
+};
+
+gl::Program createProgram(gl::StateCache& state)
+{
+    gl::Program program = state.createProgram();
+    const char* sources[2] = { vertexSource, fragmentSource };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], nullptr);
+        glCompileShader(shader);
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if(!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+            std::fprintf(stderr, "shader compilation error: %s\n", infoLog);
+            std::exit(EXIT_FAILURE);
+        }
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+    return program;
+}
+
+void drawScene(gl::StateCache& state, const Scene& scene)
+{
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    state.useProgram(scene.program);
+    state.bindVertexArray(scene.vertexArray);
+    const unsigned int side = unsigned(std::ceil(std::sqrt(float(scene.draws))));
+    for(unsigned int i = 0; i < scene.draws; i++) {
+        const float step = 2.0f / float(side);
+        glUniform2f(scene.offsetLocation, -1.0f + step * float(i % side), -1.0f + step * float(i / side));
+        if(i == scene.selected) {
+            glUniform4f(scene.colorLocation, 1.0f, 0.8f, 0.2f, 1.0f);
+        }
+        else {
+            glUniform4f(scene.colorLocation, 0.4f, 0.5f, 0.9f, 1.0f);
+        }
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+}
+
+// Runs the loop for seconds, or until the keyboard is done if it has inputs.
+Result run(GLFWwindow* window, gl::StateCache& state, Scene& scene, bool onDemand, double seconds, int inputs)
+{
+    gl::FrameScheduler redraw(onDemand);
+    redraw.setWake(glfwPostEmptyEvent);
+
+    Keyboard keyboard;
+    std::thread thread;
+    if(inputs > 0) {
+        thread = std::thread([&keyboard, inputs]() {
+            Random random;
+            for(int i = 0; i < inputs; i++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20 + random.bits() % 61));
+                keyboard.time = std::chrono::steady_clock::now();
+                keyboard.pending.store(true);
+                glfwPostEmptyEvent();
+                while(keyboard.pending.load()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            keyboard.done.store(true);
+            glfwPostEmptyEvent();
+        });
+    }
+
+    Result result;
+    const double start = glfwGetTime();
+    const std::clock_t cpuStart = std::clock();
+    bool shown = true;
+    std::chrono::steady_clock::time_point inputTime;
+    for(;;) {
+        const double now = glfwGetTime();
+        if(inputs > 0 ? keyboard.done.load() : now - start >= seconds) {
+            break;
+        }
+        // wakes up at the end of an idle run to see it is over
+        redraw.wakeAt(start + seconds);
+        const double wait = redraw.waitTime(now);
+        if(wait == 0.0) {
+            glfwPollEvents();
+        }
+        else if(wait < 0.0) {
+            glfwWaitEvents();
+        }
+        else {
+            glfwWaitEventsTimeout(wait);
+        }
+
+        if(keyboard.pending.load()) {
+            inputTime = keyboard.time;
+            keyboard.pending.store(false);
+            scene.selected = (scene.selected + 1) % scene.draws;
+            shown = false;
+            redraw.invalidate();
+        }
+
+        if(!redraw.beginFrame(glfwGetTime())) {
+            continue;
+        }
+        drawScene(state, scene);
+        glfwSwapBuffers(window);
+        glFinish();
+        if(!shown) {
+            result.latencies.push_back(milliseconds(inputTime));
+            shown = true;
+        }
+    }
+    result.cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    result.seconds = glfwGetTime() - start;
+    result.iterations = redraw.iterationCount();
+    result.frames = redraw.frameCount();
+    if(thread.joinable()) {
+        thread.join();
+    }
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int draws = 1000;
+    double seconds = 2.0;
+    int inputs = 50;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--draws" && i + 1 < argc) {
+            draws = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--seconds" && i + 1 < argc) {
+            seconds = std::max(0.1, std::atof(argv[++i]));
+        }
+        else if(arg == "--inputs" && i + 1 < argc) {
+            inputs = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: redraw [--draws n] [--seconds s] [--inputs n]\n");
+            return 1;
+        }
+    }
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(SCREEN_SIZE, SCREEN_SIZE, "redraw", nullptr, nullptr);
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    gl::StateCache glState;
+    glState.viewport(0, 0, SCREEN_SIZE, SCREEN_SIZE);
+
+    // a quad the size of a grid cell
+    Scene scene;
+    scene.draws = draws;
+    const float size = 1.8f / std::ceil(std::sqrt(float(draws)));
+    const float quad[] = { 0.0f, 0.0f, size, 0.0f, 0.0f, size, size, size };
+    scene.vertexArray = glState.createVertexArray();
+    glState.bindVertexArray(scene.vertexArray);
+    gl::Buffer vbo = glState.createBuffer();
+    glState.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+    scene.program = createProgram(glState);
+    scene.offsetLocation = glGetUniformLocation(scene.program.id, "offset");
+    scene.colorLocation = glGetUniformLocation(scene.program.id, "color");
+
+    std::printf("%u draws, %.1f s idle, %d inputs, %s\n", draws, seconds, inputs,
+                reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-12s %10s %12s %12s %14s %14s\n", "", "idle CPU", "idle frames", "iterations", "latency mean",
+                "latency worst");
+    const char* names[2] = { "every frame", "on demand" };
+    for(int mode = 0; mode < 2; mode++) {
+        const Result idle = run(window, glState, scene, mode == 1, seconds, 0);
+        const Result input = run(window, glState, scene, mode == 1, seconds, inputs);
+        double mean = 0.0, worst = 0.0;
+        for(double latency : input.latencies) {
+            mean += latency;
+            worst = std::max(worst, latency);
+        }
+        mean /= double(std::max<std::size_t>(1, input.latencies.size()));
+        std::printf("%-12s %8.1f %% %12lu %12lu %11.2f ms %11.2f ms\n", names[mode], 100.0 * idle.cpu / idle.seconds,
+                    idle.frames, idle.iterations, mean, worst);
+    }
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
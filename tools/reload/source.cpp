@@ -0,0 +1,253 @@
+// Measures what a shader edit costs the frame: a generated fragment shader
+// of n functions, rewritten with a new constant each time so no shader
+// cache knows it, is rebuilt
+// - blocking: read, compiled and linked within one frame, as
+//   createShaderProgram does at start up,
+// - by ShaderReloader::update() at budgets of 0.25 to 4 ms a frame.
+//
+// Each frame updates the reloader then draws with its program to a small
+// hidden window, waiting for the draw, frames paced at 60 Hz. The spike is
+// the longest update() and the longest frame while a rebuild is under way,
+// the latency the time from the write to the swap, including the 50 ms the
+// reloader waits for the files to settle. Some drivers, Mesa's among them,
+// finish compiling at the first draw with a program, which no budget hides:
+// the frame column shows it. The color uniform is set once at start up and
+// checked after the last swap.
+//
+//     reload [--functions n] [--edits n]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+#include <gl_shader_reload.h>
+#include <GLFW/glfw3.h>
+
+#include "../common/bench.h"
+
+#define SCREEN_SIZE 128
+
+const char* vertexSource =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 position;\n"
+    "void main() { gl_Position = vec4(position, 0.0, 1.0); }\n";
+
+// Functions the optimizer can't drop, each adding to the result a value too
+// small to change the color.
+std::string fragmentSource(unsigned int functions, unsigned int seed)
+{
+    std::string source = "#version 330 core\n"
+                         "uniform vec4 color;\n"
+                         "out vec4 fragColor;\n";
+    source += "const float seed = " + std::to_string(seed) + ".0;\n";
+    for(unsigned int i = 0; i < functions; i++) {
+        const std::string n = std::to_string(i);
+        source += "float f" + n + "(vec2 p) { vec2 q = p * " + n + ".5 + seed; "
+                  "return sin(q.x) * cos(q.y) + fract(dot(q, vec2(" + n + ".25, 0.75))); }\n";
+    }
+    source += "void main() {\n    float sum = 0.0;\n";
+    for(unsigned int i = 0; i < functions; i++) {
+        source += "    sum += f" + std::to_string(i) + "(gl_FragCoord.xy);\n";
+    }
+    source += "    fragColor = color + vec4(sum * 1e-12);\n}\n";
+    return source;
+}
+
+void writeFile(const std::string& path, const std::string& content)
+{
+    std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream << content;
+}
+
+std::string readFile(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+// The way the examples build their programs, all in one go.
+gl::Program buildBlocking(gl::StateCache& state, const std::string& vertexPath, const std::string& fragmentPath)
+{
+    gl::Program program = state.createProgram();
+    const std::string sources[2] = { readFile(vertexPath), readFile(fragmentPath) };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        const char* source = sources[i].c_str();
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if(!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+            std::fprintf(stderr, "shader compilation error: %s\n", infoLog);
+            std::exit(EXIT_FAILURE);
+        }
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+    GLint success = 0;
+    glGetProgramiv(program.id, GL_LINK_STATUS, &success);
+    if(!success) {
+        std::fprintf(stderr, "shader program creation error\n");
+        std::exit(EXIT_FAILURE);
+    }
+    return program;
+}
+
+void draw(gl::StateCache& state, gl::Program program)
+{
+    state.useProgram(program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFinish();
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int functions = 400;
+    int edits = 3;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--functions" && i + 1 < argc) {
+            functions = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--edits" && i + 1 < argc) {
+            edits = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::fprintf(stderr, "usage: reload [--functions n] [--edits n]\n");
+            return 1;
+        }
+    }
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(SCREEN_SIZE, SCREEN_SIZE, "reload", nullptr, nullptr);
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    char directory[] = "/tmp/reloadXXXXXX";
+    if(mkdtemp(directory) == nullptr) {
+        std::fprintf(stderr, "Error: mkdtemp\n");
+        return EXIT_FAILURE;
+    }
+    const std::string vertexPath = std::string(directory) + "/vertex.glsl";
+    const std::string fragmentPath = std::string(directory) + "/fragment.glsl";
+    unsigned int seed = unsigned(std::chrono::system_clock::now().time_since_epoch().count() % 100000);
+    writeFile(vertexPath, vertexSource);
+    writeFile(fragmentPath, fragmentSource(functions, seed++));
+
+    // one triangle covering the window
+    gl::StateCache glState;
+    glState.viewport(0, 0, SCREEN_SIZE, SCREEN_SIZE);
+    const float triangle[] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+    gl::VertexArray vao = glState.createVertexArray();
+    glState.bindVertexArray(vao);
+    gl::Buffer vbo = glState.createBuffer();
+    glState.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+
+    // blocking, the file rewritten before each build like an edit
+    double blockingWorst = 0.0, blockingTotal = 0.0;
+    for(int edit = 0; edit < edits; edit++) {
+        writeFile(fragmentPath, fragmentSource(functions, seed++));
+        const auto start = std::chrono::steady_clock::now();
+        const gl::Program program = buildBlocking(glState, vertexPath, fragmentPath);
+        draw(glState, program);
+        const double frame = milliseconds(start);
+        blockingWorst = std::max(blockingWorst, frame);
+        blockingTotal += frame;
+        glState.deleteProgram(program);
+    }
+
+    gl::ShaderReloader shaders(glState);
+    const unsigned int id = shaders.add(vertexPath, fragmentPath);
+    if(shaders.program(id).id == 0) {
+        std::fprintf(stderr, "%s\n", shaders.log(id).c_str());
+        return EXIT_FAILURE;
+    }
+    if(!shaders.watchError().empty()) {
+        std::fprintf(stderr, "%s\n", shaders.watchError().c_str());
+    }
+    const float color[4] = { 0.25f, 0.5f, 0.75f, 1.0f };
+    glState.useProgram(shaders.program(id));
+    glUniform4fv(glGetUniformLocation(shaders.program(id).id, "color"), 1, color);
+
+    std::printf("fragment shader of %u functions, %zu bytes, %s, parallel compile %s\n", functions,
+                fragmentSource(functions, seed).size(), reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                shaders.parallelCompile() ? "yes" : "no");
+    std::printf("%-16s %14s %14s %10s %12s\n", "", "worst update", "worst frame", "frames", "latency");
+    std::printf("%-16s %11.2f ms %11.2f ms %10d %9.2f ms\n", "blocking", blockingWorst, blockingWorst, 1, blockingTotal / edits);
+
+    const double budgets[] = { 0.25, 0.5, 1.0, 2.0, 4.0 };
+    const auto framePeriod = std::chrono::microseconds(16667);
+    for(double budget : budgets) {
+        double worstUpdate = 0.0, worstFrame = 0.0, latency = 0.0;
+        int rebuildFrames = 0;
+        for(int edit = 0; edit < edits; edit++) {
+            // the watcher compares modification times, which may be coarse
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            writeFile(fragmentPath, fragmentSource(functions, seed++));
+            const auto written = std::chrono::steady_clock::now();
+            const unsigned long swaps = shaders.swapCount(id);
+            while(shaders.swapCount(id) == swaps) {
+                const auto frameStart = std::chrono::steady_clock::now();
+                shaders.update(budget);
+                const double update = milliseconds(frameStart);
+                draw(glState, shaders.program(id));
+                if(shaders.pending(id) || shaders.swapCount(id) != swaps) {
+                    // frames waiting for the files to settle do no work
+                    if(milliseconds(written) >= 50.0) {
+                        rebuildFrames++;
+                    }
+                    worstUpdate = std::max(worstUpdate, update);
+                    worstFrame = std::max(worstFrame, milliseconds(frameStart));
+                }
+                if(shaders.failureCount(id) != 0) {
+                    std::fprintf(stderr, "%s\n", shaders.log(id).c_str());
+                    return EXIT_FAILURE;
+                }
+                std::this_thread::sleep_until(frameStart + framePeriod);
+            }
+            latency += milliseconds(written);
+        }
+        char name[32];
+        std::snprintf(name, sizeof(name), "budget %.2f ms", budget);
+        std::printf("%-16s %11.2f ms %11.2f ms %10.1f %9.2f ms\n", name, worstUpdate, worstFrame,
+                    double(rebuildFrames) / edits, latency / edits);
+    }
+
+    unsigned char pixel[4];
+    glReadPixels(SCREEN_SIZE / 2, SCREEN_SIZE / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    std::printf("color after %lu swaps: %d %d %d, set once to 64 128 191\n", shaders.swapCount(id), pixel[0], pixel[1], pixel[2]);
+
+    std::remove(vertexPath.c_str());
+    std::remove(fragmentPath.c_str());
+    std::remove(directory);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
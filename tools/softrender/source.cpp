@@ -0,0 +1,442 @@
+// Renders the scenes of the examples with the software rasterizer, no GL
+// context or GPU needed, and measures its throughput.
+//
+// The vertex data is the examples', their shaders are ported to C++: the
+// vertex stage runs here, the fragment stage is a function per shader.
+//
+//     softrender [--size WxH] [--time seconds] [--threads n] [--res dir] [ex1 .. ex11]
+//         writes exN.ppm for the scenes given, all of them by default;
+//         --time is what glfwGetTime() returns for the animated ones
+//     softrender --bench [--threads n] [--res dir]
+//         triangles per second and fill rate at 640x480 and 3840x2160
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_soft_rasterizer.h>
+
+// ex1
+const float triangle[] = {
+    -0.5f, -0.5f, 0.0f,
+     0.5f, -0.5f, 0.0f,
+     0.0f,  0.5f, 0.0f
+};
+
+// ex2 to ex4
+const float quad[] = {
+     0.5f,  0.5f, 0.0f,  // top right
+     0.5f, -0.5f, 0.0f,  // bottom right
+    -0.5f, -0.5f, 0.0f,  // bottom left
+    -0.5f,  0.5f, 0.0f   // top left
+};
+const std::uint32_t quadIndices[] = {
+    0, 1, 3,
+    1, 2, 3
+};
+
+// ex5
+const float colorTriangle[] = {
+    // positions         // colors
+     0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,   // bottom right
+    -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,   // bottom left
+     0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f    // top
+};
+
+// ex6 to ex9
+const float texturedQuad[] = {
+    // positions          // colors           // texture coords
+     0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // top right
+     0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // bottom right
+    -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // bottom left
+    -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // top left
+};
+
+// ex10 and ex11
+const float cube[] = {
+    // positions          // texture coords
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
+
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+
+    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+    -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+     0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 1.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
+};
+constexpr unsigned int cubeVertexCount = 36;
+
+const glm::vec3 cubePositions[] = {
+    glm::vec3( 0.0f,  0.0f,  0.0f),
+    glm::vec3( 2.0f,  5.0f, -15.0f),
+    glm::vec3(-1.5f, -2.2f, -2.5f),
+    glm::vec3(-3.8f, -2.0f, -12.3f),
+    glm::vec3( 2.4f, -0.4f, -3.5f),
+    glm::vec3(-1.7f,  3.0f, -7.5f),
+    glm::vec3( 1.3f, -2.0f, -2.5f),
+    glm::vec3( 1.5f,  2.0f, -2.5f),
+    glm::vec3( 1.5f,  0.2f, -1.5f),
+    glm::vec3(-1.3f,  1.0f, -1.5f)
+};
+constexpr unsigned int cubeCount = sizeof(cubePositions) / sizeof(cubePositions[0]);
+
+const glm::vec4 clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+struct Uniforms
+{
+    glm::vec4 color;
+    const gl::SoftTexture* texture1;
+    const gl::SoftTexture* texture2;
+};
+
+// fragment shaders
+
+glm::vec4 shadeUniformColor(const float*, const void* uniforms)
+{
+    return static_cast<const Uniforms*>(uniforms)->color;
+}
+
+glm::vec4 shadeVertexColor(const float* varyings, const void*)
+{
+    return glm::vec4(varyings[0], varyings[1], varyings[2], 1.0f);
+}
+
+// FragColor = texture(ourTexture, texCoord) * vec4(ourColor, 1.0)
+glm::vec4 shadeTextureColor(const float* varyings, const void* uniforms)
+{
+    const Uniforms* u = static_cast<const Uniforms*>(uniforms);
+    return u->texture1->sample(glm::vec2(varyings[3], varyings[4])) * glm::vec4(varyings[0], varyings[1], varyings[2], 1.0f);
+}
+
+// FragColor = mix(texture(texture1, texCoord), texture(texture2, texCoord), 0.3)
+glm::vec4 shadeMixedTextures(const float* varyings, const void* uniforms)
+{
+    const Uniforms* u = static_cast<const Uniforms*>(uniforms);
+    const glm::vec2 texCoord(varyings[0], varyings[1]);
+    return glm::mix(u->texture1->sample(texCoord), u->texture2->sample(texCoord), 0.3f);
+}
+
+// vertex stage: positions at the start of every stride floats, the
+// varyings copied from varyingOffset
+std::vector<gl::SoftVertex> transformVertices(const float* data, unsigned int count, unsigned int stride,
+                                              const glm::mat4& transform, unsigned int varyingOffset, unsigned int varyingCount)
+{
+    std::vector<gl::SoftVertex> vertices(count);
+    for(unsigned int i = 0; i < count; i++) {
+        const float* v = data + i * stride;
+        vertices[i].position = transform * glm::vec4(v[0], v[1], v[2], 1.0f);
+        for(unsigned int k = 0; k < varyingCount; k++) {
+            vertices[i].varyings[k] = v[varyingOffset + k];
+        }
+    }
+    return vertices;
+}
+
+glm::mat4 cameraTransform(int width, int height)
+{
+    const glm::mat4 view = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -3.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(45.0f), float(width) / float(height), 0.1f, 100.0f);
+    return projection * view;
+}
+
+bool loadTexture(gl::SoftTexture& texture, const std::string& path)
+{
+    // the examples upload as GL_RGB, dropping alpha, and don't flip
+    int width, height, channels;
+    unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 3);
+    if(data == nullptr) {
+        std::fprintf(stderr, "couldn't load texture: %s\n", path.c_str());
+        return false;
+    }
+    texture.assign(width, height, 3, data);
+    stbi_image_free(data);
+    return true;
+}
+
+struct Scene
+{
+    gl::SoftTexture container;
+    gl::SoftTexture face;
+    Uniforms uniforms;
+    std::vector<gl::SoftVertex> vertices;
+};
+
+// Draws example number, at time seconds.
+void drawExample(gl::SoftRasterizer& rasterizer, Scene& scene, int number, float time)
+{
+    const int width = rasterizer.width();
+    const int height = rasterizer.height();
+    Uniforms& uniforms = scene.uniforms;
+    uniforms.texture1 = &scene.container;
+    uniforms.texture2 = &scene.face;
+    std::vector<gl::SoftVertex>& vertices = scene.vertices;
+    const glm::mat4 identity(1.0f);
+
+    rasterizer.depthTest(number >= 10);
+    rasterizer.clear(clearColor);
+    switch(number) {
+    case 1:
+        uniforms.color = glm::vec4(1.0f, 0.5f, 0.2f, 1.0f);
+        vertices = transformVertices(triangle, 3, 3, identity, 0, 0);
+        rasterizer.draw(vertices.data(), 3, 0, shadeUniformColor, &uniforms);
+        break;
+    case 2:
+    case 3:
+    case 4:
+        if(number == 2) {
+            uniforms.color = glm::vec4(1.0f, 0.5f, 0.2f, 1.0f);
+        }
+        else if(number == 3) {
+            uniforms.color = glm::vec4(0.5f, 0.0f, 0.0f, 1.0f);
+        }
+        else {
+            uniforms.color = glm::vec4(0.5f, std::sin(time) / 2.0f + 0.5f, 0.0f, 1.0f);
+        }
+        vertices = transformVertices(quad, 4, 3, identity, 0, 0);
+        rasterizer.drawIndexed(vertices.data(), quadIndices, 6, 0, shadeUniformColor, &uniforms);
+        break;
+    case 5:
+        vertices = transformVertices(colorTriangle, 3, 6, identity, 3, 3);
+        rasterizer.draw(vertices.data(), 3, 3, shadeVertexColor, &uniforms);
+        break;
+    case 6:
+        vertices = transformVertices(texturedQuad, 4, 8, identity, 3, 5);
+        rasterizer.drawIndexed(vertices.data(), quadIndices, 6, 5, shadeTextureColor, &uniforms);
+        break;
+    case 7:
+        vertices = transformVertices(texturedQuad, 4, 8, identity, 6, 2);
+        rasterizer.drawIndexed(vertices.data(), quadIndices, 6, 2, shadeMixedTextures, &uniforms);
+        break;
+    case 8: {
+        glm::mat4 transform = glm::translate(identity, glm::vec3(0.5f, -0.5f, 0.0f));
+        transform = glm::rotate(transform, time, glm::vec3(0.0f, 0.0f, 1.0f));
+        vertices = transformVertices(texturedQuad, 4, 8, transform, 6, 2);
+        rasterizer.drawIndexed(vertices.data(), quadIndices, 6, 2, shadeMixedTextures, &uniforms);
+        break;
+    }
+    case 9: {
+        const glm::mat4 model = glm::rotate(identity, glm::radians(-55.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+        vertices = transformVertices(texturedQuad, 4, 8, cameraTransform(width, height) * model, 6, 2);
+        rasterizer.drawIndexed(vertices.data(), quadIndices, 6, 2, shadeMixedTextures, &uniforms);
+        break;
+    }
+    case 10: {
+        // the example accumulates time * 0.05 degrees every frame, at 60 Hz
+        // that's about 1.5 * time^2 degrees
+        const float angle = glm::radians(1.5f * time * time);
+        const glm::mat4 model = glm::rotate(identity, angle, glm::vec3(0.5f, 1.0f, 0.0f));
+        vertices = transformVertices(cube, cubeVertexCount, 5, cameraTransform(width, height) * model, 3, 2);
+        rasterizer.draw(vertices.data(), cubeVertexCount, 2, shadeMixedTextures, &uniforms);
+        break;
+    }
+    case 11:
+        vertices.resize(cubeCount * cubeVertexCount);
+        for(unsigned int i = 0; i < cubeCount; i++) {
+            glm::mat4 model = glm::translate(identity, cubePositions[i]);
+            model = glm::rotate(model, glm::radians(20.0f * float(i)), glm::vec3(1.0f, 0.3f, 0.5f));
+            const std::vector<gl::SoftVertex> transformed = transformVertices(cube, cubeVertexCount, 5, cameraTransform(width, height) * model, 3, 2);
+            std::copy(transformed.begin(), transformed.end(), vertices.begin() + i * cubeVertexCount);
+        }
+        rasterizer.draw(vertices.data(), vertices.size(), 2, shadeMixedTextures, &uniforms);
+        break;
+    }
+    rasterizer.flush();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Triangles per second on a grid of small textured, depth tested
+// triangles, and fill rate from full screen quads.
+void benchmark(Scene& scene, int width, int height, unsigned int threads)
+{
+    gl::SoftRasterizer rasterizer(width, height, threads);
+    Uniforms& uniforms = scene.uniforms;
+    uniforms.texture1 = &scene.container;
+    uniforms.texture2 = &scene.face;
+
+    // grid of cells about 8 pixels wide, two triangles each
+    const int columns = width / 8;
+    const int rows = height / 8;
+    std::vector<gl::SoftVertex> grid;
+    grid.reserve(std::size_t(columns) * std::size_t(rows) * 6);
+    for(int y = 0; y < rows; y++) {
+        for(int x = 0; x < columns; x++) {
+            const float x0 = float(x) / float(columns) * 2.0f - 1.0f;
+            const float x1 = float(x + 1) / float(columns) * 2.0f - 1.0f;
+            const float y0 = float(y) / float(rows) * 2.0f - 1.0f;
+            const float y1 = float(y + 1) / float(rows) * 2.0f - 1.0f;
+            const float corners[6][2] = { { x0, y0 }, { x1, y0 }, { x1, y1 }, { x1, y1 }, { x0, y1 }, { x0, y0 } };
+            for(const float* corner : corners) {
+                gl::SoftVertex vertex;
+                vertex.position = glm::vec4(corner[0], corner[1], 0.5f, 1.0f);
+                vertex.varyings[0] = corner[0] * 4.0f;
+                vertex.varyings[1] = corner[1] * 4.0f;
+                grid.push_back(vertex);
+            }
+        }
+    }
+
+    rasterizer.depthTest(true);
+    rasterizer.clear(clearColor);
+    rasterizer.resetCounters();
+    // a few seconds per test
+    const int gridFrames = std::max(2, 6000000 / (width * height));
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < gridFrames; i++) {
+        rasterizer.clear(clearColor);
+        rasterizer.draw(grid.data(), grid.size(), 2, shadeMixedTextures, &uniforms);
+        rasterizer.flush();
+    }
+    double seconds = secondsSince(start);
+    std::printf("%dx%d, %u threads\n", width, height, rasterizer.threadCount());
+    std::printf("  %zu triangles of %d pixels: %.2f Mtriangles/s, %.1f ms per frame\n", grid.size() / 3,
+                width * height * 2 / int(grid.size() / 3 * 2), double(rasterizer.triangleCount()) / seconds / 1e6,
+                seconds * 1000.0 / gridFrames);
+
+    // overdraw of 8 full screen textured quads, no depth test
+    std::vector<gl::SoftVertex> quadVertices = transformVertices(texturedQuad, 4, 8, glm::scale(glm::mat4(1.0f), glm::vec3(2.0f)), 6, 2);
+    rasterizer.depthTest(false);
+    rasterizer.resetCounters();
+    const int fillFrames = std::max(1, 3000000 / (width * height));
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < fillFrames; i++) {
+        for(int layer = 0; layer < 8; layer++) {
+            rasterizer.drawIndexed(quadVertices.data(), quadIndices, 6, 2, shadeMixedTextures, &uniforms);
+        }
+        rasterizer.flush();
+    }
+    seconds = secondsSince(start);
+    std::printf("  fill, two textures: %.1f Mpixels/s\n", double(rasterizer.fragmentCount()) / seconds / 1e6);
+
+    rasterizer.resetCounters();
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < fillFrames; i++) {
+        for(int layer = 0; layer < 8; layer++) {
+            rasterizer.drawIndexed(quadVertices.data(), quadIndices, 6, 0, shadeUniformColor, &uniforms);
+        }
+        rasterizer.flush();
+    }
+    seconds = secondsSince(start);
+    std::printf("  fill, flat color: %.1f Mpixels/s\n", double(rasterizer.fragmentCount()) / seconds / 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    int width = 640;
+    int height = 480;
+    float time = 1.0f;
+    unsigned int threads = 0;
+    std::string resources = "../../res";
+    bool bench = false;
+    std::vector<int> examples;
+
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--size" && i + 1 < argc && std::sscanf(argv[i + 1], "%dx%d", &width, &height) == 2) {
+            i++;
+        }
+        else if(arg == "--time" && i + 1 < argc) {
+            time = float(std::atof(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else if(arg == "--res" && i + 1 < argc) {
+            resources = argv[++i];
+        }
+        else if(arg == "--bench") {
+            bench = true;
+        }
+        else if(arg.compare(0, 2, "ex") == 0 && std::atoi(arg.c_str() + 2) >= 1 && std::atoi(arg.c_str() + 2) <= 11) {
+            examples.push_back(std::atoi(arg.c_str() + 2));
+        }
+        else {
+            std::fprintf(stderr, "usage: softrender [--size WxH] [--time seconds] [--threads n] [--res dir] [ex1 .. ex11]\n"
+                                 "       softrender --bench [--threads n] [--res dir]\n");
+            return 1;
+        }
+    }
+    if(width <= 0 || height <= 0) {
+        std::fprintf(stderr, "invalid size %dx%d\n", width, height);
+        return 1;
+    }
+
+    Scene scene;
+    if(!loadTexture(scene.container, resources + "/container.jpg") || !loadTexture(scene.face, resources + "/awesomeface.png")) {
+        return 1;
+    }
+
+    if(bench) {
+        benchmark(scene, 640, 480, threads);
+        benchmark(scene, 3840, 2160, threads);
+        return 0;
+    }
+
+    if(examples.empty()) {
+        for(int number = 1; number <= 11; number++) {
+            examples.push_back(number);
+        }
+    }
+    gl::SoftRasterizer rasterizer(width, height, threads);
+    for(int number : examples) {
+        const auto start = std::chrono::steady_clock::now();
+        drawExample(rasterizer, scene, number, time);
+        const double seconds = secondsSince(start);
+        const std::string path = "ex" + std::to_string(number) + ".ppm";
+        if(!rasterizer.writePpm(path.c_str())) {
+            std::fprintf(stderr, "couldn't write %s\n", path.c_str());
+            return 1;
+        }
+        std::printf("%s: %llu triangles, %llu fragments, %.2f ms\n", path.c_str(),
+                    (unsigned long long)rasterizer.triangleCount(), (unsigned long long)rasterizer.fragmentCount(), seconds * 1000.0);
+        rasterizer.resetCounters();
+    }
+    return 0;
+}
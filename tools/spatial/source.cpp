@@ -0,0 +1,294 @@
+// Compares the loose grid with refitting a bounding volume hierarchy when
+// every object moves every frame: 1M unit cubes drifting in a box, like
+// the cubePositions of the examples with many more of them.
+//
+// Each frame moves the cubes on the update threads. The grid gets a move()
+// per cube from those threads then a commit(), the hierarchy gets the new
+// boxes and a refit(). After the last frame both answer the same frustum
+// and range queries, and so does a hierarchy built from scratch, whose
+// tree has not degraded.
+//
+//     spatial [--count n] [--frames n] [--cell size] [--threads n] [--verify]
+//         --verify compares the queries' results with a brute force loop
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gl_bvh.h>
+#include <gl_spatial_grid.h>
+
+#include "../common/bench.h"
+
+gl::Bounds cubeBounds(const glm::vec3& position)
+{
+    return { position - 0.5f, position + 0.5f };
+}
+
+// Runs task(first, last) over [0, count) split between the threads.
+template<typename Task>
+void parallelFor(std::size_t count, unsigned int threads, const Task& task)
+{
+    gl::detail::bvhParallel(threads, [&](unsigned int thread) {
+        task(count * thread / threads, count * (thread + 1) / threads);
+    });
+}
+
+bool overlap(const gl::Bounds& a, const gl::Bounds& b)
+{
+    return glm::all(glm::lessThanEqual(a.low, b.high)) && glm::all(glm::greaterThanEqual(a.high, b.low));
+}
+
+gl::Bounds frustumBounds(const glm::mat4& viewProjection)
+{
+    const glm::mat4 inverse = glm::inverse(viewProjection);
+    gl::Bounds frustum = { glm::vec3(std::numeric_limits<float>::infinity()), glm::vec3(-std::numeric_limits<float>::infinity()) };
+    for(int corner = 0; corner < 8; corner++) {
+        const glm::vec4 point = inverse * glm::vec4(corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f, corner & 4 ? 1.0f : -1.0f, 1.0f);
+        frustum.low = glm::min(frustum.low, glm::vec3(point) / point.w);
+        frustum.high = glm::max(frustum.high, glm::vec3(point) / point.w);
+    }
+    return frustum;
+}
+
+template<typename Query>
+double timeQueries(int count, const Query& query)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < count; i++) {
+        query(i);
+    }
+    return milliseconds(start) / count;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000;
+    int frames = 30;
+    float cellSize = 8.0f;
+    unsigned int threads = 0;
+    bool check = false;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::atoll(argv[++i]));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::atoi(argv[++i]);
+        }
+        else if(arg == "--cell" && i + 1 < argc) {
+            cellSize = float(std::atof(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::atoi(argv[++i]));
+        }
+        else if(arg == "--verify") {
+            check = true;
+        }
+        else {
+            std::fprintf(stderr, "usage: spatial [--count n] [--frames n] [--cell size] [--threads n] [--verify]\n");
+            return 1;
+        }
+    }
+    if(threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    Random random;
+    const float side = 4.0f * std::cbrt(float(count));
+    std::vector<glm::vec3> cubePositions(count), velocities(count);
+    std::vector<gl::Bounds> bounds(count);
+    for(std::size_t i = 0; i < count; i++) {
+        cubePositions[i] = random.vector(0.0f, side);
+        velocities[i] = random.vector(-3.0f, 3.0f);
+        bounds[i] = cubeBounds(cubePositions[i]);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    gl::SpatialGrid grid(cellSize, count, threads);
+    parallelFor(count, threads, [&](std::size_t first, std::size_t last) {
+        for(std::size_t i = first; i < last; i++) {
+            grid.insert(std::uint32_t(i), bounds[i]);
+        }
+    });
+    grid.commit();
+    const double gridBuildTime = milliseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    gl::Bvh bvh;
+    bvh.build(bounds.data(), count, threads);
+    const double bvhBuildTime = milliseconds(start);
+
+    std::printf("%zu cubes in a box of %.0f, %u threads\n", count, side, threads);
+    std::printf("grid insert and commit %.1f ms, %zu cells of %.1f\n", gridBuildTime, grid.cellCount(), cellSize);
+    std::printf("bvh build %.1f ms\n\n", bvhBuildTime);
+
+    // the cubes bounce off the walls at up to 3 units per axis and second
+    double moveTime = 0.0, gridTime = 0.0, commitTime = 0.0, refitTime = 0.0;
+    const float step = 1.0f / 60.0f;
+    for(int frame = 0; frame < frames; frame++) {
+        start = std::chrono::steady_clock::now();
+        parallelFor(count, threads, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++) {
+                glm::vec3& position = cubePositions[i];
+                position += velocities[i] * step;
+                for(int axis = 0; axis < 3; axis++) {
+                    if(position[axis] < 0.0f || position[axis] > side) {
+                        velocities[i][axis] = -velocities[i][axis];
+                        position[axis] = glm::clamp(position[axis], 0.0f, side);
+                    }
+                }
+            }
+        });
+        moveTime += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        parallelFor(count, threads, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++) {
+                grid.move(std::uint32_t(i), cubeBounds(cubePositions[i]));
+            }
+        });
+        const auto commitStart = std::chrono::steady_clock::now();
+        grid.commit();
+        commitTime += milliseconds(commitStart);
+        gridTime += milliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        parallelFor(count, threads, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++) {
+                bounds[i] = cubeBounds(cubePositions[i]);
+            }
+        });
+        bvh.refit(bounds.data());
+        refitTime += milliseconds(start);
+    }
+    std::printf("per frame over %d frames\n", frames);
+    std::printf("  moving the cubes      %8.2f ms\n", moveTime / frames);
+    std::printf("  grid move and commit  %8.2f ms (commit %.2f ms)\n", gridTime / frames, commitTime / frames);
+    std::printf("  bvh bounds and refit  %8.2f ms\n\n", refitTime / frames);
+
+    gl::Bvh rebuilt;
+    start = std::chrono::steady_clock::now();
+    rebuilt.build(bounds.data(), count, threads);
+    const double rebuildTime = milliseconds(start);
+    std::printf("bvh rebuild %.1f ms\n\n", rebuildTime);
+
+    // cameras inside the box seeing a quarter of its side, ranges of 4 to 16
+    const int cameraCount = 64;
+    std::vector<glm::mat4> cameras;
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.5f, side * 0.25f);
+    for(int i = 0; i < cameraCount; i++) {
+        const glm::vec3 eye = random.vector(0.0f, side);
+        cameras.push_back(projection * glm::lookAt(eye, eye + random.vector(-1.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+    const int rangeCount = 1024;
+    std::vector<gl::Bounds> ranges;
+    for(int i = 0; i < rangeCount; i++) {
+        const glm::vec3 low = random.vector(0.0f, side);
+        ranges.push_back({ low, low + random.vector(4.0f, 16.0f) });
+    }
+
+    std::vector<std::uint32_t> found;
+    std::vector<gl::SpatialSpan> spans;
+    std::size_t candidates = 0;
+    const double gridSpanCull = timeQueries(cameraCount, [&](int i) {
+        spans.clear();
+        grid.cullFrustum(cameras[i], spans);
+        for(const gl::SpatialSpan& span : spans) {
+            candidates += span.count;
+        }
+    });
+    const double gridCull = timeQueries(cameraCount, [&](int i) {
+        found.clear();
+        grid.cullFrustum(cameras[i], found);
+    });
+    const double refitCull = timeQueries(cameraCount, [&](int i) {
+        found.clear();
+        bvh.cullFrustum(cameras[i], found);
+    });
+    const double rebuiltCull = timeQueries(cameraCount, [&](int i) {
+        found.clear();
+        rebuilt.cullFrustum(cameras[i], found);
+    });
+    const double gridSpanRange = timeQueries(rangeCount, [&](int i) {
+        spans.clear();
+        grid.queryBounds(ranges[i], spans);
+    });
+    const double gridRange = timeQueries(rangeCount, [&](int i) {
+        found.clear();
+        grid.queryBounds(ranges[i], found);
+    });
+    const double refitRange = timeQueries(rangeCount, [&](int i) {
+        found.clear();
+        bvh.queryBounds(ranges[i], found);
+    });
+    const double rebuiltRange = timeQueries(rangeCount, [&](int i) {
+        found.clear();
+        rebuilt.queryBounds(ranges[i], found);
+    });
+
+    std::printf("%-20s %10s %10s\n", "per query", "frustum", "range");
+    std::printf("%-20s %7.3f ms %7.4f ms\n", "grid spans", gridSpanCull, gridSpanRange);
+    std::printf("%-20s %7.3f ms %7.4f ms\n", "grid", gridCull, gridRange);
+    std::printf("%-20s %7.3f ms %7.4f ms\n", "bvh refit", refitCull, refitRange);
+    std::printf("%-20s %7.3f ms %7.4f ms\n", "bvh rebuilt", rebuiltCull, rebuiltRange);
+    std::printf("%zu objects in the frustum spans on average\n", candidates / cameraCount);
+
+    if(!check) {
+        return 0;
+    }
+    std::size_t wrong = 0;
+    std::vector<std::uint32_t> expected, expectedGrid, other;
+    for(int i = 0; i < cameraCount + rangeCount; i++) {
+        expected.clear();
+        expectedGrid.clear();
+        found.clear();
+        other.clear();
+        if(i < cameraCount) {
+            // same plane test as the queries, the grid also drops the boxes
+            // out of the frustum's box
+            const glm::mat4 m = glm::transpose(cameras[i]);
+            const glm::vec4 planes[6] = { m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[3] + m[2], m[3] - m[2] };
+            const gl::Bounds frustum = frustumBounds(cameras[i]);
+            for(std::size_t k = 0; k < count; k++) {
+                bool outside = false;
+                for(const glm::vec4& plane : planes) {
+                    const glm::vec3 far(plane.x > 0.0f ? bounds[k].high.x : bounds[k].low.x, plane.y > 0.0f ? bounds[k].high.y : bounds[k].low.y,
+                                        plane.z > 0.0f ? bounds[k].high.z : bounds[k].low.z);
+                    outside = outside || glm::dot(glm::vec3(plane), far) + plane.w < 0.0f;
+                }
+                if(!outside) {
+                    expected.push_back(std::uint32_t(k));
+                    if(overlap(bounds[k], frustum)) {
+                        expectedGrid.push_back(std::uint32_t(k));
+                    }
+                }
+            }
+            grid.cullFrustum(cameras[i], found);
+            bvh.cullFrustum(cameras[i], other);
+        }
+        else {
+            const gl::Bounds& range = ranges[i - cameraCount];
+            for(std::size_t k = 0; k < count; k++) {
+                if(overlap(bounds[k], range)) {
+                    expected.push_back(std::uint32_t(k));
+                }
+            }
+            expectedGrid = expected;
+            grid.queryBounds(range, found);
+            bvh.queryBounds(range, other);
+        }
+        std::sort(found.begin(), found.end());
+        std::sort(other.begin(), other.end());
+        wrong += found != expectedGrid || other != expected ? 1 : 0;
+    }
+    std::printf("%zu of %d queries differ\n", wrong, cameraCount + rangeCount);
+    return 0;
+}
@@ -0,0 +1,171 @@
+// Measures what loading GL costs at start up, with the regular glad build
+// and the lazy one (make LAZY=1 in glad), which resolves entry points on
+// their first call. The Makefile links this file twice, startup_eager and
+// startup_lazy, against a glad object built each way.
+//
+// A run creates a hidden window, then times:
+// - the first gladLoadGLLoader() of the process,
+// - the first use of GL after it, a triangle drawn with a small program,
+//   where the lazy build resolves the entry points it calls,
+// - further gladLoadGLLoader() calls in the same process, whose driver
+//   lookups are warm.
+// The first load is only first once per process, so --processes runs the
+// program again that many times and averages what the runs print.
+//
+//     startup_eager [--processes n] [--loads n]
+//     startup_lazy [--processes n] [--loads n]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <gl_state_cache.h>
+
+#include "../common/bench.h"
+
+#ifdef GLAD_LAZY_LOAD
+#define BUILD_NAME "lazy"
+#else
+#define BUILD_NAME "eager"
+#endif
+
+const char* vertexSource =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 position;\n"
+    "void main() { gl_Position = vec4(position, 0.0, 1.0); }\n";
+
+const char* fragmentSource =
+    "#version 330 core\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = vec4(1.0, 0.5, 0.2, 1.0); }\n";
+
+void drawTriangle()
+{
+    gl::StateCache glState;
+    gl::Program program = glState.createProgram();
+    const char* sources[2] = { vertexSource, fragmentSource };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], nullptr);
+        glCompileShader(shader);
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+
+    const float triangle[] = { -1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f };
+    gl::VertexArray vao = glState.createVertexArray();
+    glState.bindVertexArray(vao);
+    gl::Buffer vbo = glState.createBuffer();
+    glState.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+    glState.useProgram(program);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFinish();
+
+    glState.deleteBuffer(vbo);
+    glState.deleteVertexArray(vao);
+    glState.deleteProgram(program);
+}
+
+// One process: prints the first load, the first use and the mean of the
+// further loads, in us.
+int child(int loads)
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(64, 64, "startup", nullptr, nullptr);
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+
+    auto start = std::chrono::steady_clock::now();
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    const double firstLoad = microseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    drawTriangle();
+    const double firstUse = microseconds(start);
+    if(glGetError() != GL_NO_ERROR) {
+        std::fprintf(stderr, "Error: GL error drawing the triangle\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    double reloads = 0.0;
+    for(int i = 0; i < loads; i++) {
+        start = std::chrono::steady_clock::now();
+        gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+        reloads += microseconds(start);
+    }
+    std::printf("%f %f %f\n", firstLoad, firstUse, reloads / std::max(1, loads));
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    int processes = 20;
+    int loads = 20;
+    bool isChild = false;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--processes" && i + 1 < argc) {
+            processes = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--loads" && i + 1 < argc) {
+            loads = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--child") {
+            isChild = true;
+        }
+        else {
+            std::fprintf(stderr, "usage: startup_" BUILD_NAME " [--processes n] [--loads n]\n");
+            return 1;
+        }
+    }
+    if(isChild) {
+        return child(loads);
+    }
+
+    const std::string command = std::string(argv[0]) + " --child --loads " + std::to_string(loads);
+    double firstLoad = 0.0, firstUse = 0.0, reload = 0.0;
+    double worstLoad = 0.0;
+    for(int i = 0; i < processes; i++) {
+        FILE* pipe = popen(command.c_str(), "r");
+        double values[3];
+        const int read = pipe != nullptr ? std::fscanf(pipe, "%lf %lf %lf", &values[0], &values[1], &values[2]) : 0;
+        if(pipe == nullptr || pclose(pipe) != 0 || read != 3) {
+            std::fprintf(stderr, "Error: %s failed\n", command.c_str());
+            return EXIT_FAILURE;
+        }
+        firstLoad += values[0];
+        firstUse += values[1];
+        reload += values[2];
+        worstLoad = std::max(worstLoad, values[0]);
+    }
+    std::printf("%s glad, mean of %d processes\n", BUILD_NAME, processes);
+    std::printf("  %-24s %9.1f us (worst %.1f us)\n", "first load", firstLoad / processes, worstLoad);
+    std::printf("  %-24s %9.1f us\n", "first triangle", firstUse / processes);
+    std::printf("  %-24s %9.1f us\n", "load first + triangle", (firstLoad + firstUse) / processes);
+    std::printf("  %-24s %9.1f us, mean of %d\n", "further loads", reload / processes, loads);
+    return EXIT_SUCCESS;
+}
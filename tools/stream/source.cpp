@@ -0,0 +1,351 @@
+// Measures how fast gl::StreamBuffer streams per frame data to the GPU,
+// against the naive uploads it replaces. Each frame writes n MB of points
+// and draws them, for
+// - persistent: StreamBuffer on a persistently mapped buffer
+//   (GL_ARB_buffer_storage),
+// - unsynchronized: StreamBuffer on the 3.3 path, a GL_MAP_UNSYNCHRONIZED_BIT
+//   map of the region per frame,
+// - orphaning: glBufferData with the data every frame,
+// - subdata: glBufferSubData into a buffer allocated once.
+// Only the first --points points of a frame are drawn, so that drawing them
+// doesn't hide the uploads on a software driver, the GPU still reads the
+// buffer written that frame.
+//
+// MB/s is the data streamed over the wall time of all the frames, GPU
+// included. The upload column is the CPU time of the uploads per frame,
+// where the naive paths pay for the driver's synchronization, the stall
+// columns are the fence waits StreamBuffer reported. The last frames of the
+// paths are compared.
+//
+// Last, --threads threads fill a region with 64 byte allocations at once,
+// which measures allocate()'s compare and swap under contention and checks
+// that no two allocations overlap.
+//
+//     stream [--megabytes n] [--points n] [--frames n] [--threads n]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gl_state_cache.h>
+#include <gl_stream_buffer.h>
+#include <GLFW/glfw3.h>
+
+#include "../common/bench.h"
+
+#define SCREEN_SIZE 256
+
+const char* vertexSource =
+    "#version 330 core\n"
+    "layout(location = 0) in vec4 point;\n"
+    "out vec3 color;\n"
+    "void main() { color = point.xyz * 0.5 + 0.5; gl_Position = vec4(point.xyz, 1.0); }\n";
+
+const char* fragmentSource =
+    "#version 330 core\n"
+    "in vec3 color;\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = vec4(color, 1.0); }\n";
+
+gl::Program createProgram(gl::StateCache& state)
+{
+    gl::Program program = state.createProgram();
+    const char* sources[2] = { vertexSource, fragmentSource };
+    const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    for(int i = 0; i < 2; i++) {
+        GLuint shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], nullptr);
+        glCompileShader(shader);
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if(!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+            std::fprintf(stderr, "shader compilation error: %s\n", infoLog);
+            std::exit(EXIT_FAILURE);
+        }
+        glAttachShader(program.id, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(program.id);
+    return program;
+}
+
+enum Path { Persistent, Unsynchronized, Orphaning, SubData, PathCount };
+
+const char* pathNames[PathCount] = { "persistent", "unsynchronized", "orphaning", "subdata" };
+
+struct Result
+{
+    double megabytesPerSecond = 0.0;
+    double upload = 0.0;
+    std::vector<unsigned char> image;
+};
+
+Result run(GLFWwindow* window, gl::StateCache& state, Path path, const std::vector<float>& points, GLsizei drawn,
+           int frames)
+{
+    const std::size_t bytes = points.size() * sizeof(float);
+    const GLsizei count = std::min(drawn, GLsizei(points.size() / 4));
+
+    gl::VertexArray vao = state.createVertexArray();
+    state.bindVertexArray(vao);
+    gl::StreamBuffer stream;
+    gl::Buffer buffer;
+    if(path == Persistent || path == Unsynchronized) {
+        if(!stream.init(state, GL_ARRAY_BUFFER, bytes, path == Persistent)) {
+            std::fprintf(stderr, "Error: stream buffer of %zu bytes per frame not allocated\n", bytes);
+            std::exit(EXIT_FAILURE);
+        }
+        // a failed persistent mapping falls back to the 3.3 path, which
+        // would be measured under the wrong name
+        if(stream.persistentlyMapped() != (path == Persistent)) {
+            std::fprintf(stderr, "Error: persistent mapping failed\n");
+            std::exit(EXIT_FAILURE);
+        }
+        buffer = stream.buffer();
+    }
+    else {
+        buffer = state.createBuffer();
+        state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(bytes), nullptr, GL_STREAM_DRAW);
+    }
+    // the stream regions are 16 byte aligned, a frame draws from the first
+    // point of its allocation
+    state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+
+    Result result;
+    std::chrono::steady_clock::time_point start;
+    // the first frame allocates and maps, it isn't counted
+    for(int frame = 0; frame <= frames; frame++) {
+        if(frame == 1) {
+            glFinish();
+            start = std::chrono::steady_clock::now();
+        }
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        const auto uploadStart = std::chrono::steady_clock::now();
+        GLint first = 0;
+        if(path == Persistent || path == Unsynchronized) {
+            stream.begin(state);
+            const gl::StreamBuffer::Allocation allocation = stream.allocate(bytes, 16);
+            if(allocation.data == nullptr) {
+                std::fprintf(stderr, "Error: %zu bytes refused\n", bytes);
+                std::exit(EXIT_FAILURE);
+            }
+            std::memcpy(allocation.data, points.data(), bytes);
+            stream.commit(state);
+            first = GLint(allocation.offset / GLintptr(4 * sizeof(float)));
+        }
+        else {
+            state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+            if(path == Orphaning) {
+                glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(bytes), points.data(), GL_STREAM_DRAW);
+            }
+            else {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, GLsizeiptr(bytes), points.data());
+            }
+        }
+        if(frame > 0) {
+            result.upload += milliseconds(uploadStart);
+        }
+
+        glDrawArrays(GL_POINTS, first, count);
+        if(path == Persistent || path == Unsynchronized) {
+            stream.end();
+        }
+        if(frame == frames) {
+            result.image.resize(SCREEN_SIZE * SCREEN_SIZE * 4);
+            glReadPixels(0, 0, SCREEN_SIZE, SCREEN_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, result.image.data());
+        }
+        glfwSwapBuffers(window);
+    }
+    glFinish();
+    const double total = milliseconds(start);
+    result.megabytesPerSecond = double(bytes) * frames / (1024.0 * 1024.0) / (total / 1000.0);
+    result.upload /= frames;
+
+    if(path == Persistent || path == Unsynchronized) {
+        std::printf("%-16s %9.0f %9.2f ms %8lu %9.2f ms\n", pathNames[path], result.megabytesPerSecond, result.upload,
+                    stream.stalledFrames(), double(stream.stallNanoseconds()) / 1e6);
+        stream.release(state);
+    }
+    else {
+        std::printf("%-16s %9.0f %9.2f ms %8s %12s\n", pathNames[path], result.megabytesPerSecond, result.upload, "-", "-");
+        state.deleteBuffer(buffer);
+    }
+    state.deleteVertexArray(vao);
+    return result;
+}
+
+// Threads fill one region with 64 byte allocations, each thread writes its
+// index in the bytes it got, so an overlap shows as a foreign byte.
+void contend(gl::StateCache& state, unsigned int threads, int frames)
+{
+    const std::size_t size = 64;
+    gl::StreamBuffer stream;
+    if(!stream.init(state, GL_ARRAY_BUFFER, 16 << 20)) {
+        std::fprintf(stderr, "Error: stream buffer of 16 MB per frame not allocated\n");
+        std::exit(EXIT_FAILURE);
+    }
+    const std::size_t perRegion = stream.bytesPerFrame() / size;
+
+    double best = 1e30;
+    for(int frame = 0; frame < frames; frame++) {
+        stream.begin(state);
+        std::vector<std::vector<gl::StreamBuffer::Allocation>> got(threads);
+        std::atomic<unsigned int> ready{ 0 };
+        std::vector<std::thread> workers;
+        const auto start = std::chrono::steady_clock::now();
+        for(unsigned int t = 0; t < threads; t++) {
+            workers.emplace_back([&, t]() {
+                ready.fetch_add(1);
+                while(ready.load() < threads) {
+                }
+                for(;;) {
+                    const gl::StreamBuffer::Allocation allocation = stream.allocate(size, 16);
+                    if(allocation.data == nullptr) {
+                        break;
+                    }
+                    std::memset(allocation.data, int(t), size);
+                    got[t].push_back(allocation);
+                }
+            });
+        }
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+        best = std::min(best, milliseconds(start));
+
+        std::size_t total = 0;
+        for(unsigned int t = 0; t < threads; t++) {
+            total += got[t].size();
+            for(const gl::StreamBuffer::Allocation& allocation : got[t]) {
+                const unsigned char* bytes = static_cast<const unsigned char*>(allocation.data);
+                if(std::count(bytes, bytes + size, static_cast<unsigned char>(t)) != std::ptrdiff_t(size)) {
+                    std::fprintf(stderr, "Error: allocations overlap at offset %ld\n", long(allocation.offset));
+                    std::exit(EXIT_FAILURE);
+                }
+            }
+        }
+        if(total != perRegion) {
+            std::fprintf(stderr, "Error: %zu allocations of %zu fit in the region\n", total, perRegion);
+            std::exit(EXIT_FAILURE);
+        }
+        stream.commit(state);
+        stream.end();
+    }
+    std::printf("%u threads: %zu allocations of %zu bytes per region in %.2f ms, %.0fM allocations/s, none overlap\n",
+                threads, perRegion, size, best, double(perRegion) / best / 1000.0);
+    stream.release(state);
+}
+
+int main(int argc, char** argv)
+{
+    int megabytes = 8;
+    GLsizei drawn = 4096;
+    int frames = 60;
+    unsigned int threads = 4;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--megabytes" && i + 1 < argc) {
+            megabytes = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--points" && i + 1 < argc) {
+            drawn = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else {
+            std::fprintf(stderr, "usage: stream [--megabytes n] [--points n] [--frames n] [--threads n]\n");
+            return 1;
+        }
+    }
+
+    // persistent mapping needs 4.4 or GL_ARB_buffer_storage, macOS stops at
+    // 4.1 and only gets the 3.3 paths
+    glfwInit();
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    const int versions[3][2] = { { 4, 6 }, { 4, 4 }, { 3, 3 } };
+    GLFWwindow* window = nullptr;
+    for(const int* version : versions) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, version[0]);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, version[1]);
+        window = glfwCreateWindow(SCREEN_SIZE, SCREEN_SIZE, "stream", nullptr, nullptr);
+        if(window != nullptr) {
+            break;
+        }
+    }
+    if(window == nullptr) {
+        std::fprintf(stderr, "Error: glfwCreateWindow\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+        std::fprintf(stderr, "Error: gladLoadGLLoader\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    gl::StateCache glState;
+    glState.viewport(0, 0, SCREEN_SIZE, SCREEN_SIZE);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    const gl::Program program = createProgram(glState);
+    glState.useProgram(program);
+
+    Random random;
+    std::vector<float> points(std::size_t(megabytes) * 1024 * 1024 / sizeof(float));
+    for(std::size_t i = 0; i < points.size(); i += 4) {
+        points[i] = random.next() * 2.0f - 1.0f;
+        points[i + 1] = random.next() * 2.0f - 1.0f;
+        points[i + 2] = random.next() * 2.0f - 1.0f;
+        points[i + 3] = 1.0f;
+    }
+
+    std::printf("%d MB per frame, %d frames, %s, %s\n", megabytes, frames,
+                reinterpret_cast<const char*>(glGetString(GL_VERSION)), reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-16s %9s %12s %8s %12s\n", "", "MB/s", "upload", "stalls", "stalled");
+    std::vector<unsigned char> reference;
+    for(int path = 0; path < PathCount; path++) {
+        if(path == Persistent && !GLAD_GL_ARB_buffer_storage) {
+            std::printf("%-16s not supported, needs GL 4.4 or GL_ARB_buffer_storage\n", pathNames[path]);
+            continue;
+        }
+        const Result result = run(window, glState, Path(path), points, drawn, frames);
+        if(reference.empty()) {
+            reference = result.image;
+        }
+        else if(result.image != reference) {
+            std::fprintf(stderr, "Error: %s draws a different image\n", pathNames[path]);
+            glfwTerminate();
+            return EXIT_FAILURE;
+        }
+    }
+    if(glGetError() != GL_NO_ERROR) {
+        std::fprintf(stderr, "Error: GL error while streaming\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    contend(glState, threads, std::min(frames, 10));
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,270 @@
+// Checks and measures batchSinCos of GLM_GTX_trigonometric_batch.
+//
+// The accuracy check runs batchSinCos on every finite float, or every
+// step-th one, and compares sin and cos with std::sin and std::cos in double
+// precision. The error is in units in the last place of the exact result, as
+// a float, and absolute. Inputs up to 2^20 go through the polynomials,
+// beyond through the std fallback, so both ranges are reported. The tool
+// fails when the polynomial range is over 2 ulp or 2e-7 absolute, the
+// bounds quoted in trigonometric_batch.hpp with some slack.
+//
+// The benchmark times batchSinCos against std::sin and std::cos in float,
+// and against fastSin and fastCos of GLM_GTX_fast_trigonometry, whose
+// absolute error it prints, on random angles in [-pi, pi] and [-100, 100].
+// It then times both forms of batchRotate against glm::rotate, on their own
+// and applied to translations, and fails when they differ by over 1e-6.
+//
+//     trig [--step n] [--threads n] [--count n]
+//         --step 1, the default, checks all 2^32 - 2^24 finite floats
+
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtx/trigonometric_batch.hpp>
+
+#include "../common/bench.h"
+
+// Error of result in units in the last place of exact rounded to float,
+// denormal spacing below the smallest normal.
+double ulpError(float result, double exact)
+{
+    const double magnitude = std::abs(exact);
+    const double spacing = magnitude < 1.1754943508222875e-38 ? std::ldexp(1.0, -149)
+                                                             : std::ldexp(1.0, std::ilogb(magnitude) - 23);
+    return std::abs(double(result) - exact) / spacing;
+}
+
+struct Errors
+{
+    double ulp = 0.0;
+    double absolute = 0.0;
+    float worstAngle = 0.0f;
+
+    void add(float angle, float result, double exact)
+    {
+        const double ulps = ulpError(result, exact);
+        if(ulps > ulp) {
+            ulp = ulps;
+            worstAngle = angle;
+        }
+        absolute = std::max(absolute, std::abs(double(result) - exact));
+    }
+
+    void merge(const Errors& other)
+    {
+        if(other.ulp > ulp) {
+            ulp = other.ulp;
+            worstAngle = other.worstAngle;
+        }
+        absolute = std::max(absolute, other.absolute);
+    }
+};
+
+// Errors of sin and cos, within the polynomial range and beyond.
+struct Check
+{
+    Errors sin[2];
+    Errors cos[2];
+    std::uint64_t count[2] = { 0, 0 };
+};
+
+// Every step-th bit pattern of [first, last) that is a finite float.
+void check(std::uint64_t first, std::uint64_t last, std::uint64_t step, Check& result)
+{
+    const std::size_t chunk = 4096;
+    std::vector<float> angles(chunk), sines(chunk), cosines(chunk);
+    std::uint64_t bits = first;
+    while(bits < last) {
+        std::size_t n = 0;
+        for(; n < chunk && bits < last; bits += step) {
+            const std::uint32_t pattern = std::uint32_t(bits);
+            float angle;
+            std::memcpy(&angle, &pattern, sizeof(angle));
+            if(std::isfinite(angle)) {
+                angles[n++] = angle;
+            }
+        }
+        glm::batchSinCos(angles.data(), sines.data(), cosines.data(), 0, n);
+        for(std::size_t i = 0; i < n; i++) {
+            const int range = std::abs(angles[i]) <= 1048576.0f ? 0 : 1;
+            result.sin[range].add(angles[i], sines[i], std::sin(double(angles[i])));
+            result.cos[range].add(angles[i], cosines[i], std::cos(double(angles[i])));
+            result.count[range]++;
+        }
+    }
+}
+
+// Largest component difference between two arrays of count matrices.
+float maxDifference(const glm::mat4* a, const glm::mat4* b, std::size_t count)
+{
+    float difference = 0.0f;
+    for(std::size_t i = 0; i < count; i++) {
+        for(int c = 0; c < 4; c++) {
+            for(int r = 0; r < 4; r++) {
+                difference = std::max(difference, std::abs(a[i][c][r] - b[i][c][r]));
+            }
+        }
+    }
+    return difference;
+}
+
+// Runs function, which computes count sines and cosines or matrices, best
+// of 5, in ns per angle.
+template<typename Function>
+double measure(std::size_t count, Function function)
+{
+    double best = 1e30;
+    for(int run = 0; run < 5; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        best = std::min(best, milliseconds(start) * 1e6 / double(count));
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    std::uint64_t step = 1;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t count = 1 << 20;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--step" && i + 1 < argc) {
+            step = std::uint64_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--threads" && i + 1 < argc) {
+            threads = unsigned(std::max(1, std::atoi(argv[++i])));
+        }
+        else if(arg == "--count" && i + 1 < argc) {
+            count = std::size_t(std::max(1, std::atoi(argv[++i])));
+        }
+        else {
+            std::fprintf(stderr, "usage: trig [--step n] [--threads n] [--count n]\n");
+            return 1;
+        }
+    }
+
+    const char* isa[] = { "scalar", "SSE2", "AVX2/FMA" };
+    std::printf("batch kernels: %s\n", isa[glm::batchIsa()]);
+
+    // the 2^32 bit patterns split between the threads on step boundaries
+    const auto checkStart = std::chrono::steady_clock::now();
+    std::vector<Check> checks(threads);
+    std::vector<std::thread> workers;
+    const std::uint64_t patterns = std::uint64_t(1) << 32;
+    const std::uint64_t steps = (patterns + step - 1) / step;
+    for(unsigned int t = 0; t < threads; t++) {
+        const std::uint64_t first = steps * t / threads * step;
+        const std::uint64_t last = std::min(patterns, steps * (t + 1) / threads * step);
+        workers.emplace_back([first, last, step, &checks, t]() { check(first, last, step, checks[t]); });
+    }
+    Check total;
+    for(unsigned int t = 0; t < threads; t++) {
+        workers[t].join();
+        for(int range = 0; range < 2; range++) {
+            total.sin[range].merge(checks[t].sin[range]);
+            total.cos[range].merge(checks[t].cos[range]);
+            total.count[range] += checks[t].count[range];
+        }
+    }
+    const std::string which = step == 1 ? "every finite float" : "every " + std::to_string(step) + "th finite float";
+    std::printf("accuracy over %s, %.1f s\n", which.c_str(), milliseconds(checkStart) / 1000.0);
+    const char* rangeNames[2] = { "|x| <= 2^20", "|x| > 2^20" };
+    for(int range = 0; range < 2; range++) {
+        std::printf("  %-12s %11llu angles  sin %5.2f ulp %8.1e abs (worst at %.9g)  cos %5.2f ulp %8.1e abs (worst at %.9g)\n",
+                    rangeNames[range], static_cast<unsigned long long>(total.count[range]), total.sin[range].ulp,
+                    total.sin[range].absolute, double(total.sin[range].worstAngle), total.cos[range].ulp,
+                    total.cos[range].absolute, double(total.cos[range].worstAngle));
+    }
+    const bool failed = total.sin[0].ulp > 2.0 || total.cos[0].ulp > 2.0
+                     || total.sin[0].absolute > 2e-7 || total.cos[0].absolute > 2e-7;
+
+    std::printf("%zu random angles, ns per angle for sin and cos\n", count);
+    std::printf("  %-20s %14s %14s %14s %16s\n", "", "batchSinCos", "std::sin/cos", "fastSin/Cos", "fast max error");
+    std::vector<float> angles(count), sines(count), cosines(count);
+    const float ranges[2] = { 3.14159265f, 100.0f };
+    for(float extent : ranges) {
+        Random random;
+        for(float& angle : angles) {
+            angle = random.range(-extent, extent);
+        }
+        const double batch = measure(count, [&]() { glm::batchSinCos(angles.data(), sines.data(), cosines.data(), 0, count); });
+        const double standard = measure(count, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                sines[i] = std::sin(angles[i]);
+                cosines[i] = std::cos(angles[i]);
+            }
+        });
+        const double fast = measure(count, [&]() {
+            for(std::size_t i = 0; i < count; i++) {
+                sines[i] = glm::fastSin(angles[i]);
+                cosines[i] = glm::fastCos(angles[i]);
+            }
+        });
+        double fastError = 0.0;
+        for(std::size_t i = 0; i < count; i++) {
+            fastError = std::max(fastError, std::abs(double(sines[i]) - std::sin(double(angles[i]))));
+            fastError = std::max(fastError, std::abs(double(cosines[i]) - std::cos(double(angles[i]))));
+        }
+        char name[32];
+        std::snprintf(name, sizeof(name), "[-%g, %g]", double(extent), double(extent));
+        std::printf("  %-20s %11.2f ns %11.2f ns %11.2f ns %12.1e abs\n", name, batch, standard, fast, fastError);
+    }
+
+    // rotations of random angles in [-pi, pi] around one axis, then the
+    // same applied to translations in [-10, 10]
+    const std::size_t matrices = std::max<std::size_t>(1, count / 16);
+    std::printf("%zu random rotations, ns per matrix\n", matrices);
+    std::printf("  %-20s %14s %14s %16s\n", "", "batchRotate", "glm::rotate", "max difference");
+    const glm::vec3 axis(1.0f, 0.3f, 0.5f);
+    std::vector<glm::mat4> parents(matrices), expected(matrices), rotations(matrices);
+    Random random;
+    for(std::size_t i = 0; i < matrices; i++) {
+        angles[i] = random.range(-3.14159265f, 3.14159265f);
+        parents[i] = glm::translate(glm::mat4(1.0f), random.vector(-10.0f, 10.0f));
+    }
+    float rotateDifference = 0.0f;
+    for(int applied = 0; applied < 2; applied++) {
+        const glm::mat4* from = applied ? parents.data() : nullptr;
+        const double single = measure(matrices, [&]() {
+            for(std::size_t i = 0; i < matrices; i++) {
+                expected[i] = glm::rotate(from ? from[i] : glm::mat4(1.0f), angles[i], axis);
+            }
+        });
+        const double batch = measure(matrices, [&]() {
+            if(from) {
+                glm::batchRotate(from, angles.data(), axis, rotations.data(), 0, matrices);
+            }
+            else {
+                glm::batchRotate(angles.data(), axis, rotations.data(), 0, matrices);
+            }
+        });
+        const float difference = maxDifference(rotations.data(), expected.data(), matrices);
+        rotateDifference = std::max(rotateDifference, difference);
+        std::printf("  %-20s %11.2f ns %11.2f ns %12.1e abs\n", applied ? "applied to parents" : "rotations", batch,
+                    single, double(difference));
+    }
+
+    if(failed) {
+        std::fprintf(stderr, "batchSinCos is over 2 ulp or 2e-7 absolute error for |x| <= 2^20\n");
+        return EXIT_FAILURE;
+    }
+    if(rotateDifference > 1e-6f) {
+        std::fprintf(stderr, "batchRotate differs from glm::rotate by over 1e-6\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}